@@ -21,6 +21,7 @@
 #include <Library/DebugLib.h>
 #include <Library/DevicePathLib.h>
 #include <Library/NetLib.h>
+#include <Library/SnpPerfLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiDriverEntryPoint.h>
 #include <Library/UefiLib.h>
@@ -69,7 +70,12 @@
 #define USB_NETWORK_CLASS   0x09    ///<  USB Network class code
 #define USB_BUS_TIMEOUT     1000    ///<  USB timeout in milliseconds
 
-#define AX88179_BULKIN_SIZE_INK     2
+//
+//  Size in KB of the host bulk-in staging buffer.  This must cover the
+//  aggregate size programmed into RXBINQSIZE so that a multi-packet
+//  burst from the adapter fits in a single transfer.
+//
+#define AX88179_BULKIN_SIZE_INK     16
 #define AX88179_MAX_BULKIN_SIZE    (1024 * AX88179_BULKIN_SIZE_INK)
 #define AX88179_MAX_PKT_SIZE  2048
 
@@ -294,6 +300,8 @@ typedef struct {
   BOOLEAN                   SetZeroLen;
   UINT8                     RxBurst;
   UINTN                     UsbMaxPktSize;
+
+  SNP_PERF_STATS            *PerfStats;         ///<  Entry in the shared SNP perf table
 } NIC_DEVICE;
 
 #define DEV_FROM_SIMPLE_NETWORK(a)  CR (a, NIC_DEVICE, SimpleNetwork, DEV_SIGNATURE)  ///< Locate NIC_DEVICE from Simple Network Protocol
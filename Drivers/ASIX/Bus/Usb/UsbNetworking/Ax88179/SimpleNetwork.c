@@ -892,6 +892,98 @@ SN_Reset (
   return Status;
 }
 
+/**
+  Performance accounting wrapper around ::SN_Transmit, recording packet
+  and byte counts, busy rejections and the time spent in the call.
+
+  See ::SN_Transmit for the parameter and return value documentation.
+
+**/
+EFI_STATUS
+EFIAPI
+SN_TransmitTimed (
+  IN EFI_SIMPLE_NETWORK_PROTOCOL *SimpleNetwork,
+  IN UINTN                       HeaderSize,
+  IN UINTN                       BufferSize,
+  IN VOID                        *Buffer,
+  IN EFI_MAC_ADDRESS             *SrcAddr,
+  IN EFI_MAC_ADDRESS             *DestAddr,
+  IN UINT16                      *Protocol
+  )
+{
+  SNP_PERF_STATS          *Stats;
+  EFI_STATUS              Status;
+  UINT64                  Start;
+
+  Start = SnpPerfTimestamp ();
+  Status = SN_Transmit (SimpleNetwork,
+                         HeaderSize,
+                         BufferSize,
+                         Buffer,
+                         SrcAddr,
+                         DestAddr,
+                         Protocol);
+
+  if (SimpleNetwork != NULL) {
+    Stats = DEV_FROM_SIMPLE_NETWORK (SimpleNetwork)->PerfStats;
+    SnpPerfAddElapsed (&Stats->TxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->TxPackets++;
+      Stats->TxBytes += BufferSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->TxRingFull++;
+    }
+  }
+
+  return Status;
+}
+
+/**
+  Performance accounting wrapper around ::SN_Receive, recording packet
+  and byte counts, empty polls and the time spent in the call.
+
+  See ::SN_Receive for the parameter and return value documentation.
+
+**/
+EFI_STATUS
+EFIAPI
+SN_ReceiveTimed (
+  IN  EFI_SIMPLE_NETWORK_PROTOCOL *SimpleNetwork,
+  OUT UINTN                       *HeaderSize,
+  OUT UINTN                       *BufferSize,
+  OUT VOID                        *Buffer,
+  OUT EFI_MAC_ADDRESS             *SrcAddr,
+  OUT EFI_MAC_ADDRESS             *DestAddr,
+  OUT UINT16                      *Protocol
+  )
+{
+  SNP_PERF_STATS          *Stats;
+  EFI_STATUS              Status;
+  UINT64                  Start;
+
+  Start = SnpPerfTimestamp ();
+  Status = SN_Receive (SimpleNetwork,
+                        HeaderSize,
+                        BufferSize,
+                        Buffer,
+                        SrcAddr,
+                        DestAddr,
+                        Protocol);
+
+  if (SimpleNetwork != NULL) {
+    Stats = DEV_FROM_SIMPLE_NETWORK (SimpleNetwork)->PerfStats;
+    SnpPerfAddElapsed (&Stats->RxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->RxPackets++;
+      Stats->RxBytes += *BufferSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->RxPollEmpty++;
+    }
+  }
+
+  return Status;
+}
+
 /**
   Initialize the simple network protocol.
 
@@ -928,8 +1020,8 @@ SN_Setup (
   SimpleNetwork->MCastIpToMac = SN_MCastIPtoMAC;
   SimpleNetwork->NvData = SN_NvData;
   SimpleNetwork->GetStatus = SN_GetStatus;
-  SimpleNetwork->Transmit = SN_Transmit;
-  SimpleNetwork->Receive = SN_Receive;
+  SimpleNetwork->Transmit = SN_TransmitTimed;
+  SimpleNetwork->Receive = SN_ReceiveTimed;
   SimpleNetwork->WaitForPacket = NULL;
   Mode = &NicDevice->SimpleNetworkData;
   SimpleNetwork->Mode = Mode;
@@ -969,6 +1061,7 @@ SN_Setup (
   NicDevice->FirstRst = TRUE;
   NicDevice->PktCnt = 0;
   NicDevice->SkipRXCnt = 0;
+  NicDevice->PerfStats = SnpPerfRegister ("Ax88179");
   NicDevice->UsbMaxPktSize = 512;
   NicDevice->SetZeroLen = TRUE;
 
@@ -1035,10 +1035,25 @@ Ax88772UsbCommand (
   return Status;
 }
 
-BOOLEAN
-Ax88772GetLinkStatus (
-  IN NIC_DEVICE *NicDevice
-)
+/**
+  Read the link state from the interrupt endpoint
+
+  The device reports PHY link changes through the interrupt endpoint,
+  which is much cheaper to poll than the control transfers required
+  to read the PHY registers.
+
+  @param [in] NicDevice   Pointer to the NIC_DEVICE structure
+  @param [out] LinkUp     Current link state, TRUE = link up
+
+  @retval EFI_SUCCESS     The link state in LinkUp is valid
+  @retval other           The interrupt endpoint could not be read
+
+**/
+EFI_STATUS
+Ax88772LinkStatusFromInterrupt (
+  IN  NIC_DEVICE *NicDevice,
+  OUT BOOLEAN    *LinkUp
+  )
 {
   UINT32              CmdStatus;
   EFI_USB_IO_PROTOCOL *UsbIo;
@@ -1057,11 +1072,26 @@ Ax88772GetLinkStatus (
                                         USB_BUS_TIMEOUT,
                                         &CmdStatus);
 
-  if (EFI_ERROR(Status) || EFI_ERROR(CmdStatus) || 0 == IntDataLeng) {
-      return FALSE;
+  if (EFI_ERROR(Status)) {
+    return Status;
   }
-  return (IntData & 0x800000)? FALSE : TRUE;
+  if (EFI_ERROR(CmdStatus) || 0 == IntDataLeng) {
+    return EFI_DEVICE_ERROR;
+  }
+  *LinkUp = (IntData & 0x800000)? FALSE : TRUE;
+  return EFI_SUCCESS;
+}
 
+BOOLEAN
+Ax88772GetLinkStatus (
+  IN NIC_DEVICE *NicDevice
+)
+{
+  BOOLEAN    LinkUp;
+  EFI_STATUS Status;
+
+  Status = Ax88772LinkStatusFromInterrupt (NicDevice, &LinkUp);
+  return (EFI_ERROR(Status))? FALSE : LinkUp;
 }
 
 #if RXTHOU
@@ -1298,3 +1328,82 @@ no_pkt:
   return Status;
 }
 #endif
+
+/**
+  Flush the transmit aggregation buffer
+
+  This routine packs every frame queued by ::SN_Transmit into a
+  single bulk-out transfer; each frame carries its own length /
+  ~length header per the AX88772C bulk format.  The caller buffers
+  move to the recycle list for ::SN_GetStatus to return.
+
+  @param [in] NicDevice  Pointer to the NIC_DEVICE structure
+
+  @retval EFI_SUCCESS    The frames were transmitted
+  @retval EFI_NOT_READY  The transfer failed; the frames were dropped
+                          but the caller buffers are still recycled
+
+**/
+EFI_STATUS
+Ax88772BulkOut (
+  IN NIC_DEVICE *NicDevice
+)
+{
+  EFI_USB_IO_PROTOCOL *UsbIo;
+  EFI_STATUS          Status;
+  UINTN               Index;
+  UINTN               TransferLength;
+  UINT32              TransferStatus = 0;
+
+  if (0 == NicDevice->TxQueuedCnt) {
+    return EFI_SUCCESS;
+  }
+
+  TransferLength = NicDevice->TxAggLength;
+  if (TransferLength % 512 == 0 || TransferLength % 1024 == 0) {
+    ZeroMem (&NicDevice->TxAggBuf[TransferLength], 4);
+    TransferLength += 4;
+  }
+#if RXTHOU
+  if (NicDevice->RxBurst == 1)
+    NicDevice->RxBurst--;
+#endif
+  //
+  //  Work around USB bus driver bug where a timeout set by receive
+  //  succeeds but the timeout expires immediately after, causing the
+  //  transmit operation to timeout.
+  //
+  UsbIo = NicDevice->UsbIo;
+  Status = UsbIo->UsbBulkTransfer (UsbIo,
+                                     BULK_OUT_ENDPOINT,
+                                     NicDevice->TxAggBuf,
+                                     &TransferLength,
+                                     0xfffffffe,
+                                     &TransferStatus);
+
+  //
+  //  Recycle the caller buffers whether or not the frames made it to
+  //  the wire; a lost frame must not leave the network stack waiting
+  //  forever for its buffer.
+  //
+  for (Index = 0; Index < NicDevice->TxQueuedCnt; Index++) {
+    NicDevice->TxDoneBuf[NicDevice->TxDoneCnt++] = NicDevice->TxQueuedBuf[Index];
+  }
+  NicDevice->TxQueuedCnt = 0;
+  NicDevice->TxAggLength = 0;
+
+  if (EFI_SUCCESS == Status) {
+    Status = TransferStatus;
+  }
+  if (EFI_ERROR (Status)) {
+    if (EFI_DEVICE_ERROR == Status) {
+      SN_Reset (&NicDevice->SimpleNetwork, FALSE);
+    }
+    Status = EFI_NOT_READY;
+  }
+
+  //
+  // Return the operation status
+  //
+  return Status;
+}
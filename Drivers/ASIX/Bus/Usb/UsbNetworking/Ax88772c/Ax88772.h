@@ -68,6 +68,10 @@
 #define AX88772_MAX_BULKIN_SIZE    1024 * 3
 #endif
 
+#define AX88772_MAX_BULKOUT_SIZE   1024 * 13
+
+#define AX88772_TX_QUEUE_DEPTH  8   ///< Maximum frames aggregated into one bulk-out transfer
+
 #define AX88772_MAX_PKT_SIZE  2048  ///< Maximum packet size
 
 #define ETHERNET_HEADER_SIZE  sizeof (ETHERNET_HEADER)  ///<  Size in bytes of the Ethernet header
@@ -355,7 +359,6 @@ typedef struct {
   BOOLEAN                   LinkUp;             ///<  Current link state
   UINTN                     PollCount;          ///<  Number of times the autonegotiation status was polled
   UINT16                    CurRxControl;
-  VOID                      *TxBuffer;
   //
   //  Receive buffer list
   //
@@ -364,7 +367,15 @@ typedef struct {
   UINT8                     *CurPktOff;
   UINT16                    PktCnt;
 
-  RX_TX_PACKET              *TxTest;
+  //
+  //  Transmit aggregation
+  //
+  UINT8                     *TxAggBuf;       ///<  Frames packed for the next bulk-out transfer
+  UINTN                     TxAggLength;     ///<  Bytes waiting in TxAggBuf
+  VOID                      *TxQueuedBuf[AX88772_TX_QUEUE_DEPTH]; ///<  Caller buffers waiting in TxAggBuf
+  UINT16                    TxQueuedCnt;     ///<  Frames waiting in TxAggBuf
+  VOID                      *TxDoneBuf[AX88772_TX_QUEUE_DEPTH];   ///<  Transmitted buffers awaiting recycle
+  UINT16                    TxDoneCnt;       ///<  Transmitted buffers awaiting recycle
 
   UINT8                     MulticastHash[8];
   EFI_MAC_ADDRESS           MAC;
@@ -912,6 +923,12 @@ Ax88772GetLinkStatus (
   IN NIC_DEVICE *NicDevice
 ) ;
 
+EFI_STATUS
+Ax88772LinkStatusFromInterrupt (
+  IN  NIC_DEVICE *NicDevice,
+  OUT BOOLEAN    *LinkUp
+  );
+
 //------------------------------------------------------------------------------
 // EFI Component Name Protocol Support
 //------------------------------------------------------------------------------
@@ -1036,6 +1053,11 @@ Ax88772BulkIn(
   IN NIC_DEVICE *NicDevice
 );
 
+EFI_STATUS
+Ax88772BulkOut (
+  IN NIC_DEVICE *NicDevice
+);
+
 //------------------------------------------------------------------------------
 
 #endif  //  AX88772_H_
@@ -289,8 +289,8 @@ ERR:
     gBS->FreePool (NicDevice->BulkInbuf);
   }
 
-  if (NicDevice->TxTest != NULL) {
-    gBS->FreePool (NicDevice->TxTest);
+  if (NicDevice->TxAggBuf != NULL) {
+    gBS->FreePool (NicDevice->TxAggBuf);
   }
 
   if (NicDevice->MyDevPath != NULL) {
@@ -454,8 +454,8 @@ DriverStop (
         gBS->FreePool (NicDevice->BulkInbuf);
       }
 
-      if (NicDevice->TxTest != NULL) {
-        gBS->FreePool (NicDevice->TxTest);
+      if (NicDevice->TxAggBuf != NULL) {
+        gBS->FreePool (NicDevice->TxAggBuf);
       }
 
       if (NicDevice->MyDevPath != NULL) {
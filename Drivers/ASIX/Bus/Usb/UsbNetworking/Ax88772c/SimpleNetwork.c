@@ -121,6 +121,8 @@ SN_GetStatus (
   EFI_SIMPLE_NETWORK_MODE *Mode;
   NIC_DEVICE              *NicDevice = NULL;
   EFI_STATUS              Status = EFI_SUCCESS;
+  EFI_STATUS              IntStatus;
+  BOOLEAN                 IntLinkUp = FALSE;
   EFI_TPL                 TplPrevious;
 
   TplPrevious = gBS->RaiseTPL(TPL_CALLBACK);
@@ -133,9 +135,23 @@ SN_GetStatus (
     //
     NicDevice = DEV_FROM_SIMPLE_NETWORK (SimpleNetwork);
 
-    if ((TxBuf != NULL) && (NicDevice->TxBuffer != NULL)) {
-      *TxBuf = NicDevice->TxBuffer;
-      NicDevice->TxBuffer = NULL;
+    if (TxBuf != NULL) {
+      //
+      //  Push any frames waiting in the aggregation buffer to the
+      //  wire so that their caller buffers become recyclable
+      //
+      if ((NicDevice->TxQueuedCnt != 0) &&
+          (EfiSimpleNetworkInitialized == SimpleNetwork->Mode->State)) {
+        Ax88772BulkOut (NicDevice);
+      }
+
+      if (NicDevice->TxDoneCnt != 0) {
+        *TxBuf = NicDevice->TxDoneBuf[0];
+        NicDevice->TxDoneCnt--;
+        CopyMem (&NicDevice->TxDoneBuf[0],
+                  &NicDevice->TxDoneBuf[1],
+                  NicDevice->TxDoneCnt * sizeof (VOID *));
+      }
     }
 
     Mode = SimpleNetwork->Mode;
@@ -145,10 +161,19 @@ SN_GetStatus (
         goto EXIT;
       }
 
+      //
+      //  The interrupt endpoint reports the link state without the
+      //  control transfer overhead of reading the PHY registers, so
+      //  poll it first and only fall back to the PHY registers when
+      //  the link comes up or the endpoint could not be read.
+      //
 #if REPORTLINK
-#else
-      if (!NicDevice->LinkUp || !NicDevice->Complete) {
-#endif
+      IntStatus = Ax88772LinkStatusFromInterrupt (NicDevice, &IntLinkUp);
+      if (!EFI_ERROR (IntStatus) && !IntLinkUp) {
+        NicDevice->LinkUp = FALSE;
+        NicDevice->Complete = FALSE;
+        Mode->MediaPresent = FALSE;
+      } else if (!NicDevice->LinkUp || !NicDevice->Complete) {
         Status = Ax88772NegotiateLinkComplete (NicDevice,
                                                 &NicDevice->PollCount,
                                                 &NicDevice->Complete,
@@ -158,18 +183,34 @@ SN_GetStatus (
 
         if (EFI_ERROR(Status))
           goto EXIT;
-#if REPORTLINK
         if (NicDevice->LinkUp && NicDevice->Complete) {
           Mode->MediaPresent = TRUE;
           Status = ReceiveFilterUpdate (SimpleNetwork);
         } else {
           Mode->MediaPresent = FALSE;
         }
+      }
 #else
-        if (NicDevice->LinkUp && NicDevice->Complete) {
-          Mode->MediaPresent = TRUE;
-          Mode->MediaPresentSupported = FALSE;
-          Status = ReceiveFilterUpdate (SimpleNetwork);
+      if (!NicDevice->LinkUp || !NicDevice->Complete) {
+        IntStatus = Ax88772LinkStatusFromInterrupt (NicDevice, &IntLinkUp);
+        if (!EFI_ERROR (IntStatus) && !IntLinkUp) {
+          NicDevice->LinkUp = FALSE;
+          NicDevice->Complete = FALSE;
+        } else {
+          Status = Ax88772NegotiateLinkComplete (NicDevice,
+                                                  &NicDevice->PollCount,
+                                                  &NicDevice->Complete,
+                                                  &NicDevice->LinkUp,
+                                                  &NicDevice->LinkSpeed100Mbps,
+                                                  &NicDevice->FullDuplex);
+
+          if (EFI_ERROR(Status))
+            goto EXIT;
+          if (NicDevice->LinkUp && NicDevice->Complete) {
+            Mode->MediaPresent = TRUE;
+            Mode->MediaPresentSupported = FALSE;
+            Status = ReceiveFilterUpdate (SimpleNetwork);
+          }
         }
       }
 #endif
@@ -565,6 +606,15 @@ SN_Receive (
         //  Attempt to receive a packet
         //
         if (0 == NicDevice->PktCnt) {
+          //
+          //  Push out any frames waiting in the aggregation buffer
+          //  first; the packet being polled for may be the response
+          //  to one of them.
+          //
+          if (NicDevice->TxQueuedCnt != 0) {
+            Ax88772BulkOut (NicDevice);
+          }
+
           Status = Ax88772BulkIn(NicDevice);
           if (EFI_ERROR(Status)) {
             goto  no_pkt;
@@ -854,6 +904,7 @@ SN_Reset (
   EFI_SIMPLE_NETWORK_MODE *Mode;
   NIC_DEVICE              *NicDevice;
   EFI_STATUS              Status;
+  UINTN                   Index;
   EFI_TPL                 TplPrevious;
 
   TplPrevious = gBS->RaiseTPL(TPL_CALLBACK);
@@ -868,6 +919,16 @@ SN_Reset (
       //
       NicDevice = DEV_FROM_SIMPLE_NETWORK (SimpleNetwork);
 
+      //
+      //  The reset clears the transmit queue; recycle any frames
+      //  still waiting in the aggregation buffer without sending them
+      //
+      for (Index = 0; Index < NicDevice->TxQueuedCnt; Index++) {
+        NicDevice->TxDoneBuf[NicDevice->TxDoneCnt++] = NicDevice->TxQueuedBuf[Index];
+      }
+      NicDevice->TxQueuedCnt = 0;
+      NicDevice->TxAggLength = 0;
+
       //
       //  Reset the device
       //
@@ -962,7 +1023,7 @@ SN_Setup (
 
   Mode->IfType = NET_IFTYPE_ETHERNET;
   Mode->MacAddressChangeable = TRUE;
-  Mode->MultipleTxSupported = FALSE;
+  Mode->MultipleTxSupported = TRUE;
   Mode->MediaPresentSupported = TRUE;
   Mode->MediaPresent = FALSE;
 
@@ -977,6 +1038,9 @@ SN_Setup (
   NicDevice->Grub_f = FALSE;
   NicDevice->FirstRst = TRUE;
   NicDevice->PktCnt = 0;
+  NicDevice->TxAggLength = 0;
+  NicDevice->TxQueuedCnt = 0;
+  NicDevice->TxDoneCnt = 0;
 
   Status = Ax88772MacAddressGet (
                 NicDevice,
@@ -1006,8 +1070,8 @@ SN_Setup (
   }
 
   Status = gBS->AllocatePool (EfiBootServicesData,
-                                   sizeof (RX_TX_PACKET),
-                                   (VOID **) &NicDevice->TxTest);
+                                   AX88772_MAX_BULKOUT_SIZE,
+                                   (VOID **) &NicDevice->TxAggBuf);
 
   if (EFI_ERROR (Status)) {
     gBS->FreePool (NicDevice->BulkInbuf);
@@ -1086,7 +1150,7 @@ SN_Start (
       SetMem(&Mode->BroadcastAddress, PXE_HWADDR_LEN_ETHER, 0xff);
       Mode->IfType = NET_IFTYPE_ETHERNET;
       Mode->MacAddressChangeable = TRUE;
-      Mode->MultipleTxSupported = FALSE;
+      Mode->MultipleTxSupported = TRUE;
       Mode->MediaPresentSupported = TRUE;
       Mode->MediaPresent = FALSE;
 
@@ -1391,9 +1455,12 @@ SN_Shutdown (
   operation.  When the transmit is complete, the buffer is returned
   via the GetStatus() call.
 
-  This routine calls ::Ax88772Rx to empty the network adapter of
-  receive packets.  The routine then passes the transmit packet
-  to the network adapter.
+  This routine appends the packet to the bulk-out aggregation
+  buffer, packing it behind any frames already waiting so that
+  several frames share a single USB transfer.  ::Ax88772BulkOut
+  pushes the aggregated frames to the network adapter when the
+  buffer fills, when GetStatus() is called, or before Receive()
+  polls the adapter.
 
   @param [in] SimpleNetwork    Protocol instance pointer
   @param [in] HeaderSize        The size, in bytes, of the media header to be filled in by
@@ -1441,10 +1508,10 @@ SN_Transmit (
   ETHERNET_HEADER         *Header;
   EFI_SIMPLE_NETWORK_MODE *Mode;
   NIC_DEVICE              *NicDevice;
-  EFI_USB_IO_PROTOCOL     *UsbIo;
   EFI_STATUS              Status;
-  UINTN                   TransferLength;
-  UINT32                  TransferStatus;
+  UINT8                   *Packet;
+  UINT16                  Length;
+  UINTN                   WireLength;
   UINT16                  Type;
   EFI_TPL                 TplPrevious;
 
@@ -1492,13 +1559,49 @@ SN_Transmit (
           goto EXIT;
         }
 
-        CopyMem (&NicDevice->TxTest->Data[0], Buffer, BufferSize);
-        NicDevice->TxTest->Length = (UINT16) BufferSize;
+        //
+        //  All recycle slots are busy; the caller must drain
+        //  GetStatus() before handing over more frames
+        //
+        if ((UINTN)(NicDevice->TxDoneCnt + NicDevice->TxQueuedCnt) >= AX88772_TX_QUEUE_DEPTH) {
+          Status = EFI_NOT_READY;
+          goto EXIT;
+        }
+
+        Length = (UINT16) BufferSize;
+        if (Length < MIN_ETHERNET_PKT_SIZE) {
+          Length = MIN_ETHERNET_PKT_SIZE;
+        }
+        WireLength = sizeof (UINT16) * 2 + (((UINTN) Length + 1) & ~(UINTN) 1);
+
+        //
+        //  Push the aggregation buffer out first when this frame does
+        //  not fit behind the frames already queued
+        //
+        if (NicDevice->TxAggLength + WireLength + 4 > AX88772_MAX_BULKOUT_SIZE) {
+          Status = Ax88772BulkOut (NicDevice);
+          if (EFI_ERROR (Status)) {
+            goto EXIT;
+          }
+        }
 
         //
-        //  Transmit the packet
+        //  Append the frame behind its length / ~length header so
+        //  several frames share a single bulk-out transfer
         //
-        Header = (ETHERNET_HEADER *) &NicDevice->TxTest->Data[0];
+        Packet = &NicDevice->TxAggBuf[NicDevice->TxAggLength];
+        *(UINT16 *) Packet = Length;
+        *(UINT16 *)(Packet + sizeof (UINT16)) = (UINT16) ~Length;
+        CopyMem (Packet + sizeof (UINT16) * 2, Buffer, BufferSize);
+        if (Length > (UINT16) BufferSize) {
+          ZeroMem (Packet + sizeof (UINT16) * 2 + BufferSize,
+                    Length - BufferSize);
+        }
+        if ((Length & 1) != 0) {
+          Packet[sizeof (UINT16) * 2 + Length] = 0;
+        }
+
+        Header = (ETHERNET_HEADER *)(Packet + sizeof (UINT16) * 2);
         if (HeaderSize != 0) {
           if (DestAddr != NULL) {
             CopyMem (&Header->DestAddr, DestAddr, PXE_HWADDR_LEN_ETHER);
@@ -1511,53 +1614,16 @@ SN_Transmit (
           if (Protocol != NULL) {
             Type = *Protocol;
           } else {
-            Type = NicDevice->TxTest->Length;
+            Type = (UINT16) BufferSize;
           }
           Type = (UINT16)((Type >> 8) | (Type << 8));
           Header->Type = Type;
         }
 
-
-        if (NicDevice->TxTest->Length < MIN_ETHERNET_PKT_SIZE) {
-          NicDevice->TxTest->Length = MIN_ETHERNET_PKT_SIZE;
-          ZeroMem (&NicDevice->TxTest->Data[BufferSize],
-                    NicDevice->TxTest->Length - BufferSize);
-        }
-
-        NicDevice->TxTest->LengthBar = ~(NicDevice->TxTest->Length);
-        TransferLength = sizeof (NicDevice->TxTest->Length)
-                       + sizeof (NicDevice->TxTest->LengthBar)
-                       + NicDevice->TxTest->Length;
-
-        if (TransferLength % 512 == 0 || TransferLength % 1024 == 0)
-          TransferLength +=4;
-#if RXTHOU
-        if (NicDevice->RxBurst == 1)
-          NicDevice->RxBurst--;
-#endif
-        //
-        //  Work around USB bus driver bug where a timeout set by receive
-        //  succeeds but the timeout expires immediately after, causing the
-        //  transmit operation to timeout.
-        //
-        UsbIo = NicDevice->UsbIo;
-        Status = UsbIo->UsbBulkTransfer (UsbIo,
-                                           BULK_OUT_ENDPOINT,
-                                           &NicDevice->TxTest->Length,
-                                           &TransferLength,
-                                           0xfffffffe,
-                                           &TransferStatus);
-        if (EFI_SUCCESS == Status) {
-          Status = TransferStatus;
-        }
-        if (EFI_SUCCESS == Status && EFI_SUCCESS == TransferStatus) {
-          NicDevice->TxBuffer = Buffer;
-        } else {
-          if (EFI_DEVICE_ERROR == Status) {
-            SN_Reset (SimpleNetwork, FALSE);
-          }
-          Status = EFI_NOT_READY;
-        }
+        NicDevice->TxAggLength += WireLength;
+        NicDevice->TxQueuedBuf[NicDevice->TxQueuedCnt] = Buffer;
+        NicDevice->TxQueuedCnt++;
+        Status = EFI_SUCCESS;
       } else {
         //
         // No packets available.
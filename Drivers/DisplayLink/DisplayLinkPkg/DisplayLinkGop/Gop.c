@@ -269,7 +269,7 @@ DlGopSendScreenUpdate (
   // This allows us to update a hot-plugged monitor quickly.
   if (UsbDisplayLinkDev->TimeSinceLastScreenUpdate > DISPLAYLINK_FULL_SCREEN_UPDATE_PERIOD) {
     UsbDisplayLinkDev->LastY1 = 0;
-    UsbDisplayLinkDev->LastY2 = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->HorizontalResolution - 1;
+    UsbDisplayLinkDev->LastY2 = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->VerticalResolution;
   }
 
   // If there has been no BLT since the last update/poll, drop out quietly.
@@ -287,14 +287,24 @@ DlGopSendScreenUpdate (
   UINTN Height;
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL* SrcPtr;
   UINT8* DstPtr;
-  UINT8 DstBuffer[1920 * 3]; // Get rid of the magic numbers at some point
-                             // Could also use a buffer allocated at runtime to store the line, stored in the USB_DISPLAYLINK_DEV structure.
+  UINT8* DstBuffer;
   UINTN H;
 
   DataLen = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->HorizontalResolution * 3; // Send 1 line @ 24 bits per pixel
   Width = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->HorizontalResolution;
   Height = UsbDisplayLinkDev->GraphicsOutputProtocol.Mode->Info->VerticalResolution;
+
+  // The device writes incoming lines sequentially from the top of the frame,
+  // and the frame terminator below resets it back to line 0. Lines above the
+  // dirty area still have to be streamed, but the frame can be cut short once
+  // the last line touched by a BLT has gone out, which is what makes partial
+  // updates cheap. The periodic full screen update above repaints anything below.
+  if (UsbDisplayLinkDev->LastY2 < Height) {
+    Height = UsbDisplayLinkDev->LastY2;
+  }
+
   SrcPtr = UsbDisplayLinkDev->Screen;
+  DstBuffer = UsbDisplayLinkDev->LineBuffer;
   DstPtr = DstBuffer;
 
   for (H = 0; H < Height; H++) {
@@ -471,11 +481,15 @@ DisplayLinkSetMode (
   Gop->Mode->FrameBufferSize = 0;
 
   //
-  // Allocate the back buffer
+  // Allocate the back buffer and the line conversion buffer
   //
   if (UsbDisplayLinkDev->Screen != NULL) {
     FreePool (UsbDisplayLinkDev->Screen);
   }
+  if (UsbDisplayLinkDev->LineBuffer != NULL) {
+    FreePool (UsbDisplayLinkDev->LineBuffer);
+    UsbDisplayLinkDev->LineBuffer = NULL;
+  }
 
   UsbDisplayLinkDev->Screen = (EFI_GRAPHICS_OUTPUT_BLT_PIXEL*)AllocateZeroPool (
     Gop->Mode->Info->HorizontalResolution *
@@ -486,6 +500,15 @@ DisplayLinkSetMode (
     return EFI_OUT_OF_RESOURCES;
   }
 
+  UsbDisplayLinkDev->LineBuffer = (UINT8*)AllocatePool (
+    Gop->Mode->Info->HorizontalResolution * 3); // 1 line @ 24 bits per pixel
+
+  if (UsbDisplayLinkDev->LineBuffer == NULL) {
+    FreePool (UsbDisplayLinkDev->Screen);
+    UsbDisplayLinkDev->Screen = NULL;
+    return EFI_OUT_OF_RESOURCES;
+  }
+
   DEBUG ((DEBUG_INFO, "Video mode %d selected by BIOS - %d x %d.\n", ModeNumber, VideoMode->HActive, VideoMode->VActive));
   // Wait until we are sure that we can set the video mode before we tell the firmware
   Status = DlUsbSendControlWriteMessage (UsbDisplayLinkDev, SET_VIDEO_MODE, 0, VideoMode, sizeof (struct VideoMode));
@@ -496,6 +519,8 @@ DisplayLinkSetMode (
     Gop->Mode->Mode = GRAPHICS_OUTPUT_INVALID_MODE_NUMBER;
     FreePool (UsbDisplayLinkDev->Screen);
     UsbDisplayLinkDev->Screen = NULL;
+    FreePool (UsbDisplayLinkDev->LineBuffer);
+    UsbDisplayLinkDev->LineBuffer = NULL;
   } else {
     BuildBackBuffer (
       UsbDisplayLinkDev,
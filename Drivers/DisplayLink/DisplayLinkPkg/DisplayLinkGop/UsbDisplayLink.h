@@ -80,6 +80,7 @@ typedef struct {
   EFI_EDID_ACTIVE_PROTOCOL      EdidActive;
   EFI_UNICODE_STRING_TABLE      *ControllerNameTable;
   EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Screen;
+  UINT8                         *LineBuffer;                    /** One scan line converted to the 24bpp wire format */
   UINTN                         DataSent;                       /** Debug - used to track the bandwidth */
   EFI_EVENT                     TimerEvent;
   EFI_EVENT                     DriverExitBootServicesEvent;
@@ -37,6 +37,14 @@ STATIC CONST UINT16 mStorageId = 4U;
 
 STATIC MEM_INSTANCE mInstance;
 
+//
+// Every RPMB access costs a round trip to OP-TEE, i.e. two world switches.
+// Count the calls we issue and the ones batching avoided so the savings
+// show up on the serial console.
+//
+STATIC UINT32 mRpmbSvcCalls;
+STATIC UINT32 mRpmbSvcCallsSaved;
+
 /**
   Sends an SVC call to OP-TEE for reading/writing an RPMB partition
 
@@ -66,6 +74,8 @@ ReadWriteRpmb (
   ARM_SVC_ARGS  SvcArgs;
   EFI_STATUS    Status;
 
+  mRpmbSvcCalls++;
+
   ZeroMem (&SvcArgs, sizeof (SvcArgs));
 
   SvcArgs.Arg0 = ARM_SVC_ID_FFA_MSG_SEND_DIRECT_REQ;
@@ -110,6 +120,76 @@ ReadWriteRpmb (
   return Status;
 }
 
+/**
+  Recompute the recorded CRC32 of a run of blocks in the in-memory copy
+  of the RPMB contents. Must be called whenever the copy is modified.
+
+  @param[in] Instance   MEM_INSTANCE describing the device
+  @param[in] Lba        First modified block
+  @param[in] NumBlocks  Number of modified blocks
+**/
+STATIC
+VOID
+UpdateBlockCrc (
+  IN MEM_INSTANCE *Instance,
+  IN EFI_LBA      Lba,
+  IN UINTN        NumBlocks
+  )
+{
+  UINT8 *Base;
+  UINTN Idx;
+
+  Base = (UINT8 *)(UINTN)Instance->MemBaseAddress +
+         (UINTN)Lba * Instance->BlockSize;
+  for (Idx = 0; Idx < NumBlocks; Idx++) {
+    Instance->BlockCrc[(UINTN)Lba + Idx] = CalculateCrc32 (Base, Instance->BlockSize);
+    Base += Instance->BlockSize;
+  }
+}
+
+/**
+  Check a block of the in-memory copy against its recorded CRC32. If the
+  copy no longer matches what was read from or written to the device,
+  restore the block from the RPMB before it is served to a reader.
+
+  @param[in] Instance   MEM_INSTANCE describing the device
+  @param[in] Lba        Block to verify
+
+  @retval    EFI_SUCCESS  The block matches, or was restored from the device
+  @retval    other        Restoring the block from the device failed
+**/
+STATIC
+EFI_STATUS
+VerifyBlockCrc (
+  IN MEM_INSTANCE *Instance,
+  IN EFI_LBA      Lba
+  )
+{
+  UINT8      *Base;
+  EFI_STATUS Status;
+
+  Base = (UINT8 *)(UINTN)Instance->MemBaseAddress +
+         (UINTN)Lba * Instance->BlockSize;
+  if (CalculateCrc32 (Base, Instance->BlockSize) == Instance->BlockCrc[(UINTN)Lba]) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG ((DEBUG_WARN, "%a: in-memory copy of block 0x%lx is corrupt, restoring it from the device\n",
+    __func__, Lba));
+  Status = ReadWriteRpmb (
+             SP_SVC_RPMB_READ,
+             (UINTN)Base,
+             Instance->BlockSize,
+             (UINTN)Lba * Instance->BlockSize
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  UpdateBlockCrc (Instance, Lba, 1);
+
+  return EFI_SUCCESS;
+}
+
 /**
   The GetAttributes() function retrieves the attributes and
   current settings of the block.
@@ -295,6 +375,8 @@ OpTeeRpmbFvbRead (
   EFI_STATUS   Status;
   MEM_INSTANCE *Instance;
   VOID         *Base;
+  EFI_LBA      Walk;
+  EFI_LBA      Last;
 
   Status = EFI_SUCCESS;
   Instance = INSTANCE_FROM_FVB_THIS (This);
@@ -307,9 +389,21 @@ OpTeeRpmbFvbRead (
 
   Base = (VOID *)(UINTN)Instance->MemBaseAddress + (Lba * Instance->BlockSize) +
          Offset;
-  // We could read the data from the RPMB instead of memory
-  // The 2 copies should already be identical
-  // Copy from memory image
+  // Serve the read from the in-memory copy, but only after checking that
+  // the covered blocks still match the CRC recorded when they were last
+  // synced with the device. A mismatch restores the block from the RPMB,
+  // so a corrupted copy costs one extra secure world round trip instead of
+  // returning bad data.
+  if (*NumBytes != 0) {
+    Last = ((Lba * Instance->BlockSize) + Offset + *NumBytes - 1) /
+           Instance->BlockSize;
+    for (Walk = Lba; Walk <= Last; Walk++) {
+      Status = VerifyBlockCrc (Instance, Walk);
+      if (EFI_ERROR (Status)) {
+        return EFI_DEVICE_ERROR;
+      }
+    }
+  }
   CopyMem (Buffer, Base, *NumBytes);
 
   return Status;
@@ -402,6 +496,13 @@ OpTeeRpmbFvbWrite (
 
   // Update the memory copy
   CopyMem (Base, Buffer, *NumBytes);
+  if (*NumBytes != 0) {
+    UpdateBlockCrc (
+      Instance,
+      Lba,
+      ((Offset + *NumBytes - 1) / Instance->BlockSize) + 1
+      );
+  }
 
   return Status;
 }
@@ -463,6 +564,8 @@ OpTeeRpmbFvbErase (
   UINTN   NumBytes;
   UINTN   NumLba;
   EFI_LBA Start;
+  EFI_LBA RunStart;
+  UINTN   RunLba;
   VOID    *Base;
   VOID    *Buf;
   VA_LIST Args;
@@ -470,39 +573,64 @@ OpTeeRpmbFvbErase (
 
   Instance = INSTANCE_FROM_FVB_THIS (This);
 
+  // The entire parameter list must be verified before erasing any blocks
   VA_START (Args, This);
   for (Start = VA_ARG (Args, EFI_LBA);
        Start != EFI_LBA_LIST_TERMINATOR;
        Start = VA_ARG (Args, EFI_LBA)) {
     NumLba = VA_ARG (Args, UINTN);
     if (NumLba == 0 || Start + NumLba > Instance->NBlocks) {
+      VA_END (Args);
       return EFI_INVALID_PARAMETER;
     }
-    NumBytes = NumLba * Instance->BlockSize;
-    Base = (VOID *)(UINTN)Instance->MemBaseAddress +
-           (Start * Instance->BlockSize);
-    Buf = AllocatePool (NumLba * Instance->BlockSize);
-    if (Buf == NULL) {
-      return EFI_DEVICE_ERROR;
+  }
+  VA_END (Args);
+
+  // A single all-ones buffer covering the whole volume serves every run
+  Buf = AllocatePool (Instance->NBlocks * Instance->BlockSize);
+  if (Buf == NULL) {
+    return EFI_DEVICE_ERROR;
+  }
+  SetMem64 (Buf, Instance->NBlocks * Instance->BlockSize, ~0UL);
+
+  VA_START (Args, This);
+  RunStart = VA_ARG (Args, EFI_LBA);
+  while (RunStart != EFI_LBA_LIST_TERMINATOR) {
+    RunLba = VA_ARG (Args, UINTN);
+    // Merge list entries describing contiguous block runs so that each
+    // run costs a single RPMB access instead of one per entry
+    for (Start = VA_ARG (Args, EFI_LBA);
+         (Start != EFI_LBA_LIST_TERMINATOR) && (Start == RunStart + RunLba);
+         Start = VA_ARG (Args, EFI_LBA)) {
+      RunLba += VA_ARG (Args, UINTN);
+      mRpmbSvcCallsSaved++;
     }
-    SetMem64 (Buf, NumLba * Instance->BlockSize, ~0UL);
+    NumBytes = RunLba * Instance->BlockSize;
+    Base = (VOID *)(UINTN)Instance->MemBaseAddress +
+           (RunStart * Instance->BlockSize);
     // Write the device
     Status = ReadWriteRpmb (
                SP_SVC_RPMB_WRITE,
                (UINTN)Buf,
                NumBytes,
-               Start * Instance->BlockSize
+               RunStart * Instance->BlockSize
                );
     if (EFI_ERROR (Status)) {
       FreePool (Buf);
+      VA_END (Args);
       return Status;
     }
     // Update the in memory copy
-    SetMem64 (Base, NumLba * Instance->BlockSize, ~0UL);
-    FreePool (Buf);
+    SetMem64 (Base, NumBytes, ~0UL);
+    UpdateBlockCrc (Instance, RunStart, RunLba);
+    RunStart = Start;
   }
 
   VA_END (Args);
+  FreePool (Buf);
+
+  DEBUG ((DEBUG_VERBOSE, "%a: %u RPMB accesses so far, %u saved by batching\n",
+    __func__, mRpmbSvcCalls, mRpmbSvcCallsSaved));
 
   return EFI_SUCCESS;
 }
@@ -616,16 +744,16 @@ ValidateFvHeader (
 }
 
 /**
-  Initialize Fvb and variable storage headers for the RPMB storage.
+  Initialize Fvb and variable storage headers in the in-memory copy of the
+  RPMB storage. The caller is expected to flush the memory copy to the
+  device, which lets a full volume (re)initialization cost a single RPMB
+  access.
 
   @param[in,out]    Instance   MEM_INSTANCE pointer describing the device and
                                the Firmware Block Protocol
 
-  @retval           EFI_SUCCESS read/write ok
-  @retval           EFI_UNSUPPORTED SVC to op-tee not supported
-  @retval           EFI_INVALID_PARAMETER SVC to op-tee had an invalid param
-  @retval           EFI_ACCESS_DENIED SVC to op-tee was denied
-  @retval           EFI_OUT_OF_RESOURCES op-tee out of memory
+  @retval           EFI_SUCCESS headers installed in the memory copy
+  @retval           EFI_OUT_OF_RESOURCES out of memory
 **/
 STATIC
 EFI_STATUS
@@ -687,14 +815,10 @@ InitializeFvAndVariableStoreHeaders (
   VariableStoreHeader->Format = VARIABLE_STORE_FORMATTED;
   VariableStoreHeader->State = VARIABLE_STORE_HEALTHY;
 
-  Status = ReadWriteRpmb (SP_SVC_RPMB_WRITE, (UINTN)Headers, HeadersLength, 0);
-  if (EFI_ERROR (Status)) {
-    goto Exit;
-  }
   // Install the combined header in memory
   CopyMem ((VOID*)(UINTN)Instance->MemBaseAddress, Headers, HeadersLength);
 
-Exit:
+  Status = EFI_SUCCESS;
   FreePool (Headers);
   return Status;
 }
@@ -762,6 +886,15 @@ FvbInitialize (
       Instance->NBlocks * Instance->BlockSize,
       ~0UL
       );
+    // Install all appropriate headers
+    DEBUG ((DEBUG_INFO, "%a: Installing a correct one for this volume.\n",
+      __FUNCTION__));
+    Status = InitializeFvAndVariableStoreHeaders (Instance);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    // Flush the erased volume and the fresh headers to the device in a
+    // single access
     DEBUG ((DEBUG_INFO, "%a: Erasing Flash.\n", __FUNCTION__));
     Status = ReadWriteRpmb (
                SP_SVC_RPMB_WRITE,
@@ -774,16 +907,12 @@ FvbInitialize (
     if (EFI_ERROR (Status)) {
       return Status;
     }
-    // Install all appropriate headers
-    DEBUG ((DEBUG_INFO, "%a: Installing a correct one for this volume.\n",
-      __FUNCTION__));
-    Status = InitializeFvAndVariableStoreHeaders (Instance);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
+    mRpmbSvcCallsSaved++;
   } else {
     DEBUG ((DEBUG_INFO, "%a: Found valid FVB Header.\n", __FUNCTION__));
   }
+  // Record what was synced with the device so reads can verify the copy
+  UpdateBlockCrc (Instance, 0, Instance->NBlocks);
   Instance->Initialized = TRUE;
 
   return Status;
@@ -826,6 +955,13 @@ OpTeeRpmbFvbInit (
 
   ZeroMem (&mInstance, sizeof (mInstance));
 
+  mInstance.BlockCrc = AllocateZeroPool (NBlocks * sizeof (UINT32));
+  if (mInstance.BlockCrc == NULL) {
+    FreePages (Addr, NBlocks);
+    ASSERT (0);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
   mInstance.FvbProtocol.GetPhysicalAddress = OpTeeRpmbFvbGetPhysicalAddress;
   mInstance.FvbProtocol.GetAttributes      = OpTeeRpmbFvbGetAttributes;
   mInstance.FvbProtocol.SetAttributes      = OpTeeRpmbFvbSetAttributes;
@@ -58,6 +58,8 @@ struct _MEM_INSTANCE
     UINT16                              BlockSize;
     /// Number of allocated blocks
     UINT16                              NBlocks;
+    /// CRC32 of each block of the in-memory copy, used to spot corruption
+    UINT32                              *BlockCrc;
 };
 
 #endif
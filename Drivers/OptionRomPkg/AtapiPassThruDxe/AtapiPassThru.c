@@ -2327,7 +2327,6 @@ Arguments:
 
 --*/
 {
-  UINT32      Index;
   UINT32      RequiredWordCount;
   UINT32      ActualWordCount;
   UINT32      WordCount;
@@ -2383,21 +2382,35 @@ Arguments:
     WordCount = WordCount & 0xffff;
     WordCount /= 2;
 
+    if (WordCount > RequiredWordCount - ActualWordCount) {
+      WordCount = RequiredWordCount - ActualWordCount;
+    }
+
     //
-    // perform a series data In/Out.
+    // move the whole DRQ window with a single FIFO request instead of
+    // one port access per word.
     //
-    for (Index = 0; (Index < WordCount) && (ActualWordCount < RequiredWordCount); Index++, ActualWordCount++) {
-
+    if (WordCount > 0) {
       if (Direction == DataIn) {
 
-        *ptrBuffer = ReadPortW (AtapiScsiPrivate->PciIo, AtapiScsiPrivate->IoPort->Data);
+        ReadPortWMultiple (
+          AtapiScsiPrivate->PciIo,
+          AtapiScsiPrivate->IoPort->Data,
+          WordCount,
+          ptrBuffer
+          );
       } else {
 
-        WritePortW (AtapiScsiPrivate->PciIo, AtapiScsiPrivate->IoPort->Data, *ptrBuffer);
+        WritePortWMultiple (
+          AtapiScsiPrivate->PciIo,
+          AtapiScsiPrivate->IoPort->Data,
+          WordCount,
+          ptrBuffer
+          );
       }
 
-      ptrBuffer++;
-
+      ptrBuffer       += WordCount;
+      ActualWordCount += WordCount;
     }
   }
   //
@@ -2489,6 +2502,43 @@ Returns:
 }
 
 
+VOID
+ReadPortWMultiple (
+  IN  EFI_PCI_IO_PROTOCOL   *PciIo,
+  IN  UINT16                Port,
+  IN  UINTN                 Count,
+  OUT UINT16                *Buffer
+  )
+/*++
+
+Routine Description:
+
+  Read a number of words from a specified I/O port with one FIFO request.
+
+Arguments:
+
+  PciIo      - The pointer of EFI_PCI_IO_PROTOCOL
+  Port       - IO port
+  Count      - The number of words to read
+  Buffer     - The destination buffer
+
+Returns:
+
+   NONE
+
+--*/
+{
+  PciIo->Io.Read (
+              PciIo,
+              EfiPciIoWidthFifoUint16,
+              EFI_PCI_IO_PASS_THROUGH_BAR,
+              (UINT64) Port,
+              Count,
+              Buffer
+              );
+}
+
+
 VOID
 WritePortB (
   IN  EFI_PCI_IO_PROTOCOL   *PciIo,
@@ -2558,6 +2608,43 @@ Returns:
               );
 }
 
+
+VOID
+WritePortWMultiple (
+  IN  EFI_PCI_IO_PROTOCOL   *PciIo,
+  IN  UINT16                Port,
+  IN  UINTN                 Count,
+  IN  UINT16                *Buffer
+  )
+/*++
+
+Routine Description:
+
+  Write a number of words to a specified I/O port with one FIFO request.
+
+Arguments:
+
+  PciIo      - The pointer of EFI_PCI_IO_PROTOCOL
+  Port       - IO port
+  Count      - The number of words to write
+  Buffer     - The source buffer
+
+Returns:
+
+   NONE
+
+--*/
+{
+  PciIo->Io.Write (
+              PciIo,
+              EfiPciIoWidthFifoUint16,
+              EFI_PCI_IO_PASS_THROUGH_BAR,
+              (UINT64) Port,
+              Count,
+              Buffer
+              );
+}
+
 EFI_STATUS
 StatusDRQClear (
   ATAPI_SCSI_PASS_THRU_DEV        *AtapiScsiPrivate,
@@ -1217,7 +1217,7 @@ Arguments:
   PciIo      - The pointer of EFI_PCI_IO_PROTOCOL
   Port       - IO port
   
-Returns:     
+Returns:
 
   A word read out
 
@@ -1225,6 +1225,34 @@ Returns:
 ;
 
 
+VOID
+ReadPortWMultiple (
+  IN  EFI_PCI_IO_PROTOCOL   *PciIo,
+  IN  UINT16                Port,
+  IN  UINTN                 Count,
+  OUT UINT16                *Buffer
+  )
+/*++
+
+Routine Description:
+
+  Read a number of words from a specified I/O port with one FIFO request.
+
+Arguments:
+
+  PciIo      - The pointer of EFI_PCI_IO_PROTOCOL
+  Port       - IO port
+  Count      - Number of words to read
+  Buffer     - Destination buffer
+
+Returns:
+
+  NONE
+
+--*/
+;
+
+
 VOID
 WritePortB (
   IN  EFI_PCI_IO_PROTOCOL   *PciIo,
@@ -1268,11 +1296,38 @@ Arguments:
   PciIo      - The pointer of EFI_PCI_IO_PROTOCOL
   Port       - IO port
   Data       - The data to write
-  
+
 Returns:
 
   NONE
-  
+
+--*/
+;
+
+VOID
+WritePortWMultiple (
+  IN  EFI_PCI_IO_PROTOCOL   *PciIo,
+  IN  UINT16                Port,
+  IN  UINTN                 Count,
+  IN  UINT16                *Buffer
+  )
+/*++
+
+Routine Description:
+
+  Write a number of words to a specified I/O port with one FIFO request.
+
+Arguments:
+
+  PciIo      - The pointer of EFI_PCI_IO_PROTOCOL
+  Port       - IO port
+  Count      - Number of words to write
+  Buffer     - Source buffer
+
+Returns:
+
+  NONE
+
 --*/
 ;
 
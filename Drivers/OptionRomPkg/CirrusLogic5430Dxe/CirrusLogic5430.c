@@ -304,6 +304,27 @@ CirrusLogic5430ControllerDriverStart (
     goto Error;
   }
 
+  //
+  // Request write combining on the frame buffer if the root bridge offers
+  // it; posted writes make Blt updates to VRAM considerably cheaper than
+  // uncached ones. This is an optimization only, so it is not fatal if the
+  // attribute cannot be enabled.
+  //
+  Status = Private->PciIo->Attributes (
+                             Private->PciIo,
+                             EfiPciIoAttributeOperationSupported,
+                             0,
+                             &Supports
+                             );
+  if (!EFI_ERROR (Status) && (Supports & EFI_PCI_IO_ATTRIBUTE_MEMORY_WRITE_COMBINE) != 0) {
+    Private->PciIo->Attributes (
+                      Private->PciIo,
+                      EfiPciIoAttributeOperationEnable,
+                      EFI_PCI_IO_ATTRIBUTE_MEMORY_WRITE_COMBINE,
+                      NULL
+                      );
+  }
+
   //
   // Get ParentDevicePath
   //
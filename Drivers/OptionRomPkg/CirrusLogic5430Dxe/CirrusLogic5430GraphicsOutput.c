@@ -157,7 +157,12 @@ Routine Description:
   }
 
   Private->LineBuffer = NULL;
-  Private->LineBuffer = AllocatePool (ModeData->HorizontalResolution);
+  //
+  // The staging buffer holds a full frame so that rectangles covering
+  // complete scan lines can move to or from video memory with a single
+  // request instead of one request per row.
+  //
+  Private->LineBuffer = AllocatePool (ModeData->HorizontalResolution * ModeData->VerticalResolution);
   if (Private->LineBuffer == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
@@ -297,6 +302,46 @@ Returns:
     //
     // Video to BltBuffer: Source is Video, destination is BltBuffer
     //
+    ScreenWidth = Private->ModeData[CurrentMode].HorizontalResolution;
+    if (SourceX == 0 && Width == ScreenWidth) {
+      //
+      // The rectangle covers complete scan lines, so it is contiguous in
+      // video memory and the whole thing can be fetched in one request.
+      //
+      Offset = SourceY * ScreenWidth;
+      if (((Offset & 0x03) == 0) && (((Width * Height) & 0x03) == 0)) {
+        Private->PciIo->Mem.Read (
+                              Private->PciIo,
+                              EfiPciIoWidthUint32,
+                              0,
+                              Offset,
+                              (Width * Height) >> 2,
+                              Private->LineBuffer
+                              );
+      } else {
+        Private->PciIo->Mem.Read (
+                              Private->PciIo,
+                              EfiPciIoWidthUint8,
+                              0,
+                              Offset,
+                              Width * Height,
+                              Private->LineBuffer
+                              );
+      }
+
+      for (SrcY = SourceY, DstY = DestinationY; DstY < (Height + DestinationY); SrcY++, DstY++) {
+        for (X = 0; X < Width; X++) {
+          Blt         = (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *) ((UINT8 *) BltBuffer + (DstY * Delta) + (DestinationX + X) * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+          Pixel       = Private->LineBuffer[(SrcY - SourceY) * Width + X];
+
+          Blt->Red    = PIXEL_TO_RED_BYTE (Pixel);
+          Blt->Green  = PIXEL_TO_GREEN_BYTE (Pixel);
+          Blt->Blue   = PIXEL_TO_BLUE_BYTE (Pixel);
+        }
+      }
+      break;
+    }
+
     for (SrcY = SourceY, DstY = DestinationY; DstY < (Height + DestinationY); SrcY++, DstY++) {
 
       Offset = (SrcY * Private->ModeData[CurrentMode].HorizontalResolution) + SourceX;
@@ -430,6 +475,49 @@ Returns:
     break;
 
   case EfiBltBufferToVideo:
+    ScreenWidth = Private->ModeData[CurrentMode].HorizontalResolution;
+    if (DestinationX == 0 && Width == ScreenWidth) {
+      //
+      // The rectangle covers complete scan lines; convert it into the
+      // staging buffer and push it to video memory in one request.
+      //
+      for (SrcY = SourceY, DstY = DestinationY; SrcY < (Height + SourceY); SrcY++, DstY++) {
+        for (X = 0; X < Width; X++) {
+          Blt =
+            (EFI_GRAPHICS_OUTPUT_BLT_PIXEL *) (
+                (UINT8 *) BltBuffer +
+                (SrcY * Delta) +
+                ((SourceX + X) * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL))
+              );
+          Private->LineBuffer[(DstY - DestinationY) * Width + X] =
+            RGB_BYTES_TO_PIXEL (Blt->Red, Blt->Green, Blt->Blue);
+        }
+      }
+
+      Offset = DestinationY * ScreenWidth;
+
+      if (((Offset & 0x03) == 0) && (((Width * Height) & 0x03) == 0)) {
+        Private->PciIo->Mem.Write (
+                              Private->PciIo,
+                              EfiPciIoWidthUint32,
+                              0,
+                              Offset,
+                              (Width * Height) >> 2,
+                              Private->LineBuffer
+                              );
+      } else {
+        Private->PciIo->Mem.Write (
+                              Private->PciIo,
+                              EfiPciIoWidthUint8,
+                              0,
+                              Offset,
+                              Width * Height,
+                              Private->LineBuffer
+                              );
+      }
+      break;
+    }
+
     for (SrcY = SourceY, DstY = DestinationY; SrcY < (Height + SourceY); SrcY++, DstY++) {
 
       for (X = 0; X < Width; X++) {
@@ -84,7 +84,11 @@ CirrusLogic5430UgaDrawSetMode (
     }
 
     Private->LineBuffer = NULL;
-    Private->LineBuffer = AllocatePool (HorizontalResolution);
+    //
+    // The staging buffer is shared with the Graphics Output path and is
+    // sized for a full frame there, so keep the two allocations in sync.
+    //
+    Private->LineBuffer = AllocatePool (HorizontalResolution * VerticalResolution);
     if (Private->LineBuffer == NULL) {
       return EFI_OUT_OF_RESOURCES;
     }
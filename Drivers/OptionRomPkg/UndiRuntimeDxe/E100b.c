@@ -446,6 +446,23 @@ IssueCB (
 {
   UINT16  status;
 
+  //
+  // if the CU is still actively walking the CB chain, clearing the
+  // suspend bit on the previous CB lets it chain straight into the new
+  // one - no SCB doorbell (and no spin on the command byte) is needed.
+  // Only if the CU suspended before it saw the cleared bit do we fall
+  // through to the resume below.
+  //
+  status = InWord (AdapterInfo, AdapterInfo->ioaddr + SCBStatus);
+  if ((status & SCB_STATUS_CU_MASK) == SCB_STATUS_CU_ACTIVE) {
+    cmd_ptr->PrevTCBVirtualLinkPtr->cb_header.command &= ~(CmdSuspend | CmdIntr);
+
+    status = InWord (AdapterInfo, AdapterInfo->ioaddr + SCBStatus);
+    if ((status & SCB_STATUS_CU_MASK) == SCB_STATUS_CU_ACTIVE) {
+      return 0;
+    }
+  }
+
   wait_for_cmd_done (AdapterInfo->ioaddr + SCBCmd);
 
   //
@@ -1206,9 +1223,12 @@ E100bReceive (
   status    = InWord (AdapterInfo, AdapterInfo->ioaddr + SCBStatus);
   AdapterInfo->Int_Status = (UINT16) (AdapterInfo->Int_Status | status);
   //
-  // acknoledge the interrupts
+  // acknoledge the interrupts, but skip the doorbell write on the empty
+  // polls the PXE hot loop mostly consists of
   //
-  OutWord (AdapterInfo, (UINT16) (status & 0xfc00), (UINT32) (AdapterInfo->ioaddr + SCBStatus));
+  if ((status & 0xfc00) != 0) {
+    OutWord (AdapterInfo, (UINT16) (status & 0xfc00), (UINT32) (AdapterInfo->ioaddr + SCBStatus));
+  }
 
   //
   // include the prev ints as well
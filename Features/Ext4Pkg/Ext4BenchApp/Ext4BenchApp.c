@@ -0,0 +1,610 @@
+/** @file
+  Filesystem driver benchmark application.
+
+  Measures the read performance every Simple File System volume in the
+  system delivers to its consumers: timed sequential reads, random 4KB
+  reads, directory enumeration and path lookups, all against the root
+  directory of the volume. Rates are derived from the architectural
+  timer through TimerLib, so different Ext4Dxe builds can be compared
+  on the same hardware by running the application from the shell.
+
+  Copyright (c) 2026 Pedro Falcato All rights reserved.
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <Uefi.h>
+
+#include <Guid/FileInfo.h>
+#include <Guid/FileSystemInfo.h>
+#include <Protocol/SimpleFileSystem.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
+
+#define EXT4_BENCH_MAX_FILES      32
+#define EXT4_BENCH_NAME_MAX       255
+#define EXT4_BENCH_DIR_PASSES     32
+#define EXT4_BENCH_LOOKUP_PASSES  32
+#define EXT4_BENCH_SEQ_CHUNK      SIZE_1MB
+#define EXT4_BENCH_SEQ_MAX_BYTES  SIZE_64MB
+#define EXT4_BENCH_RANDOM_READS   1024
+#define EXT4_BENCH_RANDOM_SIZE    SIZE_4KB
+
+// Scratch buffer for ReadFile calls on directories; grown on demand.
+#define EXT4_BENCH_INFO_SIZE      SIZE_1KB
+
+STATIC UINT64   mTimerFrequency;
+STATIC BOOLEAN  mTimerCountsDown;
+
+// Names of regular files found in the volume's root directory, used by the
+// path lookup benchmark, and the largest of them for the read benchmarks.
+STATIC CHAR16  mFileNames[EXT4_BENCH_MAX_FILES][EXT4_BENCH_NAME_MAX + 1];
+STATIC UINTN   mFileNameCount;
+STATIC CHAR16  mLargestFile[EXT4_BENCH_NAME_MAX + 1];
+STATIC UINT64  mLargestFileSize;
+
+/**
+   Returns the ticks elapsed since Start, taking the count direction of
+   the performance counter into account.
+
+   @param[in]   Start   Counter value at the start of the measured interval.
+
+   @return Elapsed ticks.
+**/
+STATIC
+UINT64
+Ext4BenchElapsed (
+  IN UINT64  Start
+  )
+{
+  UINT64  Now;
+
+  Now = GetPerformanceCounter ();
+
+  return mTimerCountsDown ? Start - Now : Now - Start;
+}
+
+/**
+   Converts a unit count over a tick count into a units-per-second rate.
+
+   @param[in]   Units   Number of units (bytes, operations, ...) processed.
+   @param[in]   Ticks   Ticks the processing took.
+
+   @return Units per second, or 0 if the interval was unmeasurably short.
+**/
+STATIC
+UINT64
+Ext4BenchRate (
+  IN UINT64  Units,
+  IN UINT64  Ticks
+  )
+{
+  if ((Ticks == 0) || (mTimerFrequency == 0)) {
+    return 0;
+  }
+
+  return DivU64x64Remainder (MultU64x64 (Units, mTimerFrequency), Ticks, NULL);
+}
+
+/**
+   Converts a tick count to milliseconds.
+
+   @param[in]   Ticks   Number of elapsed ticks.
+
+   @return Elapsed milliseconds.
+**/
+STATIC
+UINT64
+Ext4BenchMilliseconds (
+  IN UINT64  Ticks
+  )
+{
+  if (mTimerFrequency == 0) {
+    return 0;
+  }
+
+  return DivU64x64Remainder (MultU64x64 (Ticks, 1000), mTimerFrequency, NULL);
+}
+
+/**
+   Reads the next entry of a directory, growing the destination buffer when
+   the entry does not fit.
+
+   @param[in]      Directory   Open handle of the directory.
+   @param[in out]  Info        Pointer to the EFI_FILE_INFO buffer pointer.
+   @param[in out]  InfoSize    Pointer to the allocated size of the buffer.
+   @param[out]     Length      Length of the entry read; 0 at the end of the
+                               directory.
+
+   @return Status of the read.
+**/
+STATIC
+EFI_STATUS
+Ext4BenchReadDirEntry (
+  IN EFI_FILE_PROTOCOL  *Directory,
+  IN OUT EFI_FILE_INFO  **Info,
+  IN OUT UINTN          *InfoSize,
+  OUT UINTN             *Length
+  )
+{
+  EFI_STATUS  Status;
+
+  *Length = *InfoSize;
+  Status  = Directory->Read (Directory, Length, *Info);
+
+  if (Status == EFI_BUFFER_TOO_SMALL) {
+    FreePool (*Info);
+    *InfoSize = *Length;
+    *Info     = AllocatePool (*InfoSize);
+
+    if (*Info == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    *Length = *InfoSize;
+    Status  = Directory->Read (Directory, Length, *Info);
+  }
+
+  return Status;
+}
+
+/**
+   Collects the regular files of the volume's root directory, to give the
+   lookup and read benchmarks something to work on.
+
+   @param[in]   Root    Open handle of the root directory.
+
+   @return Status of the directory enumeration.
+**/
+STATIC
+EFI_STATUS
+Ext4BenchCollectFiles (
+  IN EFI_FILE_PROTOCOL  *Root
+  )
+{
+  EFI_STATUS     Status;
+  EFI_FILE_INFO  *Info;
+  UINTN          InfoSize;
+  UINTN          Length;
+
+  mFileNameCount   = 0;
+  mLargestFileSize = 0;
+  mLargestFile[0]  = L'\0';
+
+  InfoSize = EXT4_BENCH_INFO_SIZE;
+  Info     = AllocatePool (InfoSize);
+
+  if (Info == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = Root->SetPosition (Root, 0);
+
+  if (EFI_ERROR (Status)) {
+    FreePool (Info);
+    return Status;
+  }
+
+  for ( ; ;) {
+    Status = Ext4BenchReadDirEntry (Root, &Info, &InfoSize, &Length);
+
+    if (EFI_ERROR (Status) || (Length == 0)) {
+      break;
+    }
+
+    if ((Info->Attribute & EFI_FILE_DIRECTORY) != 0) {
+      continue;
+    }
+
+    if (StrLen (Info->FileName) > EXT4_BENCH_NAME_MAX) {
+      continue;
+    }
+
+    if (mFileNameCount < EXT4_BENCH_MAX_FILES) {
+      StrCpyS (mFileNames[mFileNameCount], EXT4_BENCH_NAME_MAX + 1, Info->FileName);
+      mFileNameCount++;
+    }
+
+    if (Info->FileSize > mLargestFileSize) {
+      mLargestFileSize = Info->FileSize;
+      StrCpyS (mLargestFile, EXT4_BENCH_NAME_MAX + 1, Info->FileName);
+    }
+  }
+
+  FreePool (Info);
+  return Status;
+}
+
+/**
+   Benchmarks enumeration of the volume's root directory.
+
+   @param[in]   Root    Open handle of the root directory.
+**/
+STATIC
+VOID
+Ext4BenchDirEnumeration (
+  IN EFI_FILE_PROTOCOL  *Root
+  )
+{
+  EFI_STATUS     Status;
+  EFI_FILE_INFO  *Info;
+  UINTN          InfoSize;
+  UINTN          Length;
+  UINTN          Pass;
+  UINT64         Entries;
+  UINT64         Start;
+  UINT64         Ticks;
+
+  InfoSize = EXT4_BENCH_INFO_SIZE;
+  Info     = AllocatePool (InfoSize);
+
+  if (Info == NULL) {
+    return;
+  }
+
+  Entries = 0;
+  Start   = GetPerformanceCounter ();
+
+  for (Pass = 0; Pass < EXT4_BENCH_DIR_PASSES; Pass++) {
+    Status = Root->SetPosition (Root, 0);
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    for ( ; ;) {
+      Status = Ext4BenchReadDirEntry (Root, &Info, &InfoSize, &Length);
+
+      if (EFI_ERROR (Status) || (Length == 0)) {
+        break;
+      }
+
+      Entries++;
+    }
+  }
+
+  Ticks = Ext4BenchElapsed (Start);
+
+  FreePool (Info);
+
+  Print (
+    L"  dir enumeration : %lu entries/s (%lu entries in %lu ms)\n",
+    Ext4BenchRate (Entries, Ticks),
+    Entries,
+    Ext4BenchMilliseconds (Ticks)
+    );
+}
+
+/**
+   Benchmarks path lookups of the collected root directory files.
+
+   @param[in]   Root    Open handle of the root directory.
+**/
+STATIC
+VOID
+Ext4BenchPathLookup (
+  IN EFI_FILE_PROTOCOL  *Root
+  )
+{
+  EFI_STATUS         Status;
+  EFI_FILE_PROTOCOL  *File;
+  UINTN              Pass;
+  UINTN              Index;
+  UINT64             Lookups;
+  UINT64             Start;
+  UINT64             Ticks;
+
+  if (mFileNameCount == 0) {
+    Print (L"  path lookup     : skipped, no regular files in the root directory\n");
+    return;
+  }
+
+  Lookups = 0;
+  Start   = GetPerformanceCounter ();
+
+  for (Pass = 0; Pass < EXT4_BENCH_LOOKUP_PASSES; Pass++) {
+    for (Index = 0; Index < mFileNameCount; Index++) {
+      Status = Root->Open (Root, &File, mFileNames[Index], EFI_FILE_MODE_READ, 0);
+
+      if (EFI_ERROR (Status)) {
+        continue;
+      }
+
+      File->Close (File);
+      Lookups++;
+    }
+  }
+
+  Ticks = Ext4BenchElapsed (Start);
+
+  Print (
+    L"  path lookup     : %lu ops/s (%lu lookups in %lu ms)\n",
+    Ext4BenchRate (Lookups, Ticks),
+    Lookups,
+    Ext4BenchMilliseconds (Ticks)
+    );
+}
+
+/**
+   Benchmarks sequential reads of the largest root directory file.
+
+   @param[in]   Root    Open handle of the root directory.
+**/
+STATIC
+VOID
+Ext4BenchSequentialRead (
+  IN EFI_FILE_PROTOCOL  *Root
+  )
+{
+  EFI_STATUS         Status;
+  EFI_FILE_PROTOCOL  *File;
+  VOID               *Buffer;
+  UINTN              Length;
+  UINT64             BytesRead;
+  UINT64             Start;
+  UINT64             Ticks;
+
+  if (mLargestFileSize == 0) {
+    Print (L"  sequential read : skipped, no regular files in the root directory\n");
+    return;
+  }
+
+  Status = Root->Open (Root, &File, mLargestFile, EFI_FILE_MODE_READ, 0);
+
+  if (EFI_ERROR (Status)) {
+    Print (L"  sequential read : failed to open '%s' - %r\n", mLargestFile, Status);
+    return;
+  }
+
+  Buffer = AllocatePool (EXT4_BENCH_SEQ_CHUNK);
+
+  if (Buffer == NULL) {
+    File->Close (File);
+    return;
+  }
+
+  BytesRead = 0;
+  Start     = GetPerformanceCounter ();
+
+  while (BytesRead < EXT4_BENCH_SEQ_MAX_BYTES) {
+    Length = EXT4_BENCH_SEQ_CHUNK;
+    Status = File->Read (File, &Length, Buffer);
+
+    if (EFI_ERROR (Status) || (Length == 0)) {
+      break;
+    }
+
+    BytesRead += Length;
+  }
+
+  Ticks = Ext4BenchElapsed (Start);
+
+  FreePool (Buffer);
+  File->Close (File);
+
+  Print (
+    L"  sequential read : %lu MB/s ('%s', %lu KB in %lu ms)\n",
+    RShiftU64 (Ext4BenchRate (BytesRead, Ticks), 20),
+    mLargestFile,
+    RShiftU64 (BytesRead, 10),
+    Ext4BenchMilliseconds (Ticks)
+    );
+}
+
+/**
+   Benchmarks random 4KB reads of the largest root directory file.
+
+   @param[in]   Root    Open handle of the root directory.
+**/
+STATIC
+VOID
+Ext4BenchRandomRead (
+  IN EFI_FILE_PROTOCOL  *Root
+  )
+{
+  EFI_STATUS         Status;
+  EFI_FILE_PROTOCOL  *File;
+  VOID               *Buffer;
+  UINTN              Length;
+  UINTN              Index;
+  UINT64             Seed;
+  UINT64             Blocks;
+  UINT64             Position;
+  UINT64             Reads;
+  UINT64             BytesRead;
+  UINT64             Start;
+  UINT64             Ticks;
+
+  if (mLargestFileSize < EXT4_BENCH_RANDOM_SIZE) {
+    Print (L"  random 4K read  : skipped, no root directory file of at least 4KB\n");
+    return;
+  }
+
+  Status = Root->Open (Root, &File, mLargestFile, EFI_FILE_MODE_READ, 0);
+
+  if (EFI_ERROR (Status)) {
+    Print (L"  random 4K read  : failed to open '%s' - %r\n", mLargestFile, Status);
+    return;
+  }
+
+  Buffer = AllocatePool (EXT4_BENCH_RANDOM_SIZE);
+
+  if (Buffer == NULL) {
+    File->Close (File);
+    return;
+  }
+
+  Blocks    = DivU64x32 (mLargestFileSize, EXT4_BENCH_RANDOM_SIZE);
+  Seed      = 1;
+  Reads     = 0;
+  BytesRead = 0;
+  Start     = GetPerformanceCounter ();
+
+  for (Index = 0; Index < EXT4_BENCH_RANDOM_READS; Index++) {
+    // Knuth's MMIX linear congruential generator; deterministic on purpose,
+    // so different driver builds read the exact same block sequence.
+    Seed     = MultU64x64 (Seed, 6364136223846793005ULL) + 1442695040888963407ULL;
+    DivU64x64Remainder (RShiftU64 (Seed, 16), Blocks, &Position);
+    Position = MultU64x32 (Position, EXT4_BENCH_RANDOM_SIZE);
+
+    Status = File->SetPosition (File, Position);
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    Length = EXT4_BENCH_RANDOM_SIZE;
+    Status = File->Read (File, &Length, Buffer);
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    Reads++;
+    BytesRead += Length;
+  }
+
+  Ticks = Ext4BenchElapsed (Start);
+
+  FreePool (Buffer);
+  File->Close (File);
+
+  Print (
+    L"  random 4K read  : %lu ops/s, %lu MB/s (%lu reads in %lu ms)\n",
+    Ext4BenchRate (Reads, Ticks),
+    RShiftU64 (Ext4BenchRate (BytesRead, Ticks), 20),
+    Reads,
+    Ext4BenchMilliseconds (Ticks)
+    );
+}
+
+/**
+   Benchmarks one volume.
+
+   @param[in]   Handle  Handle the volume's Simple File System protocol is
+                        installed on.
+   @param[in]   Index   Ordinal of the volume, for the report.
+**/
+STATIC
+VOID
+Ext4BenchVolume (
+  IN EFI_HANDLE  Handle,
+  IN UINTN       Index
+  )
+{
+  EFI_STATUS                       Status;
+  EFI_SIMPLE_FILE_SYSTEM_PROTOCOL  *FileSystem;
+  EFI_FILE_PROTOCOL                *Root;
+  EFI_FILE_SYSTEM_INFO             *FsInfo;
+  UINTN                            FsInfoSize;
+
+  Status = gBS->HandleProtocol (
+                  Handle,
+                  &gEfiSimpleFileSystemProtocolGuid,
+                  (VOID **)&FileSystem
+                  );
+
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  Status = FileSystem->OpenVolume (FileSystem, &Root);
+
+  if (EFI_ERROR (Status)) {
+    Print (L"fs%u: failed to open the volume - %r\n", (UINT32)Index, Status);
+    return;
+  }
+
+  FsInfoSize = SIZE_1KB;
+  FsInfo     = AllocateZeroPool (FsInfoSize);
+
+  if (FsInfo != NULL) {
+    Status = Root->GetInfo (Root, &gEfiFileSystemInfoGuid, &FsInfoSize, FsInfo);
+
+    if (!EFI_ERROR (Status)) {
+      Print (
+        L"fs%u: '%s', %lu MB%s\n",
+        (UINT32)Index,
+        FsInfo->VolumeLabel,
+        RShiftU64 (FsInfo->VolumeSize, 20),
+        FsInfo->ReadOnly ? L", read-only" : L""
+        );
+    } else {
+      Print (L"fs%u:\n", (UINT32)Index);
+    }
+
+    FreePool (FsInfo);
+  }
+
+  Status = Ext4BenchCollectFiles (Root);
+
+  if (EFI_ERROR (Status)) {
+    Print (L"  failed to enumerate the root directory - %r\n", Status);
+    Root->Close (Root);
+    return;
+  }
+
+  Ext4BenchSequentialRead (Root);
+  Ext4BenchRandomRead (Root);
+  Ext4BenchDirEnumeration (Root);
+  Ext4BenchPathLookup (Root);
+
+  Root->Close (Root);
+}
+
+/**
+   The benchmark application's entry point. Benchmarks every volume in the
+   system in turn.
+
+   @param[in]   ImageHandle   The firmware allocated handle for the EFI image.
+   @param[in]   SystemTable   A pointer to the EFI System Table.
+
+   @retval EFI_SUCCESS   The benchmarks ran.
+   @retval other         No volume could be benchmarked.
+**/
+EFI_STATUS
+EFIAPI
+Ext4BenchEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  *Handles;
+  UINTN       HandleCount;
+  UINTN       Index;
+  UINT64      StartValue;
+  UINT64      EndValue;
+
+  mTimerFrequency  = GetPerformanceCounterProperties (&StartValue, &EndValue);
+  mTimerCountsDown = StartValue > EndValue;
+
+  if (mTimerFrequency == 0) {
+    Print (L"Ext4Bench: no usable performance counter, rates will read 0\n");
+  }
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiSimpleFileSystemProtocolGuid,
+                  NULL,
+                  &HandleCount,
+                  &Handles
+                  );
+
+  if (EFI_ERROR (Status)) {
+    Print (L"Ext4Bench: no Simple File System volumes found - %r\n", Status);
+    return Status;
+  }
+
+  for (Index = 0; Index < HandleCount; Index++) {
+    Ext4BenchVolume (Handles[Index], Index);
+  }
+
+  FreePool (Handles);
+
+  return EFI_SUCCESS;
+}
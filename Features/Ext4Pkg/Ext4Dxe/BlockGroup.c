@@ -27,6 +27,127 @@ Ext4GetBlockGroupDesc (
   return (EXT4_BLOCK_GROUP_DESC *)((CHAR8 *)Partition->BlockGroups + BlockGroup * Partition->DescSize);
 }
 
+// Upper bound on cached inode table blocks per partition. Inode tables have
+// strong locality during directory enumeration: with 256-byte inodes a 4KB
+// block covers 16 inodes, so even a handful of blocks turns an enumeration
+// of N files into roughly N/16 disk reads.
+#define EXT4_INODE_BLOCK_CACHE_MAX_BLOCKS  8U
+
+/**
+   This structure represents one cached block of the inode table, keyed by
+   its physical block number. The list is kept in most-recently-used order
+   and doubles as the LRU eviction order. The block's data follows the
+   structure and is Partition->BlockSize bytes long.
+ */
+typedef struct {
+  LIST_ENTRY       Node;
+  EXT4_BLOCK_NR    BlockNr;
+} EXT4_INODE_BLOCK;
+
+#define EXT4_INODE_BLOCK_DATA(CacheBlock)  ((CHAR8 *)((CacheBlock) + 1))
+
+/**
+   Reads an inode from the inode table, going through the partition's cache
+   of inode table blocks.
+
+   Inodes that cannot be served at block granularity, e.g. because the inode
+   size exceeds the block size, are read from disk directly. Failure to cache
+   a block is not an error either; the inode is then read from disk as well.
+
+   @param[in]    Partition  Pointer to the opened partition.
+   @param[in]    Offset     Byte offset of the inode on the partition.
+   @param[out]   Inode      Pointer to a buffer of Partition->InodeSize bytes.
+
+   @return Status of the read.
+**/
+STATIC
+EFI_STATUS
+Ext4ReadInodeTableBytes (
+  IN EXT4_PARTITION  *Partition,
+  IN UINT64          Offset,
+  OUT EXT4_INODE     *Inode
+  )
+{
+  EFI_STATUS        Status;
+  EXT4_BLOCK_NR     BlockNr;
+  UINT32            WithinBlock;
+  LIST_ENTRY        *Entry;
+  EXT4_INODE_BLOCK  *CacheBlock;
+
+  BlockNr = DivU64x32Remainder (Offset, Partition->BlockSize, &WithinBlock);
+
+  if (WithinBlock + Partition->InodeSize > Partition->BlockSize) {
+    return Ext4ReadDiskIo (Partition, Inode, Partition->InodeSize, Offset);
+  }
+
+  BASE_LIST_FOR_EACH (Entry, &Partition->InodeBlockCache) {
+    CacheBlock = BASE_CR (Entry, EXT4_INODE_BLOCK, Node);
+
+    if (CacheBlock->BlockNr == BlockNr) {
+      RemoveEntryList (&CacheBlock->Node);
+      InsertHeadList (&Partition->InodeBlockCache, &CacheBlock->Node);
+
+      CopyMem (Inode, EXT4_INODE_BLOCK_DATA (CacheBlock) + WithinBlock, Partition->InodeSize);
+      return EFI_SUCCESS;
+    }
+  }
+
+  if (Partition->InodeBlockCacheSize >= EXT4_INODE_BLOCK_CACHE_MAX_BLOCKS) {
+    CacheBlock = BASE_CR (GetPreviousNode (&Partition->InodeBlockCache, &Partition->InodeBlockCache),
+                   EXT4_INODE_BLOCK, Node);
+    RemoveEntryList (&CacheBlock->Node);
+    FreePool (CacheBlock);
+    Partition->InodeBlockCacheSize--;
+  }
+
+  CacheBlock = AllocatePool (sizeof (EXT4_INODE_BLOCK) + Partition->BlockSize);
+
+  if (CacheBlock == NULL) {
+    return Ext4ReadDiskIo (Partition, Inode, Partition->InodeSize, Offset);
+  }
+
+  Status = Ext4ReadDiskIo (
+             Partition,
+             EXT4_INODE_BLOCK_DATA (CacheBlock),
+             Partition->BlockSize,
+             EXT4_BLOCK_TO_BYTES (Partition, BlockNr)
+             );
+
+  if (EFI_ERROR (Status)) {
+    FreePool (CacheBlock);
+    return Status;
+  }
+
+  CacheBlock->BlockNr = BlockNr;
+
+  InsertHeadList (&Partition->InodeBlockCache, &CacheBlock->Node);
+  Partition->InodeBlockCacheSize++;
+
+  CopyMem (Inode, EXT4_INODE_BLOCK_DATA (CacheBlock) + WithinBlock, Partition->InodeSize);
+  return EFI_SUCCESS;
+}
+
+/**
+   Frees the partition's cache of inode table blocks.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+**/
+VOID
+Ext4FreeInodeBlockCache (
+  IN EXT4_PARTITION  *Partition
+  )
+{
+  EXT4_INODE_BLOCK  *CacheBlock;
+
+  while (!IsListEmpty (&Partition->InodeBlockCache)) {
+    CacheBlock = BASE_CR (GetFirstNode (&Partition->InodeBlockCache), EXT4_INODE_BLOCK, Node);
+    RemoveEntryList (&CacheBlock->Node);
+    FreePool (CacheBlock);
+  }
+
+  Partition->InodeBlockCacheSize = 0;
+}
+
 /**
    Reads an inode from disk.
 
@@ -77,11 +198,10 @@ Ext4ReadInode (
                       BlockGroup->bg_inode_table_hi
                       );
 
-  Status = Ext4ReadDiskIo (
+  Status = Ext4ReadInodeTableBytes (
              Partition,
-             Inode,
-             Partition->InodeSize,
-             EXT4_BLOCK_TO_BYTES (Partition, InodeTableStart) + MultU64x32 (InodeOffset, Partition->InodeSize)
+             EXT4_BLOCK_TO_BYTES (Partition, InodeTableStart) + MultU64x32 (InodeOffset, Partition->InodeSize),
+             Inode
              );
 
   if (EFI_ERROR (Status)) {
@@ -82,46 +82,607 @@ Ext4ValidDirent (
 }
 
 /**
-   Retrieves a directory entry.
+   Searches a single block of directory entries for a given filename.
 
-   @param[in]      Directory   Pointer to the opened directory.
-   @param[in]      NameUnicode Pointer to the UCS-2 formatted filename.
    @param[in]      Partition   Pointer to the ext4 partition.
+   @param[in]      Buf         Pointer to one block's worth of directory entries.
+   @param[in]      Name        Pointer to the UCS-2 formatted filename.
    @param[out]     Result      Pointer to the destination directory entry.
 
-   @return The result of the operation.
+   @retval EFI_SUCCESS           The directory entry was found.
+   @retval EFI_NOT_FOUND         The block holds no matching entry.
+   @retval EFI_VOLUME_CORRUPTED  The block is not a valid run of entries.
 **/
+STATIC
 EFI_STATUS
-Ext4RetrieveDirent (
-  IN EXT4_FILE        *Directory,
-  IN CONST CHAR16     *Name,
+Ext4ScanDirentBlock (
   IN EXT4_PARTITION   *Partition,
+  IN CONST CHAR8      *Buf,
+  IN CONST CHAR16     *Name,
   OUT EXT4_DIR_ENTRY  *Result
   )
 {
   EFI_STATUS      Status;
-  CHAR8           *Buf;
-  UINT64          Off;
-  EXT4_INODE      *Inode;
-  UINT64          DirInoSize;
-  UINT32          BlockRemainder;
-  UINTN           Length;
   EXT4_DIR_ENTRY  *Entry;
   UINTN           RemainingBlock;
   CHAR16          DirentUcs2Name[EXT4_NAME_MAX + 1];
   UINTN           ToCopy;
   UINTN           BlockOffset;
 
-  Status = EFI_NOT_FOUND;
-  Buf    = AllocatePool (Partition->BlockSize);
+  for (BlockOffset = 0; BlockOffset < Partition->BlockSize; ) {
+    Entry = (EXT4_DIR_ENTRY *)(Buf + BlockOffset);
+    RemainingBlock = Partition->BlockSize - BlockOffset;
+    // Check if the minimum directory entry fits inside [BlockOffset, EndOfBlock]
+    if (RemainingBlock < EXT4_MIN_DIR_ENTRY_LEN) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    if (!Ext4ValidDirent (Entry)) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    if (Entry->name_len > RemainingBlock || Entry->rec_len > RemainingBlock) {
+      // Corrupted filesystem
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    // Ignore names bigger than our limit.
+
+    /* Note: I think having a limit is sane because:
+      1) It's nicer to work with.
+      2) Linux and a number of BSDs also have a filename limit of 255.
+    */
+    if (Entry->name_len > EXT4_NAME_MAX) {
+      BlockOffset += Entry->rec_len;
+      continue;
+    }
+
+    // Unused entry
+    if (Entry->inode == 0) {
+      BlockOffset += Entry->rec_len;
+      continue;
+    }
+
+    Status = Ext4GetUcs2DirentName (Entry, DirentUcs2Name);
+
+    /* In theory, this should never fail.
+     * In reality, it's quite possible that it can fail, considering filenames in
+     * Linux (and probably other nixes) are just null-terminated bags of bytes, and don't
+     * need to form valid ASCII/UTF-8 sequences.
+     */
+    if (EFI_ERROR (Status)) {
+      // If we error out, skip this entry
+      // I'm not sure if this is correct behaviour, but I don't think there's a precedent here.
+      BlockOffset += Entry->rec_len;
+      continue;
+    }
+
+    if (Entry->name_len == StrLen (Name) &&
+        !Ext4StrCmpInsensitive (DirentUcs2Name, (CHAR16 *)Name)) {
+      ToCopy = MIN (Entry->rec_len, sizeof (EXT4_DIR_ENTRY));
+
+      CopyMem (Result, Entry, ToCopy);
+      return EFI_SUCCESS;
+    }
+
+    BlockOffset += Entry->rec_len;
+  }
+
+  return EFI_NOT_FOUND;
+}
+
+//
+// Half MD4 transform constants and round functions, matching the hash the
+// kernel uses for htree indexed directories.
+//
+#define EXT4_DX_MD4_K2  0x5A827999
+#define EXT4_DX_MD4_K3  0x6ED9EBA1
+
+#define EXT4_DX_MD4_F(x, y, z)  ((z) ^ ((x) & ((y) ^ (z))))
+#define EXT4_DX_MD4_G(x, y, z)  (((x) & (y)) + (((x) ^ (y)) & (z)))
+#define EXT4_DX_MD4_H(x, y, z)  ((x) ^ (y) ^ (z))
+
+#define EXT4_DX_MD4_ROUND(f, a, b, c, d, x, s)  \
+  ((a) += f (b, c, d) + (x), (a) = LRotU32 ((a), (s)))
+
+/**
+   Performs one half MD4 transform over a block of hashed name data.
+
+   @param[in out]  Hash        Hash state, 4 words.
+   @param[in]      Data        One block of hashed name data, 8 words.
+**/
+STATIC
+VOID
+Ext4DxHalfMd4Transform (
+  IN OUT UINT32    Hash[4],
+  IN CONST UINT32  Data[8]
+  )
+{
+  UINT32  A;
+  UINT32  B;
+  UINT32  C;
+  UINT32  D;
+
+  A = Hash[0];
+  B = Hash[1];
+  C = Hash[2];
+  D = Hash[3];
+
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, A, B, C, D, Data[0], 3);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, D, A, B, C, Data[1], 7);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, C, D, A, B, Data[2], 11);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, B, C, D, A, Data[3], 19);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, A, B, C, D, Data[4], 3);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, D, A, B, C, Data[5], 7);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, C, D, A, B, Data[6], 11);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_F, B, C, D, A, Data[7], 19);
+
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, A, B, C, D, Data[1] + EXT4_DX_MD4_K2, 3);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, D, A, B, C, Data[3] + EXT4_DX_MD4_K2, 5);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, C, D, A, B, Data[5] + EXT4_DX_MD4_K2, 9);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, B, C, D, A, Data[7] + EXT4_DX_MD4_K2, 13);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, A, B, C, D, Data[0] + EXT4_DX_MD4_K2, 3);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, D, A, B, C, Data[2] + EXT4_DX_MD4_K2, 5);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, C, D, A, B, Data[4] + EXT4_DX_MD4_K2, 9);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_G, B, C, D, A, Data[6] + EXT4_DX_MD4_K2, 13);
+
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, A, B, C, D, Data[3] + EXT4_DX_MD4_K3, 3);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, D, A, B, C, Data[7] + EXT4_DX_MD4_K3, 9);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, C, D, A, B, Data[2] + EXT4_DX_MD4_K3, 11);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, B, C, D, A, Data[6] + EXT4_DX_MD4_K3, 15);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, A, B, C, D, Data[1] + EXT4_DX_MD4_K3, 3);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, D, A, B, C, Data[5] + EXT4_DX_MD4_K3, 9);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, C, D, A, B, Data[0] + EXT4_DX_MD4_K3, 11);
+  EXT4_DX_MD4_ROUND (EXT4_DX_MD4_H, B, C, D, A, Data[4] + EXT4_DX_MD4_K3, 15);
+
+  Hash[0] += A;
+  Hash[1] += B;
+  Hash[2] += C;
+  Hash[3] += D;
+}
+
+/**
+   Packs up to 32 bytes of a filename into the hash input block, padded
+   with the name's length, the way the kernel's str2hashbuf does.
+
+   @param[in]      Name           Pointer to the remaining filename bytes.
+   @param[in]      Length         Remaining length of the filename.
+   @param[out]     Data           Output hash input block, 8 words.
+   @param[in]      UnsignedChars  TRUE to hash the name bytes as unsigned
+                                  chars, as told by the superblock.
+**/
+STATIC
+VOID
+Ext4DxStr2HashBuf (
+  IN CONST CHAR8  *Name,
+  IN UINTN        Length,
+  OUT UINT32      *Data,
+  IN BOOLEAN      UnsignedChars
+  )
+{
+  UINT32  Pad;
+  UINT32  Value;
+  UINTN   Words;
+  UINTN   Index;
+
+  Pad  = (UINT32)Length | ((UINT32)Length << 8);
+  Pad |= Pad << 16;
+
+  Value = Pad;
+  Words = 8;
+
+  if (Length > Words * 4) {
+    Length = Words * 4;
+  }
+
+  for (Index = 0; Index < Length; Index++) {
+    if (UnsignedChars) {
+      Value = (UINT8)Name[Index] + (Value << 8);
+    } else {
+      Value = (UINT32)(INT32)(INT8)Name[Index] + (Value << 8);
+    }
+
+    if ((Index % 4) == 3) {
+      *Data++ = Value;
+      Value = Pad;
+      Words--;
+    }
+  }
+
+  if (Words > 0) {
+    *Data++ = Value;
+    Words--;
+  }
+
+  while (Words > 0) {
+    *Data++ = Pad;
+    Words--;
+  }
+}
+
+/**
+   Computes the name hash an htree indexed directory is organized by.
+
+   @param[in]      Partition    Pointer to the ext4 partition.
+   @param[in]      Name         Pointer to the NUL terminated UTF-8 filename.
+   @param[in]      HashVersion  Hash algorithm, from the index root.
+   @param[out]     Hash         Computed major hash of the name.
+
+   @retval EFI_SUCCESS          The hash was computed.
+   @retval EFI_UNSUPPORTED      The hash algorithm is not supported.
+**/
+STATIC
+EFI_STATUS
+Ext4DxHashName (
+  IN EXT4_PARTITION  *Partition,
+  IN CONST CHAR8     *Name,
+  IN UINT8           HashVersion,
+  OUT UINT32         *Hash
+  )
+{
+  UINT32   HashState[4];
+  UINT32   Data[8];
+  UINTN    Length;
+  BOOLEAN  UnsignedChars;
+  UINTN    Index;
+
+  if (HashVersion != EXT4_DX_HASH_HALF_MD4) {
+    // Half MD4 has been the mke2fs default for ages; directories hashed
+    // with the legacy or TEA functions take the linear scan instead.
+    return EFI_UNSUPPORTED;
+  }
+
+  UnsignedChars = (Partition->SuperBlock.s_flags & EXT4_FLAGS_UNSIGNED_HASH) != 0;
+
+  HashState[0] = 0x67452301;
+  HashState[1] = 0xEFCDAB89;
+  HashState[2] = 0x98BADCFE;
+  HashState[3] = 0x10325476;
+
+  for (Index = 0; Index < 4; Index++) {
+    if (Partition->SuperBlock.s_hash_seed[Index] != 0) {
+      CopyMem (HashState, Partition->SuperBlock.s_hash_seed, sizeof (HashState));
+      break;
+    }
+  }
+
+  Length = AsciiStrLen (Name);
+
+  while (Length > 0) {
+    Ext4DxStr2HashBuf (Name, Length, Data, UnsignedChars);
+    Ext4DxHalfMd4Transform (HashState, Data);
+
+    if (Length <= 32) {
+      break;
+    }
+
+    Name   += 32;
+    Length -= 32;
+  }
+
+  // The low bit distinguishes leaves continuing a hash collision.
+  *Hash = HashState[1] & ~1U;
+
+  return EFI_SUCCESS;
+}
+
+/**
+   Looks a directory entry up through the directory's htree index, reading
+   O(log n) blocks instead of scanning the whole directory.
+
+   @param[in]      Directory   Pointer to the opened directory.
+   @param[in]      Name        Pointer to the UCS-2 formatted filename.
+   @param[in]      Partition   Pointer to the ext4 partition.
+   @param[out]     Result      Pointer to the destination directory entry.
+
+   @retval EFI_SUCCESS         The directory entry was found.
+   @retval EFI_NOT_FOUND       The indexed leaf holds no exact match.
+   @retval EFI_UNSUPPORTED     The index uses an unsupported hash algorithm.
+   @return Other               Read error or a corrupted index.
+**/
+STATIC
+EFI_STATUS
+Ext4DxRetrieveDirent (
+  IN EXT4_FILE        *Directory,
+  IN CONST CHAR16     *Name,
+  IN EXT4_PARTITION   *Partition,
+  OUT EXT4_DIR_ENTRY  *Result
+  )
+{
+  EFI_STATUS          Status;
+  CHAR8               *Utf8Name;
+  CHAR8               *Buf;
+  EXT4_DX_ROOT_INFO   *RootInfo;
+  EXT4_DX_ENTRY       *Entries;
+  EXT4_DX_ENTRY       *Low;
+  EXT4_DX_ENTRY       *High;
+  EXT4_DX_ENTRY       *Middle;
+  EXT4_DX_COUNTLIMIT  *CountLimit;
+  UINT32              Hash;
+  UINT32              BlockNr;
+  UINTN               Count;
+  UINTN               Limit;
+  UINTN               EntriesOffset;
+  UINT8               Levels;
+  UINT64              DirInoSize;
+  UINTN               Length;
+
+  Status = UCS2StrToUTF8 ((CHAR16 *)Name, &Utf8Name);
+
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Buf = Ext4AllocateBlockScratch (Partition);
 
   if (Buf == NULL) {
+    FreePool (Utf8Name);
     return EFI_OUT_OF_RESOURCES;
   }
 
-  Off = 0;
+  // The index root sits in the first directory block, hidden behind the
+  // "." and ".." entries.
+  Length = Partition->BlockSize;
+  Status = Ext4Read (Partition, Directory, Buf, 0, &Length);
 
-  Inode = Directory->Inode;
+  if (Status != EFI_SUCCESS) {
+    goto Exit;
+  }
+
+  RootInfo = (EXT4_DX_ROOT_INFO *)(Buf + EXT4_DX_ROOT_INFO_OFFSET);
+
+  if ((RootInfo->reserved_zero != 0) ||
+      (RootInfo->info_length < sizeof (EXT4_DX_ROOT_INFO)) ||
+      (RootInfo->indirect_levels > 3)) {
+    Status = EFI_VOLUME_CORRUPTED;
+    goto Exit;
+  }
+
+  Status = Ext4DxHashName (Partition, Utf8Name, RootInfo->hash_version, &Hash);
+
+  if (EFI_ERROR (Status)) {
+    goto Exit;
+  }
+
+  Levels        = RootInfo->indirect_levels;
+  EntriesOffset = EXT4_DX_ROOT_INFO_OFFSET + RootInfo->info_length;
+  DirInoSize    = EXT4_INODE_SIZE (Directory->Inode);
+
+  for ( ; ;) {
+    Entries    = (EXT4_DX_ENTRY *)(Buf + EntriesOffset);
+    CountLimit = (EXT4_DX_COUNTLIMIT *)Entries;
+    Count      = CountLimit->count;
+    Limit      = CountLimit->limit;
+
+    if ((Count == 0) || (Count > Limit) ||
+        (Limit > (Partition->BlockSize - EntriesOffset) / sizeof (EXT4_DX_ENTRY))) {
+      Status = EFI_VOLUME_CORRUPTED;
+      goto Exit;
+    }
+
+    // Binary search for the last entry whose hash does not exceed ours.
+    // Entries[0] holds the count/limit instead of a hash and covers
+    // everything hashing below Entries[1].
+    Low  = Entries + 1;
+    High = Entries + Count - 1;
+
+    while (Low <= High) {
+      Middle = Low + (High - Low) / 2;
+
+      if (Middle->hash > Hash) {
+        High = Middle - 1;
+      } else {
+        Low = Middle + 1;
+      }
+    }
+
+    BlockNr = (Low - 1)->block & EXT4_DX_BLOCK_MASK;
+
+    if (MultU64x32 (BlockNr, Partition->BlockSize) >= DirInoSize) {
+      Status = EFI_VOLUME_CORRUPTED;
+      goto Exit;
+    }
+
+    Length = Partition->BlockSize;
+    Status = Ext4Read (
+               Partition,
+               Directory,
+               Buf,
+               MultU64x32 (BlockNr, Partition->BlockSize),
+               &Length
+               );
+
+    if (Status != EFI_SUCCESS) {
+      goto Exit;
+    }
+
+    if (Levels == 0) {
+      break;
+    }
+
+    // Interior nodes carry their entries behind a single fake dirent.
+    Levels--;
+    EntriesOffset = EXT4_DX_NODE_ENTRIES_OFFSET;
+  }
+
+  Status = Ext4ScanDirentBlock (Partition, Buf, Name, Result);
+
+Exit:
+  Ext4FreeBlockScratch (Partition, Buf);
+  FreePool (Utf8Name);
+
+  return Status;
+}
+
+// Upper bound on cached directory lookups per partition. Boot loaders probe
+// the same handful of paths many times over, so a small cache goes a long way.
+#define EXT4_DIRENT_CACHE_MAX_ENTRIES  64U
+
+/**
+   This structure represents one cached directory lookup, keyed by the inode
+   number of the directory that was searched and the name that was searched
+   for. Negative results are cached too, so repeated probes for files that do
+   not exist are also served from memory. The list is kept in most-recently-used
+   order and doubles as the LRU eviction order.
+ */
+typedef struct {
+  LIST_ENTRY        Node;
+  EXT4_INO_NR       ParentInode;
+  BOOLEAN           Found;
+  EXT4_DIR_ENTRY    Entry;
+  CHAR16            Name[EXT4_NAME_MAX + 1];
+} EXT4_DIRENT_CACHE_ENTRY;
+
+/**
+   Looks up a directory lookup result in the partition's dentry cache.
+
+   On a hit the entry becomes the most recently used one. The returned entry
+   stays valid until the next insertion into the cache, which may evict it.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+   @param[in]      ParentInode   Inode number of the searched directory.
+   @param[in]      Name          Pointer to the UCS-2 formatted filename.
+
+   @return Pointer to the cached lookup, or NULL if it is not cached.
+**/
+STATIC
+EXT4_DIRENT_CACHE_ENTRY *
+Ext4GetCachedDirent (
+  IN EXT4_PARTITION  *Partition,
+  IN EXT4_INO_NR     ParentInode,
+  IN CONST CHAR16    *Name
+  )
+{
+  LIST_ENTRY               *Entry;
+  EXT4_DIRENT_CACHE_ENTRY  *Cached;
+
+  BASE_LIST_FOR_EACH (Entry, &Partition->DirentCache) {
+    Cached = BASE_CR (Entry, EXT4_DIRENT_CACHE_ENTRY, Node);
+
+    if (Cached->ParentInode != ParentInode) {
+      continue;
+    }
+
+    // Lookups match names case-insensitively (see Ext4ScanDirentBlock), so
+    // the cache has to do the same or differently-cased probes of the same
+    // name would bypass it.
+    if (Ext4StrCmpInsensitive ((CHAR16 *)Name, Cached->Name) != 0) {
+      continue;
+    }
+
+    RemoveEntryList (&Cached->Node);
+    InsertHeadList (&Partition->DirentCache, &Cached->Node);
+
+    return Cached;
+  }
+
+  return NULL;
+}
+
+/**
+   Caches the result of a directory lookup, evicting the least recently used
+   one if the cache is full.
+
+   Failure to cache the lookup is not an error; the next one simply takes the
+   slow path again.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+   @param[in]      ParentInode   Inode number of the searched directory.
+   @param[in]      Name          Pointer to the UCS-2 formatted filename.
+   @param[in]      Entry         Pointer to the directory entry that was
+                                 found, or NULL to record that the name does
+                                 not exist in the directory.
+**/
+STATIC
+VOID
+Ext4CacheDirent (
+  IN EXT4_PARTITION        *Partition,
+  IN EXT4_INO_NR           ParentInode,
+  IN CONST CHAR16          *Name,
+  IN CONST EXT4_DIR_ENTRY  *Entry  OPTIONAL
+  )
+{
+  EXT4_DIRENT_CACHE_ENTRY  *Cached;
+
+  if (Partition->DirentCacheSize >= EXT4_DIRENT_CACHE_MAX_ENTRIES) {
+    Cached = BASE_CR (GetPreviousNode (&Partition->DirentCache, &Partition->DirentCache),
+               EXT4_DIRENT_CACHE_ENTRY, Node);
+    RemoveEntryList (&Cached->Node);
+    FreePool (Cached);
+    Partition->DirentCacheSize--;
+  }
+
+  Cached = AllocateZeroPool (sizeof (EXT4_DIRENT_CACHE_ENTRY));
+
+  if (Cached == NULL) {
+    return;
+  }
+
+  if (StrCpyS (Cached->Name, EXT4_NAME_MAX + 1, Name) != RETURN_SUCCESS) {
+    FreePool (Cached);
+    return;
+  }
+
+  Cached->ParentInode = ParentInode;
+  Cached->Found       = Entry != NULL;
+
+  if (Entry != NULL) {
+    CopyMem (&Cached->Entry, Entry, sizeof (EXT4_DIR_ENTRY));
+  }
+
+  InsertHeadList (&Partition->DirentCache, &Cached->Node);
+  Partition->DirentCacheSize++;
+}
+
+/**
+   Frees the partition's cache of directory lookups.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+**/
+VOID
+Ext4FreeDirentCache (
+  IN EXT4_PARTITION  *Partition
+  )
+{
+  EXT4_DIRENT_CACHE_ENTRY  *Cached;
+
+  while (!IsListEmpty (&Partition->DirentCache)) {
+    Cached = BASE_CR (GetFirstNode (&Partition->DirentCache), EXT4_DIRENT_CACHE_ENTRY, Node);
+    RemoveEntryList (&Cached->Node);
+    FreePool (Cached);
+  }
+
+  Partition->DirentCacheSize = 0;
+}
+
+/**
+   Retrieves a directory entry.
+
+   @param[in]      Directory   Pointer to the opened directory.
+   @param[in]      NameUnicode Pointer to the UCS-2 formatted filename.
+   @param[in]      Partition   Pointer to the ext4 partition.
+   @param[out]     Result      Pointer to the destination directory entry.
+
+   @return The result of the operation.
+**/
+EFI_STATUS
+Ext4RetrieveDirent (
+  IN EXT4_FILE        *Directory,
+  IN CONST CHAR16     *Name,
+  IN EXT4_PARTITION   *Partition,
+  OUT EXT4_DIR_ENTRY  *Result
+  )
+{
+  EFI_STATUS               Status;
+  CHAR8                    *Buf;
+  UINT64                   Off;
+  EXT4_INODE               *Inode;
+  UINT64                   DirInoSize;
+  UINT32                   BlockRemainder;
+  UINTN                    Length;
+  EXT4_DIRENT_CACHE_ENTRY  *Cached;
+
+  Inode      = Directory->Inode;
   DirInoSize = EXT4_INODE_SIZE (Inode);
 
   DivU64x32Remainder (DirInoSize, Partition->BlockSize, &BlockRemainder);
@@ -130,83 +691,68 @@ Ext4RetrieveDirent (
     return EFI_VOLUME_CORRUPTED;
   }
 
-  while (Off < DirInoSize) {
-    Length = Partition->BlockSize;
+  Cached = Ext4GetCachedDirent (Partition, Directory->InodeNum, Name);
 
-    Status = Ext4Read (Partition, Directory, Buf, Off, &Length);
+  if (Cached != NULL) {
+    if (!Cached->Found) {
+      return EFI_NOT_FOUND;
+    }
 
-    if (Status != EFI_SUCCESS) {
-      FreePool (Buf);
+    CopyMem (Result, &Cached->Entry, sizeof (EXT4_DIR_ENTRY));
+    return EFI_SUCCESS;
+  }
+
+  if (((Inode->i_flags & EXT4_INDEX_FL) != 0) &&
+      ((Partition->FeaturesCompat & EXT4_FEATURE_COMPAT_DIR_INDEX) != 0)) {
+    Status = Ext4DxRetrieveDirent (Directory, Name, Partition, Result);
+
+    if (Status == EFI_SUCCESS) {
+      Ext4CacheDirent (Partition, Directory->InodeNum, Name, Result);
       return Status;
     }
 
-    for (BlockOffset = 0; BlockOffset < Partition->BlockSize; ) {
-      Entry = (EXT4_DIR_ENTRY *)(Buf + BlockOffset);
-      RemainingBlock = Partition->BlockSize - BlockOffset;
-      // Check if the minimum directory entry fits inside [BlockOffset, EndOfBlock]
-      if (RemainingBlock < EXT4_MIN_DIR_ENTRY_LEN) {
-        FreePool (Buf);
-        return EFI_VOLUME_CORRUPTED;
-      }
+    // Fall through to the linear scan on any miss: it serves unsupported
+    // hash versions, hash collisions that continue into the next leaf,
+    // names that only match case-insensitively, and it turns a corrupted
+    // index into a best-effort search. "." and ".." also only exist in
+    // the unindexed first block.
+  }
 
-      if (!Ext4ValidDirent (Entry)) {
-        FreePool (Buf);
-        return EFI_VOLUME_CORRUPTED;
-      }
+  Buf = Ext4AllocateBlockScratch (Partition);
 
-      if (Entry->name_len > RemainingBlock || Entry->rec_len > RemainingBlock) {
-        // Corrupted filesystem
-        FreePool (Buf);
-        return EFI_VOLUME_CORRUPTED;
-      }
+  if (Buf == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
 
-      // Ignore names bigger than our limit.
+  Off = 0;
 
-      /* Note: I think having a limit is sane because:
-        1) It's nicer to work with.
-        2) Linux and a number of BSDs also have a filename limit of 255.
-      */
-      if (Entry->name_len > EXT4_NAME_MAX) {
-        BlockOffset += Entry->rec_len;
-        continue;
-      }
+  while (Off < DirInoSize) {
+    Length = Partition->BlockSize;
 
-      // Unused entry
-      if (Entry->inode == 0) {
-        BlockOffset += Entry->rec_len;
-        continue;
-      }
+    Status = Ext4Read (Partition, Directory, Buf, Off, &Length);
 
-      Status = Ext4GetUcs2DirentName (Entry, DirentUcs2Name);
-
-      /* In theory, this should never fail.
-       * In reality, it's quite possible that it can fail, considering filenames in
-       * Linux (and probably other nixes) are just null-terminated bags of bytes, and don't
-       * need to form valid ASCII/UTF-8 sequences.
-       */
-      if (EFI_ERROR (Status)) {
-        // If we error out, skip this entry
-        // I'm not sure if this is correct behaviour, but I don't think there's a precedent here.
-        BlockOffset += Entry->rec_len;
-        continue;
-      }
+    if (Status != EFI_SUCCESS) {
+      Ext4FreeBlockScratch (Partition, Buf);
+      return Status;
+    }
 
-      if (Entry->name_len == StrLen (Name) &&
-          !Ext4StrCmpInsensitive (DirentUcs2Name, (CHAR16 *)Name)) {
-        ToCopy = MIN (Entry->rec_len, sizeof (EXT4_DIR_ENTRY));
+    Status = Ext4ScanDirentBlock (Partition, Buf, Name, Result);
 
-        CopyMem (Result, Entry, ToCopy);
-        FreePool (Buf);
-        return EFI_SUCCESS;
+    if (Status != EFI_NOT_FOUND) {
+      if (Status == EFI_SUCCESS) {
+        Ext4CacheDirent (Partition, Directory->InodeNum, Name, Result);
       }
 
-      BlockOffset += Entry->rec_len;
+      Ext4FreeBlockScratch (Partition, Buf);
+      return Status;
     }
 
     Off += Partition->BlockSize;
   }
 
-  FreePool (Buf);
+  Ext4CacheDirent (Partition, Directory->InodeNum, Name, NULL);
+
+  Ext4FreeBlockScratch (Partition, Buf);
   return EFI_NOT_FOUND;
 }
 
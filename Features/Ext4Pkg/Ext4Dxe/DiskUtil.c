@@ -33,6 +33,205 @@ Ext4ReadDiskIo (
                                      );
 }
 
+/**
+   Initializes a batch of disk reads.
+
+   @param[out] Batch          Pointer to the batch to initialize.
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+**/
+VOID
+Ext4ReadBatchInit (
+  OUT EXT4_READ_BATCH  *Batch,
+  IN EXT4_PARTITION    *Partition
+  )
+{
+  Batch->Partition = Partition;
+  Batch->Count     = 0;
+}
+
+/**
+   Adds one read to a batch of disk reads.
+
+   The buffer belongs to the disk until Ext4ReadBatchWait() returns, even if
+   this or a later call fails. Without DISK_IO2 support the read is performed
+   synchronously instead.
+
+   @param[in]  Batch          Pointer to the initialized batch.
+   @param[out] Buffer         Pointer to a destination buffer.
+   @param[in]  Length         Length of the destination buffer.
+   @param[in]  Offset         Offset, in bytes, of the location to read.
+
+   @return Success status of the submission (or, without DISK_IO2 support,
+           of the read itself).
+**/
+EFI_STATUS
+Ext4ReadBatchAdd (
+  IN EXT4_READ_BATCH  *Batch,
+  OUT VOID            *Buffer,
+  IN UINTN            Length,
+  IN UINT64           Offset
+  )
+{
+  EXT4_PARTITION      *Partition;
+  EFI_DISK_IO2_TOKEN  *Token;
+  EFI_STATUS          Status;
+
+  Partition = Batch->Partition;
+
+  if (EXT4_DISK_IO2 (Partition) == NULL) {
+    return Ext4ReadDiskIo (Partition, Buffer, Length, Offset);
+  }
+
+  if (Batch->Count == EXT4_READ_BATCH_MAX_REQUESTS) {
+    Status = Ext4ReadBatchWait (Batch);
+
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  Token = &Batch->Token[Batch->Count];
+
+  Status = gBS->CreateEvent (0, 0, NULL, NULL, &Token->Event);
+
+  if (EFI_ERROR (Status)) {
+    return Ext4ReadDiskIo (Partition, Buffer, Length, Offset);
+  }
+
+  Status = EXT4_DISK_IO2 (Partition)->ReadDiskEx (
+                                        EXT4_DISK_IO2 (Partition),
+                                        EXT4_MEDIA_ID (Partition),
+                                        Offset,
+                                        Token,
+                                        Length,
+                                        Buffer
+                                        );
+
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (Token->Event);
+    return Ext4ReadDiskIo (Partition, Buffer, Length, Offset);
+  }
+
+  Batch->Count++;
+  return EFI_SUCCESS;
+}
+
+/**
+   Waits for every read in the batch to complete.
+
+   The batch is left empty and may be reused for further reads.
+
+   @param[in]  Batch          Pointer to the initialized batch.
+
+   @return EFI_SUCCESS if every read completed successfully, else the status
+           of the first failed read.
+**/
+EFI_STATUS
+Ext4ReadBatchWait (
+  IN EXT4_READ_BATCH  *Batch
+  )
+{
+  EFI_STATUS          Status;
+  EFI_DISK_IO2_TOKEN  *Token;
+  UINTN               Index;
+
+  Status = EFI_SUCCESS;
+
+  for (Index = 0; Index < Batch->Count; Index++) {
+    Token = &Batch->Token[Index];
+
+    while (gBS->CheckEvent (Token->Event) == EFI_NOT_READY) {
+    }
+
+    gBS->CloseEvent (Token->Event);
+
+    if (EFI_ERROR (Token->TransactionStatus) && !EFI_ERROR (Status)) {
+      Status = Token->TransactionStatus;
+    }
+  }
+
+  Batch->Count = 0;
+  return Status;
+}
+
+
+// Upper bound on buffers kept around by a partition's scratch pool.
+#define EXT4_BLOCK_SCRATCH_MAX_BUFFERS  8U
+
+/**
+   Allocates a scratch buffer of one filesystem block, reusing a buffer from
+   the partition's scratch pool when one is available.
+
+   Scratch buffers back short-lived metadata reads (directory blocks, extent
+   tree nodes) that would otherwise go through the pool allocator on every
+   operation. They must be returned with Ext4FreeBlockScratch().
+
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+
+   @return Pointer to a buffer of Partition->BlockSize bytes, or NULL.
+**/
+VOID *
+Ext4AllocateBlockScratch (
+  IN EXT4_PARTITION  *Partition
+  )
+{
+  LIST_ENTRY  *Entry;
+
+  if (!IsListEmpty (&Partition->BlockScratchList)) {
+    Entry = GetFirstNode (&Partition->BlockScratchList);
+    RemoveEntryList (Entry);
+    Partition->BlockScratchCount--;
+
+    return Entry;
+  }
+
+  return AllocatePool (Partition->BlockSize);
+}
+
+/**
+   Returns a scratch buffer to the partition's scratch pool, or frees it if
+   the pool is full.
+
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+   @param[in]  Buffer         Buffer obtained from Ext4AllocateBlockScratch().
+**/
+VOID
+Ext4FreeBlockScratch (
+  IN EXT4_PARTITION  *Partition,
+  IN VOID            *Buffer
+  )
+{
+  if (Partition->BlockScratchCount >= EXT4_BLOCK_SCRATCH_MAX_BUFFERS) {
+    FreePool (Buffer);
+    return;
+  }
+
+  // A free buffer doubles as its own list node; the smallest ext4 block
+  // (1KB) comfortably fits a LIST_ENTRY.
+  InsertHeadList (&Partition->BlockScratchList, (LIST_ENTRY *)Buffer);
+  Partition->BlockScratchCount++;
+}
+
+/**
+   Frees every buffer held by the partition's scratch pool.
+
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+**/
+VOID
+Ext4FreeBlockScratchPool (
+  IN EXT4_PARTITION  *Partition
+  )
+{
+  LIST_ENTRY  *Entry;
+
+  while (!IsListEmpty (&Partition->BlockScratchList)) {
+    Entry = GetFirstNode (&Partition->BlockScratchList);
+    RemoveEntryList (Entry);
+    FreePool (Entry);
+  }
+
+  Partition->BlockScratchCount = 0;
+}
 /**
    Reads blocks from the partition's disk using the DISK_IO protocol.
 
@@ -402,6 +402,53 @@ typedef struct {
 
 #define EXT4_MIN_DIR_ENTRY_LEN  8
 
+// Hash algorithms used by htree indexed directories (EXT4_DX_ROOT_INFO.hash_version).
+#define EXT4_DX_HASH_LEGACY    0
+#define EXT4_DX_HASH_HALF_MD4  1
+#define EXT4_DX_HASH_TEA       2
+
+// Signedness of the directory name hash, from the superblock's s_flags.
+#define EXT4_FLAGS_SIGNED_HASH    0x0001
+#define EXT4_FLAGS_UNSIGNED_HASH  0x0002
+
+//
+// On-disk layout of the htree index in the first directory block, placed
+// right after the "." and ".." entries (the rec_len of ".." covers the
+// whole remainder of the block, which hides the index from linear scans).
+//
+typedef struct {
+  UINT32    reserved_zero;
+  UINT8     hash_version;
+  UINT8     info_length;
+  UINT8     indirect_levels;
+  UINT8     unused_flags;
+} EXT4_DX_ROOT_INFO;
+
+//
+// One entry of an index node. The entries array of a node overlays an
+// EXT4_DX_COUNTLIMIT on the hash field of its first entry; the block
+// pointer of that first entry covers every hash below the second one.
+//
+typedef struct {
+  UINT32    hash;
+  UINT32    block;
+} EXT4_DX_ENTRY;
+
+typedef struct {
+  UINT16    limit;
+  UINT16    count;
+} EXT4_DX_COUNTLIMIT;
+
+// Offset of EXT4_DX_ROOT_INFO in the first block of an indexed directory
+#define EXT4_DX_ROOT_INFO_OFFSET  24
+
+// Offset of the entries in an interior index block, after one fake dirent
+// whose rec_len covers the whole block
+#define EXT4_DX_NODE_ENTRIES_OFFSET  8
+
+// Logical blocks stored in an EXT4_DX_ENTRY carry flags in the top byte
+#define EXT4_DX_BLOCK_MASK  0x00FFFFFF
+
 // This on-disk structure is present at the bottom of the extent tree
 typedef struct {
   // First logical block
@@ -530,6 +530,8 @@ Ext4EntryPoint (
     return Status;
   }
 
+  Ext4InitialiseCrc32c ();
+
   return Ext4InitialiseUnicodeCollation (ImageHandle);
 }
 
@@ -84,8 +84,94 @@ typedef struct _Ext4_PARTITION {
   LIST_ENTRY                         OpenFiles;
 
   EXT4_DENTRY                        *RootDentry;
+
+  // LRU cache of extent tree nodes, shared by every open file.
+  LIST_ENTRY                         ExtentNodeCache;
+  UINTN                              ExtentNodeCacheSize;
+
+  // LRU cache of directory lookups, including negative results.
+  LIST_ENTRY                         DirentCache;
+  UINTN                              DirentCacheSize;
+
+  // LRU cache of inode table blocks, see Ext4ReadInode.
+  LIST_ENTRY                         InodeBlockCache;
+  UINTN                              InodeBlockCacheSize;
+
+  // Free list of block-sized scratch buffers, see Ext4AllocateBlockScratch.
+  LIST_ENTRY                         BlockScratchList;
+  UINTN                              BlockScratchCount;
 } EXT4_PARTITION;
 
+/**
+   Frees the partition's cache of extent tree nodes.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+**/
+VOID
+Ext4FreeExtentNodeCache (
+  IN EXT4_PARTITION  *Partition
+  );
+
+/**
+   Frees the partition's cache of directory lookups.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+**/
+VOID
+Ext4FreeDirentCache (
+  IN EXT4_PARTITION  *Partition
+  );
+
+/**
+   Frees the partition's cache of inode table blocks.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+**/
+VOID
+Ext4FreeInodeBlockCache (
+  IN EXT4_PARTITION  *Partition
+  );
+
+/**
+   Allocates a scratch buffer of one filesystem block, reusing a buffer from
+   the partition's scratch pool when one is available.
+
+   Scratch buffers back short-lived metadata reads (directory blocks, extent
+   tree nodes) that would otherwise go through the pool allocator on every
+   operation. They must be returned with Ext4FreeBlockScratch().
+
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+
+   @return Pointer to a buffer of Partition->BlockSize bytes, or NULL.
+**/
+VOID *
+Ext4AllocateBlockScratch (
+  IN EXT4_PARTITION  *Partition
+  );
+
+/**
+   Returns a scratch buffer to the partition's scratch pool, or frees it if
+   the pool is full.
+
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+   @param[in]  Buffer         Buffer obtained from Ext4AllocateBlockScratch().
+**/
+VOID
+Ext4FreeBlockScratch (
+  IN EXT4_PARTITION  *Partition,
+  IN VOID            *Buffer
+  );
+
+/**
+   Frees every buffer held by the partition's scratch pool.
+
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+**/
+VOID
+Ext4FreeBlockScratchPool (
+  IN EXT4_PARTITION  *Partition
+  );
+
 /**
    This structure represents a directory entry inside our directory entry tree.
    For now, it will be used as a way to track file names inside our opening code,
@@ -207,6 +293,71 @@ Ext4ReadDiskIo (
   IN UINT64          Offset
   );
 
+// Upper bound on reads a single batch keeps in flight at once.
+#define EXT4_READ_BATCH_MAX_REQUESTS  8
+
+/**
+   This structure represents a batch of disk reads. Reads added to the batch
+   are submitted asynchronously through the DISK_IO2 protocol, when present,
+   so several non-contiguous reads can be in flight at once; the caller waits
+   for all of them with a single call once everything has been submitted.
+ */
+typedef struct {
+  EXT4_PARTITION        *Partition;
+  UINTN                 Count;
+  EFI_DISK_IO2_TOKEN    Token[EXT4_READ_BATCH_MAX_REQUESTS];
+} EXT4_READ_BATCH;
+
+/**
+   Initializes a batch of disk reads.
+
+   @param[out] Batch          Pointer to the batch to initialize.
+   @param[in]  Partition      Pointer to the opened ext4 partition.
+**/
+VOID
+Ext4ReadBatchInit (
+  OUT EXT4_READ_BATCH  *Batch,
+  IN EXT4_PARTITION    *Partition
+  );
+
+/**
+   Adds one read to a batch of disk reads.
+
+   The buffer belongs to the disk until Ext4ReadBatchWait() returns, even if
+   this or a later call fails. Without DISK_IO2 support the read is performed
+   synchronously instead.
+
+   @param[in]  Batch          Pointer to the initialized batch.
+   @param[out] Buffer         Pointer to a destination buffer.
+   @param[in]  Length         Length of the destination buffer.
+   @param[in]  Offset         Offset, in bytes, of the location to read.
+
+   @return Success status of the submission (or, without DISK_IO2 support,
+           of the read itself).
+**/
+EFI_STATUS
+Ext4ReadBatchAdd (
+  IN EXT4_READ_BATCH  *Batch,
+  OUT VOID            *Buffer,
+  IN UINTN            Length,
+  IN UINT64           Offset
+  );
+
+/**
+   Waits for every read in the batch to complete.
+
+   The batch is left empty and may be reused for further reads.
+
+   @param[in]  Batch          Pointer to the initialized batch.
+
+   @return EFI_SUCCESS if every read completed successfully, else the status
+           of the first failed read.
+**/
+EFI_STATUS
+Ext4ReadBatchWait (
+  IN EXT4_READ_BATCH  *Batch
+  );
+
 /**
    Reads blocks from the partition's disk using the DISK_IO protocol.
 
@@ -351,6 +502,26 @@ Ext4GetExtent (
   OUT EXT4_EXTENT     *Extent
   );
 
+// Upper bound on the size of one asynchronous read-ahead window.
+#define EXT4_READ_AHEAD_MAX_BYTES  SIZE_1MB
+
+/**
+   This structure represents one asynchronous read-ahead of file data, issued
+   through EFI_DISK_IO2_PROTOCOL.ReadDiskEx while the caller consumes the
+   previous window. The data follows the structure and is Length bytes long.
+ */
+typedef struct {
+  EFI_DISK_IO2_TOKEN    Token;
+  // Set once the token has been waited for; the token's event resets when
+  // its signal is consumed, so it must only be waited for once.
+  BOOLEAN               Done;
+  // File byte offset the data maps.
+  UINT64                FileOffset;
+  UINTN                 Length;
+} EXT4_READ_AHEAD;
+
+#define EXT4_READ_AHEAD_DATA(ReadAhead)  ((CHAR8 *)((ReadAhead) + 1))
+
 struct _Ext4File {
   EFI_FILE_PROTOCOL     Protocol;
   EXT4_INODE            *Inode;
@@ -359,6 +530,12 @@ struct _Ext4File {
   UINT64                OpenMode;
   UINT64                Position;
 
+  // Read-ahead state, see Ext4ReadFile. LastReadEnd is the file offset right
+  // past the last read, used to detect sequential access; ReadAhead is
+  // non-NULL while a read-ahead is in flight or waiting to be consumed.
+  UINT64                LastReadEnd;
+  EXT4_READ_AHEAD       *ReadAhead;
+
   EXT4_PARTITION        *Partition;
 
   ORDERED_COLLECTION    *ExtentsMap;
@@ -929,6 +1106,16 @@ Ext4FreeExtentsMap (
   IN EXT4_FILE  *File
   );
 
+/**
+   Derives the slicing tables for CalculateCrc32c() from the bytewise
+   lookup table. Called once, at driver start; until it runs, checksums
+   are computed with the (slower) bytewise fallback.
+**/
+VOID
+Ext4InitialiseCrc32c (
+  VOID
+  );
+
 /**
    Calculates the CRC32c checksum of the given buffer.
 
@@ -212,6 +212,124 @@ Ext4ExtentIdxLeafBlock (
   return LShiftU64 (Index->ei_leaf_hi, 32) | Index->ei_leaf_lo;
 }
 
+// Upper bound on cached extent tree nodes per partition. With 4KB blocks the
+// cache tops out at 128KB, enough to hold the whole tree of a multi-GB file.
+#define EXT4_EXTENT_NODE_CACHE_MAX_NODES  32U
+
+/**
+   This structure represents one cached node of an inode's extent tree, either
+   an interior index node or a leaf. Nodes are keyed by their physical block
+   number, which is unique on the partition, so a single per-partition list
+   can serve every open file. The list is kept in most-recently-used order
+   and doubles as the LRU eviction order. The node's data follows the
+   structure and is Partition->BlockSize bytes long.
+ */
+typedef struct {
+  LIST_ENTRY       Node;
+  EXT4_BLOCK_NR    BlockNr;
+} EXT4_EXTENT_NODE;
+
+#define EXT4_EXTENT_NODE_HEADER(CacheNode)  ((EXT4_EXTENT_HEADER *)((CacheNode) + 1))
+
+/**
+   Looks up an extent tree node in the partition's node cache.
+
+   On a hit the node becomes the most recently used one. The returned header
+   stays valid until the next insertion into the cache, which may evict it.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+   @param[in]      BlockNr       Physical block number of the node.
+
+   @return Pointer to the cached node, or NULL if it is not cached.
+**/
+STATIC
+EXT4_EXTENT_HEADER *
+Ext4GetCachedExtentNode (
+  IN EXT4_PARTITION  *Partition,
+  IN EXT4_BLOCK_NR   BlockNr
+  )
+{
+  LIST_ENTRY        *Entry;
+  EXT4_EXTENT_NODE  *CacheNode;
+
+  BASE_LIST_FOR_EACH (Entry, &Partition->ExtentNodeCache) {
+    CacheNode = BASE_CR (Entry, EXT4_EXTENT_NODE, Node);
+
+    if (CacheNode->BlockNr == BlockNr) {
+      RemoveEntryList (&CacheNode->Node);
+      InsertHeadList (&Partition->ExtentNodeCache, &CacheNode->Node);
+
+      return EXT4_EXTENT_NODE_HEADER (CacheNode);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+   Caches a single extent tree node, evicting the least recently used one
+   if the cache is full. The node must already have been validated, since
+   cache hits skip the header and checksum checks.
+
+   Failure to cache the node is not an error; the next lookup simply takes
+   the slow path again.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+   @param[in]      BlockNr       Physical block number of the node.
+   @param[in]      Header        Pointer to the node's data.
+**/
+STATIC
+VOID
+Ext4CacheExtentNode (
+  IN EXT4_PARTITION            *Partition,
+  IN EXT4_BLOCK_NR             BlockNr,
+  IN CONST EXT4_EXTENT_HEADER  *Header
+  )
+{
+  EXT4_EXTENT_NODE  *CacheNode;
+
+  if (Partition->ExtentNodeCacheSize >= EXT4_EXTENT_NODE_CACHE_MAX_NODES) {
+    CacheNode = BASE_CR (GetPreviousNode (&Partition->ExtentNodeCache, &Partition->ExtentNodeCache),
+                  EXT4_EXTENT_NODE, Node);
+    RemoveEntryList (&CacheNode->Node);
+    FreePool (CacheNode);
+    Partition->ExtentNodeCacheSize--;
+  }
+
+  CacheNode = AllocatePool (sizeof (EXT4_EXTENT_NODE) + Partition->BlockSize);
+
+  if (CacheNode == NULL) {
+    return;
+  }
+
+  CacheNode->BlockNr = BlockNr;
+  CopyMem (EXT4_EXTENT_NODE_HEADER (CacheNode), Header, Partition->BlockSize);
+
+  InsertHeadList (&Partition->ExtentNodeCache, &CacheNode->Node);
+  Partition->ExtentNodeCacheSize++;
+}
+
+/**
+   Frees the partition's cache of extent tree nodes.
+
+   @param[in]      Partition     Pointer to the opened EXT4 partition.
+**/
+VOID
+Ext4FreeExtentNodeCache (
+  IN EXT4_PARTITION  *Partition
+  )
+{
+  EXT4_EXTENT_NODE  *CacheNode;
+
+  while (!IsListEmpty (&Partition->ExtentNodeCache)) {
+    CacheNode = BASE_CR (GetFirstNode (&Partition->ExtentNodeCache), EXT4_EXTENT_NODE, Node);
+    RemoveEntryList (&CacheNode->Node);
+    FreePool (CacheNode);
+  }
+
+  Partition->ExtentNodeCacheSize = 0;
+}
+
 /**
    Retrieves an extent from an EXT4 inode.
    @param[in]      Partition     Pointer to the opened EXT4 partition.
@@ -235,7 +353,9 @@ Ext4GetExtent (
   EXT4_EXTENT         *Ext;
   UINT32              CurrentDepth;
   EXT4_EXTENT_HEADER  *ExtHeader;
+  EXT4_EXTENT_HEADER  *CachedNode;
   EXT4_EXTENT_INDEX   *Index;
+  EXT4_BLOCK_NR       NodeBlock;
   EFI_STATUS          Status;
 
   Inode  = File->Inode;
@@ -281,8 +401,26 @@ Ext4GetExtent (
 
     Index = Ext4BinsearchExtentIndex (ExtHeader, LogicalBlock);
 
+    NodeBlock = Ext4ExtentIdxLeafBlock (Index);
+
+    // A cached node has already passed the header and checksum validation,
+    // so a hit replaces the block read and both checks below.
+    CachedNode = Ext4GetCachedExtentNode (Partition, NodeBlock);
+    if (CachedNode != NULL) {
+      if (CachedNode->eh_depth != CurrentDepth) {
+        if (Buffer != NULL) {
+          Ext4FreeBlockScratch (Partition, Buffer);
+        }
+
+        return EFI_VOLUME_CORRUPTED;
+      }
+
+      ExtHeader = CachedNode;
+      continue;
+    }
+
     if (Buffer == NULL) {
-      Buffer = AllocatePool (Partition->BlockSize);
+      Buffer = Ext4AllocateBlockScratch (Partition);
       if (Buffer == NULL) {
         return EFI_OUT_OF_RESOURCES;
       }
@@ -290,29 +428,32 @@ Ext4GetExtent (
 
     // Read the leaf block onto the previously-allocated buffer.
 
-    Status = Ext4ReadBlocks (Partition, Buffer, 1, Ext4ExtentIdxLeafBlock (Index));
+    Status = Ext4ReadBlocks (Partition, Buffer, 1, NodeBlock);
     if (EFI_ERROR (Status)) {
-      FreePool (Buffer);
+      Ext4FreeBlockScratch (Partition, Buffer);
       return Status;
     }
 
     ExtHeader = Buffer;
 
     if (!Ext4ExtentHeaderValid (ExtHeader)) {
-      FreePool (Buffer);
+      Ext4FreeBlockScratch (Partition, Buffer);
       return EFI_VOLUME_CORRUPTED;
     }
 
     if (!Ext4CheckExtentChecksum (ExtHeader, File)) {
       DEBUG ((DEBUG_ERROR, "[ext4] Invalid extent checksum\n"));
-      FreePool (Buffer);
+      Ext4FreeBlockScratch (Partition, Buffer);
       return EFI_VOLUME_CORRUPTED;
     }
 
     if (ExtHeader->eh_depth != CurrentDepth) {
-      FreePool (Buffer);
+      Ext4FreeBlockScratch (Partition, Buffer);
       return EFI_VOLUME_CORRUPTED;
     }
+
+    // Memoize the node so later traversals through it skip the disk read.
+    Ext4CacheExtentNode (Partition, NodeBlock, ExtHeader);
   }
 
   /* We try to cache every extent under a single leaf, since it's quite likely that we
@@ -326,7 +467,7 @@ Ext4GetExtent (
 
   if (!Ext) {
     if (Buffer != NULL) {
-      FreePool (Buffer);
+      Ext4FreeBlockScratch (Partition, Buffer);
     }
 
     return EFI_NO_MAPPING;
@@ -335,7 +476,7 @@ Ext4GetExtent (
   if (!(LogicalBlock >= Ext->ee_block && Ext->ee_block + Ext4GetExtentLength (Ext) > LogicalBlock)) {
     // This extent does not cover the block
     if (Buffer != NULL) {
-      FreePool (Buffer);
+      Ext4FreeBlockScratch (Partition, Buffer);
     }
 
     return EFI_NO_MAPPING;
@@ -344,7 +485,7 @@ Ext4GetExtent (
   *Extent = *Ext;
 
   if (Buffer != NULL) {
-    FreePool (Buffer);
+    Ext4FreeBlockScratch (Partition, Buffer);
   }
 
   return EFI_SUCCESS;
@@ -133,6 +133,222 @@ Ext4DirCanLookup (
   return (File->Inode->i_mode & EXT4_INO_PERM_EXEC_OWNER) == EXT4_INO_PERM_EXEC_OWNER;
 }
 
+/**
+   Waits for the file's in-flight read-ahead to complete.
+
+   @param[in]        File        Pointer to the opened file.
+
+   @return The transaction status of the read-ahead.
+**/
+STATIC
+EFI_STATUS
+Ext4WaitReadAhead (
+  IN EXT4_FILE  *File
+  )
+{
+  EXT4_READ_AHEAD  *ReadAhead;
+
+  ReadAhead = File->ReadAhead;
+
+  if (!ReadAhead->Done) {
+    while (gBS->CheckEvent (ReadAhead->Token.Event) == EFI_NOT_READY) {
+    }
+
+    ReadAhead->Done = TRUE;
+  }
+
+  return ReadAhead->Token.TransactionStatus;
+}
+
+/**
+   Releases the file's read-ahead, waiting for it first if it is still in
+   flight: the buffer belongs to the disk until the token signals, even when
+   the data is not going to be used.
+
+   @param[in]        File        Pointer to the opened file.
+**/
+STATIC
+VOID
+Ext4DropReadAhead (
+  IN EXT4_FILE  *File
+  )
+{
+  if (File->ReadAhead == NULL) {
+    return;
+  }
+
+  Ext4WaitReadAhead (File);
+
+  gBS->CloseEvent (File->ReadAhead->Token.Event);
+  FreePool (File->ReadAhead);
+  File->ReadAhead = NULL;
+}
+
+/**
+   Starts an asynchronous read-ahead of file data at the given offset, through
+   the DISK_IO2 protocol.
+
+   Only the physically contiguous run of extents starting at the offset is
+   fetched, so the read maps to a single disk request. Not being able to start
+   the read-ahead is never an error; the data is then simply read on demand.
+
+   @param[in]        Partition   Pointer to the opened partition.
+   @param[in]        File        Pointer to the opened file.
+   @param[in]        Offset      Offset to read ahead from.
+**/
+STATIC
+VOID
+Ext4StartReadAhead (
+  IN EXT4_PARTITION  *Partition,
+  IN EXT4_FILE       *File,
+  IN UINT64          Offset
+  )
+{
+  EFI_STATUS       Status;
+  UINT64           InodeSize;
+  EXT4_EXTENT      Extent;
+  UINT32           BlockOff;
+  UINT64           ExtentOffset;
+  UINT64           Length;
+  EXT4_READ_AHEAD  *ReadAhead;
+
+  ASSERT (File->ReadAhead == NULL);
+
+  if (EXT4_DISK_IO2 (Partition) == NULL) {
+    return;
+  }
+
+  InodeSize = EXT4_INODE_SIZE (File->Inode);
+
+  if (Offset >= InodeSize) {
+    return;
+  }
+
+  Status = Ext4GetExtent (
+             Partition,
+             File,
+             DivU64x32Remainder (Offset, Partition->BlockSize, &BlockOff),
+             &Extent
+             );
+
+  // Prefetching holes buys nothing, and errors are better reported by the
+  // read that actually needs the data.
+  if ((Status != EFI_SUCCESS) || EXT4_EXTENT_IS_UNINITIALIZED (&Extent)) {
+    return;
+  }
+
+  ExtentOffset = Offset - MultU64x32 (Extent.ee_block, Partition->BlockSize);
+  Length       = MultU64x32 (Extent.ee_len, Partition->BlockSize) - ExtentOffset;
+  Length       = MIN (Length, InodeSize - Offset);
+  Length       = MIN (Length, EXT4_READ_AHEAD_MAX_BYTES);
+
+  ReadAhead = AllocatePool (sizeof (EXT4_READ_AHEAD) + (UINTN)Length);
+
+  if (ReadAhead == NULL) {
+    return;
+  }
+
+  ReadAhead->Done       = FALSE;
+  ReadAhead->FileOffset = Offset;
+  ReadAhead->Length     = (UINTN)Length;
+
+  Status = gBS->CreateEvent (0, 0, NULL, NULL, &ReadAhead->Token.Event);
+
+  if (EFI_ERROR (Status)) {
+    FreePool (ReadAhead);
+    return;
+  }
+
+  Status = EXT4_DISK_IO2 (Partition)->ReadDiskEx (
+                                        EXT4_DISK_IO2 (Partition),
+                                        EXT4_MEDIA_ID (Partition),
+                                        MultU64x32 (
+                                          LShiftU64 (Extent.ee_start_hi, 32) |
+                                          Extent.ee_start_lo,
+                                          Partition->BlockSize
+                                          ) + ExtentOffset,
+                                        &ReadAhead->Token,
+                                        ReadAhead->Length,
+                                        EXT4_READ_AHEAD_DATA (ReadAhead)
+                                        );
+
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (ReadAhead->Token.Event);
+    FreePool (ReadAhead);
+    return;
+  }
+
+  File->ReadAhead = ReadAhead;
+}
+
+/**
+   Reads file data, serving the leading part of the read from the file's
+   read-ahead buffer when it covers the current offset.
+
+   @param[in]        Partition   Pointer to the opened partition.
+   @param[in]        File        Pointer to the opened file.
+   @param[out]       Buffer      Pointer to the destination buffer.
+   @param[in]        Offset      Offset of the read.
+   @param[in out]    Length      Length of the read, length actually read.
+
+   @return Status of the read.
+**/
+STATIC
+EFI_STATUS
+Ext4ReadWithReadAhead (
+  IN EXT4_PARTITION  *Partition,
+  IN EXT4_FILE       *File,
+  OUT VOID           *Buffer,
+  IN UINT64          Offset,
+  IN OUT UINTN       *Length
+  )
+{
+  EXT4_READ_AHEAD  *ReadAhead;
+  EFI_STATUS       Status;
+  UINTN            Consumed;
+  UINTN            Remaining;
+
+  ReadAhead = File->ReadAhead;
+  Consumed  = 0;
+
+  if (ReadAhead != NULL) {
+    if ((Offset >= ReadAhead->FileOffset) &&
+        (Offset < ReadAhead->FileOffset + ReadAhead->Length))
+    {
+      Status = Ext4WaitReadAhead (File);
+
+      if (!EFI_ERROR (Status)) {
+        Consumed = MIN (*Length, (UINTN)(ReadAhead->FileOffset + ReadAhead->Length - Offset));
+        CopyMem (Buffer, EXT4_READ_AHEAD_DATA (ReadAhead) + (Offset - ReadAhead->FileOffset), Consumed);
+      }
+    }
+
+    // The window is single use either way: a stale one will not match again,
+    // and a consumed one gets replaced by the next one.
+    Ext4DropReadAhead (File);
+
+    if (Consumed == *Length) {
+      return EFI_SUCCESS;
+    }
+
+    if ((Consumed != 0) && (Offset + Consumed >= EXT4_INODE_SIZE (File->Inode))) {
+      // The read-ahead window already ends at the end of the file.
+      *Length = Consumed;
+      return EFI_SUCCESS;
+    }
+  }
+
+  Remaining = *Length - Consumed;
+  Status    = Ext4Read (Partition, File, (CHAR8 *)Buffer + Consumed, Offset + Consumed, &Remaining);
+
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  *Length = Consumed + Remaining;
+  return EFI_SUCCESS;
+}
+
 /**
   Opens a new file relative to the source file's location.
 
@@ -313,6 +529,7 @@ Ext4CloseInternal (
   }
 
   DEBUG ((DEBUG_FS, "[ext4] Closed file %p (inode %lu)\n", File, File->InodeNum));
+  Ext4DropReadAhead (File);
   RemoveEntryList (&File->OpenFilesListNode);
   FreePool (File->Inode);
   Ext4FreeExtentsMap (File);
@@ -373,6 +590,7 @@ Ext4ReadFile (
   EXT4_FILE       *File;
   EXT4_PARTITION  *Partition;
   EFI_STATUS      Status;
+  BOOLEAN         Sequential;
 
   File = (EXT4_FILE *)This;
   Partition = File->Partition;
@@ -380,9 +598,17 @@ Ext4ReadFile (
   ASSERT (Ext4FileIsOpenable (File));
 
   if (Ext4FileIsReg (File)) {
-    Status = Ext4Read (Partition, File, Buffer, File->Position, BufferSize);
+    Sequential = (File->Position != 0) && (File->Position == File->LastReadEnd);
+
+    Status = Ext4ReadWithReadAhead (Partition, File, Buffer, File->Position, BufferSize);
     if (Status == EFI_SUCCESS) {
-      File->Position += *BufferSize;
+      File->Position   += *BufferSize;
+      File->LastReadEnd = File->Position;
+
+      // Start fetching the next window while the caller consumes this one.
+      if (Sequential && (File->ReadAhead == NULL)) {
+        Ext4StartReadAhead (Partition, File, File->Position);
+      }
     }
 
     return Status;
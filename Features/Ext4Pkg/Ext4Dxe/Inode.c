@@ -12,6 +12,13 @@
 
 #include "Ext4Dxe.h"
 
+// Upper bound, in bytes, on a single clustered disk read. Adjacent extents
+// that are physically contiguous are merged into one ReadDisk call up to
+// this size; ext4 caps a single extent at 32768 blocks, so without the
+// clustering a large contiguous file is still read in 128MB (4KB blocks)
+// pieces at best, and in far smaller ones on a fragmented filesystem.
+#define EXT4_MAX_CLUSTER_READ_BYTES  SIZE_16MB
+
 /**
    Calculates the checksum of the given inode.
    @param[in]      Partition     Pointer to the opened EXT4 partition.
@@ -101,13 +108,18 @@ Ext4Read (
   BOOLEAN      HasBackingExtent;
   UINT32       HoleOff;
   UINTN        HoleLen;
+  EXT4_EXTENT  NextExtent;
   UINT64       ExtentStartBytes;
   UINT64       ExtentLengthBytes;
   UINT64       ExtentLogicalBytes;
+  UINT64       NextStartBytes;
+  UINT64       NextLogicalBytes;
+  UINT64       NextMayRead;
 
   // Our extent offset is the difference between CurrentSeek and ExtentLogicalBytes
-  UINT64  ExtentOffset;
-  UINTN   ExtentMayRead;
+  UINT64           ExtentOffset;
+  UINTN            ExtentMayRead;
+  EXT4_READ_BATCH  Batch;
 
   Inode         = File->Inode;
   InodeSize     = EXT4_INODE_SIZE (Inode);
@@ -125,6 +137,10 @@ Ext4Read (
     RemainingRead = (UINTN)(InodeSize - Offset);
   }
 
+  // Reads over non-contiguous extents are batched, so they can be in flight
+  // at once when the disk supports DISK_IO2, and only waited for at the end.
+  Ext4ReadBatchInit (&Batch, Partition);
+
   while (RemainingRead != 0) {
     WasRead = 0;
 
@@ -139,6 +155,7 @@ Ext4Read (
                );
 
     if (Status != EFI_SUCCESS && Status != EFI_NO_MAPPING) {
+      Ext4ReadBatchWait (&Batch);
       return Status;
     }
 
@@ -172,7 +189,49 @@ Ext4Read (
 
       WasRead = ExtentMayRead > RemainingRead ? RemainingRead : ExtentMayRead;
 
-      Status = Ext4ReadDiskIo (Partition, Buffer, WasRead, ExtentStartBytes + ExtentOffset);
+      // Cluster the read over the following extents while they are
+      // physically contiguous with this one, so a single large ReadDisk
+      // call replaces one call per extent. The current read always ends
+      // on an extent (and hence block) boundary when there is more to read.
+      while (WasRead < RemainingRead && WasRead < EXT4_MAX_CLUSTER_READ_BYTES) {
+        Status = Ext4GetExtent (
+                   Partition,
+                   File,
+                   DivU64x32 (CurrentSeek + WasRead, Partition->BlockSize),
+                   &NextExtent
+                   );
+
+        if (Status != EFI_SUCCESS) {
+          // Holes and errors end the run; the outer loop deals with them.
+          break;
+        }
+
+        if (EXT4_EXTENT_IS_UNINITIALIZED (&NextExtent)) {
+          break;
+        }
+
+        NextStartBytes = MultU64x32 (
+                           LShiftU64 (NextExtent.ee_start_hi, 32) |
+                           NextExtent.ee_start_lo,
+                           Partition->BlockSize
+                           );
+        NextLogicalBytes = (UINT64)NextExtent.ee_block * Partition->BlockSize;
+
+        if (NextStartBytes + (CurrentSeek + WasRead - NextLogicalBytes) !=
+            ExtentStartBytes + ExtentOffset + WasRead)
+        {
+          break;
+        }
+
+        NextMayRead = NextExtent.ee_len * Partition->BlockSize -
+                      (CurrentSeek + WasRead - NextLogicalBytes);
+        NextMayRead = MIN (NextMayRead, RemainingRead - WasRead);
+        NextMayRead = MIN (NextMayRead, EXT4_MAX_CLUSTER_READ_BYTES - WasRead);
+
+        WasRead += (UINTN)NextMayRead;
+      }
+
+      Status = Ext4ReadBatchAdd (&Batch, Buffer, WasRead, ExtentStartBytes + ExtentOffset);
 
       if (EFI_ERROR (Status)) {
         DEBUG ((
@@ -182,6 +241,7 @@ Ext4Read (
           ExtentStartBytes + ExtentOffset,
           ExtentStartBytes + ExtentOffset + WasRead - 1
           ));
+        Ext4ReadBatchWait (&Batch);
         return Status;
       }
     }
@@ -192,6 +252,12 @@ Ext4Read (
     CurrentSeek += WasRead;
   }
 
+  Status = Ext4ReadBatchWait (&Batch);
+
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   *Length = BeenRead;
 
   return EFI_SUCCESS;
@@ -36,6 +36,10 @@ Ext4OpenPartition (
   }
 
   InitializeListHead (&Part->OpenFiles);
+  InitializeListHead (&Part->ExtentNodeCache);
+  InitializeListHead (&Part->DirentCache);
+  InitializeListHead (&Part->InodeBlockCache);
+  InitializeListHead (&Part->BlockScratchList);
 
   Part->BlockIo = BlockIo;
   Part->DiskIo  = DiskIo;
@@ -125,6 +129,11 @@ Ext4UnmountAndFreePartition (
     DEBUG ((DEBUG_ERROR, "[ext4] Failed to delete root dentry - resource leak present.\n"));
   }
 
+  Ext4FreeExtentNodeCache (Partition);
+  Ext4FreeDirentCache (Partition);
+  Ext4FreeInodeBlockCache (Partition);
+  Ext4FreeBlockScratchPool (Partition);
+
   FreePool (Partition->BlockGroups);
   FreePool (Partition);
 
@@ -0,0 +1,113 @@
+/** @file
+  Shell application decoding the ACPI Debug trace buffer.
+
+  Collects the records the ASL code traced, sorts them by the timestamp
+  each record carries and prints them in chronological order, so the
+  output reads correctly even after the ring has wrapped and overwritten
+  its oldest entries.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiLib.h>
+#include <Library/PcdLib.h>
+
+#include <AcpiDebugBuffer.h>
+
+/**
+  Application entry point.
+
+  @param[in] ImageHandle    The firmware allocated handle for the EFI image.
+  @param[in] SystemTable    A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS       The trace buffer was decoded.
+  @retval EFI_NOT_FOUND     The trace buffer is absent or not initialized.
+
+**/
+EFI_STATUS
+EFIAPI
+AcpiDebugDumpEntryPoint (
+  IN EFI_HANDLE         ImageHandle,
+  IN EFI_SYSTEM_TABLE   *SystemTable
+  )
+{
+  ACPI_DEBUG_HEAD    *AcpiDebug;
+  ACPI_DEBUG_RECORD  *Records;
+  ACPI_DEBUG_RECORD  *Record;
+  ACPI_DEBUG_RECORD  Swap;
+  CHAR8              Text[ACPI_DEBUG_RECORD_TEXT_SIZE + 1];
+  UINT32             DataStart;
+  UINT32             DataEnd;
+  UINT32             Cursor;
+  UINTN              Count;
+  UINTN              Index;
+  UINTN              SortIndex;
+
+  AcpiDebug = (ACPI_DEBUG_HEAD *) (UINTN) PcdGet32 (PcdAcpiDebugAddress);
+  if ((AcpiDebug == NULL) ||
+      (CompareMem (AcpiDebug->Signature, ACPI_DEBUG_STR, sizeof (ACPI_DEBUG_STR) - 1) != 0)) {
+    Print (L"ACPI debug buffer is not present.\n");
+    return EFI_NOT_FOUND;
+  }
+
+  DataStart = (UINT32) ((UINTN) AcpiDebug + sizeof (ACPI_DEBUG_HEAD));
+  DataEnd   = (UINT32) ((UINTN) AcpiDebug + AcpiDebug->BufferSize);
+  if ((AcpiDebug->Tail < DataStart) || (AcpiDebug->Tail > DataEnd)) {
+    Print (L"ACPI debug buffer is corrupt.\n");
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // Before the first wrap only the slots below Tail were ever written;
+  // afterwards every slot holds a record.
+  //
+  if ((BOOLEAN) AcpiDebug->Wrap) {
+    DataEnd = DataStart + (((DataEnd - DataStart) / ACPI_DEBUG_RECORD_SIZE) * ACPI_DEBUG_RECORD_SIZE);
+  } else {
+    DataEnd = AcpiDebug->Tail;
+  }
+
+  Count = (DataEnd - DataStart) / ACPI_DEBUG_RECORD_SIZE;
+  if (Count == 0) {
+    Print (L"ACPI debug buffer is empty.\n");
+    return EFI_SUCCESS;
+  }
+
+  Records = AllocatePool (Count * ACPI_DEBUG_RECORD_SIZE);
+  if (Records == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  for (Index = 0, Cursor = DataStart; Index < Count; Index++, Cursor += ACPI_DEBUG_RECORD_SIZE) {
+    CopyMem (&Records[Index], (VOID *) (UINTN) Cursor, ACPI_DEBUG_RECORD_SIZE);
+  }
+
+  //
+  // Restore chronological order; the ring position alone is wrong once the
+  // buffer has wrapped.
+  //
+  for (Index = 1; Index < Count; Index++) {
+    Swap = Records[Index];
+    for (SortIndex = Index; SortIndex > 0 && Records[SortIndex - 1].Timestamp > Swap.Timestamp; SortIndex--) {
+      Records[SortIndex] = Records[SortIndex - 1];
+    }
+    Records[SortIndex] = Swap;
+  }
+
+  for (Index = 0; Index < Count; Index++) {
+    Record = &Records[Index];
+    ZeroMem (Text, sizeof (Text));
+    AsciiStrnCpyS (Text, sizeof (Text), Record->Text, ACPI_DEBUG_RECORD_TEXT_SIZE);
+    Print (L"[%ld us] %a\n", DivU64x32 (Record->Timestamp, 10), Text);
+  }
+  if (AcpiDebug->DroppedCount != 0) {
+    Print (L"%d message(s) dropped on contention.\n", AcpiDebug->DroppedCount);
+  }
+
+  FreePool (Records);
+  return EFI_SUCCESS;
+}
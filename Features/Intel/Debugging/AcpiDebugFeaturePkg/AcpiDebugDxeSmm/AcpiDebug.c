@@ -19,7 +19,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Protocol/SmmEndOfDxe.h>
 #include <Protocol/SmmSwDispatch2.h>
 
-#define ACPI_DEBUG_STR      "INTEL ACPI DEBUG"
+#include <AcpiDebugBuffer.h>
 
 //
 // ASL NAME structure
@@ -33,22 +33,7 @@ typedef struct {
 } NAME_LAYOUT;
 #pragma pack()
 
-#pragma pack(1)
-typedef struct {
-  UINT8  Signature[16];     // "INTEL ACPI DEBUG"
-  UINT32 BufferSize;        // Total size of Acpi Debug buffer including header structure
-  UINT32 Head;              // Current buffer pointer for SMM to print out
-  UINT32 Tail;              // Current buffer pointer for ASL to input
-  UINT8  SmiTrigger;        // Value to trigger the SMI via B2 port
-  UINT8  Wrap;              // If current Tail < Head
-  UINT8  SmmVersion;        // If SMM version
-  UINT8  Truncate;          // If the input from ASL > MAX_BUFFER_SIZE
-} ACPI_DEBUG_HEAD;
-#pragma pack()
-
-#define AD_SIZE             sizeof (ACPI_DEBUG_HEAD) // This is 0x20
-
-#define MAX_BUFFER_SIZE     32
+#define AD_SIZE             sizeof (ACPI_DEBUG_HEAD) // This is 0x40
 
 UINT32                      mBufferEnd = 0;
 ACPI_DEBUG_HEAD             *mAcpiDebug = NULL;
@@ -332,7 +317,8 @@ AcpiDebugSmmCallback (
   IN OUT UINTN      *CommBufferSize
   )
 {
-  UINT8             Buffer[MAX_BUFFER_SIZE];
+  ACPI_DEBUG_RECORD Record;
+  CHAR8             Text[ACPI_DEBUG_RECORD_TEXT_SIZE + 1];
 
   //
   // Validate the fields in mAcpiDebug to ensure there is no harm to SMI handler.
@@ -352,7 +338,7 @@ AcpiDebugSmmCallback (
   if (!(BOOLEAN)mAcpiDebug->Wrap && ((mAcpiDebug->Head >= (UINT32) ((UINTN) mAcpiDebug + AD_SIZE))
     && (mAcpiDebug->Head < mAcpiDebug->Tail))){
     //
-    // If curent ----- buffer + 020
+    // If curent ----- buffer + 040
     //                 ...
     //                 ... Head
     //                 ... Data for SMM print
@@ -360,52 +346,41 @@ AcpiDebugSmmCallback (
     //                 ... Vacant for ASL input
     //           ----- buffer end
     //
-    // skip NULL block
-    //
-    while ((*(CHAR8 *) (UINTN) mAcpiDebug->Head == '\0') && (mAcpiDebug->Head < mAcpiDebug->Tail)) {
-      mAcpiDebug->Head ++;
-    }
-
-    if (mAcpiDebug->Head < mAcpiDebug->Tail) {
-      ZeroMem (Buffer, MAX_BUFFER_SIZE);
-      AsciiStrnCpyS ((CHAR8 *) Buffer, MAX_BUFFER_SIZE, (CHAR8 *) (UINTN) mAcpiDebug->Head, MAX_BUFFER_SIZE - 1);
-
-      DEBUG ((DEBUG_INFO | DEBUG_ERROR, "%a%a\n", Buffer, (BOOLEAN) mAcpiDebug->Truncate ? "..." : ""));
-      mAcpiDebug->Head += MAX_BUFFER_SIZE;
-
-      if (mAcpiDebug->Head >= (mAcpiDebug->Tail)) {
-        //
-        // When head == tail, we do nothing in handler.
-        //
-        mAcpiDebug->Head = mAcpiDebug->Tail;
-      }
+    CopyMem (&Record, (VOID *) (UINTN) mAcpiDebug->Head, ACPI_DEBUG_RECORD_SIZE);
+    ZeroMem (Text, sizeof (Text));
+    AsciiStrnCpyS (Text, sizeof (Text), Record.Text, ACPI_DEBUG_RECORD_TEXT_SIZE);
+
+    DEBUG ((DEBUG_INFO | DEBUG_ERROR, "[%ld us] %a%a\n", DivU64x32 (Record.Timestamp, 10), Text, (BOOLEAN) mAcpiDebug->Truncate ? "..." : ""));
+    mAcpiDebug->Head += ACPI_DEBUG_RECORD_SIZE;
+
+    if (mAcpiDebug->Head >= (mAcpiDebug->Tail)) {
+      //
+      // When head == tail, we do nothing in handler.
+      //
+      mAcpiDebug->Head = mAcpiDebug->Tail;
     }
   } else if ((BOOLEAN) mAcpiDebug->Wrap && ((mAcpiDebug->Head > mAcpiDebug->Tail)
     && (mAcpiDebug->Head < (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize)))){
     //
-    // If curent ----- buffer + 020
+    // If curent ----- buffer + 040
     //                 ... Tail
     //                 ... Vacant for ASL input
     //                 ... Head
     //                 ... Data for SMM print
     //           ----- buffer end
     //
-    while ((*(CHAR8 *) (UINTN) mAcpiDebug->Head == '\0') && (mAcpiDebug->Head < (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize))) {
-      mAcpiDebug->Head ++;
-    }
-    if (mAcpiDebug->Head < (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize)){
-      ZeroMem (Buffer, MAX_BUFFER_SIZE);
-      AsciiStrnCpyS ((CHAR8 *) Buffer, MAX_BUFFER_SIZE, (CHAR8 *) (UINTN) mAcpiDebug->Head, MAX_BUFFER_SIZE - 1);
-      DEBUG ((DEBUG_INFO | DEBUG_ERROR, "%a%a\n", Buffer, (BOOLEAN) mAcpiDebug->Truncate ? "..." : ""));
-      mAcpiDebug->Head += MAX_BUFFER_SIZE;
-
-      if (mAcpiDebug->Head >= (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize)) {
-        //
-        // We met end of buffer.
-        //
-        mAcpiDebug->Wrap = 0;
-        mAcpiDebug->Head = (UINT32) ((UINTN) mAcpiDebug + AD_SIZE);
-      }
+    CopyMem (&Record, (VOID *) (UINTN) mAcpiDebug->Head, ACPI_DEBUG_RECORD_SIZE);
+    ZeroMem (Text, sizeof (Text));
+    AsciiStrnCpyS (Text, sizeof (Text), Record.Text, ACPI_DEBUG_RECORD_TEXT_SIZE);
+    DEBUG ((DEBUG_INFO | DEBUG_ERROR, "[%ld us] %a%a\n", DivU64x32 (Record.Timestamp, 10), Text, (BOOLEAN) mAcpiDebug->Truncate ? "..." : ""));
+    mAcpiDebug->Head += ACPI_DEBUG_RECORD_SIZE;
+
+    if (mAcpiDebug->Head >= (UINT32) ((UINTN) mAcpiDebug + mAcpiDebug->BufferSize)) {
+      //
+      // We met end of buffer.
+      //
+      mAcpiDebug->Wrap = 0;
+      mAcpiDebug->Head = (UINT32) ((UINTN) mAcpiDebug + AD_SIZE);
     }
   }
 
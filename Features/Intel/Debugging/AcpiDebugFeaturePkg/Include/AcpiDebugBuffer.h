@@ -0,0 +1,49 @@
+/** @file
+  Definitions for the ACPI Debug trace buffer shared between the ASL code,
+  the DXE/SMM drivers and the dump application.
+
+Copyright (c) 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _ACPI_DEBUG_BUFFER_H_
+#define _ACPI_DEBUG_BUFFER_H_
+
+#define ACPI_DEBUG_STR            "INTEL ACPI DEBUG"
+
+//
+// Layout of the buffer head; the ASL code accesses the same fields through
+// the ADHD operation region, so the ASL offsets must track this structure.
+//
+#pragma pack(1)
+typedef struct {
+  UINT8  Signature[16];     // "INTEL ACPI DEBUG"
+  UINT32 BufferSize;        // Total size of Acpi Debug buffer including header structure
+  UINT32 Head;              // Current buffer pointer for SMM to print out
+  UINT32 Tail;              // Current buffer pointer for ASL to input
+  UINT8  SmiTrigger;        // Value to trigger the SMI via B2 port
+  UINT8  Wrap;              // If current Tail < Head
+  UINT8  SmmVersion;        // If SMM version
+  UINT8  Truncate;          // If the input from ASL > record text size
+  UINT32 DroppedCount;      // Messages dropped because the mutex was contended
+  UINT32 Reserved[7];       // Keep the head a multiple of the record size
+} ACPI_DEBUG_HEAD;
+#pragma pack()
+
+//
+// Each record carries the ASL Timer value (100ns units since boot) taken
+// when the message was traced, so a decoder can restore chronological
+// order across the wrap point of the ring.
+//
+#pragma pack(1)
+typedef struct {
+  UINT64 Timestamp;         // ASL Timer value at trace time, 100ns units
+  CHAR8  Text[24];          // Message text, not necessarily terminated
+} ACPI_DEBUG_RECORD;
+#pragma pack()
+
+#define ACPI_DEBUG_RECORD_SIZE      sizeof (ACPI_DEBUG_RECORD)  // This is 0x20
+#define ACPI_DEBUG_RECORD_TEXT_SIZE 24
+
+#endif
@@ -0,0 +1,40 @@
+/** @file
+  Definitions shared between the post-code journal producers and decoders.
+
+  The journal lives in a reserved memory region at a fixed physical address
+  (PcdPostCodeJournalBase) that firmware does not clear on warm reset, so
+  the trail of a hung or slow boot can be read back after the reset that
+  recovered from it. Each record carries the performance counter value at
+  emission time; a decoder turns the deltas between consecutive records
+  into a per-interval boot profile.
+
+Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#ifndef _POST_CODE_JOURNAL_H_
+#define _POST_CODE_JOURNAL_H_
+
+#define POST_CODE_JOURNAL_SIGNATURE  SIGNATURE_32 ('P', 'C', 'J', 'L')
+#define POST_CODE_JOURNAL_VERSION    1
+
+#pragma pack(1)
+
+typedef struct {
+  UINT32    Signature;    ///< POST_CODE_JOURNAL_SIGNATURE
+  UINT32    Version;      ///< POST_CODE_JOURNAL_VERSION
+  UINT32    RecordCount;  ///< Capacity of the record area, in records
+  UINT32    NextIndex;    ///< Next record slot to write
+  UINT32    BootCount;    ///< Bumped once per boot by the PEI handler
+  UINT32    Wrap;         ///< Non-zero once NextIndex has wrapped
+} POST_CODE_JOURNAL_HEADER;
+
+typedef struct {
+  UINT64    Timestamp;    ///< Performance counter value at emission time
+  UINT32    PostCode;     ///< The value written to the post-code port
+  UINT32    BootCount;    ///< Boot the record belongs to
+} POST_CODE_JOURNAL_RECORD;
+
+#pragma pack()
+
+#endif // _POST_CODE_JOURNAL_H_
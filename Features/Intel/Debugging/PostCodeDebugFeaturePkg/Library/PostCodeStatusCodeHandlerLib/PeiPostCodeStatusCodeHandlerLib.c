@@ -16,6 +16,9 @@
 #include <Library/PostCodeMapLib.h>
 #include <Library/PostCodeLib.h>
 
+#include <PostCodeJournal.h>
+#include "PostCodeJournalInternal.h"
+
 /**
   Convert status code value and write data to post code.
 
@@ -56,6 +59,7 @@ PostCodeStatusCodeReportWorker (
   if (PostCodeValue != 0) {
     DEBUG ((EFI_D_INFO, "POSTCODE=<%02x>\n", PostCodeValue));
     PostCode (PostCodeValue);
+    PostCodeJournalRecordEntry (PostCodeValue);
   }
 
   return EFI_SUCCESS;
@@ -87,6 +91,12 @@ PeiPostCodeStatusCodeHandlerLibConstructor (
     return RETURN_SUCCESS;
   }
 
+  //
+  // The journal survives warm reset; open a new boot interval in it so a
+  // decoder can tell this boot's trail from the previous one's.
+  //
+  PostCodeJournalBeginBoot ();
+
   Status = PeiServicesLocatePpi (
              &gEfiPeiRscHandlerPpiGuid,
              0,
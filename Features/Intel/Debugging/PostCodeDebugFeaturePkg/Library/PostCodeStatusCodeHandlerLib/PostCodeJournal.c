@@ -0,0 +1,118 @@
+/** @file
+  Post-code journal implementation shared by the PEI, RuntimeDxe and SMM
+  status code handlers.
+
+  Every post code emitted to the port is also appended, together with the
+  performance counter value, to a ring of records in the reserved region at
+  PcdPostCodeJournalBase. The region is expected to survive warm reset, so
+  the journal is only rebuilt when its header does not validate.
+
+  Copyright (c) 2010 - 2020, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Base.h>
+#include <Library/PcdLib.h>
+#include <Library/TimerLib.h>
+
+#include <PostCodeJournal.h>
+#include "PostCodeJournalInternal.h"
+
+/**
+  Locate the post-code journal and validate its header.
+
+  The reserved region is not cleared by firmware, so a header left by the
+  previous boot is kept; it is rebuilt only when the content is not a valid
+  journal (first boot after power loss, or a firmware update that moved or
+  resized the region).
+
+  @return Pointer to the journal header, or NULL when the feature is not
+          configured (PcdPostCodeJournalBase is zero) or the region is too
+          small to hold a single record.
+
+**/
+POST_CODE_JOURNAL_HEADER *
+PostCodeJournalGet (
+  VOID
+  )
+{
+  POST_CODE_JOURNAL_HEADER  *Journal;
+  UINT32                    Size;
+  UINT32                    RecordCount;
+
+  Journal = (POST_CODE_JOURNAL_HEADER *) (UINTN) PcdGet32 (PcdPostCodeJournalBase);
+  Size    = PcdGet32 (PcdPostCodeJournalSize);
+  if ((Journal == NULL) ||
+      (Size < sizeof (POST_CODE_JOURNAL_HEADER) + sizeof (POST_CODE_JOURNAL_RECORD))) {
+    return NULL;
+  }
+
+  RecordCount = (Size - sizeof (POST_CODE_JOURNAL_HEADER)) / sizeof (POST_CODE_JOURNAL_RECORD);
+  if ((Journal->Signature != POST_CODE_JOURNAL_SIGNATURE) ||
+      (Journal->Version != POST_CODE_JOURNAL_VERSION) ||
+      (Journal->RecordCount != RecordCount) ||
+      (Journal->NextIndex >= RecordCount)) {
+    Journal->Signature   = POST_CODE_JOURNAL_SIGNATURE;
+    Journal->Version     = POST_CODE_JOURNAL_VERSION;
+    Journal->RecordCount = RecordCount;
+    Journal->NextIndex   = 0;
+    Journal->BootCount   = 0;
+    Journal->Wrap        = 0;
+  }
+
+  return Journal;
+}
+
+/**
+  Mark the start of a new boot in the post-code journal.
+
+**/
+VOID
+PostCodeJournalBeginBoot (
+  VOID
+  )
+{
+  POST_CODE_JOURNAL_HEADER  *Journal;
+
+  Journal = PostCodeJournalGet ();
+  if (Journal == NULL) {
+    return;
+  }
+
+  Journal->BootCount++;
+}
+
+/**
+  Append a post code to the journal.
+
+  @param  PostCodeValue    The value written to the post-code port.
+
+**/
+VOID
+PostCodeJournalRecordEntry (
+  IN UINT32  PostCodeValue
+  )
+{
+  POST_CODE_JOURNAL_HEADER  *Journal;
+  POST_CODE_JOURNAL_RECORD  *Record;
+
+  Journal = PostCodeJournalGet ();
+  if (Journal == NULL) {
+    return;
+  }
+
+  Record = (POST_CODE_JOURNAL_RECORD *) (Journal + 1) + Journal->NextIndex;
+  Record->Timestamp = GetPerformanceCounter ();
+  Record->PostCode  = PostCodeValue;
+  Record->BootCount = Journal->BootCount;
+
+  Journal->NextIndex++;
+  if (Journal->NextIndex >= Journal->RecordCount) {
+    //
+    // Overwrite the oldest records; the latest trail is the interesting one.
+    //
+    Journal->NextIndex = 0;
+    Journal->Wrap      = 1;
+  }
+}
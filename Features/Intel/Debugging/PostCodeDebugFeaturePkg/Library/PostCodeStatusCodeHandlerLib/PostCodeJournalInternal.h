@@ -0,0 +1,32 @@
+/** @file
+  Post-code journal producer interface shared by the PEI, RuntimeDxe and
+  SMM status code handlers.
+
+Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#ifndef _POST_CODE_JOURNAL_INTERNAL_H_
+#define _POST_CODE_JOURNAL_INTERNAL_H_
+
+/**
+  Mark the start of a new boot in the post-code journal.
+
+**/
+VOID
+PostCodeJournalBeginBoot (
+  VOID
+  );
+
+/**
+  Append a post code to the journal.
+
+  @param  PostCodeValue    The value written to the post-code port.
+
+**/
+VOID
+PostCodeJournalRecordEntry (
+  IN UINT32  PostCodeValue
+  );
+
+#endif // _POST_CODE_JOURNAL_INTERNAL_H_
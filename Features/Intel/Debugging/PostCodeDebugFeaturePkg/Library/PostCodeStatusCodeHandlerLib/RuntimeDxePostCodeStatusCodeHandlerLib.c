@@ -18,6 +18,9 @@
 #include <Library/PostCodeMapLib.h>
 #include <Library/PostCodeLib.h>
 
+#include <PostCodeJournal.h>
+#include "PostCodeJournalInternal.h"
+
 EFI_RSC_HANDLER_PROTOCOL  *mPostCodeRscHandlerProtocol       = NULL;
 EFI_EVENT                 mPostCodeExitBootServicesEvent     = NULL;
 BOOLEAN                   mPostCodeRegisted                  = FALSE;
@@ -60,6 +63,7 @@ PostCodeStatusCodeReportWorker (
   if (PostCodeValue != 0) {
     DEBUG ((EFI_D_INFO, "POSTCODE=<%02x>\n", PostCodeValue));
     PostCode (PostCodeValue);
+    PostCodeJournalRecordEntry (PostCodeValue);
   }
 
   return EFI_SUCCESS;
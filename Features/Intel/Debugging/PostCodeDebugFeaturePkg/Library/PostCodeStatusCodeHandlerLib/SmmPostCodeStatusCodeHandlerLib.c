@@ -17,6 +17,9 @@
 #include <Library/PostCodeLib.h>
 #include <Library/PostCodeMapLib.h>
 
+#include <PostCodeJournal.h>
+#include "PostCodeJournalInternal.h"
+
 
 /**
   Convert status code value and write data to post code.
@@ -56,6 +59,7 @@ PostCodeStatusCodeReportWorker (
   if (PostCodeValue != 0) {
     DEBUG ((EFI_D_INFO, "POSTCODE=<%02x>\n", PostCodeValue));
     PostCode (PostCodeValue);
+    PostCodeJournalRecordEntry (PostCodeValue);
   }
 
   return EFI_SUCCESS;
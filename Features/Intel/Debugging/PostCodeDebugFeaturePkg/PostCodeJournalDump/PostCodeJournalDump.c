@@ -0,0 +1,119 @@
+/** @file
+  Shell application decoding the post-code journal.
+
+  Prints the journal records in chronological order together with the time
+  spent between consecutive post codes, turning the journal into a boot
+  profile: the intervals with the largest deltas are where firmware dawdled,
+  and the last record of a boot is where it died.
+
+Copyright (c) 2020, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/UefiLib.h>
+#include <Library/PcdLib.h>
+#include <Library/TimerLib.h>
+
+#include <PostCodeJournal.h>
+
+/**
+  Convert a performance counter delta to microseconds.
+
+  @param[in] Ticks    Performance counter delta.
+
+  @return The delta expressed in microseconds.
+
+**/
+UINT64
+PostCodeJournalTicksToUs (
+  IN UINT64  Ticks
+  )
+{
+  return DivU64x64Remainder (
+           MultU64x32 (Ticks, 1000000),
+           GetPerformanceCounterProperties (NULL, NULL),
+           NULL
+           );
+}
+
+/**
+  Application entry point.
+
+  @param[in] ImageHandle    The firmware allocated handle for the EFI image.
+  @param[in] SystemTable    A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS       The journal was decoded.
+  @retval EFI_NOT_FOUND     The journal is absent or not initialized.
+
+**/
+EFI_STATUS
+EFIAPI
+PostCodeJournalDumpEntryPoint (
+  IN EFI_HANDLE         ImageHandle,
+  IN EFI_SYSTEM_TABLE   *SystemTable
+  )
+{
+  POST_CODE_JOURNAL_HEADER  *Journal;
+  POST_CODE_JOURNAL_RECORD  *Records;
+  POST_CODE_JOURNAL_RECORD  *Record;
+  UINT32                    Count;
+  UINT32                    Index;
+  UINT32                    Cursor;
+  UINT32                    CurrentBoot;
+  UINT64                    Previous;
+
+  Journal = (POST_CODE_JOURNAL_HEADER *) (UINTN) PcdGet32 (PcdPostCodeJournalBase);
+  if ((Journal == NULL) ||
+      (Journal->Signature != POST_CODE_JOURNAL_SIGNATURE) ||
+      (Journal->Version != POST_CODE_JOURNAL_VERSION) ||
+      (Journal->NextIndex >= Journal->RecordCount)) {
+    Print (L"Post-code journal is not present.\n");
+    return EFI_NOT_FOUND;
+  }
+
+  Records = (POST_CODE_JOURNAL_RECORD *) (Journal + 1);
+  if ((BOOLEAN) Journal->Wrap) {
+    Count  = Journal->RecordCount;
+    Cursor = Journal->NextIndex;
+  } else {
+    Count  = Journal->NextIndex;
+    Cursor = 0;
+  }
+  if (Count == 0) {
+    Print (L"Post-code journal is empty.\n");
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Walk from the oldest record; the delta of each record against the
+  // previous one of the same boot is how long firmware spent between the
+  // two post codes.
+  //
+  CurrentBoot = 0;
+  Previous    = 0;
+  for (Index = 0; Index < Count; Index++) {
+    Record = &Records[Cursor];
+    Cursor = (Cursor + 1) % Journal->RecordCount;
+
+    if (Record->BootCount != CurrentBoot) {
+      CurrentBoot = Record->BootCount;
+      Previous    = 0;
+      Print (L"--- boot %d ---\n", CurrentBoot);
+    }
+
+    if ((Previous == 0) || (Record->Timestamp < Previous)) {
+      Print (L"POSTCODE=<%02x>\n", Record->PostCode);
+    } else {
+      Print (
+        L"POSTCODE=<%02x> +%ld us\n",
+        Record->PostCode,
+        PostCodeJournalTicksToUs (Record->Timestamp - Previous)
+        );
+    }
+    Previous = Record->Timestamp;
+  }
+
+  return EFI_SUCCESS;
+}
@@ -663,6 +663,189 @@ ON_EXIT:
   return Status;
 }
 
+/**
+  Reap the buffered transmit chunk in flight, if any. This never waits: if
+  the chunk the debug engine is transferring has not completed yet, the
+  function returns and the chunk is checked again on a later call.
+
+  @param  Xhc           The XHCI Instance.
+
+**/
+VOID
+Usb3DebugPortTxReap (
+  IN USB3_DEBUG_PORT_INSTANCE  *Xhc
+  )
+{
+  URB                     *Urb;
+  TRANSFER_RING           *Ring;
+  TRB_TEMPLATE            *Trb;
+  TRB_TEMPLATE            *TrbStart;
+  TRB_TEMPLATE            *TrbEnd;
+
+  if (Xhc->TxInFlight == 0) {
+    return;
+  }
+
+  Urb = &Xhc->Urb;
+  XhcCheckUrbResult (Xhc, Urb);
+  if (!Urb->Finished) {
+    return;
+  }
+
+  if (Urb->Result != EFI_USB_NOERROR) {
+    //
+    // Restore the transfer ring as XhcExecTransfer does on error, and count
+    // the chunk as dropped instead of retrying it; the debug channel must
+    // not wedge behind a host that stopped reading.
+    //
+    Ring = (TRANSFER_RING *)(UINTN) Urb->Ring;
+    Ring->RingEnqueue = Urb->TrbStart;
+    TrbStart = (TRB_TEMPLATE *)(UINTN) Urb->TrbStart;
+    TrbEnd   = (TRB_TEMPLATE *)(UINTN) Urb->TrbEnd;
+    for (Trb = TrbStart; Trb <= TrbEnd; Trb++) {
+      Trb->CycleBit = ((~Ring->RingPCS) & BIT0);
+    }
+    Xhc->TxDroppedBytes += Xhc->TxInFlight;
+  }
+
+  //
+  // Consumed, successfully or not; release the staged bytes.
+  //
+  Xhc->TxRingHead = (Xhc->TxRingHead + Xhc->TxInFlight) % Xhc->TxRingSize;
+  Xhc->TxInFlight = 0;
+}
+
+/**
+  Reap the buffered transmit chunk in flight and, when the engine is idle,
+  hand it the next contiguous run of staged bytes. The engine DMAs from the
+  URB data buffer XhcCreateUrb copies into, so only the doorbell is rung
+  here; completion is collected by a later reap.
+
+  @param  Xhc           The XHCI Instance.
+
+**/
+VOID
+Usb3DebugPortTxPump (
+  IN USB3_DEBUG_PORT_INSTANCE  *Xhc
+  )
+{
+  URB                     *Urb;
+  UINT32                  Pending;
+  UINTN                   Chunk;
+
+  Usb3DebugPortTxReap (Xhc);
+  if (Xhc->TxInFlight != 0) {
+    return;
+  }
+
+  if (Xhc->TxRingHead == Xhc->TxRingTail) {
+    return;
+  }
+
+  if (Xhc->TxRingTail > Xhc->TxRingHead) {
+    Pending = Xhc->TxRingTail - Xhc->TxRingHead;
+  } else {
+    Pending = Xhc->TxRingSize - Xhc->TxRingHead;
+  }
+  Chunk = (Pending > XHC_DEBUG_PORT_DATA_LENGTH) ? XHC_DEBUG_PORT_DATA_LENGTH : Pending;
+
+  Urb = XhcCreateUrb (Xhc, EfiUsbDataOut, (VOID *)(UINTN)(Xhc->TxRingBuffer + Xhc->TxRingHead), Chunk);
+  XhcRingDoorBell (Xhc, Urb);
+  Xhc->TxInFlight = (UINT32) Chunk;
+}
+
+/**
+  Wait for the buffered transmit chunk in flight to finish, so the URB it
+  occupies can be reused for a synchronous transfer. If the host does not
+  collect the chunk within XHC_DEBUG_PORT_TX_DRAIN_TIMEOUT, the chunk is
+  abandoned the same way a failed one is.
+
+  @param  Xhc           The XHCI Instance.
+
+**/
+VOID
+Usb3DebugPortTxDrainInFlight (
+  IN USB3_DEBUG_PORT_INSTANCE  *Xhc
+  )
+{
+  URB                     *Urb;
+  UINTN                   Index;
+  UINTN                   Loop;
+
+  Loop = (XHC_DEBUG_PORT_TX_DRAIN_TIMEOUT * XHC_1_MILLISECOND / XHC_POLL_DELAY) + 1;
+  for (Index = 0; Index < Loop; Index++) {
+    Usb3DebugPortTxReap (Xhc);
+    if (Xhc->TxInFlight == 0) {
+      return;
+    }
+    MicroSecondDelay (XHC_POLL_DELAY);
+  }
+
+  //
+  // Force the chunk to fail so the reap above releases it through the
+  // error path.
+  //
+  Urb = &Xhc->Urb;
+  Urb->Result   = EFI_USB_ERR_TIMEOUT;
+  Urb->Finished = TRUE;
+  Usb3DebugPortTxReap (Xhc);
+}
+
+/**
+  Stage outgoing data in the transmit ring and kick the debug engine. Bytes
+  that do not fit are dropped and counted rather than waited for, so a write
+  costs a memory copy instead of a USB round trip.
+
+  @param  Xhc           The XHCI Instance.
+  @param  Data          Data buffer.
+  @param  Length        Data length.
+
+**/
+VOID
+Usb3DebugPortTxWrite (
+  IN USB3_DEBUG_PORT_INSTANCE  *Xhc,
+  IN UINT8                     *Data,
+  IN UINTN                     Length
+  )
+{
+  UINT32                  Used;
+  UINT32                  Space;
+  UINT32                  Copy;
+  UINT32                  First;
+
+  if (Xhc->TxRingBuffer == 0) {
+    Xhc->TxRingBuffer = (EFI_PHYSICAL_ADDRESS)(UINTN) AllocateAlignBuffer (XHC_DEBUG_PORT_TX_RING_SIZE);
+    if (Xhc->TxRingBuffer == 0) {
+      Xhc->TxDroppedBytes += Length;
+      return;
+    }
+    Xhc->TxRingSize = XHC_DEBUG_PORT_TX_RING_SIZE;
+    Xhc->TxRingHead = 0;
+    Xhc->TxRingTail = 0;
+    Xhc->TxInFlight = 0;
+  }
+
+  //
+  // One slot is kept free to distinguish a full ring from an empty one.
+  //
+  Used  = (Xhc->TxRingTail + Xhc->TxRingSize - Xhc->TxRingHead) % Xhc->TxRingSize;
+  Space = Xhc->TxRingSize - 1 - Used;
+  Copy  = (Length > Space) ? Space : (UINT32) Length;
+  Xhc->TxDroppedBytes += Length - Copy;
+
+  if (Copy != 0) {
+    First = Xhc->TxRingSize - Xhc->TxRingTail;
+    if (First > Copy) {
+      First = Copy;
+    }
+    CopyMem ((VOID *)(UINTN)(Xhc->TxRingBuffer + Xhc->TxRingTail), Data, First);
+    CopyMem ((VOID *)(UINTN) Xhc->TxRingBuffer, Data + First, Copy - First);
+    Xhc->TxRingTail = (Xhc->TxRingTail + Copy) % Xhc->TxRingSize;
+  }
+
+  Usb3DebugPortTxPump (Xhc);
+}
+
 /**
   Check whether the MMIO Bar is within any of the SMRAM ranges.
 
@@ -832,6 +1015,23 @@ Usb3DebugPortDataTransfer (
     }
   }
 
+  if (FeaturePcdGet (PcdUsb3DebugPortBufferedTransmit)) {
+    if (Direction == EfiUsbDataOut) {
+      //
+      // Stage the bytes in the transmit ring and return; the debug engine
+      // drains the ring in the background.
+      //
+      Usb3DebugPortTxWrite (Instance, Data, *Length);
+      *Length = 0;
+      goto Done;
+    }
+    //
+    // The synchronous path below reuses the single URB; finish any buffered
+    // transmit chunk first.
+    //
+    Usb3DebugPortTxDrainInFlight (Instance);
+  }
+
   BytesToSend = 0;
   while (*Length > 0) {
     BytesToSend = ((*Length) > XHC_DEBUG_PORT_DATA_LENGTH) ? XHC_DEBUG_PORT_DATA_LENGTH : *Length;
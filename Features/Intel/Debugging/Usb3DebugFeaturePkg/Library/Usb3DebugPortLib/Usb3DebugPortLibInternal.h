@@ -61,6 +61,17 @@
 //
 #define XHC_DEBUG_PORT_DATA_LENGTH   8
 
+//
+// Size of the staging ring used by the buffered transmit mode
+//
+#define XHC_DEBUG_PORT_TX_RING_SIZE  0x1000
+
+//
+// Time to wait, in millisecond, for a buffered transmit chunk to finish
+// before the URB is needed for a synchronous transfer
+//
+#define XHC_DEBUG_PORT_TX_DRAIN_TIMEOUT  10
+
 //
 // Indicate the timeout when data is transferred. 0 means infinite timeout.
 //
@@ -509,6 +520,19 @@ typedef struct _USB3_DEBUG_PORT_INSTANCE {
   // URB
   //
   URB                                     Urb;
+
+  //
+  // Buffered transmit ring; only used when PcdUsb3DebugPortBufferedTransmit
+  // is set. Head is the next byte to hand to the debug engine, Tail is the
+  // next byte the producer writes, InFlight is the size of the chunk the
+  // engine is currently transferring (0 when idle).
+  //
+  EFI_PHYSICAL_ADDRESS                    TxRingBuffer;
+  UINT32                                  TxRingSize;
+  UINT32                                  TxRingHead;
+  UINT32                                  TxRingTail;
+  UINT32                                  TxInFlight;
+  UINT64                                  TxDroppedBytes;
 } USB3_DEBUG_PORT_INSTANCE;
 
 #pragma pack()
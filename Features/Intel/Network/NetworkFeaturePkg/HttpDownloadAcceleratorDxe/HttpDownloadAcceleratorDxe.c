@@ -0,0 +1,591 @@
+/** @file
+  HTTP download accelerator driver.
+
+  Installs EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL. A download first asks
+  the server for the resource size with a HEAD request; when the server
+  advertises byte-range support and the resource is large enough, the
+  transfer is split into contiguous slices downloaded on several HTTP
+  connections at once, and every response body fragment is received
+  directly into the caller's buffer so no intermediate copy is made.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "HttpDownloadAcceleratorDxe.h"
+
+EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL mHttpDownloadAccelerator = {
+  HttpDownloadAcceleratorDownload
+};
+
+/**
+  Token notification function, records the completion of a request or
+  response token.
+
+  @param[in] Event    Event whose notification function is being invoked.
+  @param[in] Context  Points to the connection's Completed flag.
+
+**/
+VOID
+EFIAPI
+HttpDownloadTokenNotify (
+  IN EFI_EVENT Event,
+  IN VOID      *Context
+  )
+{
+  *(BOOLEAN *) Context = TRUE;
+}
+
+/**
+  Poll a connection until its outstanding token completes.
+
+  @param[in] Connection    The connection to wait on.
+
+  @retval EFI_SUCCESS      The token completed successfully.
+  @retval EFI_TIMEOUT      The token did not complete in time.
+  @retval Others           The status the token completed with.
+
+**/
+EFI_STATUS
+HttpDownloadWaitToken (
+  IN HTTP_DOWNLOAD_CONNECTION *Connection
+  )
+{
+  UINTN Retry;
+
+  for (Retry = 0; Retry < HTTP_DOWNLOAD_TIMEOUT; Retry++) {
+    if (Connection->Completed) {
+      return Connection->Token.Status;
+    }
+    Connection->Http->Poll (Connection->Http);
+    gBS->Stall (HTTP_DOWNLOAD_POLL_INTERVAL);
+  }
+
+  return EFI_TIMEOUT;
+}
+
+/**
+  Create and configure one HTTP connection.
+
+  @param[in]  ServiceBinding    The HTTP service binding to create the
+                                connection on.
+  @param[out] Connection        The connection to initialize.
+
+  @retval EFI_SUCCESS           The connection is ready for requests.
+  @retval Others                An unexpected error occurred.
+
+**/
+EFI_STATUS
+HttpDownloadCreateConnection (
+  IN  EFI_SERVICE_BINDING_PROTOCOL *ServiceBinding,
+  OUT HTTP_DOWNLOAD_CONNECTION     *Connection
+  )
+{
+  EFI_STATUS              Status;
+  EFI_HTTP_CONFIG_DATA    ConfigData;
+  EFI_HTTPv4_ACCESS_POINT Ipv4Node;
+
+  ZeroMem (Connection, sizeof (HTTP_DOWNLOAD_CONNECTION));
+
+  Status = ServiceBinding->CreateChild (ServiceBinding, &Connection->ChildHandle);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = gBS->HandleProtocol (
+                  Connection->ChildHandle,
+                  &gEfiHttpProtocolGuid,
+                  (VOID **) &Connection->Http
+                  );
+  if (EFI_ERROR (Status)) {
+    ServiceBinding->DestroyChild (ServiceBinding, Connection->ChildHandle);
+    Connection->ChildHandle = NULL;
+    return Status;
+  }
+
+  ZeroMem (&ConfigData, sizeof (ConfigData));
+  ZeroMem (&Ipv4Node, sizeof (Ipv4Node));
+  Ipv4Node.UseDefaultAddress      = TRUE;
+  ConfigData.HttpVersion          = HttpVersion11;
+  ConfigData.TimeOutMillisec      = 0;
+  ConfigData.LocalAddressIsIPv6   = FALSE;
+  ConfigData.AccessPoint.IPv4Node = &Ipv4Node;
+  Status = Connection->Http->Configure (Connection->Http, &ConfigData);
+  if (EFI_ERROR (Status)) {
+    ServiceBinding->DestroyChild (ServiceBinding, Connection->ChildHandle);
+    Connection->ChildHandle = NULL;
+    return Status;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  HttpDownloadTokenNotify,
+                  &Connection->Completed,
+                  &Connection->Token.Event
+                  );
+  if (EFI_ERROR (Status)) {
+    Connection->Http->Configure (Connection->Http, NULL);
+    ServiceBinding->DestroyChild (ServiceBinding, Connection->ChildHandle);
+    Connection->ChildHandle = NULL;
+    return Status;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Tear down one HTTP connection.
+
+  @param[in] ServiceBinding    The HTTP service binding the connection was
+                               created on.
+  @param[in] Connection        The connection to destroy.
+
+**/
+VOID
+HttpDownloadDestroyConnection (
+  IN EFI_SERVICE_BINDING_PROTOCOL *ServiceBinding,
+  IN HTTP_DOWNLOAD_CONNECTION     *Connection
+  )
+{
+  if (Connection->ChildHandle == NULL) {
+    return;
+  }
+  if (Connection->Token.Event != NULL) {
+    gBS->CloseEvent (Connection->Token.Event);
+    Connection->Token.Event = NULL;
+  }
+  Connection->Http->Configure (Connection->Http, NULL);
+  ServiceBinding->DestroyChild (ServiceBinding, Connection->ChildHandle);
+  Connection->ChildHandle = NULL;
+}
+
+/**
+  Issue a request on a connection and wait for it to be sent.
+
+  @param[in] Connection    The connection to send on.
+  @param[in] Method        The HTTP method.
+  @param[in] Url           The resource URL.
+  @param[in] HeaderCount   Number of request headers.
+
+  @retval EFI_SUCCESS      The request was sent.
+  @retval Others           An unexpected error occurred.
+
+**/
+EFI_STATUS
+HttpDownloadSendRequest (
+  IN HTTP_DOWNLOAD_CONNECTION *Connection,
+  IN EFI_HTTP_METHOD          Method,
+  IN CHAR16                   *Url,
+  IN UINTN                    HeaderCount
+  )
+{
+  EFI_STATUS Status;
+
+  Connection->Request.Method       = Method;
+  Connection->Request.Url          = Url;
+  Connection->Message.Data.Request = &Connection->Request;
+  Connection->Message.HeaderCount  = HeaderCount;
+  Connection->Message.Headers      = Connection->RequestHeaders;
+  Connection->Message.BodyLength   = 0;
+  Connection->Message.Body         = NULL;
+  Connection->Token.Status         = EFI_SUCCESS;
+  Connection->Token.Message        = &Connection->Message;
+  Connection->Completed            = FALSE;
+
+  Status = Connection->Http->Request (Connection->Http, &Connection->Token);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  return HttpDownloadWaitToken (Connection);
+}
+
+/**
+  Receive the response status line and headers on a connection.
+
+  The caller owns the returned header array and releases it with
+  HttpFreeHeaderFields().
+
+  @param[in]  Connection    The connection to receive on.
+  @param[out] Headers       The response headers.
+  @param[out] HeaderCount   Number of response headers.
+  @param[out] StatusCode    The response status code.
+
+  @retval EFI_SUCCESS       The response headers were received.
+  @retval Others            An unexpected error occurred.
+
+**/
+EFI_STATUS
+HttpDownloadReceiveHeaders (
+  IN  HTTP_DOWNLOAD_CONNECTION *Connection,
+  OUT EFI_HTTP_HEADER          **Headers,
+  OUT UINTN                    *HeaderCount,
+  OUT EFI_HTTP_STATUS_CODE     *StatusCode
+  )
+{
+  EFI_STATUS Status;
+
+  Connection->Response.StatusCode   = HTTP_STATUS_UNSUPPORTED_STATUS;
+  Connection->Message.Data.Response = &Connection->Response;
+  Connection->Message.HeaderCount   = 0;
+  Connection->Message.Headers       = NULL;
+  Connection->Message.BodyLength    = 0;
+  Connection->Message.Body          = NULL;
+  Connection->Token.Status          = EFI_SUCCESS;
+  Connection->Token.Message         = &Connection->Message;
+  Connection->Completed             = FALSE;
+
+  Status = Connection->Http->Response (Connection->Http, &Connection->Token);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = HttpDownloadWaitToken (Connection);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  *Headers     = Connection->Message.Headers;
+  *HeaderCount = Connection->Message.HeaderCount;
+  *StatusCode  = Connection->Response.StatusCode;
+  return EFI_SUCCESS;
+}
+
+/**
+  Issue the reception of the next body fragment of a connection's slice,
+  directly into its place in the caller's buffer.
+
+  @param[in] Connection    The connection to receive on.
+  @param[in] Buffer        The caller's buffer for the whole resource.
+
+  @retval EFI_SUCCESS      The reception is outstanding.
+  @retval Others           An unexpected error occurred.
+
+**/
+EFI_STATUS
+HttpDownloadReceiveFragment (
+  IN HTTP_DOWNLOAD_CONNECTION *Connection,
+  IN VOID                     *Buffer
+  )
+{
+  Connection->Message.Data.Response = NULL;
+  Connection->Message.HeaderCount   = 0;
+  Connection->Message.Headers       = NULL;
+  Connection->Message.BodyLength    = (UINTN) (Connection->SliceLength - Connection->Received);
+  Connection->Message.Body          = (UINT8 *) Buffer + Connection->SliceStart + Connection->Received;
+  Connection->Token.Status          = EFI_SUCCESS;
+  Connection->Token.Message         = &Connection->Message;
+  Connection->Completed             = FALSE;
+
+  return Connection->Http->Response (Connection->Http, &Connection->Token);
+}
+
+/**
+  Download a resource into the caller's buffer.
+
+  @param[in]      This          Pointer to this protocol instance.
+  @param[in]      Controller    Handle carrying the HTTP service binding to
+                                download through.
+  @param[in]      Url           Null-terminated URL of the resource.
+  @param[out]     Buffer        Buffer receiving the resource. May be NULL to
+                                query the resource size.
+  @param[in, out] BufferSize    On input, the size of Buffer in bytes. On
+                                output, the size of the resource.
+
+  @retval EFI_SUCCESS           The resource was downloaded.
+  @retval EFI_BUFFER_TOO_SMALL  Buffer is NULL or too small; BufferSize holds
+                                the required size.
+  @retval EFI_INVALID_PARAMETER Url or BufferSize is NULL.
+  @retval EFI_DEVICE_ERROR      A transfer failed.
+  @retval Others                An unexpected error occurred.
+
+**/
+EFI_STATUS
+EFIAPI
+HttpDownloadAcceleratorDownload (
+  IN     EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL *This,
+  IN     EFI_HANDLE                               Controller,
+  IN     CHAR16                                   *Url,
+  OUT    VOID                                     *Buffer OPTIONAL,
+  IN OUT UINTN                                    *BufferSize
+  )
+{
+  EFI_STATUS                   Status;
+  EFI_SERVICE_BINDING_PROTOCOL *ServiceBinding;
+  HTTP_DOWNLOAD_CONNECTION     Connections[HTTP_DOWNLOAD_MAX_CONNECTIONS];
+  HTTP_DOWNLOAD_CONNECTION     *Connection;
+  EFI_HTTP_HEADER              *Headers;
+  EFI_HTTP_HEADER              *Header;
+  UINTN                        HeaderCount;
+  EFI_HTTP_STATUS_CODE         StatusCode;
+  CHAR8                        *AsciiUrl;
+  CHAR8                        *HostName;
+  VOID                         *UrlParser;
+  UINT64                       ContentLength;
+  BOOLEAN                      AcceptRanges;
+  UINTN                        NumConnections;
+  UINTN                        Created;
+  UINTN                        Index;
+  UINTN                        Remaining;
+  UINTN                        Idle;
+  UINT64                       SliceSize;
+  BOOLEAN                      Progress;
+
+  if ((Url == NULL) || (BufferSize == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  AsciiUrl  = NULL;
+  HostName  = NULL;
+  UrlParser = NULL;
+  Created   = 0;
+
+  Status = gBS->OpenProtocol (
+                  Controller,
+                  &gEfiHttpServiceBindingProtocolGuid,
+                  (VOID **) &ServiceBinding,
+                  gImageHandle,
+                  NULL,
+                  EFI_OPEN_PROTOCOL_GET_PROTOCOL
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // The Host request header is built from the URL.
+  //
+  AsciiUrl = AllocatePool (StrLen (Url) + 1);
+  if (AsciiUrl == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  UnicodeStrToAsciiStrS (Url, AsciiUrl, StrLen (Url) + 1);
+  Status = HttpParseUrl (AsciiUrl, (UINT32) AsciiStrLen (AsciiUrl), FALSE, &UrlParser);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+  Status = HttpUrlGetHostName (AsciiUrl, UrlParser, &HostName);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+
+  NumConnections = PcdGet8 (PcdHttpDownloadMaxConnections);
+  if (NumConnections == 0) {
+    NumConnections = 1;
+  }
+  if (NumConnections > HTTP_DOWNLOAD_MAX_CONNECTIONS) {
+    NumConnections = HTTP_DOWNLOAD_MAX_CONNECTIONS;
+  }
+
+  Status = HttpDownloadCreateConnection (ServiceBinding, &Connections[0]);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+  Created = 1;
+
+  //
+  // Learn the resource size and whether the server takes range requests.
+  //
+  Connection = &Connections[0];
+  Connection->RequestHeaders[0].FieldName  = "Host";
+  Connection->RequestHeaders[0].FieldValue = HostName;
+  Status = HttpDownloadSendRequest (Connection, HttpMethodHead, Url, 1);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+  Status = HttpDownloadReceiveHeaders (Connection, &Headers, &HeaderCount, &StatusCode);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+  if (StatusCode != HTTP_STATUS_200_OK) {
+    DEBUG ((DEBUG_ERROR, "HttpDownload: HEAD failed with HTTP status %d\n", StatusCode));
+    HttpFreeHeaderFields (Headers, HeaderCount);
+    Status = EFI_DEVICE_ERROR;
+    goto Done;
+  }
+
+  ContentLength = 0;
+  AcceptRanges  = FALSE;
+  Header = HttpFindHeader (HeaderCount, Headers, "Content-Length");
+  if (Header != NULL) {
+    ContentLength = AsciiStrDecimalToUint64 (Header->FieldValue);
+  }
+  Header = HttpFindHeader (HeaderCount, Headers, "Accept-Ranges");
+  if ((Header != NULL) && (AsciiStrStr (Header->FieldValue, "bytes") != NULL)) {
+    AcceptRanges = TRUE;
+  }
+  HttpFreeHeaderFields (Headers, HeaderCount);
+
+  if (ContentLength == 0) {
+    Status = EFI_DEVICE_ERROR;
+    goto Done;
+  }
+  if ((Buffer == NULL) || (*BufferSize < ContentLength)) {
+    *BufferSize = (UINTN) ContentLength;
+    Status = EFI_BUFFER_TOO_SMALL;
+    goto Done;
+  }
+  *BufferSize = (UINTN) ContentLength;
+
+  //
+  // Small resources and servers without range support get one full GET.
+  //
+  if (!AcceptRanges || (ContentLength < PcdGet32 (PcdHttpDownloadMinRangeSize))) {
+    NumConnections = 1;
+  }
+
+  for (Index = Created; Index < NumConnections; Index++) {
+    Status = HttpDownloadCreateConnection (ServiceBinding, &Connections[Index]);
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
+    Created++;
+  }
+
+  //
+  // Carve the resource into one contiguous slice per connection and start
+  // every transfer; response bodies land straight in the caller's buffer.
+  //
+  SliceSize = ContentLength / NumConnections;
+  for (Index = 0; Index < NumConnections; Index++) {
+    Connection = &Connections[Index];
+    Connection->SliceStart  = SliceSize * Index;
+    Connection->SliceLength = (Index == NumConnections - 1) ?
+                              (ContentLength - Connection->SliceStart) : SliceSize;
+    Connection->Received    = 0;
+    Connection->Finished    = FALSE;
+
+    Connection->RequestHeaders[0].FieldName  = "Host";
+    Connection->RequestHeaders[0].FieldValue = HostName;
+    HeaderCount = 1;
+    if (NumConnections > 1) {
+      AsciiSPrint (
+        Connection->RangeValue,
+        sizeof (Connection->RangeValue),
+        "bytes=%Lu-%Lu",
+        Connection->SliceStart,
+        Connection->SliceStart + Connection->SliceLength - 1
+        );
+      Connection->RequestHeaders[1].FieldName  = "Range";
+      Connection->RequestHeaders[1].FieldValue = Connection->RangeValue;
+      HeaderCount = 2;
+    }
+
+    Status = HttpDownloadSendRequest (Connection, HttpMethodGet, Url, HeaderCount);
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
+    Status = HttpDownloadReceiveHeaders (Connection, &Headers, &HeaderCount, &StatusCode);
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
+    HttpFreeHeaderFields (Headers, HeaderCount);
+    if (((NumConnections > 1) && (StatusCode != HTTP_STATUS_206_PARTIAL_CONTENT)) ||
+        ((NumConnections == 1) && (StatusCode != HTTP_STATUS_200_OK))) {
+      DEBUG ((DEBUG_ERROR, "HttpDownload: GET failed with HTTP status %d\n", StatusCode));
+      Status = EFI_DEVICE_ERROR;
+      goto Done;
+    }
+
+    Status = HttpDownloadReceiveFragment (Connection, Buffer);
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
+  }
+
+  //
+  // Service all connections until every slice is complete; a connection
+  // whose fragment finished immediately gets the next one issued so the
+  // streams stay in flight together.
+  //
+  Remaining = NumConnections;
+  Idle      = 0;
+  while (Remaining != 0) {
+    Progress = FALSE;
+    for (Index = 0; Index < NumConnections; Index++) {
+      Connection = &Connections[Index];
+      if (Connection->Finished) {
+        continue;
+      }
+      Connection->Http->Poll (Connection->Http);
+      if (!Connection->Completed) {
+        continue;
+      }
+      Progress = TRUE;
+      if (EFI_ERROR (Connection->Token.Status)) {
+        Status = Connection->Token.Status;
+        goto Done;
+      }
+      if (Connection->Message.BodyLength == 0) {
+        //
+        // The server closed the stream before the slice was complete.
+        //
+        Status = EFI_DEVICE_ERROR;
+        goto Done;
+      }
+      Connection->Received += Connection->Message.BodyLength;
+      if (Connection->Received >= Connection->SliceLength) {
+        Connection->Finished = TRUE;
+        Remaining--;
+        continue;
+      }
+      Status = HttpDownloadReceiveFragment (Connection, Buffer);
+      if (EFI_ERROR (Status)) {
+        goto Done;
+      }
+    }
+    if (Progress) {
+      Idle = 0;
+    } else {
+      if (++Idle >= HTTP_DOWNLOAD_TIMEOUT) {
+        Status = EFI_TIMEOUT;
+        goto Done;
+      }
+      gBS->Stall (HTTP_DOWNLOAD_POLL_INTERVAL);
+    }
+  }
+
+  Status = EFI_SUCCESS;
+
+Done:
+  for (Index = 0; Index < Created; Index++) {
+    HttpDownloadDestroyConnection (ServiceBinding, &Connections[Index]);
+  }
+  if (HostName != NULL) {
+    FreePool (HostName);
+  }
+  if (UrlParser != NULL) {
+    HttpUrlFreeParser (UrlParser);
+  }
+  if (AsciiUrl != NULL) {
+    FreePool (AsciiUrl);
+  }
+  return Status;
+}
+
+/**
+  Entrypoint of this module, installs the HTTP download accelerator
+  protocol.
+
+  @param[in] ImageHandle    The firmware allocated handle for the EFI image.
+  @param[in] SystemTable    A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS       The protocol was installed.
+
+**/
+EFI_STATUS
+EFIAPI
+HttpDownloadAcceleratorEntryPoint (
+  IN EFI_HANDLE       ImageHandle,
+  IN EFI_SYSTEM_TABLE *SystemTable
+  )
+{
+  return gBS->InstallMultipleProtocolInterfaces (
+                &ImageHandle,
+                &gEdkiiHttpDownloadAcceleratorProtocolGuid,
+                &mHttpDownloadAccelerator,
+                NULL
+                );
+}
@@ -0,0 +1,90 @@
+/** @file
+  Header file for the HTTP download accelerator driver.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _HTTP_DOWNLOAD_ACCELERATOR_DXE_H_
+#define _HTTP_DOWNLOAD_ACCELERATOR_DXE_H_
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/HttpLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/PrintLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Protocol/Http.h>
+#include <Protocol/ServiceBinding.h>
+#include <Protocol/HttpDownloadAccelerator.h>
+
+///
+/// Upper bound on concurrent connections regardless of the PCD
+///
+#define HTTP_DOWNLOAD_MAX_CONNECTIONS   8
+
+///
+/// Interval between polls of the HTTP instances, in microseconds
+///
+#define HTTP_DOWNLOAD_POLL_INTERVAL     100
+
+///
+/// Time without any token completing before the transfer is abandoned,
+/// in poll intervals
+///
+#define HTTP_DOWNLOAD_TIMEOUT           (10000000 / HTTP_DOWNLOAD_POLL_INTERVAL)
+
+///
+/// One HTTP connection downloading a contiguous slice of the resource
+///
+typedef struct {
+  EFI_HTTP_PROTOCOL       *Http;
+  EFI_HANDLE              ChildHandle;
+  EFI_HTTP_TOKEN          Token;
+  EFI_HTTP_MESSAGE        Message;
+  EFI_HTTP_REQUEST_DATA   Request;
+  EFI_HTTP_RESPONSE_DATA  Response;
+  EFI_HTTP_HEADER         RequestHeaders[2];
+  CHAR8                   RangeValue[48];
+  BOOLEAN                 Completed;
+  BOOLEAN                 Finished;
+  UINT64                  SliceStart;
+  UINT64                  SliceLength;
+  UINT64                  Received;
+} HTTP_DOWNLOAD_CONNECTION;
+
+/**
+  Download a resource into the caller's buffer.
+
+  @param[in]      This          Pointer to this protocol instance.
+  @param[in]      Controller    Handle carrying the HTTP service binding to
+                                download through.
+  @param[in]      Url           Null-terminated URL of the resource.
+  @param[out]     Buffer        Buffer receiving the resource. May be NULL to
+                                query the resource size.
+  @param[in, out] BufferSize    On input, the size of Buffer in bytes. On
+                                output, the size of the resource.
+
+  @retval EFI_SUCCESS           The resource was downloaded.
+  @retval EFI_BUFFER_TOO_SMALL  Buffer is NULL or too small; BufferSize holds
+                                the required size.
+  @retval EFI_INVALID_PARAMETER Url or BufferSize is NULL.
+  @retval EFI_DEVICE_ERROR      A transfer failed.
+  @retval Others                An unexpected error occurred.
+
+**/
+EFI_STATUS
+EFIAPI
+HttpDownloadAcceleratorDownload (
+  IN     EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL *This,
+  IN     EFI_HANDLE                               Controller,
+  IN     CHAR16                                   *Url,
+  OUT    VOID                                     *Buffer OPTIONAL,
+  IN OUT UINTN                                    *BufferSize
+  );
+
+#endif
@@ -0,0 +1,69 @@
+/** @file
+  HTTP download accelerator protocol.
+
+  Downloads a resource over HTTP using ranged requests on several
+  concurrent connections, placing the response bodies directly into the
+  caller's buffer. Falls back to a single full GET when the server does
+  not advertise byte-range support.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _HTTP_DOWNLOAD_ACCELERATOR_H_
+#define _HTTP_DOWNLOAD_ACCELERATOR_H_
+
+#define EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL_GUID \
+  { \
+    0xdc0e8032, 0xf5f9, 0x4136, { 0x9b, 0x24, 0x24, 0x30, 0x60, 0xe5, 0xcc, 0x32 } \
+  }
+
+typedef struct _EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL;
+
+/**
+  Download a resource into the caller's buffer.
+
+  The resource size is learned with a HEAD request first. When the caller's
+  buffer is absent or too small the required size is returned in BufferSize
+  and no transfer takes place, so the caller can allocate the final load
+  buffer once and have the response bodies land in it without an
+  intermediate copy.
+
+  @param[in]      This          Pointer to this protocol instance.
+  @param[in]      Controller    Handle carrying the HTTP service binding to
+                                download through.
+  @param[in]      Url           Null-terminated URL of the resource.
+  @param[out]     Buffer        Buffer receiving the resource. May be NULL to
+                                query the resource size.
+  @param[in, out] BufferSize    On input, the size of Buffer in bytes. On
+                                output, the size of the resource.
+
+  @retval EFI_SUCCESS           The resource was downloaded.
+  @retval EFI_BUFFER_TOO_SMALL  Buffer is NULL or too small; BufferSize holds
+                                the required size.
+  @retval EFI_INVALID_PARAMETER Url or BufferSize is NULL.
+  @retval EFI_DEVICE_ERROR      A transfer failed.
+  @retval Others                An unexpected error occurred.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_HTTP_DOWNLOAD_ACCELERATOR_DOWNLOAD) (
+  IN     EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL *This,
+  IN     EFI_HANDLE                               Controller,
+  IN     CHAR16                                   *Url,
+  OUT    VOID                                     *Buffer OPTIONAL,
+  IN OUT UINTN                                    *BufferSize
+  );
+
+///
+/// Accelerated HTTP download service.
+///
+struct _EDKII_HTTP_DOWNLOAD_ACCELERATOR_PROTOCOL {
+  EDKII_HTTP_DOWNLOAD_ACCELERATOR_DOWNLOAD Download;
+};
+
+extern EFI_GUID gEdkiiHttpDownloadAcceleratorProtocolGuid;
+
+#endif
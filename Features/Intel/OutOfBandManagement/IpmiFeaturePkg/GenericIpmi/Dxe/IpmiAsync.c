@@ -0,0 +1,689 @@
+/** @file
+  Asynchronous KCS transaction engine.
+
+  Commands are queued and driven to completion by a periodic timer whose
+  callback advances a non-blocking state machine through the KCS write and
+  read phases. Each timer tick performs at most a bounded number of status
+  register polls and never stalls, so BMC traffic overlaps with the rest of
+  DXE. Completion callbacks deliver the response and the measured latency,
+  and cumulative latency counters are kept for fleet debugging.
+
+  The synchronous transport protocol keeps working: its submit entry is
+  interposed so a synchronous command first finishes whatever transaction
+  the engine has on the wire.
+
+  @copyright
+  Copyright 2021 Intel Corporation. <BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include "IpmiAsync.h"
+#include <Protocol/IpmiAsyncTransportProtocol.h>
+
+//
+// From IpmiBmc.c; used to keep the soft error accounting of the synchronous
+// path for completion codes returned on the asynchronous one.
+//
+EFI_STATUS
+UpdateErrorStatus (
+  IN UINT8                      BmcError,
+  IPMI_BMC_INSTANCE_DATA        *IpmiInstance
+  );
+
+#define IPMI_ASYNC_QUEUE_DEPTH    16
+#define IPMI_ASYNC_TIMER_PERIOD   (100 * 10)  // [100ns] 100 us between ticks
+#define IPMI_ASYNC_POLL_BUDGET    256         // Status polls allowed per tick
+#define IPMI_ASYNC_TPL            TPL_NOTIFY
+
+//
+// Phases of the non-blocking KCS state machine. The write phases mirror
+// SendDataToBmc () and the read phases mirror ReceiveBmcData (); every
+// blocking IBF/OBF wait of the synchronous code is a phase re-entry here.
+//
+typedef enum {
+  KcsPhaseIdle,
+  KcsPhaseWriteStart,
+  KcsPhaseWriteCheck,
+  KcsPhaseReadCheck,
+  KcsPhaseReadObf
+} KCS_ASYNC_PHASE;
+
+typedef struct {
+  BOOLEAN                Valid;
+  UINT8                  Request[MAX_TEMP_DATA];
+  UINT8                  RequestSize;
+  IPMI_ASYNC_COMPLETION  Completion;
+  VOID                   *UserContext;
+  UINT64                 SubmitTick;
+} IPMI_ASYNC_REQUEST;
+
+typedef struct {
+  IPMI_BMC_INSTANCE_DATA  *IpmiInstance;
+  IPMI_ASYNC_TRANSPORT    AsyncTransport;
+  IPMI_SEND_COMMAND       SyncSubmit;
+  EFI_EVENT               TimerEvent;
+  EFI_EVENT               ExitBootServicesEvent;
+  //
+  // Request ring.
+  //
+  IPMI_ASYNC_REQUEST      Queue[IPMI_ASYNC_QUEUE_DEPTH];
+  UINTN                   QueueHead;
+  UINTN                   QueueTail;
+  //
+  // State of the transaction on the wire.
+  //
+  KCS_ASYNC_PHASE         Phase;
+  UINT8                   ByteIndex;
+  BOOLEAN                 WroteEndCmd;
+  BOOLEAN                 ExtraCheck;
+  BOOLEAN                 IdleExit;
+  UINT8                   Response[MAX_TEMP_DATA];
+  UINT8                   ResponseCount;
+  UINT64                  PhaseStartTick;
+  //
+  // Counters.
+  //
+  IPMI_ASYNC_STATISTICS   Statistics;
+} IPMI_ASYNC_ENGINE;
+
+STATIC IPMI_ASYNC_ENGINE  mAsyncEngine;
+
+/**
+  Converts a performance counter tick delta to microseconds.
+
+  @param[in] Ticks  Tick delta measured with GetPerformanceCounter ().
+
+  @return The delta in microseconds.
+**/
+STATIC
+UINT64
+IpmiAsyncTicksToUs (
+  IN UINT64  Ticks
+  )
+{
+  UINT64  Frequency;
+
+  Frequency = GetPerformanceCounterProperties (NULL, NULL);
+  if (Frequency == 0) {
+    return 0;
+  }
+  return DivU64x64Remainder (MultU64x32 (Ticks, 1000000), Frequency, NULL);
+}
+
+/**
+  Checks whether the transaction has been stuck in the current phase longer
+  than the synchronous KCS timeout.
+
+  @retval TRUE   The phase timed out.
+  @retval FALSE  Still within the timeout.
+**/
+STATIC
+BOOLEAN
+IpmiAsyncPhaseTimedOut (
+  VOID
+  )
+{
+  return (BOOLEAN) (IpmiAsyncTicksToUs (GetPerformanceCounter () - mAsyncEngine.PhaseStartTick) >
+                    (UINT64) BMC_KCS_TIMEOUT * 1000 * 1000);
+}
+
+/**
+  Completes the request at the head of the queue.
+
+  Updates the counters, reports the latency and hands the response to the
+  completion callback. The engine returns to idle; the caller decides when
+  the next queued request is started.
+
+  @param[in] Status  Final status of the transaction.
+**/
+STATIC
+VOID
+IpmiAsyncCompleteRequest (
+  IN EFI_STATUS  Status
+  )
+{
+  IPMI_ASYNC_REQUEST  *Request;
+  IPMI_RESPONSE       *IpmiResponse;
+  UINT8               CallbackData[MAX_TEMP_DATA];
+  UINT8               CallbackSize;
+  UINT64              LatencyUs;
+
+  Request = &mAsyncEngine.Queue[mAsyncEngine.QueueHead];
+  mAsyncEngine.Phase = KcsPhaseIdle;
+
+  CallbackSize = 0;
+  if (!EFI_ERROR (Status)) {
+    IpmiResponse = (IPMI_RESPONSE *) mAsyncEngine.Response;
+    if (mAsyncEngine.ResponseCount < IPMI_RESPONSE_HEADER_SIZE) {
+      Status = EFI_DEVICE_ERROR;
+    } else {
+      if (IpmiResponse->CompletionCode != COMP_CODE_NORMAL) {
+        UpdateErrorStatus (IpmiResponse->CompletionCode, mAsyncEngine.IpmiInstance);
+      }
+      //
+      // Completion code first, then the response data, like the synchronous
+      // transport returns it.
+      //
+      CallbackData[0] = IpmiResponse->CompletionCode;
+      CallbackSize    = (UINT8) (mAsyncEngine.ResponseCount - IPMI_RESPONSE_HEADER_SIZE + 1);
+      CopyMem (&CallbackData[1], IpmiResponse->ResponseData, CallbackSize - 1);
+    }
+  }
+
+  if (EFI_ERROR (Status)) {
+    mAsyncEngine.IpmiInstance->BmcStatus = BMC_SOFTFAIL;
+    mAsyncEngine.IpmiInstance->SoftErrorCount++;
+    mAsyncEngine.Statistics.ErrorCount++;
+  }
+
+  LatencyUs = IpmiAsyncTicksToUs (GetPerformanceCounter () - Request->SubmitTick);
+  mAsyncEngine.Statistics.CompletedCount++;
+  mAsyncEngine.Statistics.TotalLatencyUs += LatencyUs;
+  mAsyncEngine.Statistics.LastLatencyUs   = LatencyUs;
+  if (LatencyUs > mAsyncEngine.Statistics.MaxLatencyUs) {
+    mAsyncEngine.Statistics.MaxLatencyUs = LatencyUs;
+  }
+  DEBUG ((DEBUG_INFO, "[IPMI] async NetFn 0x%02x Cmd 0x%02x: %r, %ld us\n",
+          ((IPMI_COMMAND *) Request->Request)->NetFunction,
+          ((IPMI_COMMAND *) Request->Request)->Command,
+          Status, LatencyUs));
+
+  //
+  // Free the slot before the callback so the callback may submit again.
+  //
+  Request->Valid = FALSE;
+  mAsyncEngine.QueueHead = (mAsyncEngine.QueueHead + 1) % IPMI_ASYNC_QUEUE_DEPTH;
+
+  if (Request->Completion != NULL) {
+    Request->Completion (Status, CallbackData, CallbackSize, LatencyUs, Request->UserContext);
+  }
+}
+
+/**
+  Starts the request at the head of the queue on the wire.
+**/
+STATIC
+VOID
+IpmiAsyncStartRequest (
+  VOID
+  )
+{
+  mAsyncEngine.Phase          = KcsPhaseWriteStart;
+  mAsyncEngine.ByteIndex      = 0;
+  mAsyncEngine.WroteEndCmd    = FALSE;
+  mAsyncEngine.ExtraCheck     = FALSE;
+  mAsyncEngine.IdleExit       = FALSE;
+  mAsyncEngine.ResponseCount  = 0;
+  mAsyncEngine.PhaseStartTick = GetPerformanceCounter ();
+}
+
+/**
+  Advances the KCS state machine by one micro step without waiting.
+
+  Each micro step is one of the IBF/OBF gated actions of the synchronous
+  handshake. When the gate is closed the function returns without progress
+  and the same step is retried on a later poll or tick.
+
+  @param[out] Done    TRUE when the transaction finished; status in *Status.
+  @param[out] Status  Final status, only valid when Done is TRUE.
+
+  @retval TRUE   Progress was made.
+  @retval FALSE  Blocked on the status register; try again later.
+**/
+STATIC
+BOOLEAN
+IpmiAsyncStep (
+  OUT BOOLEAN     *Done,
+  OUT EFI_STATUS  *Status
+  )
+{
+  IPMI_ASYNC_REQUEST  *Request;
+  KCS_STATUS          KcsStatus;
+  UINT16              KcsPort;
+
+  *Done   = FALSE;
+  *Status = EFI_SUCCESS;
+  Request = &mAsyncEngine.Queue[mAsyncEngine.QueueHead];
+  KcsPort = mAsyncEngine.IpmiInstance->IpmiIoBase;
+
+  KcsStatus.RawData = IoRead8 (KcsPort + 1);
+  if (KcsStatus.RawData == 0xFF) {
+    *Done   = TRUE;
+    *Status = EFI_DEVICE_ERROR;
+    return TRUE;
+  }
+
+  switch (mAsyncEngine.Phase) {
+    case KcsPhaseWriteStart:
+      if (KcsStatus.Status.Ibf) {
+        return FALSE;
+      }
+      IoWrite8 (KcsPort + 1, KCS_WRITE_START);
+      //
+      // The synchronous path checks the write state twice before the first
+      // data byte; mirror that with one extra pass through WriteCheck.
+      //
+      mAsyncEngine.ExtraCheck     = TRUE;
+      mAsyncEngine.Phase          = KcsPhaseWriteCheck;
+      mAsyncEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    case KcsPhaseWriteCheck:
+      if (KcsStatus.Status.Ibf) {
+        return FALSE;
+      }
+      //
+      // Drain the dummy byte the BMC leaves in the data register, exactly
+      // like KcsCheckStatus () does for the write state.
+      //
+      IoRead8 (KcsPort);
+      if (KcsStatus.Status.State != KcsWriteState) {
+        *Done   = TRUE;
+        *Status = EFI_DEVICE_ERROR;
+        return TRUE;
+      }
+      if (mAsyncEngine.ExtraCheck) {
+        mAsyncEngine.ExtraCheck = FALSE;
+      } else if ((mAsyncEngine.ByteIndex == Request->RequestSize - 1) && !mAsyncEngine.WroteEndCmd) {
+        IoWrite8 (KcsPort + 1, KCS_WRITE_END);
+        mAsyncEngine.WroteEndCmd = TRUE;
+      } else {
+        IoWrite8 (KcsPort, Request->Request[mAsyncEngine.ByteIndex]);
+        mAsyncEngine.ByteIndex++;
+        if (mAsyncEngine.ByteIndex == Request->RequestSize) {
+          mAsyncEngine.Phase = KcsPhaseReadCheck;
+        }
+      }
+      mAsyncEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    case KcsPhaseReadCheck:
+      if (KcsStatus.Status.Ibf) {
+        return FALSE;
+      }
+      if (KcsStatus.Status.State == KcsReadState) {
+        mAsyncEngine.IdleExit = FALSE;
+      } else if (KcsStatus.Status.State == KcsIdleState) {
+        mAsyncEngine.IdleExit = TRUE;
+      } else {
+        *Done   = TRUE;
+        *Status = EFI_DEVICE_ERROR;
+        return TRUE;
+      }
+      mAsyncEngine.Phase          = KcsPhaseReadObf;
+      mAsyncEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    case KcsPhaseReadObf:
+      if (!KcsStatus.Status.Obf) {
+        return FALSE;
+      }
+      if (mAsyncEngine.IdleExit) {
+        //
+        // Dummy read that terminates the transaction.
+        //
+        IoRead8 (KcsPort);
+        *Done   = TRUE;
+        *Status = EFI_SUCCESS;
+        return TRUE;
+      }
+      if (mAsyncEngine.ResponseCount >= MAX_TEMP_DATA - 1) {
+        *Done   = TRUE;
+        *Status = EFI_DEVICE_ERROR;
+        return TRUE;
+      }
+      mAsyncEngine.Response[mAsyncEngine.ResponseCount] = IoRead8 (KcsPort);
+      mAsyncEngine.ResponseCount++;
+      IoWrite8 (KcsPort, KCS_READ);
+      mAsyncEngine.Phase          = KcsPhaseReadCheck;
+      mAsyncEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    default:
+      break;
+  }
+
+  return FALSE;
+}
+
+/**
+  Runs the engine until it blocks or the poll budget is used up.
+
+  Started transactions complete, their callbacks run, and the next queued
+  request is put on the wire, all within the budget.
+**/
+STATIC
+VOID
+IpmiAsyncPump (
+  VOID
+  )
+{
+  UINTN       Budget;
+  BOOLEAN     Done;
+  EFI_STATUS  Status;
+
+  for (Budget = 0; Budget < IPMI_ASYNC_POLL_BUDGET; Budget++) {
+    if (mAsyncEngine.Phase == KcsPhaseIdle) {
+      if (mAsyncEngine.QueueHead == mAsyncEngine.QueueTail) {
+        return;
+      }
+      IpmiAsyncStartRequest ();
+    }
+    if (!IpmiAsyncStep (&Done, &Status)) {
+      //
+      // Blocked. Give up on the transaction when it has been stuck longer
+      // than the synchronous timeout; the abort sequence is bounded, so the
+      // blocking error exit of the synchronous path is reused.
+      //
+      if (IpmiAsyncPhaseTimedOut ()) {
+        KcsErrorExit (
+          mAsyncEngine.IpmiInstance->KcsTimeoutPeriod,
+          mAsyncEngine.IpmiInstance->IpmiIoBase,
+          NULL
+          );
+        IpmiAsyncCompleteRequest (EFI_TIMEOUT);
+        continue;
+      }
+      return;
+    }
+    if (Done) {
+      if (EFI_ERROR (Status)) {
+        KcsErrorExit (
+          mAsyncEngine.IpmiInstance->KcsTimeoutPeriod,
+          mAsyncEngine.IpmiInstance->IpmiIoBase,
+          NULL
+          );
+      }
+      IpmiAsyncCompleteRequest (Status);
+    }
+  }
+}
+
+/**
+  Periodic timer callback driving the engine.
+
+  @param[in] Event    The timer event.
+  @param[in] Context  Not used.
+**/
+STATIC
+VOID
+EFIAPI
+IpmiAsyncTimerTick (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  IpmiAsyncPump ();
+}
+
+/**
+  Drives the engine synchronously until the wire is idle and the queue is
+  empty. Must be called at or below the engine TPL.
+**/
+STATIC
+VOID
+IpmiAsyncDrain (
+  VOID
+  )
+{
+  while ((mAsyncEngine.Phase != KcsPhaseIdle) ||
+         (mAsyncEngine.QueueHead != mAsyncEngine.QueueTail)) {
+    IpmiAsyncPump ();
+    if ((mAsyncEngine.Phase != KcsPhaseIdle) ||
+        (mAsyncEngine.QueueHead != mAsyncEngine.QueueTail)) {
+      MicroSecondDelay (KCS_DELAY_UNIT);
+    }
+  }
+}
+
+/**
+  Queues an IPMI command for asynchronous execution.
+
+  @param[in] This             Pointer to the async transport instance.
+  @param[in] NetFunction      Net Function of command to send.
+  @param[in] Lun              LUN of command to send.
+  @param[in] Command          IPMI command to send.
+  @param[in] CommandData      Pointer to command data buffer, if needed.
+  @param[in] CommandDataSize  Size of command data buffer.
+  @param[in] Completion       Callback invoked when the command completes.
+  @param[in] UserContext      Context handed back to the callback.
+
+  @retval EFI_SUCCESS            The command was queued.
+  @retval EFI_INVALID_PARAMETER  One of the input values is bad.
+  @retval EFI_NOT_READY          The queue is full; retry after completions.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+IpmiAsyncSubmitCommand (
+  IN IPMI_ASYNC_TRANSPORT   *This,
+  IN UINT8                  NetFunction,
+  IN UINT8                  Lun,
+  IN UINT8                  Command,
+  IN UINT8                  *CommandData,
+  IN UINT8                  CommandDataSize,
+  IN IPMI_ASYNC_COMPLETION  Completion,
+  IN VOID                   *UserContext
+  )
+{
+  IPMI_ASYNC_REQUEST  *Request;
+  IPMI_COMMAND        *IpmiCommand;
+  UINTN               NextTail;
+  EFI_TPL             OldTpl;
+
+  if ((CommandDataSize > 0) && (CommandData == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+  if (CommandDataSize > MAX_TEMP_DATA - IPMI_COMMAND_HEADER_SIZE) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (IPMI_ASYNC_TPL);
+
+  NextTail = (mAsyncEngine.QueueTail + 1) % IPMI_ASYNC_QUEUE_DEPTH;
+  if (NextTail == mAsyncEngine.QueueHead) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_NOT_READY;
+  }
+
+  Request = &mAsyncEngine.Queue[mAsyncEngine.QueueTail];
+  IpmiCommand              = (IPMI_COMMAND *) Request->Request;
+  IpmiCommand->Lun         = Lun;
+  IpmiCommand->NetFunction = NetFunction;
+  IpmiCommand->Command     = Command;
+  if (CommandDataSize > 0) {
+    CopyMem (IpmiCommand->CommandData, CommandData, CommandDataSize);
+  }
+  Request->RequestSize = (UINT8) (CommandDataSize + IPMI_COMMAND_HEADER_SIZE);
+  Request->Completion  = Completion;
+  Request->UserContext = UserContext;
+  Request->SubmitTick  = GetPerformanceCounter ();
+  Request->Valid       = TRUE;
+
+  mAsyncEngine.QueueTail = NextTail;
+  mAsyncEngine.Statistics.SubmittedCount++;
+
+  gBS->RestoreTPL (OldTpl);
+  return EFI_SUCCESS;
+}
+
+/**
+  Completes all queued commands before returning.
+
+  @param[in] This  Pointer to the async transport instance.
+
+  @retval EFI_SUCCESS  The queue is empty and the interface is idle.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+IpmiAsyncFlush (
+  IN IPMI_ASYNC_TRANSPORT  *This
+  )
+{
+  EFI_TPL  OldTpl;
+
+  OldTpl = gBS->RaiseTPL (IPMI_ASYNC_TPL);
+  IpmiAsyncDrain ();
+  gBS->RestoreTPL (OldTpl);
+  return EFI_SUCCESS;
+}
+
+/**
+  Returns the cumulative engine counters.
+
+  @param[in]  This        Pointer to the async transport instance.
+  @param[out] Statistics  Receives a copy of the counters.
+
+  @retval EFI_SUCCESS            Counters returned.
+  @retval EFI_INVALID_PARAMETER  Statistics is NULL.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+IpmiAsyncGetStatistics (
+  IN IPMI_ASYNC_TRANSPORT    *This,
+  OUT IPMI_ASYNC_STATISTICS  *Statistics
+  )
+{
+  EFI_TPL  OldTpl;
+
+  if (Statistics == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+  OldTpl = gBS->RaiseTPL (IPMI_ASYNC_TPL);
+  CopyMem (Statistics, &mAsyncEngine.Statistics, sizeof (IPMI_ASYNC_STATISTICS));
+  gBS->RestoreTPL (OldTpl);
+  return EFI_SUCCESS;
+}
+
+/**
+  Synchronous submit interposer.
+
+  Finishes whatever transaction the engine has on the wire before letting
+  the original blocking path use the interface, so the two cannot interleave
+  in the middle of a KCS handshake.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+IpmiAsyncGuardedSyncSubmit (
+  IN IPMI_TRANSPORT  *This,
+  IN UINT8           NetFunction,
+  IN UINT8           Lun,
+  IN UINT8           Command,
+  IN UINT8           *CommandData,
+  IN UINT32          CommandDataSize,
+  OUT UINT8          *ResponseData,
+  OUT UINT32         *ResponseDataSize
+  )
+{
+  EFI_STATUS  Status;
+  EFI_TPL     OldTpl;
+
+  OldTpl = gBS->RaiseTPL (IPMI_ASYNC_TPL);
+  IpmiAsyncDrain ();
+  Status = mAsyncEngine.SyncSubmit (
+             This,
+             NetFunction,
+             Lun,
+             Command,
+             CommandData,
+             CommandDataSize,
+             ResponseData,
+             ResponseDataSize
+             );
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+/**
+  Exit boot services callback; drains the queue and stops the timer so no
+  tick fires after the OS owns the platform.
+
+  @param[in] Event    The exit boot services event.
+  @param[in] Context  Not used.
+**/
+STATIC
+VOID
+EFIAPI
+IpmiAsyncExitBootServices (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  IpmiAsyncDrain ();
+  gBS->SetTimer (mAsyncEngine.TimerEvent, TimerCancel, 0);
+}
+
+/**
+  Sets up the asynchronous KCS transaction engine on top of an initialized
+  BMC instance and installs the IPMI async transport protocol.
+
+  @param[in] IpmiInstance  The initialized BMC instance the engine drives.
+
+  @retval EFI_SUCCESS  The engine is running and the protocol is installed.
+  @retval Other        Event creation or protocol installation failed.
+**/
+EFI_STATUS
+IpmiAsyncInitialize (
+  IN IPMI_BMC_INSTANCE_DATA  *IpmiInstance
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  Handle;
+
+  mAsyncEngine.IpmiInstance = IpmiInstance;
+  mAsyncEngine.Phase        = KcsPhaseIdle;
+
+  mAsyncEngine.AsyncTransport.SubmitCommand = IpmiAsyncSubmitCommand;
+  mAsyncEngine.AsyncTransport.Flush         = IpmiAsyncFlush;
+  mAsyncEngine.AsyncTransport.GetStatistics = IpmiAsyncGetStatistics;
+
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  IPMI_ASYNC_TPL,
+                  IpmiAsyncTimerTick,
+                  NULL,
+                  &mAsyncEngine.TimerEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_SIGNAL_EXIT_BOOT_SERVICES,
+                  TPL_NOTIFY,
+                  IpmiAsyncExitBootServices,
+                  NULL,
+                  &mAsyncEngine.ExitBootServicesEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (mAsyncEngine.TimerEvent);
+    return Status;
+  }
+
+  Status = gBS->SetTimer (mAsyncEngine.TimerEvent, TimerPeriodic, IPMI_ASYNC_TIMER_PERIOD);
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (mAsyncEngine.ExitBootServicesEvent);
+    gBS->CloseEvent (mAsyncEngine.TimerEvent);
+    return Status;
+  }
+
+  //
+  // Interpose the synchronous submit so both paths share the wire safely.
+  //
+  mAsyncEngine.SyncSubmit                    = IpmiInstance->IpmiTransport.IpmiSubmitCommand;
+  IpmiInstance->IpmiTransport.IpmiSubmitCommand = IpmiAsyncGuardedSyncSubmit;
+
+  Handle = NULL;
+  Status = gBS->InstallProtocolInterface (
+                  &Handle,
+                  &gIpmiAsyncTransportProtocolGuid,
+                  EFI_NATIVE_INTERFACE,
+                  &mAsyncEngine.AsyncTransport
+                  );
+  ASSERT_EFI_ERROR (Status);
+
+  return Status;
+}
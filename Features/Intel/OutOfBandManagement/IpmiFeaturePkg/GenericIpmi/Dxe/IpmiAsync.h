@@ -0,0 +1,28 @@
+/** @file
+  Asynchronous KCS transaction engine head file.
+
+  @copyright
+  Copyright 2021 Intel Corporation. <BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _IPMI_ASYNC_H_
+#define _IPMI_ASYNC_H_
+
+#include "IpmiBmc.h"
+
+/**
+  Sets up the asynchronous KCS transaction engine on top of an initialized
+  BMC instance and installs the IPMI async transport protocol.
+
+  @param[in] IpmiInstance  The initialized BMC instance the engine drives.
+
+  @retval EFI_SUCCESS  The engine is running and the protocol is installed.
+  @retval Other        Event creation or protocol installation failed.
+**/
+EFI_STATUS
+IpmiAsyncInitialize (
+  IN IPMI_BMC_INSTANCE_DATA  *IpmiInstance
+  );
+
+#endif
@@ -12,6 +12,7 @@
 #include "IpmiBmcCommon.h"
 #include "IpmiBmc.h"
 #include "IpmiPhysicalLayer.h"
+#include "IpmiAsync.h"
 #include <Library/TimerLib.h>
 #ifdef FAST_VIDEO_SUPPORT
   #include <Protocol/VideoPrint.h>
@@ -444,6 +445,11 @@ InitializeIpmiKcsPhysicalLayer (
                       &mIpmiInstance->IpmiTransport
                       );
       ASSERT_EFI_ERROR (Status);
+
+      //
+      // Start the asynchronous transaction engine on top of the working BMC.
+      //
+      IpmiAsyncInitialize (mIpmiInstance);
     }
 
     return EFI_SUCCESS;
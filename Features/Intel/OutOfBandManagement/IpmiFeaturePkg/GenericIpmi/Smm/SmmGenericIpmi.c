@@ -23,6 +23,7 @@
 #include "IpmiHooks.h"
 #include "IpmiBmcCommon.h"
 #include "IpmiBmc.h"
+#include "SmmIpmiDeferred.h"
 #include <Library/TimerLib.h>
 
 IPMI_BMC_INSTANCE_DATA             *mIpmiInstance;
@@ -191,6 +192,12 @@ Returns:
                       );
     ASSERT_EFI_ERROR (Status);
 
+    //
+    // Start the deferred transaction engine so SMM callers can hand off
+    // commands without stalling inside a single SMM entry.
+    //
+    SmmIpmiDeferredInitialize (mIpmiInstance);
+
     DEBUG ((DEBUG_INFO,"SmmInitializeIpmiKcsPhysicalLayer exit \n"));
 
     return EFI_SUCCESS;
@@ -0,0 +1,727 @@
+/** @file
+  SMM deferred IPMI transaction engine.
+
+  Split-transaction IPMI for SMM. Enqueue returns without touching the KCS
+  interface; the handshake is advanced by a non-blocking state machine that
+  runs for at most PcdIpmiSmmEntryBudgetUs microseconds per SMM entry, from
+  a periodic SMI, from a root SMI handler piggybacking on incidental SMIs,
+  and from explicit Poll calls. A slow BMC therefore costs many short SMM
+  entries instead of one multi-millisecond all-core stall.
+
+  The synchronous SMM transport keeps working: its submit entry is
+  interposed so a synchronous command first finishes whatever transaction
+  the engine has on the wire.
+
+  @copyright
+  Copyright 2021 Intel Corporation. <BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include "SmmIpmiDeferred.h"
+#include <Protocol/SmmIpmiDeferredTransportProtocol.h>
+#include <Protocol/SmmPeriodicTimerDispatch2.h>
+#include <Library/SmmServicesTableLib.h>
+
+//
+// From IpmiBmc.c; used to keep the soft error accounting of the synchronous
+// path for completion codes returned on the deferred one.
+//
+EFI_STATUS
+UpdateErrorStatus (
+  IN UINT8                      BmcError,
+  IPMI_BMC_INSTANCE_DATA        *IpmiInstance
+  );
+
+#define SMM_IPMI_DEFERRED_QUEUE_DEPTH   8
+#define SMM_IPMI_PERIODIC_SMI_PERIOD    160000  // [100ns] 16 ms between SMIs
+
+//
+// Phases of the non-blocking KCS state machine; the same decomposition of
+// SendDataToBmc () and ReceiveBmcData () as the DXE asynchronous engine.
+//
+typedef enum {
+  DeferredPhaseIdle,
+  DeferredPhaseWriteStart,
+  DeferredPhaseWriteCheck,
+  DeferredPhaseReadCheck,
+  DeferredPhaseReadObf
+} SMM_IPMI_DEFERRED_PHASE;
+
+typedef struct {
+  BOOLEAN                Valid;
+  UINT8                  Request[MAX_TEMP_DATA];
+  UINT8                  RequestSize;
+  IPMI_ASYNC_COMPLETION  Completion;
+  VOID                   *UserContext;
+  UINT64                 SubmitTick;
+} SMM_IPMI_DEFERRED_REQUEST;
+
+typedef struct {
+  IPMI_BMC_INSTANCE_DATA       *IpmiInstance;
+  SMM_IPMI_DEFERRED_TRANSPORT  DeferredTransport;
+  IPMI_SEND_COMMAND            SyncSubmit;
+  //
+  // Request ring.
+  //
+  SMM_IPMI_DEFERRED_REQUEST    Queue[SMM_IPMI_DEFERRED_QUEUE_DEPTH];
+  UINTN                        QueueHead;
+  UINTN                        QueueTail;
+  //
+  // State of the transaction on the wire.
+  //
+  SMM_IPMI_DEFERRED_PHASE      Phase;
+  UINT8                        ByteIndex;
+  BOOLEAN                      WroteEndCmd;
+  BOOLEAN                      ExtraCheck;
+  BOOLEAN                      IdleExit;
+  UINT8                        Response[MAX_TEMP_DATA];
+  UINT8                        ResponseCount;
+  UINT64                       PhaseStartTick;
+  //
+  // Counters.
+  //
+  IPMI_ASYNC_STATISTICS        Statistics;
+} SMM_IPMI_DEFERRED_ENGINE;
+
+STATIC SMM_IPMI_DEFERRED_ENGINE  mDeferredEngine;
+
+/**
+  Converts a performance counter tick delta to microseconds.
+
+  @param[in] Ticks  Tick delta measured with GetPerformanceCounter ().
+
+  @return The delta in microseconds.
+**/
+STATIC
+UINT64
+DeferredTicksToUs (
+  IN UINT64  Ticks
+  )
+{
+  UINT64  Frequency;
+
+  Frequency = GetPerformanceCounterProperties (NULL, NULL);
+  if (Frequency == 0) {
+    return 0;
+  }
+  return DivU64x64Remainder (MultU64x32 (Ticks, 1000000), Frequency, NULL);
+}
+
+/**
+  Completes the request at the head of the queue.
+
+  Updates the counters, reports the latency and hands the response to the
+  completion callback. The engine returns to idle; the caller decides when
+  the next queued request is started.
+
+  @param[in] Status  Final status of the transaction.
+**/
+STATIC
+VOID
+DeferredCompleteRequest (
+  IN EFI_STATUS  Status
+  )
+{
+  SMM_IPMI_DEFERRED_REQUEST  *Request;
+  IPMI_RESPONSE              *IpmiResponse;
+  UINT8                      CallbackData[MAX_TEMP_DATA];
+  UINT8                      CallbackSize;
+  UINT64                     LatencyUs;
+
+  Request = &mDeferredEngine.Queue[mDeferredEngine.QueueHead];
+  mDeferredEngine.Phase = DeferredPhaseIdle;
+
+  CallbackSize = 0;
+  if (!EFI_ERROR (Status)) {
+    IpmiResponse = (IPMI_RESPONSE *) mDeferredEngine.Response;
+    if (mDeferredEngine.ResponseCount < IPMI_RESPONSE_HEADER_SIZE) {
+      Status = EFI_DEVICE_ERROR;
+    } else {
+      if (IpmiResponse->CompletionCode != COMP_CODE_NORMAL) {
+        UpdateErrorStatus (IpmiResponse->CompletionCode, mDeferredEngine.IpmiInstance);
+      }
+      //
+      // Completion code first, then the response data, like the synchronous
+      // transport returns it.
+      //
+      CallbackData[0] = IpmiResponse->CompletionCode;
+      CallbackSize    = (UINT8) (mDeferredEngine.ResponseCount - IPMI_RESPONSE_HEADER_SIZE + 1);
+      CopyMem (&CallbackData[1], IpmiResponse->ResponseData, CallbackSize - 1);
+    }
+  }
+
+  if (EFI_ERROR (Status)) {
+    mDeferredEngine.IpmiInstance->BmcStatus = BMC_SOFTFAIL;
+    mDeferredEngine.IpmiInstance->SoftErrorCount++;
+    mDeferredEngine.Statistics.ErrorCount++;
+  }
+
+  LatencyUs = DeferredTicksToUs (GetPerformanceCounter () - Request->SubmitTick);
+  mDeferredEngine.Statistics.CompletedCount++;
+  mDeferredEngine.Statistics.TotalLatencyUs += LatencyUs;
+  mDeferredEngine.Statistics.LastLatencyUs   = LatencyUs;
+  if (LatencyUs > mDeferredEngine.Statistics.MaxLatencyUs) {
+    mDeferredEngine.Statistics.MaxLatencyUs = LatencyUs;
+  }
+  DEBUG ((DEBUG_INFO, "[IPMI] deferred NetFn 0x%02x Cmd 0x%02x: %r, %ld us\n",
+          ((IPMI_COMMAND *) Request->Request)->NetFunction,
+          ((IPMI_COMMAND *) Request->Request)->Command,
+          Status, LatencyUs));
+
+  //
+  // Free the slot before the callback so the callback may enqueue again.
+  //
+  Request->Valid = FALSE;
+  mDeferredEngine.QueueHead = (mDeferredEngine.QueueHead + 1) % SMM_IPMI_DEFERRED_QUEUE_DEPTH;
+
+  if (Request->Completion != NULL) {
+    Request->Completion (Status, CallbackData, CallbackSize, LatencyUs, Request->UserContext);
+  }
+}
+
+/**
+  Starts the request at the head of the queue on the wire.
+**/
+STATIC
+VOID
+DeferredStartRequest (
+  VOID
+  )
+{
+  mDeferredEngine.Phase          = DeferredPhaseWriteStart;
+  mDeferredEngine.ByteIndex      = 0;
+  mDeferredEngine.WroteEndCmd    = FALSE;
+  mDeferredEngine.ExtraCheck     = FALSE;
+  mDeferredEngine.IdleExit       = FALSE;
+  mDeferredEngine.ResponseCount  = 0;
+  mDeferredEngine.PhaseStartTick = GetPerformanceCounter ();
+}
+
+/**
+  Advances the KCS state machine by one micro step without waiting.
+
+  @param[out] Done    TRUE when the transaction finished; status in *Status.
+  @param[out] Status  Final status, only valid when Done is TRUE.
+
+  @retval TRUE   Progress was made.
+  @retval FALSE  Blocked on the status register; try again later.
+**/
+STATIC
+BOOLEAN
+DeferredStep (
+  OUT BOOLEAN     *Done,
+  OUT EFI_STATUS  *Status
+  )
+{
+  SMM_IPMI_DEFERRED_REQUEST  *Request;
+  KCS_STATUS                 KcsStatus;
+  UINT16                     KcsPort;
+
+  *Done   = FALSE;
+  *Status = EFI_SUCCESS;
+  Request = &mDeferredEngine.Queue[mDeferredEngine.QueueHead];
+  KcsPort = mDeferredEngine.IpmiInstance->IpmiIoBase;
+
+  KcsStatus.RawData = IoRead8 (KcsPort + 1);
+  if (KcsStatus.RawData == 0xFF) {
+    *Done   = TRUE;
+    *Status = EFI_DEVICE_ERROR;
+    return TRUE;
+  }
+
+  switch (mDeferredEngine.Phase) {
+    case DeferredPhaseWriteStart:
+      if (KcsStatus.Status.Ibf) {
+        return FALSE;
+      }
+      IoWrite8 (KcsPort + 1, KCS_WRITE_START);
+      //
+      // The synchronous path checks the write state twice before the first
+      // data byte; mirror that with one extra pass through WriteCheck.
+      //
+      mDeferredEngine.ExtraCheck     = TRUE;
+      mDeferredEngine.Phase          = DeferredPhaseWriteCheck;
+      mDeferredEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    case DeferredPhaseWriteCheck:
+      if (KcsStatus.Status.Ibf) {
+        return FALSE;
+      }
+      //
+      // Drain the dummy byte the BMC leaves in the data register, exactly
+      // like KcsCheckStatus () does for the write state.
+      //
+      IoRead8 (KcsPort);
+      if (KcsStatus.Status.State != KcsWriteState) {
+        *Done   = TRUE;
+        *Status = EFI_DEVICE_ERROR;
+        return TRUE;
+      }
+      if (mDeferredEngine.ExtraCheck) {
+        mDeferredEngine.ExtraCheck = FALSE;
+      } else if ((mDeferredEngine.ByteIndex == Request->RequestSize - 1) && !mDeferredEngine.WroteEndCmd) {
+        IoWrite8 (KcsPort + 1, KCS_WRITE_END);
+        mDeferredEngine.WroteEndCmd = TRUE;
+      } else {
+        IoWrite8 (KcsPort, Request->Request[mDeferredEngine.ByteIndex]);
+        mDeferredEngine.ByteIndex++;
+        if (mDeferredEngine.ByteIndex == Request->RequestSize) {
+          mDeferredEngine.Phase = DeferredPhaseReadCheck;
+        }
+      }
+      mDeferredEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    case DeferredPhaseReadCheck:
+      if (KcsStatus.Status.Ibf) {
+        return FALSE;
+      }
+      if (KcsStatus.Status.State == KcsReadState) {
+        mDeferredEngine.IdleExit = FALSE;
+      } else if (KcsStatus.Status.State == KcsIdleState) {
+        mDeferredEngine.IdleExit = TRUE;
+      } else {
+        *Done   = TRUE;
+        *Status = EFI_DEVICE_ERROR;
+        return TRUE;
+      }
+      mDeferredEngine.Phase          = DeferredPhaseReadObf;
+      mDeferredEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    case DeferredPhaseReadObf:
+      if (!KcsStatus.Status.Obf) {
+        return FALSE;
+      }
+      if (mDeferredEngine.IdleExit) {
+        //
+        // Dummy read that terminates the transaction.
+        //
+        IoRead8 (KcsPort);
+        *Done   = TRUE;
+        *Status = EFI_SUCCESS;
+        return TRUE;
+      }
+      if (mDeferredEngine.ResponseCount >= MAX_TEMP_DATA - 1) {
+        *Done   = TRUE;
+        *Status = EFI_DEVICE_ERROR;
+        return TRUE;
+      }
+      mDeferredEngine.Response[mDeferredEngine.ResponseCount] = IoRead8 (KcsPort);
+      mDeferredEngine.ResponseCount++;
+      IoWrite8 (KcsPort, KCS_READ);
+      mDeferredEngine.Phase          = DeferredPhaseReadCheck;
+      mDeferredEngine.PhaseStartTick = GetPerformanceCounter ();
+      return TRUE;
+
+    default:
+      break;
+  }
+
+  return FALSE;
+}
+
+/**
+  Runs the engine until the queue is empty or the time budget is spent.
+
+  @param[in] BudgetUs  Maximum time to spend, in microseconds.
+**/
+STATIC
+VOID
+DeferredPump (
+  IN UINT64  BudgetUs
+  )
+{
+  UINT64      StartTick;
+  BOOLEAN     Done;
+  EFI_STATUS  Status;
+
+  StartTick = GetPerformanceCounter ();
+
+  for (;;) {
+    if (mDeferredEngine.Phase == DeferredPhaseIdle) {
+      if (mDeferredEngine.QueueHead == mDeferredEngine.QueueTail) {
+        return;
+      }
+      DeferredStartRequest ();
+    }
+    if (DeferredStep (&Done, &Status)) {
+      if (Done) {
+        if (EFI_ERROR (Status)) {
+          KcsErrorExit (
+            mDeferredEngine.IpmiInstance->KcsTimeoutPeriod,
+            mDeferredEngine.IpmiInstance->IpmiIoBase,
+            NULL
+            );
+        }
+        DeferredCompleteRequest (Status);
+      }
+    } else {
+      //
+      // Blocked. Give up on the transaction when it has been stuck longer
+      // than the synchronous timeout; the abort sequence is bounded, so the
+      // blocking error exit of the synchronous path is reused.
+      //
+      if (DeferredTicksToUs (GetPerformanceCounter () - mDeferredEngine.PhaseStartTick) >
+          (UINT64) BMC_KCS_TIMEOUT * 1000 * 1000) {
+        KcsErrorExit (
+          mDeferredEngine.IpmiInstance->KcsTimeoutPeriod,
+          mDeferredEngine.IpmiInstance->IpmiIoBase,
+          NULL
+          );
+        DeferredCompleteRequest (EFI_TIMEOUT);
+        continue;
+      }
+      if (DeferredTicksToUs (GetPerformanceCounter () - StartTick) >= BudgetUs) {
+        return;
+      }
+      MicroSecondDelay (KCS_DELAY_UNIT);
+      continue;
+    }
+    if (DeferredTicksToUs (GetPerformanceCounter () - StartTick) >= BudgetUs) {
+      return;
+    }
+  }
+}
+
+/**
+  Queues an IPMI command without waiting for the BMC.
+
+  @param[in] This             Pointer to the deferred transport instance.
+  @param[in] NetFunction      Net Function of command to send.
+  @param[in] Lun              LUN of command to send.
+  @param[in] Command          IPMI command to send.
+  @param[in] CommandData      Pointer to command data buffer, if needed.
+  @param[in] CommandDataSize  Size of command data buffer.
+  @param[in] Completion       Callback invoked when the command completes.
+  @param[in] UserContext      Context handed back to the callback.
+
+  @retval EFI_SUCCESS            The command was queued.
+  @retval EFI_INVALID_PARAMETER  One of the input values is bad.
+  @retval EFI_NOT_READY          The queue is full; retry after completions.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredEnqueue (
+  IN SMM_IPMI_DEFERRED_TRANSPORT  *This,
+  IN UINT8                        NetFunction,
+  IN UINT8                        Lun,
+  IN UINT8                        Command,
+  IN UINT8                        *CommandData,
+  IN UINT8                        CommandDataSize,
+  IN IPMI_ASYNC_COMPLETION        Completion,
+  IN VOID                         *UserContext
+  )
+{
+  SMM_IPMI_DEFERRED_REQUEST  *Request;
+  IPMI_COMMAND               *IpmiCommand;
+  UINTN                      NextTail;
+
+  if ((CommandDataSize > 0) && (CommandData == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+  if (CommandDataSize > MAX_TEMP_DATA - IPMI_COMMAND_HEADER_SIZE) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  NextTail = (mDeferredEngine.QueueTail + 1) % SMM_IPMI_DEFERRED_QUEUE_DEPTH;
+  if (NextTail == mDeferredEngine.QueueHead) {
+    return EFI_NOT_READY;
+  }
+
+  Request = &mDeferredEngine.Queue[mDeferredEngine.QueueTail];
+  IpmiCommand              = (IPMI_COMMAND *) Request->Request;
+  IpmiCommand->Lun         = Lun;
+  IpmiCommand->NetFunction = NetFunction;
+  IpmiCommand->Command     = Command;
+  if (CommandDataSize > 0) {
+    CopyMem (IpmiCommand->CommandData, CommandData, CommandDataSize);
+  }
+  Request->RequestSize = (UINT8) (CommandDataSize + IPMI_COMMAND_HEADER_SIZE);
+  Request->Completion  = Completion;
+  Request->UserContext = UserContext;
+  Request->SubmitTick  = GetPerformanceCounter ();
+  Request->Valid       = TRUE;
+
+  mDeferredEngine.QueueTail = NextTail;
+  mDeferredEngine.Statistics.SubmittedCount++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Advances queued transactions within the configured SMM entry budget.
+
+  @param[in] This  Pointer to the deferred transport instance.
+
+  @retval EFI_SUCCESS  The budget was spent or the queue is empty.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredPoll (
+  IN SMM_IPMI_DEFERRED_TRANSPORT  *This
+  )
+{
+  DeferredPump (PcdGet32 (PcdIpmiSmmEntryBudgetUs));
+  return EFI_SUCCESS;
+}
+
+/**
+  Completes all queued commands before returning, ignoring the entry
+  budget.
+
+  @param[in] This  Pointer to the deferred transport instance.
+
+  @retval EFI_SUCCESS  The queue is empty and the interface is idle.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredFlush (
+  IN SMM_IPMI_DEFERRED_TRANSPORT  *This
+  )
+{
+  DeferredPump (MAX_UINT64);
+  return EFI_SUCCESS;
+}
+
+/**
+  Returns the cumulative engine counters.
+
+  @param[in]  This        Pointer to the deferred transport instance.
+  @param[out] Statistics  Receives a copy of the counters.
+
+  @retval EFI_SUCCESS            Counters returned.
+  @retval EFI_INVALID_PARAMETER  Statistics is NULL.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredGetStatistics (
+  IN SMM_IPMI_DEFERRED_TRANSPORT  *This,
+  OUT IPMI_ASYNC_STATISTICS       *Statistics
+  )
+{
+  if (Statistics == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+  CopyMem (Statistics, &mDeferredEngine.Statistics, sizeof (IPMI_ASYNC_STATISTICS));
+  return EFI_SUCCESS;
+}
+
+/**
+  Synchronous submit interposer.
+
+  Finishes whatever transaction the engine has on the wire before letting
+  the original blocking path use the interface, so the two cannot
+  interleave in the middle of a KCS handshake.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredGuardedSyncSubmit (
+  IN IPMI_TRANSPORT  *This,
+  IN UINT8           NetFunction,
+  IN UINT8           Lun,
+  IN UINT8           Command,
+  IN UINT8           *CommandData,
+  IN UINT32          CommandDataSize,
+  OUT UINT8          *ResponseData,
+  OUT UINT32         *ResponseDataSize
+  )
+{
+  DeferredPump (MAX_UINT64);
+  return mDeferredEngine.SyncSubmit (
+           This,
+           NetFunction,
+           Lun,
+           Command,
+           CommandData,
+           CommandDataSize,
+           ResponseData,
+           ResponseDataSize
+           );
+}
+
+/**
+  Root SMI handler piggybacking on every SMM entry.
+
+  Never claims the SMI; it only spends the entry budget on pending
+  transactions so incidental SMIs collect responses.
+
+  @param[in] DispatchHandle  The handle of this dispatch function.
+  @param[in] Context         Not used.
+  @param[in] CommBuffer      Not used.
+  @param[in] CommBufferSize  Not used.
+
+  @retval EFI_WARN_INTERRUPT_SOURCE_PENDING  The SMI was not claimed.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredRootHandler (
+  IN EFI_HANDLE  DispatchHandle,
+  IN CONST VOID  *Context        OPTIONAL,
+  IN OUT VOID    *CommBuffer     OPTIONAL,
+  IN OUT UINTN   *CommBufferSize OPTIONAL
+  )
+{
+  if (mDeferredEngine.QueueHead != mDeferredEngine.QueueTail) {
+    DeferredPump (PcdGet32 (PcdIpmiSmmEntryBudgetUs));
+  }
+  return EFI_WARN_INTERRUPT_SOURCE_PENDING;
+}
+
+/**
+  Periodic SMI handler guaranteeing forward progress when no other SMIs
+  occur.
+
+  @param[in] DispatchHandle  The handle of this dispatch function.
+  @param[in] Context         Points to the timer register context.
+  @param[in] CommBuffer      Not used.
+  @param[in] CommBufferSize  Not used.
+
+  @retval EFI_SUCCESS  Always.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredTimerHandler (
+  IN EFI_HANDLE  DispatchHandle,
+  IN CONST VOID  *Context        OPTIONAL,
+  IN OUT VOID    *CommBuffer     OPTIONAL,
+  IN OUT UINTN   *CommBufferSize OPTIONAL
+  )
+{
+  if (mDeferredEngine.QueueHead != mDeferredEngine.QueueTail) {
+    DeferredPump (PcdGet32 (PcdIpmiSmmEntryBudgetUs));
+  }
+  return EFI_SUCCESS;
+}
+
+/**
+  Registers the periodic SMI that drives the engine.
+
+  @retval EFI_SUCCESS  The periodic SMI is registered.
+  @retval Other        The dispatch protocol failed the registration.
+**/
+STATIC
+EFI_STATUS
+SmmIpmiDeferredRegisterTimer (
+  VOID
+  )
+{
+  EFI_STATUS                               Status;
+  EFI_SMM_PERIODIC_TIMER_DISPATCH2_PROTOCOL  *PeriodicTimer;
+  EFI_SMM_PERIODIC_TIMER_REGISTER_CONTEXT  TimerContext;
+  EFI_HANDLE                               TimerHandle;
+
+  Status = gSmst->SmmLocateProtocol (
+                    &gEfiSmmPeriodicTimerDispatch2ProtocolGuid,
+                    NULL,
+                    (VOID **) &PeriodicTimer
+                    );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  TimerContext.Period          = SMM_IPMI_PERIODIC_SMI_PERIOD;
+  TimerContext.SmiTickInterval = 0;
+  TimerHandle                  = NULL;
+  Status = PeriodicTimer->Register (
+                            PeriodicTimer,
+                            SmmIpmiDeferredTimerHandler,
+                            &TimerContext,
+                            &TimerHandle
+                            );
+  return Status;
+}
+
+/**
+  Notify callback registering the periodic SMI once the dispatch protocol
+  shows up.
+
+  @param[in] Protocol   Points to the protocol's unique identifier.
+  @param[in] Interface  Points to the interface instance.
+  @param[in] Handle     The handle on which the interface was installed.
+
+  @retval EFI_SUCCESS  Always.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+SmmIpmiDeferredTimerNotify (
+  IN CONST EFI_GUID  *Protocol,
+  IN VOID            *Interface,
+  IN EFI_HANDLE      Handle
+  )
+{
+  SmmIpmiDeferredRegisterTimer ();
+  return EFI_SUCCESS;
+}
+
+/**
+  Sets up the deferred transaction engine on top of an initialized BMC
+  instance and installs the SMM IPMI deferred transport protocol.
+
+  @param[in] IpmiInstance  The initialized BMC instance the engine drives.
+
+  @retval EFI_SUCCESS  The engine is ready and the protocol is installed.
+  @retval Other        Handler registration or installation failed.
+**/
+EFI_STATUS
+SmmIpmiDeferredInitialize (
+  IN IPMI_BMC_INSTANCE_DATA  *IpmiInstance
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  Handle;
+  VOID        *Registration;
+
+  mDeferredEngine.IpmiInstance = IpmiInstance;
+  mDeferredEngine.Phase        = DeferredPhaseIdle;
+
+  mDeferredEngine.DeferredTransport.Enqueue       = SmmIpmiDeferredEnqueue;
+  mDeferredEngine.DeferredTransport.Poll          = SmmIpmiDeferredPoll;
+  mDeferredEngine.DeferredTransport.Flush         = SmmIpmiDeferredFlush;
+  mDeferredEngine.DeferredTransport.GetStatistics = SmmIpmiDeferredGetStatistics;
+
+  //
+  // Piggyback on every SMM entry; the periodic SMI guarantees forward
+  // progress when the platform is otherwise SMI quiet.
+  //
+  Handle = NULL;
+  Status = gSmst->SmiHandlerRegister (SmmIpmiDeferredRootHandler, NULL, &Handle);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = SmmIpmiDeferredRegisterTimer ();
+  if (EFI_ERROR (Status)) {
+    Status = gSmst->SmmRegisterProtocolNotify (
+                      &gEfiSmmPeriodicTimerDispatch2ProtocolGuid,
+                      SmmIpmiDeferredTimerNotify,
+                      &Registration
+                      );
+    ASSERT_EFI_ERROR (Status);
+  }
+
+  //
+  // Interpose the synchronous submit so both paths share the wire safely.
+  //
+  mDeferredEngine.SyncSubmit                    = IpmiInstance->IpmiTransport.IpmiSubmitCommand;
+  IpmiInstance->IpmiTransport.IpmiSubmitCommand = SmmIpmiDeferredGuardedSyncSubmit;
+
+  Handle = NULL;
+  Status = gSmst->SmmInstallProtocolInterface (
+                    &Handle,
+                    &gSmmIpmiDeferredTransportProtocolGuid,
+                    EFI_NATIVE_INTERFACE,
+                    &mDeferredEngine.DeferredTransport
+                    );
+  ASSERT_EFI_ERROR (Status);
+
+  return Status;
+}
@@ -0,0 +1,28 @@
+/** @file
+  SMM deferred IPMI transaction engine head file.
+
+  @copyright
+  Copyright 2021 Intel Corporation. <BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _SMM_IPMI_DEFERRED_H_
+#define _SMM_IPMI_DEFERRED_H_
+
+#include "IpmiBmc.h"
+
+/**
+  Sets up the deferred transaction engine on top of an initialized BMC
+  instance and installs the SMM IPMI deferred transport protocol.
+
+  @param[in] IpmiInstance  The initialized BMC instance the engine drives.
+
+  @retval EFI_SUCCESS  The engine is ready and the protocol is installed.
+  @retval Other        Handler registration or installation failed.
+**/
+EFI_STATUS
+SmmIpmiDeferredInitialize (
+  IN IPMI_BMC_INSTANCE_DATA  *IpmiInstance
+  );
+
+#endif
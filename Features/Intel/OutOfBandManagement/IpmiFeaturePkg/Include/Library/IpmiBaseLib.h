@@ -9,6 +9,11 @@
 #ifndef _IPMI_BASE_LIB_H_
 #define _IPMI_BASE_LIB_H_
 
+//
+// For the IPMI_ASYNC_COMPLETION callback type used by the deferred routines.
+//
+#include <Protocol/IpmiAsyncTransportProtocol.h>
+
 //
 // Prototype definitions for IPMI Library
 //
@@ -46,5 +51,46 @@ IpmiSubmitCommand (
   OUT UINT32   *ResponseDataSize
   );
 
+/**
+  Routine to queue a command to BMC without waiting for the response.
+
+  The response is collected by a later SMM entry and handed to Completion.
+  Only the SMM instance of this library implements the deferred routines;
+  other instances do not provide them.
+
+  @param NetFunction       - Net function of the command
+  @param Command           - IPMI Command
+  @param CommandData       - Command Data
+  @param CommandDataSize   - Size of CommandData
+  @param Completion        - Callback invoked when the command completes,
+                             may be NULL for fire-and-forget requests
+  @param UserContext       - Context handed back to the callback
+
+  @retval EFI_NOT_AVAILABLE_YET - Deferred transport is not installed yet
+  @retval EFI_NOT_READY         - The request queue is full
+
+**/
+EFI_STATUS
+IpmiSubmitCommandDeferred (
+  IN UINT8                  NetFunction,
+  IN UINT8                  Command,
+  IN UINT8                  *CommandData,
+  IN UINT8                  CommandDataSize,
+  IN IPMI_ASYNC_COMPLETION  Completion,
+  IN VOID                   *UserContext
+  );
+
+/**
+  Routine to advance queued deferred commands within the configured SMM
+  entry budget. Only the SMM instance of this library implements it.
+
+  @retval EFI_NOT_AVAILABLE_YET - Deferred transport is not installed yet
+
+**/
+EFI_STATUS
+IpmiPollDeferredCommands (
+  VOID
+  );
+
 #endif
 
@@ -0,0 +1,96 @@
+/** @file
+  IPMI Asynchronous Transport Protocol Header File.
+
+  The asynchronous transport queues IPMI commands and completes them through
+  a timer driven KCS state machine, so callers can overlap BMC traffic with
+  the rest of DXE instead of blocking on each byte handshake.
+
+  @copyright
+  Copyright 2021 Intel Corporation. <BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _IPMI_ASYNC_TRANSPORT_PROTO_H_
+#define _IPMI_ASYNC_TRANSPORT_PROTO_H_
+
+typedef struct _IPMI_ASYNC_TRANSPORT IPMI_ASYNC_TRANSPORT;
+
+#define IPMI_ASYNC_TRANSPORT_PROTOCOL_GUID \
+  { \
+    0x9f7653b4, 0x44c8, 0x4fd1, 0xa8, 0x5f, 0x2b, 0x61, 0xbe, 0x94, 0xf3, 0x4c \
+  }
+
+//
+// Cumulative per-engine counters for fleet debugging. Latencies are measured
+// from submission to completion, including the time spent queued.
+//
+typedef struct {
+  UINT64  SubmittedCount;
+  UINT64  CompletedCount;
+  UINT64  ErrorCount;
+  UINT64  TotalLatencyUs;
+  UINT64  MaxLatencyUs;
+  UINT64  LastLatencyUs;
+} IPMI_ASYNC_STATISTICS;
+
+/**
+  Completion callback for an asynchronous IPMI command.
+
+  Runs at the notify TPL of the engine timer. ResponseData is owned by the
+  engine and only valid for the duration of the callback; the first byte is
+  the completion code, as with the synchronous transport.
+
+  @param[in] Status            EFI_SUCCESS or the transport error of the command.
+  @param[in] ResponseData      Response including leading completion code.
+  @param[in] ResponseDataSize  Size of ResponseData in bytes.
+  @param[in] LatencyUs         Submission-to-completion latency in microseconds.
+  @param[in] UserContext       Context given at submission.
+**/
+typedef
+VOID
+(EFIAPI *IPMI_ASYNC_COMPLETION) (
+  IN EFI_STATUS                        Status,
+  IN UINT8                             *ResponseData,
+  IN UINT8                             ResponseDataSize,
+  IN UINT64                            LatencyUs,
+  IN VOID                              *UserContext
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *IPMI_ASYNC_SUBMIT_COMMAND) (
+  IN IPMI_ASYNC_TRANSPORT              *This,
+  IN UINT8                             NetFunction,
+  IN UINT8                             Lun,
+  IN UINT8                             Command,
+  IN UINT8                             *CommandData,
+  IN UINT8                             CommandDataSize,
+  IN IPMI_ASYNC_COMPLETION             Completion,
+  IN VOID                              *UserContext
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *IPMI_ASYNC_FLUSH) (
+  IN IPMI_ASYNC_TRANSPORT              *This
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *IPMI_ASYNC_GET_STATISTICS) (
+  IN IPMI_ASYNC_TRANSPORT              *This,
+  OUT IPMI_ASYNC_STATISTICS            *Statistics
+  );
+
+//
+// IPMI ASYNC TRANSPORT PROTOCOL
+//
+struct _IPMI_ASYNC_TRANSPORT {
+  IPMI_ASYNC_SUBMIT_COMMAND   SubmitCommand;
+  IPMI_ASYNC_FLUSH            Flush;
+  IPMI_ASYNC_GET_STATISTICS   GetStatistics;
+};
+
+extern EFI_GUID gIpmiAsyncTransportProtocolGuid;
+
+#endif
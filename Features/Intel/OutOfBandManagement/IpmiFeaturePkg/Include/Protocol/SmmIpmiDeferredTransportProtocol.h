@@ -0,0 +1,125 @@
+/** @file
+  SMM IPMI Deferred Transport Protocol Header File.
+
+  Split-transaction IPMI for SMM: a handler enqueues a request and returns,
+  and later SMM entries advance the KCS handshake a bounded amount at a
+  time until the response is collected. This keeps any single SMM entry
+  within the platform microsecond budget instead of stalling all cores on a
+  slow BMC.
+
+  @copyright
+  Copyright 2021 Intel Corporation. <BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _SMM_IPMI_DEFERRED_TRANSPORT_PROTO_H_
+#define _SMM_IPMI_DEFERRED_TRANSPORT_PROTO_H_
+
+//
+// Completion callback and statistics types are shared with the DXE
+// asynchronous transport.
+//
+#include <Protocol/IpmiAsyncTransportProtocol.h>
+
+typedef struct _SMM_IPMI_DEFERRED_TRANSPORT SMM_IPMI_DEFERRED_TRANSPORT;
+
+#define SMM_IPMI_DEFERRED_TRANSPORT_PROTOCOL_GUID \
+  { \
+    0x47ee5685, 0xda50, 0x448a, 0xbc, 0xaf, 0xb8, 0x10, 0x14, 0xe0, 0xc6, 0x9b \
+  }
+
+/**
+  Queues an IPMI command without waiting for the BMC.
+
+  The enqueue itself does not touch the KCS interface; the handshake is
+  advanced by later Poll calls and by the engine's own periodic SMI. The
+  completion callback runs inside SMM from whichever entry collects the
+  response.
+
+  @param[in] This             Pointer to the deferred transport instance.
+  @param[in] NetFunction      Net Function of command to send.
+  @param[in] Lun              LUN of command to send.
+  @param[in] Command          IPMI command to send.
+  @param[in] CommandData      Pointer to command data buffer, if needed.
+  @param[in] CommandDataSize  Size of command data buffer.
+  @param[in] Completion       Callback invoked when the command completes.
+                              May be NULL for fire-and-forget requests.
+  @param[in] UserContext      Context handed back to the callback.
+
+  @retval EFI_SUCCESS            The command was queued.
+  @retval EFI_INVALID_PARAMETER  One of the input values is bad.
+  @retval EFI_NOT_READY          The queue is full; retry after completions.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *SMM_IPMI_DEFERRED_ENQUEUE) (
+  IN SMM_IPMI_DEFERRED_TRANSPORT       *This,
+  IN UINT8                             NetFunction,
+  IN UINT8                             Lun,
+  IN UINT8                             Command,
+  IN UINT8                             *CommandData,
+  IN UINT8                             CommandDataSize,
+  IN IPMI_ASYNC_COMPLETION             Completion,
+  IN VOID                              *UserContext
+  );
+
+/**
+  Advances queued transactions within the configured SMM entry budget.
+
+  Handlers that want their own SMI to make progress on pending requests can
+  call this; the engine also polls from its periodic SMI and from a root
+  SMI handler, so calling it is optional.
+
+  @param[in] This  Pointer to the deferred transport instance.
+
+  @retval EFI_SUCCESS  The budget was spent or the queue is empty.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *SMM_IPMI_DEFERRED_POLL) (
+  IN SMM_IPMI_DEFERRED_TRANSPORT       *This
+  );
+
+/**
+  Completes all queued commands before returning, ignoring the entry
+  budget. Intended for shutdown paths that must not leave requests behind.
+
+  @param[in] This  Pointer to the deferred transport instance.
+
+  @retval EFI_SUCCESS  The queue is empty and the interface is idle.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *SMM_IPMI_DEFERRED_FLUSH) (
+  IN SMM_IPMI_DEFERRED_TRANSPORT       *This
+  );
+
+/**
+  Returns the cumulative engine counters.
+
+  @param[in]  This        Pointer to the deferred transport instance.
+  @param[out] Statistics  Receives a copy of the counters.
+
+  @retval EFI_SUCCESS            Counters returned.
+  @retval EFI_INVALID_PARAMETER  Statistics is NULL.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *SMM_IPMI_DEFERRED_GET_STATISTICS) (
+  IN SMM_IPMI_DEFERRED_TRANSPORT       *This,
+  OUT IPMI_ASYNC_STATISTICS            *Statistics
+  );
+
+//
+// SMM IPMI DEFERRED TRANSPORT PROTOCOL
+//
+struct _SMM_IPMI_DEFERRED_TRANSPORT {
+  SMM_IPMI_DEFERRED_ENQUEUE          Enqueue;
+  SMM_IPMI_DEFERRED_POLL             Poll;
+  SMM_IPMI_DEFERRED_FLUSH            Flush;
+  SMM_IPMI_DEFERRED_GET_STATISTICS   GetStatistics;
+};
+
+extern EFI_GUID gSmmIpmiDeferredTransportProtocolGuid;
+
+#endif
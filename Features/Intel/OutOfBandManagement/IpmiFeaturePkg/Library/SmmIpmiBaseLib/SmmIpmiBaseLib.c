@@ -8,12 +8,14 @@
 
 #include <PiDxe.h>
 #include <Protocol/IpmiTransportProtocol.h>
+#include <Protocol/SmmIpmiDeferredTransportProtocol.h>
 #include <Library/IpmiBaseLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/SmmServicesTableLib.h>
 #include <Library/DebugLib.h>
 
-STATIC IPMI_TRANSPORT     *mIpmiTransport = NULL;
+STATIC IPMI_TRANSPORT               *mIpmiTransport = NULL;
+STATIC SMM_IPMI_DEFERRED_TRANSPORT  *mIpmiDeferredTransport = NULL;
 VOID                      *mEfiIpmiProtocolNotifyReg = NULL;
 EFI_EVENT                 mEfiIpmiProtocolEvent;
 
@@ -178,3 +180,69 @@ GetBmcStatus (
   return Status;
 }
 
+/**
+  Routine to queue a command to BMC without waiting for the response.
+
+  @param NetFunction       - Net function of the command
+  @param Command           - IPMI Command
+  @param CommandData       - Command Data
+  @param CommandDataSize   - Size of CommandData
+  @param Completion        - Callback invoked when the command completes
+  @param UserContext       - Context handed back to the callback
+
+  @retval EFI_NOT_AVAILABLE_YET - Deferred transport is not installed yet
+  @retval EFI_NOT_READY         - The request queue is full
+
+**/
+EFI_STATUS
+IpmiSubmitCommandDeferred (
+  IN UINT8                  NetFunction,
+  IN UINT8                  Command,
+  IN UINT8                  *CommandData,
+  IN UINT8                  CommandDataSize,
+  IN IPMI_ASYNC_COMPLETION  Completion,
+  IN VOID                   *UserContext
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = gSmst->SmmLocateProtocol (&gSmmIpmiDeferredTransportProtocolGuid, NULL, (VOID **) &mIpmiDeferredTransport);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = mIpmiDeferredTransport->Enqueue (
+                                     mIpmiDeferredTransport,
+                                     NetFunction,
+                                     0,
+                                     Command,
+                                     CommandData,
+                                     CommandDataSize,
+                                     Completion,
+                                     UserContext
+                                     );
+  return Status;
+}
+
+/**
+  Routine to advance queued deferred commands within the configured SMM
+  entry budget.
+
+  @retval EFI_NOT_AVAILABLE_YET - Deferred transport is not installed yet
+
+**/
+EFI_STATUS
+IpmiPollDeferredCommands (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = gSmst->SmmLocateProtocol (&gSmmIpmiDeferredTransportProtocolGuid, NULL, (VOID **) &mIpmiDeferredTransport);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  return mIpmiDeferredTransport->Poll (mIpmiDeferredTransport);
+}
+
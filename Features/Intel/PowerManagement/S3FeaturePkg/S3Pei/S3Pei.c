@@ -8,6 +8,77 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <Library/PeiServicesLib.h>
 #include <Library/SmmAccessLib.h>
+#include <Library/BaseLib.h>
+#include <Library/DebugLib.h>
+#include <Library/PerformanceLib.h>
+#include <Library/TimerLib.h>
+#include <Ppi/EndOfPeiPhase.h>
+
+//
+// Performance counter value captured when this module starts running on the
+// S3 resume path; used to split the resume time reported at end of PEI.
+//
+STATIC UINT64  mS3ResumeEntryTick;
+STATIC UINT64  mS3SmmAccessDoneTick;
+
+/**
+  Converts a performance counter tick delta to microseconds.
+
+  @param[in] Ticks  Tick delta measured with GetPerformanceCounter ().
+
+  @return The delta in microseconds.
+**/
+STATIC
+UINT64
+S3TicksToUs (
+  IN UINT64  Ticks
+  )
+{
+  UINT64  Frequency;
+
+  Frequency = GetPerformanceCounterProperties (NULL, NULL);
+  if (Frequency == 0) {
+    return 0;
+  }
+  return DivU64x64Remainder (MultU64x32 (Ticks, 1000000), Frequency, NULL);
+}
+
+/**
+  End of PEI callback on the S3 resume path.
+
+  Reports how the PEI portion of resume divided between SMM access
+  reconstruction and the remaining PEI work, so regressions can be pinned
+  to a phase from the serial log alongside the FPDT resume record.
+
+  @param[in] PeiServices       General purpose services available to every PEIM.
+  @param[in] NotifyDescriptor  The notification structure this PEIM registered.
+  @param[in] Ppi               The EndOfPei PPI.
+
+  @retval EFI_SUCCESS          The function completes successfully
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+S3EndOfPeiNotify (
+  IN EFI_PEI_SERVICES           **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  )
+{
+  UINT64  EndTick;
+
+  EndTick = GetPerformanceCounter ();
+  DEBUG ((DEBUG_INFO, "S3 resume PEI phase: SmmAccess %ld us, remaining PEI %ld us\n",
+          S3TicksToUs (mS3SmmAccessDoneTick - mS3ResumeEntryTick),
+          S3TicksToUs (EndTick - mS3SmmAccessDoneTick)));
+  return EFI_SUCCESS;
+}
+
+STATIC EFI_PEI_NOTIFY_DESCRIPTOR  mS3EndOfPeiNotifyDesc = {
+  (EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK | EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST),
+  &gEfiEndOfPeiSignalPpiGuid,
+  S3EndOfPeiNotify
+};
 
 /**
   S3 PEI module entry point
@@ -25,12 +96,30 @@ S3PeiEntryPoint (
   IN CONST EFI_PEI_SERVICES     **PeiServices
   )
 {
-  EFI_STATUS Status;
+  EFI_STATUS     Status;
+  EFI_BOOT_MODE  BootMode;
+
+  BootMode = BOOT_WITH_FULL_CONFIGURATION;
+  Status   = PeiServicesGetBootMode (&BootMode);
+  if (!EFI_ERROR (Status) && (BootMode == BOOT_ON_S3_RESUME)) {
+    mS3ResumeEntryTick = GetPerformanceCounter ();
+    PERF_INMODULE_BEGIN ("S3SmmAccess");
+  }
 
   //
   // Install EFI_PEI_MM_ACCESS_PPI for S3 resume case
   //
   Status = PeiInstallSmmAccessPpi ();
 
+  if (BootMode == BOOT_ON_S3_RESUME) {
+    PERF_INMODULE_END ("S3SmmAccess");
+    mS3SmmAccessDoneTick = GetPerformanceCounter ();
+    //
+    // The measurements surface in the log at end of PEI; the FPDT S3
+    // performance table records produced by the core carry the total.
+    //
+    PeiServicesNotifyPpi (&mS3EndOfPeiNotifyDesc);
+  }
+
   return Status;
 }
@@ -21,6 +21,31 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/PcdLib.h>
 #include <Library/UefiLib.h>
 
+//
+// Initial size of the record staging arena. The arena doubles when a
+// record does not fit, so the number of allocations grows with the log
+// of the table size instead of the record count.
+//
+#define SMBIOS_BUILDER_ARENA_INITIAL_SIZE  0x1000
+
+//
+// Upper bound on the number of strings a single record passes to the
+// builder; no SMBIOS type produced here comes close.
+//
+#define SMBIOS_BUILDER_MAX_STRINGS         16
+
+///
+/// Staging arena holding every assembled record (formatted area followed
+/// by its deduplicated string-set) until one installation pass publishes
+/// them through the Smbios protocol.
+///
+typedef struct {
+  UINT8     *Arena;
+  UINTN     ArenaSize;
+  UINTN     ArenaUsed;
+  UINTN     RecordCount;
+} SMBIOS_BUILDER;
+
 /**
   Add an SMBIOS record.
 
@@ -42,4 +67,91 @@ AddSmbiosRecord (
   IN EFI_SMBIOS_TABLE_HEADER    *Record
   );
 
+/**
+  Initialize an SMBIOS record staging arena.
+
+  @param  Builder               The builder to initialize.
+
+  @retval EFI_SUCCESS           The arena is ready for records.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be allocated.
+
+**/
+EFI_STATUS
+SmbiosBuilderInit (
+  OUT SMBIOS_BUILDER            *Builder
+  );
+
+/**
+  Assign SMBIOS string numbers to a record's strings, deduplicating
+  identical strings.
+
+  Empty strings get number 0 (no string); each remaining string gets the
+  number previously assigned to an identical string, or the next free
+  number. The numbers returned here match the string-set layout that
+  SmbiosBuilderAddRecord produces for the same string array.
+
+  @param  Strings               Array of the record's strings, in field order.
+  @param  StringCount           Number of entries in Strings.
+  @param  StringNumbers         Assigned string number for each entry.
+
+**/
+VOID
+SmbiosBuilderAssignStringNumbers (
+  IN  CHAR8                     **Strings,
+  IN  UINTN                     StringCount,
+  OUT SMBIOS_TABLE_STRING       *StringNumbers
+  );
+
+/**
+  Append a record and its deduplicated string-set to the staging arena.
+
+  The record's string fields must already hold the numbers returned by
+  SmbiosBuilderAssignStringNumbers for the same string array.
+
+  @param  Builder               The staging arena.
+  @param  Record                The formatted portion of the record; its size
+                                is given by Record->Length.
+  @param  Strings               Array of the record's strings, in field order.
+  @param  StringCount           Number of entries in Strings.
+
+  @retval EFI_SUCCESS           Record was staged.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderAddRecord (
+  IN OUT SMBIOS_BUILDER         *Builder,
+  IN EFI_SMBIOS_TABLE_HEADER    *Record,
+  IN CHAR8                      **Strings,
+  IN UINTN                      StringCount
+  );
+
+/**
+  Install every staged record through the Smbios protocol in one pass.
+
+  @param  Builder               The staging arena.
+  @param  Smbios                The EFI_SMBIOS_PROTOCOL instance.
+
+  @retval EFI_SUCCESS           All staged records were installed.
+  @retval Others                The error returned for the first record the
+                                protocol rejected.
+
+**/
+EFI_STATUS
+SmbiosBuilderInstall (
+  IN OUT SMBIOS_BUILDER         *Builder,
+  IN EFI_SMBIOS_PROTOCOL        *Smbios
+  );
+
+/**
+  Release the staging arena.
+
+  @param  Builder               The staging arena.
+
+**/
+VOID
+SmbiosBuilderFree (
+  IN OUT SMBIOS_BUILDER         *Builder
+  );
+
 #endif
@@ -11,37 +11,37 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 BiosVendorFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   );
 
 EFI_STATUS
 EFIAPI
 SystemManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   );
 
 EFI_STATUS
 EFIAPI
 BaseBoardManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   );
 
 EFI_STATUS
 EFIAPI
 ChassisManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   );
 
 EFI_STATUS
 EFIAPI
 BootInfoStatusFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   );
 
 typedef
 EFI_STATUS
 (EFIAPI EFI_BASIC_SMBIOS_DATA_FUNCTION) (
-  IN  EFI_SMBIOS_PROTOCOL  *Smbios
+  IN OUT SMBIOS_BUILDER  *Builder
   );
 
 typedef struct {
@@ -76,6 +76,7 @@ SmbiosBasicEntryPoint(
   UINTN                Index;
   EFI_STATUS           EfiStatus;
   EFI_SMBIOS_PROTOCOL  *Smbios;
+  SMBIOS_BUILDER       Builder;
 
   EfiStatus = gBS->LocateProtocol(&gEfiSmbiosProtocolGuid, NULL, (VOID**)&Smbios);
   if (EFI_ERROR(EfiStatus)) {
@@ -83,14 +84,31 @@ SmbiosBasicEntryPoint(
     return EfiStatus;
   }
 
+  EfiStatus = SmbiosBuilderInit (&Builder);
+  if (EFI_ERROR(EfiStatus)) {
+    DEBUG((DEBUG_ERROR, "Could not allocate the smbios record arena.  %r\n", EfiStatus));
+    return EfiStatus;
+  }
+
+  //
+  // Assemble every record into the arena first, then publish them in a
+  // single pass.
+  //
   for (Index = 0; Index < sizeof(mSmbiosBasicDataFuncTable)/sizeof(mSmbiosBasicDataFuncTable[0]); ++Index) {
-    EfiStatus = (*mSmbiosBasicDataFuncTable[Index].Function) (Smbios);
+    EfiStatus = (*mSmbiosBasicDataFuncTable[Index].Function) (&Builder);
     if (EFI_ERROR(EfiStatus)) {
       DEBUG((DEBUG_ERROR, "Basic smbios store error.  Index=%d, ReturnStatus=%r\n", Index, EfiStatus));
+      SmbiosBuilderFree (&Builder);
       return EfiStatus;
     }
   }
 
+  EfiStatus = SmbiosBuilderInstall (&Builder, Smbios);
+  if (EFI_ERROR(EfiStatus)) {
+    DEBUG((DEBUG_ERROR, "Basic smbios install error.  ReturnStatus=%r\n", EfiStatus));
+  }
+
+  SmbiosBuilderFree (&Builder);
   return EfiStatus;
 }
 
@@ -0,0 +1,252 @@
+/** @file
+  Smbios record staging arena with a deduplicating string pool.
+
+  Records are assembled into one growing arena instead of one pool
+  allocation each, identical strings inside a record are stored once and
+  share a string number, and the finished arena is installed through the
+  Smbios protocol in a single pass.
+
+Copyright (c) 2018 - 2019, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "SmbiosBasic.h"
+
+/**
+  Initialize an SMBIOS record staging arena.
+
+  @param  Builder               The builder to initialize.
+
+  @retval EFI_SUCCESS           The arena is ready for records.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be allocated.
+
+**/
+EFI_STATUS
+SmbiosBuilderInit (
+  OUT SMBIOS_BUILDER            *Builder
+  )
+{
+  Builder->Arena = AllocateZeroPool (SMBIOS_BUILDER_ARENA_INITIAL_SIZE);
+  if (Builder->Arena == NULL) {
+    ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
+    return EFI_OUT_OF_RESOURCES;
+  }
+  Builder->ArenaSize   = SMBIOS_BUILDER_ARENA_INITIAL_SIZE;
+  Builder->ArenaUsed   = 0;
+  Builder->RecordCount = 0;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Assign SMBIOS string numbers to a record's strings, deduplicating
+  identical strings.
+
+  Empty strings get number 0 (no string); each remaining string gets the
+  number previously assigned to an identical string, or the next free
+  number. The numbers returned here match the string-set layout that
+  SmbiosBuilderAddRecord produces for the same string array.
+
+  @param  Strings               Array of the record's strings, in field order.
+  @param  StringCount           Number of entries in Strings.
+  @param  StringNumbers         Assigned string number for each entry.
+
+**/
+VOID
+SmbiosBuilderAssignStringNumbers (
+  IN  CHAR8                     **Strings,
+  IN  UINTN                     StringCount,
+  OUT SMBIOS_TABLE_STRING       *StringNumbers
+  )
+{
+  UINTN               Index;
+  UINTN               Previous;
+  SMBIOS_TABLE_STRING NextNumber;
+
+  NextNumber = 1;
+  for (Index = 0; Index < StringCount; Index++) {
+    if (*Strings[Index] == '\0') {
+      StringNumbers[Index] = 0;
+      continue;
+    }
+    for (Previous = 0; Previous < Index; Previous++) {
+      if ((StringNumbers[Previous] != 0) &&
+          (AsciiStrCmp (Strings[Previous], Strings[Index]) == 0)) {
+        break;
+      }
+    }
+    if (Previous < Index) {
+      StringNumbers[Index] = StringNumbers[Previous];
+    } else {
+      StringNumbers[Index] = NextNumber++;
+    }
+  }
+}
+
+/**
+  Append a record and its deduplicated string-set to the staging arena.
+
+  The record's string fields must already hold the numbers returned by
+  SmbiosBuilderAssignStringNumbers for the same string array.
+
+  @param  Builder               The staging arena.
+  @param  Record                The formatted portion of the record; its size
+                                is given by Record->Length.
+  @param  Strings               Array of the record's strings, in field order.
+  @param  StringCount           Number of entries in Strings.
+
+  @retval EFI_SUCCESS           Record was staged.
+  @retval EFI_OUT_OF_RESOURCES  The arena could not be grown.
+
+**/
+EFI_STATUS
+SmbiosBuilderAddRecord (
+  IN OUT SMBIOS_BUILDER         *Builder,
+  IN EFI_SMBIOS_TABLE_HEADER    *Record,
+  IN CHAR8                      **Strings,
+  IN UINTN                      StringCount
+  )
+{
+  SMBIOS_TABLE_STRING StringNumbers[SMBIOS_BUILDER_MAX_STRINGS];
+  UINTN               Index;
+  UINTN               Previous;
+  UINTN               StringsSize;
+  UINTN               StringLen;
+  UINTN               TotalSize;
+  UINTN               NewSize;
+  UINT8               *NewArena;
+  UINT8               *Cursor;
+
+  ASSERT (StringCount <= ARRAY_SIZE (StringNumbers));
+  SmbiosBuilderAssignStringNumbers (Strings, StringCount, StringNumbers);
+
+  //
+  // Only the first occurrence of each string lands in the string-set.
+  //
+  StringsSize = 0;
+  for (Index = 0; Index < StringCount; Index++) {
+    if (StringNumbers[Index] == 0) {
+      continue;
+    }
+    for (Previous = 0; Previous < Index; Previous++) {
+      if (StringNumbers[Previous] == StringNumbers[Index]) {
+        break;
+      }
+    }
+    if (Previous == Index) {
+      StringsSize += AsciiStrLen (Strings[Index]) + 1;
+    }
+  }
+
+  //
+  // A record without strings ends with a double null; with strings, the
+  // string-set already carries one null per string plus the terminator.
+  //
+  TotalSize = Record->Length + ((StringsSize == 0) ? 2 : StringsSize + 1);
+
+  if (Builder->ArenaUsed + TotalSize > Builder->ArenaSize) {
+    NewSize = Builder->ArenaSize;
+    while (Builder->ArenaUsed + TotalSize > NewSize) {
+      NewSize *= 2;
+    }
+    NewArena = ReallocatePool (Builder->ArenaSize, NewSize, Builder->Arena);
+    if (NewArena == NULL) {
+      ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
+      return EFI_OUT_OF_RESOURCES;
+    }
+    Builder->Arena     = NewArena;
+    Builder->ArenaSize = NewSize;
+  }
+
+  Cursor = Builder->Arena + Builder->ArenaUsed;
+  ZeroMem (Cursor, TotalSize);
+  CopyMem (Cursor, Record, Record->Length);
+  Cursor += Record->Length;
+  for (Index = 0; Index < StringCount; Index++) {
+    if (StringNumbers[Index] == 0) {
+      continue;
+    }
+    for (Previous = 0; Previous < Index; Previous++) {
+      if (StringNumbers[Previous] == StringNumbers[Index]) {
+        break;
+      }
+    }
+    if (Previous == Index) {
+      StringLen = AsciiStrLen (Strings[Index]);
+      CopyMem (Cursor, Strings[Index], StringLen);
+      Cursor += StringLen + 1;
+    }
+  }
+
+  Builder->ArenaUsed += TotalSize;
+  Builder->RecordCount++;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Install every staged record through the Smbios protocol in one pass.
+
+  @param  Builder               The staging arena.
+  @param  Smbios                The EFI_SMBIOS_PROTOCOL instance.
+
+  @retval EFI_SUCCESS           All staged records were installed.
+  @retval Others                The error returned for the first record the
+                                protocol rejected.
+
+**/
+EFI_STATUS
+SmbiosBuilderInstall (
+  IN OUT SMBIOS_BUILDER         *Builder,
+  IN EFI_SMBIOS_PROTOCOL        *Smbios
+  )
+{
+  EFI_STATUS              Status;
+  EFI_SMBIOS_TABLE_HEADER *Record;
+  EFI_SMBIOS_HANDLE       SmbiosHandle;
+  UINTN                   Offset;
+  UINTN                   Index;
+  UINT8                   *StringSet;
+
+  Offset = 0;
+  for (Index = 0; Index < Builder->RecordCount; Index++) {
+    Record = (EFI_SMBIOS_TABLE_HEADER *) (Builder->Arena + Offset);
+    Status = AddSmbiosRecord (Smbios, &SmbiosHandle, Record);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    //
+    // Step over the formatted area and the double-null terminated
+    // string-set to reach the next staged record.
+    //
+    StringSet = (UINT8 *) Record + Record->Length;
+    while ((StringSet[0] != 0) || (StringSet[1] != 0)) {
+      StringSet++;
+    }
+    Offset = (UINTN) (StringSet + 2 - Builder->Arena);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Release the staging arena.
+
+  @param  Builder               The staging arena.
+
+**/
+VOID
+SmbiosBuilderFree (
+  IN OUT SMBIOS_BUILDER         *Builder
+  )
+{
+  if (Builder->Arena != NULL) {
+    FreePool (Builder->Arena);
+    Builder->Arena = NULL;
+  }
+  Builder->ArenaSize   = 0;
+  Builder->ArenaUsed   = 0;
+  Builder->RecordCount = 0;
+}
@@ -20,62 +20,43 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 BiosVendorFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   )
 {
-  EFI_STATUS            Status;
-  CHAR8                 *VendorStr;
-  UINTN                 VendorStrLen;
-  CHAR8                 *VersionStr;
-  UINTN                 VerStrLen;
-  CHAR8                 *DateStr;
-  UINTN                 DateStrLen;
-  SMBIOS_TABLE_TYPE0    *SmbiosRecord;
+  CHAR8                 *Strings[3];
+  SMBIOS_TABLE_STRING   StringNumbers[3];
+  SMBIOS_TABLE_TYPE0    SmbiosRecord;
   SMBIOS_TABLE_TYPE0    *PcdSmbiosRecord;
-  EFI_SMBIOS_HANDLE     SmbiosHandle;
-  UINTN                 StringOffset;
 
   PcdSmbiosRecord = PcdGetPtr (PcdSmbiosType0BiosInformation);
 
-  VendorStr = PcdGetPtr (PcdSmbiosType0StringVendor);
-  VendorStrLen = AsciiStrLen (VendorStr);
-  ASSERT (VendorStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[0] = PcdGetPtr (PcdSmbiosType0StringVendor);
+  ASSERT (AsciiStrLen (Strings[0]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  VersionStr = PcdGetPtr (PcdSmbiosType0StringBiosVersion);
-  VerStrLen = AsciiStrLen (VersionStr);
-  ASSERT (VerStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[1] = PcdGetPtr (PcdSmbiosType0StringBiosVersion);
+  ASSERT (AsciiStrLen (Strings[1]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  DateStr = PcdGetPtr (PcdSmbiosType0StringBiosReleaseDate);
-  DateStrLen = AsciiStrLen (DateStr);
-  ASSERT (DateStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[2] = PcdGetPtr (PcdSmbiosType0StringBiosReleaseDate);
+  ASSERT (AsciiStrLen (Strings[2]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  //
-  // Two zeros following the last string.
-  //
-  SmbiosRecord = AllocateZeroPool (sizeof (SMBIOS_TABLE_TYPE0) + VendorStrLen + 1 + VerStrLen + 1 + DateStrLen + 1 + 1);
-  if (SmbiosRecord == NULL) {
-    ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  CopyMem (SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE0));
+  CopyMem (&SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE0));
 
-  SmbiosRecord->Hdr.Type = SMBIOS_TYPE_BIOS_INFORMATION;
-  SmbiosRecord->Hdr.Length = sizeof (SMBIOS_TABLE_TYPE0);
-  SmbiosRecord->Hdr.Handle = 0;
-
-  StringOffset = SmbiosRecord->Hdr.Length;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, VendorStr, VendorStrLen);
-  StringOffset += VendorStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, VersionStr, VerStrLen);
-  StringOffset += VerStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, DateStr, DateStrLen);
+  SmbiosRecord.Hdr.Type = SMBIOS_TYPE_BIOS_INFORMATION;
+  SmbiosRecord.Hdr.Length = sizeof (SMBIOS_TABLE_TYPE0);
+  SmbiosRecord.Hdr.Handle = 0;
 
   //
-  // Now we have got the full smbios record, call smbios protocol to add this record.
+  // Let the builder assign the string numbers so identical strings share
+  // one string-set entry.
   //
-  Status = AddSmbiosRecord (Smbios, &SmbiosHandle, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord);
+  SmbiosBuilderAssignStringNumbers (Strings, ARRAY_SIZE (Strings), StringNumbers);
+  SmbiosRecord.Vendor          = StringNumbers[0];
+  SmbiosRecord.BiosVersion     = StringNumbers[1];
+  SmbiosRecord.BiosReleaseDate = StringNumbers[2];
 
-  FreePool (SmbiosRecord);
-  return Status;
+  //
+  // Now we have got the full smbios record, stage it for the single
+  // installation pass.
+  //
+  return SmbiosBuilderAddRecord (Builder, (EFI_SMBIOS_TABLE_HEADER *) &SmbiosRecord, Strings, ARRAY_SIZE (Strings));
 }
@@ -20,95 +20,59 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 SystemManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   )
 {
-  EFI_STATUS                      Status;
-  CHAR8                           *ManufacturerStr;
-  CHAR8                           *ProductNameStr;
-  CHAR8                           *VersionStr;
-  CHAR8                           *SerialNumberStr;
-  CHAR8                           *SKUNumberStr;
-  CHAR8                           *FamilyStr;
-  UINTN                           ManufacturerStrLen;
-  UINTN                           ProductNameStrLen;
-  UINTN                           VersionStrLen;
-  UINTN                           SerialNumberStrLen;
-  UINTN                           SKUNumberStrLen;
-  UINTN                           FamilyStrLen;
-  UINTN                           TableSize;
+  CHAR8                           *Strings[6];
+  SMBIOS_TABLE_STRING             StringNumbers[6];
+  SMBIOS_TABLE_TYPE1              SmbiosRecord;
   SMBIOS_TABLE_TYPE1              *PcdSmbiosRecord;
-  SMBIOS_TABLE_TYPE1              *SmbiosRecord;
-  EFI_SMBIOS_HANDLE               SmbiosHandle;
-  UINTN                           StringOffset;
 
   PcdSmbiosRecord = PcdGetPtr (PcdSmbiosType1SystemInformation);
 
-  ManufacturerStr = PcdGetPtr (PcdSmbiosType1StringManufacturer);
-  ManufacturerStrLen = AsciiStrLen (ManufacturerStr);
-  ASSERT (ManufacturerStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[0] = PcdGetPtr (PcdSmbiosType1StringManufacturer);
+  ASSERT (AsciiStrLen (Strings[0]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  ProductNameStr = PcdGetPtr (PcdSmbiosType1StringProductName);
-  ProductNameStrLen = AsciiStrLen (ProductNameStr);
-  ASSERT (ProductNameStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[1] = PcdGetPtr (PcdSmbiosType1StringProductName);
+  ASSERT (AsciiStrLen (Strings[1]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  VersionStr = PcdGetPtr (PcdSmbiosType1StringVersion);
-  VersionStrLen = AsciiStrLen (VersionStr);
-  ASSERT (VersionStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[2] = PcdGetPtr (PcdSmbiosType1StringVersion);
+  ASSERT (AsciiStrLen (Strings[2]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  SerialNumberStr = PcdGetPtr (PcdSmbiosType1StringSerialNumber);
-  SerialNumberStrLen = AsciiStrLen (SerialNumberStr);
-  ASSERT (SerialNumberStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[3] = PcdGetPtr (PcdSmbiosType1StringSerialNumber);
+  ASSERT (AsciiStrLen (Strings[3]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  SKUNumberStr = PcdGetPtr (PcdSmbiosType1StringSKUNumber);
-  SKUNumberStrLen = AsciiStrLen (SKUNumberStr);
-  ASSERT (SKUNumberStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[4] = PcdGetPtr (PcdSmbiosType1StringSKUNumber);
+  ASSERT (AsciiStrLen (Strings[4]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  FamilyStr = PcdGetPtr (PcdSmbiosType1StringFamily);
-  FamilyStrLen = AsciiStrLen (FamilyStr);
-  ASSERT (FamilyStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[5] = PcdGetPtr (PcdSmbiosType1StringFamily);
+  ASSERT (AsciiStrLen (Strings[5]) <= SMBIOS_STRING_MAX_LENGTH);
 
-  //
-  // Create table size based on string lengths
-  //
-  TableSize = sizeof (SMBIOS_TABLE_TYPE1) + ManufacturerStrLen + 1 + ProductNameStrLen + 1 + VersionStrLen + 1 + SerialNumberStrLen + 1 + SKUNumberStrLen + 1 + FamilyStrLen + 1 + 1;
-  SmbiosRecord = AllocateZeroPool (TableSize);
-  if (SmbiosRecord == NULL) {
-    ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  CopyMem (SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE1));
+  CopyMem (&SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE1));
 
   //
   // Fill in Type 1 fields
   //
 
-  SmbiosRecord->Hdr.Type = SMBIOS_TYPE_SYSTEM_INFORMATION;
-  SmbiosRecord->Hdr.Length = sizeof (SMBIOS_TABLE_TYPE1);
-  SmbiosRecord->Hdr.Handle = 0;
+  SmbiosRecord.Hdr.Type = SMBIOS_TYPE_SYSTEM_INFORMATION;
+  SmbiosRecord.Hdr.Length = sizeof (SMBIOS_TABLE_TYPE1);
+  SmbiosRecord.Hdr.Handle = 0;
 
   //
-  // Add strings to bottom of data block
+  // Let the builder assign the string numbers so identical strings share
+  // one string-set entry.
   //
-  StringOffset = SmbiosRecord->Hdr.Length;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, ManufacturerStr, ManufacturerStrLen);
-  StringOffset += ManufacturerStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, ProductNameStr, ProductNameStrLen);
-  StringOffset += ProductNameStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, VersionStr, VersionStrLen);
-  StringOffset += VersionStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, SerialNumberStr, SerialNumberStrLen);
-  StringOffset += SerialNumberStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, SKUNumberStr, SKUNumberStrLen);
-  StringOffset += SKUNumberStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, FamilyStr, FamilyStrLen);
+  SmbiosBuilderAssignStringNumbers (Strings, ARRAY_SIZE (Strings), StringNumbers);
+  SmbiosRecord.Manufacturer = StringNumbers[0];
+  SmbiosRecord.ProductName  = StringNumbers[1];
+  SmbiosRecord.Version      = StringNumbers[2];
+  SmbiosRecord.SerialNumber = StringNumbers[3];
+  SmbiosRecord.SKUNumber    = StringNumbers[4];
+  SmbiosRecord.Family       = StringNumbers[5];
 
   //
-  // Now we have got the full smbios record, call smbios protocol to add this record.
+  // Now we have got the full smbios record, stage it for the single
+  // installation pass.
   //
-  Status = AddSmbiosRecord (Smbios, &SmbiosHandle, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord);
-
-  FreePool(SmbiosRecord);
-  return Status;
+  return SmbiosBuilderAddRecord (Builder, (EFI_SMBIOS_TABLE_HEADER *) &SmbiosRecord, Strings, ARRAY_SIZE (Strings));
 }
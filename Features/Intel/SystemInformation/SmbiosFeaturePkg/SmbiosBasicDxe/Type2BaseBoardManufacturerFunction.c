@@ -20,86 +20,64 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 BaseBoardManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   )
 {
   EFI_STATUS                          Status;
-  CHAR8                               *ManufacturerStr;
-  CHAR8                               *ProductStr;
-  CHAR8                               *VersionStr;
-  CHAR8                               *SerialNumberStr;
-  CHAR8                               *AssertTagStr;
-  CHAR8                               *ChassisStr;
-  UINTN                               ManuStrLen;
-  UINTN                               ProductStrLen;
-  UINTN                               VerStrLen;
-  UINTN                               AssertTagStrLen;
-  UINTN                               SerialNumStrLen;
-  UINTN                               ChassisStrLen;
-  EFI_SMBIOS_HANDLE                   SmbiosHandle;
+  CHAR8                               *Strings[6];
+  SMBIOS_TABLE_STRING                 StringNumbers[6];
   SMBIOS_TABLE_TYPE2                  *PcdSmbiosRecord;
   SMBIOS_TABLE_TYPE2                  *SmbiosRecord;
   UINTN                               SourceSize;
-  UINTN                               TotalSize;
-  UINTN                               StringOffset;
 
   PcdSmbiosRecord = PcdGetPtr (PcdSmbiosType2BaseBoardInformation);
 
   //
   // Get BoardManufacturer String.
   //
-  ManufacturerStr = PcdGetPtr (PcdSmbiosType2StringManufacturer);
-  ManuStrLen = AsciiStrLen (ManufacturerStr);
-  ASSERT (ManuStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[0] = PcdGetPtr (PcdSmbiosType2StringManufacturer);
+  ASSERT (AsciiStrLen (Strings[0]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get Board ProductName String.
   //
-  ProductStr = PcdGetPtr (PcdSmbiosType2StringProductName);
-  ProductStrLen = AsciiStrLen (ProductStr);
-  ASSERT (ProductStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[1] = PcdGetPtr (PcdSmbiosType2StringProductName);
+  ASSERT (AsciiStrLen (Strings[1]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get Board Version String.
   //
-  VersionStr = PcdGetPtr (PcdSmbiosType2StringVersion);
-  VerStrLen = AsciiStrLen (VersionStr);
-  ASSERT (VerStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[2] = PcdGetPtr (PcdSmbiosType2StringVersion);
+  ASSERT (AsciiStrLen (Strings[2]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get Board Serial Number String.
   //
-  SerialNumberStr = PcdGetPtr (PcdSmbiosType2StringSerialNumber);
-  SerialNumStrLen = AsciiStrLen (SerialNumberStr);
-  ASSERT (SerialNumStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[3] = PcdGetPtr (PcdSmbiosType2StringSerialNumber);
+  ASSERT (AsciiStrLen (Strings[3]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get Board Asset Tag String.
   //
-  AssertTagStr = PcdGetPtr (PcdSmbiosType2StringAssetTag);
-  AssertTagStrLen = AsciiStrLen (AssertTagStr);
-  ASSERT (AssertTagStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[4] = PcdGetPtr (PcdSmbiosType2StringAssetTag);
+  ASSERT (AsciiStrLen (Strings[4]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get Board Chassis Location Tag String.
   //
-  ChassisStr = PcdGetPtr (PcdSmbiosType2StringLocationInChassis);
-  ChassisStrLen = AsciiStrLen (ChassisStr);
-  ASSERT (ChassisStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[5] = PcdGetPtr (PcdSmbiosType2StringLocationInChassis);
+  ASSERT (AsciiStrLen (Strings[5]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
-  // Two zeros following the last string.
+  // The formatted area length depends on the contained object handles.
   //
   SourceSize = PcdGetSize (PcdSmbiosType2BaseBoardInformation);
-  TotalSize = SourceSize + ManuStrLen + 1 + ProductStrLen + 1 + VerStrLen + 1 + SerialNumStrLen + 1 + AssertTagStrLen + 1 + ChassisStrLen + 1 + 1;
-  SmbiosRecord = AllocateZeroPool(TotalSize);
+  SmbiosRecord = AllocateCopyPool (SourceSize, PcdSmbiosRecord);
   if (SmbiosRecord == NULL) {
     ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
     return EFI_OUT_OF_RESOURCES;
   }
 
-  CopyMem (SmbiosRecord, PcdSmbiosRecord, SourceSize);
-
   SmbiosRecord->Hdr.Type = SMBIOS_TYPE_BASEBOARD_INFORMATION;
   SmbiosRecord->Hdr.Length = sizeof (SMBIOS_TABLE_TYPE2);
   if (PcdSmbiosRecord->NumberOfContainedObjectHandles >= 2) {
@@ -108,23 +86,23 @@ BaseBoardManufacturerFunction(
   ASSERT(SourceSize >= SmbiosRecord->Hdr.Length);
   SmbiosRecord->Hdr.Handle = 0;
 
-  StringOffset = SmbiosRecord->Hdr.Length;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, ManufacturerStr, ManuStrLen);
-  StringOffset += ManuStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, ProductStr, ProductStrLen);
-  StringOffset += ProductStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, VersionStr, VerStrLen);
-  StringOffset += VerStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, SerialNumberStr, SerialNumStrLen);
-  StringOffset += SerialNumStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, AssertTagStr, AssertTagStrLen);
-  StringOffset += AssertTagStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, ChassisStr, ChassisStrLen);
+  //
+  // Let the builder assign the string numbers so identical strings share
+  // one string-set entry.
+  //
+  SmbiosBuilderAssignStringNumbers (Strings, ARRAY_SIZE (Strings), StringNumbers);
+  SmbiosRecord->Manufacturer      = StringNumbers[0];
+  SmbiosRecord->ProductName       = StringNumbers[1];
+  SmbiosRecord->Version           = StringNumbers[2];
+  SmbiosRecord->SerialNumber      = StringNumbers[3];
+  SmbiosRecord->AssetTag          = StringNumbers[4];
+  SmbiosRecord->LocationInChassis = StringNumbers[5];
 
   //
-  // Now we have got the full smbios record, call smbios protocol to add this record.
+  // Now we have got the full smbios record, stage it for the single
+  // installation pass.
   //
-  Status = AddSmbiosRecord (Smbios, &SmbiosHandle, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord);
+  Status = SmbiosBuilderAddRecord (Builder, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord, Strings, ARRAY_SIZE (Strings));
 
   FreePool(SmbiosRecord);
   return Status;
@@ -21,36 +21,23 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 BootInfoStatusFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   )
 {
-  EFI_STATUS                         Status;
-  EFI_SMBIOS_HANDLE                  SmbiosHandle;
+  SMBIOS_TABLE_TYPE32                SmbiosRecord;
   SMBIOS_TABLE_TYPE32                *PcdSmbiosRecord;
-  SMBIOS_TABLE_TYPE32                *SmbiosRecord;
 
   PcdSmbiosRecord = PcdGetPtr (PcdSmbiosType32SystemBootInformation);
 
-  //
-  // Two zeros following the last string.
-  //
-  SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE32) + 1 + 1);
-  if (SmbiosRecord == NULL) {
-    ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
-    return EFI_OUT_OF_RESOURCES;
-  }
+  CopyMem (&SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE32));
 
-  CopyMem (SmbiosRecord, PcdSmbiosRecord, sizeof(SMBIOS_TABLE_TYPE32));
-
-  SmbiosRecord->Hdr.Type = EFI_SMBIOS_TYPE_SYSTEM_BOOT_INFORMATION;
-  SmbiosRecord->Hdr.Length = sizeof (SMBIOS_TABLE_TYPE32);
-  SmbiosRecord->Hdr.Handle = 0;
+  SmbiosRecord.Hdr.Type = EFI_SMBIOS_TYPE_SYSTEM_BOOT_INFORMATION;
+  SmbiosRecord.Hdr.Length = sizeof (SMBIOS_TABLE_TYPE32);
+  SmbiosRecord.Hdr.Handle = 0;
 
   //
-  // Now we have got the full smbios record, call smbios protocol to add this record.
+  // Now we have got the full smbios record, stage it for the single
+  // installation pass.
   //
-  Status = AddSmbiosRecord (Smbios, &SmbiosHandle, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord);
-
-  FreePool(SmbiosRecord);
-  return Status;
+  return SmbiosBuilderAddRecord (Builder, (EFI_SMBIOS_TABLE_HEADER *) &SmbiosRecord, NULL, 0);
 }
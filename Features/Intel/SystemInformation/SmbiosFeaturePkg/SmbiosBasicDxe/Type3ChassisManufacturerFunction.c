@@ -20,71 +20,55 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 EFI_STATUS
 EFIAPI
 ChassisManufacturerFunction(
-  IN  EFI_SMBIOS_PROTOCOL   *Smbios
+  IN OUT SMBIOS_BUILDER   *Builder
   )
 {
-  UINTN                           ManuStrLen;
-  UINTN                           VerStrLen;
-  UINTN                           AssertTagStrLen;
-  UINTN                           SerialNumStrLen;
-  UINTN                           SKUNumberStrLen;
   EFI_STATUS                      Status;
-  CHAR8                           *ManufacturerStr;
-  CHAR8                           *VersionStr;
-  CHAR8                           *SerialNumberStr;
-  CHAR8                           *AssertTagStr;
-  CHAR8                           *SKUNumberStr;
+  CHAR8                           *Strings[5];
+  SMBIOS_TABLE_STRING             StringNumbers[5];
   SMBIOS_TABLE_STRING             *SKUNumberPtr;
-  EFI_SMBIOS_HANDLE               SmbiosHandle;
   SMBIOS_TABLE_TYPE3              *SmbiosRecord;
   SMBIOS_TABLE_TYPE3              *PcdSmbiosRecord;
   UINTN                           SourceSize;
-  UINTN                           TotalSize;
-  UINTN                           StringOffset;
 
   PcdSmbiosRecord = PcdGetPtr (PcdSmbiosType3SystemEnclosureChassis);
 
   //
   // Get ChassisManufacturer String.
   //
-  ManufacturerStr = PcdGetPtr (PcdSmbiosType3StringManufacturer);
-  ManuStrLen = AsciiStrLen (ManufacturerStr);
-  ASSERT (ManuStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[0] = PcdGetPtr (PcdSmbiosType3StringManufacturer);
+  ASSERT (AsciiStrLen (Strings[0]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get ChassisVersion String.
   //
-  VersionStr = PcdGetPtr (PcdSmbiosType3StringVersion);
-  VerStrLen = AsciiStrLen (VersionStr);
-  ASSERT (VerStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[1] = PcdGetPtr (PcdSmbiosType3StringVersion);
+  ASSERT (AsciiStrLen (Strings[1]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get ChassisSerialNumber String.
   //
-  SerialNumberStr = PcdGetPtr (PcdSmbiosType3StringSerialNumber);
-  SerialNumStrLen = AsciiStrLen (SerialNumberStr);
-  ASSERT (SerialNumStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[2] = PcdGetPtr (PcdSmbiosType3StringSerialNumber);
+  ASSERT (AsciiStrLen (Strings[2]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get ChassisAssetTag String.
   //
-  AssertTagStr = PcdGetPtr (PcdSmbiosType3StringAssetTag);
-  AssertTagStrLen = AsciiStrLen (AssertTagStr);
-  ASSERT (AssertTagStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[3] = PcdGetPtr (PcdSmbiosType3StringAssetTag);
+  ASSERT (AsciiStrLen (Strings[3]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
   // Get ChassisSKUNumber String.
   //
-  SKUNumberStr = PcdGetPtr (PcdSmbiosType3StringSKUNumber);
-  SKUNumberStrLen = AsciiStrLen (SKUNumberStr);
-  ASSERT (SKUNumberStrLen <= SMBIOS_STRING_MAX_LENGTH);
+  Strings[4] = PcdGetPtr (PcdSmbiosType3StringSKUNumber);
+  ASSERT (AsciiStrLen (Strings[4]) <= SMBIOS_STRING_MAX_LENGTH);
 
   //
-  // Two zeros following the last string.
+  // The formatted area length depends on the contained elements; the SKU
+  // number string field follows them.
   //
   SourceSize = PcdGetSize(PcdSmbiosType3SystemEnclosureChassis);
-  TotalSize = SourceSize + sizeof(SMBIOS_TABLE_STRING) + ManuStrLen + 1 + VerStrLen + 1 + SerialNumStrLen + 1 + AssertTagStrLen + 1 + SKUNumberStrLen + 1 + 1;
-  SmbiosRecord = AllocateZeroPool(TotalSize);
+  SmbiosRecord = AllocateZeroPool(SourceSize + sizeof(SMBIOS_TABLE_STRING));
   if (SmbiosRecord == NULL) {
     ASSERT_EFI_ERROR (EFI_OUT_OF_RESOURCES);
     return EFI_OUT_OF_RESOURCES;
@@ -99,26 +83,26 @@ ChassisManufacturerFunction(
   }
   SmbiosRecord->Hdr.Handle = 0;
 
+  //
+  // Let the builder assign the string numbers so identical strings share
+  // one string-set entry.
+  //
+  SmbiosBuilderAssignStringNumbers (Strings, ARRAY_SIZE (Strings), StringNumbers);
+  SmbiosRecord->Manufacturer = StringNumbers[0];
+  SmbiosRecord->Version      = StringNumbers[1];
+  SmbiosRecord->SerialNumber = StringNumbers[2];
+  SmbiosRecord->AssetTag     = StringNumbers[3];
+
   if ((PcdSmbiosRecord->ContainedElementCount == 0) || (SourceSize < (UINTN)SmbiosRecord + SmbiosRecord->Hdr.Length)) {
     SKUNumberPtr = (SMBIOS_TABLE_STRING *)((UINTN)SmbiosRecord + SmbiosRecord->Hdr.Length - sizeof(SMBIOS_TABLE_STRING));
-    *SKUNumberPtr = 5;
+    *SKUNumberPtr = StringNumbers[4];
   }
 
-  StringOffset = SmbiosRecord->Hdr.Length;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, ManufacturerStr, ManuStrLen);
-  StringOffset += ManuStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, VersionStr, VerStrLen);
-  StringOffset += VerStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, SerialNumberStr, SerialNumStrLen);
-  StringOffset += SerialNumStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, AssertTagStr, AssertTagStrLen);
-  StringOffset += AssertTagStrLen + 1;
-  CopyMem ((UINT8 *)SmbiosRecord + StringOffset, SKUNumberStr, SKUNumberStrLen);
-
   //
-  // Now we have got the full smbios record, call smbios protocol to add this record.
+  // Now we have got the full smbios record, stage it for the single
+  // installation pass.
   //
-  Status = AddSmbiosRecord (Smbios, &SmbiosHandle, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord);
+  Status = SmbiosBuilderAddRecord (Builder, (EFI_SMBIOS_TABLE_HEADER *) SmbiosRecord, Strings, ARRAY_SIZE (Strings));
 
   FreePool(SmbiosRecord);
   return Status;
@@ -13,6 +13,9 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Protocol/HiiPackageList.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/DebugLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
 
 typedef struct {
   EFI_IMAGE_ID                          ImageId;
@@ -32,6 +35,119 @@ LOGO_ENTRY                mLogos[] = {
   }
 };
 
+//
+// Decode cache: the image decoded from the HII package on the first request,
+// kept for the driver's lifetime so later requests cost a copy, not a decode.
+//
+EFI_IMAGE_INPUT           mDecodedLogos[ARRAY_SIZE (mLogos)];
+BOOLEAN                   mDecodedLogoValid[ARRAY_SIZE (mLogos)];
+
+//
+// Precompose cache: the logo already placed on a screen-sized background,
+// keyed by the display resolution it was composed for, so the consumer can
+// show it with a single full-rectangle blit.
+//
+EFI_GRAPHICS_OUTPUT_BLT_PIXEL *mComposedBitmap   = NULL;
+UINT32                        mComposedLogoIndex = 0;
+UINT16                        mComposedWidth     = 0;
+UINT16                        mComposedHeight    = 0;
+
+/**
+  Return the requested logo precomposed for the current display mode.
+
+  The composition (logo centered on a black screen-sized background) is
+  rebuilt only when the display resolution changed since it was last built;
+  otherwise the cached pixels are returned directly.
+
+  @param Index             Index into mLogos of the image to compose.
+  @param Image             Points to the composed image on success.
+
+  @retval EFI_SUCCESS      The composed image was returned.
+  @retval EFI_UNSUPPORTED  There is no usable display mode to compose for,
+                           or the logo does not fit the screen.
+
+**/
+EFI_STATUS
+GetPrecomposedImage (
+  IN  UINT32          Index,
+  OUT EFI_IMAGE_INPUT *Image
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_GRAPHICS_OUTPUT_PROTOCOL  *GraphicsOutput;
+  EFI_IMAGE_INPUT               *Logo;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Composed;
+  UINT32                        Width;
+  UINT32                        Height;
+  UINT32                        Row;
+  UINT32                        OffsetX;
+  UINT32                        OffsetY;
+
+  Status = gBS->LocateProtocol (
+                  &gEfiGraphicsOutputProtocolGuid,
+                  NULL,
+                  (VOID **) &GraphicsOutput
+                  );
+  if (EFI_ERROR (Status)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Width  = GraphicsOutput->Mode->Info->HorizontalResolution;
+  Height = GraphicsOutput->Mode->Info->VerticalResolution;
+  Logo   = &mDecodedLogos[Index];
+  if ((Width == 0) || (Height == 0) || (Width > MAX_UINT16) || (Height > MAX_UINT16) ||
+      (Logo->Width > Width) || (Logo->Height > Height)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if ((mComposedBitmap == NULL) ||
+      (mComposedLogoIndex != Index) ||
+      (mComposedWidth != (UINT16) Width) ||
+      (mComposedHeight != (UINT16) Height)) {
+    Composed = AllocateZeroPool (Width * Height * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+    if (Composed == NULL) {
+      return EFI_UNSUPPORTED;
+    }
+
+    //
+    // Center the logo on the black background, row by row.
+    //
+    OffsetX = (Width - Logo->Width) / 2;
+    OffsetY = (Height - Logo->Height) / 2;
+    for (Row = 0; Row < Logo->Height; Row++) {
+      CopyMem (
+        &Composed[(OffsetY + Row) * Width + OffsetX],
+        &Logo->Bitmap[Row * Logo->Width],
+        Logo->Width * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+        );
+    }
+
+    if (mComposedBitmap != NULL) {
+      FreePool (mComposedBitmap);
+    }
+    mComposedBitmap    = Composed;
+    mComposedLogoIndex = Index;
+    mComposedWidth     = (UINT16) Width;
+    mComposedHeight    = (UINT16) Height;
+  }
+
+  //
+  // The caller owns and frees the bitmap it receives, so hand out a copy
+  // and keep the composition cached.
+  //
+  Image->Bitmap = AllocateCopyPool (
+                    Width * Height * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL),
+                    mComposedBitmap
+                    );
+  if (Image->Bitmap == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+  Image->Width  = (UINT16) Width;
+  Image->Height = (UINT16) Height;
+  Image->Flags  = 0;
+  return EFI_SUCCESS;
+}
+
 /**
   Load a platform logo image and return its data and attributes.
 
@@ -56,7 +172,9 @@ GetImage (
      OUT INTN                                  *OffsetY
   )
 {
-  UINT32 Current;
+  EFI_STATUS Status;
+  UINT32     Current;
+
   if (Instance == NULL || Image == NULL ||
       Attribute == NULL || OffsetX == NULL || OffsetY == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -71,7 +189,48 @@ GetImage (
   *Attribute = mLogos[Current].Attribute;
   *OffsetX   = mLogos[Current].OffsetX;
   *OffsetY   = mLogos[Current].OffsetY;
-  return mHiiImageEx->GetImageEx (mHiiImageEx, mHiiHandle, mLogos[Current].ImageId, Image);
+
+  //
+  // Decode the image only the first time it is requested; the image shown
+  // on every boot never changes, its decode is not free.
+  //
+  if (!mDecodedLogoValid[Current]) {
+    Status = mHiiImageEx->GetImageEx (mHiiImageEx, mHiiHandle, mLogos[Current].ImageId, &mDecodedLogos[Current]);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    mDecodedLogoValid[Current] = TRUE;
+  }
+
+  if (FeaturePcdGet (PcdLogoPrecomposedRendering)) {
+    //
+    // Return the logo already placed on a screen-sized background, so the
+    // consumer shows it with one full-rectangle blit instead of a clear
+    // followed by a small centered blit.
+    //
+    Status = GetPrecomposedImage (Current, Image);
+    if (!EFI_ERROR (Status)) {
+      *Attribute = EdkiiPlatformLogoDisplayAttributeLeftTop;
+      *OffsetX   = 0;
+      *OffsetY   = 0;
+      return EFI_SUCCESS;
+    }
+    //
+    // No display to compose for (yet); fall back to the plain image.
+    //
+  }
+
+  Image->Width  = mDecodedLogos[Current].Width;
+  Image->Height = mDecodedLogos[Current].Height;
+  Image->Flags  = mDecodedLogos[Current].Flags;
+  Image->Bitmap = AllocateCopyPool (
+                    Image->Width * Image->Height * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL),
+                    mDecodedLogos[Current].Bitmap
+                    );
+  if (Image->Bitmap == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  return EFI_SUCCESS;
 }
 
 EDKII_PLATFORM_LOGO_PROTOCOL mPlatformLogo = {
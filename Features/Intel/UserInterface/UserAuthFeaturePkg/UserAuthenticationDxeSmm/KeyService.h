@@ -84,5 +84,38 @@ KeyLibGeneratePBKDF2Hash (
   IN   UINTN               KeyHashSize
   );
 
+/**
+  Compute a session token digest for a verified key.
+
+  The token is SHA256 (Nonce || SaltValue || Key). It is cheap to recompute
+  compared with the PBKDF2 derivation and is only meaningful together with
+  the nonce, which the caller keeps private for the current boot session.
+
+  @param[in]   Key              Points to the key buffer
+  @param[in]   KeySize          Key buffer size
+  @param[in]   Nonce            Points to the per-session nonce buffer
+  @param[in]   NonceSize        Size of the nonce buffer
+  @param[in]   SaltValue        Points to the salt buffer of the stored credential
+  @param[in]   SaltSize         Size of the salt buffer
+  @param[out]  TokenDigest      Points to the token digest result
+  @param[in]   TokenDigestSize  Size of the token digest buffer
+
+  @retval      TRUE           Token digest is computed successfully.
+  @retval      FALSE          Failed to compute the token digest.
+
+**/
+BOOLEAN
+EFIAPI
+KeyLibComputeSessionToken (
+  IN   VOID                *Key,
+  IN   UINTN               KeySize,
+  IN   UINT8               *Nonce,
+  IN   UINTN               NonceSize,
+  IN   UINT8               *SaltValue,
+  IN   UINTN               SaltSize,
+  OUT  UINT8               *TokenDigest,
+  IN   UINTN               TokenDigestSize
+  );
+
 #endif
 
@@ -15,6 +15,16 @@ BOOLEAN                         mNeedReVerify = TRUE;
 BOOLEAN                         mPasswordVerified = FALSE;
 EFI_HANDLE                      mSmmHandle = NULL;
 
+//
+// Session token of the last successful verification. It lets repeated
+// verifications of the same credential in one boot session skip the PBKDF2
+// derivation. The nonce is random per session and the token never leaves
+// SMRAM, so the token reveals nothing about the password outside SMM.
+//
+BOOLEAN                         mSessionTokenValid = FALSE;
+UINT8                           mSessionTokenNonce[PASSWORD_SALT_SIZE];
+UINT8                           mSessionToken[PASSWORD_HASH_SIZE];
+
 /**
   Verify if the password is correct.
 
@@ -34,6 +44,27 @@ VerifyPassword (
 {
   BOOLEAN  HashOk;
   UINT8    HashData[PASSWORD_HASH_SIZE];
+  UINT8    TokenDigest[PASSWORD_HASH_SIZE];
+
+  //
+  // The token is bound to the credential salt, so a match can only occur for
+  // the same stored credential and the same input password.
+  //
+  if (mSessionTokenValid) {
+    HashOk = KeyLibComputeSessionToken (
+               Password,
+               PasswordSize,
+               mSessionTokenNonce,
+               sizeof(mSessionTokenNonce),
+               UserPasswordVarStruct->PasswordSalt,
+               sizeof(UserPasswordVarStruct->PasswordSalt),
+               TokenDigest,
+               sizeof(TokenDigest)
+               );
+    if (HashOk && (KeyLibSlowCompareMem (mSessionToken, TokenDigest, sizeof(mSessionToken)) == 0)) {
+      return EFI_SUCCESS;
+    }
+  }
 
   HashOk = KeyLibGeneratePBKDF2Hash (
              HASH_TYPE_SHA256,
@@ -48,6 +79,23 @@ VerifyPassword (
     return EFI_DEVICE_ERROR;
   }
   if (KeyLibSlowCompareMem (UserPasswordVarStruct->PasswordHash, HashData, PASSWORD_HASH_SIZE) == 0) {
+    //
+    // Record a fresh session token so the next verification of this
+    // credential does not need to re-derive the PBKDF2 hash.
+    //
+    mSessionTokenValid = FALSE;
+    if (KeyLibGenerateSalt (mSessionTokenNonce, sizeof(mSessionTokenNonce))) {
+      mSessionTokenValid = KeyLibComputeSessionToken (
+                             Password,
+                             PasswordSize,
+                             mSessionTokenNonce,
+                             sizeof(mSessionTokenNonce),
+                             UserPasswordVarStruct->PasswordSalt,
+                             sizeof(UserPasswordVarStruct->PasswordSalt),
+                             mSessionToken,
+                             sizeof(mSessionToken)
+                             );
+    }
     return EFI_SUCCESS;
   } else {
     return EFI_SECURITY_VIOLATION;
@@ -222,6 +270,12 @@ SavePasswordToVariable (
   USER_PASSWORD_VAR_STRUCT          UserPasswordVarStruct;
   BOOLEAN                           HashOk;
 
+  //
+  // The stored credential is about to change, drop the session token.
+  //
+  mSessionTokenValid = FALSE;
+  ZeroMem (mSessionToken, sizeof(mSessionToken));
+
   //
   // If password is NULL, it means we want to clean password field saved in variable region.
   //
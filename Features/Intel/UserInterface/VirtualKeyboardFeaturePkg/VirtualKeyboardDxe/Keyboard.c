@@ -450,6 +450,7 @@ VkTimer (
   UINT32                        Index;
   VK_STRUCT                     KeyItem;
   UINT32                        Font;
+  UINT32                        Drained;
 
   DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT, "VkTimer Start\n"));
   VkContext = (VK_CONTEXT *)Context;
@@ -467,87 +468,117 @@ VkTimer (
   }
 
   //
-  // Error handle for invalid information
+  // Drain every sample the touch panel queued since the last poll so a
+  // burst of touch events costs at most one keyboard redraw below instead
+  // of one redraw per event.
   //
   AbsolutePointer = VkContext->AbsolutePointer;
-  Status = gBS->CheckEvent (AbsolutePointer->WaitForInput);
-  if (EFI_ERROR (Status)) {
-    if (Status != EFI_NOT_READY) {
-      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS, "ERROR - VkContext->AbsolutePointer->WaitForInput->CheckEvent failed! Status: %r\n", Status));
+  for (Drained = 0; Drained < VK_COALESCE_EVENTS_PER_POLL; Drained++) {
+    Status = gBS->CheckEvent (AbsolutePointer->WaitForInput);
+    if (EFI_ERROR (Status)) {
+      if (Status != EFI_NOT_READY) {
+        DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS, "ERROR - VkContext->AbsolutePointer->WaitForInput->CheckEvent failed! Status: %r\n", Status));
+        goto Error;
+      }
+      //
+      // The queue is drained.
+      //
+      break;
     }
-    goto Error;
-  }
-
-  Status = AbsolutePointer->GetState (AbsolutePointer, &Point);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS, "ERROR - GetState failed, Status: %r\n", Status));
-    goto Error;
-  }
 
-  if (VkContext->AbsolutePointer->Mode->AbsoluteMaxX <= Point.CurrentX) {
-    DEBUG ((
-      DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS,
-      "ERROR - X value exceeds maximum: X: 0x%016Lx, MaxX: 0x%016Lx\n",
-      Point.CurrentX,
-      VkContext->AbsolutePointer->Mode->AbsoluteMaxX
-      ));
-    Status = EFI_PROTOCOL_ERROR;
-    goto Error;
-  }
-  if (VkContext->AbsolutePointer->Mode->AbsoluteMaxY <= Point.CurrentY) {
-    DEBUG ((
-      DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS,
-      "ERROR - Y value exceeds maximum: Y: 0x%016Lx, MaxY: 0x%016Lx\n",
-      Point.CurrentY,
-      VkContext->AbsolutePointer->Mode->AbsoluteMaxY
-      ));
-    Status = EFI_PROTOCOL_ERROR;
-    goto Error;
-  }
+    Status = AbsolutePointer->GetState (AbsolutePointer, &Point);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS, "ERROR - GetState failed, Status: %r\n", Status));
+      goto Error;
+    }
 
-  //
-  // Update the touch active status
-  //
-  VkContext->TouchActive = ((Point.ActiveButtons & EFI_ABSP_TouchActive) != 0) ? TRUE : FALSE;
-  if (!VkContext->TouchActive) {
-    VkContext->KeyPressed = FALSE;
-  }
-  ConvertCoordinate (VkContext, Point, &TouchX, &TouchY);
-
-  if (!VkContext->KeyPressed &&
-      VkContext->TouchActive &&
-      IsTouchVk (VkContext, &KeyItem, &Index, TouchX, TouchY)) {
-    VkGetMappingFont (VkContext, KeyItem, &Font);
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO,                   "VK Touch event is trigger!\n" ));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "TouchActive:            0x%04x  \n", VkContext->TouchActive));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "CurrentKeyboardDisplay: 0x%04x  \n", VkContext->CurrentKeyboardDisplay));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "X:                      0x%016Lx\n", Point.CurrentX));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Y:                      0x%016Lx\n", Point.CurrentY));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Z:                      0x%016Lx\n", Point.CurrentZ));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Buttons:                0x%08x  \n", Point.ActiveButtons));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "MapKey Index:           0x%04x  \n", Index));
-    DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Key Unicode:            0x%08x  \n", Font));
-
-    switch (Font) {
-    //
-    // Touch the small keyboard icon, show/hide the keyboard.
-    //
-    case VkKeyTypeMaximum:
-      KeyboardLayoutHandler (VkContext, Index);
-      break;
+    if (VkContext->AbsolutePointer->Mode->AbsoluteMaxX <= Point.CurrentX) {
+      DEBUG ((
+        DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS,
+        "ERROR - X value exceeds maximum: X: 0x%016Lx, MaxX: 0x%016Lx\n",
+        Point.CurrentX,
+        VkContext->AbsolutePointer->Mode->AbsoluteMaxX
+        ));
+      Status = EFI_PROTOCOL_ERROR;
+      goto Error;
+    }
+    if (VkContext->AbsolutePointer->Mode->AbsoluteMaxY <= Point.CurrentY) {
+      DEBUG ((
+        DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_VK_POINTS,
+        "ERROR - Y value exceeds maximum: Y: 0x%016Lx, MaxY: 0x%016Lx\n",
+        Point.CurrentY,
+        VkContext->AbsolutePointer->Mode->AbsoluteMaxY
+        ));
+      Status = EFI_PROTOCOL_ERROR;
+      goto Error;
+    }
 
     //
-    // Touch the key raw.
+    // Update the touch active status
     //
-    default:
-      if (VkContext->CurrentKeyboardDisplay == VkDisplayAttributeNone) {
+    VkContext->TouchActive = ((Point.ActiveButtons & EFI_ABSP_TouchActive) != 0) ? TRUE : FALSE;
+    if (!VkContext->TouchActive) {
+      if (VkContext->KeyPressed && (VkContext->PressedKeyIndex != VK_PRESSED_KEY_NONE)) {
+        DrawVkKeyFeedback (VkContext, VkContext->PressedKeyIndex, FALSE);
+        VkContext->PressedKeyIndex = VK_PRESSED_KEY_NONE;
+      }
+      VkContext->KeyPressed = FALSE;
+    }
+    ConvertCoordinate (VkContext, Point, &TouchX, &TouchY);
+
+    if (!VkContext->KeyPressed &&
+        VkContext->TouchActive &&
+        IsTouchVk (VkContext, &KeyItem, &Index, TouchX, TouchY)) {
+      VkGetMappingFont (VkContext, KeyItem, &Font);
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO,                   "VK Touch event is trigger!\n" ));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "TouchActive:            0x%04x  \n", VkContext->TouchActive));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "CurrentKeyboardDisplay: 0x%04x  \n", VkContext->CurrentKeyboardDisplay));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "X:                      0x%016Lx\n", Point.CurrentX));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Y:                      0x%016Lx\n", Point.CurrentY));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Z:                      0x%016Lx\n", Point.CurrentZ));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Buttons:                0x%08x  \n", Point.ActiveButtons));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "MapKey Index:           0x%04x  \n", Index));
+      DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT | DEBUG_INFO | DEBUG_VK_POINTS, "Key Unicode:            0x%08x  \n", Font));
+
+      switch (Font) {
+      //
+      // Touch the small keyboard icon, show/hide the keyboard.
+      //
+      case VkKeyTypeMaximum:
+        KeyboardLayoutHandler (VkContext, Index);
         break;
+
+      //
+      // Touch the key raw.
+      //
+      default:
+        if (VkContext->CurrentKeyboardDisplay == VkDisplayAttributeNone) {
+          break;
+        }
+        VkPushTheKey (VkContext, (UINT16) Font);
+        //
+        // Keys that do not switch the layout only need their own
+        // rectangle repainted to show the pressed state.
+        //
+        if (!VkContext->IsRedrawUpdateUI &&
+            !EFI_ERROR (DrawVkKeyFeedback (VkContext, Index, TRUE))) {
+          VkContext->PressedKeyIndex = Index;
+        }
       }
-      VkPushTheKey (VkContext, (UINT16) Font);
+      VkContext->KeyPressed = TRUE;
     }
-    VkContext->KeyPressed = TRUE;
   }
 
+  //
+  // Render at most once for everything the drained samples changed.
+  //
+  if (VkContext->IsRedrawUpdateUI) {
+    HideVkBody (VkContext);
+    DrawKeyboardLayout (VkContext);
+    VkContext->IsRedrawUpdateUI = FALSE;
+  }
+
+  Status = EFI_SUCCESS;
   DEBUG ((DEBUG_VK_TIMER_ENTRY_EXIT, "VkTimer Success, Status: %r\n", Status));
   goto End;
 
@@ -834,6 +865,7 @@ VkApiStart (
   VkContext->SimIconUpdatedFlag                 = FALSE;
   VkContext->KeyStartIndex                      = 0;
   VkContext->KeyEndIndex                        = 0;
+  VkContext->PressedKeyIndex                    = VK_PRESSED_KEY_NONE;
   VkContext->KeyToggleState                     = EFI_TOGGLE_STATE_VALID;
   VkContext->SmallIcon                          = VkGetImage (VkContext, IMAGE_TOKEN (IMG_VK_SIMPLEICON));
   VkContext->FullIcon                           = VkGetImage (VkContext, IMAGE_TOKEN (IMG_VK_FULLICON));
@@ -903,6 +903,123 @@ DVKBODY_Exit:
   return Status;
 }
 
+/**
+  Redraw only the rectangle of one key to show or clear its pressed state.
+
+  The composed keyboard image kept in VkBodyCompoundBltBuffer already holds
+  the key's released look, so clearing the highlight is a sub-rectangle blt
+  out of that buffer, and showing it blts an inverted copy of the same
+  sub-rectangle. Either way only the touched key is repainted instead of
+  the whole keyboard surface.
+
+  @param[in] VkContext  Pointer to virtual keyboard's context
+  @param[in] Index      Index of the key in VkContext->KeyboardBodyPtr.
+  @param[in] Pressed    TRUE to show the pressed highlight, FALSE to clear it.
+
+  @retval EFI_SUCCESS           The key rectangle has been repainted.
+  @retval EFI_UNSUPPORTED       The keyboard body is not on the screen or the
+                                key is outside of it.
+  @retval EFI_OUT_OF_RESOURCES  Allocate memory failed.
+
+**/
+EFI_STATUS
+EFIAPI
+DrawVkKeyFeedback (
+  IN VK_CONTEXT                    *VkContext,
+  IN UINT32                        Index,
+  IN BOOLEAN                       Pressed
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *KeyBlt;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *Pixel;
+  VK_STRUCT                     *KeyItem;
+  UINTN                         SrcX;
+  UINTN                         SrcY;
+  UINTN                         Width;
+  UINTN                         Height;
+  UINTN                         Row;
+  UINTN                         Count;
+
+  if ((VkContext->CurrentKeyboardDisplay == VkDisplayAttributeNone) ||
+      (VkContext->VkBodyCompoundBltBuffer == NULL) ||
+      (Index >= VkContext->NumOfKeysInfo)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  KeyItem = &VkContext->KeyboardBodyPtr[Index];
+  if ((KeyItem->DisStartX <  VkContext->VkBodyBltStartX) ||
+      (KeyItem->DisStartY <  VkContext->VkBodyBltStartY) ||
+      (KeyItem->DisEndX   >  VkContext->VkBodyBltStartX + VkContext->VkBodyBltWidth) ||
+      (KeyItem->DisEndY   >  VkContext->VkBodyBltStartY + VkContext->VkBodyBltHeight) ||
+      (KeyItem->DisEndX   <= KeyItem->DisStartX) ||
+      (KeyItem->DisEndY   <= KeyItem->DisStartY)) {
+    return EFI_UNSUPPORTED;
+  }
+  SrcX   = KeyItem->DisStartX - VkContext->VkBodyBltStartX;
+  SrcY   = KeyItem->DisStartY - VkContext->VkBodyBltStartY;
+  Width  = (UINTN) (KeyItem->DisEndX - KeyItem->DisStartX);
+  Height = (UINTN) (KeyItem->DisEndY - KeyItem->DisStartY);
+
+  if (!Pressed) {
+    //
+    // The released look is still in the compound buffer, blt it back.
+    //
+    return VkContext->GraphicsOutput->Blt (
+                                        VkContext->GraphicsOutput,
+                                        VkContext->VkBodyCompoundBltBuffer,
+                                        EfiBltBufferToVideo,
+                                        SrcX,
+                                        SrcY,
+                                        KeyItem->DisStartX,
+                                        KeyItem->DisStartY,
+                                        Width,
+                                        Height,
+                                        VkContext->VkBodyBltWidth * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                                        );
+  }
+
+  KeyBlt = AllocatePool (Width * Height * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  if (KeyBlt == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  for (Row = 0; Row < Height; Row++) {
+    CopyMem (
+      &KeyBlt[Row * Width],
+      &VkContext->VkBodyCompoundBltBuffer[(SrcY + Row) * VkContext->VkBodyBltWidth + SrcX],
+      Width * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+      );
+  }
+
+  //
+  // Invert the key colors so the pressed key stands out.
+  //
+  Pixel = KeyBlt;
+  Count = Width * Height;
+  while (Count-- != 0) {
+    Pixel->Red   = (UINT8) (255 - Pixel->Red);
+    Pixel->Green = (UINT8) (255 - Pixel->Green);
+    Pixel->Blue  = (UINT8) (255 - Pixel->Blue);
+    Pixel++;
+  }
+
+  Status = VkContext->GraphicsOutput->Blt (
+                                        VkContext->GraphicsOutput,
+                                        KeyBlt,
+                                        EfiBltBufferToVideo,
+                                        0,
+                                        0,
+                                        KeyItem->DisStartX,
+                                        KeyItem->DisStartY,
+                                        Width,
+                                        Height,
+                                        Width * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL)
+                                        );
+  FreePool (KeyBlt);
+
+  return Status;
+}
+
 /**
   Clear the keyboard body
 
@@ -918,6 +1035,7 @@ HideVkBody (
 {
   RestoreVkBodyBackgroundBltBuffer (VkContext);
   VkContext->CurrentKeyboardDisplay = VkDisplayAttributeNone;
+  VkContext->PressedKeyIndex        = VK_PRESSED_KEY_NONE;
 
   return EFI_SUCCESS;
 }
@@ -83,6 +83,18 @@ extern EFI_COMPONENT_NAME2_PROTOCOL  gVirtualKeyboardComponentName2;
 ///
 #define VK_REPEAT_TIMEOUT             5
 
+///
+/// Maximum pointer samples drained per poll interval. A burst of touch
+/// events is coalesced into at most one keyboard redraw per poll instead
+/// of one redraw per event.
+///
+#define VK_COALESCE_EVENTS_PER_POLL   16
+
+///
+/// PressedKeyIndex value when no pressed-key highlight is on the screen
+///
+#define VK_PRESSED_KEY_NONE           0xFFFFFFFF
+
 ///
 /// TPL used to synchronize add/remove from list
 ///
@@ -339,6 +351,12 @@ struct _VK_CONTEXT {
   ///
   BOOLEAN                           KeyPressed;
 
+  ///
+  /// Index of the key whose pressed highlight is currently on the screen,
+  /// VK_PRESSED_KEY_NONE when there is none
+  ///
+  UINT32                            PressedKeyIndex;
+
   ///
   /// Keyboard display status
   ///
@@ -654,6 +672,27 @@ DrawVkBody (
   IN VK_DISPLAY_ATTRIBUTE          Attribute
   );
 
+/**
+  Redraw only the rectangle of one key to show or clear its pressed state.
+
+  @param[in] VkContext  Pointer to virtual keyboard's context
+  @param[in] Index      Index of the key in VkContext->KeyboardBodyPtr.
+  @param[in] Pressed    TRUE to show the pressed highlight, FALSE to clear it.
+
+  @retval EFI_SUCCESS           The key rectangle has been repainted.
+  @retval EFI_UNSUPPORTED       The keyboard body is not on the screen or the
+                                key is outside of it.
+  @retval EFI_OUT_OF_RESOURCES  Allocate memory failed.
+
+**/
+EFI_STATUS
+EFIAPI
+DrawVkKeyFeedback (
+  IN VK_CONTEXT                    *VkContext,
+  IN UINT32                        Index,
+  IN BOOLEAN                       Pressed
+  );
+
 /**
   Get unicode by VkContext->PageNumber and VkContext->KeyboardBodyPtr.
 
@@ -49,35 +49,29 @@ BootMonFsComputeFooterChecksum (
   IN OUT HW_IMAGE_DESCRIPTION *Footer
   )
 {
-  HW_IMAGE_DESCRIPTION *Description;
+  HW_IMAGE_DESCRIPTION  Description;
   UINT32                Index;
 
   Footer->Attributes = 1;
 
-  Description = AllocateZeroPool (sizeof (HW_IMAGE_DESCRIPTION));
-  if (Description == NULL) {
-    DEBUG ((DEBUG_ERROR, "BootMonFsComputeFooterChecksum: Unable to allocate memory.\n"));
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  // Copy over to temporary shim
-  CopyMem (Description, Footer, sizeof (HW_IMAGE_DESCRIPTION));
+  // Copy over to temporary shim. The description is checksummed for every
+  // block probed during the mount scan, so use a local copy rather than a
+  // pool allocation per call.
+  CopyMem (&Description, Footer, sizeof (HW_IMAGE_DESCRIPTION));
 
   // BootMon doesn't checksum the previous checksum
-  Description->FooterChecksum = 0;
+  Description.FooterChecksum = 0;
 
   // Blank out regions which aren't being used.
   for (Index = Footer->RegionCount; Index < HW_IMAGE_DESCRIPTION_REGION_MAX; Index++) {
-    Description->Region[Index].Checksum = 0;
-    Description->Region[Index].LoadAddress = 0;
-    Description->Region[Index].Offset = 0;
-    Description->Region[Index].Size = 0;
+    Description.Region[Index].Checksum = 0;
+    Description.Region[Index].LoadAddress = 0;
+    Description.Region[Index].Offset = 0;
+    Description.Region[Index].Size = 0;
   }
 
   // Compute the checksum
-  Footer->FooterChecksum = BootMonFsChecksum (Description, sizeof (HW_IMAGE_DESCRIPTION));
-
-  FreePool (Description);
+  Footer->FooterChecksum = BootMonFsChecksum (&Description, sizeof (HW_IMAGE_DESCRIPTION));
 
   return EFI_SUCCESS;
 }
@@ -60,7 +60,12 @@ BootMonFsReadFile (
 
   // Ensure the file has been written in Flash before reading it.
   // This keeps the code simple and avoids having to manage a non-flushed file.
-  BootMonFsFlushFile (This);
+  // Files without pending write regions are served straight from the media
+  // image catalog built at mount, so streamed reads cost one contiguous flash
+  // read each instead of a metadata update per chunk.
+  if (!IsListEmpty (&File->RegionToFlushLink)) {
+    BootMonFsFlushFile (This);
+  }
 
   Instance  = File->Instance;
   DiskIo    = Instance->DiskIo;
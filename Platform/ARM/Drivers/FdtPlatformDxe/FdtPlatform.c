@@ -37,6 +37,18 @@ STATIC CONST EFI_GUID  mFdtPlatformDxeHiiGuid = {
 
 EFI_HANDLE mFdtPlatformDxeHiiHandle;
 
+//
+// Record of the FDT currently installed in the configuration table. It is
+// used to recognize a blob that is already in place, so that re-installing
+// the same device tree (e.g. across netboot attempts) skips the structure
+// validation, the runtime copy and the table update, and to free the copy
+// of the previous device tree when a new one is installed.
+//
+STATIC EFI_PHYSICAL_ADDRESS  mInstalledFdtBase;
+STATIC UINTN                 mInstalledFdtPages;
+STATIC UINTN                 mInstalledFdtSize;
+STATIC UINT32                mInstalledFdtCrc32;
+
 /**
   Install the FDT specified by its device path in text form.
 
@@ -59,6 +71,9 @@ InstallFdt (
   EFI_DEVICE_PATH                     *DevicePath;
   EFI_PHYSICAL_ADDRESS                FdtBlobBase;
   UINTN                               FdtBlobSize;
+  UINTN                               FdtBlobPages;
+  UINTN                               FdtSize;
+  UINT32                              FdtCrc32;
   UINTN                               NumPages;
   EFI_PHYSICAL_ADDRESS                FdtConfigurationTableBase;
 
@@ -81,19 +96,39 @@ InstallFdt (
   // Load the FDT given its device path.
   // This operation may fail if the device path is not supported.
   //
-  FdtBlobBase = 0;
-  NumPages    = 0;
+  FdtBlobBase  = 0;
+  FdtBlobPages = 0;
   Status = BdsLoadImage (DevicePath, AllocateAnyPages, &FdtBlobBase, &FdtBlobSize);
   if (EFI_ERROR (Status)) {
     goto Error;
   }
+  FdtBlobPages = EFI_SIZE_TO_PAGES (FdtBlobSize);
+
+  //
+  // If the blob has the same size and content as the device tree already
+  // installed in the configuration table, keep the installed copy. It has
+  // been validated when it was installed and does not need to be checked,
+  // copied or installed again. "fdt_totalsize" is a raw header field read
+  // and is safe on a not yet validated blob.
+  //
+  FdtSize = fdt_totalsize ((VOID*)(UINTN)FdtBlobBase);
+  if ((mInstalledFdtBase != 0)       &&
+      (FdtSize == mInstalledFdtSize) &&
+      (FdtSize <= FdtBlobSize)          ) {
+    FdtCrc32 = 0;
+    Status = gBS->CalculateCrc32 ((VOID*)(UINTN)FdtBlobBase, FdtSize, &FdtCrc32);
+    if (!EFI_ERROR (Status) && (FdtCrc32 == mInstalledFdtCrc32)) {
+      DEBUG ((EFI_D_INFO, "InstallFdt() - FDT blob already installed, installation skipped\n"));
+      goto Error;
+    }
+  }
 
   //
   // Ensure that the FDT header is valid and that the Size of the Device Tree
   // is smaller than the size of the read file
   //
   if (fdt_check_header ((VOID*)(UINTN)FdtBlobBase) != 0 ||
-      (UINTN)fdt_totalsize ((VOID*)(UINTN)FdtBlobBase) > FdtBlobSize) {
+      FdtSize > FdtBlobSize) {
     DEBUG ((EFI_D_ERROR, "InstallFdt() - loaded FDT binary image seems corrupt\n"));
     Status = EFI_LOAD_ERROR;
     goto Error;
@@ -101,9 +136,11 @@ InstallFdt (
 
   //
   // Store the FDT as Runtime Service Data to prevent the Kernel from
-  // overwritting its data.
+  // overwritting its data. Only the device tree itself is copied, not the
+  // trailing part of a read buffer bigger than the device tree (e.g. a TFTP
+  // download buffer rounded up by the loader).
   //
-  NumPages = EFI_SIZE_TO_PAGES (FdtBlobSize);
+  NumPages = EFI_SIZE_TO_PAGES (FdtSize);
   Status = gBS->AllocatePages (
                   AllocateAnyPages, EfiRuntimeServicesData,
                   NumPages, &FdtConfigurationTableBase
@@ -114,7 +151,7 @@ InstallFdt (
   CopyMem (
     (VOID*)(UINTN)FdtConfigurationTableBase,
     (VOID*)(UINTN)FdtBlobBase,
-    FdtBlobSize
+    FdtSize
     );
 
   //
@@ -126,11 +163,27 @@ InstallFdt (
                   );
   if (EFI_ERROR (Status)) {
     gBS->FreePages (FdtConfigurationTableBase, NumPages);
+    goto Error;
+  }
+
+  //
+  // Free the copy of the previously installed device tree, if any, and
+  // record the newly installed one so that subsequent installations of the
+  // same blob are recognized.
+  //
+  if (mInstalledFdtBase != 0) {
+    gBS->FreePages (mInstalledFdtBase, mInstalledFdtPages);
   }
+  FdtCrc32 = 0;
+  gBS->CalculateCrc32 ((VOID*)(UINTN)FdtConfigurationTableBase, FdtSize, &FdtCrc32);
+  mInstalledFdtBase  = FdtConfigurationTableBase;
+  mInstalledFdtPages = NumPages;
+  mInstalledFdtSize  = FdtSize;
+  mInstalledFdtCrc32 = FdtCrc32;
 
 Error:
   if (FdtBlobBase != 0) {
-    gBS->FreePages (FdtBlobBase, NumPages);
+    gBS->FreePages (FdtBlobBase, FdtBlobPages);
   }
   FreePool (DevicePath);
 
@@ -552,6 +552,67 @@ EDKII_PLATFORM_REPOSITORY_INFO ArmJunoPlatformRepositoryInfo = {
   }
 };
 
+/** A slice of the platform repository arena.
+*/
+typedef struct CmObjectSlice {
+  /// Offset of the object(s) in EDKII_PLATFORM_REPOSITORY_INFO
+  UINT16  Offset;
+
+  /// Total size of the object(s); zero marks an unmapped Object ID
+  UINT16  Size;
+
+  /// Number of objects
+  UINT16  Count;
+} CM_OBJECT_SLICE;
+
+/** Helper macros for populating the object map below.
+*/
+#define CM_SLICE_COUNT(Field)  (UINT16)ARRAY_SIZE (                \
+  ((EDKII_PLATFORM_REPOSITORY_INFO *)0)->Field)
+
+#define CM_SLICE_ENTRY(ObjId, Field, ObjCount)                     \
+  [ObjId] = {                                                      \
+    OFFSET_OF (EDKII_PLATFORM_REPOSITORY_INFO, Field),             \
+    sizeof (((EDKII_PLATFORM_REPOSITORY_INFO *)0)->Field),         \
+    (ObjCount)                                                     \
+  }
+
+/** The precompiled ARM namespace object map: for each Object ID the slice
+    of the static repository arena holding the object(s), allowing GetObject
+    to resolve the common requests with a single indexed lookup.
+
+    Objects that require token handling (EArmObjCmRef) or depend on the Juno
+    revision (EArmObjPciConfigSpaceInfo) are deliberately absent and are
+    resolved by the switch in GetArmNameSpaceObject().
+*/
+STATIC CONST CM_OBJECT_SLICE ArmNameSpaceObjectMap[EArmObjMax] = {
+  CM_SLICE_ENTRY (EArmObjBootArchInfo, BootArchInfo, 1),
+  CM_SLICE_ENTRY (EArmObjPowerManagementProfileInfo, PmProfileInfo, 1),
+  CM_SLICE_ENTRY (EArmObjGenericTimerInfo, GenericTimerInfo, 1),
+  CM_SLICE_ENTRY (EArmObjPlatformGenericWatchdogInfo, Watchdog, 1),
+  CM_SLICE_ENTRY (
+    EArmObjPlatformGTBlockInfo,
+    GTBlockInfo,
+    CM_SLICE_COUNT (GTBlockInfo)
+    ),
+  CM_SLICE_ENTRY (
+    EArmObjGTBlockTimerFrameInfo,
+    GTBlock0TimerInfo,
+    CM_SLICE_COUNT (GTBlock0TimerInfo)
+    ),
+  CM_SLICE_ENTRY (EArmObjGicCInfo, GicCInfo, CM_SLICE_COUNT (GicCInfo)),
+  CM_SLICE_ENTRY (EArmObjGicDInfo, GicDInfo, 1),
+  CM_SLICE_ENTRY (EArmObjSerialConsolePortInfo, SpcrSerialPort, 1),
+  CM_SLICE_ENTRY (EArmObjSerialDebugPortInfo, DbgSerialPort, 1),
+  CM_SLICE_ENTRY (EArmObjGicMsiFrameInfo, GicMsiFrameInfo, 1),
+  CM_SLICE_ENTRY (
+    EArmObjProcHierarchyInfo,
+    ProcHierarchyInfo,
+    CM_SLICE_COUNT (ProcHierarchyInfo)
+    ),
+  CM_SLICE_ENTRY (EArmObjCacheInfo, CacheInfo, CM_SLICE_COUNT (CacheInfo))
+};
+
 /** A helper function for returning the Configuration Manager Objects.
 
   @param [in]       CmObjectId     The Configuration Manager Object ID.
@@ -973,6 +1034,7 @@ GetArmNameSpaceObject (
 {
   EFI_STATUS                        Status;
   EDKII_PLATFORM_REPOSITORY_INFO  * PlatformRepo;
+  CONST CM_OBJECT_SLICE           * Slice;
 
   if ((This == NULL) || (CmObject == NULL)) {
     ASSERT (This != NULL);
@@ -983,6 +1045,25 @@ GetArmNameSpaceObject (
   Status = EFI_NOT_FOUND;
   PlatformRepo = This->PlatRepoInfo;
 
+  //
+  // Resolve objects present in the precompiled object map with a direct
+  // Object ID indexed lookup. Requests carrying a token and objects absent
+  // from the map fall through to the switch below.
+  //
+  if ((Token == CM_NULL_TOKEN) &&
+      (GET_CM_OBJECT_ID (CmObjectId) < ARRAY_SIZE (ArmNameSpaceObjectMap))) {
+    Slice = &ArmNameSpaceObjectMap[GET_CM_OBJECT_ID (CmObjectId)];
+    if (Slice->Size != 0) {
+      return HandleCmObject (
+               CmObjectId,
+               (VOID*)((UINT8*)PlatformRepo + Slice->Offset),
+               Slice->Size,
+               Slice->Count,
+               CmObject
+               );
+    }
+  }
+
   switch (GET_CM_OBJECT_ID (CmObjectId)) {
     case EArmObjBootArchInfo:
       Status = HandleCmObject (
@@ -23,6 +23,7 @@
 #include <Library/DevicePathLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/NonDiscoverableDeviceRegistrationLib.h>
+#include <Library/TimerLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
 #include <Library/IoLib.h>
 #include <Library/PrintLib.h>
@@ -35,6 +36,25 @@ STATIC VOID *mAcpiRegistration = NULL;
 
 STATIC VOID *mPciIoNotificationRegistration = NULL;
 
+/**
+  Reports how long an init stage took, so slow stages show up in boot logs.
+
+  @param[in]  StageName   Name of the completed stage
+  @param[in]  StartTicks  Performance counter value sampled when the stage began
+**/
+STATIC
+VOID
+ReportStageTime (
+  IN CONST CHAR8  *StageName,
+  IN UINT64       StartTicks
+  )
+{
+  UINT64  ElapsedNs;
+
+  ElapsedNs = GetTimeInNanoSecond (GetPerformanceCounter () - StartTicks);
+  DEBUG ((DEBUG_INFO, "ArmJunoDxe: %a took %lu us\n", StageName, ElapsedNs / 1000));
+}
+
 /**
   This function reads PCI ID of the controller.
 
@@ -280,6 +300,7 @@ PciIoNotificationEvent (
 {
   EFI_STATUS            Status;
   EFI_PCI_IO_PROTOCOL   *PciIo;
+  UINT64                StageStart;
 
   Status = gBS->LocateProtocol (&gEfiPciIoProtocolGuid,
                   mPciIoNotificationRegistration, (VOID **)&PciIo);
@@ -292,10 +313,12 @@ PciIoNotificationEvent (
     return;
   }
 
+  StageStart = GetPerformanceCounter ();
   Status = ArmJunoSetNicMacAddress (PciIo);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "ArmJunoDxe: Failed to set Marvell Yukon NIC MAC address\n"));
   }
+  ReportStageTime ("Yukon MAC address programming", StageStart);
   gBS->CloseEvent (Event);
 }
 
@@ -311,6 +334,10 @@ ArmJunoEntryPoint (
   CHAR16                *TextDevicePath;
   UINTN                 TextDevicePathSize;
   UINT32                JunoRevision;
+  UINT64                EntryStart;
+  UINT64                StageStart;
+
+  EntryStart = GetPerformanceCounter ();
 
   //
   // Register the OHCI and EHCI controllers as non-coherent
@@ -376,10 +403,12 @@ ArmJunoEntryPoint (
   }
 
   // Install dynamic Shell command to run baremetal binaries.
+  StageStart = GetPerformanceCounter ();
   Status = ShellDynCmdRunAxfInstall (ImageHandle);
   if (EFI_ERROR (Status)) {
     DEBUG ((EFI_D_ERROR, "ArmJunoDxe: Failed to install ShellDynCmdRunAxf\n"));
   }
+  ReportStageTime ("RunAxf shell command installation", StageStart);
 
   GetJunoRevision(JunoRevision);
 
@@ -387,8 +416,10 @@ ArmJunoEntryPoint (
   //
   // Try to install the ACPI Tables
   //
+  StageStart = GetPerformanceCounter ();
   Status = LocateAndInstallAcpiFromFv (&mJunoAcpiTableFile);
   ASSERT_EFI_ERROR (Status);
+  ReportStageTime ("ACPI table installation", StageStart);
 #endif
 
   //
@@ -446,5 +477,7 @@ ArmJunoEntryPoint (
     return Status;
   }
 
+  ReportStageTime ("entry point", EntryStart);
+
   return Status;
 }
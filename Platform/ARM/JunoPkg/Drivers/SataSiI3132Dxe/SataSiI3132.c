@@ -55,7 +55,9 @@ SataSiI3132PortConstructor (
   Port->Instance = SataSiI3132Instance;
   InitializeListHead (&(Port->Devices));
 
-  NumberOfBytes = sizeof (SATA_SI3132_PRB);
+  // One PRB per command slot, followed by the external SGE tables
+  NumberOfBytes = (SATA_SII3132_MAXSLOT * sizeof (SATA_SI3132_PRB)) +
+                  (SATA_SII3132_MAXSLOT * SATA_SII3132_MAXSGE * sizeof (SATA_SI3132_SGE));
   Status = SataSiI3132Instance->PciIo->AllocateBuffer (
              SataSiI3132Instance->PciIo, AllocateAnyPages, EfiBootServicesData,
              EFI_SIZE_TO_PAGES (NumberOfBytes), &HostPRB, 0
@@ -75,7 +77,10 @@ SataSiI3132PortConstructor (
   }
 
   Port->HostPRB            = HostPRB;
+  Port->HostSGT            = (SATA_SI3132_SGE*)((UINT8*)HostPRB +
+                               (SATA_SII3132_MAXSLOT * sizeof (SATA_SI3132_PRB)));
   Port->PhysAddrHostPRB    = PhysAddrHostPRB;
+  Port->PhysAddrHostSGT    = PhysAddrHostPRB + (SATA_SII3132_MAXSLOT * sizeof (SATA_SI3132_PRB));
   Port->PciAllocMappingPRB = PciAllocMappingPRB;
 
   return Status;
@@ -104,7 +109,8 @@ SataSiI3132Constructor (
   Instance->PciIo               = PciIo;
 
   AtaPassThruMode = (EFI_ATA_PASS_THRU_MODE*)AllocatePool (sizeof (EFI_ATA_PASS_THRU_MODE));
-  AtaPassThruMode->Attributes = EFI_ATA_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_ATA_PASS_THRU_ATTRIBUTES_LOGICAL;
+  AtaPassThruMode->Attributes = EFI_ATA_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_ATA_PASS_THRU_ATTRIBUTES_LOGICAL |
+                                EFI_ATA_PASS_THRU_ATTRIBUTES_NON_BLOCKIO;
   AtaPassThruMode->IoAlign = 0x1000;
 
   // Initialize SiI3132 ports
@@ -444,6 +450,23 @@ SataSiI3132DriverBindingStart (
     goto FREE_POOL;
   }
 
+  // Start the periodic poll harvesting the completion of non-blocking commands
+  Status = gBS->CreateEvent (
+              EVT_TIMER | EVT_NOTIFY_SIGNAL,
+              TPL_NOTIFY,
+              SiI3132HarvestTimerCallback,
+              SataSiI3132Instance,
+              &SataSiI3132Instance->HarvestTimerEvent
+              );
+  ASSERT_EFI_ERROR (Status);
+
+  Status = gBS->SetTimer (
+              SataSiI3132Instance->HarvestTimerEvent,
+              TimerPeriodic,
+              SATA_SII3132_HARVEST_PERIOD
+              );
+  ASSERT_EFI_ERROR (Status);
+
 /*  //
   // Create event to stop the HC when exit boot service.
   //
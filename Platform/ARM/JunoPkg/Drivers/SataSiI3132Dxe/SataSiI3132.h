@@ -72,6 +72,20 @@
 
 #define SATA_SII3132_MAXPORT    2
 
+// The SiI3132 provides 31 command slots per port
+#define SATA_SII3132_MAXSLOT    31
+
+// External Scatter Gather Entries per command slot (in addition to the two
+// SGEs embedded in the PRB, the second of which links to the external table)
+#define SATA_SII3132_MAXSGE     32
+
+// Maximum number of PCI DMA mappings per command: one for the SGE embedded in
+// the PRB plus one per external SGE
+#define SATA_SII3132_MAXSGE_MAPPINGS    (SATA_SII3132_MAXSGE + 1)
+
+// Period of the completion harvest timer for non-blocking commands (1ms)
+#define SATA_SII3132_HARVEST_PERIOD     10000
+
 #define PRB_CTRL_ATA            0x0
 #define PRB_CTRL_PROT_OVERRIDE  0x1
 #define PRB_CTRL_RESTRANSMIT    0x2
@@ -117,6 +131,16 @@ typedef struct _SATA_SI3132_PRB {
     SATA_SI3132_SGE     Sge[2];
 } SATA_SI3132_PRB;
 
+typedef struct _SATA_SI3132_SLOT {
+    EFI_ATA_PASS_THRU_COMMAND_PACKET    *Packet; // Non NULL while the slot is in flight
+    UINT16                              PortMultiplierPort;
+    EFI_EVENT                           Event;   // Event to signal on completion (non-blocking commands)
+    UINT64                              Timeout; // Remaining microseconds, 0 means wait forever
+    EFI_STATUS                          Result;  // Completion status of the last command run in this slot
+    UINTN                               MappingCount;
+    VOID                                *Mappings[SATA_SII3132_MAXSGE_MAPPINGS];
+} SATA_SI3132_SLOT;
+
 typedef struct _SATA_SI3132_DEVICE {
     LIST_ENTRY                  Link; // This attribute must be the first entry of this structure (to avoid pointer computation)
     UINTN                       Index;
@@ -132,9 +156,14 @@ typedef struct _SATA_SI3132_PORT {
     //TODO: Support Port multiplier
     LIST_ENTRY                      Devices;
 
-    SATA_SI3132_PRB*                HostPRB;
+    SATA_SI3132_PRB*                HostPRB;        // Array of SATA_SII3132_MAXSLOT PRBs
+    SATA_SI3132_SGE*                HostSGT;        // External SGE tables, SATA_SII3132_MAXSGE entries per slot
     EFI_PHYSICAL_ADDRESS            PhysAddrHostPRB;
+    EFI_PHYSICAL_ADDRESS            PhysAddrHostSGT;
     VOID*                           PciAllocMappingPRB;
+
+    UINT32                          SlotsInUse;     // Bitmap of the command slots owned by software
+    SATA_SI3132_SLOT                Slots[SATA_SII3132_MAXSLOT];
 } SATA_SI3132_PORT;
 
 typedef struct _SATA_SI3132_INSTANCE {
@@ -145,6 +174,8 @@ typedef struct _SATA_SI3132_INSTANCE {
     EFI_ATA_PASS_THRU_PROTOCOL  AtaPassThruProtocol;
 
     EFI_PCI_IO_PROTOCOL         *PciIo;
+
+    EFI_EVENT                   HarvestTimerEvent;  // Periodic completion poll for non-blocking commands
 } SATA_SI3132_INSTANCE;
 
 #define SATA_SII3132_SIGNATURE              SIGNATURE_32('s', 'i', '3', '2')
@@ -184,6 +215,13 @@ SataSiI3132ComponentNameGetControllerName (
 
 EFI_STATUS SiI3132HwResetPort (SATA_SI3132_PORT *Port);
 
+VOID
+EFIAPI
+SiI3132HarvestTimerCallback (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
 /*
  * Driver Binding Protocol Functions
  */
@@ -46,6 +46,299 @@ GetSataDevice (
   return NULL;
 }
 
+STATIC
+VOID
+SiI3132FreeSlotMappings (
+  IN SATA_SI3132_PORT *SataPort,
+  IN UINTN            Slot
+  )
+{
+  EFI_PCI_IO_PROTOCOL *PciIo;
+  SATA_SI3132_SLOT    *SlotData;
+  UINTN               Index;
+  EFI_STATUS          Status;
+
+  PciIo    = SataPort->Instance->PciIo;
+  SlotData = &SataPort->Slots[Slot];
+
+  for (Index = 0; Index < SlotData->MappingCount; Index++) {
+    Status = PciIo->Unmap (PciIo, SlotData->Mappings[Index]);
+    ASSERT (!EFI_ERROR (Status));
+  }
+  SlotData->MappingCount = 0;
+}
+
+/**
+  Map a data buffer for DMA and describe it with a Scatter Gather chain sized
+  to the request.
+
+  The first region goes into the SGE embedded in the slot PRB. If the PCI
+  mapping cannot cover the whole buffer in a single region, the second
+  embedded SGE is turned into a link to the slot's external SGE table and the
+  remaining regions are appended there.
+
+  @param[in]     SataPort   The port owning the command slot.
+  @param[in]     Slot       The command slot whose SGE chain to build.
+  @param[in]     Buffer     The data buffer of the command.
+  @param[in,out] ByteCount  On input, the number of bytes to map. On
+                            EFI_BAD_BUFFER_SIZE, updated with the number of
+                            bytes the chain could describe.
+  @param[in]     Operation  EfiPciIoOperationBusMasterWrite for reads from the
+                            device, EfiPciIoOperationBusMasterRead for writes.
+
+  @retval EFI_SUCCESS          The whole buffer is described by the SGE chain.
+  @retval EFI_BAD_BUFFER_SIZE  The buffer needs more regions than a chain can
+                               hold.
+
+**/
+STATIC
+EFI_STATUS
+SiI3132BuildSgeChain (
+  IN     SATA_SI3132_PORT              *SataPort,
+  IN     UINTN                         Slot,
+  IN     VOID                          *Buffer,
+  IN OUT UINTN                         *ByteCount,
+  IN     EFI_PCI_IO_PROTOCOL_OPERATION Operation
+  )
+{
+  EFI_PCI_IO_PROTOCOL   *PciIo;
+  SATA_SI3132_PRB       *Prb;
+  SATA_SI3132_SGE       *Sge;
+  SATA_SI3132_SLOT      *SlotData;
+  EFI_PHYSICAL_ADDRESS  PhysAddr;
+  EFI_PHYSICAL_ADDRESS  PhysAddrSGT;
+  UINTN                 Remaining;
+  UINTN                 Mapped;
+  UINTN                 Described;
+  UINTN                 SgeCount;
+  EFI_STATUS            Status;
+
+  PciIo    = SataPort->Instance->PciIo;
+  Prb      = &SataPort->HostPRB[Slot];
+  SlotData = &SataPort->Slots[Slot];
+
+  Remaining = *ByteCount;
+  Described = 0;
+  SgeCount  = 0;
+  Sge       = &Prb->Sge[0];
+
+  while (Remaining != 0) {
+    if (SgeCount == SATA_SII3132_MAXSGE_MAPPINGS) {
+      // The chain is full, report how much of the buffer it could describe
+      (Sge - 1)->Attributes |= SGE_TRM;
+      *ByteCount = Described;
+      return EFI_BAD_BUFFER_SIZE;
+    }
+
+    Mapped = Remaining;
+    Status = PciIo->Map (
+               PciIo, Operation,
+               (UINT8*)Buffer + Described, &Mapped, &PhysAddr,
+               &SlotData->Mappings[SlotData->MappingCount]
+               );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+    SlotData->MappingCount++;
+
+    if (SgeCount == 1) {
+      // More than one region: link the second embedded SGE to the external table
+      PhysAddrSGT = SataPort->PhysAddrHostSGT +
+                    (Slot * SATA_SII3132_MAXSGE * sizeof (SATA_SI3132_SGE));
+      Sge->DataAddressLow  = (UINT32)PhysAddrSGT;
+      Sge->DataAddressHigh = (UINT32)(PhysAddrSGT >> 32);
+      Sge->DataCount       = 0;
+      Sge->Attributes      = SGE_LNK;
+      Sge = &SataPort->HostSGT[Slot * SATA_SII3132_MAXSGE];
+    }
+
+    Sge->DataAddressLow  = (UINT32)PhysAddr;
+    Sge->DataAddressHigh = (UINT32)(PhysAddr >> 32);
+    Sge->DataCount       = (UINT32)Mapped;
+    Sge->Attributes      = 0;
+    Sge++;
+
+    Described += Mapped;
+    Remaining -= Mapped;
+    SgeCount++;
+  }
+
+  // Mark the end of the chain
+  (Sge - 1)->Attributes |= SGE_TRM;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Complete the command in flight in a slot: read back the received FIS, unmap
+  the data buffer, release the slot and signal the caller's event if there is
+  one.
+
+**/
+STATIC
+VOID
+SiI3132CompleteSlot (
+  IN SATA_SI3132_PORT *SataPort,
+  IN UINTN            Slot,
+  IN EFI_STATUS       Result
+  )
+{
+  EFI_PCI_IO_PROTOCOL               *PciIo;
+  SATA_SI3132_SLOT                  *SlotData;
+  EFI_ATA_PASS_THRU_COMMAND_PACKET  *Packet;
+  SATA_SI3132_DEVICE                *SataDevice;
+  EFI_STATUS                        Status;
+
+  PciIo    = SataPort->Instance->PciIo;
+  SlotData = &SataPort->Slots[Slot];
+  Packet   = SlotData->Packet;
+
+  // Fill Packet Ata Status Block from the received FIS of this slot
+  Status = PciIo->Mem.Read (PciIo, EfiPciIoWidthUint32, 1, // Bar 1
+      SataPort->RegBase + (Slot * 0x80) + 0x08,
+      sizeof (EFI_ATA_STATUS_BLOCK) / 4,
+      Packet->Asb);
+  ASSERT_EFI_ERROR (Status);
+
+  SiI3132FreeSlotMappings (SataPort, Slot);
+
+  // If the command was ATA_CMD_IDENTIFY_DRIVE then we need to update the BlockSize
+  if (!EFI_ERROR (Result) && (Packet->Acb->AtaCommand == ATA_CMD_IDENTIFY_DRIVE)) {
+    ATA_IDENTIFY_DATA *IdentifyData = (ATA_IDENTIFY_DATA*)Packet->InDataBuffer;
+
+    // Get the corresponding Block Device
+    SataDevice = GetSataDevice (SataPort->Instance, SataPort->Index, SlotData->PortMultiplierPort);
+
+    // Check logical block size
+    if ((IdentifyData->phy_logic_sector_support & BIT12) != 0) {
+      ASSERT (SataDevice != NULL);
+      SataDevice->BlockSize = (UINT32) (((IdentifyData->logic_sector_size_hi << 16) |
+                                          IdentifyData->logic_sector_size_lo) * sizeof (UINT16));
+    } else {
+      SataDevice->BlockSize = 0x200;
+    }
+  }
+
+  SlotData->Result = Result;
+  SlotData->Packet = NULL;
+  SataPort->SlotsInUse &= ~(1U << Slot);
+
+  if (SlotData->Event != NULL) {
+    gBS->SignalEvent (SlotData->Event);
+    SlotData->Event = NULL;
+  }
+}
+
+/**
+  Harvest the completed command slots of a port.
+
+  Completion is detected by the controller clearing a slot's bit in the Port
+  Slot Status register. A command error halts command execution on the whole
+  port, so on error every outstanding slot is failed and the port is reset to
+  resume operation.
+
+  @param[in] SataPort   The port to harvest.
+  @param[in] TimerTick  TRUE when called from the periodic harvest timer, to
+                        account the elapsed period against the timeout of
+                        non-blocking commands.
+
+**/
+STATIC
+VOID
+SiI3132HarvestCompletions (
+  IN SATA_SI3132_PORT *SataPort,
+  IN BOOLEAN          TimerTick
+  )
+{
+  EFI_PCI_IO_PROTOCOL *PciIo;
+  UINT32              SlotStatus;
+  UINT32              IntStatus;
+  UINT32              Error;
+  UINT32              Pending;
+  UINTN               Slot;
+
+  if (SataPort->SlotsInUse == 0) {
+    return;
+  }
+
+  PciIo = SataPort->Instance->PciIo;
+
+  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_SLOTSTATUS_REG, &SlotStatus);
+  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &IntStatus);
+
+  if (IntStatus & (SII3132_PORT_INT_CMDERR << 16)) {
+    SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_CMDERROR_REG, &Error);
+    DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() CmdErr:0x%X (SiI3132 Err:0x%X)\n", IntStatus, Error));
+
+    // A command error stops the port command execution: fail every
+    // outstanding slot and reset the port to resume operation
+    Pending = SataPort->SlotsInUse;
+    for (Slot = 0; Pending != 0; Slot++, Pending >>= 1) {
+      if (Pending & BIT0) {
+        SiI3132CompleteSlot (SataPort, Slot, EFI_DEVICE_ERROR);
+      }
+    }
+
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG,
+        (SII3132_PORT_INT_CMDCOMPL | SII3132_PORT_INT_CMDERR) << 16);
+    SiI3132HwResetPort (SataPort);
+    return;
+  }
+
+  // Complete the slots the controller has finished with
+  Pending = SataPort->SlotsInUse & ~SlotStatus;
+  for (Slot = 0; Pending != 0; Slot++, Pending >>= 1) {
+    if (Pending & BIT0) {
+      SiI3132CompleteSlot (SataPort, Slot, EFI_SUCCESS);
+    }
+  }
+
+  // Clear Command Complete
+  if (IntStatus & (SII3132_PORT_INT_CMDCOMPL << 16)) {
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, SII3132_PORT_INT_CMDCOMPL << 16);
+  }
+
+  // Account the elapsed harvest period against the non-blocking commands
+  // carrying a timeout
+  if (TimerTick) {
+    Pending = SataPort->SlotsInUse;
+    for (Slot = 0; Pending != 0; Slot++, Pending >>= 1) {
+      if ((Pending & BIT0) && (SataPort->Slots[Slot].Timeout != 0)) {
+        if (SataPort->Slots[Slot].Timeout <= (SATA_SII3132_HARVEST_PERIOD / 10)) {
+          DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() Err:Timeout\n"));
+          SiI3132CompleteSlot (SataPort, Slot, EFI_TIMEOUT);
+        } else {
+          SataPort->Slots[Slot].Timeout -= (SATA_SII3132_HARVEST_PERIOD / 10);
+        }
+      }
+    }
+  }
+}
+
+/**
+  Periodic poll harvesting the completion of non-blocking commands.
+
+  @param[in] Event    The periodic harvest timer event.
+  @param[in] Context  The SATA_SI3132_INSTANCE whose ports to harvest.
+
+**/
+VOID
+EFIAPI
+SiI3132HarvestTimerCallback (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  SATA_SI3132_INSTANCE  *SataSiI3132Instance;
+  UINTN                 Index;
+
+  SataSiI3132Instance = (SATA_SI3132_INSTANCE*)Context;
+
+  for (Index = 0; Index < SATA_SII3132_MAXPORT; Index++) {
+    SiI3132HarvestCompletions (&SataSiI3132Instance->Ports[Index], TRUE);
+  }
+}
+
 EFI_STATUS
 EFIAPI
 SiI3132AtaPassThruCommand (
@@ -57,21 +350,47 @@ SiI3132AtaPassThruCommand (
   )
 {
   SATA_SI3132_DEVICE      *SataDevice;
-  EFI_PHYSICAL_ADDRESS    PhysInDataBuffer;
+  SATA_SI3132_PRB         *Prb;
+  SATA_SI3132_SLOT        *SlotData;
+  EFI_PHYSICAL_ADDRESS    PhysAddrPRB;
+  UINTN                   Slot;
   UINTN                   InDataBufferLength = 0;
-  EFI_PHYSICAL_ADDRESS    PhysOutDataBuffer;
   UINTN                   OutDataBufferLength;
-  CONST UINTN             EmptySlot = 0;
   UINTN                   Control = PRB_CTRL_ATA;
   UINTN                   Protocol = 0;
-  UINT32                  Value32, Error, Timeout = 0;
-  CONST UINT32            IrqMask = (SII3132_PORT_INT_CMDCOMPL | SII3132_PORT_INT_CMDERR) << 16;
+  UINT32                  SlotStatus;
+  UINT32                  Timeout = 0;
   EFI_STATUS              Status;
-  VOID*                   PciAllocMapping = NULL;
   EFI_PCI_IO_PROTOCOL     *PciIo;
+  EFI_TPL                 OldTpl;
 
   PciIo = SataSiI3132Instance->PciIo;
-  ZeroMem (SataPort->HostPRB, sizeof (SATA_SI3132_PRB));
+
+  // Find a free command slot, skipping any the controller still reports busy
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_SLOTSTATUS_REG, &SlotStatus);
+  SlotStatus |= SataPort->SlotsInUse;
+  for (Slot = 0; Slot < SATA_SII3132_MAXSLOT; Slot++) {
+    if ((SlotStatus & (1U << Slot)) == 0) {
+      break;
+    }
+  }
+  if (Slot == SATA_SII3132_MAXSLOT) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_NOT_READY;
+  }
+  SataPort->SlotsInUse |= 1U << Slot;
+  gBS->RestoreTPL (OldTpl);
+
+  SlotData = &SataPort->Slots[Slot];
+  SlotData->Packet             = Packet;
+  SlotData->PortMultiplierPort = PortMultiplierPort;
+  SlotData->Event              = Event;
+  SlotData->Timeout            = Packet->Timeout;
+  SlotData->MappingCount       = 0;
+
+  Prb = &SataPort->HostPRB[Slot];
+  ZeroMem (Prb, sizeof (SATA_SI3132_PRB));
 
   // Construct Si3132 PRB
   switch (Packet->Protocol) {
@@ -83,7 +402,7 @@ SiI3132AtaPassThruCommand (
     Control = PRB_CTRL_SRST;
 
     if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
-        SataPort->HostPRB->Fis.Control = 0x0F;
+        Prb->Fis.Control = 0x0F;
     }
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_ATA_NON_DATA:
@@ -100,69 +419,72 @@ SiI3132AtaPassThruCommand (
     } else {
       SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, PortMultiplierPort);
       if (!SataDevice || (SataDevice->BlockSize == 0)) {
-        return EFI_INVALID_PARAMETER;
+        Status = EFI_INVALID_PARAMETER;
+        goto EXIT_FREE_SLOT;
       }
 
       InDataBufferLength = Packet->InTransferLength * SataDevice->BlockSize;
     }
 
-    Status = PciIo->Map (
-               PciIo, EfiPciIoOperationBusMasterWrite,
-               Packet->InDataBuffer, &InDataBufferLength, &PhysInDataBuffer, &PciAllocMapping
+    Status = SiI3132BuildSgeChain (
+               SataPort, Slot,
+               Packet->InDataBuffer, &InDataBufferLength,
+               EfiPciIoOperationBusMasterWrite
                );
     if (EFI_ERROR (Status)) {
-      return Status;
+      if (Status == EFI_BAD_BUFFER_SIZE) {
+        // Report back how much the chain could have transferred
+        if (Packet->Acb->AtaCommand == ATA_CMD_IDENTIFY_DRIVE) {
+          Packet->InTransferLength = (UINT32)InDataBufferLength;
+        } else {
+          Packet->InTransferLength = (UINT32)(InDataBufferLength / SataDevice->BlockSize);
+        }
+      }
+      goto EXIT_FREE_SLOT;
     }
 
-    // Construct SGEs (32-bit system)
-    SataPort->HostPRB->Sge[0].DataAddressLow = (UINT32)PhysInDataBuffer;
-    SataPort->HostPRB->Sge[0].DataAddressHigh = (UINT32)(PhysInDataBuffer >> 32);
-    SataPort->HostPRB->Sge[0].Attributes = SGE_TRM; // Only one SGE
-    SataPort->HostPRB->Sge[0].DataCount = InDataBufferLength;
-
     // Copy the Ata Command Block
-    CopyMem (&SataPort->HostPRB->Fis, Packet->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
+    CopyMem (&Prb->Fis, Packet->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
 
     // Fixup the FIS
-    SataPort->HostPRB->Fis.FisType = 0x27; // Register - Host to Device FIS
-    SataPort->HostPRB->Fis.Control = 1 << 7; // Is a command
+    Prb->Fis.FisType = 0x27; // Register - Host to Device FIS
+    Prb->Fis.Control = 1 << 7; // Is a command
     if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
-      SataPort->HostPRB->Fis.Control |= PortMultiplierPort & 0xFF;
+      Prb->Fis.Control |= PortMultiplierPort & 0xFF;
     }
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_UDMA_DATA_OUT:
   case EFI_ATA_PASS_THRU_PROTOCOL_PIO_DATA_OUT:
     SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, PortMultiplierPort);
     if (!SataDevice || (SataDevice->BlockSize == 0)) {
-      return EFI_INVALID_PARAMETER;
+      Status = EFI_INVALID_PARAMETER;
+      goto EXIT_FREE_SLOT;
     }
 
     // Fixup the size for block transfer. Following UEFI Specification, 'InTransferLength' should
     // be in number of bytes. But for most data transfer commands, the value is in number of blocks
     OutDataBufferLength = Packet->OutTransferLength * SataDevice->BlockSize;
 
-    Status = PciIo->Map (
-               PciIo, EfiPciIoOperationBusMasterRead,
-               Packet->OutDataBuffer, &OutDataBufferLength, &PhysOutDataBuffer, &PciAllocMapping
+    Status = SiI3132BuildSgeChain (
+               SataPort, Slot,
+               Packet->OutDataBuffer, &OutDataBufferLength,
+               EfiPciIoOperationBusMasterRead
                );
     if (EFI_ERROR (Status)) {
-      return Status;
+      if (Status == EFI_BAD_BUFFER_SIZE) {
+        Packet->OutTransferLength = (UINT32)(OutDataBufferLength / SataDevice->BlockSize);
+      }
+      goto EXIT_FREE_SLOT;
     }
 
-    // Construct SGEs (32-bit system)
-    SataPort->HostPRB->Sge[0].DataAddressLow  = (UINT32)PhysOutDataBuffer;
-    SataPort->HostPRB->Sge[0].DataAddressHigh = (UINT32)(PhysOutDataBuffer >> 32);
-    SataPort->HostPRB->Sge[0].Attributes      = SGE_TRM; // Only one SGE
-    SataPort->HostPRB->Sge[0].DataCount       = OutDataBufferLength;
-
     // Copy the Ata Command Block
-    CopyMem (&SataPort->HostPRB->Fis, Packet->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
+    CopyMem (&Prb->Fis, Packet->Acb, sizeof (EFI_ATA_COMMAND_BLOCK));
 
     // Fixup the FIS
-    SataPort->HostPRB->Fis.FisType = 0x27; // Register - Host to Device FIS
-    SataPort->HostPRB->Fis.Control = 1 << 7; // Is a command
+    Prb->Fis.FisType = 0x27; // Register - Host to Device FIS
+    Prb->Fis.Control = 1 << 7; // Is a command
     if (FeaturePcdGet (PcdSataSiI3132FeaturePMPSupport)) {
-      SataPort->HostPRB->Fis.Control |= PortMultiplierPort & 0xFF;
+      Prb->Fis.Control |= PortMultiplierPort & 0xFF;
     }
     break;
   case EFI_ATA_PASS_THRU_PROTOCOL_DMA:
@@ -188,105 +510,66 @@ SiI3132AtaPassThruCommand (
     break;
   }
 
-  SataPort->HostPRB->Control = Control;
-  SataPort->HostPRB->ProtocolOverride = Protocol;
+  Prb->Control = Control;
+  Prb->ProtocolOverride = Protocol;
 
-  // Clear IRQ
-  SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, IrqMask);
+  // Do not clear the port interrupt status here: other slots may be in
+  // flight and their completion is harvested from the Slot Status register
 
   if (!FeaturePcdGet (PcdSataSiI3132FeatureDirectCommandIssuing)) {
     // Indirect Command Issuance
+    PhysAddrPRB = SataPort->PhysAddrHostPRB + (Slot * sizeof (SATA_SI3132_PRB));
 
-    //TODO: Find which slot is free (maybe use the Cmd FIFO)
-    //SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_CMDEXECFIFO_REG, &EmptySlot);
-
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (EmptySlot * 8),
-                     (UINT32)(SataPort->PhysAddrHostPRB & 0xFFFFFFFF));
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (EmptySlot * 8) + 4,
-                     (UINT32)((SataPort->PhysAddrHostPRB >> 32) & 0xFFFFFFFF));
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (Slot * 8),
+                     (UINT32)(PhysAddrPRB & 0xFFFFFFFF));
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDACTIV_REG + (Slot * 8) + 4,
+                     (UINT32)((PhysAddrPRB >> 32) & 0xFFFFFFFF));
   } else {
     // Direct Command Issuance
     Status = PciIo->Mem.Write (PciIo, EfiPciIoWidthUint32, 1, // Bar 1
-        SataPort->RegBase + (EmptySlot * 0x80),
+        SataPort->RegBase + (Slot * 0x80),
         sizeof (SATA_SI3132_PRB) / 4,
-        SataPort->HostPRB);
+        Prb);
     ASSERT_EFI_ERROR (Status);
 
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDEXECFIFO_REG, EmptySlot);
+    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_CMDEXECFIFO_REG, Slot);
   }
 
-#if 0
-  // Could need to be implemented if we run multiple command in parallel to know which slot has been completed
-  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_SLOTSTATUS_REG, &Value32);
-  Timeout = Packet->Timeout;
-  while (!Timeout && !Value32) {
-    gBS->Stall (1);
-    SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_SLOTSTATUS_REG, &Value32);
-    Timeout--;
-  }
-#else
-  SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &Value32);
-  if (!Packet->Timeout) {
-    while (!(Value32 & IrqMask)) {
-      gBS->Stall (1);
-      SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &Value32);
-    }
-  } else {
-    Timeout = Packet->Timeout;
-    while (Timeout && !(Value32 & IrqMask)) {
-      gBS->Stall (1);
-      SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, &Value32);
-      Timeout--;
-    }
+  if (Event != NULL) {
+    // Non-blocking command: the periodic harvest timer completes the slot
+    // and signals the event
+    return EFI_SUCCESS;
   }
-#endif
-  // Fill Packet Ata Status Block
-  Status = PciIo->Mem.Read (PciIo, EfiPciIoWidthUint32, 1, // Bar 1
-      SataPort->RegBase + 0x08,
-      sizeof (EFI_ATA_STATUS_BLOCK) / 4,
-      Packet->Asb);
-  ASSERT_EFI_ERROR (Status);
 
-
-  if ((Packet->Timeout != 0) && (Timeout == 0)) {
-    DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() Err:Timeout\n"));
-    //ASSERT (0);
-    return EFI_TIMEOUT;
-  } else if (Value32 & (SII3132_PORT_INT_CMDERR << 16)) {
-    SATA_PORT_READ32 (SataPort->RegBase + SII3132_PORT_CMDERROR_REG, &Error);
-    DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() CmdErr:0x%X (SiI3132 Err:0x%X)\n", Value32, Error));
-    ASSERT (0);
-    return EFI_DEVICE_ERROR;
-  } else if (Value32 & (SII3132_PORT_INT_CMDCOMPL << 16)) {
-    // Clear Command Complete
-    SATA_PORT_WRITE32 (SataPort->RegBase + SII3132_PORT_INTSTATUS_REG, SII3132_PORT_INT_CMDCOMPL << 16);
-
-    if (PciAllocMapping != NULL) {
-      Status = PciIo->Unmap (PciIo, PciAllocMapping);
-      ASSERT (!EFI_ERROR (Status));
+  // Blocking command: poll the harvest loop until our slot completes
+  Timeout = Packet->Timeout;
+  while ((SataPort->SlotsInUse & (1U << Slot)) != 0) {
+    if ((Packet->Timeout != 0) && (Timeout == 0)) {
+      DEBUG ((EFI_D_ERROR, "SiI3132AtaPassThru() Err:Timeout\n"));
+      OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+      if ((SataPort->SlotsInUse & (1U << Slot)) != 0) {
+        SiI3132CompleteSlot (SataPort, Slot, EFI_TIMEOUT);
+      }
+      gBS->RestoreTPL (OldTpl);
+      break;
     }
 
-    // If the command was ATA_CMD_IDENTIFY_DRIVE then we need to update the BlockSize
-    if (Packet->Acb->AtaCommand == ATA_CMD_IDENTIFY_DRIVE) {
-      ATA_IDENTIFY_DATA *IdentifyData = (ATA_IDENTIFY_DATA*)Packet->InDataBuffer;
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+    SiI3132HarvestCompletions (SataPort, FALSE);
+    gBS->RestoreTPL (OldTpl);
 
-      // Get the corresponding Block Device
-      SataDevice = GetSataDevice (SataSiI3132Instance, SataPort->Index, PortMultiplierPort);
-
-      // Check logical block size
-      if ((IdentifyData->phy_logic_sector_support & BIT12) != 0) {
-        ASSERT (SataDevice != NULL);
-        SataDevice->BlockSize = (UINT32) (((IdentifyData->logic_sector_size_hi << 16) |
-                                            IdentifyData->logic_sector_size_lo) * sizeof (UINT16));
-      } else {
-        SataDevice->BlockSize = 0x200;
-      }
-    }
-    return EFI_SUCCESS;
-  } else {
-    ASSERT (0);
-    return EFI_DEVICE_ERROR;
+    gBS->Stall (1);
+    Timeout--;
   }
+
+  return SlotData->Result;
+
+EXIT_FREE_SLOT:
+  SiI3132FreeSlotMappings (SataPort, Slot);
+  SlotData->Packet = NULL;
+  SlotData->Event  = NULL;
+  SataPort->SlotsInUse &= ~(1U << Slot);
+  return Status;
 }
 
 /**
@@ -8,6 +8,7 @@
 
 #include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/CacheMaintenanceLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/DebugLib.h>
 #include <Library/UefiLib.h>
@@ -332,3 +333,212 @@ ElfLoadFile (
 
   return EFI_SUCCESS;
 }
+
+
+/**
+  Stream the loadable segments of an ELF file from an open file handle.
+
+  Only the ELF header, the program header table and the PT_LOAD file extents
+  are read, so the symbol and debug data of large images never transits
+  through memory. Each segment is copied straight from the file into its
+  slot in a runtime staging buffer and cache maintenance is performed per
+  segment as it lands.
+
+  @retval EFI_SUCCESS on success.
+  @retval EFI_UNSUPPORTED if the file is not an ELF image for this platform.
+  @retval EFI_INVALID_PARAMETER if the ELF file is invalid.
+  @retval EFI_DEVICE_ERROR if reading from the file fails.
+**/
+EFI_STATUS
+ElfStreamFile (
+  IN  SHELL_FILE_HANDLE   FileHandle,
+  IN  UINTN               FileSize,
+  OUT VOID              **SegmentData,
+  OUT UINTN              *SegmentDataSize,
+  OUT VOID              **EntryPoint,
+  IN  LIST_ENTRY         *LoadList
+  )
+{
+  EFI_STATUS        Status;
+  UINT8            *ProgramHdrTable;
+  UINT8            *ProgramHdr;
+  UINTN             ProgramHdrSize;
+  UINTN             ReadSize;
+  UINTN             Index;
+  UINTN             StagingSize;
+  UINT8            *Staging;
+  UINTN             StagingOffset;
+  RUNAXF_LOAD_LIST *LoadNode;
+
+  // Large enough for either header class - ElfCheckFile inspects both.
+  UINT8 ElfHdrData[sizeof (Elf64_Ehdr)];
+
+#ifdef MDE_CPU_ARM
+  Elf32_Ehdr  *ElfHdr;
+  Elf32_Phdr  *ProgramHdrPtr;
+#elif defined(MDE_CPU_AARCH64)
+  Elf64_Ehdr  *ElfHdr;
+  Elf64_Phdr  *ProgramHdrPtr;
+#endif
+
+  ASSERT (FileHandle      != NULL);
+  ASSERT (SegmentData     != NULL);
+  ASSERT (SegmentDataSize != NULL);
+  ASSERT (EntryPoint      != NULL);
+  ASSERT (LoadList        != NULL);
+
+  if (FileSize < sizeof (ElfHdrData)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  // Read and validate the ELF header before touching the rest of the file.
+  Status = ShellSetFilePosition (FileHandle, 0);
+  if (EFI_ERROR (Status)) {
+    return EFI_DEVICE_ERROR;
+  }
+  ReadSize = sizeof (ElfHdrData);
+  Status = ShellReadFile (FileHandle, &ReadSize, ElfHdrData);
+  if (EFI_ERROR (Status) || (ReadSize != sizeof (ElfHdrData))) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  Status = ElfCheckFile (ElfHdrData);
+  if (EFI_ERROR (Status)) {
+    return EFI_UNSUPPORTED;
+  }
+#ifdef MDE_CPU_ARM
+  ElfHdr = (Elf32_Ehdr*)ElfHdrData;
+#elif defined(MDE_CPU_AARCH64)
+  ElfHdr = (Elf64_Ehdr*)ElfHdrData;
+#endif
+
+  // Read the whole program header table in one transaction.
+  ProgramHdrSize = (UINTN)ElfHdr->e_phnum * ElfHdr->e_phentsize;
+  ProgramHdrTable = AllocatePool (ProgramHdrSize);
+  if (ProgramHdrTable == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = ShellSetFilePosition (FileHandle, ElfHdr->e_phoff);
+  if (!EFI_ERROR (Status)) {
+    ReadSize = ProgramHdrSize;
+    Status = ShellReadFile (FileHandle, &ReadSize, ProgramHdrTable);
+    if (!EFI_ERROR (Status) && (ReadSize != ProgramHdrSize)) {
+      Status = EFI_DEVICE_ERROR;
+    }
+  }
+  if (EFI_ERROR (Status)) {
+    FreePool (ProgramHdrTable);
+    return EFI_DEVICE_ERROR;
+  }
+
+  // Size the staging buffer from the PT_LOAD file extents only.
+  StagingSize = 0;
+  ProgramHdr = ProgramHdrTable;
+  for (Index = 0; Index < ElfHdr->e_phnum; ++Index) {
+#ifdef MDE_CPU_ARM
+    ProgramHdrPtr = (Elf32_Phdr*)ProgramHdr;
+#elif defined(MDE_CPU_AARCH64)
+    ProgramHdrPtr = (Elf64_Phdr*)ProgramHdr;
+#endif
+    if (ProgramHdrPtr->p_type == PT_LOAD) {
+      if (ProgramHdrPtr->p_filesz > ProgramHdrPtr->p_memsz) {
+        ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_ELFBADFORMAT), gRunAxfHiiHandle);
+        FreePool (ProgramHdrTable);
+        return EFI_INVALID_PARAMETER;
+      }
+      StagingSize += (UINTN)ProgramHdrPtr->p_filesz;
+    }
+    ProgramHdr += ElfHdr->e_phentsize;
+  }
+
+  if (StagingSize == 0) {
+    ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_ELFNOSEG), gRunAxfHiiHandle);
+    FreePool (ProgramHdrTable);
+    return EFI_INVALID_PARAMETER;
+  }
+
+  // 'Runtime' so we can access it after ExitBootServices().
+  Staging = AllocateRuntimePool (StagingSize);
+  if (Staging == NULL) {
+    FreePool (ProgramHdrTable);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  // Stream every loadable segment from the file into its staging slot.
+  StagingOffset = 0;
+  ProgramHdr = ProgramHdrTable;
+  for (Index = 0; Index < ElfHdr->e_phnum; ++Index) {
+#ifdef MDE_CPU_ARM
+    ProgramHdrPtr = (Elf32_Phdr*)ProgramHdr;
+#elif defined(MDE_CPU_AARCH64)
+    ProgramHdrPtr = (Elf64_Phdr*)ProgramHdr;
+#endif
+    if (ProgramHdrPtr->p_type != PT_LOAD) {
+      ProgramHdr += ElfHdr->e_phentsize;
+      continue;
+    }
+
+    if (ProgramHdrPtr->p_filesz != 0) {
+      DEBUG ((EFI_D_INFO, "Streaming segment from file offset 0x%lx to 0x%lx (size = %ld)\n",
+                   ProgramHdrPtr->p_offset, ProgramHdrPtr->p_vaddr, ProgramHdrPtr->p_filesz));
+
+      Status = ShellSetFilePosition (FileHandle, ProgramHdrPtr->p_offset);
+      if (!EFI_ERROR (Status)) {
+        ReadSize = (UINTN)ProgramHdrPtr->p_filesz;
+        Status = ShellReadFile (FileHandle, &ReadSize, Staging + StagingOffset);
+        if (!EFI_ERROR (Status) && (ReadSize != (UINTN)ProgramHdrPtr->p_filesz)) {
+          Status = EFI_DEVICE_ERROR;
+        }
+      }
+      if (EFI_ERROR (Status)) {
+        ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_ELFFAILSEG), gRunAxfHiiHandle);
+        FreePool (ProgramHdrTable);
+        FreePool (Staging);
+        return EFI_DEVICE_ERROR;
+      }
+
+      LoadNode = AllocateRuntimeZeroPool (sizeof (RUNAXF_LOAD_LIST));
+      if (LoadNode == NULL) {
+        FreePool (ProgramHdrTable);
+        FreePool (Staging);
+        return EFI_OUT_OF_RESOURCES;
+      }
+      LoadNode->MemOffset  = (UINTN)ProgramHdrPtr->p_vaddr;
+      LoadNode->FileOffset = (UINTN)(Staging + StagingOffset);
+      LoadNode->Length     = (UINTN)ProgramHdrPtr->p_filesz;
+      InsertTailList (LoadList, &LoadNode->Link);
+
+      // Maintain caches for this segment while its data is still warm,
+      // instead of sweeping the whole buffer at the end.
+      WriteBackDataCacheRange (Staging + StagingOffset, (UINTN)ProgramHdrPtr->p_filesz);
+      InvalidateInstructionCacheRange (Staging + StagingOffset, (UINTN)ProgramHdrPtr->p_filesz);
+
+      StagingOffset += (UINTN)ProgramHdrPtr->p_filesz;
+    }
+
+    if (ProgramHdrPtr->p_memsz > ProgramHdrPtr->p_filesz) {
+      // Extra Node to add the Zeroes (.bss).
+      LoadNode = AllocateRuntimeZeroPool (sizeof (RUNAXF_LOAD_LIST));
+      if (LoadNode == NULL) {
+        FreePool (ProgramHdrTable);
+        FreePool (Staging);
+        return EFI_OUT_OF_RESOURCES;
+      }
+      LoadNode->MemOffset  = (UINTN)ProgramHdrPtr->p_vaddr + (UINTN)ProgramHdrPtr->p_filesz;
+      LoadNode->Zeroes     = TRUE;
+      LoadNode->Length     = (UINTN)(ProgramHdrPtr->p_memsz - ProgramHdrPtr->p_filesz);
+      InsertTailList (LoadList, &LoadNode->Link);
+    }
+
+    ProgramHdr += ElfHdr->e_phentsize;
+  }
+
+  FreePool (ProgramHdrTable);
+
+  *SegmentData     = Staging;
+  *SegmentDataSize = StagingSize;
+  *EntryPoint      = (void*)ElfHdr->e_entry;
+
+  return EFI_SUCCESS;
+}
@@ -55,4 +55,42 @@ ElfLoadFile (
   OUT LIST_ENTRY   *LoadList
   );
 
+
+/**
+  Stream the loadable segments of an ELF file from an open file handle.
+
+  Only the ELF header, the program header table and the PT_LOAD file extents
+  are read, so the symbol and debug data of large images never transits
+  through memory. Each segment is copied straight from the file into its
+  slot in a runtime staging buffer and cache maintenance is performed per
+  segment as it lands.
+
+  @param[in]  FileHandle       Handle of the file to load, positioned at the
+                               start of the file.
+
+  @param[in]  FileSize         Size of the file in bytes.
+
+  @param[out] SegmentData      Will be filled with the address of the runtime
+                               staging buffer holding the segment data. The
+                               caller is responsible for freeing it.
+
+  @param[out] SegmentDataSize  Will be filled with the staging buffer size.
+
+  @param[out] EntryPoint       Will be filled with the ELF entry point address.
+
+  @retval EFI_SUCCESS on success.
+  @retval EFI_UNSUPPORTED if the file is not an ELF image for this platform.
+  @retval EFI_INVALID_PARAMETER if the ELF file is invalid.
+  @retval EFI_DEVICE_ERROR if reading from the file fails.
+**/
+EFI_STATUS
+ElfStreamFile (
+  IN  SHELL_FILE_HANDLE   FileHandle,
+  IN  UINTN               FileSize,
+  OUT VOID              **SegmentData,
+  OUT UINTN              *SegmentDataSize,
+  OUT VOID              **EntryPoint,
+  IN  LIST_ENTRY         *LoadList
+  );
+
 #endif // ELF_LOADER_H
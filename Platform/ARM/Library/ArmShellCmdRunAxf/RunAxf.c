@@ -143,10 +143,12 @@ ShellDynCmdRunAxfHandler (
   CHAR16                      *TmpFileName;
   CHAR16                      *TmpChar16;
   EFI_LOADED_IMAGE_PROTOCOL   *LoadedImage;
+  BOOLEAN                     Streamed;
 
   ShellStatus = SHELL_SUCCESS;
   FileHandle = NULL;
   FileData = NULL;
+  Streamed = FALSE;
   InitializeListHead (&LoadList);
 
   // Only install if they are not there yet? First time or every time?
@@ -219,24 +221,42 @@ ShellDynCmdRunAxfHandler (
         FreePool (Info);
 
         //
-        // Allocate buffer to read file. 'Runtime' so we can access it after
-        // ExitBootServices().
+        // If this is an ELF image, stream the loadable segments straight
+        // from the file: only the program headers and PT_LOAD extents are
+        // read, so the symbol and debug data of large images is never
+        // pulled into memory at all.
         //
-        FileData = AllocateRuntimeZeroPool (FileSize);
-        if (FileData == NULL) {
-          ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_NO_MEM), gRunAxfHiiHandle);
-          ShellStatus = SHELL_OUT_OF_RESOURCES;
-        } else {
+        Status = ElfStreamFile (FileHandle, FileSize, &FileData, &FileSize,
+                                &Entrypoint, &LoadList);
+        if (!EFI_ERROR (Status)) {
+          Streamed = TRUE;
+        } else if (Status == EFI_UNSUPPORTED) {
           //
-          // Read file into Buffer
+          // Not an ELF image - read the whole file so the BootMonFS loader
+          // can look at it. 'Runtime' so we can access it after
+          // ExitBootServices().
           //
-          Status = ShellReadFile (FileHandle, &FileSize, FileData);
-          if (EFI_ERROR (Status)) {
-            ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_READ_FAIL), gRunAxfHiiHandle);
-            SHELL_FREE_NON_NULL (FileData);
-            FileData = NULL;
-            ShellStatus = SHELL_DEVICE_ERROR;
+          ShellSetFilePosition (FileHandle, 0);
+          FileData = AllocateRuntimeZeroPool (FileSize);
+          if (FileData == NULL) {
+            ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_NO_MEM), gRunAxfHiiHandle);
+            ShellStatus = SHELL_OUT_OF_RESOURCES;
+          } else {
+            //
+            // Read file into Buffer
+            //
+            Status = ShellReadFile (FileHandle, &FileSize, FileData);
+            if (EFI_ERROR (Status)) {
+              ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_READ_FAIL), gRunAxfHiiHandle);
+              SHELL_FREE_NON_NULL (FileData);
+              FileData = NULL;
+              ShellStatus = SHELL_DEVICE_ERROR;
+            }
           }
+        } else {
+          // A valid ELF image that failed to stream - do not fall back.
+          ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_READ_FAIL), gRunAxfHiiHandle);
+          ShellStatus = SHELL_DEVICE_ERROR;
         }
       }
     }
@@ -248,38 +268,34 @@ ShellDynCmdRunAxfHandler (
   }
 
   // We have a file in memory. Try to work out if we can use it.
-  // It can either be in ELF format or BootMonFS format.
-  if (FileData != NULL) {
-    // Do some validation on the file before we try to load it. The file can
-    // either be an proper ELF file or one processed by the FlashLoader.
+  // ELF images were already streamed above; anything else can only be in
+  // BootMonFS format.
+  if ((FileData != NULL) && !Streamed) {
+    // Do some validation on the file before we try to load it.
     // Since the data might need to go to various locations in memory we cannot
     // load the data directly while UEFI is running. We use the file loaders to
     // populate a linked list of data and load addresses. This is processed and
     // data copied to where it needs to go after calling ExitBootServices. At
     // that stage we've reached the point of no return, so overwriting UEFI code
     // does not make a difference.
-    Status = ElfCheckFile (FileData);
+    Status = BootMonFsCheckFile ((EFI_FILE_HANDLE)FileHandle);
     if (!EFI_ERROR (Status)) {
       // Load program into memory
-      Status = ElfLoadFile ((VOID*)FileData, &Entrypoint, &LoadList);
+      Status = BootMonFsLoadFile ((EFI_FILE_HANDLE)FileHandle,
+                                  (VOID*)FileData, &Entrypoint, &LoadList);
     } else {
-      // Try to see if it is a BootMonFs executable
-      Status = BootMonFsCheckFile ((EFI_FILE_HANDLE)FileHandle);
-      if (!EFI_ERROR (Status)) {
-        // Load program into memory
-        Status = BootMonFsLoadFile ((EFI_FILE_HANDLE)FileHandle,
-                                    (VOID*)FileData, &Entrypoint, &LoadList);
-      } else {
-        ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_BAD_FILE),
-                         gRunAxfHiiHandle);
-        SHELL_FREE_NON_NULL (FileData);
-        ShellStatus = SHELL_UNSUPPORTED;
-      }
+      ShellPrintHiiEx (-1, -1, NULL, STRING_TOKEN (STR_RUNAXF_BAD_FILE),
+                       gRunAxfHiiHandle);
+      SHELL_FREE_NON_NULL (FileData);
+      ShellStatus = SHELL_UNSUPPORTED;
     }
   }
 
-  WriteBackDataCacheRange (FileData, FileSize);
-  InvalidateInstructionCacheRange (FileData, FileSize);
+  // The streamed ELF path already maintained caches segment by segment.
+  if ((FileData != NULL) && !Streamed) {
+    WriteBackDataCacheRange (FileData, FileSize);
+    InvalidateInstructionCacheRange (FileData, FileSize);
+  }
 
   // Program load list created.
   // Shutdown UEFI, copy and jump to code.
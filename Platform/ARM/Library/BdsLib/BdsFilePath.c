@@ -21,6 +21,16 @@
 #define IS_DEVICE_PATH_NODE(node,type,subtype)    \
         (((node)->Type == (type)) && ((node)->SubType == (subtype)))
 
+//
+// Resolution cache for boot device paths that needed the removable-device
+// fallback. The variable stores the original device path followed by the
+// resolved one, so the next boot can replay the minimal connect directly
+// instead of connecting every driver in the system to find the device again.
+//
+#define BDS_DP_CACHE_VARIABLE_NAME  L"BdsResolvedDevicePath"
+
+STATIC CONST EFI_GUID mBdsDevicePathCacheGuid = { 0xf25c6a31, 0x4a92, 0x4b4f, { 0xb2, 0x55, 0x9e, 0x74, 0x1d, 0x08, 0xc6, 0x3e } };
+
 #define MAX_TFTP_FILE_SIZE    0x01000000
 
 /* Type and defines to set up the DHCP4 options */
@@ -336,6 +346,90 @@ TryRemovableDevice (
   return Status;
 }
 
+/**
+  Return the resolved device path a previous boot cached for DevicePath,
+  or NULL when there is no cached entry or it was made for another path.
+
+  The caller is responsible for freeing the returned device path.
+**/
+STATIC
+EFI_DEVICE_PATH*
+BdsGetCachedDevicePath (
+  IN EFI_DEVICE_PATH*  DevicePath
+  )
+{
+  EFI_STATUS        Status;
+  UINT8            *Data;
+  UINTN             DataSize;
+  UINTN             OriginalSize;
+  EFI_DEVICE_PATH*  ResolvedDevicePath;
+
+  DataSize = 0;
+  Status = gRT->GetVariable (BDS_DP_CACHE_VARIABLE_NAME,
+                  (EFI_GUID*)&mBdsDevicePathCacheGuid, NULL, &DataSize, NULL);
+  if (Status != EFI_BUFFER_TOO_SMALL) {
+    return NULL;
+  }
+
+  Data = AllocatePool (DataSize);
+  if (Data == NULL) {
+    return NULL;
+  }
+
+  Status = gRT->GetVariable (BDS_DP_CACHE_VARIABLE_NAME,
+                  (EFI_GUID*)&mBdsDevicePathCacheGuid, NULL, &DataSize, Data);
+  if (EFI_ERROR (Status)) {
+    FreePool (Data);
+    return NULL;
+  }
+
+  // The cache entry only applies if it was recorded for the same request.
+  OriginalSize = GetDevicePathSize (DevicePath);
+  if ((DataSize <= OriginalSize) ||
+      (CompareMem (Data, DevicePath, OriginalSize) != 0)) {
+    FreePool (Data);
+    return NULL;
+  }
+
+  ResolvedDevicePath = DuplicateDevicePath ((EFI_DEVICE_PATH*)(Data + OriginalSize));
+  FreePool (Data);
+  return ResolvedDevicePath;
+}
+
+/**
+  Record the resolution of DevicePath into ResolvedDevicePath so the next
+  boot can replay it without walking and connecting every device.
+**/
+STATIC
+VOID
+BdsSetCachedDevicePath (
+  IN EFI_DEVICE_PATH*  DevicePath,
+  IN EFI_DEVICE_PATH*  ResolvedDevicePath
+  )
+{
+  UINT8  *Data;
+  UINTN   OriginalSize;
+  UINTN   ResolvedSize;
+
+  OriginalSize = GetDevicePathSize (DevicePath);
+  ResolvedSize = GetDevicePathSize (ResolvedDevicePath);
+
+  Data = AllocatePool (OriginalSize + ResolvedSize);
+  if (Data == NULL) {
+    return;
+  }
+  CopyMem (Data, DevicePath, OriginalSize);
+  CopyMem (Data + OriginalSize, ResolvedDevicePath, ResolvedSize);
+
+  // Best effort - resolution still works without the cache.
+  gRT->SetVariable (BDS_DP_CACHE_VARIABLE_NAME,
+         (EFI_GUID*)&mBdsDevicePathCacheGuid,
+         EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+         OriginalSize + ResolvedSize, Data);
+
+  FreePool (Data);
+}
+
 STATIC
 EFI_STATUS
 BdsConnectAndUpdateDevicePath (
@@ -409,8 +503,51 @@ BdsConnectAndUpdateDevicePath (
     //TODO: Should we just return success and leave the caller decide if it is the expected RemainingPath
     Status = EFI_SUCCESS;
   } else {
+    // Before the full removable-device walk, try to replay the resolution
+    // a previous boot cached for this device path. When the boot target
+    // has not changed this connects just the one device chain; the replay
+    // only succeeds if the cached path resolves completely.
+    NewDevicePath = BdsGetCachedDevicePath (*DevicePath);
+    if (NewDevicePath != NULL) {
+      PreviousHandle = NULL;
+      do {
+        Remaining = NewDevicePath;
+        Status = gBS->LocateDevicePath (&gEfiDevicePathProtocolGuid, &Remaining, Handle);
+        if (!EFI_ERROR (Status)) {
+          if (*Handle == PreviousHandle) {
+            // No forward progress: the cached resolution is stale.
+            Status = EFI_NOT_FOUND;
+          } else {
+            PreviousHandle = *Handle;
+            Status = gBS->ConnectController (*Handle, NULL, Remaining, FALSE);
+          }
+        }
+      } while (!EFI_ERROR (Status) && !IsDevicePathEnd (Remaining));
+
+      // The replay is good only if the path resolved completely or all
+      // that is left is the media portion (eg: the file path) which the
+      // image loaders consume themselves.
+      Remaining = NewDevicePath;
+      Status = gBS->LocateDevicePath (&gEfiDevicePathProtocolGuid, &Remaining, Handle);
+      if (!EFI_ERROR (Status) &&
+          (IsDevicePathEnd (Remaining) ||
+           (DevicePathType (Remaining) == MEDIA_DEVICE_PATH))) {
+        // Connect the remaining Driver Binding Protocols (such as DiskIo
+        // and SimpleFileSystem) on the final handle.
+        gBS->ConnectController (*Handle, NULL, Remaining, FALSE);
+        *DevicePath = NewDevicePath;
+        if (RemainingDevicePath != NULL) {
+          *RemainingDevicePath = DuplicateDevicePath (Remaining);
+        }
+        return EFI_SUCCESS;
+      }
+      // Cached resolution no longer matches - fall back to the full walk.
+      FreePool (NewDevicePath);
+    }
+
     Status = TryRemovableDevice (*DevicePath, Handle, &NewDevicePath);
     if (!EFI_ERROR (Status)) {
+      BdsSetCachedDevicePath (*DevicePath, NewDevicePath);
       Status = BdsConnectAndUpdateDevicePath (&NewDevicePath, Handle, RemainingDevicePath);
       *DevicePath = NewDevicePath;
       return Status;
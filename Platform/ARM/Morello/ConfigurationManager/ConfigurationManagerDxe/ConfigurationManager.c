@@ -398,6 +398,71 @@ EDKII_COMMON_PLATFORM_REPOSITORY_INFO CommonPlatformInfo = {
   },
 };
 
+/** A slice of the common platform repository arena.
+*/
+typedef struct CmObjectSlice {
+  /// Offset of the object(s) in EDKII_COMMON_PLATFORM_REPOSITORY_INFO
+  UINT16  Offset;
+
+  /// Total size of the object(s); zero marks an unmapped Object ID
+  UINT16  Size;
+
+  /// Number of objects
+  UINT16  Count;
+} CM_OBJECT_SLICE;
+
+/** Helper macros for populating the object map below.
+*/
+#define CM_SLICE_COUNT(Field)  (UINT16)ARRAY_SIZE (                \
+  ((EDKII_COMMON_PLATFORM_REPOSITORY_INFO *)0)->Field)
+
+#define CM_SLICE_ENTRY(ObjId, Field, ObjCount)                     \
+  [ObjId] = {                                                      \
+    OFFSET_OF (EDKII_COMMON_PLATFORM_REPOSITORY_INFO, Field),      \
+    sizeof (((EDKII_COMMON_PLATFORM_REPOSITORY_INFO *)0)->Field),  \
+    (ObjCount)                                                     \
+  }
+
+/** The precompiled ARM namespace object map: for each Object ID the slice
+    of the common repository arena holding the object(s), allowing GetObject
+    to resolve the common requests with a single indexed lookup.
+
+    Objects that require token handling (EArmObjCmRef) and the FVP/SoC
+    platform specific objects served by GetArmNameSpaceObjectPlat() are
+    deliberately absent and are resolved by the existing handlers in
+    GetArmNameSpaceObject().
+*/
+STATIC CONST CM_OBJECT_SLICE ArmNameSpaceObjectMap[EArmObjMax] = {
+  CM_SLICE_ENTRY (EArmObjBootArchInfo, BootArchInfo, 1),
+#ifdef HEADLESS_PLATFORM
+  CM_SLICE_ENTRY (EArmObjFixedFeatureFlags, FixedFeatureFlags, 1),
+#endif
+  CM_SLICE_ENTRY (EArmObjPowerManagementProfileInfo, PmProfileInfo, 1),
+  CM_SLICE_ENTRY (EArmObjGenericTimerInfo, GenericTimerInfo, 1),
+  CM_SLICE_ENTRY (EArmObjPlatformGenericWatchdogInfo, Watchdog, 1),
+  CM_SLICE_ENTRY (
+    EArmObjPlatformGTBlockInfo,
+    GTBlockInfo,
+    CM_SLICE_COUNT (GTBlockInfo)
+    ),
+  CM_SLICE_ENTRY (
+    EArmObjGTBlockTimerFrameInfo,
+    GTBlock0TimerInfo,
+    CM_SLICE_COUNT (GTBlock0TimerInfo)
+    ),
+  CM_SLICE_ENTRY (EArmObjGicCInfo, GicCInfo, CM_SLICE_COUNT (GicCInfo)),
+  CM_SLICE_ENTRY (EArmObjGicDInfo, GicDInfo, 1),
+  CM_SLICE_ENTRY (EArmObjGicRedistributorInfo, GicRedistInfo, 1),
+  CM_SLICE_ENTRY (EArmObjSerialConsolePortInfo, SpcrSerialPort, 1),
+  CM_SLICE_ENTRY (EArmObjSerialDebugPortInfo, DbgSerialPort, 1),
+  CM_SLICE_ENTRY (
+    EArmObjProcHierarchyInfo,
+    ProcHierarchyInfo,
+    CM_SLICE_COUNT (ProcHierarchyInfo)
+    ),
+  CM_SLICE_ENTRY (EArmObjCacheInfo, CacheInfo, CM_SLICE_COUNT (CacheInfo))
+};
+
 /** A helper function for returning the Configuration Manager Objects.
 
   @param [in]       CmObjectId     The Configuration Manager Object ID.
@@ -788,6 +853,7 @@ GetArmNameSpaceObject (
 {
   EFI_STATUS                               Status;
   EDKII_COMMON_PLATFORM_REPOSITORY_INFO  * CommonPlatRepo;
+  CONST CM_OBJECT_SLICE                  * Slice;
 
   if ((This == NULL) || (CmObject == NULL)) {
     ASSERT (This != NULL);
@@ -801,6 +867,23 @@ GetArmNameSpaceObject (
   Status = GetArmNameSpaceObjectPlat (This, CmObjectId, Token, CmObject);
 
   if (Status == EFI_NOT_FOUND) {
+    //
+    // Resolve the common objects through the precompiled object map.
+    //
+    if ((Token == CM_NULL_TOKEN) &&
+        (GET_CM_OBJECT_ID (CmObjectId) < ARRAY_SIZE (ArmNameSpaceObjectMap))) {
+      Slice = &ArmNameSpaceObjectMap[GET_CM_OBJECT_ID (CmObjectId)];
+      if (Slice->Size != 0) {
+        return HandleCmObject (
+                 CmObjectId,
+                 (VOID*)((UINT8*)CommonPlatRepo + Slice->Offset),
+                 Slice->Size,
+                 Slice->Count,
+                 CmObject
+                 );
+      }
+    }
+
     switch (GET_CM_OBJECT_ID (CmObjectId)) {
       case EArmObjBootArchInfo:
         Status = HandleCmObject (
@@ -359,6 +359,65 @@ EDKII_PLATFORM_REPOSITORY_INFO VExpressPlatRepositoryInfo = {
   },
 };
 
+/** A slice of the platform repository arena.
+*/
+typedef struct CmObjectSlice {
+  /// Offset of the object(s) in EDKII_PLATFORM_REPOSITORY_INFO
+  UINT16  Offset;
+
+  /// Total size of the object(s); zero marks an unmapped Object ID
+  UINT16  Size;
+
+  /// Number of objects
+  UINT16  Count;
+} CM_OBJECT_SLICE;
+
+/** Helper macros for populating the object map below.
+*/
+#define CM_SLICE_COUNT(Field)  (UINT16)ARRAY_SIZE (                \
+  ((EDKII_PLATFORM_REPOSITORY_INFO *)0)->Field)
+
+#define CM_SLICE_ENTRY(ObjId, Field, ObjCount)                     \
+  [ObjId] = {                                                      \
+    OFFSET_OF (EDKII_PLATFORM_REPOSITORY_INFO, Field),             \
+    sizeof (((EDKII_PLATFORM_REPOSITORY_INFO *)0)->Field),         \
+    (ObjCount)                                                     \
+  }
+
+/** The precompiled ARM namespace object map: for each Object ID the slice
+    of the static repository arena holding the object(s), allowing GetObject
+    to resolve the common requests with a single indexed lookup.
+
+    Objects that require token handling and the IORT/PCIe objects whose
+    presence depends on the FVP revision are deliberately absent and are
+    resolved by the switch in GetArmNameSpaceObject().
+*/
+STATIC CONST CM_OBJECT_SLICE ArmNameSpaceObjectMap[EArmObjMax] = {
+  CM_SLICE_ENTRY (EArmObjBootArchInfo, BootArchInfo, 1),
+#ifdef HEADLESS_PLATFORM
+  CM_SLICE_ENTRY (EArmObjFixedFeatureFlags, FixedFeatureFlags, 1),
+#endif
+  CM_SLICE_ENTRY (EArmObjPowerManagementProfileInfo, PmProfileInfo, 1),
+  CM_SLICE_ENTRY (EArmObjGenericTimerInfo, GenericTimerInfo, 1),
+  CM_SLICE_ENTRY (EArmObjPlatformGenericWatchdogInfo, Watchdog, 1),
+  CM_SLICE_ENTRY (
+    EArmObjPlatformGTBlockInfo,
+    GTBlockInfo,
+    CM_SLICE_COUNT (GTBlockInfo)
+    ),
+  CM_SLICE_ENTRY (
+    EArmObjGTBlockTimerFrameInfo,
+    GTBlock0TimerInfo,
+    CM_SLICE_COUNT (GTBlock0TimerInfo)
+    ),
+  CM_SLICE_ENTRY (EArmObjGicCInfo, GicCInfo, CM_SLICE_COUNT (GicCInfo)),
+  CM_SLICE_ENTRY (EArmObjGicDInfo, GicDInfo, 1),
+  CM_SLICE_ENTRY (EArmObjGicRedistributorInfo, GicRedistInfo, 1),
+  CM_SLICE_ENTRY (EArmObjSerialConsolePortInfo, SpcrSerialPort, 1),
+  CM_SLICE_ENTRY (EArmObjSerialDebugPortInfo, DbgSerialPort, 1),
+  CM_SLICE_ENTRY (EArmObjGicItsInfo, GicItsInfo, 1)
+};
+
 /** A helper function for returning the Configuration Manager Objects.
 
   @param [in]       CmObjectId     The Configuration Manager Object ID.
@@ -718,6 +777,7 @@ GetArmNameSpaceObject (
 {
   EFI_STATUS                        Status;
   EDKII_PLATFORM_REPOSITORY_INFO  * PlatformRepo;
+  CONST CM_OBJECT_SLICE           * Slice;
   UINTN                             Smmuv3Count;
   UINTN                             ItsGroupCount;
   UINTN                             ItsIdentifierArrayCount;
@@ -734,6 +794,25 @@ GetArmNameSpaceObject (
   Status = EFI_NOT_FOUND;
   PlatformRepo = This->PlatRepoInfo;
 
+  //
+  // Resolve objects present in the precompiled object map with a direct
+  // Object ID indexed lookup. Requests carrying a token and objects absent
+  // from the map fall through to the switch below.
+  //
+  if ((Token == CM_NULL_TOKEN) &&
+      (GET_CM_OBJECT_ID (CmObjectId) < ARRAY_SIZE (ArmNameSpaceObjectMap))) {
+    Slice = &ArmNameSpaceObjectMap[GET_CM_OBJECT_ID (CmObjectId)];
+    if (Slice->Size != 0) {
+      return HandleCmObject (
+               CmObjectId,
+               (VOID*)((UINT8*)PlatformRepo + Slice->Offset),
+               Slice->Size,
+               Slice->Count,
+               CmObject
+               );
+    }
+  }
+
   if ((PlatformRepo->SysId & ARM_FVP_SYS_ID_REV_MASK) ==
        ARM_FVP_BASE_REVC_REV) {
     Smmuv3Count = 1;
@@ -0,0 +1,104 @@
+/** @file
+*
+*  PlatformPeiLib for the Versatile Express platforms: publishes the HOB
+*  describing the DXE firmware volume, optionally shadowing the volume
+*  to DRAM first.
+*
+*  Copyright (c) 2024, ARM Limited. All rights reserved.
+*
+*  SPDX-License-Identifier: BSD-2-Clause-Patent
+*
+**/
+
+#include <PiPei.h>
+
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/HobLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/PeiServicesLib.h>
+
+#include <Ppi/MemoryDiscovered.h>
+
+STATIC
+EFI_STATUS
+EFIAPI
+ShadowFvToDram (
+  IN EFI_PEI_SERVICES           **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  );
+
+STATIC CONST EFI_PEI_NOTIFY_DESCRIPTOR mMemoryDiscoveredNotify = {
+  EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK | EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST,
+  &gEfiPeiMemoryDiscoveredPpiGuid,
+  ShadowFvToDram
+};
+
+/**
+  Copy the DXE firmware volume out of NOR flash and describe the copy to
+  the DXE core.
+
+  Runs once permanent memory has been installed, so every subsequent FFS
+  read and decompression of the volume happens at DRAM speed instead of
+  being limited by the NOR fetch latency. If the shadow cannot be
+  allocated the volume is left to execute in place.
+
+  @param[in]  PeiServices       Pointer to the PEI Services table.
+  @param[in]  NotifyDescriptor  Pointer to the notification descriptor.
+  @param[in]  Ppi               Pointer to the installed PPI.
+
+  @retval EFI_SUCCESS           A firmware volume HOB has been built.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+ShadowFvToDram (
+  IN EFI_PEI_SERVICES           **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  )
+{
+  VOID    *Shadow;
+  UINT32  FvSize;
+
+  FvSize = PcdGet32 (PcdFvSize);
+
+  Shadow = AllocatePages (EFI_SIZE_TO_PAGES (FvSize));
+  if (Shadow == NULL) {
+    DEBUG ((DEBUG_WARN,
+      "Failed to allocate 0x%x bytes for the FV shadow, executing in place.\n",
+      FvSize));
+    BuildFvHob (PcdGet64 (PcdFvBaseAddress), FvSize);
+    return EFI_SUCCESS;
+  }
+
+  CopyMem (Shadow, (VOID *)(UINTN)PcdGet64 (PcdFvBaseAddress), FvSize);
+  BuildFvHob ((EFI_PHYSICAL_ADDRESS)(UINTN)Shadow, FvSize);
+
+  DEBUG ((DEBUG_INFO, "DXE FV shadowed from 0x%lx to 0x%p (0x%x bytes).\n",
+    PcdGet64 (PcdFvBaseAddress), Shadow, FvSize));
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+PlatformPeim (
+  VOID
+  )
+{
+  if (FeaturePcdGet (PcdNorFlashShadowFv)) {
+    //
+    // Postpone building the firmware volume HOB until permanent memory
+    // is available to hold the shadow.
+    //
+    return PeiServicesNotifyPpi (&mMemoryDiscoveredNotify);
+  }
+
+  BuildFvHob (PcdGet64 (PcdFvBaseAddress), PcdGet32 (PcdFvSize));
+
+  return EFI_SUCCESS;
+}
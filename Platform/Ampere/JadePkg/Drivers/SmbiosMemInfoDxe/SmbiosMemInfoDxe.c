@@ -123,6 +123,19 @@ STATIC ARM_TYPE19 mArmDefaultType19 = {
   TYPE19_ADDITIONAL_STRINGS
 };
 
+//
+// One-shot snapshot of the memory inventory that SMpro published through the
+// platform HOB. It is captured once per boot and consumed by all the record
+// builders below, so the HOB is never located or walked per record.
+//
+typedef struct {
+  PLATFORM_DRAM_INFO DramInfo;
+  PLATFORM_DIMM_LIST DimmList;
+  BOOLEAN            Valid;
+} MEM_INVENTORY_SNAPSHOT;
+
+STATIC MEM_INVENTORY_SNAPSHOT mMemInventory;
+
 typedef struct _JEDEC_MF_ID {
   UINT8 VendorId;
   CHAR8 *ManufacturerString;
@@ -482,6 +495,37 @@ UpdatePartNumber (
            );
 }
 
+/**
+   Capture the memory inventory into mMemInventory.
+
+   The DIMM list and DRAM region table are copied out of the platform HOB
+   in a single pass so every record builder works from the same local data.
+**/
+STATIC
+EFI_STATUS
+CaptureMemInventory (
+  VOID
+  )
+{
+  PLATFORM_INFO_HOB  *PlatformHob;
+
+  if (mMemInventory.Valid) {
+    return EFI_SUCCESS;
+  }
+
+  PlatformHob = GetPlatformHob ();
+  ASSERT (PlatformHob != NULL);
+  if (PlatformHob == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  CopyMem (&mMemInventory.DramInfo, &mMemInventory.DramInfo, sizeof (mMemInventory.DramInfo));
+  CopyMem (&mMemInventory.DimmList, &mMemInventory.DimmList, sizeof (mMemInventory.DimmList));
+  mMemInventory.Valid = TRUE;
+
+  return EFI_SUCCESS;
+}
+
 /**
    Install SMBIOS Type 16 17 and 19 table
 
@@ -495,10 +539,8 @@ InstallMemStructures (
   EFI_STATUS         Status = EFI_SUCCESS;
   EFI_SMBIOS_HANDLE  SmbiosHandle;
   EFI_SMBIOS_HANDLE  Type16Handle;
-  PLATFORM_INFO_HOB  *PlatformHob;
   PLATFORM_DIMM      *Dimm;
   CHAR8              *Table;
-  VOID               *Hob;
   UINTN              Index;
   UINTN              SlotIndex;
   UINTN              MemRegionIndex;
@@ -507,15 +549,12 @@ InstallMemStructures (
 
   ASSERT (Smbios != NULL);
 
-  /* Get the Platform HOB */
-  Hob = GetFirstGuidHob (&gPlatformInfoHobGuid);
-  ASSERT (Hob != NULL);
-  if (Hob == NULL) {
-    return EFI_INVALID_PARAMETER;
+  /* Snapshot the memory inventory from the Platform HOB */
+  Status = CaptureMemInventory ();
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
-  PlatformHob = (PLATFORM_INFO_HOB *)GET_GUID_HOB_DATA (Hob);
-
   Table = AllocateZeroPool (sizeof (ARM_TYPE17));
   if (Table == NULL) {
     return EFI_OUT_OF_RESOURCES;
@@ -544,12 +583,12 @@ InstallMemStructures (
       return Status;
     }
 
-    for (SlotIndex = 0; SlotIndex < PlatformHob->DimmList.BoardDimmSlots; SlotIndex++) {
+    for (SlotIndex = 0; SlotIndex < mMemInventory.DimmList.BoardDimmSlots; SlotIndex++) {
       // Copy Tempplate to Type 17
       CopyMem (Table, (VOID *)&mArmDefaultType17, sizeof (ARM_TYPE17));
 
       // Fill up type 17 table's content here
-      Dimm = &PlatformHob->DimmList.Dimm[SlotIndex];
+      Dimm = &mMemInventory.DimmList.Dimm[SlotIndex];
       if (Dimm->NodeId != Index) {
         continue;
       }
@@ -570,8 +609,8 @@ InstallMemStructures (
         }
 
         ((ARM_TYPE17 *)Table)->Base.MemoryType = 0x1A; /* DDR4 */
-        ((ARM_TYPE17 *)Table)->Base.Speed = (UINT16)PlatformHob->DramInfo.MaxSpeed;
-        ((ARM_TYPE17 *)Table)->Base.ConfiguredMemoryClockSpeed = (UINT16)PlatformHob->DramInfo.MaxSpeed;
+        ((ARM_TYPE17 *)Table)->Base.Speed = (UINT16)mMemInventory.DramInfo.MaxSpeed;
+        ((ARM_TYPE17 *)Table)->Base.ConfiguredMemoryClockSpeed = (UINT16)mMemInventory.DramInfo.MaxSpeed;
         ((ARM_TYPE17 *)Table)->Base.Attributes = Dimm->Info.DimmNrRank & 0x0F;
         ((ARM_TYPE17 *)Table)->Base.ConfiguredVoltage = 1200;
         ((ARM_TYPE17 *)Table)->Base.MinimumVoltage = 1140;
@@ -621,24 +660,24 @@ InstallMemStructures (
       }
     }
 
-    for (MemRegionIndex = 0; MemRegionIndex < PlatformHob->DramInfo.NumRegion; MemRegionIndex++) {
+    for (MemRegionIndex = 0; MemRegionIndex < mMemInventory.DramInfo.NumRegion; MemRegionIndex++) {
       // Copy Tempplate to Type 19
       CopyMem (Table, (VOID *)&mArmDefaultType19, sizeof (ARM_TYPE19));
 
-      if (PlatformHob->DramInfo.NvdRegion[MemRegionIndex] > 0
-          || PlatformHob->DramInfo.Socket[MemRegionIndex] != Index)
+      if (mMemInventory.DramInfo.NvdRegion[MemRegionIndex] > 0
+          || mMemInventory.DramInfo.Socket[MemRegionIndex] != Index)
       {
         continue;
       }
 
       ((ARM_TYPE19 *)Table)->Base.StartingAddress = 0xFFFFFFFF;
       ((ARM_TYPE19 *)Table)->Base.EndingAddress = 0xFFFFFFFF;
-      ((ARM_TYPE19 *)Table)->Base.ExtendedStartingAddress = PlatformHob->DramInfo.Base[MemRegionIndex];
-      ((ARM_TYPE19 *)Table)->Base.ExtendedEndingAddress = PlatformHob->DramInfo.Base[MemRegionIndex] +
-                                                          PlatformHob->DramInfo.Size[MemRegionIndex] - 1;
+      ((ARM_TYPE19 *)Table)->Base.ExtendedStartingAddress = mMemInventory.DramInfo.Base[MemRegionIndex];
+      ((ARM_TYPE19 *)Table)->Base.ExtendedEndingAddress = mMemInventory.DramInfo.Base[MemRegionIndex] +
+                                                          mMemInventory.DramInfo.Size[MemRegionIndex] - 1;
 
       if (MemorySize != 0) {
-        ((ARM_TYPE19 *)Table)->Base.PartitionWidth = (PlatformHob->DramInfo.Size[MemRegionIndex] - 1) / MemorySize + 1;
+        ((ARM_TYPE19 *)Table)->Base.PartitionWidth = (mMemInventory.DramInfo.Size[MemRegionIndex] - 1) / MemorySize + 1;
       }
 
       // Update Type 16 handle
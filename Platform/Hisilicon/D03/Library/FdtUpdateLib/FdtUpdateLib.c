@@ -53,6 +53,18 @@ CHAR8  *EthName[8]=
  "ethernet@6","ethernet@7"
 };
 
+//
+// Offsets of the nodes patched below, collected in one pass over the
+// "soc" node. The offsets stay valid as long as properties are only
+// rewritten in place; any fallback to fdt_delprop()/fdt_setprop()
+// shifts the tree and must rebuild the index.
+//
+typedef struct {
+  INTN  SocNode;
+  INTN  EthNode[ARRAY_SIZE (EthName)];
+  INTN  RefClkNode;
+} FDT_NODE_INDEX;
+
 UINT8 DawNum[4] = {0, 0, 0, 0};
 PHY_MEM_REGION    *NodemRegion[4] = {NULL, NULL, NULL, NULL};
 UINTN  NumaPages[4] = {0, 0, 0, 0};
@@ -122,21 +134,60 @@ GetMacAddress (UINT32 Port)
     return EFI_SUCCESS;
 }
 
+STATIC
+VOID
+BuildNodeIndex (
+  IN  VOID            *Fdt,
+  OUT FDT_NODE_INDEX  *NodeIndex
+  )
+{
+  CONST CHAR8  *Name;
+  INTN         Node;
+  UINT8        Port;
+
+  NodeIndex->RefClkNode = -FDT_ERR_NOTFOUND;
+  for (Port = 0; Port < ARRAY_SIZE (EthName); Port++) {
+    NodeIndex->EthNode[Port] = -FDT_ERR_NOTFOUND;
+  }
+
+  NodeIndex->SocNode = fdt_subnode_offset (Fdt, 0, "soc");
+  if (NodeIndex->SocNode < 0) {
+    return;
+  }
+
+  for (Node = fdt_first_subnode (Fdt, NodeIndex->SocNode);
+       Node >= 0;
+       Node = fdt_next_subnode (Fdt, Node)) {
+    Name = fdt_get_name (Fdt, Node, NULL);
+    if (Name == NULL) {
+      continue;
+    }
+    if (AsciiStrCmp (Name, "refclk") == 0) {
+      NodeIndex->RefClkNode = Node;
+      continue;
+    }
+    for (Port = 0; Port < ARRAY_SIZE (EthName); Port++) {
+      if (AsciiStrCmp (Name, EthName[Port]) == 0) {
+        NodeIndex->EthNode[Port] = Node;
+        break;
+      }
+    }
+  }
+}
+
 STATIC
 EFI_STATUS
-DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
+DelPhyhandleUpdateMacAddress(IN VOID* Fdt, IN OUT FDT_NODE_INDEX *NodeIndex)
 {
     UINT8               port;
     INTN                ethernetnode;
-    INTN                node;
     INTN                Error;
     struct              fdt_property *m_prop;
     int                 m_oldlen;
     EFI_STATUS          Status = EFI_SUCCESS;
     EFI_STATUS          GetMacStatus = EFI_SUCCESS;
 
-    node = fdt_subnode_offset(Fdt, 0, "soc");
-    if (node < 0)
+    if (NodeIndex->SocNode < 0)
     {
         DEBUG ((EFI_D_ERROR, "can not find soc root node\n"));
         return EFI_INVALID_PARAMETER;
@@ -146,7 +197,7 @@ DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
         for( port=0; port<8; port++ )
         {
             GetMacStatus= GetMacAddress(port);
-            ethernetnode = fdt_subnode_offset(Fdt, node,EthName[port]);
+            ethernetnode = NodeIndex->EthNode[port];
             if(!EFI_ERROR(GetMacStatus))
             {
 
@@ -159,17 +210,28 @@ DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
                 m_prop = fdt_get_property_w(Fdt, ethernetnode, "local-mac-address", &m_oldlen);
                 if(m_prop)
                 {
-                    Error = fdt_delprop(Fdt, ethernetnode, "local-mac-address");
+                    //
+                    // The MAC address is the same length as the existing
+                    // property, so it can be patched without shifting the
+                    // tree and the node index stays valid.
+                    //
+                    Error = fdt_setprop_inplace(Fdt, ethernetnode, "local-mac-address",gMacAddress,sizeof(MAC_ADDRESS));
                     if (Error)
                     {
-                        DEBUG ((EFI_D_ERROR, "ERROR:fdt_delprop() Local-mac-address: %a\n", fdt_strerror (Error)));
-                        Status = EFI_INVALID_PARAMETER;
-                    }
-                    Error = fdt_setprop(Fdt, ethernetnode, "local-mac-address",gMacAddress,sizeof(MAC_ADDRESS));
-                    if (Error)
-                    {
-                        DEBUG ((EFI_D_ERROR, "ERROR:fdt_setprop():local-mac-address %a\n", fdt_strerror (Error)));
-                        Status = EFI_INVALID_PARAMETER;
+                        Error = fdt_delprop(Fdt, ethernetnode, "local-mac-address");
+                        if (Error)
+                        {
+                            DEBUG ((EFI_D_ERROR, "ERROR:fdt_delprop() Local-mac-address: %a\n", fdt_strerror (Error)));
+                            Status = EFI_INVALID_PARAMETER;
+                        }
+                        Error = fdt_setprop(Fdt, ethernetnode, "local-mac-address",gMacAddress,sizeof(MAC_ADDRESS));
+                        if (Error)
+                        {
+                            DEBUG ((EFI_D_ERROR, "ERROR:fdt_setprop():local-mac-address %a\n", fdt_strerror (Error)));
+                            Status = EFI_INVALID_PARAMETER;
+                        }
+                        // The tree has shifted, refresh the node offsets
+                        BuildNodeIndex (Fdt, NodeIndex);
                     }
                 }
             }
@@ -180,7 +242,7 @@ DelPhyhandleUpdateMacAddress(IN VOID* Fdt)
 
 STATIC
 EFI_STATUS
-UpdateRefClk (IN VOID* Fdt)
+UpdateRefClk (IN VOID* Fdt, IN OUT FDT_NODE_INDEX *NodeIndex)
 {
   INTN                node;
   INTN                Error;
@@ -196,13 +258,12 @@ UpdateRefClk (IN VOID* Fdt)
     return EFI_INVALID_PARAMETER;
   }
 
-  node = fdt_subnode_offset(Fdt, 0, "soc");
-  if (node < 0) {
+  if (NodeIndex->SocNode < 0) {
     DEBUG ((DEBUG_ERROR, "can not find soc node\n"));
     return EFI_INVALID_PARAMETER;
   }
 
-  node = fdt_subnode_offset(Fdt, node, "refclk");
+  node = NodeIndex->RefClkNode;
   if (node < 0) {
     DEBUG ((DEBUG_ERROR, "can not find refclk node\n"));
     return EFI_INVALID_PARAMETER;
@@ -214,19 +275,31 @@ UpdateRefClk (IN VOID* Fdt)
     return EFI_INVALID_PARAMETER;
   }
 
-  Error = fdt_delprop(Fdt, node, Property);
-  if (Error) {
-    DEBUG ((DEBUG_ERROR, "ERROR: fdt_delprop() %a: %a\n", Property, fdt_strerror (Error)));
-    return EFI_INVALID_PARAMETER;
-  }
-
   // UINT32 is enough for refclk data length
   Data = (UINT32) ArchTimerFreq;
   Data = cpu_to_fdt32 (Data);
-  Error = fdt_setprop(Fdt, node, Property, &Data, sizeof(Data));
+
+  //
+  // The property is a single cell, so patch it in place and only fall
+  // back to a tree-shifting delete/insert if the existing property has
+  // an unexpected length.
+  //
+  Error = fdt_setprop_inplace(Fdt, node, Property, &Data, sizeof(Data));
   if (Error) {
-    DEBUG ((DEBUG_ERROR, "ERROR:fdt_setprop() %a: %a\n", Property, fdt_strerror (Error)));
-    return EFI_INVALID_PARAMETER;
+    Error = fdt_delprop(Fdt, node, Property);
+    if (Error) {
+      DEBUG ((DEBUG_ERROR, "ERROR: fdt_delprop() %a: %a\n", Property, fdt_strerror (Error)));
+      return EFI_INVALID_PARAMETER;
+    }
+
+    Error = fdt_setprop(Fdt, node, Property, &Data, sizeof(Data));
+    if (Error) {
+      DEBUG ((DEBUG_ERROR, "ERROR:fdt_setprop() %a: %a\n", Property, fdt_strerror (Error)));
+      return EFI_INVALID_PARAMETER;
+    }
+
+    // The tree has shifted, refresh the node offsets
+    BuildNodeIndex (Fdt, NodeIndex);
   }
 
   DEBUG ((DEBUG_INFO, "Update refclk successfully.\n"));
@@ -416,6 +489,7 @@ EFI_STATUS EFIFdtUpdate(UINTN FdtFileAddr)
     UINTN               NewFdtBlobBase;
     EFI_STATUS          Status = EFI_SUCCESS;
     EFI_STATUS          UpdateNumaStatus = EFI_SUCCESS;
+    FDT_NODE_INDEX      NodeIndex;
 
 
     Error = fdt_check_header ((VOID*)(FdtFileAddr));
@@ -444,14 +518,18 @@ EFI_STATUS EFIFdtUpdate(UINTN FdtFileAddr)
     }
 
     Fdt = (VOID*)(UINTN)NewFdtBlobBase;
-    Status = DelPhyhandleUpdateMacAddress(Fdt);
+
+    // Locate every node patched below in a single scan of the tree
+    BuildNodeIndex (Fdt, &NodeIndex);
+
+    Status = DelPhyhandleUpdateMacAddress(Fdt, &NodeIndex);
     if (EFI_ERROR (Status))
     {
         DEBUG ((EFI_D_ERROR, "DelPhyhandleUpdateMacAddress fail:\n"));
         Status = EFI_SUCCESS;
     }
 
-    Status =  UpdateRefClk (Fdt);
+    Status =  UpdateRefClk (Fdt, &NodeIndex);
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "UpdateiRefClk fail.\n"));
     }
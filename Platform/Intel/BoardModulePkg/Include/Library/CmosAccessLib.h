@@ -9,6 +9,85 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #ifndef _CMOS_ACCESS_LIB_H_
 #define _CMOS_ACCESS_LIB_H_
 
+//
+// Number of CMOS locations covered by a transaction, both banks.
+//
+#define CMOS_TRANSACTION_SIZE  0x100
+
+//
+// Shadow buffer for batched CMOS updates. The caller owns the storage and
+// must treat the content as opaque; use the CmosTransaction functions below.
+//
+typedef struct {
+  UINT8    Data[CMOS_TRANSACTION_SIZE];
+  UINT8    Original[CMOS_TRANSACTION_SIZE];
+  UINT8    Valid[CMOS_TRANSACTION_SIZE / 8];
+  UINT8    Dirty[CMOS_TRANSACTION_SIZE / 8];
+} CMOS_TRANSACTION;
+
+/**
+  Start a CMOS transaction.
+
+  Reads and writes against the transaction are served from a shadow buffer
+  that fills from CMOS on first use; nothing is written back until
+  CmosTransactionCommit().
+
+  @param [out] Transaction Caller allocated transaction to initialize.
+**/
+VOID
+EFIAPI
+CmosTransactionStart (
+  OUT CMOS_TRANSACTION *Transaction
+  );
+
+/**
+  Read a byte value through a CMOS transaction.
+
+  @param [in] Transaction The transaction to read through.
+  @param [in] Address     Location to read from CMOS.
+
+  @return The byte value at the CMOS address, including any value written
+          to this transaction but not committed yet.
+**/
+UINT8
+EFIAPI
+CmosTransactionRead8 (
+  IN OUT CMOS_TRANSACTION *Transaction,
+  IN     UINT8            Address
+  );
+
+/**
+  Write a byte value into a CMOS transaction.
+
+  The value is held in the shadow buffer until CmosTransactionCommit().
+
+  @param [in] Transaction The transaction to write into.
+  @param [in] Address     Location to write to CMOS.
+  @param [in] Data        The byte value write to the CMOS address.
+**/
+VOID
+EFIAPI
+CmosTransactionWrite8 (
+  IN OUT CMOS_TRANSACTION *Transaction,
+  IN     UINT8            Address,
+  IN     UINT8            Data
+  );
+
+/**
+  Commit a CMOS transaction.
+
+  Writes only the bytes whose value actually changed and updates the
+  checksum once for the whole batch. The transaction stays valid and can
+  accumulate further writes after the commit.
+
+  @param [in] Transaction The transaction to commit.
+**/
+VOID
+EFIAPI
+CmosTransactionCommit (
+  IN OUT CMOS_TRANSACTION *Transaction
+  );
+
 /**
   Read a byte value from a CMOS address.
 
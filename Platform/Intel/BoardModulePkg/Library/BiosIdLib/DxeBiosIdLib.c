@@ -22,6 +22,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <Guid/BiosId.h>
 
+//
+// The BIOS ID image never changes after build, so capture it on the first
+// successful lookup and serve every later request from the copy instead of
+// walking the HOB list or traversing firmware volumes again.
+//
+BOOLEAN        mBiosIdImageCached = FALSE;
+BIOS_ID_IMAGE  mBiosIdImageCache;
+
 /**
   This function returns BIOS ID by searching HOB or FV.
   It also debug print the BIOS ID found.
@@ -55,11 +63,19 @@ GetBiosId (
     BiosIdImage = &TempBiosIdImage;
   }
 
+  if (mBiosIdImageCached) {
+    CopyMem ((VOID *) BiosIdImage, &mBiosIdImageCache, sizeof (BIOS_ID_IMAGE));
+    return EFI_SUCCESS;
+  }
+
   Address = GetFirstGuidHob (&gBiosIdGuid);
   if (Address != NULL) {
     Size = sizeof (BIOS_ID_IMAGE);
     CopyMem ((VOID *) BiosIdImage, GET_GUID_HOB_DATA (Address), Size);
 
+    CopyMem (&mBiosIdImageCache, (VOID *) BiosIdImage, sizeof (BIOS_ID_IMAGE));
+    mBiosIdImageCached = TRUE;
+
     DEBUG ((EFI_D_INFO, "DXE get BIOS ID from HOB successfully\n"));
     DEBUG ((EFI_D_INFO, "BIOS ID: %s\n", (CHAR16 *) (&(BiosIdImage->BiosIdString))));
     return EFI_SUCCESS;
@@ -83,6 +99,9 @@ GetBiosId (
     //
     FreePool (Address);
 
+    CopyMem (&mBiosIdImageCache, (VOID *) BiosIdImage, sizeof (BIOS_ID_IMAGE));
+    mBiosIdImageCached = TRUE;
+
     DEBUG ((EFI_D_INFO, "DXE get BIOS ID from FV successfully\n"));
     DEBUG ((EFI_D_INFO, "BIOS ID: %s\n", (CHAR16 *) (&(BiosIdImage->BiosIdString))));
     return EFI_SUCCESS;
@@ -264,20 +264,17 @@ CmosAccessLibWriteChecksum (
 /**
   Read a byte value from a CMOS address.
 
+  It's an internal function that doesn't check accessibility.
+
   @param [in] Address   Location to read from CMOS
 
   @return The byte value read from the CMOS address.
 **/
 UINT8
-EFIAPI
-CmosRead8 (
+CmosAccessLibICmosRead8 (
   IN  UINT8 Address
   )
 {
-  if (!CmosAccessLibIsAccessible (Address, CmosAccessLibLocateEntry (Address))) {
-    return 0xFF;
-  }
-
   if (Address <= CMOS_BANK0_LIMIT) {
     if (PlatformCmosGetNmiState ()) {
       Address |= BIT7;
@@ -290,6 +287,26 @@ CmosRead8 (
   }
 }
 
+/**
+  Read a byte value from a CMOS address.
+
+  @param [in] Address   Location to read from CMOS
+
+  @return The byte value read from the CMOS address.
+**/
+UINT8
+EFIAPI
+CmosRead8 (
+  IN  UINT8 Address
+  )
+{
+  if (!CmosAccessLibIsAccessible (Address, CmosAccessLibLocateEntry (Address))) {
+    return 0xFF;
+  }
+
+  return CmosAccessLibICmosRead8 (Address);
+}
+
 /**
   Write a byte value to a CMOS address.
 
@@ -357,6 +374,154 @@ CmosWrite8 (
   }
 }
 
+/**
+  Fill a transaction shadow byte from CMOS on first use.
+
+  It's an internal function that doesn't check accessibility.
+
+  @param [in] Transaction The transaction to fill.
+  @param [in] Address     The CMOS address to fill.
+**/
+VOID
+CmosTransactionLoadByte (
+  IN OUT CMOS_TRANSACTION *Transaction,
+  IN     UINT8            Address
+  )
+{
+  if ((Transaction->Valid[Address >> 3] & (1 << (Address & 7))) == 0) {
+    Transaction->Data[Address]        = CmosAccessLibICmosRead8 (Address);
+    Transaction->Original[Address]    = Transaction->Data[Address];
+    Transaction->Valid[Address >> 3] |= (UINT8) (1 << (Address & 7));
+  }
+}
+
+/**
+  Start a CMOS transaction.
+
+  Reads and writes against the transaction are served from a shadow buffer
+  that fills from CMOS on first use; nothing is written back until
+  CmosTransactionCommit().
+
+  @param [out] Transaction Caller allocated transaction to initialize.
+**/
+VOID
+EFIAPI
+CmosTransactionStart (
+  OUT CMOS_TRANSACTION *Transaction
+  )
+{
+  ZeroMem (Transaction->Valid, sizeof (Transaction->Valid));
+  ZeroMem (Transaction->Dirty, sizeof (Transaction->Dirty));
+}
+
+/**
+  Read a byte value through a CMOS transaction.
+
+  @param [in] Transaction The transaction to read through.
+  @param [in] Address     Location to read from CMOS.
+
+  @return The byte value at the CMOS address, including any value written
+          to this transaction but not committed yet.
+**/
+UINT8
+EFIAPI
+CmosTransactionRead8 (
+  IN OUT CMOS_TRANSACTION *Transaction,
+  IN     UINT8            Address
+  )
+{
+  if (!CmosAccessLibIsAccessible (Address, CmosAccessLibLocateEntry (Address))) {
+    return 0xFF;
+  }
+
+  CmosTransactionLoadByte (Transaction, Address);
+  return Transaction->Data[Address];
+}
+
+/**
+  Write a byte value into a CMOS transaction.
+
+  The value is held in the shadow buffer until CmosTransactionCommit().
+
+  @param [in] Transaction The transaction to write into.
+  @param [in] Address     Location to write to CMOS.
+  @param [in] Data        The byte value write to the CMOS address.
+**/
+VOID
+EFIAPI
+CmosTransactionWrite8 (
+  IN OUT CMOS_TRANSACTION *Transaction,
+  IN     UINT8            Address,
+  IN     UINT8            Data
+  )
+{
+  if (!CmosAccessLibIsAccessible (Address, CmosAccessLibLocateEntry (Address))) {
+    return;
+  }
+
+  //
+  // Keep the original value so the commit can skip unchanged bytes and
+  // compute the checksum adjustment for the whole batch.
+  //
+  CmosTransactionLoadByte (Transaction, Address);
+  Transaction->Data[Address]        = Data;
+  Transaction->Dirty[Address >> 3] |= (UINT8) (1 << (Address & 7));
+}
+
+/**
+  Commit a CMOS transaction.
+
+  Writes only the bytes whose value actually changed and updates the
+  checksum once for the whole batch. The transaction stays valid and can
+  accumulate further writes after the commit.
+
+  @param [in] Transaction The transaction to commit.
+**/
+VOID
+EFIAPI
+CmosTransactionCommit (
+  IN OUT CMOS_TRANSACTION *Transaction
+  )
+{
+  UINTN                       Address;
+  UINT16                      Delta;
+  CMOS_ENTRY                  *Entry;
+  CMOS_CHECKSUM_LOCATION_INFO ChecksumLocation;
+
+  Delta = 0;
+  for (Address = 0; Address <= CMOS_BANK1_LIMIT; Address++) {
+    if ((Transaction->Dirty[Address >> 3] & (1 << (Address & 7))) == 0) {
+      continue;
+    }
+    Transaction->Dirty[Address >> 3] &= (UINT8) ~(1 << (Address & 7));
+
+    if (Transaction->Data[Address] == Transaction->Original[Address]) {
+      continue;
+    }
+
+    CmosAccessLibICmosWrite8 ((UINT8) Address, Transaction->Data[Address]);
+
+    Entry = CmosAccessLibLocateEntry ((UINT8) Address);
+    if (CmosAccessLibNeedChecksum ((UINT8) Address, Entry)) {
+      Delta += (UINT16) (Transaction->Data[Address] - Transaction->Original[Address]);
+    }
+
+    Transaction->Original[Address] = Transaction->Data[Address];
+  }
+
+  if (Delta != 0) {
+    //
+    // Same adjustment as CmosWrite8() does per byte, applied once for
+    // the accumulated difference of all committed bytes.
+    //
+    CmosAccessLibGetChecksumLocation (&ChecksumLocation);
+    CmosAccessLibWriteChecksum (
+      &ChecksumLocation,
+      CmosAccessLibReadChecksum (&ChecksumLocation) - Delta
+      );
+  }
+}
+
 /**
   Read a word value from a CMOS address.
 
@@ -386,8 +551,12 @@ CmosWrite16 (
   IN UINT16 Data
   )
 {
-  CmosWrite8 (Address, (UINT8) Data);
-  CmosWrite8 (Address + 1, (UINT8) (Data >> 8));
+  CMOS_TRANSACTION            Transaction;
+
+  CmosTransactionStart (&Transaction);
+  CmosTransactionWrite8 (&Transaction, Address, (UINT8) Data);
+  CmosTransactionWrite8 (&Transaction, Address + 1, (UINT8) (Data >> 8));
+  CmosTransactionCommit (&Transaction);
 }
 
 /**
@@ -419,8 +588,14 @@ CmosWrite32 (
   IN UINT32 Data
   )
 {
-  CmosWrite16 (Address, (UINT16) Data);
-  CmosWrite16 (Address + 2, (UINT16) (Data >> 16));
+  CMOS_TRANSACTION            Transaction;
+  UINT8                       Index;
+
+  CmosTransactionStart (&Transaction);
+  for (Index = 0; Index < sizeof (Data); Index++) {
+    CmosTransactionWrite8 (&Transaction, Address + Index, (UINT8) (Data >> (8 * Index)));
+  }
+  CmosTransactionCommit (&Transaction);
 }
 
 
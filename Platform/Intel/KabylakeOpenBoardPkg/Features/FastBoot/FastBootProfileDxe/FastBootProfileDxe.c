@@ -0,0 +1,408 @@
+/** @file
+  Fast Boot Profile Driver : This driver persists the enumeration results
+  of a boot in a versioned variable and validates them on the next boot,
+  so boots with an unchanged configuration can take a fast path.
+
+Copyright (c) 2026, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/PerformanceLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+#include <Library/UefiLib.h>
+#include <Protocol/PciIo.h>
+#include <Protocol/UsbIo.h>
+#include <IndustryStandard/Pci.h>
+#include <Register/Cpuid.h>
+#include <FastBootProfile.h>
+
+GLOBAL_REMOVE_IF_UNREFERENCED BOOLEAN  mFastBootProfileValid = FALSE;
+
+/**
+  Compute the hash of the configuration inputs which would force a full
+  re-enumeration when they change.
+
+  @return The configuration hash.
+**/
+UINT32
+ComputeConfigHash (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINT32      ConfigData[2];
+  UINT32      ConfigHash;
+
+  AsmCpuid (CPUID_VERSION_INFO, &ConfigData[0], NULL, NULL, NULL);
+  ConfigData[1] = (UINT32) PcdGet8 (PcdSaMiscUserBd);
+
+  ConfigHash = 0;
+  Status = gBS->CalculateCrc32 (ConfigData, sizeof (ConfigData), &ConfigHash);
+  ASSERT_EFI_ERROR (Status);
+
+  return ConfigHash;
+}
+
+/**
+  Validate the fast boot profile variable saved by the previous boot.
+
+  The profile is accepted only when the signature, version, length, CRC32
+  and configuration hash all match.
+
+  @retval TRUE   The profile is present and valid.
+  @retval FALSE  The profile is absent, stale or corrupted.
+**/
+BOOLEAN
+ValidateFastBootProfile (
+  VOID
+  )
+{
+  EFI_STATUS                Status;
+  FAST_BOOT_PROFILE_HEADER  *Profile;
+  UINTN                     ProfileSize;
+  UINT32                    StoredCrc32;
+  UINT32                    Crc32;
+  UINTN                     RecordsSize;
+  BOOLEAN                   Valid;
+
+  Profile = NULL;
+  ProfileSize = 0;
+  Status = GetVariable2 (
+             FAST_BOOT_PROFILE_VARIABLE_NAME,
+             &gFastBootProfileVariableGuid,
+             (VOID **) &Profile,
+             &ProfileSize
+             );
+  if (EFI_ERROR (Status) || (Profile == NULL)) {
+    DEBUG ((DEBUG_INFO, "FastBootProfile: no profile variable - %r\n", Status));
+    return FALSE;
+  }
+
+  Valid = FALSE;
+  do {
+    if (ProfileSize < sizeof (FAST_BOOT_PROFILE_HEADER)) {
+      DEBUG ((DEBUG_INFO, "FastBootProfile: profile too small (0x%x)\n", ProfileSize));
+      break;
+    }
+    if (Profile->Signature != FAST_BOOT_PROFILE_SIGNATURE) {
+      DEBUG ((DEBUG_INFO, "FastBootProfile: bad signature\n"));
+      break;
+    }
+    if (Profile->Version != FAST_BOOT_PROFILE_VERSION) {
+      DEBUG ((DEBUG_INFO, "FastBootProfile: version %d, expected %d\n", Profile->Version, FAST_BOOT_PROFILE_VERSION));
+      break;
+    }
+    RecordsSize = Profile->PciDeviceCount * sizeof (FAST_BOOT_PROFILE_PCI_DEVICE) +
+                  Profile->UsbDeviceCount * sizeof (FAST_BOOT_PROFILE_USB_DEVICE);
+    if ((Profile->TotalLength != ProfileSize) ||
+        (Profile->TotalLength != sizeof (FAST_BOOT_PROFILE_HEADER) + RecordsSize)) {
+      DEBUG ((DEBUG_INFO, "FastBootProfile: inconsistent length\n"));
+      break;
+    }
+
+    StoredCrc32 = Profile->Crc32;
+    Profile->Crc32 = 0;
+    Crc32 = 0;
+    Status = gBS->CalculateCrc32 (Profile, ProfileSize, &Crc32);
+    Profile->Crc32 = StoredCrc32;
+    if (EFI_ERROR (Status) || (Crc32 != StoredCrc32)) {
+      DEBUG ((DEBUG_INFO, "FastBootProfile: CRC mismatch\n"));
+      break;
+    }
+
+    if (Profile->ConfigHash != ComputeConfigHash ()) {
+      DEBUG ((DEBUG_INFO, "FastBootProfile: config hash mismatch\n"));
+      break;
+    }
+
+    Valid = TRUE;
+  } while (FALSE);
+
+  if (!Valid) {
+    //
+    // Automatic fallback: drop the stale profile so the slow path is taken
+    // and a fresh profile is collected at ReadyToBoot.
+    //
+    gRT->SetVariable (
+           FAST_BOOT_PROFILE_VARIABLE_NAME,
+           &gFastBootProfileVariableGuid,
+           0,
+           0,
+           NULL
+           );
+  }
+
+  FreePool (Profile);
+  return Valid;
+}
+
+/**
+  Collect the enumeration results of this boot into a fast boot profile.
+
+  @param[out] ProfileSize  The size of the collected profile in bytes.
+
+  @return The collected profile. The caller must free it.
+  @retval NULL  No resource to collect the profile.
+**/
+FAST_BOOT_PROFILE_HEADER *
+CollectFastBootProfile (
+  OUT UINTN  *ProfileSize
+  )
+{
+  EFI_STATUS                    Status;
+  EFI_HANDLE                    *HandleBuffer;
+  UINTN                         HandleCount;
+  UINTN                         Index;
+  EFI_PCI_IO_PROTOCOL           *PciIo;
+  EFI_USB_IO_PROTOCOL           *UsbIo;
+  EFI_USB_DEVICE_DESCRIPTOR     DeviceDescriptor;
+  EFI_USB_INTERFACE_DESCRIPTOR  InterfaceDescriptor;
+  UINTN                         Segment;
+  UINTN                         Bus;
+  UINTN                         Device;
+  UINTN                         Function;
+  UINT32                        PciId;
+  UINTN                         PciHandleCount;
+  UINTN                         UsbHandleCount;
+  FAST_BOOT_PROFILE_HEADER      *Profile;
+  FAST_BOOT_PROFILE_PCI_DEVICE  *PciRecord;
+  FAST_BOOT_PROFILE_USB_DEVICE  *UsbRecord;
+  UINTN                         Columns;
+  UINTN                         Rows;
+  UINT32                        Crc32;
+
+  PciHandleCount = 0;
+  UsbHandleCount = 0;
+
+  Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiPciIoProtocolGuid, NULL, &PciHandleCount, &HandleBuffer);
+  if (!EFI_ERROR (Status)) {
+    FreePool (HandleBuffer);
+  } else {
+    PciHandleCount = 0;
+  }
+  Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiUsbIoProtocolGuid, NULL, &UsbHandleCount, &HandleBuffer);
+  if (!EFI_ERROR (Status)) {
+    FreePool (HandleBuffer);
+  } else {
+    UsbHandleCount = 0;
+  }
+
+  *ProfileSize = sizeof (FAST_BOOT_PROFILE_HEADER) +
+                 PciHandleCount * sizeof (FAST_BOOT_PROFILE_PCI_DEVICE) +
+                 UsbHandleCount * sizeof (FAST_BOOT_PROFILE_USB_DEVICE);
+  Profile = AllocateZeroPool (*ProfileSize);
+  if (Profile == NULL) {
+    return NULL;
+  }
+
+  Profile->Signature   = FAST_BOOT_PROFILE_SIGNATURE;
+  Profile->Version     = FAST_BOOT_PROFILE_VERSION;
+  Profile->ConfigHash  = ComputeConfigHash ();
+  Profile->ConOutMode  = -1;
+
+  PciRecord = (FAST_BOOT_PROFILE_PCI_DEVICE *) (Profile + 1);
+  Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiPciIoProtocolGuid, NULL, &HandleCount, &HandleBuffer);
+  if (!EFI_ERROR (Status)) {
+    for (Index = 0; (Index < HandleCount) && (Profile->PciDeviceCount < PciHandleCount); Index++) {
+      Status = gBS->HandleProtocol (HandleBuffer[Index], &gEfiPciIoProtocolGuid, (VOID **) &PciIo);
+      if (EFI_ERROR (Status)) {
+        continue;
+      }
+      Status = PciIo->GetLocation (PciIo, &Segment, &Bus, &Device, &Function);
+      if (EFI_ERROR (Status)) {
+        continue;
+      }
+      Status = PciIo->Pci.Read (PciIo, EfiPciIoWidthUint32, PCI_VENDOR_ID_OFFSET, 1, &PciId);
+      if (EFI_ERROR (Status)) {
+        continue;
+      }
+      PciRecord->Segment  = (UINT16) Segment;
+      PciRecord->Bus      = (UINT8) Bus;
+      PciRecord->Device   = (UINT8) Device;
+      PciRecord->Function = (UINT8) Function;
+      PciRecord->VendorId = (UINT16) PciId;
+      PciRecord->DeviceId = (UINT16) (PciId >> 16);
+      PciRecord++;
+      Profile->PciDeviceCount++;
+    }
+    FreePool (HandleBuffer);
+  }
+
+  UsbRecord = (FAST_BOOT_PROFILE_USB_DEVICE *) PciRecord;
+  Status = gBS->LocateHandleBuffer (ByProtocol, &gEfiUsbIoProtocolGuid, NULL, &HandleCount, &HandleBuffer);
+  if (!EFI_ERROR (Status)) {
+    for (Index = 0; (Index < HandleCount) && (Profile->UsbDeviceCount < UsbHandleCount); Index++) {
+      Status = gBS->HandleProtocol (HandleBuffer[Index], &gEfiUsbIoProtocolGuid, (VOID **) &UsbIo);
+      if (EFI_ERROR (Status)) {
+        continue;
+      }
+      Status = UsbIo->UsbGetDeviceDescriptor (UsbIo, &DeviceDescriptor);
+      if (EFI_ERROR (Status)) {
+        continue;
+      }
+      UsbRecord->VendorId  = DeviceDescriptor.IdVendor;
+      UsbRecord->ProductId = DeviceDescriptor.IdProduct;
+      Status = UsbIo->UsbGetInterfaceDescriptor (UsbIo, &InterfaceDescriptor);
+      if (!EFI_ERROR (Status)) {
+        UsbRecord->InterfaceClass = InterfaceDescriptor.InterfaceClass;
+      }
+      UsbRecord++;
+      Profile->UsbDeviceCount++;
+    }
+    FreePool (HandleBuffer);
+  }
+
+  if ((gST->ConOut != NULL) && (gST->ConOut->Mode != NULL)) {
+    Profile->ConOutMode = gST->ConOut->Mode->Mode;
+    Status = gST->ConOut->QueryMode (gST->ConOut, gST->ConOut->Mode->Mode, &Columns, &Rows);
+    if (!EFI_ERROR (Status)) {
+      Profile->ConOutColumns = (UINT32) Columns;
+      Profile->ConOutRows    = (UINT32) Rows;
+    }
+  }
+
+  //
+  // The record area may be smaller than the initial handle counts if some
+  // handles disappeared between the two passes. Trim the length accordingly.
+  //
+  Profile->TotalLength = (UINT32) (sizeof (FAST_BOOT_PROFILE_HEADER) +
+                                   Profile->PciDeviceCount * sizeof (FAST_BOOT_PROFILE_PCI_DEVICE) +
+                                   Profile->UsbDeviceCount * sizeof (FAST_BOOT_PROFILE_USB_DEVICE));
+  *ProfileSize = Profile->TotalLength;
+
+  Profile->Crc32 = 0;
+  Crc32 = 0;
+  Status = gBS->CalculateCrc32 (Profile, *ProfileSize, &Crc32);
+  ASSERT_EFI_ERROR (Status);
+  Profile->Crc32 = Crc32;
+
+  return Profile;
+}
+
+/**
+  ReadyToBoot callback to persist the fast boot profile of this boot.
+
+  The variable is rewritten only when the enumeration results changed, so
+  the 95% case of identical boots does not wear the flash.
+
+  @param[in]  Event    The event that triggered this notification function.
+  @param[in]  Context  Pointer to the notification function's context.
+**/
+VOID
+EFIAPI
+OnReadyToBootSaveProfile (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  EFI_STATUS                Status;
+  FAST_BOOT_PROFILE_HEADER  *Profile;
+  UINTN                     ProfileSize;
+  FAST_BOOT_PROFILE_HEADER  *OldProfile;
+  UINTN                     OldProfileSize;
+
+  gBS->CloseEvent (Event);
+
+  Profile = CollectFastBootProfile (&ProfileSize);
+  if (Profile == NULL) {
+    return;
+  }
+  DEBUG ((DEBUG_INFO, "FastBootProfile: collected %d PCI / %d USB devices, ConOut mode %d\n",
+    Profile->PciDeviceCount, Profile->UsbDeviceCount, Profile->ConOutMode));
+
+  OldProfile = NULL;
+  OldProfileSize = 0;
+  Status = GetVariable2 (
+             FAST_BOOT_PROFILE_VARIABLE_NAME,
+             &gFastBootProfileVariableGuid,
+             (VOID **) &OldProfile,
+             &OldProfileSize
+             );
+  if (!EFI_ERROR (Status) && (OldProfile != NULL)) {
+    if ((OldProfileSize == ProfileSize) &&
+        (CompareMem (OldProfile, Profile, ProfileSize) == 0)) {
+      DEBUG ((DEBUG_INFO, "FastBootProfile: unchanged, variable not rewritten\n"));
+      FreePool (OldProfile);
+      FreePool (Profile);
+      return;
+    }
+    FreePool (OldProfile);
+  }
+
+  Status = gRT->SetVariable (
+                  FAST_BOOT_PROFILE_VARIABLE_NAME,
+                  &gFastBootProfileVariableGuid,
+                  EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                  ProfileSize,
+                  Profile
+                  );
+  DEBUG ((DEBUG_INFO, "FastBootProfile: profile saved - %r\n", Status));
+
+  FreePool (Profile);
+}
+
+/**
+  Entry point for the driver.
+
+  This routine validates the fast boot profile of the previous boot,
+  short-circuits the matching init flows when it is valid and registers
+  a ReadyToBoot callback to refresh the profile.
+
+  @param[in]  ImageHandle    An image handle.
+  @param[in]  SystemTable    A pointer to the system table.
+
+  @retval     EFI_SUCCESS.
+**/
+EFI_STATUS
+EFIAPI
+FastBootProfileEntryPoint (
+  IN EFI_HANDLE                   ImageHandle,
+  IN EFI_SYSTEM_TABLE             *SystemTable
+  )
+{
+  EFI_STATUS  Status;
+  EFI_EVENT   ReadyToBootEvent;
+
+  DEBUG ((DEBUG_INFO, "FastBootProfile Entry\n"));
+
+  mFastBootProfileValid = ValidateFastBootProfile ();
+  PcdSetBoolS (PcdFastBootProfileValid, mFastBootProfileValid);
+
+  //
+  // Leave an FPDT record pair distinguishing fast path boots from slow
+  // path boots, so boot time regressions can be attributed to profile
+  // invalidation.
+  //
+  if (mFastBootProfileValid) {
+    PERF_START_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x7040);
+    PERF_END_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x7041);
+    //
+    // The console topology is known to be unchanged; connect console
+    // input devices on demand instead of re-enumerating all of them.
+    //
+    PcdSetBoolS (PcdConInConnectOnDemand, TRUE);
+    DEBUG ((DEBUG_INFO, "FastBootProfile: profile valid, taking fast path\n"));
+  } else {
+    PERF_START_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x7042);
+    PERF_END_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x7043);
+    DEBUG ((DEBUG_INFO, "FastBootProfile: no valid profile, taking slow path\n"));
+  }
+
+  Status = EfiCreateEventReadyToBootEx (
+             TPL_CALLBACK,
+             OnReadyToBootSaveProfile,
+             NULL,
+             &ReadyToBootEvent
+             );
+  ASSERT_EFI_ERROR (Status);
+
+  return EFI_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/** @file
+  Header file for the fast boot profile feature.
+
+  The fast boot profile is a versioned snapshot of the enumeration results
+  of the previous boot (PCI resource map, USB topology, console mode). It is
+  persisted in a non-volatile variable and validated by a configuration hash
+  so that unchanged boots can short-circuit the matching init flows.
+
+  Copyright (c) 2026, Intel Corporation. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _FAST_BOOT_PROFILE_H_
+#define _FAST_BOOT_PROFILE_H_
+
+#define FAST_BOOT_PROFILE_SIGNATURE      SIGNATURE_32 ('F', 'B', 'P', 'F')
+#define FAST_BOOT_PROFILE_VERSION        1
+
+#define FAST_BOOT_PROFILE_VARIABLE_NAME  L"FastBootProfile"
+
+#pragma pack(1)
+
+///
+/// Header of the fast boot profile variable.
+/// The device records immediately follow the header: PciDeviceCount
+/// FAST_BOOT_PROFILE_PCI_DEVICE records, then UsbDeviceCount
+/// FAST_BOOT_PROFILE_USB_DEVICE records.
+///
+typedef struct {
+  UINT32          Signature;
+  UINT32          Version;
+  ///
+  /// Total length of the profile in bytes, including this header.
+  ///
+  UINT32          TotalLength;
+  ///
+  /// CRC32 of the configuration inputs which would force re-enumeration
+  /// (CPU identification and board type). A mismatch invalidates the profile.
+  ///
+  UINT32          ConfigHash;
+  ///
+  /// CRC32 of the whole profile, calculated with this field set to zero.
+  ///
+  UINT32          Crc32;
+  UINT16          PciDeviceCount;
+  UINT16          UsbDeviceCount;
+  ///
+  /// Active console output mode of the previous boot.
+  ///
+  INT32           ConOutMode;
+  UINT32          ConOutColumns;
+  UINT32          ConOutRows;
+} FAST_BOOT_PROFILE_HEADER;
+
+///
+/// One enumerated PCI function.
+///
+typedef struct {
+  UINT16          Segment;
+  UINT8           Bus;
+  UINT8           Device;
+  UINT8           Function;
+  UINT8           Reserved;
+  UINT16          VendorId;
+  UINT16          DeviceId;
+} FAST_BOOT_PROFILE_PCI_DEVICE;
+
+///
+/// One enumerated USB interface.
+///
+typedef struct {
+  UINT16          VendorId;
+  UINT16          ProductId;
+  UINT8           InterfaceClass;
+  UINT8           Reserved[3];
+} FAST_BOOT_PROFILE_USB_DEVICE;
+
+#pragma pack()
+
+extern EFI_GUID gFastBootProfileVariableGuid;
+
+#endif
@@ -8,14 +8,31 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
 #include <PiMm.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/BoardAcpiEnableLib.h>
 #include <Library/DebugLib.h>
 #include <Library/MmServicesTableLib.h>
 #include <Library/PcdLib.h>
 #include <Protocol/SmmSwDispatch2.h>
+#include <Guid/AcpiNvsBatchUpdate.h>
 
 #include "AcpiMm.h"
 
+//
+// Total ACPI MMIs serviced this boot, surfaced through the batch
+// update communication buffer for telemetry.
+//
+UINT64  mAcpiMmiCount = 0;
+
+//
+// MMRAM-resident copy of the batch entries. Entries must be captured here
+// before they are validated and applied: the communication buffer stays
+// writable to other agents (DMA, other cores) during the MMI, so checking
+// and then re-reading an entry in place would be a TOCTOU window.
+//
+ACPI_NVS_BATCH_UPDATE_ENTRY  mAcpiNvsEntryBuffer[ACPI_NVS_BATCH_UPDATE_MAX_ENTRY];
+
 /**
   Enable SCI
 
@@ -34,6 +51,7 @@ EnableAcpiCallback (
   IN  OUT UINTN                     *CommBufferSize  OPTIONAL
   )
 {
+  mAcpiMmiCount++;
   BoardEnableAcpi (TRUE);
   return EFI_SUCCESS;
 }
@@ -56,10 +74,140 @@ DisableAcpiCallback (
   IN  UINTN                         *CommBufferSize  OPTIONAL
   )
 {
+  mAcpiMmiCount++;
   BoardDisableAcpi (TRUE);
   return EFI_SUCCESS;
 }
 
+/**
+  Apply a batch of queued ACPI NVS field updates in a single MMI.
+
+  Caution: This function may receive untrusted input.
+  Communicate buffer and every target address are external input, so this
+  function validates each of them against MMRAM before use.
+
+  @param[in] DispatchHandle       - The unique handle assigned to this handler by MmiHandlerRegister()
+  @param[in] Context              - Points to an optional handler context
+  @param[in, out] CommBuffer      - A pointer to a collection of data in memory that will
+                                    be conveyed from a non-MM environment into an MM environment.
+  @param[in, out] CommBufferSize  - The size of the CommBuffer.
+
+  @retval EFI_SUCCESS             - The batch was processed.
+**/
+EFI_STATUS
+EFIAPI
+AcpiNvsBatchUpdateHandler (
+  IN EFI_HANDLE  DispatchHandle,
+  IN CONST VOID  *Context         OPTIONAL,
+  IN OUT VOID    *CommBuffer      OPTIONAL,
+  IN OUT UINTN   *CommBufferSize  OPTIONAL
+  )
+{
+  ACPI_NVS_BATCH_UPDATE_HEADER  *Header;
+  ACPI_NVS_BATCH_UPDATE_ENTRY   *Entry;
+  UINTN                         TempCommBufferSize;
+  UINT64                        EntryCount;
+  UINT64                        EntriesApplied;
+  UINT64                        Index;
+
+  mAcpiMmiCount++;
+
+  //
+  // If input is invalid, stop processing this MMI
+  //
+  if (CommBuffer == NULL || CommBufferSize == NULL) {
+    return EFI_SUCCESS;
+  }
+
+  TempCommBufferSize = *CommBufferSize;
+
+  if (TempCommBufferSize < sizeof (ACPI_NVS_BATCH_UPDATE_HEADER)) {
+    DEBUG ((DEBUG_ERROR, "AcpiNvsBatchUpdateHandler: MM communication buffer size invalid!\n"));
+    return EFI_SUCCESS;
+  }
+
+  if (!AcpiMmIsBufferOutsideMmValid ((UINTN) CommBuffer, TempCommBufferSize)) {
+    DEBUG ((DEBUG_ERROR, "AcpiNvsBatchUpdateHandler: MM communication buffer in MMRAM or overflow!\n"));
+    return EFI_SUCCESS;
+  }
+
+  Header = (ACPI_NVS_BATCH_UPDATE_HEADER *) CommBuffer;
+  Header->ReturnStatus   = (UINT64) EFI_INVALID_PARAMETER;
+  Header->EntriesApplied = 0;
+  Header->SmiCount       = mAcpiMmiCount;
+
+  if (Header->Command != ACPI_NVS_BATCH_UPDATE_COMMAND_WRITE) {
+    return EFI_SUCCESS;
+  }
+
+  EntryCount = Header->EntryCount;
+  if ((EntryCount > ACPI_NVS_BATCH_UPDATE_MAX_ENTRY) ||
+      (TempCommBufferSize != sizeof (ACPI_NVS_BATCH_UPDATE_HEADER) +
+                             (UINTN) EntryCount * sizeof (ACPI_NVS_BATCH_UPDATE_ENTRY))) {
+    DEBUG ((DEBUG_ERROR, "AcpiNvsBatchUpdateHandler: entry count does not match buffer size!\n"));
+    return EFI_SUCCESS;
+  }
+
+  //
+  // The SpeculationBarrier() call here is to ensure the previous range/content
+  // checks for the CommBuffer have been completed before the entries are used.
+  //
+  SpeculationBarrier ();
+
+  //
+  // Capture the whole batch into MMRAM before validating it, so the checks
+  // below and the stores operate on the same data.
+  //
+  CopyMem (
+    mAcpiNvsEntryBuffer,
+    (VOID *) (Header + 1),
+    (UINTN) EntryCount * sizeof (ACPI_NVS_BATCH_UPDATE_ENTRY)
+    );
+
+  Entry = mAcpiNvsEntryBuffer;
+  EntriesApplied = 0;
+  for (Index = 0; Index < EntryCount; Index++, Entry++) {
+    if ((Entry->Width != 1) && (Entry->Width != 2) &&
+        (Entry->Width != 4) && (Entry->Width != 8)) {
+      continue;
+    }
+    if ((Entry->Address & (Entry->Width - 1)) != 0) {
+      continue;
+    }
+    //
+    // Reject targets inside MMRAM so a malicious caller cannot use this
+    // handler to patch MM memory.
+    //
+    if (!AcpiMmIsBufferOutsideMmValid (Entry->Address, Entry->Width)) {
+      DEBUG ((DEBUG_ERROR, "AcpiNvsBatchUpdateHandler: entry target in MMRAM, skipped!\n"));
+      continue;
+    }
+    switch (Entry->Width) {
+    case 1:
+      *(volatile UINT8 *) (UINTN) Entry->Address = (UINT8) Entry->Value;
+      break;
+    case 2:
+      *(volatile UINT16 *) (UINTN) Entry->Address = (UINT16) Entry->Value;
+      break;
+    case 4:
+      *(volatile UINT32 *) (UINTN) Entry->Address = (UINT32) Entry->Value;
+      break;
+    case 8:
+      *(volatile UINT64 *) (UINTN) Entry->Address = Entry->Value;
+      break;
+    default:
+      break;
+    }
+    EntriesApplied++;
+  }
+
+  Header->EntriesApplied = EntriesApplied;
+  Header->ReturnStatus   = (EntriesApplied == EntryCount) ?
+                           (UINT64) EFI_SUCCESS : (UINT64) EFI_INVALID_PARAMETER;
+
+  return EFI_SUCCESS;
+}
+
 /**
   ACPI initialization logic shared between the Traditional MM and
   Standalone MM driver instances.
@@ -72,6 +220,7 @@ InitializeAcpiMm (
 {
   EFI_STATUS                                Status;
   EFI_HANDLE                                SwHandle;
+  EFI_HANDLE                                MmiHandle;
   EFI_SMM_SW_DISPATCH2_PROTOCOL             *SwDispatch;
   EFI_SMM_SW_REGISTER_CONTEXT               SwContext;
 
@@ -104,4 +253,15 @@ InitializeAcpiMm (
                          &SwHandle
                          );
   ASSERT_EFI_ERROR (Status);
+
+  //
+  // Register the batched ACPI NVS update handler so callers can apply
+  // multiple NVS field updates with a single MMI.
+  //
+  Status = gMmst->MmiHandlerRegister (
+                    AcpiNvsBatchUpdateHandler,
+                    &gAcpiNvsBatchUpdateGuid,
+                    &MmiHandle
+                    );
+  ASSERT_EFI_ERROR (Status);
 }
@@ -20,4 +20,22 @@ InitializeAcpiMm (
   VOID
   );
 
+/**
+  Check that a buffer described by a non-MM caller lies entirely outside MMRAM.
+
+  Implemented per driver instance since Traditional MM and Standalone MM use
+  different memory check libraries.
+
+  @param[in] Buffer  Physical address of the buffer.
+  @param[in] Length  Length of the buffer in bytes.
+
+  @retval TRUE   The buffer is valid for the MM handler to access.
+  @retval FALSE  The buffer overlaps MMRAM or wraps around.
+**/
+BOOLEAN
+AcpiMmIsBufferOutsideMmValid (
+  IN EFI_PHYSICAL_ADDRESS   Buffer,
+  IN UINT64                 Length
+  );
+
 #endif
@@ -8,9 +8,28 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 **/
 
 #include <PiMm.h>
+#include <Library/StandaloneMmMemLib.h>
 
 #include "AcpiMm.h"
 
+/**
+  Check that a buffer described by a non-MM caller lies entirely outside MMRAM.
+
+  @param[in] Buffer  Physical address of the buffer.
+  @param[in] Length  Length of the buffer in bytes.
+
+  @retval TRUE   The buffer is valid for the MM handler to access.
+  @retval FALSE  The buffer overlaps MMRAM or wraps around.
+**/
+BOOLEAN
+AcpiMmIsBufferOutsideMmValid (
+  IN EFI_PHYSICAL_ADDRESS   Buffer,
+  IN UINT64                 Length
+  )
+{
+  return MmIsBufferOutsideMmValid (Buffer, Length);
+}
+
 /**
   The Standalone MM driver entry point.
 
@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/BaseMemoryLib.h>
 #include <Library/HobLib.h>
 #include <Library/PcdLib.h>
+#include <Library/PerformanceLib.h>
 #include <Library/FspWrapperPlatformLib.h>
 #include <Guid/GuidHobFspEas.h>
 #include <Guid/MemoryTypeInformation.h>
@@ -31,6 +32,12 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 #define PEI_ADDITIONAL_MEMORY_SIZE    (16 * EFI_PAGE_SIZE)
 
+//
+// Largest run of FSP GUID HOB images relocated with a single allocation.
+// Bounded by the UINT16 HobLength of the HOB used to reserve the space.
+//
+#define MAX_GUID_HOB_RUN_SIZE         0xFFF8
+
 /**
   Get the mem size in memory type infromation table.
 
@@ -191,6 +198,7 @@ PostFspmHobProcess (
   //
   // Skip the MMIO and IO reource map from the FSP Hob list
   //
+  PERF_START_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x90B0);
   while ((Hob.Raw = GetNextHob (EFI_HOB_TYPE_RESOURCE_DESCRIPTOR, Hob.Raw)) != NULL) {
     if ((Hob.ResourceDescriptor->ResourceType == EFI_RESOURCE_IO) || (Hob.ResourceDescriptor->ResourceType == EFI_RESOURCE_MEMORY_MAPPED_IO)) {
       Hob.Raw = GET_NEXT_HOB (Hob);
@@ -248,6 +256,7 @@ PostFspmHobProcess (
 
     Hob.Raw = GET_NEXT_HOB (Hob);
   }
+  PERF_END_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x90B1);
 
   //
   // @todo: It is a W/A for SetMemorySpaceAttribute issue in PchSpi and PchReset drivers.
@@ -352,6 +361,35 @@ PostFspmHobProcess (
   return EFI_SUCCESS;
 }
 
+/**
+  Relocate a run of consecutive FSP GUID HOBs into the PEI HOB list.
+
+  The FSP HOB images are already in the exact layout the HOB list uses, so
+  the run is reserved with one HOB allocation and transferred with one range
+  copy. The copied images carry valid headers whose lengths sum to exactly
+  the reserved size, so the HOB list walk stays consistent.
+
+  @param[in] RunStart  First HOB image of the run.
+  @param[in] RunSize   Total size in bytes of the run, 8 byte aligned and
+                       no larger than MAX_GUID_HOB_RUN_SIZE.
+**/
+VOID
+RelocateGuidHobRun (
+  IN UINT8                *RunStart,
+  IN UINTN                RunSize
+  )
+{
+  EFI_STATUS            Status;
+  VOID                  *NewHob;
+
+  Status = PeiServicesCreateHob (EFI_HOB_TYPE_GUID_EXTENSION, (UINT16) RunSize, &NewHob);
+  ASSERT_EFI_ERROR (Status);
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+  CopyMem (NewHob, RunStart, RunSize);
+}
+
 /**
   Process FSP HOB list
 
@@ -366,6 +404,9 @@ ProcessFspHobList (
   UINT8                 PhysicalAddressBits;
   UINT32                RegEax;
   EFI_PEI_HOB_POINTERS  FspHob;
+  UINT8                 *RunStart;
+  UINTN                 RunSize;
+  BOOLEAN               BulkCopy;
 
   FspHob.Raw = FspHobList;
 
@@ -383,23 +424,58 @@ ProcessFspHobList (
   BuildCpuHob (PhysicalAddressBits, 16);
 
   //
-  // Add all the HOBs from FSP binary to FSP wrapper
+  // Add all the HOBs from FSP binary to FSP wrapper. Maximal runs of
+  // consecutive GUID HOBs are validated in place and relocated in bulk with
+  // one allocation and one range copy per run instead of rebuilding each HOB.
   //
+  PERF_START_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x90A0);
+  RunStart = NULL;
+  RunSize  = 0;
   while (!END_OF_HOB_LIST (FspHob)) {
+    BulkCopy = FALSE;
     if (FspHob.Header->HobType == EFI_HOB_TYPE_GUID_EXTENSION) {
       //
       // Skip FSP binary creates PcdDataBaseHobGuid
       //
       if (!CompareGuid(&FspHob.Guid->Name, &gPcdDataBaseHobGuid)) {
-        BuildGuidDataHob (
-          &FspHob.Guid->Name,
-          GET_GUID_HOB_DATA(FspHob),
-          GET_GUID_HOB_DATA_SIZE(FspHob)
-        );
+        if ((FspHob.Header->HobLength >= sizeof (EFI_HOB_GUID_TYPE)) &&
+            ((FspHob.Header->HobLength & 0x7) == 0)) {
+          BulkCopy = TRUE;
+        } else {
+          //
+          // Unexpected length, rebuild this HOB the conservative way
+          //
+          BuildGuidDataHob (
+            &FspHob.Guid->Name,
+            GET_GUID_HOB_DATA(FspHob),
+            GET_GUID_HOB_DATA_SIZE(FspHob)
+          );
+        }
       }
     }
+
+    if (BulkCopy) {
+      if ((RunStart != NULL) &&
+          ((RunSize + FspHob.Header->HobLength) > MAX_GUID_HOB_RUN_SIZE)) {
+        RelocateGuidHobRun (RunStart, RunSize);
+        RunStart = NULL;
+      }
+      if (RunStart == NULL) {
+        RunStart = FspHob.Raw;
+        RunSize  = 0;
+      }
+      RunSize += FspHob.Header->HobLength;
+    } else if (RunStart != NULL) {
+      RelocateGuidHobRun (RunStart, RunSize);
+      RunStart = NULL;
+      RunSize  = 0;
+    }
     FspHob.Raw = GET_NEXT_HOB (FspHob);
   }
+  if (RunStart != NULL) {
+    RelocateGuidHobRun (RunStart, RunSize);
+  }
+  PERF_END_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x90A1);
 }
 
 VOID
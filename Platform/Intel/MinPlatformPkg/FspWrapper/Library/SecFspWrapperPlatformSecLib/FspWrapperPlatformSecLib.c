@@ -92,6 +92,46 @@ EFI_PEI_PPI_DESCRIPTOR  mPeiSecPlatformPpi[] = {
   },
 };
 
+/**
+  Copy the FSP-M firmware volume into the temporary RAM staging window.
+
+  In dispatch mode FSP-M otherwise executes in place from SPI flash, which
+  leaves memory training running at flash fetch speed. When
+  PcdFspmStagingSize is non-zero and the volume fits, the image is copied
+  to PcdFspmStagingBase so PEI core dispatches it from cache-as-RAM. The
+  FSP-M binary must be rebased at build time to the staging base, as
+  pre-memory PEIMs execute at their link address.
+
+  @return The address PEI core should dispatch FSP-M from, either the
+          staging window or the flash address when staging is disabled
+          or the volume does not fit.
+
+**/
+UINTN
+StageFspmInTemporaryRam (
+  VOID
+  )
+{
+  EFI_FIRMWARE_VOLUME_HEADER  *FvHeader;
+  UINTN                       StagingBase;
+  UINTN                       StagingSize;
+
+  FvHeader = (EFI_FIRMWARE_VOLUME_HEADER *) (UINTN) FixedPcdGet32 (PcdFspmBaseAddress);
+  StagingBase = FixedPcdGet32 (PcdFspmStagingBase);
+  StagingSize = FixedPcdGet32 (PcdFspmStagingSize);
+  if (StagingSize == 0) {
+    return (UINTN) FvHeader;
+  }
+  if ((FvHeader->Signature != EFI_FVH_SIGNATURE) || (FvHeader->FvLength > StagingSize)) {
+    DEBUG ((DEBUG_INFO, "FSP Wrapper FSP-M staging skipped   - FvLength 0x%lx Window 0x%x\n", FvHeader->FvLength, StagingSize));
+    return (UINTN) FvHeader;
+  }
+  CopyMem ((VOID *) StagingBase, FvHeader, (UINTN) FvHeader->FvLength);
+  DEBUG ((DEBUG_INFO, "FSP Wrapper FSP-M staged at         - 0x%x\n", StagingBase));
+
+  return StagingBase;
+}
+
 #define LEGACY_8259_MASK_REGISTER_MASTER                  0x21
 #define LEGACY_8259_MASK_REGISTER_SLAVE                   0xA1
 #define LEGACY_8259_EDGE_LEVEL_TRIGGERED_REGISTER_MASTER  0x4D0
@@ -141,9 +181,11 @@ SecPlatformMain (
   IN OUT   EFI_SEC_PEI_HAND_OFF        *SecCoreData
   )
 {
-  EFI_PEI_PPI_DESCRIPTOR      *PpiList;
-  UINT8                       TopOfTemporaryRamPpiIndex;
-  UINT8                       *CopyDestinationPointer;
+  EFI_PEI_PPI_DESCRIPTOR        *PpiList;
+  UINT8                         TopOfTemporaryRamPpiIndex;
+  UINT8                         *CopyDestinationPointer;
+  EFI_PEI_CORE_FV_LOCATION_PPI  *PeiCoreFvLocationPpi;
+  UINTN                         FspmBase;
 
   DEBUG ((DEBUG_INFO, "FSP Wrapper BootFirmwareVolumeBase - 0x%x\n", SecCoreData->BootFirmwareVolumeBase));
   DEBUG ((DEBUG_INFO, "FSP Wrapper BootFirmwareVolumeSize - 0x%x\n", SecCoreData->BootFirmwareVolumeSize));
@@ -177,10 +219,26 @@ SecPlatformMain (
     CopyDestinationPointer += sizeof (mPeiCoreFvLocationPpiList);
   }
   CopyMem (CopyDestinationPointer, mPeiSecPlatformPpi, sizeof (mPeiSecPlatformPpi));
+  CopyDestinationPointer += sizeof (mPeiSecPlatformPpi);
   //
   // Patch TopOfTemporaryRamPpi
   //
   PpiList[TopOfTemporaryRamPpiIndex].Ppi = (VOID *)((UINTN) SecCoreData->TemporaryRamBase + SecCoreData->TemporaryRamSize);
 
+  if (TopOfTemporaryRamPpiIndex == 1) {
+    //
+    // Stage FSP-M in temporary RAM when a staging window is configured.
+    // The build-time PPI instance resides in flash and cannot be patched,
+    // so a staged location is published through a copy placed right after
+    // the descriptor list.
+    //
+    FspmBase = StageFspmInTemporaryRam ();
+    if (FspmBase != (UINTN) mPeiCoreFvLocationPpi.PeiCoreFvLocation) {
+      PeiCoreFvLocationPpi = (EFI_PEI_CORE_FV_LOCATION_PPI *) CopyDestinationPointer;
+      PeiCoreFvLocationPpi->PeiCoreFvLocation = (VOID *) FspmBase;
+      PpiList[0].Ppi = PeiCoreFvLocationPpi;
+    }
+  }
+
   return PpiList;
 }
@@ -23,6 +23,21 @@ ADAPTER_INFO_PLATFORM_SECURITY_STRUCT  mHstiStruct = {
 
 UINT8  mFeatureImplemented[HSTI_SECURITY_FEATURE_SIZE];
 
+#define HSTI_VERIFIED_CACHE_VARIABLE_NAME  L"HstiIbvVerifiedCache"
+
+EFI_GUID  mHstiVerifiedCacheGuid = {
+  0x1c8c2e52, 0x07a4, 0x4d2f, { 0x92, 0xb5, 0x5e, 0xcc, 0x41, 0x88, 0x36, 0x0d }
+  };
+
+//
+// Cached verification results.  The implemented bitmap guards the cache:
+// a platform feature configuration change invalidates it.
+//
+typedef struct {
+  UINT8   FeatureImplemented[HSTI_SECURITY_FEATURE_SIZE];
+  UINT8   FeatureVerified[HSTI_SECURITY_FEATURE_SIZE];
+} HSTI_VERIFIED_CACHE;
+
 /**
   Initialize HSTI feature data
 **/
@@ -122,6 +137,101 @@ UpdateData (
   CheckMorSupport (Role);
 }
 
+/**
+  Restore memoized verification results from the cache variable.
+
+  The cached bits are only replayed when the implemented feature bitmap
+  still matches the one the cache was recorded against, so the full test
+  walk reruns whenever the platform feature configuration changes.
+
+  @param[in] Role  - HSTI role.
+
+  @retval TRUE   All verified bits were restored from the cache.
+  @retval FALSE  No usable cache; the tests must run.
+**/
+BOOLEAN
+RestoreVerifiedFromCache (
+  IN UINT32                   Role
+  )
+{
+  EFI_STATUS           Status;
+  HSTI_VERIFIED_CACHE  Cache;
+  UINTN                DataSize;
+  UINTN                Index;
+
+  DataSize = sizeof (Cache);
+  Status = gRT->GetVariable (
+                  HSTI_VERIFIED_CACHE_VARIABLE_NAME,
+                  &mHstiVerifiedCacheGuid,
+                  NULL,
+                  &DataSize,
+                  &Cache
+                  );
+  if (EFI_ERROR (Status) || (DataSize != sizeof (Cache))) {
+    return FALSE;
+  }
+  if (CompareMem (Cache.FeatureImplemented, mFeatureImplemented, sizeof (mFeatureImplemented)) != 0) {
+    return FALSE;
+  }
+
+  for (Index = 0; Index < HSTI_SECURITY_FEATURE_SIZE; Index++) {
+    if (Cache.FeatureVerified[Index] != 0) {
+      Status = HstiLibSetFeaturesVerified (
+                 Role,
+                 NULL,
+                 (UINT32) Index,
+                 Cache.FeatureVerified[Index]
+                 );
+      ASSERT_EFI_ERROR (Status);
+    }
+  }
+
+  DEBUG ((EFI_D_INFO, "HSTI verified bits restored from cache\n"));
+  return TRUE;
+}
+
+/**
+  Memoize the verification results in the cache variable.
+
+  @param[in] Role  - HSTI role.
+**/
+VOID
+SaveVerifiedToCache (
+  IN UINT32                   Role
+  )
+{
+  EFI_STATUS                      Status;
+  HSTI_VERIFIED_CACHE             Cache;
+  ADAPTER_INFO_PLATFORM_SECURITY  *Hsti;
+  UINTN                           HstiSize;
+  UINT8                           *SecurityFeatures;
+
+  Status = HstiLibGetTable (Role, NULL, (VOID **) &Hsti, &HstiSize);
+  if (EFI_ERROR (Status)) {
+    return ;
+  }
+  if (Hsti->SecurityFeaturesSize != HSTI_SECURITY_FEATURE_SIZE) {
+    FreePool (Hsti);
+    return ;
+  }
+
+  CopyMem (Cache.FeatureImplemented, mFeatureImplemented, sizeof (mFeatureImplemented));
+  SecurityFeatures = (UINT8 *)(Hsti + 1) + 2 * Hsti->SecurityFeaturesSize;
+  CopyMem (Cache.FeatureVerified, SecurityFeatures, sizeof (Cache.FeatureVerified));
+  FreePool (Hsti);
+
+  Status = gRT->SetVariable (
+                  HSTI_VERIFIED_CACHE_VARIABLE_NAME,
+                  &mHstiVerifiedCacheGuid,
+                  EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                  sizeof (Cache),
+                  &Cache
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_ERROR, "HSTI verified cache not saved - %r\n", Status));
+  }
+}
+
 /**
   Dump HSTI info to serial
 
@@ -213,7 +323,10 @@ OnReadyToBoot (
   VOID                                    *Context
   )
 {
-  UpdateData (PLATFORM_SECURITY_ROLE_PLATFORM_IBV);
+  if (!RestoreVerifiedFromCache (PLATFORM_SECURITY_ROLE_PLATFORM_IBV)) {
+    UpdateData (PLATFORM_SECURITY_ROLE_PLATFORM_IBV);
+    SaveVerifiedToCache (PLATFORM_SECURITY_ROLE_PLATFORM_IBV);
+  }
   DumpData (PLATFORM_SECURITY_ROLE_PLATFORM_IBV);
 
   if (Event != NULL) {
@@ -0,0 +1,65 @@
+/** @file
+  Definitions for the batched ACPI NVS update MM communication handler.
+
+  Multiple NVS field updates are queued in one communication buffer and
+  applied in a single MMI instead of one software SMI per operation.
+
+Copyright (c) 2017, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef _ACPI_NVS_BATCH_UPDATE_H_
+#define _ACPI_NVS_BATCH_UPDATE_H_
+
+#pragma pack(1)
+
+#define ACPI_NVS_BATCH_UPDATE_COMMAND_WRITE   0x1
+
+//
+// Upper bound on entries per batch to keep the handler bounded.
+//
+#define ACPI_NVS_BATCH_UPDATE_MAX_ENTRY       256
+
+typedef struct {
+  //
+  // Physical address of the NVS field to update. Must be outside MMRAM.
+  //
+  UINT64  Address;
+  //
+  // Value to store, truncated to Width bytes.
+  //
+  UINT64  Value;
+  //
+  // Field width in bytes: 1, 2, 4 or 8.
+  //
+  UINT32  Width;
+  UINT32  Reserved;
+} ACPI_NVS_BATCH_UPDATE_ENTRY;
+
+typedef struct {
+  UINT64  Command;
+  //
+  // Number of ACPI_NVS_BATCH_UPDATE_ENTRY structures following this header.
+  //
+  UINT64  EntryCount;
+  //
+  // On return: number of entries actually applied.
+  //
+  UINT64  EntriesApplied;
+  //
+  // On return: total ACPI MMIs serviced this boot, for telemetry.
+  //
+  UINT64  SmiCount;
+  //
+  // On return: EFI_SUCCESS if every entry was applied.
+  //
+  UINT64  ReturnStatus;
+//ACPI_NVS_BATCH_UPDATE_ENTRY  Entry[];
+} ACPI_NVS_BATCH_UPDATE_HEADER;
+
+#pragma pack()
+
+extern EFI_GUID gAcpiNvsBatchUpdateGuid;
+
+#endif
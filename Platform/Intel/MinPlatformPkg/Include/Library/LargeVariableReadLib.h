@@ -58,4 +58,41 @@ GetLargeVariable (
   OUT    VOID                        *Data           OPTIONAL
   );
 
+/**
+  Returns a portion of the value of a large variable.
+
+  Only the underlying variables that overlap the requested range are read, so
+  a caller can stream a large data set piece by piece without allocating a
+  buffer for the entire logical variable.
+
+  @param[in]       VariableName  A Null-terminated string that is the name of the vendor's
+                                 variable.
+  @param[in]       VendorGuid    A unique identifier for the vendor.
+  @param[in]       Offset        The byte offset within the logical data set to start
+                                 reading from.
+  @param[in, out]  DataSize      On input, the number of bytes to read. On output the number
+                                 of bytes actually read, which is smaller if the end of the
+                                 data set was reached.
+  @param[out]      Data          The buffer to return the requested portion of the variable.
+
+  @retval EFI_SUCCESS            The function completed successfully.
+  @retval EFI_NOT_FOUND          The variable was not found.
+  @retval EFI_INVALID_PARAMETER  VariableName, VendorGuid, DataSize or Data is NULL.
+  @retval EFI_INVALID_PARAMETER  Offset is beyond the end of the data set.
+  @retval EFI_OUT_OF_RESOURCES   A staging buffer could not be allocated, or the variable
+                                 name is too long.
+  @retval EFI_DEVICE_ERROR       The variable could not be retrieved due to a hardware error.
+  @retval EFI_SECURITY_VIOLATION The variable could not be retrieved due to an authentication failure.
+
+**/
+EFI_STATUS
+EFIAPI
+GetLargeVariablePortion (
+  IN     CHAR16                      *VariableName,
+  IN     EFI_GUID                    *VendorGuid,
+  IN     UINTN                       Offset,
+  IN OUT UINTN                       *DataSize,
+  OUT    VOID                        *Data
+  );
+
 #endif  // _LARGE_VARIABLE_READ_LIB_H_
@@ -66,6 +66,47 @@ SetLargeVariable (
   IN  VOID                         *Data
   );
 
+/**
+  Appends data to the end of a large variable.
+
+  The existing chunk variables are left in place: at most the last, partially
+  filled chunk is rewritten, and the remaining data is stored in new chunk
+  variables directly from the caller's buffer. This allows producers to
+  stream a large data set into variable storage without ever allocating a
+  buffer for the whole logical variable. If the variable does not exist yet
+  it is created.
+
+  Note: A failure part way through leaves the previously stored data plus any
+  chunks appended so far; the caller decides whether to retry, continue or
+  delete the variable.
+
+  @param[in]  VariableName       A Null-terminated string that is the name of the vendor's variable.
+                                 Each VariableName is unique for each VendorGuid. VariableName must
+                                 contain 1 or more characters. If VariableName is an empty string,
+                                 then EFI_INVALID_PARAMETER is returned.
+  @param[in]  VendorGuid         A unique identifier for the vendor.
+  @param[in]  DataSize           The size in bytes of the Data buffer. Must be greater than zero.
+  @param[in]  Data               The data to append.
+
+  @retval EFI_SUCCESS            The firmware has successfully appended the data.
+  @retval EFI_INVALID_PARAMETER  An invalid combination of name and GUID was supplied.
+  @retval EFI_INVALID_PARAMETER  VariableName is an empty string.
+  @retval EFI_INVALID_PARAMETER  DataSize is zero or Data is NULL.
+  @retval EFI_OUT_OF_RESOURCES   Not enough storage is available to hold the appended data.
+  @retval EFI_OUT_OF_RESOURCES   The VariableName is longer than 1018 characters
+  @retval EFI_DEVICE_ERROR       The variable could not be stored due to a hardware error.
+  @retval EFI_WRITE_PROTECTED    The variable in question is read-only.
+
+**/
+EFI_STATUS
+EFIAPI
+AppendLargeVariable (
+  IN  CHAR16                       *VariableName,
+  IN  EFI_GUID                     *VendorGuid,
+  IN  UINTN                        DataSize,
+  IN  VOID                         *Data
+  );
+
 /**
   Locks the existing large variable.
 
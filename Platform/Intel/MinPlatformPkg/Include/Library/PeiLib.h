@@ -9,6 +9,72 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define _PEI_LIB_H_
 
 #include <PiPei.h>
+#include <Library/BaseLib.h>
+
+//
+// Lightweight PEI tracing facility.
+//
+// Records are stored in a pre-allocated GUID HOB ring and written with two
+// TSC reads and no allocation, so probes are cheap enough for pre-memory
+// hot paths where the PERF macros are too heavy. The ring is created on
+// first use and wraps when full; a DXE application can locate the HOB by
+// gPeiTraceRingHobGuid and print it.
+//
+// Usage, one probe per scope:
+//   PEI_TRACE_BEGIN ();
+//   ... code under measurement ...
+//   PEI_TRACE_END (0x1234);
+//
+#define PEI_TRACE_RING_SIGNATURE  SIGNATURE_32 ('P', 'T', 'R', 'H')
+#define PEI_TRACE_RING_RECORDS    64
+
+typedef struct {
+  //
+  // Caller chosen probe identifier.
+  //
+  UINT32  Id;
+  UINT32  Reserved;
+  UINT64  StartTsc;
+  UINT64  EndTsc;
+} PEI_TRACE_RECORD;
+
+typedef struct {
+  UINT32  Signature;
+  //
+  // Capacity of the ring in records.
+  //
+  UINT32  RecordCount;
+  //
+  // Total records written; the slot of record N is N modulo RecordCount.
+  //
+  UINT32  NextIndex;
+  UINT32  Reserved;
+//PEI_TRACE_RECORD  Record[];
+} PEI_TRACE_RING;
+
+#define PEI_TRACE_BEGIN()  UINT64 PeiTraceStartTsc = AsmReadTsc ()
+#define PEI_TRACE_END(Id)  PeiTraceRecord ((Id), PeiTraceStartTsc, AsmReadTsc ())
+
+extern EFI_GUID gPeiTraceRingHobGuid;
+
+/**
+  Write one trace record into the trace ring HOB.
+
+  The ring HOB is created on the first call; afterwards each record costs a
+  HOB list walk and a fixed-size store, with no allocation. Intended to be
+  used through the PEI_TRACE_BEGIN/PEI_TRACE_END macros.
+
+  @param[in] Id        Caller chosen probe identifier.
+  @param[in] StartTsc  TSC value at the start of the traced region.
+  @param[in] EndTsc    TSC value at the end of the traced region.
+**/
+VOID
+EFIAPI
+PeiTraceRecord (
+  IN UINT32  Id,
+  IN UINT64  StartTsc,
+  IN UINT64  EndTsc
+  );
 
 /**
   Returns the status whether get the variable success. The function retrieves
@@ -19,6 +19,7 @@
 #include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/PrintLib.h>
 #include <Library/VariableReadLib.h>
 
@@ -174,3 +175,190 @@ Done:
   DEBUG ((DEBUG_ERROR, "GetLargeVariable: Status = %r\n", Status));
   return Status;
 }
+
+/**
+  Returns a portion of the value of a large variable.
+
+  Only the underlying variables that overlap the requested range are read, so
+  a caller can stream a large data set piece by piece without allocating a
+  buffer for the entire logical variable. At most one variable sized staging
+  buffer is allocated at a time, and only for variables that partially
+  overlap the requested range.
+
+  @param[in]       VariableName  A Null-terminated string that is the name of the vendor's
+                                 variable.
+  @param[in]       VendorGuid    A unique identifier for the vendor.
+  @param[in]       Offset        The byte offset within the logical data set to start
+                                 reading from.
+  @param[in, out]  DataSize      On input, the number of bytes to read. On output the number
+                                 of bytes actually read, which is smaller if the end of the
+                                 data set was reached.
+  @param[out]      Data          The buffer to return the requested portion of the variable.
+
+  @retval EFI_SUCCESS            The function completed successfully.
+  @retval EFI_NOT_FOUND          The variable was not found.
+  @retval EFI_INVALID_PARAMETER  VariableName, VendorGuid, DataSize or Data is NULL.
+  @retval EFI_INVALID_PARAMETER  Offset is beyond the end of the data set.
+  @retval EFI_OUT_OF_RESOURCES   A staging buffer could not be allocated, or the variable
+                                 name is too long.
+  @retval EFI_DEVICE_ERROR       The variable could not be retrieved due to a hardware error.
+  @retval EFI_SECURITY_VIOLATION The variable could not be retrieved due to an authentication failure.
+
+**/
+EFI_STATUS
+EFIAPI
+GetLargeVariablePortion (
+  IN     CHAR16                      *VariableName,
+  IN     EFI_GUID                    *VendorGuid,
+  IN     UINTN                       Offset,
+  IN OUT UINTN                       *DataSize,
+  OUT    VOID                        *Data
+  )
+{
+  CHAR16        TempVariableName[MAX_VARIABLE_NAME_SIZE];
+  EFI_STATUS    Status;
+  UINTN         VarDataSize;
+  UINTN         VariableSize;
+  UINTN         ChunkStart;
+  UINTN         CopyOffset;
+  UINTN         CopySize;
+  UINTN         BytesRemaining;
+  UINTN         Index;
+  UINT8         *OffsetPtr;
+  UINT8         *ChunkBuffer;
+
+  if ((VariableName == NULL) || (VendorGuid == NULL) || (DataSize == NULL) || (Data == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // First check if a variable with the given name exists
+  //
+  VarDataSize = 0;
+  Status = VarLibGetVariable (VariableName, VendorGuid, NULL, &VarDataSize, NULL);
+  if (Status == EFI_BUFFER_TOO_SMALL) {
+    DEBUG ((DEBUG_VERBOSE, "GetLargeVariablePortion: Single Variable Found\n"));
+    if (Offset >= VarDataSize) {
+      Status = EFI_INVALID_PARAMETER;
+      goto Done;
+    }
+    if (*DataSize > (VarDataSize - Offset)) {
+      *DataSize = VarDataSize - Offset;
+    }
+    if ((Offset == 0) && (*DataSize == VarDataSize)) {
+      Status = VarLibGetVariable (VariableName, VendorGuid, NULL, DataSize, Data);
+      goto Done;
+    }
+
+    //
+    // The variable services offer no offset reads, so a partial read stages
+    // the one variable and copies the requested range out of it.
+    //
+    ChunkBuffer = AllocatePool (VarDataSize);
+    if (ChunkBuffer == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto Done;
+    }
+    Status = VarLibGetVariable (VariableName, VendorGuid, NULL, &VarDataSize, ChunkBuffer);
+    if (!EFI_ERROR (Status)) {
+      CopyMem (Data, ChunkBuffer + Offset, *DataSize);
+    }
+    FreePool (ChunkBuffer);
+    goto Done;
+  } else if (Status != EFI_NOT_FOUND) {
+    goto Done;
+  }
+
+  //
+  // Check the first variable of a multi-variable set
+  //
+  if (StrLen (VariableName) >= (MAX_VARIABLE_NAME_SIZE - MAX_VARIABLE_SPLIT_DIGITS)) {
+    DEBUG ((DEBUG_ERROR, "GetLargeVariablePortion: Variable name too long\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  //
+  // Walk the chunk variables, skipping the ones entirely below Offset using
+  // size-only queries so their data is never copied.
+  //
+  ChunkStart      = 0;
+  OffsetPtr       = (UINT8 *) Data;
+  BytesRemaining  = *DataSize;
+  for (Index = 0; (Index < MAX_VARIABLE_SPLIT) && (BytesRemaining > 0); Index++) {
+    VarDataSize = 0;
+    ZeroMem (TempVariableName, MAX_VARIABLE_NAME_SIZE);
+    UnicodeSPrint (TempVariableName, MAX_VARIABLE_NAME_SIZE, L"%s%d", VariableName, Index);
+    Status = VarLibGetVariable (TempVariableName, VendorGuid, NULL, &VarDataSize, NULL);
+    if (Status != EFI_BUFFER_TOO_SMALL) {
+      if ((Status == EFI_NOT_FOUND) && (Index != 0)) {
+        DEBUG ((DEBUG_VERBOSE, "GetLargeVariablePortion: No more variables found\n"));
+        break;
+      }
+      goto Done;
+    }
+
+    if ((ChunkStart + VarDataSize) <= Offset) {
+      //
+      // This chunk lies entirely before the requested range
+      //
+      ChunkStart += VarDataSize;
+      continue;
+    }
+
+    CopyOffset = (Offset > ChunkStart) ? (Offset - ChunkStart) : 0;
+    CopySize   = VarDataSize - CopyOffset;
+    if (CopySize > BytesRemaining) {
+      CopySize = BytesRemaining;
+    }
+
+    if ((CopyOffset == 0) && (CopySize == VarDataSize)) {
+      //
+      // The whole chunk is wanted, read it straight into place
+      //
+      VariableSize = VarDataSize;
+      DEBUG ((DEBUG_INFO, "Reading %s, Guid = %g,", TempVariableName, VendorGuid));
+      Status = VarLibGetVariable (TempVariableName, VendorGuid, NULL, &VariableSize, (VOID *) OffsetPtr);
+      DEBUG ((DEBUG_INFO, " Size %d\n", VariableSize));
+      if (EFI_ERROR (Status)) {
+        goto Done;
+      }
+    } else {
+      //
+      // A partial chunk is staged through a chunk sized buffer
+      //
+      ChunkBuffer = AllocatePool (VarDataSize);
+      if (ChunkBuffer == NULL) {
+        Status = EFI_OUT_OF_RESOURCES;
+        goto Done;
+      }
+      DEBUG ((DEBUG_INFO, "Reading %s, Guid = %g, Size %d (partial)\n", TempVariableName, VendorGuid, CopySize));
+      Status = VarLibGetVariable (TempVariableName, VendorGuid, NULL, &VarDataSize, ChunkBuffer);
+      if (EFI_ERROR (Status)) {
+        FreePool (ChunkBuffer);
+        goto Done;
+      }
+      CopyMem (OffsetPtr, ChunkBuffer + CopyOffset, CopySize);
+      FreePool (ChunkBuffer);
+    }
+
+    OffsetPtr      += CopySize;
+    BytesRemaining -= CopySize;
+    ChunkStart     += VarDataSize;
+  }   //End of for loop
+
+  if (BytesRemaining == *DataSize) {
+    //
+    // Nothing overlapped the requested range
+    //
+    Status = (Index == 0) ? EFI_NOT_FOUND : EFI_INVALID_PARAMETER;
+    goto Done;
+  }
+
+  *DataSize -= BytesRemaining;
+  Status = EFI_SUCCESS;
+
+Done:
+  DEBUG ((DEBUG_ERROR, "GetLargeVariablePortion: Status = %r\n", Status));
+  return Status;
+}
@@ -19,6 +19,7 @@
 #include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/PrintLib.h>
 #include <Library/VariableReadLib.h>
 #include <Library/VariableWriteLib.h>
@@ -462,6 +463,245 @@ Done:
   return Status;
 }
 
+/**
+  Appends data to the end of a large variable.
+
+  The existing chunk variables are left in place: at most the last, partially
+  filled chunk is rewritten, and the remaining data is stored in new chunk
+  variables directly from the caller's buffer. This allows producers to
+  stream a large data set into variable storage without ever allocating a
+  buffer for the whole logical variable. If the variable does not exist yet
+  it is created.
+
+  Note: A failure part way through leaves the previously stored data plus any
+  chunks appended so far; the caller decides whether to retry, continue or
+  delete the variable.
+
+  @param[in]  VariableName       A Null-terminated string that is the name of the vendor's variable.
+                                 Each VariableName is unique for each VendorGuid. VariableName must
+                                 contain 1 or more characters. If VariableName is an empty string,
+                                 then EFI_INVALID_PARAMETER is returned.
+  @param[in]  VendorGuid         A unique identifier for the vendor.
+  @param[in]  DataSize           The size in bytes of the Data buffer. Must be greater than zero.
+  @param[in]  Data               The data to append.
+
+  @retval EFI_SUCCESS            The firmware has successfully appended the data.
+  @retval EFI_INVALID_PARAMETER  An invalid combination of name and GUID was supplied.
+  @retval EFI_INVALID_PARAMETER  VariableName is an empty string.
+  @retval EFI_INVALID_PARAMETER  DataSize is zero or Data is NULL.
+  @retval EFI_OUT_OF_RESOURCES   Not enough storage is available to hold the appended data.
+  @retval EFI_OUT_OF_RESOURCES   The VariableName is longer than 1018 characters
+  @retval EFI_DEVICE_ERROR       The variable could not be stored due to a hardware error.
+  @retval EFI_WRITE_PROTECTED    The variable in question is read-only.
+
+**/
+EFI_STATUS
+EFIAPI
+AppendLargeVariable (
+  IN  CHAR16                       *VariableName,
+  IN  EFI_GUID                     *VendorGuid,
+  IN  UINTN                        DataSize,
+  IN  VOID                         *Data
+  )
+{
+  CHAR16        TempVariableName[MAX_VARIABLE_NAME_SIZE];
+  EFI_STATUS    Status;
+  UINT64        VariableSplitSize;
+  UINT64        RemainingVariableStorage;
+  UINTN         VarDataSize;
+  UINTN         LastIndex;
+  UINTN         LastSize;
+  UINTN         Index;
+  UINTN         SizeToSave;
+  UINTN         BytesRemaining;
+  UINT8         *OffsetPtr;
+  UINT8         *MergeBuffer;
+
+  //
+  // Check input parameters.
+  //
+  if (VariableName == NULL || VariableName[0] == 0 || VendorGuid == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (DataSize == 0 || Data == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Check the length of the variable name is short enough to allow an integer
+  // to be appended.
+  //
+  if (StrLen (VariableName) >= (MAX_VARIABLE_NAME_SIZE - MAX_VARIABLE_SPLIT_DIGITS)) {
+    DEBUG ((DEBUG_ERROR, "AppendLargeVariable: Variable name too long\n"));
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Check that there is enough space remaining in the UEFI Variable Services
+  // Non-Volatile storage to store the appended data.
+  //
+  RemainingVariableStorage = GetRemainingVariableStorageSpace ();
+  if (DataSize > RemainingVariableStorage) {
+    DEBUG ((DEBUG_ERROR, "AppendLargeVariable: Not enough NV storage space to append the data\n"));
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // A data set previously stored in a single unnumbered variable is migrated
+  // to the numbered naming scheme so new chunks can follow it.
+  //
+  VarDataSize = 0;
+  Status = VarLibGetVariable (VariableName, VendorGuid, NULL, &VarDataSize, NULL);
+  if (Status == EFI_BUFFER_TOO_SMALL) {
+    DEBUG ((DEBUG_VERBOSE, "AppendLargeVariable: Migrating single variable to numbered scheme\n"));
+    MergeBuffer = AllocatePool (VarDataSize);
+    if (MergeBuffer == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto Done;
+    }
+    Status = VarLibGetVariable (VariableName, VendorGuid, NULL, &VarDataSize, MergeBuffer);
+    if (!EFI_ERROR (Status)) {
+      ZeroMem (TempVariableName, MAX_VARIABLE_NAME_SIZE);
+      UnicodeSPrint (TempVariableName, MAX_VARIABLE_NAME_SIZE, L"%s%d", VariableName, 0);
+      Status = VarLibSetVariable (
+                 TempVariableName,
+                 VendorGuid,
+                 EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_RUNTIME_ACCESS,
+                 VarDataSize,
+                 MergeBuffer
+                 );
+    }
+    if (!EFI_ERROR (Status)) {
+      Status = VarLibSetVariable (
+                 VariableName,
+                 VendorGuid,
+                 EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_RUNTIME_ACCESS,
+                 0,
+                 NULL
+                 );
+    }
+    FreePool (MergeBuffer);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "AppendLargeVariable: Migration failed: Status = %r\n", Status));
+      goto Done;
+    }
+  }
+
+  //
+  // Find the last chunk variable of the existing data set, using size-only
+  // queries so no data is copied.
+  //
+  LastIndex = 0;
+  LastSize  = 0;
+  for (Index = 0; Index < MAX_VARIABLE_SPLIT; Index++) {
+    VarDataSize = 0;
+    ZeroMem (TempVariableName, MAX_VARIABLE_NAME_SIZE);
+    UnicodeSPrint (TempVariableName, MAX_VARIABLE_NAME_SIZE, L"%s%d", VariableName, Index);
+    Status = VarLibGetVariable (TempVariableName, VendorGuid, NULL, &VarDataSize, NULL);
+    if (Status != EFI_BUFFER_TOO_SMALL) {
+      break;
+    }
+    LastIndex = Index;
+    LastSize  = VarDataSize;
+  }   // End of for loop
+
+  OffsetPtr       = (UINT8 *) Data;
+  BytesRemaining  = DataSize;
+
+  if (Index != 0) {
+    //
+    // Top off the last, partially filled chunk before creating new ones.
+    //
+    ZeroMem (TempVariableName, MAX_VARIABLE_NAME_SIZE);
+    UnicodeSPrint (TempVariableName, MAX_VARIABLE_NAME_SIZE, L"%s%d", VariableName, LastIndex);
+    VariableSplitSize = GetVariableSplitSize (StrLen (TempVariableName));
+    if (LastSize < VariableSplitSize) {
+      SizeToSave = (UINTN) VariableSplitSize - LastSize;
+      if (SizeToSave > BytesRemaining) {
+        SizeToSave = BytesRemaining;
+      }
+      MergeBuffer = AllocatePool (LastSize + SizeToSave);
+      if (MergeBuffer == NULL) {
+        Status = EFI_OUT_OF_RESOURCES;
+        goto Done;
+      }
+      VarDataSize = LastSize;
+      Status = VarLibGetVariable (TempVariableName, VendorGuid, NULL, &VarDataSize, MergeBuffer);
+      if (!EFI_ERROR (Status)) {
+        CopyMem (MergeBuffer + LastSize, OffsetPtr, SizeToSave);
+        DEBUG ((DEBUG_INFO, "Saving %s, Guid = %g, Size %d\n", TempVariableName, VendorGuid, LastSize + SizeToSave));
+        Status = VarLibSetVariable (
+                   TempVariableName,
+                   VendorGuid,
+                   EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_RUNTIME_ACCESS,
+                   LastSize + SizeToSave,
+                   MergeBuffer
+                   );
+      }
+      FreePool (MergeBuffer);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "AppendLargeVariable: Error rewriting last chunk: Status = %r\n", Status));
+        goto Done;
+      }
+      OffsetPtr      += SizeToSave;
+      BytesRemaining -= SizeToSave;
+    }
+  }
+
+  //
+  // Store the remaining data in new chunk variables until all data is stored,
+  // straight from the caller's buffer.
+  //
+  for (; (Index < MAX_VARIABLE_SPLIT) && (BytesRemaining > 0); Index++) {
+    ZeroMem (TempVariableName, MAX_VARIABLE_NAME_SIZE);
+    UnicodeSPrint (TempVariableName, MAX_VARIABLE_NAME_SIZE, L"%s%d", VariableName, Index);
+
+    VariableSplitSize = GetVariableSplitSize (StrLen (TempVariableName));
+    if (VariableSplitSize == 0) {
+      DEBUG ((DEBUG_ERROR, "Unable to save variable, out of NV storage space\n"));
+      Status = EFI_OUT_OF_RESOURCES;
+      goto Done;
+    }
+
+    if (BytesRemaining > VariableSplitSize) {
+      SizeToSave = (UINTN) VariableSplitSize;
+    } else {
+      SizeToSave = BytesRemaining;
+    }
+    DEBUG ((DEBUG_INFO, "Saving %s, Guid = %g, Size %d\n", TempVariableName, VendorGuid, SizeToSave));
+    Status = VarLibSetVariable (
+              TempVariableName,
+              VendorGuid,
+              EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS | EFI_VARIABLE_RUNTIME_ACCESS,
+              SizeToSave,
+              (VOID *) OffsetPtr
+              );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "AppendLargeVariable: Error writting variable: Status = %r\n", Status));
+      goto Done;
+    }
+    BytesRemaining -= SizeToSave;
+    OffsetPtr += SizeToSave;
+  }   // End of for loop
+
+  if (BytesRemaining > 0) {
+    DEBUG ((
+      DEBUG_ERROR,
+      "AppendLargeVariable: More than %d variables are needed to store the data, which exceeds the maximum supported\n",
+      MAX_VARIABLE_SPLIT
+      ));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  Status = EFI_SUCCESS;
+
+Done:
+  DEBUG ((DEBUG_ERROR, "AppendLargeVariable: Status = %r\n", Status));
+  return Status;
+}
+
 /**
   Locks the existing large variable.
 
@@ -592,18 +592,16 @@ FreadCrc (
 {
   INT32 LoopVar1;
 
-  for (LoopVar1 = 0; mSrc < mSrcUpperLimit && LoopVar1 < LoopVar8; LoopVar1++) {
-    *LoopVar7++ = *mSrc++;
+  if (LoopVar8 > (INT32) (mSrcUpperLimit - mSrc)) {
+    LoopVar8 = (INT32) (mSrcUpperLimit - mSrc);
   }
 
-  LoopVar8 = LoopVar1;
+  CopyMem (LoopVar7, mSrc, LoopVar8);
+  mSrc += LoopVar8;
 
-  LoopVar7 -= LoopVar8;
   mOrigSize += LoopVar8;
-  LoopVar1--;
-  while (LoopVar1 >= 0) {
+  for (LoopVar1 = 0; LoopVar1 < LoopVar8; LoopVar1++) {
     UPDATE_CRC (*LoopVar7++);
-    LoopVar1--;
   }
 
   return LoopVar8;
@@ -614,7 +612,6 @@ FreadCrc (
   Delete outdated string info. Find a match string for current position.
 
   @retval TRUE      The operation was successful.
-  @retval FALSE     The operation failed due to insufficient memory.
 
 **/
 BOOLEAN
@@ -624,18 +621,15 @@ GetNextMatch (
   )
 {
   INT32 LoopVar8;
-  VOID  *Temp;
 
   mRemainder--;
   mPos++;
   if (mPos == WNDSIZ * 2) {
-    Temp = AllocateZeroPool (WNDSIZ + MAXMATCH);
-    if (Temp == NULL) {
-      return (FALSE);
-    }
-    CopyMem (Temp, &mText[WNDSIZ], WNDSIZ + MAXMATCH);
-    CopyMem (&mText[0], Temp, WNDSIZ + MAXMATCH);
-    FreePool (Temp);
+    //
+    // Slide the window in place; CopyMem handles the overlapping tail,
+    // so no bounce buffer needs to be allocated per slide.
+    //
+    CopyMem (&mText[0], &mText[WNDSIZ], WNDSIZ + MAXMATCH);
     LoopVar8 = FreadCrc (&mText[WNDSIZ + MAXMATCH], WNDSIZ);
     mRemainder += LoopVar8;
     mPos = WNDSIZ;
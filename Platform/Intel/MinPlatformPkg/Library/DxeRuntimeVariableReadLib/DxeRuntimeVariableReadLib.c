@@ -1,117 +1,479 @@
-/** @file
-  DXE Variable Read Lib
-
-  This library provides phase agnostic access to the UEFI Variable Services.
-  This is done by implementing a wrapper on top of the phase specific mechanism
-  for reading from UEFI variables. For example, the PEI implementation of this
-  library uses EFI_PEI_READ_ONLY_VARIABLE2_PPI. The DXE implementation accesses
-  the UEFI Runtime Services Table, and the SMM implementation uses
-  EFI_SMM_VARIABLE_PROTOCOL.
-
-  Using this library allows code to be written in a generic manner that can be
-  used in PEI, DXE, or SMM without modification.
-
-  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
-  SPDX-License-Identifier: BSD-2-Clause-Patent
-
-**/
-
-#include <Uefi.h>
-
-#include <Library/UefiRuntimeServicesTableLib.h>
-
-/**
-  Returns the value of a variable.
-
-  @param[in]       VariableName  A Null-terminated string that is the name of the vendor's
-                                 variable.
-  @param[in]       VendorGuid    A unique identifier for the vendor.
-  @param[out]      Attributes    If not NULL, a pointer to the memory location to return the
-                                 attributes bitmask for the variable.
-  @param[in, out]  DataSize      On input, the size in bytes of the return Data buffer.
-                                 On output the size of data returned in Data.
-  @param[out]      Data          The buffer to return the contents of the variable. May be NULL
-                                 with a zero DataSize in order to determine the size buffer needed.
-
-  @retval EFI_SUCCESS            The function completed successfully.
-  @retval EFI_NOT_FOUND          The variable was not found.
-  @retval EFI_BUFFER_TOO_SMALL   The DataSize is too small for the result.
-  @retval EFI_INVALID_PARAMETER  VariableName is NULL.
-  @retval EFI_INVALID_PARAMETER  VendorGuid is NULL.
-  @retval EFI_INVALID_PARAMETER  DataSize is NULL.
-  @retval EFI_INVALID_PARAMETER  The DataSize is not too small and Data is NULL.
-  @retval EFI_DEVICE_ERROR       The variable could not be retrieved due to a hardware error.
-  @retval EFI_SECURITY_VIOLATION The variable could not be retrieved due to an authentication failure.
-  @retval EFI_UNSUPPORTED        This function is not implemented by this instance of the LibraryClass
-
-**/
-EFI_STATUS
-EFIAPI
-VarLibGetVariable (
-  IN     CHAR16                      *VariableName,
-  IN     EFI_GUID                    *VendorGuid,
-  OUT    UINT32                      *Attributes,    OPTIONAL
-  IN OUT UINTN                       *DataSize,
-  OUT    VOID                        *Data           OPTIONAL
-  )
-{
-  EFI_STATUS    Status = EFI_UNSUPPORTED;
-
-  if (gRT != NULL) {
-    Status = gRT->GetVariable (
-                    VariableName,
-                    VendorGuid,
-                    Attributes,
-                    DataSize,
-                    Data
-                    );
-  }
-  return Status;
-}
-
-/**
-  Enumerates the current variable names.
-
-  @param[in, out]  VariableNameSize The size of the VariableName buffer. The size must be large
-                                    enough to fit input string supplied in VariableName buffer.
-  @param[in, out]  VariableName     On input, supplies the last VariableName that was returned
-                                    by GetNextVariableName(). On output, returns the Nullterminated
-                                    string of the current variable.
-  @param[in, out]  VendorGuid       On input, supplies the last VendorGuid that was returned by
-                                    GetNextVariableName(). On output, returns the
-                                    VendorGuid of the current variable.
-
-  @retval EFI_SUCCESS           The function completed successfully.
-  @retval EFI_NOT_FOUND         The next variable was not found.
-  @retval EFI_BUFFER_TOO_SMALL  The VariableNameSize is too small for the result.
-                                VariableNameSize has been updated with the size needed to complete the request.
-  @retval EFI_INVALID_PARAMETER VariableNameSize is NULL.
-  @retval EFI_INVALID_PARAMETER VariableName is NULL.
-  @retval EFI_INVALID_PARAMETER VendorGuid is NULL.
-  @retval EFI_INVALID_PARAMETER The input values of VariableName and VendorGuid are not a name and
-                                GUID of an existing variable.
-  @retval EFI_INVALID_PARAMETER Null-terminator is not found in the first VariableNameSize bytes of
-                                the input VariableName buffer.
-  @retval EFI_DEVICE_ERROR      The variable could not be retrieved due to a hardware error.
-  @retval EFI_UNSUPPORTED       This function is not implemented by this instance of the LibraryClass
-
-**/
-EFI_STATUS
-EFIAPI
-VarLibGetNextVariableName (
-  IN OUT UINTN                    *VariableNameSize,
-  IN OUT CHAR16                   *VariableName,
-  IN OUT EFI_GUID                 *VendorGuid
-  )
-{
-  EFI_STATUS    Status = EFI_UNSUPPORTED;
-
-  if (gRT != NULL) {
-    Status = gRT->GetNextVariableName (
-                    VariableNameSize,
-                    VariableName,
-                    VendorGuid
-                    );
-  }
-  return Status;
-}
+/** @file
+  DXE Variable Read Lib
+
+  This library provides phase agnostic access to the UEFI Variable Services.
+  This is done by implementing a wrapper on top of the phase specific mechanism
+  for reading from UEFI variables. For example, the PEI implementation of this
+  library uses EFI_PEI_READ_ONLY_VARIABLE2_PPI. The DXE implementation accesses
+  the UEFI Runtime Services Table, and the SMM implementation uses
+  EFI_SMM_VARIABLE_PROTOCOL.
+
+  Using this library allows code to be written in a generic manner that can be
+  used in PEI, DXE, or SMM without modification.
+
+  This instance additionally keeps a small least-recently-used cache of
+  variable contents so that repeated reads of the same variable are served
+  from memory instead of walking the variable store through the variable
+  services on every call. The cache is kept coherent by interposing on the
+  runtime SetVariable service and invalidating the cached copy before a
+  write is forwarded. Because that interposer must remain callable for as
+  long as it is linked into the runtime services table, the cache is only
+  armed when the linking module is a runtime image; boot time images keep
+  the plain pass-through behavior.
+
+  Copyright (c) 2021, Intel Corporation. All rights reserved.<BR>
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+
+#include <Guid/EventGroup.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+#include <Protocol/LoadedImage.h>
+
+#define VAR_READ_CACHE_ENTRY_COUNT    8
+#define VAR_READ_CACHE_MAX_NAME_SIZE  64
+#define VAR_READ_CACHE_MAX_DATA_SIZE  128
+
+typedef struct {
+  BOOLEAN     Valid;
+  BOOLEAN     AttributesValid;
+  UINT32      NameHash;
+  EFI_GUID    Guid;
+  CHAR16      Name[VAR_READ_CACHE_MAX_NAME_SIZE / sizeof (CHAR16)];
+  UINT32      Attributes;
+  UINTN       DataSize;
+  UINT8       Data[VAR_READ_CACHE_MAX_DATA_SIZE];
+  UINT64      LastUse;
+} VAR_READ_CACHE_ENTRY;
+
+STATIC VAR_READ_CACHE_ENTRY  mVarReadCache[VAR_READ_CACHE_ENTRY_COUNT];
+STATIC BOOLEAN               mVarReadCacheEnabled   = FALSE;
+STATIC UINT64                mVarReadCacheUseCount  = 0;
+STATIC EFI_SET_VARIABLE      mOriginalSetVariable   = NULL;
+STATIC VOID                  *mVariableWriteRegistration;
+STATIC EFI_EVENT             mVirtualAddressChangeEvent;
+
+/**
+  Computes a hash over the variable name and vendor GUID.
+
+  @param[in]  VariableName  Null-terminated variable name.
+  @param[in]  VendorGuid    Vendor GUID of the variable.
+
+  @return Hash value used to reject non-matching cache entries cheaply.
+
+**/
+STATIC
+UINT32
+VarReadCacheHash (
+  IN CONST CHAR16    *VariableName,
+  IN CONST EFI_GUID  *VendorGuid
+  )
+{
+  UINT32  Hash;
+  UINTN   Index;
+
+  Hash = VendorGuid->Data1;
+  for (Index = 0; VariableName[Index] != CHAR_NULL; Index++) {
+    Hash = (Hash << 5) + Hash + VariableName[Index];
+  }
+  return Hash;
+}
+
+/**
+  Finds the cache entry for a variable, if one is present.
+
+  @param[in]  VariableName  Null-terminated variable name.
+  @param[in]  VendorGuid    Vendor GUID of the variable.
+
+  @return Pointer to the matching cache entry, or NULL if not cached.
+
+**/
+STATIC
+VAR_READ_CACHE_ENTRY *
+VarReadCacheLookup (
+  IN CONST CHAR16    *VariableName,
+  IN CONST EFI_GUID  *VendorGuid
+  )
+{
+  VAR_READ_CACHE_ENTRY  *Entry;
+  UINT32                Hash;
+  UINTN                 Index;
+
+  Hash = VarReadCacheHash (VariableName, VendorGuid);
+  for (Index = 0; Index < VAR_READ_CACHE_ENTRY_COUNT; Index++) {
+    Entry = &mVarReadCache[Index];
+    if (Entry->Valid &&
+        (Entry->NameHash == Hash) &&
+        CompareGuid (&Entry->Guid, VendorGuid) &&
+        (StrCmp (Entry->Name, VariableName) == 0)) {
+      return Entry;
+    }
+  }
+  return NULL;
+}
+
+/**
+  Records a successfully read variable in the cache.
+
+  Variables whose name or data exceed the fixed entry sizes are not cached.
+  An existing entry for the variable is updated in place; otherwise the
+  least recently used entry is evicted.
+
+  @param[in]  VariableName  Null-terminated variable name.
+  @param[in]  VendorGuid    Vendor GUID of the variable.
+  @param[in]  Attributes    Attributes returned by the read, or NULL if the
+                            caller did not request them.
+  @param[in]  DataSize      Size of the variable data in bytes.
+  @param[in]  Data          The variable data.
+
+**/
+STATIC
+VOID
+VarReadCacheInsert (
+  IN CONST CHAR16    *VariableName,
+  IN CONST EFI_GUID  *VendorGuid,
+  IN CONST UINT32    *Attributes,    OPTIONAL
+  IN UINTN           DataSize,
+  IN CONST VOID      *Data
+  )
+{
+  VAR_READ_CACHE_ENTRY  *Entry;
+  VAR_READ_CACHE_ENTRY  *Victim;
+  UINTN                 Index;
+
+  if ((StrSize (VariableName) > sizeof (Entry->Name)) ||
+      (DataSize > VAR_READ_CACHE_MAX_DATA_SIZE)) {
+    return;
+  }
+
+  Victim = VarReadCacheLookup (VariableName, VendorGuid);
+  if (Victim == NULL) {
+    Victim = &mVarReadCache[0];
+    for (Index = 0; Index < VAR_READ_CACHE_ENTRY_COUNT; Index++) {
+      Entry = &mVarReadCache[Index];
+      if (!Entry->Valid) {
+        Victim = Entry;
+        break;
+      }
+      if (Entry->LastUse < Victim->LastUse) {
+        Victim = Entry;
+      }
+    }
+  }
+
+  ZeroMem (Victim, sizeof (*Victim));
+  Victim->NameHash = VarReadCacheHash (VariableName, VendorGuid);
+  CopyGuid (&Victim->Guid, VendorGuid);
+  CopyMem (Victim->Name, VariableName, StrSize (VariableName));
+  Victim->DataSize = DataSize;
+  CopyMem (Victim->Data, Data, DataSize);
+  if (Attributes != NULL) {
+    Victim->Attributes      = *Attributes;
+    Victim->AttributesValid = TRUE;
+  }
+  Victim->LastUse = ++mVarReadCacheUseCount;
+  Victim->Valid   = TRUE;
+}
+
+/**
+  SetVariable interposer that invalidates the cached copy of a variable
+  before the write is forwarded to the variable services.
+
+  @param[in]  VariableName  Null-terminated variable name.
+  @param[in]  VendorGuid    Vendor GUID of the variable.
+  @param[in]  Attributes    Attributes bitmask for the variable.
+  @param[in]  DataSize      Size of Data in bytes.
+  @param[in]  Data          Contents of the variable.
+
+  @return Status of the underlying SetVariable service.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+VarReadCacheSetVariable (
+  IN CHAR16    *VariableName,
+  IN EFI_GUID  *VendorGuid,
+  IN UINT32    Attributes,
+  IN UINTN     DataSize,
+  IN VOID      *Data
+  )
+{
+  VAR_READ_CACHE_ENTRY  *Entry;
+
+  if ((VariableName != NULL) && (VendorGuid != NULL)) {
+    //
+    // Invalidate before forwarding so a write that fails midway only
+    // costs a refetch on the next read.
+    //
+    Entry = VarReadCacheLookup (VariableName, VendorGuid);
+    if (Entry != NULL) {
+      Entry->Valid = FALSE;
+    }
+  }
+
+  return mOriginalSetVariable (VariableName, VendorGuid, Attributes, DataSize, Data);
+}
+
+/**
+  Converts the saved SetVariable pointer for the virtual address space.
+
+  @param[in]  Event    The event that was signaled.
+  @param[in]  Context  Not used.
+
+**/
+STATIC
+VOID
+EFIAPI
+VarReadCacheAddressChange (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  gRT->ConvertPointer (0, (VOID **)&mOriginalSetVariable);
+}
+
+/**
+  Arms the read cache once the variable write services are available.
+
+  Installs the SetVariable interposer into the runtime services table so
+  all subsequent writes invalidate their cached copies, then enables
+  serving reads from the cache.
+
+  @param[in]  Event    The event that was signaled.
+  @param[in]  Context  Not used.
+
+**/
+STATIC
+VOID
+EFIAPI
+VarReadCacheVariableWriteReady (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  EFI_STATUS  Status;
+  VOID        *Interface;
+
+  Status = gBS->LocateProtocol (&gEfiVariableWriteArchProtocolGuid, NULL, &Interface);
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  Status = gBS->CreateEventEx (
+                  EVT_NOTIFY_SIGNAL,
+                  TPL_NOTIFY,
+                  VarReadCacheAddressChange,
+                  NULL,
+                  &gEfiEventVirtualAddressChangeGuid,
+                  &mVirtualAddressChangeEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (Event);
+    return;
+  }
+
+  mOriginalSetVariable = gRT->SetVariable;
+  gRT->SetVariable = VarReadCacheSetVariable;
+  gRT->Hdr.CRC32 = 0;
+  gBS->CalculateCrc32 ((UINT8 *)&gRT->Hdr, gRT->Hdr.HeaderSize, &gRT->Hdr.CRC32);
+
+  mVarReadCacheEnabled = TRUE;
+  gBS->CloseEvent (Event);
+}
+
+/**
+  Library constructor. Arms the variable read cache for runtime images.
+
+  @param[in]  ImageHandle  The image handle of the linking module.
+  @param[in]  SystemTable  The EFI System Table pointer.
+
+  @retval EFI_SUCCESS  The constructor always succeeds; modules for which
+                       the cache cannot be armed keep pass-through reads.
+
+**/
+EFI_STATUS
+EFIAPI
+DxeRuntimeVariableReadLibConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS                 Status;
+  EFI_LOADED_IMAGE_PROTOCOL  *LoadedImage;
+  EFI_EVENT                  Event;
+
+  if ((gBS == NULL) || (gRT == NULL)) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // The SetVariable interposer must stay callable for as long as it is
+  // linked into the runtime services table, so the cache is only armed
+  // when the linking module is a runtime image.
+  //
+  Status = gBS->HandleProtocol (ImageHandle, &gEfiLoadedImageProtocolGuid, (VOID **)&LoadedImage);
+  if (EFI_ERROR (Status) || (LoadedImage->ImageCodeType != EfiRuntimeServicesCode)) {
+    return EFI_SUCCESS;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  VarReadCacheVariableWriteReady,
+                  NULL,
+                  &Event
+                  );
+  if (EFI_ERROR (Status)) {
+    return EFI_SUCCESS;
+  }
+
+  Status = gBS->RegisterProtocolNotify (
+                  &gEfiVariableWriteArchProtocolGuid,
+                  Event,
+                  &mVariableWriteRegistration
+                  );
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (Event);
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Kick the notification once in case the write services are already up.
+  //
+  gBS->SignalEvent (Event);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Returns the value of a variable.
+
+  @param[in]       VariableName  A Null-terminated string that is the name of the vendor's
+                                 variable.
+  @param[in]       VendorGuid    A unique identifier for the vendor.
+  @param[out]      Attributes    If not NULL, a pointer to the memory location to return the
+                                 attributes bitmask for the variable.
+  @param[in, out]  DataSize      On input, the size in bytes of the return Data buffer.
+                                 On output the size of data returned in Data.
+  @param[out]      Data          The buffer to return the contents of the variable. May be NULL
+                                 with a zero DataSize in order to determine the size buffer needed.
+
+  @retval EFI_SUCCESS            The function completed successfully.
+  @retval EFI_NOT_FOUND          The variable was not found.
+  @retval EFI_BUFFER_TOO_SMALL   The DataSize is too small for the result.
+  @retval EFI_INVALID_PARAMETER  VariableName is NULL.
+  @retval EFI_INVALID_PARAMETER  VendorGuid is NULL.
+  @retval EFI_INVALID_PARAMETER  DataSize is NULL.
+  @retval EFI_INVALID_PARAMETER  The DataSize is not too small and Data is NULL.
+  @retval EFI_DEVICE_ERROR       The variable could not be retrieved due to a hardware error.
+  @retval EFI_SECURITY_VIOLATION The variable could not be retrieved due to an authentication failure.
+  @retval EFI_UNSUPPORTED        This function is not implemented by this instance of the LibraryClass
+
+**/
+EFI_STATUS
+EFIAPI
+VarLibGetVariable (
+  IN     CHAR16                      *VariableName,
+  IN     EFI_GUID                    *VendorGuid,
+  OUT    UINT32                      *Attributes,    OPTIONAL
+  IN OUT UINTN                       *DataSize,
+  OUT    VOID                        *Data           OPTIONAL
+  )
+{
+  EFI_STATUS            Status;
+  VAR_READ_CACHE_ENTRY  *Entry;
+
+  if (gRT == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (mVarReadCacheEnabled &&
+      (VariableName != NULL) && (VendorGuid != NULL) && (DataSize != NULL)) {
+    Entry = VarReadCacheLookup (VariableName, VendorGuid);
+    if ((Entry != NULL) && ((Attributes == NULL) || Entry->AttributesValid)) {
+      Entry->LastUse = ++mVarReadCacheUseCount;
+      if (*DataSize < Entry->DataSize) {
+        *DataSize = Entry->DataSize;
+        return EFI_BUFFER_TOO_SMALL;
+      }
+      if (Data == NULL) {
+        return EFI_INVALID_PARAMETER;
+      }
+      CopyMem (Data, Entry->Data, Entry->DataSize);
+      *DataSize = Entry->DataSize;
+      if (Attributes != NULL) {
+        *Attributes = Entry->Attributes;
+      }
+      return EFI_SUCCESS;
+    }
+  }
+
+  Status = gRT->GetVariable (
+                  VariableName,
+                  VendorGuid,
+                  Attributes,
+                  DataSize,
+                  Data
+                  );
+
+  if (mVarReadCacheEnabled && !EFI_ERROR (Status) &&
+      (VariableName != NULL) && (VendorGuid != NULL) &&
+      (DataSize != NULL) && (Data != NULL)) {
+    VarReadCacheInsert (VariableName, VendorGuid, Attributes, *DataSize, Data);
+  }
+
+  return Status;
+}
+
+/**
+  Enumerates the current variable names.
+
+  @param[in, out]  VariableNameSize The size of the VariableName buffer. The size must be large
+                                    enough to fit input string supplied in VariableName buffer.
+  @param[in, out]  VariableName     On input, supplies the last VariableName that was returned
+                                    by GetNextVariableName(). On output, returns the Nullterminated
+                                    string of the current variable.
+  @param[in, out]  VendorGuid       On input, supplies the last VendorGuid that was returned by
+                                    GetNextVariableName(). On output, returns the
+                                    VendorGuid of the current variable.
+
+  @retval EFI_SUCCESS           The function completed successfully.
+  @retval EFI_NOT_FOUND         The next variable was not found.
+  @retval EFI_BUFFER_TOO_SMALL  The VariableNameSize is too small for the result.
+                                VariableNameSize has been updated with the size needed to complete the request.
+  @retval EFI_INVALID_PARAMETER VariableNameSize is NULL.
+  @retval EFI_INVALID_PARAMETER VariableName is NULL.
+  @retval EFI_INVALID_PARAMETER VendorGuid is NULL.
+  @retval EFI_INVALID_PARAMETER The input values of VariableName and VendorGuid are not a name and
+                                GUID of an existing variable.
+  @retval EFI_INVALID_PARAMETER Null-terminator is not found in the first VariableNameSize bytes of
+                                the input VariableName buffer.
+  @retval EFI_DEVICE_ERROR      The variable could not be retrieved due to a hardware error.
+  @retval EFI_UNSUPPORTED       This function is not implemented by this instance of the LibraryClass
+
+**/
+EFI_STATUS
+EFIAPI
+VarLibGetNextVariableName (
+  IN OUT UINTN                    *VariableNameSize,
+  IN OUT CHAR16                   *VariableName,
+  IN OUT EFI_GUID                 *VendorGuid
+  )
+{
+  EFI_STATUS    Status = EFI_UNSUPPORTED;
+
+  if (gRT != NULL) {
+    Status = gRT->GetNextVariableName (
+                    VariableNameSize,
+                    VariableName,
+                    VendorGuid
+                    );
+  }
+  return Status;
+}
@@ -291,6 +291,166 @@ GetNextVariablePtr (
   return (AUTHENTICATED_VARIABLE_HEADER *) HEADER_ALIGN (Value);
 }
 
+//
+// Hash index over the default variable HOB store. It is built once on the
+// first lookup and published as its own GUID HOB, so every PEIM linking
+// this library shares the same table. Slots are open-addressed by a
+// name+GUID hash and hold the offset of the variable header from the
+// store header; a query costs a few compares instead of a walk over the
+// whole store. SetVariableToHob only updates variable data in place and
+// never moves a header, so offsets stay valid for the life of the store.
+//
+#define VARIABLE_HOB_INDEX_MAX_VARIABLES  2048
+
+typedef struct {
+  UINT32  NameHash;
+  UINT32  Offset;
+} VARIABLE_HOB_INDEX_ENTRY;
+
+typedef struct {
+  EFI_PHYSICAL_ADDRESS      StoreBase;
+  UINT32                    SlotCount;
+  VARIABLE_HOB_INDEX_ENTRY  Entry[1];
+} VARIABLE_HOB_INDEX;
+
+#define VARIABLE_HOB_INDEX_SIZE(SlotCount) \
+  (OFFSET_OF (VARIABLE_HOB_INDEX, Entry) + (SlotCount) * sizeof (VARIABLE_HOB_INDEX_ENTRY))
+
+/**
+  This code computes a hash over the variable name and vendor guid.
+
+  @param  VariableName  Pointer to Null-terminated variable name.
+  @param  VendorGuid    Pointer to Vendor Guid.
+
+  @return Hash value for the variable identity.
+
+**/
+STATIC
+UINT32
+VariableHobIndexHash (
+  IN CONST CHAR16     *VariableName,
+  IN CONST EFI_GUID   *VendorGuid
+  )
+{
+  UINT32  Hash;
+  UINTN   Index;
+
+  Hash = VendorGuid->Data1;
+  for (Index = 0; VariableName[Index] != 0; Index++) {
+    Hash = (Hash << 5) + Hash + VariableName[Index];
+  }
+  return Hash;
+}
+
+/**
+  This code inserts a variable offset into the hash index.
+
+  @param  IndexTable  Pointer to the hash index.
+  @param  NameHash    Hash of the variable name and vendor guid.
+  @param  Offset      Offset of the variable header from the store header.
+
+**/
+STATIC
+VOID
+VariableHobIndexInsert (
+  IN VARIABLE_HOB_INDEX   *IndexTable,
+  IN UINT32               NameHash,
+  IN UINT32               Offset
+  )
+{
+  UINT32  Slot;
+
+  Slot = NameHash & (IndexTable->SlotCount - 1);
+  while (IndexTable->Entry[Slot].Offset != 0) {
+    Slot = (Slot + 1) & (IndexTable->SlotCount - 1);
+  }
+  IndexTable->Entry[Slot].NameHash = NameHash;
+  IndexTable->Entry[Slot].Offset   = Offset;
+}
+
+/**
+  This code gets the hash index for the given variable store, building
+  it on the first call.
+
+  @param  VariableStoreHeader  Pointer to the Variable Store Header.
+  @param  AuthFlag             Authenticated variable flag.
+
+  @return Pointer to the hash index, or NULL when no index can be used
+          and the caller must fall back to a linear scan.
+
+**/
+STATIC
+VARIABLE_HOB_INDEX *
+GetVariableHobIndex (
+  IN VARIABLE_STORE_HEADER    *VariableStoreHeader,
+  IN BOOLEAN                  AuthFlag
+  )
+{
+  EFI_HOB_GUID_TYPE             *GuidHob;
+  VARIABLE_HOB_INDEX            *IndexTable;
+  AUTHENTICATED_VARIABLE_HEADER *CurrPtr;
+  AUTHENTICATED_VARIABLE_HEADER *EndPtr;
+  UINT32                        Count;
+  UINT32                        SlotCount;
+
+  GuidHob = GetFirstGuidHob (&gVariableHobIndexGuid);
+  if (GuidHob != NULL) {
+    IndexTable = (VARIABLE_HOB_INDEX *) GET_GUID_HOB_DATA (GuidHob);
+    if (IndexTable->StoreBase == (EFI_PHYSICAL_ADDRESS) (UINTN) VariableStoreHeader) {
+      return IndexTable;
+    }
+    //
+    // The index belongs to another store instance.
+    //
+    return NULL;
+  }
+
+  //
+  // Count the live variables to size the table at no more than half full.
+  //
+  Count  = 0;
+  EndPtr = GetEndPointer (VariableStoreHeader);
+  for ( CurrPtr = GetStartPointer (VariableStoreHeader)
+      ; (CurrPtr < EndPtr) && IsValidVariableHeader (CurrPtr)
+      ; CurrPtr = GetNextVariablePtr (CurrPtr, AuthFlag)
+      ) {
+    if (CurrPtr->State == VAR_ADDED) {
+      Count ++;
+    }
+  }
+  if (Count > VARIABLE_HOB_INDEX_MAX_VARIABLES) {
+    return NULL;
+  }
+
+  SlotCount = 1;
+  while (SlotCount < 2 * Count) {
+    SlotCount <<= 1;
+  }
+
+  IndexTable = (VARIABLE_HOB_INDEX *) BuildGuidHob (&gVariableHobIndexGuid, VARIABLE_HOB_INDEX_SIZE (SlotCount));
+  if (IndexTable == NULL) {
+    return NULL;
+  }
+  ZeroMem (IndexTable, VARIABLE_HOB_INDEX_SIZE (SlotCount));
+  IndexTable->StoreBase = (EFI_PHYSICAL_ADDRESS) (UINTN) VariableStoreHeader;
+  IndexTable->SlotCount = SlotCount;
+
+  for ( CurrPtr = GetStartPointer (VariableStoreHeader)
+      ; (CurrPtr < EndPtr) && IsValidVariableHeader (CurrPtr)
+      ; CurrPtr = GetNextVariablePtr (CurrPtr, AuthFlag)
+      ) {
+    if (CurrPtr->State == VAR_ADDED) {
+      VariableHobIndexInsert (
+        IndexTable,
+        VariableHobIndexHash (GetVariableNamePtr (CurrPtr, AuthFlag), GetVendorGuidPtr (CurrPtr, AuthFlag)),
+        (UINT32) ((UINTN) CurrPtr - (UINTN) VariableStoreHeader)
+        );
+    }
+  }
+
+  return IndexTable;
+}
+
 EFI_STATUS
 EFIAPI
 BuildDefaultDataHobForRecoveryVariable (
@@ -430,6 +590,9 @@ FindVariableFromHob (
   AUTHENTICATED_VARIABLE_HEADER *EndPtr;
   AUTHENTICATED_VARIABLE_HEADER *CurrPtr;
   VOID                          *Point;
+  VARIABLE_HOB_INDEX            *IndexTable;
+  UINT32                        NameHash;
+  UINT32                        Slot;
 
   VariableStoreHeader = NULL;
 
@@ -449,6 +612,27 @@ FindVariableFromHob (
     return NULL;
   }
 
+  //
+  // Probe the hash index first; the linear scan below only remains as
+  // the fallback for when no index could be built.
+  //
+  IndexTable = GetVariableHobIndex (VariableStoreHeader, *AuthFlag);
+  if (IndexTable != NULL) {
+    NameHash = VariableHobIndexHash (VariableName, VendorGuid);
+    Slot     = NameHash & (IndexTable->SlotCount - 1);
+    while (IndexTable->Entry[Slot].Offset != 0) {
+      if (IndexTable->Entry[Slot].NameHash == NameHash) {
+        CurrPtr = (AUTHENTICATED_VARIABLE_HEADER *) ((UINT8 *) VariableStoreHeader + IndexTable->Entry[Slot].Offset);
+        if (CompareGuid (VendorGuid, GetVendorGuidPtr (CurrPtr, *AuthFlag)) &&
+            (CompareMem (VariableName, GetVariableNamePtr (CurrPtr, *AuthFlag), NameSizeOfVariable (CurrPtr, *AuthFlag)) == 0)) {
+          return CurrPtr;
+        }
+      }
+      Slot = (Slot + 1) & (IndexTable->SlotCount - 1);
+    }
+    return NULL;
+  }
+
   StartPtr = GetStartPointer (VariableStoreHeader);
   EndPtr   = GetEndPointer (VariableStoreHeader);
   for ( CurrPtr = StartPtr
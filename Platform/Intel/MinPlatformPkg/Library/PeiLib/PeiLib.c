@@ -7,6 +7,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <PiPei.h>
 #include <Library/DebugLib.h>
+#include <Library/HobLib.h>
+#include <Library/PeiLib.h>
 #include <Library/PeiServicesLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/LargeVariableReadLib.h>
@@ -354,3 +356,55 @@ PeiGetSectionFromAnyFv  (
 
   return EFI_SUCCESS;
 }
+
+/**
+  Write one trace record into the trace ring HOB.
+
+  The ring HOB is created on the first call; afterwards each record costs a
+  HOB list walk and a fixed-size store, with no allocation. Intended to be
+  used through the PEI_TRACE_BEGIN/PEI_TRACE_END macros.
+
+  @param[in] Id        Caller chosen probe identifier.
+  @param[in] StartTsc  TSC value at the start of the traced region.
+  @param[in] EndTsc    TSC value at the end of the traced region.
+**/
+VOID
+EFIAPI
+PeiTraceRecord (
+  IN UINT32  Id,
+  IN UINT64  StartTsc,
+  IN UINT64  EndTsc
+  )
+{
+  VOID              *GuidHob;
+  PEI_TRACE_RING    *Ring;
+  PEI_TRACE_RECORD  *Record;
+
+  GuidHob = GetFirstGuidHob (&gPeiTraceRingHobGuid);
+  if (GuidHob != NULL) {
+    Ring = (PEI_TRACE_RING *) GET_GUID_HOB_DATA (GuidHob);
+  } else {
+    //
+    // Pre-allocate the whole ring on first use; later probes never allocate.
+    //
+    Ring = BuildGuidHob (
+             &gPeiTraceRingHobGuid,
+             sizeof (PEI_TRACE_RING) + PEI_TRACE_RING_RECORDS * sizeof (PEI_TRACE_RECORD)
+             );
+    if (Ring == NULL) {
+      return ;
+    }
+    Ring->Signature   = PEI_TRACE_RING_SIGNATURE;
+    Ring->RecordCount = PEI_TRACE_RING_RECORDS;
+    Ring->NextIndex   = 0;
+    Ring->Reserved    = 0;
+  }
+
+  Record = (PEI_TRACE_RECORD *) (Ring + 1);
+  Record += Ring->NextIndex % Ring->RecordCount;
+  Record->Id       = Id;
+  Record->Reserved = 0;
+  Record->StartTsc = StartTsc;
+  Record->EndTsc   = EndTsc;
+  Ring->NextIndex++;
+}
@@ -19,6 +19,142 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/PeiServicesLib.h>
 #include <Guid/SmramMemoryReserve.h>
 
+//
+// Maximum number of ranges in the desired memory type map and scratch space
+// for the MtrrLib solver.
+//
+#define SET_CACHE_MTRR_MAX_RANGE     16
+#define SET_CACHE_MTRR_SCRATCH_SIZE  SIZE_4KB
+
+/**
+  Count the variable MTRRs consumed by an MTRR settings buffer.
+
+  @param[in]  MtrrSetting  The MTRR settings buffer to examine.
+
+  @return  Number of valid variable MTRR entries.
+**/
+STATIC
+UINT32
+CountUsedVariableMtrrs (
+  IN MTRR_SETTINGS            *MtrrSetting
+  )
+{
+  UINT32  Index;
+  UINT32  VariableMtrrCount;
+  UINT32  UsedCount;
+
+  UsedCount = 0;
+  VariableMtrrCount = MtrrGetVariableMtrrCount ();
+  for (Index = 0; Index < VariableMtrrCount; Index++) {
+    if ((MtrrSetting->Variables.Mtrr[Index].Mask & BIT11) != 0) {
+      UsedCount++;
+    }
+  }
+
+  return UsedCount;
+}
+
+/**
+  Record one desired range and program it into the MTRR settings buffer.
+
+  The recorded range list is later fed to the MtrrLib solver as the full
+  desired memory type map so the per range solution can be minimized.
+
+  @param[in, out] MtrrSetting  The MTRR settings buffer to program.
+  @param[in, out] Ranges       The desired memory type map being collected.
+  @param[in, out] RangeCount   Number of entries in Ranges.
+  @param[in]      BaseAddress  Base address of the range.
+  @param[in]      Length       Length of the range.
+  @param[in]      Type         Memory cache type of the range.
+
+  @retval  EFI_SUCCESS  The range was programmed successfully.
+  @retval  Others       MtrrLib could not program the range.
+**/
+STATIC
+EFI_STATUS
+SetCacheMtrrRecordRange (
+  IN OUT MTRR_SETTINGS        *MtrrSetting,
+  IN OUT MTRR_MEMORY_RANGE    *Ranges,
+  IN OUT UINTN                *RangeCount,
+  IN UINT64                   BaseAddress,
+  IN UINT64                   Length,
+  IN MTRR_MEMORY_CACHE_TYPE   Type
+  )
+{
+  ASSERT (*RangeCount < SET_CACHE_MTRR_MAX_RANGE);
+  if (*RangeCount < SET_CACHE_MTRR_MAX_RANGE) {
+    Ranges[*RangeCount].BaseAddress = BaseAddress;
+    Ranges[*RangeCount].Length      = Length;
+    Ranges[*RangeCount].Type        = Type;
+    (*RangeCount)++;
+  }
+
+  return MtrrSetMemoryAttributeInMtrrSettings (
+           MtrrSetting,
+           BaseAddress,
+           Length,
+           Type
+           );
+}
+
+/**
+  Recompute the variable MTRR solution from the full desired memory type map.
+
+  The per range programming may consume more variable MTRRs than necessary.
+  Feed the complete range list to MtrrLib in a single request so it can merge
+  adjacent ranges and use subtractive placements, then keep whichever solution
+  uses fewer variable MTRRs. A debug dump compares both counts.
+
+  @param[in, out] MtrrSetting  The per range solution on input, updated to the
+                               minimal solution when a smaller one is found.
+  @param[in]      Ranges       The desired memory type map.
+  @param[in]      RangeCount   Number of entries in Ranges.
+**/
+STATIC
+VOID
+MinimizeVariableMtrrUsage (
+  IN OUT MTRR_SETTINGS        *MtrrSetting,
+  IN MTRR_MEMORY_RANGE        *Ranges,
+  IN UINTN                    RangeCount
+  )
+{
+  EFI_STATUS     Status;
+  MTRR_SETTINGS  SolvedSetting;
+  UINT32         BeforeCount;
+  UINT32         AfterCount;
+  UINTN          ScratchSize;
+  UINT8          Scratch[SET_CACHE_MTRR_SCRATCH_SIZE];
+
+  CopyMem (&SolvedSetting, MtrrSetting, sizeof (MTRR_SETTINGS));
+  ZeroMem (&SolvedSetting.Variables, sizeof (SolvedSetting.Variables));
+
+  ScratchSize = sizeof (Scratch);
+  Status = MtrrSetMemoryAttributesInMtrrSettings (
+             &SolvedSetting,
+             Scratch,
+             &ScratchSize,
+             Ranges,
+             RangeCount
+             );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_INFO, "MinimizeVariableMtrrUsage: solver failed - %r, keeping per range solution\n", Status));
+    return ;
+  }
+
+  BeforeCount = CountUsedVariableMtrrs (MtrrSetting);
+  AfterCount  = CountUsedVariableMtrrs (&SolvedSetting);
+  DEBUG ((
+    DEBUG_INFO,
+    "MinimizeVariableMtrrUsage: %d ranges, per range solution %d variable MTRRs, solved %d variable MTRRs\n",
+    (UINT32) RangeCount,
+    BeforeCount,
+    AfterCount
+    ));
+  if (AfterCount < BeforeCount) {
+    CopyMem (MtrrSetting, &SolvedSetting, sizeof (MTRR_SETTINGS));
+  }
+}
+
 /**
   Set Cache Mtrr.
 **/
@@ -38,17 +174,22 @@ SetCacheMtrr (
   EFI_BOOT_MODE               BootMode;
   EFI_RESOURCE_ATTRIBUTE_TYPE ResourceAttribute;
   UINT64                      CacheMemoryLength;
+  MTRR_MEMORY_RANGE           Ranges[SET_CACHE_MTRR_MAX_RANGE];
+  UINTN                       RangeCount;
 
   ///
   /// Reset all MTRR setting.
   ///
   ZeroMem(&MtrrSetting, sizeof(MTRR_SETTINGS));
+  RangeCount = 0;
 
   ///
   /// Cache the Flash area as WP to boost performance
   ///
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
+  Status = SetCacheMtrrRecordRange (
                 &MtrrSetting,
+                Ranges,
+                &RangeCount,
                 (UINTN) PcdGet32 (PcdFlashAreaBaseAddress),
                 (UINTN) PcdGet32 (PcdFlashAreaSize),
                 CacheWriteProtected
@@ -116,8 +257,10 @@ SetCacheMtrr (
   ///
   if (MemoryLength > 0xDC000000) {
      CacheMemoryLength = 0xC0000000;
-     Status = MtrrSetMemoryAttributeInMtrrSettings (
+     Status = SetCacheMtrrRecordRange (
                 &MtrrSetting,
+                Ranges,
+                &RangeCount,
                 MemoryBase,
                 CacheMemoryLength,
                 CacheWriteBack
@@ -128,8 +271,10 @@ SetCacheMtrr (
      CacheMemoryLength = MemoryLength - 0xC0000000;
      if (MemoryLength > 0xE0000000) {
         CacheMemoryLength = 0x20000000;
-        Status = MtrrSetMemoryAttributeInMtrrSettings (
+        Status = SetCacheMtrrRecordRange (
                  &MtrrSetting,
+                 Ranges,
+                 &RangeCount,
                  MemoryBase,
                  CacheMemoryLength,
                  CacheWriteBack
@@ -141,8 +286,10 @@ SetCacheMtrr (
      }
   }
 
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
+  Status = SetCacheMtrrRecordRange (
                 &MtrrSetting,
+                Ranges,
+                &RangeCount,
                 MemoryBase,
                 CacheMemoryLength,
                 CacheWriteBack
@@ -152,8 +299,10 @@ SetCacheMtrr (
   if (LowMemoryLength != MemoryLength) {
      MemoryBase = LowMemoryLength;
      MemoryLength -= LowMemoryLength;
-     Status = MtrrSetMemoryAttributeInMtrrSettings (
+     Status = SetCacheMtrrRecordRange (
                    &MtrrSetting,
+                   Ranges,
+                   &RangeCount,
                    MemoryBase,
                    MemoryLength,
                    CacheUncacheable
@@ -164,14 +313,21 @@ SetCacheMtrr (
   ///
   /// VGA-MMIO - 0xA0000 to 0xC0000 to be UC
   ///
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
+  Status = SetCacheMtrrRecordRange (
                 &MtrrSetting,
+                Ranges,
+                &RangeCount,
                 0xA0000,
                 0x20000,
                 CacheUncacheable
                 );
   ASSERT_EFI_ERROR (Status);
 
+  ///
+  /// Minimize variable MTRR usage from the full desired memory type map
+  ///
+  MinimizeVariableMtrrUsage (&MtrrSetting, Ranges, RangeCount);
+
   ///
   /// Update MTRR setting from MTRR buffer
   ///
@@ -205,6 +361,9 @@ SetCacheMtrrAfterEndOfPei (
   UINT64                                SmramSize;
   UINT64                                SmramBase;
   EFI_SMRAM_HOB_DESCRIPTOR_BLOCK        *SmramHobDescriptorBlock;
+  MTRR_MEMORY_RANGE                     Ranges[SET_CACHE_MTRR_MAX_RANGE];
+  UINTN                                 RangeCount;
+
   Status = PeiServicesGetBootMode (&BootMode);
   ASSERT_EFI_ERROR (Status);
 
@@ -215,6 +374,7 @@ SetCacheMtrrAfterEndOfPei (
   // Clear the CAR Settings
   //
   ZeroMem(&MtrrSetting, sizeof(MTRR_SETTINGS));
+  RangeCount = 0;
 
   //
   // Default Cachable attribute will be set to WB to support large memory size/hot plug memory
@@ -225,24 +385,30 @@ SetCacheMtrrAfterEndOfPei (
   //
   // Set fixed cache for memory range below 1MB
   //
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
+  Status = SetCacheMtrrRecordRange (
                          &MtrrSetting,
+                         Ranges,
+                         &RangeCount,
                          0x0,
                          0xA0000,
                          CacheWriteBack
                          );
   ASSERT_EFI_ERROR (Status);
 
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
+  Status = SetCacheMtrrRecordRange (
                          &MtrrSetting,
+                         Ranges,
+                         &RangeCount,
                          0xA0000,
                          0x20000,
                          CacheUncacheable
                          );
   ASSERT_EFI_ERROR (Status);
 
-  Status = MtrrSetMemoryAttributeInMtrrSettings (
+  Status = SetCacheMtrrRecordRange (
                          &MtrrSetting,
+                         Ranges,
+                         &RangeCount,
                          0xC0000,
                          0x40000,
                          CacheWriteProtected
@@ -283,6 +449,19 @@ SetCacheMtrrAfterEndOfPei (
   // Add IED size to set whole SMRAM as WB to save MTRR count
   //
   MemoryLength = MemoryBase - (SmramBase + SmramSize);
+  if (MemoryLength != 0) {
+    //
+    // Record the hole as a single range; the solver can place it without
+    // the power of two splitting the single range API requires.
+    //
+    ASSERT (RangeCount < SET_CACHE_MTRR_MAX_RANGE);
+    if (RangeCount < SET_CACHE_MTRR_MAX_RANGE) {
+      Ranges[RangeCount].BaseAddress = SmramBase + SmramSize;
+      Ranges[RangeCount].Length      = MemoryLength;
+      Ranges[RangeCount].Type        = CacheUncacheable;
+      RangeCount++;
+    }
+  }
   while (MemoryLength != 0) {
     Power2Length = GetPowerOfTwo64 (MemoryLength);
     MemoryBase -= Power2Length;
@@ -299,8 +478,10 @@ SetCacheMtrrAfterEndOfPei (
   DEBUG ((DEBUG_INFO, "PcdPciReservedMemAbove4GBLimit - 0x%lx\n", PcdGet64 (PcdPciReservedMemAbove4GBLimit)));
   DEBUG ((DEBUG_INFO, "PcdPciReservedMemAbove4GBBase - 0x%lx\n", PcdGet64 (PcdPciReservedMemAbove4GBBase)));
   if (PcdGet64 (PcdPciReservedMemAbove4GBLimit) > PcdGet64 (PcdPciReservedMemAbove4GBBase)) {
-    Status = MtrrSetMemoryAttributeInMtrrSettings (
+    Status = SetCacheMtrrRecordRange (
                            &MtrrSetting,
+                           Ranges,
+                           &RangeCount,
                            PcdGet64 (PcdPciReservedMemAbove4GBBase),
                            PcdGet64 (PcdPciReservedMemAbove4GBLimit) - PcdGet64 (PcdPciReservedMemAbove4GBBase) + 1,
                            CacheUncacheable
@@ -311,8 +492,10 @@ SetCacheMtrrAfterEndOfPei (
   DEBUG ((DEBUG_INFO, "PcdPciReservedPMemAbove4GBLimit - 0x%lx\n", PcdGet64 (PcdPciReservedPMemAbove4GBLimit)));
   DEBUG ((DEBUG_INFO, "PcdPciReservedPMemAbove4GBBase - 0x%lx\n", PcdGet64 (PcdPciReservedPMemAbove4GBBase)));
   if (PcdGet64 (PcdPciReservedPMemAbove4GBLimit) > PcdGet64 (PcdPciReservedPMemAbove4GBBase)) {
-    Status = MtrrSetMemoryAttributeInMtrrSettings (
+    Status = SetCacheMtrrRecordRange (
                            &MtrrSetting,
+                           Ranges,
+                           &RangeCount,
                            PcdGet64 (PcdPciReservedPMemAbove4GBBase),
                            PcdGet64 (PcdPciReservedPMemAbove4GBLimit) - PcdGet64 (PcdPciReservedPMemAbove4GBBase) + 1,
                            CacheUncacheable
@@ -320,6 +503,11 @@ SetCacheMtrrAfterEndOfPei (
     ASSERT_EFI_ERROR ( Status);
   }
 
+  //
+  // Minimize variable MTRR usage from the full desired memory type map
+  //
+  MinimizeVariableMtrrUsage (&MtrrSetting, Ranges, RangeCount);
+
   //
   // Update MTRR setting from MTRR buffer
   //
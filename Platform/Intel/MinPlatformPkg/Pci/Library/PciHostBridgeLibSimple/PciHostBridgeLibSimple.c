@@ -61,6 +61,54 @@ PCI_ROOT_BRIDGE mRootBridgeTemplate = {
   NULL // DevicePath;
 };
 
+/**
+  Carve one segment's share out of a resource aperture.
+
+  The configured window is divided into SegmentCount aligned chunks so
+  that every root bridge owns an independent range and the PCI bus
+  driver can size and assign the segments without serializing on a
+  shared aperture.  The last segment absorbs the division remainder.
+  A window too small to split is left entirely on segment 0.
+
+  @param Aperture      Aperture holding the full window on input and
+                       the segment's share on output.
+  @param Index         Segment owning the returned share.
+  @param SegmentCount  Total number of segments sharing the window.
+  @param Alignment     Required alignment of the chunk size.
+**/
+STATIC
+VOID
+PciHostBridgeSplitAperture (
+  IN OUT PCI_ROOT_BRIDGE_APERTURE *Aperture,
+  IN     UINT8                    Index,
+  IN     UINT8                    SegmentCount,
+  IN     UINT64                   Alignment
+  )
+{
+  UINT64 ChunkSize;
+  UINT64 Base;
+
+  if (Aperture->Base >= Aperture->Limit) {
+    return;
+  }
+
+  ChunkSize = DivU64x32 (Aperture->Limit - Aperture->Base + 1, SegmentCount);
+  ChunkSize &= ~(Alignment - 1);
+  if (ChunkSize == 0) {
+    if (Index != 0) {
+      Aperture->Base  = MAX_UINT64;
+      Aperture->Limit = 0;
+    }
+    return;
+  }
+
+  Base = Aperture->Base + MultU64x32 (ChunkSize, Index);
+  if (Index != SegmentCount - 1) {
+    Aperture->Limit = Base + ChunkSize - 1;
+  }
+  Aperture->Base = Base;
+}
+
 /**
   Return all the root bridge instances.
 
@@ -77,6 +125,7 @@ PciHostBridgeGetRootBridges (
   )
 {
   UINT8 Index;
+  UINT8 SegmentCount;
   PCI_ROOT_BRIDGE *RootBridge;
 
   RootBridge = AllocateZeroPool (sizeof (PCI_ROOT_BRIDGE) * PcdGet8 (PcdPciSegmentCount));
@@ -112,15 +161,23 @@ PciHostBridgeGetRootBridges (
   mRootBridgeTemplate.NoExtendedConfigSpace = PcdGetBool (PcdPciNoExtendedConfigSpace);
   mRootBridgeTemplate.ResourceAssigned = PcdGetBool (PcdPciResourceAssigned);
 
-  for (Index = 0; Index < PcdGet8 (PcdPciSegmentCount); Index ++) {
+  SegmentCount = PcdGet8 (PcdPciSegmentCount);
+  for (Index = 0; Index < SegmentCount; Index ++) {
     mRootBridgeDeviceNodeTemplate.UID = Index;
     mRootBridgeTemplate.Segment = Index;
     mRootBridgeTemplate.DevicePath = NULL;
     mRootBridgeTemplate.DevicePath = AppendDevicePathNode (NULL, &mRootBridgeDeviceNodeTemplate.Header);
     CopyMem (RootBridge + Index, &mRootBridgeTemplate, sizeof (PCI_ROOT_BRIDGE));
+    if (SegmentCount > 1) {
+      PciHostBridgeSplitAperture (&RootBridge[Index].Io, Index, SegmentCount, SIZE_4KB);
+      PciHostBridgeSplitAperture (&RootBridge[Index].Mem, Index, SegmentCount, SIZE_1MB);
+      PciHostBridgeSplitAperture (&RootBridge[Index].MemAbove4G, Index, SegmentCount, SIZE_1MB);
+      PciHostBridgeSplitAperture (&RootBridge[Index].PMem, Index, SegmentCount, SIZE_1MB);
+      PciHostBridgeSplitAperture (&RootBridge[Index].PMemAbove4G, Index, SegmentCount, SIZE_1MB);
+    }
   }
 
-  *Count = PcdGet8 (PcdPciSegmentCount);
+  *Count = SegmentCount;
   return RootBridge;
 }
 
@@ -131,8 +188,13 @@ PciHostBridgeFreeRootBridges (
   UINTN           Count
   )
 {
+  UINTN Index;
+
   ASSERT (Count <= PcdGet8 (PcdPciSegmentCount));
-  FreePool (Bridges->DevicePath);
+  for (Index = 0; Index < Count; Index ++) {
+    FreePool (Bridges[Index].DevicePath);
+  }
+  FreePool (Bridges);
 }
 
 /**
@@ -1,6 +1,7 @@
 /** @file
-  Default PCI Segment Information Library that returns one segment whose
-  segment base address equals to PcdPciExpressBaseAddress.
+  Default PCI Segment Information Library that returns PcdPciSegmentCount
+  segments laid out contiguously: segment N base address equals to
+  PcdPciExpressBaseAddress + N * PcdPciExpressRegionLength.
 
   Copyright (c) 2017, Intel Corporation. All rights reserved.<BR>
   SPDX-License-Identifier: BSD-2-Clause-Patent
@@ -9,6 +10,7 @@
 
 #include <Base.h>
 #include <Library/PciSegmentInfoLib.h>
+#include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
 #include <Library/HobLib.h>
 #include <Library/PcdLib.h>
@@ -17,9 +19,31 @@
   0x6eab7169, 0x9b21, 0x450e, { 0x99, 0xe8, 0xe, 0xb1, 0x1b, 0x7d, 0xfe, 0xcb } \
   }
 
+#define PCI_SEGMENT_INFO_MAX_COUNT  8
+
 EFI_GUID  mPciSegmentInfoHobGuid = PCI_SEGMENT_INFO_HOB_GUID;
 
-volatile PCI_SEGMENT_INFO  mPciSegmentInfo;
+volatile PCI_SEGMENT_INFO  mPciSegmentInfo[PCI_SEGMENT_INFO_MAX_COUNT];
+
+/**
+  Fill one entry of the segment information array.
+
+  @param  PciSegmentInfo  Entry to fill.
+  @param  SegmentNumber   Segment described by the entry.
+**/
+STATIC
+VOID
+InitPciSegmentInfoEntry (
+  OUT volatile PCI_SEGMENT_INFO  *PciSegmentInfo,
+  IN  UINT16                     SegmentNumber
+  )
+{
+  PciSegmentInfo->SegmentNumber  = SegmentNumber;
+  PciSegmentInfo->BaseAddress    = PcdGet64 (PcdPciExpressBaseAddress) +
+                                   MultU64x32 ((UINT64)PcdGet32 (PcdPciExpressRegionLength), SegmentNumber);
+  PciSegmentInfo->StartBusNumber = 0;
+  PciSegmentInfo->EndBusNumber   = (UINT8)((PcdGet32 (PcdPciExpressRegionLength) / 0x100000) - 1);
+}
 
 /**
   Return an array of PCI_SEGMENT_INFO holding the segment information.
@@ -38,36 +62,44 @@ GetPciSegmentInfo (
 {
   VOID              *Hob;
   PCI_SEGMENT_INFO  *PciSegmentInfo;
+  UINT16            SegmentNumber;
+  UINTN             SegmentCount;
 
   if (Count == NULL) {
     return NULL;
   }
 
-  *Count = 1;
   Hob = GetFirstGuidHob (&mPciSegmentInfoHobGuid);
   if (Hob != NULL) {
+    *Count = GET_GUID_HOB_DATA_SIZE (Hob) / sizeof (PCI_SEGMENT_INFO);
     PciSegmentInfo = GET_GUID_HOB_DATA(Hob);
   } else {
-    mPciSegmentInfo.SegmentNumber  = 0;
-    mPciSegmentInfo.BaseAddress    = PcdGet64(PcdPciExpressBaseAddress);
-    mPciSegmentInfo.StartBusNumber = 0;
-    mPciSegmentInfo.EndBusNumber   = (UINT8)((PcdGet32 (PcdPciExpressRegionLength) / 0x100000) - 1);
+    SegmentCount = PcdGet8 (PcdPciSegmentCount);
+    ASSERT (SegmentCount >= 1 && SegmentCount <= PCI_SEGMENT_INFO_MAX_COUNT);
+    if (SegmentCount > PCI_SEGMENT_INFO_MAX_COUNT) {
+      SegmentCount = PCI_SEGMENT_INFO_MAX_COUNT;
+    }
+    *Count = SegmentCount;
 
-    DEBUG ((DEBUG_INFO, "mPciSegmentInfo.BaseAddress - 0x%x\n", mPciSegmentInfo.BaseAddress));
+    for (SegmentNumber = 0; SegmentNumber < SegmentCount; SegmentNumber++) {
+      InitPciSegmentInfoEntry (&mPciSegmentInfo[SegmentNumber], SegmentNumber);
+    }
+
+    DEBUG ((DEBUG_INFO, "mPciSegmentInfo[0].BaseAddress - 0x%x\n", mPciSegmentInfo[0].BaseAddress));
 
-    if (mPciSegmentInfo.BaseAddress == 0) {
+    if (mPciSegmentInfo[0].BaseAddress == 0) {
       // Premem phase
-      PciSegmentInfo = BuildGuidHob (&mPciSegmentInfoHobGuid, sizeof(PCI_SEGMENT_INFO));
+      PciSegmentInfo = BuildGuidHob (&mPciSegmentInfoHobGuid,
+                         SegmentCount * sizeof(PCI_SEGMENT_INFO));
       ASSERT(PciSegmentInfo != NULL);
       if (PciSegmentInfo == NULL) {
         return NULL;
       }
-      PciSegmentInfo->SegmentNumber  = 0;
-      PciSegmentInfo->BaseAddress    = PcdGet64(PcdPciExpressBaseAddress);
-      PciSegmentInfo->StartBusNumber = 0;
-      PciSegmentInfo->EndBusNumber   = (UINT8)((PcdGet32 (PcdPciExpressRegionLength) / 0x100000) - 1);
+      for (SegmentNumber = 0; SegmentNumber < SegmentCount; SegmentNumber++) {
+        InitPciSegmentInfoEntry (&PciSegmentInfo[SegmentNumber], SegmentNumber);
+      }
     } else {
-      PciSegmentInfo = (VOID *)&mPciSegmentInfo;
+      PciSegmentInfo = (VOID *)&mPciSegmentInfo[0];
     }
   }
   return PciSegmentInfo;
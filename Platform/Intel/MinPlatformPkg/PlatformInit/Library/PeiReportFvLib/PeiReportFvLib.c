@@ -14,6 +14,54 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/ReportFvLib.h>
 #include <Guid/FirmwareFileSystem2.h>
 #include <Ppi/FirmwareVolumeInfo.h>
+#include <Ppi/EndOfPeiPhase.h>
+
+EFI_STATUS
+EFIAPI
+DeferredFvNotifyCallback (
+  IN CONST EFI_PEI_SERVICES      **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR   *NotifyDescriptor,
+  IN VOID                        *Ppi
+  );
+
+static EFI_PEI_NOTIFY_DESCRIPTOR mDeferredFvNotifyList = {
+  (EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK | EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST),
+  &gEfiEndOfPeiSignalPpiGuid,
+  (EFI_PEIM_NOTIFY_ENTRY_POINT) DeferredFvNotifyCallback
+};
+
+/**
+  Report the deferred advanced feature FV at end of PEI.
+
+  Installing the FV info PPI this late still builds the FV HOB for DXE but
+  keeps the PEI dispatcher from ever scanning the FV, so its contents are
+  only processed once the DXE dispatcher demands a file from it.
+
+  @param[in]  PeiServices       General purpose services available to every PEIM.
+  @param[in]  NotifyDescriptor  Notify that this module published.
+  @param[in]  Ppi               PPI that was installed.
+  @retval     EFI_SUCCESS       The function completed successfully.
+**/
+EFI_STATUS
+EFIAPI
+DeferredFvNotifyCallback (
+  IN CONST EFI_PEI_SERVICES     **PeiServices,
+  IN EFI_PEI_NOTIFY_DESCRIPTOR  *NotifyDescriptor,
+  IN VOID                       *Ppi
+  )
+{
+  DEBUG ((DEBUG_INFO, "Install deferred FlashFvAdvanced - 0x%x, 0x%x\n", PcdGet32 (PcdFlashFvAdvancedBase), PcdGet32 (PcdFlashFvAdvancedSize)));
+  PeiServicesInstallFvInfo2Ppi (
+    &(((EFI_FIRMWARE_VOLUME_HEADER *) (UINTN) PcdGet32 (PcdFlashFvAdvancedBase))->FileSystemGuid),
+    (VOID *) (UINTN) PcdGet32 (PcdFlashFvAdvancedBase),
+    PcdGet32 (PcdFlashFvAdvancedSize),
+    NULL,
+    NULL,
+    0
+    );
+
+  return EFI_SUCCESS;
+}
 
 VOID
 ReportPreMemFv (
@@ -112,15 +160,25 @@ ReportPostMemFv (
       0
       );
     if (PcdGet8 (PcdBootStage) >= 6) {
-      DEBUG ((DEBUG_INFO, "Install FlashFvAdvanced - 0x%x, 0x%x\n", PcdGet32 (PcdFlashFvAdvancedBase), PcdGet32 (PcdFlashFvAdvancedSize)));
-      PeiServicesInstallFvInfo2Ppi (
-        &(((EFI_FIRMWARE_VOLUME_HEADER *) (UINTN) PcdGet32 (PcdFlashFvAdvancedBase))->FileSystemGuid),
-        (VOID *) (UINTN) PcdGet32 (PcdFlashFvAdvancedBase),
-        PcdGet32 (PcdFlashFvAdvancedSize),
-        NULL,
-        NULL,
-        0
-        );
+      if (PcdGetBool (PcdDeferAdvancedFvReport)) {
+        ///
+        /// Defer the report until end of PEI so the PEI dispatcher never
+        /// scans this FV; DXE still receives it through the FV HOB.
+        ///
+        DEBUG ((DEBUG_INFO, "Defer FlashFvAdvanced - 0x%x, 0x%x\n", PcdGet32 (PcdFlashFvAdvancedBase), PcdGet32 (PcdFlashFvAdvancedSize)));
+        Status = PeiServicesNotifyPpi (&mDeferredFvNotifyList);
+        ASSERT_EFI_ERROR (Status);
+      } else {
+        DEBUG ((DEBUG_INFO, "Install FlashFvAdvanced - 0x%x, 0x%x\n", PcdGet32 (PcdFlashFvAdvancedBase), PcdGet32 (PcdFlashFvAdvancedSize)));
+        PeiServicesInstallFvInfo2Ppi (
+          &(((EFI_FIRMWARE_VOLUME_HEADER *) (UINTN) PcdGet32 (PcdFlashFvAdvancedBase))->FileSystemGuid),
+          (VOID *) (UINTN) PcdGet32 (PcdFlashFvAdvancedBase),
+          PcdGet32 (PcdFlashFvAdvancedSize),
+          NULL,
+          NULL,
+          0
+          );
+      }
     }
   }
 
@@ -8,12 +8,24 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Ppi/Stall.h>
 #include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
+#include <Library/HobLib.h>
 #include <Library/PeimEntryPoint.h>
 #include <Library/TimerLib.h>
 #include <Library/PeiServicesLib.h>
 
 #define PEI_STALL_RESOLUTION   1
 
+//
+// Number of microseconds of timer reference used to calibrate the TSC.
+//
+#define PEI_STALL_TSC_CALIBRATE_US  100
+
+#define PEI_STALL_TSC_HOB_GUID { \
+  0x34d6f1a2, 0x9f5c, 0x4e8b, { 0xa7, 0x30, 0x6f, 0x91, 0x07, 0x3e, 0xd8, 0x51 } \
+  }
+
+EFI_GUID  mStallTscHobGuid = PEI_STALL_TSC_HOB_GUID;
+
 /**
   The Stall() function provides a blocking stall for at least the number
   of microseconds stipulated in the final argument of the API.
@@ -45,6 +57,29 @@ EFI_PEI_PPI_DESCRIPTOR  mPeiInstallStallPpi = {
   &mStallPpi
 };
 
+/**
+  Check whether the processor advertises an invariant TSC.
+
+  @retval TRUE   The TSC runs at a constant rate in all P-/C-/T-states.
+  @retval FALSE  The TSC rate may vary and cannot be used for timing.
+
+**/
+BOOLEAN
+IsInvariantTscSupported (
+  VOID
+  )
+{
+  UINT32  MaxExtendedFunction;
+  UINT32  RegEdx;
+
+  AsmCpuid (0x80000000, &MaxExtendedFunction, NULL, NULL, NULL);
+  if (MaxExtendedFunction < 0x80000007) {
+    return FALSE;
+  }
+  AsmCpuid (0x80000007, NULL, NULL, NULL, &RegEdx);
+  return (BOOLEAN) ((RegEdx & BIT8) != 0);
+}
+
 EFI_STATUS
 EFIAPI
 Stall (
@@ -53,6 +88,24 @@ Stall (
   IN UINTN                    Microseconds
   )
 {
+  VOID    *Hob;
+  UINT64  TicksPerMicrosecond;
+  UINT64  EndTsc;
+
+  //
+  // Spin on the TSC when a calibration HOB is present so that short
+  // stalls do not generate timer port IO transactions on every poll.
+  //
+  Hob = GetFirstGuidHob (&mStallTscHobGuid);
+  if (Hob != NULL) {
+    TicksPerMicrosecond = *(UINT64 *) GET_GUID_HOB_DATA (Hob);
+    EndTsc = AsmReadTsc () + MultU64x64 (TicksPerMicrosecond, Microseconds);
+    while (AsmReadTsc () < EndTsc) {
+      CpuPause ();
+    }
+    return EFI_SUCCESS;
+  }
+
   MicroSecondDelay (Microseconds);
 
   return EFI_SUCCESS;
@@ -79,6 +132,27 @@ StallServiceEntryPoint (
   )
 {
   EFI_STATUS   Status;
+  UINT64       StartTsc;
+  UINT64       TicksPerMicrosecond;
+  UINT64       *HobData;
+
+  //
+  // Calibrate the TSC once against the TimerLib reference timer.  The
+  // result is kept in a HOB because this PEIM may execute in place.
+  // Parts without an invariant TSC keep using the TimerLib path.
+  //
+  if (IsInvariantTscSupported ()) {
+    StartTsc = AsmReadTsc ();
+    MicroSecondDelay (PEI_STALL_TSC_CALIBRATE_US);
+    TicksPerMicrosecond = DivU64x32 (AsmReadTsc () - StartTsc, PEI_STALL_TSC_CALIBRATE_US);
+    if (TicksPerMicrosecond != 0) {
+      HobData = BuildGuidHob (&mStallTscHobGuid, sizeof (UINT64));
+      if (HobData != NULL) {
+        *HobData = TicksPerMicrosecond;
+        DEBUG ((DEBUG_INFO, "StallServicePei: TSC calibrated to %ld ticks/us\n", TicksPerMicrosecond));
+      }
+    }
+  }
 
   Status = PeiServicesInstallPpi (&mPeiInstallStallPpi);
   ASSERT_EFI_ERROR (Status);
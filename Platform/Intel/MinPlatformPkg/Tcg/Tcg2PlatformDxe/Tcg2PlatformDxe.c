@@ -8,7 +8,9 @@
 
 #include <PiDxe.h>
 
+#include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
+#include <Library/PerformanceLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiLib.h>
 #include <Library/TpmPlatformHierarchyLib.h>
@@ -46,7 +48,13 @@ SmmReadyToLockEventCallBack (
     return ;
   }
 
+  //
+  // Record the TPM transaction latency of the platform hierarchy
+  // configuration as FPDT event records for boot time analysis.
+  //
+  PERF_START_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x90C0);
   ConfigureTpmPlatformHierarchy ();
+  PERF_END_EX (NULL, "EventRec", NULL, AsmReadTsc (), 0x90C1);
 
   gBS->CloseEvent (Event);
 }
@@ -0,0 +1,68 @@
+/** @file
+  Application to dump the PEI trace ring HOB produced through PeiLib.
+
+Copyright (c) 2017 - 2021, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiDxe.h>
+#include <Library/BaseLib.h>
+#include <Library/HobLib.h>
+#include <Library/UefiLib.h>
+#include <Library/PeiLib.h>
+
+EFI_STATUS
+EFIAPI
+PeiTraceDumpAppEntrypoint (
+  IN EFI_HANDLE           ImageHandle,
+  IN EFI_SYSTEM_TABLE     *SystemTable
+  )
+{
+  VOID              *GuidHob;
+  PEI_TRACE_RING    *Ring;
+  PEI_TRACE_RECORD  *Record;
+  UINT32            First;
+  UINT32            Count;
+  UINT32            Index;
+  UINT32            Slot;
+
+  GuidHob = GetFirstGuidHob (&gPeiTraceRingHobGuid);
+  if (GuidHob == NULL) {
+    Print (L"PeiTrace ring HOB not found\n");
+    return EFI_SUCCESS;
+  }
+
+  Ring = (PEI_TRACE_RING *) GET_GUID_HOB_DATA (GuidHob);
+  if (Ring->Signature != PEI_TRACE_RING_SIGNATURE) {
+    Print (L"PeiTrace ring HOB corrupted\n");
+    return EFI_SUCCESS;
+  }
+
+  //
+  // When the ring wrapped, the oldest surviving record is at NextIndex.
+  //
+  Count = Ring->NextIndex;
+  First = 0;
+  if (Count > Ring->RecordCount) {
+    First = Count - Ring->RecordCount;
+    Count = Ring->RecordCount;
+  }
+
+  Print (L"PeiTrace ring - %d records written, %d retained\n", Ring->NextIndex, Count);
+  Print (L"Index     Id       StartTsc          EndTsc            DeltaTsc\n");
+  Record = (PEI_TRACE_RECORD *) (Ring + 1);
+  for (Index = 0; Index < Count; Index++) {
+    Slot = (First + Index) % Ring->RecordCount;
+    Print (
+      L"%8d  %08x %16lx  %16lx  %16lx\n",
+      First + Index,
+      Record[Slot].Id,
+      Record[Slot].StartTsc,
+      Record[Slot].EndTsc,
+      Record[Slot].EndTsc - Record[Slot].StartTsc
+      );
+  }
+
+  return EFI_SUCCESS;
+}
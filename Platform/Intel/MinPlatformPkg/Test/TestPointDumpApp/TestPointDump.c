@@ -15,6 +15,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/TestPointLib.h>
 #include <Protocol/AdapterInformation.h>
 
+VOID
+DumpBootPerformance (
+  VOID
+  );
+
 VOID
 DumpTestPoint (
   IN VOID                     *TestPointData
@@ -168,5 +173,7 @@ TestPointDumpAppEntrypoint (
 {
   DumpTestPointDataDxe (0, NULL);
 
+  DumpBootPerformance ();
+
   return EFI_SUCCESS;
 }
@@ -0,0 +1,338 @@
+/** @file
+
+Copyright (c) 2017, Intel Corporation. All rights reserved.<BR>
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <PiDxe.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/DebugLib.h>
+#include <Library/UefiLib.h>
+#include <IndustryStandard/Acpi.h>
+#include <Guid/Acpi.h>
+#include <Guid/FirmwarePerformance.h>
+#include <Guid/ExtendedFirmwarePerformance.h>
+
+#define MAX_PHASE_ENTRY     16
+#define MAX_MODULE_ENTRY    128
+#define MODULE_NAME_SIZE    32
+#define TOP_MODULE_COUNT    10
+
+typedef struct {
+  CHAR8     Name[MODULE_NAME_SIZE];
+  UINT64    StartTime;
+  UINT64    EndTime;
+} PHASE_ENTRY;
+
+typedef struct {
+  EFI_GUID  Guid;
+  CHAR8     Name[MODULE_NAME_SIZE];
+  UINT64    StartTime;
+  UINT64    TotalTime;
+  BOOLEAN   Started;
+} MODULE_ENTRY;
+
+PHASE_ENTRY   mPhaseTable[MAX_PHASE_ENTRY];
+UINTN         mPhaseCount;
+MODULE_ENTRY  mModuleTable[MAX_MODULE_ENTRY];
+UINTN         mModuleCount;
+
+/**
+  Find an ACPI table by its signature via the RSDP in the configuration table.
+
+  @param[in] Signature  The 32bit table signature to search for.
+
+  @return Pointer to the table, or NULL if it is not present.
+**/
+VOID *
+FindAcpiTableBySignature (
+  IN UINT32       Signature
+  )
+{
+  EFI_ACPI_5_0_ROOT_SYSTEM_DESCRIPTION_POINTER  *Rsdp;
+  EFI_ACPI_DESCRIPTION_HEADER                   *Sdt;
+  EFI_ACPI_DESCRIPTION_HEADER                   *Table;
+  UINTN                                         Index;
+  UINTN                                         EntryCount;
+  UINT64                                        *XsdtEntry;
+  UINT32                                        *RsdtEntry;
+
+  Rsdp = NULL;
+  for (Index = 0; Index < gST->NumberOfTableEntries; Index++) {
+    if (CompareGuid (&gST->ConfigurationTable[Index].VendorGuid, &gEfiAcpi20TableGuid) ||
+        CompareGuid (&gST->ConfigurationTable[Index].VendorGuid, &gEfiAcpi10TableGuid)) {
+      Rsdp = gST->ConfigurationTable[Index].VendorTable;
+      break;
+    }
+  }
+  if (Rsdp == NULL) {
+    return NULL;
+  }
+
+  if ((Rsdp->Revision >= 2) && (Rsdp->XsdtAddress != 0)) {
+    Sdt = (EFI_ACPI_DESCRIPTION_HEADER *)(UINTN)Rsdp->XsdtAddress;
+    EntryCount = (Sdt->Length - sizeof (EFI_ACPI_DESCRIPTION_HEADER)) / sizeof (UINT64);
+    XsdtEntry = (UINT64 *)(Sdt + 1);
+    for (Index = 0; Index < EntryCount; Index++) {
+      Table = (EFI_ACPI_DESCRIPTION_HEADER *)(UINTN)XsdtEntry[Index];
+      if ((Table != NULL) && (Table->Signature == Signature)) {
+        return Table;
+      }
+    }
+  } else {
+    Sdt = (EFI_ACPI_DESCRIPTION_HEADER *)(UINTN)Rsdp->RsdtAddress;
+    EntryCount = (Sdt->Length - sizeof (EFI_ACPI_DESCRIPTION_HEADER)) / sizeof (UINT32);
+    RsdtEntry = (UINT32 *)(Sdt + 1);
+    for (Index = 0; Index < EntryCount; Index++) {
+      Table = (EFI_ACPI_DESCRIPTION_HEADER *)(UINTN)RsdtEntry[Index];
+      if ((Table != NULL) && (Table->Signature == Signature)) {
+        return Table;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Record a cross module (boot phase) start or end event.
+
+  @param[in] Name        The phase name string from the record.
+  @param[in] Timestamp   The record timestamp in nanoseconds.
+  @param[in] IsStart     TRUE for a start record, FALSE for an end record.
+**/
+VOID
+RecordPhaseEvent (
+  IN CHAR8        *Name,
+  IN UINT64       Timestamp,
+  IN BOOLEAN      IsStart
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < mPhaseCount; Index++) {
+    if (AsciiStrnCmp (mPhaseTable[Index].Name, Name, MODULE_NAME_SIZE) == 0) {
+      break;
+    }
+  }
+  if (Index == mPhaseCount) {
+    if (mPhaseCount == MAX_PHASE_ENTRY) {
+      return ;
+    }
+    AsciiStrnCpyS (mPhaseTable[Index].Name, MODULE_NAME_SIZE, Name, MODULE_NAME_SIZE - 1);
+    mPhaseCount++;
+  }
+  if (IsStart) {
+    mPhaseTable[Index].StartTime = Timestamp;
+  } else {
+    mPhaseTable[Index].EndTime = Timestamp;
+  }
+}
+
+/**
+  Record a module start or end event and accumulate the module residency time.
+
+  @param[in] Guid        The module GUID from the record.
+  @param[in] Name        The module name string, or NULL if the record has none.
+  @param[in] Timestamp   The record timestamp in nanoseconds.
+  @param[in] IsStart     TRUE for a start record, FALSE for an end record.
+**/
+VOID
+RecordModuleEvent (
+  IN EFI_GUID     *Guid,
+  IN CHAR8        *Name OPTIONAL,
+  IN UINT64       Timestamp,
+  IN BOOLEAN      IsStart
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < mModuleCount; Index++) {
+    if (CompareGuid (&mModuleTable[Index].Guid, Guid)) {
+      break;
+    }
+  }
+  if (Index == mModuleCount) {
+    if (mModuleCount == MAX_MODULE_ENTRY) {
+      return ;
+    }
+    CopyGuid (&mModuleTable[Index].Guid, Guid);
+    mModuleCount++;
+  }
+  if ((Name != NULL) && (Name[0] != 0) && (mModuleTable[Index].Name[0] == 0)) {
+    AsciiStrnCpyS (mModuleTable[Index].Name, MODULE_NAME_SIZE, Name, MODULE_NAME_SIZE - 1);
+  }
+  if (IsStart) {
+    mModuleTable[Index].StartTime = Timestamp;
+    mModuleTable[Index].Started = TRUE;
+  } else {
+    if (mModuleTable[Index].Started && (Timestamp > mModuleTable[Index].StartTime)) {
+      mModuleTable[Index].TotalTime += Timestamp - mModuleTable[Index].StartTime;
+    }
+    mModuleTable[Index].Started = FALSE;
+  }
+}
+
+/**
+  Classify one FBPT record into the phase or module tables.
+
+  @param[in] RecordHeader  The record to classify.
+**/
+VOID
+ProcessFbptRecord (
+  IN EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER  *RecordHeader
+  )
+{
+  FPDT_GUID_EVENT_RECORD              *GuidEvent;
+  FPDT_DYNAMIC_STRING_EVENT_RECORD    *StringEvent;
+  FPDT_GUID_QWORD_EVENT_RECORD        *QwordEvent;
+  UINT16                              ProgressId;
+
+  switch (RecordHeader->Type) {
+  case FPDT_GUID_EVENT_TYPE:
+    GuidEvent = (FPDT_GUID_EVENT_RECORD *)RecordHeader;
+    ProgressId = GuidEvent->ProgressID;
+    if ((ProgressId == MODULE_START_ID) || (ProgressId == MODULE_END_ID)) {
+      RecordModuleEvent (&GuidEvent->Guid, NULL, GuidEvent->Timestamp, (BOOLEAN)(ProgressId == MODULE_START_ID));
+    }
+    break;
+  case FPDT_DYNAMIC_STRING_EVENT_TYPE:
+    StringEvent = (FPDT_DYNAMIC_STRING_EVENT_RECORD *)RecordHeader;
+    ProgressId = StringEvent->ProgressID;
+    if ((ProgressId == PERF_CROSSMODULE_START_ID) || (ProgressId == PERF_CROSSMODULE_END_ID)) {
+      RecordPhaseEvent (StringEvent->String, StringEvent->Timestamp, (BOOLEAN)(ProgressId == PERF_CROSSMODULE_START_ID));
+    } else if ((ProgressId == MODULE_START_ID) || (ProgressId == MODULE_END_ID)) {
+      RecordModuleEvent (&StringEvent->Guid, StringEvent->String, StringEvent->Timestamp, (BOOLEAN)(ProgressId == MODULE_START_ID));
+    }
+    break;
+  case FPDT_GUID_QWORD_EVENT_TYPE:
+    QwordEvent = (FPDT_GUID_QWORD_EVENT_RECORD *)RecordHeader;
+    ProgressId = QwordEvent->ProgressID;
+    if ((ProgressId == MODULE_START_ID) || (ProgressId == MODULE_END_ID)) {
+      RecordModuleEvent (&QwordEvent->Guid, NULL, QwordEvent->Timestamp, (BOOLEAN)(ProgressId == MODULE_START_ID));
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+  Dump boot performance data from the FPDT/FBPT as a machine parsable table.
+
+  Each line has the form
+    PERF|PHASE|<name>|<start ns>|<end ns>|<duration ns>
+    PERF|TOP|<rank>|<guid>|<name>|<total ns>
+  so fleet telemetry can scrape the output over serial.
+**/
+VOID
+DumpBootPerformance (
+  VOID
+  )
+{
+  EFI_ACPI_DESCRIPTION_HEADER                           *Fpdt;
+  EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER           *RecordHeader;
+  EFI_ACPI_5_0_FPDT_BOOT_PERFORMANCE_TABLE_POINTER_RECORD  *PointerRecord;
+  BOOT_PERFORMANCE_TABLE                                *BootTable;
+  UINT8                                                 *RecordPtr;
+  UINT8                                                 *TableEnd;
+  UINTN                                                 Index;
+  UINTN                                                 Rank;
+  UINTN                                                 TopIndex;
+  UINT64                                                TopTime;
+
+  Fpdt = FindAcpiTableBySignature (EFI_ACPI_5_0_FIRMWARE_PERFORMANCE_DATA_TABLE_SIGNATURE);
+  if (Fpdt == NULL) {
+    Print (L"PERF|ERROR|NoFpdt\n");
+    return ;
+  }
+
+  //
+  // Find the Firmware Basic Boot Performance Table pointer record
+  //
+  BootTable = NULL;
+  RecordPtr = (UINT8 *)(Fpdt + 1);
+  TableEnd  = (UINT8 *)Fpdt + Fpdt->Length;
+  while (RecordPtr < TableEnd) {
+    RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)RecordPtr;
+    if (RecordHeader->Type == EFI_ACPI_5_0_FPDT_RECORD_TYPE_FIRMWARE_BASIC_BOOT_POINTER) {
+      PointerRecord = (EFI_ACPI_5_0_FPDT_BOOT_PERFORMANCE_TABLE_POINTER_RECORD *)RecordHeader;
+      BootTable = (BOOT_PERFORMANCE_TABLE *)(UINTN)PointerRecord->BootPerformanceTablePointer;
+      break;
+    }
+    RecordPtr += RecordHeader->Length;
+  }
+  if ((BootTable == NULL) || (BootTable->Header.Signature != BOOT_PERFORMANCE_TABLE_SIGNATURE)) {
+    Print (L"PERF|ERROR|NoFbpt\n");
+    return ;
+  }
+
+  //
+  // Basic boot record, all timestamps in nanoseconds since reset
+  //
+  Print (L"PERF|BASIC|ResetEnd|%ld\n", BootTable->BasicBoot.ResetEnd);
+  Print (L"PERF|BASIC|OsLoaderLoadImageStart|%ld\n", BootTable->BasicBoot.OsLoaderLoadImageStart);
+  Print (L"PERF|BASIC|OsLoaderStartImageStart|%ld\n", BootTable->BasicBoot.OsLoaderStartImageStart);
+  Print (L"PERF|BASIC|ExitBootServicesEntry|%ld\n", BootTable->BasicBoot.ExitBootServicesEntry);
+  Print (L"PERF|BASIC|ExitBootServicesExit|%ld\n", BootTable->BasicBoot.ExitBootServicesExit);
+
+  //
+  // Walk the extended records and correlate start/end pairs
+  //
+  mPhaseCount  = 0;
+  mModuleCount = 0;
+  ZeroMem (mPhaseTable, sizeof (mPhaseTable));
+  ZeroMem (mModuleTable, sizeof (mModuleTable));
+  RecordPtr = (UINT8 *)BootTable + sizeof (BOOT_PERFORMANCE_TABLE);
+  TableEnd  = (UINT8 *)BootTable + BootTable->Header.Length;
+  while (RecordPtr < TableEnd) {
+    RecordHeader = (EFI_ACPI_5_0_FPDT_PERFORMANCE_RECORD_HEADER *)RecordPtr;
+    if (RecordHeader->Length == 0) {
+      break;
+    }
+    ProcessFbptRecord (RecordHeader);
+    RecordPtr += RecordHeader->Length;
+  }
+
+  //
+  // Per phase durations (SEC, PEI, DXE, BDS, and any platform specific ones)
+  //
+  for (Index = 0; Index < mPhaseCount; Index++) {
+    Print (
+      L"PERF|PHASE|%a|%ld|%ld|%ld\n",
+      mPhaseTable[Index].Name,
+      mPhaseTable[Index].StartTime,
+      mPhaseTable[Index].EndTime,
+      (mPhaseTable[Index].EndTime > mPhaseTable[Index].StartTime) ?
+        (mPhaseTable[Index].EndTime - mPhaseTable[Index].StartTime) : 0
+      );
+  }
+
+  //
+  // Top latency offenders by accumulated module residency
+  //
+  for (Rank = 0; (Rank < TOP_MODULE_COUNT) && (Rank < mModuleCount); Rank++) {
+    TopIndex = mModuleCount;
+    TopTime  = 0;
+    for (Index = 0; Index < mModuleCount; Index++) {
+      if (mModuleTable[Index].TotalTime > TopTime) {
+        TopTime  = mModuleTable[Index].TotalTime;
+        TopIndex = Index;
+      }
+    }
+    if (TopIndex == mModuleCount) {
+      break;
+    }
+    Print (
+      L"PERF|TOP|%d|%g|%a|%ld\n",
+      Rank + 1,
+      &mModuleTable[TopIndex].Guid,
+      (mModuleTable[TopIndex].Name[0] != 0) ? mModuleTable[TopIndex].Name : "-",
+      mModuleTable[TopIndex].TotalTime
+      );
+    mModuleTable[TopIndex].TotalTime = 0;
+  }
+}
@@ -74,6 +74,13 @@ LoadLinux (
 
 EFI_GUID gLinuxBootKernelFileGuid = LINUX_BOOT_KERNEL_GUID;
 
+///
+/// Kernel staged by the DXE preload, consumed when BDS launches it
+///
+STATIC VOID                 *mPreloadedKernelBuffer = NULL;
+STATIC struct BootParams    *mPreloadedHandoverParams = NULL;
+STATIC EFI_EVENT            mPreloadEvent = NULL;
+
 //---------------------------------------------------------------------------
 
 /**
@@ -154,18 +161,19 @@ CompleteBdsTasks (
 }
 
 /**
- *  This function will load and launch the Linux kernel from a BIOS FV.
- *
- *  @note   This function is not intended to return. Any exiting from this function indicates
- *          a problem loading or launching the kernel.
+ *  This function will load the Linux kernel from a BIOS FV and stage it at its
+ *  load address, ready to be launched.
  *
- *  @param  None
+ *  @param  KernelBuffer        Returns the staged kernel buffer
+ *  @param  HandoverParams      Returns the prepared handover parameters
  *
- *  @return EFI_ERROR           Any error code
+ *  @retval EFI_SUCCESS         Kernel staged and ready to launch
+ *  @return EFI_NOT_FOUND       Kernel could not be loaded or prepared
  */
 EFI_STATUS
-LoadAndLaunchKernel (
-    VOID
+PrepareKernel (
+    OUT VOID                **PreparedKernelBuffer,
+    OUT struct BootParams  **PreparedHandoverParams
 )
 {
     EFI_LOADED_IMAGE_PROTOCOL   *LoadedImage = NULL;
@@ -181,8 +189,6 @@ LoadAndLaunchKernel (
     UINT8                       *Temp;
     UINT8                       CmdLine[] = " ";
 
-    DEBUG((DEBUG_INFO, "LoadAndLaunchKernel Entry\n"));
-
     ///
     /// Kernel load and preparation
     ///
@@ -287,6 +293,121 @@ LoadAndLaunchKernel (
     gBS->FreePool(KernelFfsBuffer);
     KernelFfsBuffer = NULL;
 
+    *PreparedKernelBuffer   = KernelBuffer;
+    *PreparedHandoverParams = HandoverParams;
+
+    return EFI_SUCCESS;
+
+FatalError:
+    // Free everything
+    if (KernelBuffer != NULL) gBS->FreePages((EFI_PHYSICAL_ADDRESS) KernelBuffer, EFI_SIZE_TO_PAGES(HandoverParams->Hdr.InitSize));
+    if (HandoverParams != NULL) gBS->FreePages((EFI_PHYSICAL_ADDRESS) HandoverParams, EFI_SIZE_TO_PAGES(KERNEL_SETUP_SIZE));
+    if (KernelHandle != NULL) gBS->UnloadImage(KernelHandle);
+    if (KernelFfsBuffer != NULL) gBS->FreePool(KernelFfsBuffer);
+
+    return EFI_NOT_FOUND;
+}
+
+/**
+ *  Firmware volume notification callback that stages the kernel during DXE.
+ *
+ *  Runs each time a firmware volume is published; once the volume holding the
+ *  kernel is available the payload is extracted and copied to its load address,
+ *  so by the time BDS runs only the jump remains.
+ *
+ *  @param  Event               The notification event.
+ *  @param  Context             Unused.
+ *
+ *  @retval None
+ */
+VOID
+EFIAPI
+LinuxBootPreloadNotify (
+    IN EFI_EVENT    Event,
+    IN VOID         *Context
+)
+{
+    EFI_STATUS  Status;
+
+    if (mPreloadedKernelBuffer != NULL) {
+        return;
+    }
+
+    Status = PrepareKernel(&mPreloadedKernelBuffer, &mPreloadedHandoverParams);
+    if (EFI_ERROR(Status)) {
+        // The volume holding the kernel is not published yet, keep waiting
+        // for the next firmware volume.
+        return;
+    }
+
+    DEBUG((DEBUG_INFO, "Kernel preloaded during DXE.\n"));
+
+    gBS->CloseEvent(Event);
+    mPreloadEvent = NULL;
+}
+
+/**
+ *  Library constructor that arms the DXE kernel preload.
+ *
+ *  @param  ImageHandle         The image handle of the hosting driver.
+ *  @param  SystemTable         A pointer to the EFI system table.
+ *
+ *  @retval EFI_SUCCESS         Always; the launch path loads on demand if the
+ *                              preload could not be armed.
+ */
+EFI_STATUS
+EFIAPI
+LinuxBootLibConstructor (
+    IN EFI_HANDLE           ImageHandle,
+    IN EFI_SYSTEM_TABLE     *SystemTable
+)
+{
+    VOID    *Registration;
+
+    mPreloadEvent = EfiCreateProtocolNotifyEvent(
+        &gEfiFirmwareVolume2ProtocolGuid,
+        TPL_CALLBACK,
+        LinuxBootPreloadNotify,
+        NULL,
+        &Registration
+    );
+    ASSERT(mPreloadEvent != NULL);
+
+    return EFI_SUCCESS;
+}
+
+/**
+ *  This function will load and launch the Linux kernel from a BIOS FV.
+ *
+ *  @note   This function is not intended to return. Any exiting from this function indicates
+ *          a problem loading or launching the kernel.
+ *
+ *  @param  None
+ *
+ *  @return EFI_ERROR           Any error code
+ */
+EFI_STATUS
+LoadAndLaunchKernel (
+    VOID
+)
+{
+    EFI_STATUS                  Status;
+    VOID                        *KernelBuffer = NULL;
+    struct BootParams          *HandoverParams = NULL;
+
+    DEBUG((DEBUG_INFO, "LoadAndLaunchKernel Entry\n"));
+
+    if (mPreloadedKernelBuffer != NULL) {
+        // The DXE preload already staged everything, only the jump remains
+        KernelBuffer   = mPreloadedKernelBuffer;
+        HandoverParams = mPreloadedHandoverParams;
+    } else {
+        Status = PrepareKernel(&KernelBuffer, &HandoverParams);
+        if (EFI_ERROR(Status)) {
+            return Status;
+        }
+    }
+
     DEBUG((DEBUG_ERROR, "Launching the kernel\n"));
 
 
@@ -304,13 +425,6 @@ LoadAndLaunchKernel (
     ///
     DEBUG((DEBUG_ERROR, "ERROR: LoadLinux has returned with status; %r.\n", Status));
 
-FatalError:
-    // Free everything
-    if (KernelBuffer != NULL) gBS->FreePages((EFI_PHYSICAL_ADDRESS) KernelBuffer, EFI_SIZE_TO_PAGES(HandoverParams->Hdr.InitSize));
-    if (HandoverParams != NULL) gBS->FreePages((EFI_PHYSICAL_ADDRESS) HandoverParams, EFI_SIZE_TO_PAGES(KERNEL_SETUP_SIZE));
-    if (KernelHandle != NULL) gBS->UnloadImage(KernelHandle);
-    if (KernelFfsBuffer != NULL) gBS->FreePool(KernelFfsBuffer);
-
     return EFI_NOT_FOUND;
 }
 
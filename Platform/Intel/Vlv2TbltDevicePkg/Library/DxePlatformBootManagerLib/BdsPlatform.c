@@ -30,6 +30,11 @@ GLOBAL_REMOVE_IF_UNREFERENCED EFI_BOOT_MODE                 gBootMode;
 
 BOOLEAN                      gPPRequireUIConfirm;
 
+//
+// Set after the deferred dispatch FV has been handed to the DXE core
+//
+BOOLEAN                      mDeferredFvDispatched = FALSE;
+
 extern UINTN                                      mBootMenuOptionNumber;
 
 GLOBAL_REMOVE_IF_UNREFERENCED USB_CLASS_FORMAT_DEVICE_PATH gUsbClassKeyboardDevicePath = {
@@ -185,6 +190,91 @@ ExitPmAuth (
   DEBUG((DEBUG_INFO,"ExitPmAuth ()- End\n"));
 }
 
+/**
+  Dispatch the deferred FV holding the non-boot-critical drivers.
+
+  The FDF stores the FVDEFERRED image (UEFI Shell, dp command, network
+  stack) as a FREEFORM file in FVMAIN, so the DXE core never processes it
+  on its own. This function reads the FV_IMAGE section out of that file,
+  hands the image to the DXE core and runs the dispatcher, making its
+  drivers available. Boots that go straight to the OS never call it and
+  save the whole dispatch cost; the time spent here on other boots is
+  logged as an FPDT "EventRec" pair (0x7030/0x7031) by the callers.
+**/
+VOID
+DispatchDeferredFv (
+  VOID
+  )
+{
+  EFI_STATUS                     Status;
+  EFI_HANDLE                     *HandleBuffer;
+  UINTN                          HandleCount;
+  UINTN                          Index;
+  EFI_FIRMWARE_VOLUME2_PROTOCOL  *Fv;
+  VOID                           *FvImage;
+  UINTN                          FvImageSize;
+  UINT32                         AuthenticationStatus;
+  EFI_HANDLE                     FvProtocolHandle;
+
+  if (mDeferredFvDispatched) {
+    return;
+  }
+
+  DEBUG ((DEBUG_INFO, "[DispatchDeferredFv]\n"));
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiFirmwareVolume2ProtocolGuid,
+                  NULL,
+                  &HandleCount,
+                  &HandleBuffer
+                  );
+  if (EFI_ERROR (Status)) {
+    return;
+  }
+
+  for (Index = 0; Index < HandleCount; Index++) {
+    gBS->HandleProtocol (
+           HandleBuffer[Index],
+           &gEfiFirmwareVolume2ProtocolGuid,
+           (VOID **) &Fv
+           );
+
+    FvImage     = NULL;
+    FvImageSize = 0;
+    Status = Fv->ReadSection (
+                   Fv,
+                   &gDeferredFvFileGuid,
+                   EFI_SECTION_FIRMWARE_VOLUME_IMAGE,
+                   0,
+                   &FvImage,
+                   &FvImageSize,
+                   &AuthenticationStatus
+                   );
+    if (EFI_ERROR (Status)) {
+      //
+      // Skip if the deferred FV file is not in this FV
+      //
+      continue;
+    }
+
+    //
+    // The FV image buffer is owned by the DXE core from here on, so it is
+    // intentionally not freed.
+    //
+    Status = gDS->ProcessFirmwareVolume (FvImage, FvImageSize, &FvProtocolHandle);
+    if (!EFI_ERROR (Status)) {
+      gDS->Dispatch ();
+      mDeferredFvDispatched = TRUE;
+    } else {
+      DEBUG ((DEBUG_ERROR, "Failed to process the deferred FV - %r\n", Status));
+    }
+    break;
+  }
+
+  FreePool (HandleBuffer);
+}
+
 VOID
 ConnectRootBridge (
   BOOLEAN Recursive
@@ -1111,6 +1201,7 @@ OnReadyToBootCallBack (
 
   if (BootCurrentIsInternalShell ()) {
 
+    DispatchDeferredFv ();
     ChangeModeForInternalShell ();
     EfiBootManagerConnectAllDefaultConsoles();
     gDS->Dispatch ();
@@ -1206,6 +1297,21 @@ PlatformBootManagerBeforeConsole (
     DEBUG((DEBUG_INFO, "ProcessCapsules Done\n"));
   }
 
+  //
+  // Boots that may enumerate devices, enter setup or run the shell need
+  // the non-boot-critical drivers; boots that go straight to the OS skip
+  // the deferred FV and its whole dispatch cost.
+  //
+  if (gBootMode == BOOT_WITH_FULL_CONFIGURATION ||
+      gBootMode == BOOT_WITH_DEFAULT_SETTINGS ||
+      gBootMode == BOOT_WITH_FULL_CONFIGURATION_PLUS_DIAGNOSTICS ||
+      gBootMode == BOOT_IN_RECOVERY_MODE ||
+      gBootMode == BOOT_ON_FLASH_UPDATE) {
+    PERF_START_EX(NULL,"EventRec", NULL, AsmReadTsc(), 0x7030);
+    DispatchDeferredFv ();
+    PERF_END_EX(NULL,"EventRec", NULL, AsmReadTsc(), 0x7031);
+  }
+
   //
   // Dynamically register hot key: F2/F7/Enter
   //
@@ -1419,6 +1525,11 @@ PlatformBootManagerUnableToBoot (
   EFI_BOOT_MANAGER_LOAD_OPTION BootDeviceList;
   CHAR16                       OptionName[sizeof ("Boot####")];
 
+  //
+  // The boot menu may launch options living in the deferred FV
+  //
+  DispatchDeferredFv ();
+
   if (mBootMenuOptionNumber == LoadOptionNumberUnassigned) {
     return;
   }
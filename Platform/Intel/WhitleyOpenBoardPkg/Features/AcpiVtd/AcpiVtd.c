@@ -20,6 +20,12 @@ VTD_SUPPORT_INSTANCE mPrivateData;
 
 #define MAX_BUS_ADDR_WIDTH 45
 
+//
+// Number of sections in the ordered table: DRHD, DRHD with INCLUDE_PCI_ALL,
+// RMRR, ATSR and RHSA entries are grouped in that order.
+//
+#define DMAR_ORDER_SECTIONS 5
+
 /**
 
   Add DMAR entry
@@ -234,6 +240,7 @@ InsertDmaRemap (
   }
 
   ASSERT (Dmar->Header.Length < TABLE_SIZE);
+  mPrivateData.DmarOrderUpToDate = FALSE;
   return EFI_SUCCESS;
 }
 
@@ -289,10 +296,44 @@ GetTablesInfo (
   return EFI_SUCCESS;
 }
 
+/**
+
+    Returns the section an entry belongs to in the ordered table
+
+    @param Type       - DMA remapping type
+    @param IncludeAll - Include all flag of the entry
+
+    @retval Section number, or DMAR_ORDER_SECTIONS if the entry is not published
+
+**/
+UINTN
+GetOrderSection (
+  IN REMAP_TYPE  Type,
+  IN BOOLEAN     IncludeAll
+  )
+{
+  if (Type == DrhdType && !IncludeAll) {
+    return 0;
+  } else if (Type == DrhdType && IncludeAll) {
+    return 1;
+  } else if (Type == RmrrType && !IncludeAll) {
+    return 2;
+  } else if (Type == AtsrType && !IncludeAll) {
+    return 3;
+  } else if (Type == RhsaType) {
+    return 4;
+  }
+
+  return DMAR_ORDER_SECTIONS;
+}
+
 /**
 
     Reorder the table entries
 
+    Sizes each section in one scan, then places every entry at its section
+    cursor in a second scan, instead of rescanning the whole table per section.
+
     @param None
 
     @retval EFI_SUCCESS - The table entries are ordered
@@ -308,76 +349,45 @@ ReorderTables (
   UINTN       Length;
   UINTN       CurrLength;
   UINTN       TableLength;
+  UINTN       Section;
   UINT8       *Ptr;
-  UINT8       *PtrOrder;
+  UINT8       *SectionPtr[DMAR_ORDER_SECTIONS];
+  UINTN       SectionLength[DMAR_ORDER_SECTIONS];
 
-  Ptr       = (UINT8 *) mPrivateData.Dmar;
-  PtrOrder  = (UINT8 *) mPrivateData.DmarOrder;
+  Ptr = (UINT8 *) mPrivateData.Dmar;
 
-  CopyMem (PtrOrder, Ptr, sizeof (EFI_ACPI_DMAR_HEADER));
-  PtrOrder += sizeof (EFI_ACPI_DMAR_HEADER);
+  CopyMem ((UINT8 *) mPrivateData.DmarOrder, Ptr, sizeof (EFI_ACPI_DMAR_HEADER));
 
   TableLength = mPrivateData.Dmar->Header.Length;
 
-  CurrLength  = sizeof (EFI_ACPI_DMAR_HEADER);
-  Ptr         = (UINT8 *) mPrivateData.Dmar + CurrLength;
-  while (CurrLength < TableLength) {
-    GetTablesInfo (Ptr, &Type, &IncludeAll, &Length);
-    if (Type == DrhdType && !IncludeAll) {
-      CopyMem (PtrOrder, Ptr, Length);
-      PtrOrder += Length;
-    }
-
-    Ptr += Length;
-    CurrLength += Length;
-  }
-
-  CurrLength  = sizeof (EFI_ACPI_DMAR_HEADER);
-  Ptr         = (UINT8 *) mPrivateData.Dmar + CurrLength;
-  while (CurrLength < TableLength) {
-    GetTablesInfo (Ptr, &Type, &IncludeAll, &Length);
-    if (Type == DrhdType && IncludeAll) {
-      CopyMem (PtrOrder, Ptr, Length);
-      PtrOrder += Length;
-    }
-
-    Ptr += Length;
-    CurrLength += Length;
-  }
+  ZeroMem (SectionLength, sizeof (SectionLength));
 
   CurrLength  = sizeof (EFI_ACPI_DMAR_HEADER);
   Ptr         = (UINT8 *) mPrivateData.Dmar + CurrLength;
   while (CurrLength < TableLength) {
     GetTablesInfo (Ptr, &Type, &IncludeAll, &Length);
-    if (Type == RmrrType && !IncludeAll) {
-      CopyMem (PtrOrder, Ptr, Length);
-      PtrOrder += Length;
+    Section = GetOrderSection (Type, IncludeAll);
+    if (Section < DMAR_ORDER_SECTIONS) {
+      SectionLength[Section] += Length;
     }
 
     Ptr += Length;
     CurrLength += Length;
   }
 
-  CurrLength  = sizeof (EFI_ACPI_DMAR_HEADER);
-  Ptr         = (UINT8 *) mPrivateData.Dmar + CurrLength;
-  while (CurrLength < TableLength) {
-    GetTablesInfo (Ptr, &Type, &IncludeAll, &Length);
-    if (Type == AtsrType && !IncludeAll) {
-      CopyMem (PtrOrder, Ptr, Length);
-      PtrOrder += Length;
-    }
-
-    Ptr += Length;
-    CurrLength += Length;
+  SectionPtr[0] = (UINT8 *) mPrivateData.DmarOrder + sizeof (EFI_ACPI_DMAR_HEADER);
+  for (Section = 1; Section < DMAR_ORDER_SECTIONS; Section++) {
+    SectionPtr[Section] = SectionPtr[Section - 1] + SectionLength[Section - 1];
   }
 
   CurrLength  = sizeof (EFI_ACPI_DMAR_HEADER);
   Ptr         = (UINT8 *) mPrivateData.Dmar + CurrLength;
   while (CurrLength < TableLength) {
     GetTablesInfo (Ptr, &Type, &IncludeAll, &Length);
-    if (Type == RhsaType) {
-      CopyMem (PtrOrder, Ptr, Length);
-      PtrOrder += Length;
+    Section = GetOrderSection (Type, IncludeAll);
+    if (Section < DMAR_ORDER_SECTIONS) {
+      CopyMem (SectionPtr[Section], Ptr, Length);
+      SectionPtr[Section] += Length;
     }
 
     Ptr += Length;
@@ -414,7 +424,15 @@ GetDmarTable (
     return EFI_UNSUPPORTED;
   }
 
-  ReorderTables ();
+  //
+  // The source table only changes through InsertDmaRemap, so reuse the
+  // ordered copy handed out earlier unless new entries arrived since then.
+  //
+  if (!mPrivateData.DmarOrderUpToDate) {
+    ReorderTables ();
+    mPrivateData.DmarOrderUpToDate = TRUE;
+  }
+
   *DmarTable = mPrivateData.DmarOrder;
   return EFI_SUCCESS;
 }
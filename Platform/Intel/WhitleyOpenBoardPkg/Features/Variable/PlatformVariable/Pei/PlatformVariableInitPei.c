@@ -176,6 +176,12 @@ PlatformVariablePeiInit(
     Status = CreateRPVariableHob (EFI_HII_DEFAULT_CLASS_STANDARD, BoardId);
   }
 
+  //
+  // Pre-resolve the default store so later batch reads by board code do not
+  // walk it again. Failure only costs the fast path, so Status is not touched.
+  //
+  CreateDefaultVariableIndexHob (DefaultId, BoardId);
+
   PeiServicesInstallPpi (&mPpiListPlatformVariableInit);
   return Status;
 }
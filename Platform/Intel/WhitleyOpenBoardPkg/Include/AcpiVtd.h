@@ -48,6 +48,7 @@ typedef struct {
   DMA_REMAP_PROTOCOL                    DmaRemapProt;
   EFI_ACPI_DMAR_HEADER                  *Dmar;
   EFI_ACPI_DMAR_HEADER                  *DmarOrder;
+  BOOLEAN                               DmarOrderUpToDate;
 } VTD_SUPPORT_INSTANCE;
 
 #endif
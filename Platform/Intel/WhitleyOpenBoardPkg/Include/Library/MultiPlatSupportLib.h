@@ -60,6 +60,66 @@ VOID * FindDefaultHobinFfs (
   );
 
 
+//
+// One entry of a batch default variable read.
+// Name, Guid, Data and DataSize are filled by the caller; DataSize holds the size
+// of the Data buffer on input and the size of the default value on output.
+// Status reports the result for this entry only.
+//
+typedef struct {
+  CHAR16      *Name;
+  EFI_GUID    *Guid;
+  UINTN       DataSize;
+  VOID        *Data;
+  EFI_STATUS  Status;
+} DEFAULT_VARIABLE_REQUEST;
+
+/**
+  Builds the default variable index HOB for the given default store.
+
+  The index maps a name+GUID hash of every variable in the store to its offset,
+  so later reads can jump straight to the record instead of walking the store.
+  Nothing is built when an index for this store already exists.
+
+  @param DefaultId - Specifies the type of defaults to retrieve.
+  @param BoardId   - Specifies the platform board of defaults to retrieve.
+
+  @retval EFI_SUCCESS           The index is available.
+  @retval EFI_NOT_FOUND         The matched default data is not found.
+  @retval EFI_OUT_OF_RESOURCES  No enough resource to create HOB.
+
+**/
+EFI_STATUS
+CreateDefaultVariableIndexHob (
+  IN UINT16  DefaultId,
+  IN UINT16  BoardId
+  );
+
+/**
+  Resolves a batch of default variable reads in one pass.
+
+  The default store is located once for the whole batch and each entry is looked
+  up through the default variable index when one is available; without an index
+  the store is walked a single time for all entries together.
+
+  @param DefaultId    - Specifies the type of defaults to retrieve.
+  @param BoardId      - Specifies the platform board of defaults to retrieve.
+  @param RequestTable - Batch of reads to resolve; per entry results in Status.
+  @param RequestCount - Number of entries in RequestTable.
+
+  @retval EFI_SUCCESS   The batch was processed; check per entry Status.
+  @retval EFI_NOT_FOUND The matched default data is not found.
+
+**/
+EFI_STATUS
+GetDefaultVariablesFromFfs (
+  IN     UINT16                    DefaultId,
+  IN     UINT16                    BoardId,
+  IN OUT DEFAULT_VARIABLE_REQUEST  *RequestTable,
+  IN     UINTN                     RequestCount
+  );
+
+
 
 
 
@@ -22,6 +22,7 @@
 extern EFI_GUID gDefaultDataFileGuid;
 extern EFI_GUID gEfiVariableGuid;
 extern EFI_GUID gEfiAuthenticatedVariableGuid;
+extern EFI_GUID gDefaultVariableIndexHobGuid;
 
 typedef struct {
   UINT16 DefaultId;
@@ -43,6 +44,25 @@ typedef struct {
   //
 } DEFAULT_DATA;
 
+typedef struct {
+  UINT32 Hash;
+  //
+  // Offset of the variable header relative to the VARIABLE_STORE_HEADER,
+  // so the index stays valid wherever the store is copied.
+  //
+  UINT32 Offset;
+} DEFAULT_VARIABLE_INDEX_ENTRY;
+
+typedef struct {
+  UINT16 DefaultId;
+  UINT16 BoardId;
+  UINT32 Count;
+  //
+  // Count entries follow, sorted in store order.
+  // DEFAULT_VARIABLE_INDEX_ENTRY Entry[Count];
+  //
+} DEFAULT_VARIABLE_INDEX;
+
 
 
 #endif
@@ -8,6 +8,7 @@
 
 #include <PiPei.h>
 #include <Library/MultiPlatSupportLib.h>
+#include <Library/BaseLib.h>
 #include <Library/HobLib.h>
 #include <MultiPlatSupport.h>
 #include <Ppi/MemoryDiscovered.h>
@@ -253,3 +254,349 @@ Returns:
 }
 
 
+/**
+  Computes the index hash of a variable name and vendor GUID.
+
+  @param  Name - Null-terminated variable name.
+  @param  Guid - Vendor GUID of the variable.
+
+  @return The 32 bit hash used by the default variable index.
+
+**/
+STATIC
+UINT32
+DefaultVariableHash (
+  IN CONST CHAR16    *Name,
+  IN CONST EFI_GUID  *Guid
+  )
+{
+  UINT32       Hash;
+  CONST UINT8  *GuidByte;
+  UINTN        Index;
+
+  Hash = 5381;
+  while (*Name != L'\0') {
+    Hash = Hash * 33 + (UINT32) *Name;
+    Name ++;
+  }
+  GuidByte = (CONST UINT8 *) Guid;
+  for (Index = 0; Index < sizeof (EFI_GUID); Index ++) {
+    Hash = Hash * 33 + GuidByte[Index];
+  }
+  return Hash;
+}
+
+
+/**
+  Decodes one variable record of a default store.
+
+  Handles both record formats; which one is in use follows from the store
+  signature checked by the caller.
+
+  @param  AuthFormat - TRUE when the store holds AUTHENTICATED_VARIABLE_HEADER records.
+  @param  Variable   - Start of the record to decode.
+  @param  StoreEnd   - First byte after the store.
+  @param  State      - Returns the record state.
+  @param  VendorGuid - Returns the vendor GUID of the record.
+  @param  Name       - Returns the variable name of the record.
+  @param  Data       - Returns the default value of the record.
+  @param  DataSize   - Returns the size of the default value.
+
+  @return Start of the next record. NULL when Variable is not a valid record,
+          which also marks the end of the store.
+
+**/
+STATIC
+UINT8 *
+DefaultVariableRecord (
+  IN  BOOLEAN   AuthFormat,
+  IN  UINT8     *Variable,
+  IN  UINT8     *StoreEnd,
+  OUT UINT8     *State,
+  OUT EFI_GUID  **VendorGuid,
+  OUT CHAR16    **Name,
+  OUT UINT8     **Data,
+  OUT UINT32    *DataSize
+  )
+{
+  AUTHENTICATED_VARIABLE_HEADER  *AuthHeader;
+  VARIABLE_HEADER                *Header;
+  UINT32                         NameSize;
+  UINTN                          HeaderSize;
+
+  HeaderSize = AuthFormat ? sizeof (AUTHENTICATED_VARIABLE_HEADER) : sizeof (VARIABLE_HEADER);
+  if (Variable + HeaderSize > StoreEnd) {
+    return NULL;
+  }
+  AuthHeader = (AUTHENTICATED_VARIABLE_HEADER *) Variable;
+  Header     = (VARIABLE_HEADER *) Variable;
+  if (Header->StartId != VARIABLE_DATA) {
+    return NULL;
+  }
+  if (AuthFormat) {
+    NameSize    = AuthHeader->NameSize;
+    *DataSize   = AuthHeader->DataSize;
+    *State      = AuthHeader->State;
+    *VendorGuid = &AuthHeader->VendorGuid;
+  } else {
+    NameSize    = Header->NameSize;
+    *DataSize   = Header->DataSize;
+    *State      = Header->State;
+    *VendorGuid = &Header->VendorGuid;
+  }
+  if (NameSize == (UINT32) -1 || *DataSize == (UINT32) -1) {
+    return NULL;
+  }
+  *Name = (CHAR16 *) (Variable + HeaderSize);
+  *Data = (UINT8 *) *Name + NameSize + GET_PAD_SIZE (NameSize);
+  return (UINT8 *) HEADER_ALIGN (*Data + *DataSize + GET_PAD_SIZE (*DataSize));
+}
+
+
+/**
+  Finds the default variable index built for the given store, if any.
+
+  @param  DefaultId - Specifies the type of defaults to retrieve.
+  @param  BoardId   - Specifies the platform board of defaults to retrieve.
+
+  @return The matching index. NULL if none has been built yet.
+
+**/
+STATIC
+DEFAULT_VARIABLE_INDEX *
+FindDefaultVariableIndex (
+  IN UINT16  DefaultId,
+  IN UINT16  BoardId
+  )
+{
+  EFI_PEI_HOB_POINTERS    Hob;
+  DEFAULT_VARIABLE_INDEX  *Index;
+
+  Hob.Raw = GetHobList ();
+  while ((Hob.Raw = GetNextGuidHob (&gDefaultVariableIndexHobGuid, Hob.Raw)) != NULL) {
+    Index = (DEFAULT_VARIABLE_INDEX *) GET_GUID_HOB_DATA (Hob.Guid);
+    if (Index->DefaultId == DefaultId && Index->BoardId == BoardId) {
+      return Index;
+    }
+    Hob.Raw = GET_NEXT_HOB (Hob);
+  }
+  return NULL;
+}
+
+
+/**
+  Builds the default variable index HOB for the given default store.
+
+  The index maps a name+GUID hash of every variable in the store to its offset,
+  so later reads can jump straight to the record instead of walking the store.
+  Nothing is built when an index for this store already exists.
+
+  @param DefaultId - Specifies the type of defaults to retrieve.
+  @param BoardId   - Specifies the platform board of defaults to retrieve.
+
+  @retval EFI_SUCCESS           The index is available.
+  @retval EFI_NOT_FOUND         The matched default data is not found.
+  @retval EFI_OUT_OF_RESOURCES  No enough resource to create HOB.
+
+**/
+EFI_STATUS
+CreateDefaultVariableIndexHob (
+  IN UINT16  DefaultId,
+  IN UINT16  BoardId
+  )
+{
+  VARIABLE_STORE_HEADER         *VarStoreHeader;
+  DEFAULT_VARIABLE_INDEX        *Index;
+  DEFAULT_VARIABLE_INDEX_ENTRY  *Entry;
+  BOOLEAN                       AuthFormat;
+  UINT8                         *StoreEnd;
+  UINT8                         *Variable;
+  UINT8                         *Next;
+  UINT8                         State;
+  EFI_GUID                      *VendorGuid;
+  CHAR16                        *Name;
+  UINT8                         *Data;
+  UINT32                        DataSize;
+  UINT32                        Count;
+
+  //
+  // The store content in FFS never changes, so one index per store is enough.
+  //
+  if (FindDefaultVariableIndex (DefaultId, BoardId) != NULL) {
+    return EFI_SUCCESS;
+  }
+
+  VarStoreHeader = (VARIABLE_STORE_HEADER *) FindDefaultHobinFfs (DefaultId, BoardId);
+  if (VarStoreHeader == NULL) {
+    return EFI_NOT_FOUND;
+  }
+  AuthFormat = CompareGuid (&VarStoreHeader->Signature, &gEfiAuthenticatedVariableGuid);
+  StoreEnd   = (UINT8 *) VarStoreHeader + VarStoreHeader->Size;
+
+  //
+  // First walk sizes the index, second walk fills it.
+  //
+  Count    = 0;
+  Variable = (UINT8 *) HEADER_ALIGN (VarStoreHeader + 1);
+  while ((Next = DefaultVariableRecord (AuthFormat, Variable, StoreEnd, &State, &VendorGuid, &Name, &Data, &DataSize)) != NULL) {
+    if (State == VAR_ADDED) {
+      Count ++;
+    }
+    Variable = Next;
+  }
+
+  Index = (DEFAULT_VARIABLE_INDEX *) BuildGuidHob (
+                                       &gDefaultVariableIndexHobGuid,
+                                       sizeof (DEFAULT_VARIABLE_INDEX) + Count * sizeof (DEFAULT_VARIABLE_INDEX_ENTRY)
+                                       );
+  if (Index == NULL) {
+    //
+    // No enough hob resource.
+    //
+    return EFI_OUT_OF_RESOURCES;
+  }
+  Index->DefaultId = DefaultId;
+  Index->BoardId   = BoardId;
+  Index->Count     = Count;
+
+  Entry    = (DEFAULT_VARIABLE_INDEX_ENTRY *) (Index + 1);
+  Variable = (UINT8 *) HEADER_ALIGN (VarStoreHeader + 1);
+  while ((Next = DefaultVariableRecord (AuthFormat, Variable, StoreEnd, &State, &VendorGuid, &Name, &Data, &DataSize)) != NULL) {
+    if (State == VAR_ADDED) {
+      Entry->Hash   = DefaultVariableHash (Name, VendorGuid);
+      Entry->Offset = (UINT32) ((UINTN) Variable - (UINTN) VarStoreHeader);
+      Entry ++;
+    }
+    Variable = Next;
+  }
+
+  return EFI_SUCCESS;
+}
+
+
+/**
+  Resolves a batch of default variable reads in one pass.
+
+  The default store is located once for the whole batch and each entry is looked
+  up through the default variable index when one is available; without an index
+  the store is walked a single time for all entries together.
+
+  @param DefaultId    - Specifies the type of defaults to retrieve.
+  @param BoardId      - Specifies the platform board of defaults to retrieve.
+  @param RequestTable - Batch of reads to resolve; per entry results in Status.
+  @param RequestCount - Number of entries in RequestTable.
+
+  @retval EFI_SUCCESS   The batch was processed; check per entry Status.
+  @retval EFI_NOT_FOUND The matched default data is not found.
+
+**/
+EFI_STATUS
+GetDefaultVariablesFromFfs (
+  IN     UINT16                    DefaultId,
+  IN     UINT16                    BoardId,
+  IN OUT DEFAULT_VARIABLE_REQUEST  *RequestTable,
+  IN     UINTN                     RequestCount
+  )
+{
+  VARIABLE_STORE_HEADER         *VarStoreHeader;
+  DEFAULT_VARIABLE_INDEX        *Index;
+  DEFAULT_VARIABLE_INDEX_ENTRY  *Entry;
+  DEFAULT_VARIABLE_REQUEST      *Request;
+  BOOLEAN                       AuthFormat;
+  UINT8                         *StoreEnd;
+  UINT8                         *Variable;
+  UINT8                         *Next;
+  UINT8                         State;
+  EFI_GUID                      *VendorGuid;
+  CHAR16                        *Name;
+  UINT8                         *Data;
+  UINT32                        DataSize;
+  UINT32                        Hash;
+  UINTN                         RequestIndex;
+  UINT32                        EntryIndex;
+
+  for (RequestIndex = 0; RequestIndex < RequestCount; RequestIndex ++) {
+    RequestTable[RequestIndex].Status = EFI_NOT_FOUND;
+  }
+
+  //
+  // Locate the store once for the whole batch.
+  //
+  VarStoreHeader = (VARIABLE_STORE_HEADER *) FindDefaultHobinFfs (DefaultId, BoardId);
+  if (VarStoreHeader == NULL) {
+    return EFI_NOT_FOUND;
+  }
+  AuthFormat = CompareGuid (&VarStoreHeader->Signature, &gEfiAuthenticatedVariableGuid);
+  StoreEnd   = (UINT8 *) VarStoreHeader + VarStoreHeader->Size;
+
+  Index = FindDefaultVariableIndex (DefaultId, BoardId);
+  if (Index == NULL) {
+    CreateDefaultVariableIndexHob (DefaultId, BoardId);
+    Index = FindDefaultVariableIndex (DefaultId, BoardId);
+  }
+
+  if (Index != NULL) {
+    //
+    // Jump straight to each record through the index.
+    //
+    Entry = (DEFAULT_VARIABLE_INDEX_ENTRY *) (Index + 1);
+    for (RequestIndex = 0; RequestIndex < RequestCount; RequestIndex ++) {
+      Request = &RequestTable[RequestIndex];
+      Hash    = DefaultVariableHash (Request->Name, Request->Guid);
+      for (EntryIndex = 0; EntryIndex < Index->Count; EntryIndex ++) {
+        if (Entry[EntryIndex].Hash != Hash) {
+          continue;
+        }
+        Variable = (UINT8 *) VarStoreHeader + Entry[EntryIndex].Offset;
+        if (DefaultVariableRecord (AuthFormat, Variable, StoreEnd, &State, &VendorGuid, &Name, &Data, &DataSize) == NULL) {
+          continue;
+        }
+        //
+        // Hashes can collide; the record itself decides.
+        //
+        if (!CompareGuid (VendorGuid, Request->Guid) || StrCmp (Name, Request->Name) != 0) {
+          continue;
+        }
+        if (Request->DataSize < DataSize) {
+          Request->Status = EFI_BUFFER_TOO_SMALL;
+        } else {
+          CopyMem (Request->Data, Data, DataSize);
+          Request->Status = EFI_SUCCESS;
+        }
+        Request->DataSize = DataSize;
+        break;
+      }
+    }
+    return EFI_SUCCESS;
+  }
+
+  //
+  // No index could be built; a single walk still serves the whole batch.
+  //
+  Variable = (UINT8 *) HEADER_ALIGN (VarStoreHeader + 1);
+  while ((Next = DefaultVariableRecord (AuthFormat, Variable, StoreEnd, &State, &VendorGuid, &Name, &Data, &DataSize)) != NULL) {
+    if (State == VAR_ADDED) {
+      for (RequestIndex = 0; RequestIndex < RequestCount; RequestIndex ++) {
+        Request = &RequestTable[RequestIndex];
+        if (Request->Status != EFI_NOT_FOUND) {
+          continue;
+        }
+        if (CompareGuid (VendorGuid, Request->Guid) && StrCmp (Name, Request->Name) == 0) {
+          if (Request->DataSize < DataSize) {
+            Request->Status = EFI_BUFFER_TOO_SMALL;
+          } else {
+            CopyMem (Request->Data, Data, DataSize);
+            Request->Status = EFI_SUCCESS;
+          }
+          Request->DataSize = DataSize;
+          break;
+        }
+      }
+    }
+    Variable = Next;
+  }
+
+  return EFI_SUCCESS;
+}
+
+
@@ -557,6 +557,12 @@ SerialPortInitialize (
   OutputData = (UINT8) ((~DLAB << 7) | ((gBreakSet << 6) | ((gParity << 3) | ((gStop << 2) | Data))));
   IoWrite8 (ComBase + LCR_OFFSET, OutputData);
 
+  //
+  // Enable and reset the FIFOs so transmit bursts can follow a single
+  // LSR poll.
+  //
+  IoWrite8 (ComBase + FCR_OFFSET, PcdGet8 (PcdSerialFifoControl));
+
   return RETURN_SUCCESS;
 }
 
@@ -580,23 +586,54 @@ SerialPortWrite (
   IN UINTN     NumberOfBytes
 )
 {
-  UINTN Result;
-  UINT8 Data;
+  UINTN  Result;
+  UINTN  FifoSize;
+  UINTN  Burst;
+  UINT32 Spin;
+  UINT16 ComBase;
 
   if ((IsSerialPortEnabled() == FALSE) || (NULL == Buffer)) {
     return 0;
   }
 
-  Result = NumberOfBytes;
+  ComBase = (UINT16) PcdGet64 (PcdSerialRegisterBase);
 
-  while (NumberOfBytes--) {
+  //
+  // Determine how many bytes may follow one TXRDY indication. TXRDY
+  // reports the transmit holding register empty, so with the FIFO
+  // enabled a whole FIFO's worth can be written back-to-back instead
+  // of polling the LSR between every byte.
+  //
+  FifoSize = 1;
+  if ((PcdGet8 (PcdSerialFifoControl) & B_UART_FCR_FIFOE) != 0) {
+    if ((PcdGet8 (PcdSerialFifoControl) & B_UART_FCR_FIFO64) == 0) {
+      FifoSize = 16;
+    } else {
+      FifoSize = PcdGet32 (PcdSerialExtendedTxFifoSize);
+    }
+  }
+
+  Result = 0;
+
+  while (NumberOfBytes != 0) {
     //
-    // Wait for the serail port to be ready.
+    // Wait for the serail port to be ready, bounded by the configured
+    // spin budget. A budget of zero blocks until the FIFO drains;
+    // otherwise the remaining bytes are dropped once it runs out.
     //
-    do {
-      Data = IoRead8 ((UINT16) PcdGet64 (PcdSerialRegisterBase) + LSR_OFFSET);
-    } while ((Data & LSR_TXRDY) == 0);
-    IoWrite8 ((UINT16) PcdGet64 (PcdSerialRegisterBase), *Buffer++);
+    Spin = PcdGet32 (PcdSerialTxDrainSpinCount);
+    while ((IoRead8 (ComBase + LSR_OFFSET) & LSR_TXRDY) == 0) {
+      if ((PcdGet32 (PcdSerialTxDrainSpinCount) != 0) && (--Spin == 0)) {
+        return Result;
+      }
+    }
+
+    Burst = MIN (NumberOfBytes, FifoSize);
+    NumberOfBytes -= Burst;
+    Result += Burst;
+    while (Burst--) {
+      IoWrite8 (ComBase, *Buffer++);
+    }
   }
 
   return Result;
@@ -43,6 +43,64 @@ InternalGetSkuNode (
   return EFI_SUCCESS;
 }
 
+/**
+  Internal function for hashing a resource ID into the index bucket range.
+
+  @param ResId                  The resource ID.
+
+  @return The bucket number for this resource ID.
+**/
+UINTN
+InternalConfigIndexHash (
+  IN  EFI_GUID                            *ResId
+  )
+{
+  CONST UINT32                    *GuidWord;
+  UINT32                          Hash;
+
+  GuidWord = (CONST UINT32 *) ResId;
+  Hash     = ReadUnaligned32 (&GuidWord[0]) ^
+             ReadUnaligned32 (&GuidWord[1]) ^
+             ReadUnaligned32 (&GuidWord[2]) ^
+             ReadUnaligned32 (&GuidWord[3]);
+
+  return (UINTN) (Hash & (UBA_CONFIG_INDEX_BUCKETS - 1));
+}
+
+/**
+  Internal function for copying a configuration record out of the database.
+
+  @param DataNode               The configuration record node.
+  @param Data                   Data pointer.
+  @param DataSize               Data size pointer.
+
+  @retval EFI_BUFFER_TOO_SMALL  The buffer is too small to copy the data.
+  @retval EFI_SUCCESS           Operation success.
+**/
+EFI_STATUS
+InternalCopyConfigData (
+  IN  UBA_CONFIG_NODE                     *DataNode,
+  OUT VOID                                *Data,      OPTIONAL
+  OUT UINTN                               *DataSize   OPTIONAL
+  )
+{
+  if (DataSize != NULL) {
+
+    if (*DataSize < DataNode->Size) {
+      *DataSize = DataNode->Size;
+      return EFI_BUFFER_TOO_SMALL;
+    }
+
+    *DataSize = DataNode->Size;
+
+    if (Data != NULL) {
+      CopyMem (Data, DataNode->Data, DataNode->Size);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Internal function for init the platform record to database.
   Create the connections between UBA_BOARD_NODE and UBA_DXE_PRIVATE_DATA
@@ -128,6 +186,8 @@ InternalAddNewConfigData (
   UBA_DXE_PRIVATE_DATA            *UbaDxePrivate;
   UBA_CONFIG_NODE                 *NewDataNode;
   UBA_BOARD_NODE                  *SkuNode;
+  UINTN                           Bucket;
+  UINTN                           Probe;
   UbaDxePrivate = NULL;
   NewDataNode   = NULL;
   SkuNode       = NULL;
@@ -161,6 +221,22 @@ InternalAddNewConfigData (
   UbaDxePrivate->ConfigDataCount ++;
   UbaDxePrivate->HandleCount ++;
 
+  //
+  // Index the new record so InternalGetConfigData can resolve the resource
+  // ID without walking the list. Probing inserts and lookups in the same
+  // order keeps the first registered record the one a lookup finds, same
+  // as the linear scan. A record left unindexed on a full table is still
+  // found by the list walk fallback.
+  //
+  Bucket = InternalConfigIndexHash (&NewDataNode->ResId);
+  for (Probe = 0; Probe < UBA_CONFIG_INDEX_BUCKETS; Probe++) {
+    if (UbaDxePrivate->ConfigIndex[Bucket] == NULL) {
+      UbaDxePrivate->ConfigIndex[Bucket] = NewDataNode;
+      break;
+    }
+    Bucket = (Bucket + 1) & (UBA_CONFIG_INDEX_BUCKETS - 1);
+  }
+
   //
   // This Protocol just install for Protocol notify
   // The Protocol instance UbaCfgDbProtocol should not used
@@ -203,9 +279,13 @@ InternalGetConfigData (
   OUT UINTN                               *DataSize   OPTIONAL
   )
 {
+  UBA_DXE_PRIVATE_DATA                  *UbaDxePrivate;
   LIST_ENTRY                            *ListHead;
   LIST_ENTRY                            *Link;
   UBA_CONFIG_NODE                       *DataNode;
+  UINTN                                 Bucket;
+  UINTN                                 Probe;
+  UbaDxePrivate = NULL;
   ListHead = NULL;
   Link     = NULL;
   DataNode = NULL;
@@ -214,6 +294,27 @@ InternalGetConfigData (
     return EFI_INVALID_PARAMETER;
   }
 
+  UbaDxePrivate = PRIVATE_DATA_FROM_PROTOCOL (This);
+
+  //
+  // Probe the hashed index first, board init code resolves resource IDs
+  // many times per boot so the common case must not walk the list.
+  //
+  Bucket = InternalConfigIndexHash (ResId);
+  for (Probe = 0; Probe < UBA_CONFIG_INDEX_BUCKETS; Probe++) {
+    DataNode = UbaDxePrivate->ConfigIndex[Bucket];
+    if (DataNode == NULL) {
+      break;
+    }
+    if (CompareGuid (ResId, &DataNode->ResId)) {
+      return InternalCopyConfigData (DataNode, Data, DataSize);
+    }
+    Bucket = (Bucket + 1) & (UBA_CONFIG_INDEX_BUCKETS - 1);
+  }
+
+  //
+  // Not indexed, fall back to scanning the record list.
+  //
   ListHead = &SkuNode->DataLinkHead;
   if (IsListEmpty (ListHead)) {
     return EFI_NOT_FOUND;
@@ -227,22 +328,7 @@ InternalGetConfigData (
       return EFI_UNSUPPORTED;
     }
     if (CompareGuid (ResId, &DataNode->ResId)) {
-
-      if (DataSize != NULL) {
-
-        if (*DataSize < DataNode->Size) {
-          *DataSize = DataNode->Size;
-          return EFI_BUFFER_TOO_SMALL;
-        }
-
-        *DataSize = DataNode->Size;
-
-        if (Data != NULL) {
-          CopyMem (Data, DataNode->Data, DataNode->Size);
-        }
-      }
-
-      return EFI_SUCCESS;
+      return InternalCopyConfigData (DataNode, Data, DataSize);
     }
   }
 
@@ -15,6 +15,13 @@
 #include <Protocol/UbaCfgDb.h>
 #include <Guid/UbaCfgHob.h>
 
+//
+// Bucket count for the open addressed ResId index, must be a power of two.
+// Keep it well above the number of records a board registers so lookups
+// stay at one or two probes.
+//
+#define UBA_CONFIG_INDEX_BUCKETS        128
+
 typedef struct _UBA_DXE_PRIVATE_DATA {
   UINT32                          Signature;
   UINT32                          Version;
@@ -22,6 +29,7 @@ typedef struct _UBA_DXE_PRIVATE_DATA {
   UINTN                           ConfigDataCount;              //for AllConfigDataSize
   UINTN                           HandleCount;
   UBA_BOARD_NODE                  *CurrentSku;
+  UBA_CONFIG_NODE                 *ConfigIndex[UBA_CONFIG_INDEX_BUCKETS];
 
   UBA_CONFIG_DATABASE_PROTOCOL   UbaCfgDbProtocol;
 } UBA_DXE_PRIVATE_DATA;
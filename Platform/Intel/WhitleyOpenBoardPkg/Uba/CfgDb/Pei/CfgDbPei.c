@@ -44,6 +44,64 @@ InternalGetSkuNode (
   return EFI_SUCCESS;
 }
 
+/**
+  Internal function for hashing a resource ID into the index bucket range.
+
+  @param ResId                  The resource ID.
+
+  @return The bucket number for this resource ID.
+**/
+UINTN
+InternalConfigIndexHash (
+  IN  EFI_GUID                            *ResId
+  )
+{
+  CONST UINT32                    *GuidWord;
+  UINT32                          Hash;
+
+  GuidWord = (CONST UINT32 *) ResId;
+  Hash     = ReadUnaligned32 (&GuidWord[0]) ^
+             ReadUnaligned32 (&GuidWord[1]) ^
+             ReadUnaligned32 (&GuidWord[2]) ^
+             ReadUnaligned32 (&GuidWord[3]);
+
+  return (UINTN) (Hash & (UBA_CONFIG_INDEX_BUCKETS - 1));
+}
+
+/**
+  Internal function for copying a configuration record out of the database.
+
+  @param DataNode               The configuration record node.
+  @param Data                   Data pointer.
+  @param DataSize               Data size pointer.
+
+  @retval EFI_BUFFER_TOO_SMALL  The buffer is too small to copy the data.
+  @retval EFI_SUCCESS           Operation success.
+**/
+EFI_STATUS
+InternalCopyConfigData (
+  IN  UBA_CONFIG_NODE                     *DataNode,
+  OUT VOID                                *Data,      OPTIONAL
+  OUT UINTN                               *DataSize   OPTIONAL
+  )
+{
+  if (DataSize != NULL) {
+
+    if (*DataSize < DataNode->Size) {
+      *DataSize = DataNode->Size;
+      return EFI_BUFFER_TOO_SMALL;
+    }
+
+    *DataSize = DataNode->Size;
+
+    if (Data != NULL) {
+      CopyMem (Data, DataNode->Data, DataNode->Size);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Internal function for init the platform record to database.
   Create the connections between UBA_BOARD_NODE and UBA_PEIM_PRIVATE_DATA
@@ -128,6 +186,8 @@ InternalAddNewConfigData (
   UBA_CONFIG_NODE                 *NewDataNode;
   UBA_BOARD_NODE                  *SkuNode;
   EFI_PEI_PPI_DESCRIPTOR          *ConfigDataPpi;
+  UINTN                           Bucket;
+  UINTN                           Probe;
   UbaPeimPrivate = NULL;
   NewDataNode = NULL;
   SkuNode = NULL;
@@ -162,6 +222,22 @@ InternalAddNewConfigData (
   UbaPeimPrivate->ConfigDataCount ++;
   UbaPeimPrivate->HandleCount ++;
 
+  //
+  // Index the new record so InternalGetConfigData can resolve the resource
+  // ID without walking the list. Probing inserts and lookups in the same
+  // order keeps the first registered record the one a lookup finds, same
+  // as the linear scan. A record left unindexed on a full table is still
+  // found by the list walk fallback.
+  //
+  Bucket = InternalConfigIndexHash (&NewDataNode->ResId);
+  for (Probe = 0; Probe < UBA_CONFIG_INDEX_BUCKETS; Probe++) {
+    if (UbaPeimPrivate->ConfigIndex[Bucket] == NULL) {
+      UbaPeimPrivate->ConfigIndex[Bucket] = NewDataNode;
+      break;
+    }
+    Bucket = (Bucket + 1) & (UBA_CONFIG_INDEX_BUCKETS - 1);
+  }
+
   //
   // This PPI just install for NotifyPpi
   // The PPI instance UbaCfgDbPpi should not used
@@ -207,9 +283,13 @@ InternalGetConfigData (
   OUT UINTN                               *DataSize   OPTIONAL
   )
 {
+  UBA_PEIM_PRIVATE_DATA                 *UbaPeimPrivate;
   LIST_ENTRY                            *ListHead;
   LIST_ENTRY                            *Link;
   UBA_CONFIG_NODE                       *DataNode;
+  UINTN                                 Bucket;
+  UINTN                                 Probe;
+  UbaPeimPrivate = NULL;
   ListHead = NULL;
   Link = NULL;
   DataNode = NULL;
@@ -218,6 +298,27 @@ InternalGetConfigData (
     return EFI_INVALID_PARAMETER;
   }
 
+  UbaPeimPrivate = PRIVATE_DATA_FROM_PPI (This);
+
+  //
+  // Probe the hashed index first, board init code resolves resource IDs
+  // many times per boot so the common case must not walk the list.
+  //
+  Bucket = InternalConfigIndexHash (ResId);
+  for (Probe = 0; Probe < UBA_CONFIG_INDEX_BUCKETS; Probe++) {
+    DataNode = UbaPeimPrivate->ConfigIndex[Bucket];
+    if (DataNode == NULL) {
+      break;
+    }
+    if (CompareGuid (ResId, &DataNode->ResId)) {
+      return InternalCopyConfigData (DataNode, Data, DataSize);
+    }
+    Bucket = (Bucket + 1) & (UBA_CONFIG_INDEX_BUCKETS - 1);
+  }
+
+  //
+  // Not indexed, fall back to scanning the record list.
+  //
   ListHead = &SkuNode->DataLinkHead;
   if (IsListEmpty (ListHead)) {
     return EFI_NOT_FOUND;
@@ -232,22 +333,7 @@ InternalGetConfigData (
     }
 
     if (CompareGuid (ResId, &DataNode->ResId)) {
-
-      if (DataSize != NULL) {
-
-        if (*DataSize < DataNode->Size) {
-          *DataSize = DataNode->Size;
-          return EFI_BUFFER_TOO_SMALL;
-        }
-
-        *DataSize = DataNode->Size;
-
-        if (Data != NULL) {
-          CopyMem (Data, DataNode->Data, DataNode->Size);
-        }
-      }
-
-      return EFI_SUCCESS;
+      return InternalCopyConfigData (DataNode, Data, DataSize);
     }
   }
 
@@ -327,6 +413,7 @@ PeiConvertDataPointer (
   UBA_CONFIG_NODE                       *DataNode;
   LIST_ENTRY                            *DataListHead;
   LIST_ENTRY                            *DataLink;
+  UINTN                                 Bucket;
   UbaPeimPrivate = NULL;
   SkuNode = NULL;
   DataNode = NULL;
@@ -355,6 +442,15 @@ PeiConvertDataPointer (
     DataLink = DataLink->ForwardLink;
   }
 
+  //
+  // The index buckets hold raw node pointers, fix them the same way.
+  //
+  for (Bucket = 0; Bucket < UBA_CONFIG_INDEX_BUCKETS; Bucket++) {
+    if (UbaPeimPrivate->ConfigIndex[Bucket] != NULL) {
+      PeiConvertVoidPointer ((VOID **) &UbaPeimPrivate->ConfigIndex[Bucket], PtrPositive, PtrDelta);
+    }
+  }
+
   UbaPeimPrivate->ThisAddress = (UINTN) This;
 
   return EFI_SUCCESS;
@@ -15,6 +15,13 @@
 #include <Ppi/UbaCfgDb.h>
 #include <Guid/UbaCfgHob.h>
 
+//
+// Bucket count for the open addressed ResId index, must be a power of two.
+// Keep it well above the number of records a board registers so lookups
+// stay at one or two probes.
+//
+#define UBA_CONFIG_INDEX_BUCKETS        128
+
 typedef struct _UBA_PEIM_PRIVATE_DATA {
   UINT32                          Signature;
   UINT32                          Version;
@@ -23,6 +30,7 @@ typedef struct _UBA_PEIM_PRIVATE_DATA {
   UINTN                           HandleCount;
   UBA_BOARD_NODE                  *CurrentSku;
   UINTN                           ThisAddress;
+  UBA_CONFIG_NODE                 *ConfigIndex[UBA_CONFIG_INDEX_BUCKETS];
 
   UBA_CONFIG_DATABASE_PPI         UbaCfgDbPpi;
   EFI_PEI_PPI_DESCRIPTOR          UbaPeimPpiList;
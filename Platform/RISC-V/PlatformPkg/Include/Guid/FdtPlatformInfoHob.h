@@ -0,0 +1,51 @@
+/** @file
+Typed platform information extracted from the device tree in PEI.
+
+The FDT PEIM walks the flattened device tree once and publishes the
+fields every early consumer needs (harts, memory ranges, console and
+timebase) in this HOB, together with node offsets into the relocated
+FDT published through gFdtHobGuid for anything less common. Downstream
+PEIMs and DXE drivers should consume this HOB instead of re-parsing
+the blob.
+
+Copyright (c) 2021-2022, Hewlett Packard Enterprise Development LP. All rights reserved.<BR>
+
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef RISCV_FDT_PLATFORM_INFO_HOB_H_
+#define RISCV_FDT_PLATFORM_INFO_HOB_H_
+
+#define FDT_PLATFORM_INFO_HOB_GUID \
+  { 0x9f1ed240, 0x6ee2, 0x4e1c, { 0xaa, 0x15, 0x23, 0x92, 0x7d, 0x75, 0xd0, 0x4b } }
+
+#define FDT_PLATFORM_INFO_MAX_HARTS          64
+#define FDT_PLATFORM_INFO_MAX_MEMORY_RANGES  8
+
+typedef struct {
+  UINT64    Base;
+  UINT64    Size;
+} FDT_PLATFORM_MEMORY_RANGE;
+
+typedef struct {
+  UINT32                       HartCount;
+  UINT32                       MemoryRangeCount;
+  UINT64                       HartId[FDT_PLATFORM_INFO_MAX_HARTS];
+  FDT_PLATFORM_MEMORY_RANGE    MemoryRange[FDT_PLATFORM_INFO_MAX_MEMORY_RANGES];
+  UINT64                       TimebaseFrequency;
+  UINT64                       ConsoleUartBase;
+  UINT32                       ConsoleUartClock;
+  //
+  // Offsets into the FDT published through gFdtHobGuid, -1 when the node
+  // was not found. Consumers needing more than the typed fields above can
+  // seek straight to their node instead of walking the blob again.
+  //
+  INT32                        CpusNodeOffset;
+  INT32                        ChosenNodeOffset;
+  INT32                        ConsoleNodeOffset;
+} FDT_PLATFORM_INFO;
+
+extern EFI_GUID gFdtPlatformInfoHobGuid;
+
+#endif
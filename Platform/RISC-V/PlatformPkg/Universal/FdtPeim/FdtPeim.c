@@ -7,6 +7,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 **/
 
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/HobLib.h>
 #include <Library/MemoryAllocationLib.h>
@@ -15,6 +17,216 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <libfdt.h>
 
 #include <Guid/FdtHob.h>
+#include <Guid/FdtPlatformInfoHob.h>
+
+/**
+  Read a big-endian cell group from a device tree property.
+
+  @param  Cell                   Pointer to the first cell.
+  @param  CellCount              Number of 32-bit cells to combine.
+
+  @retval The combined value.
+**/
+STATIC
+UINT64
+FdtReadCells (
+  IN CONST UINT32  *Cell,
+  IN UINT32        CellCount
+  )
+{
+  UINT64  Value;
+
+  Value = 0;
+  while (CellCount-- > 0) {
+    Value = LShiftU64 (Value, 32) | fdt32_to_cpu (*Cell);
+    Cell++;
+  }
+
+  return Value;
+}
+
+/**
+  Read a #address-cells or #size-cells property of a node, falling back
+  to a default when the property is absent.
+
+  @param  Fdt                    Pointer to the device tree.
+  @param  NodeOffset             Offset of the node to read.
+  @param  Name                   Property name to read.
+  @param  Default                Value to use when the property is absent.
+
+  @retval The cell count.
+**/
+STATIC
+UINT32
+FdtReadCellCount (
+  IN VOID         *Fdt,
+  IN INT32        NodeOffset,
+  IN CONST CHAR8  *Name,
+  IN UINT32       Default
+  )
+{
+  CONST UINT32  *Prop;
+  INT32         Len;
+
+  Prop = fdt_getprop (Fdt, NodeOffset, Name, &Len);
+  if ((Prop == NULL) || (Len != sizeof (UINT32))) {
+    return Default;
+  }
+
+  return fdt32_to_cpu (*Prop);
+}
+
+/**
+  Walk the device tree once and publish the typed platform information
+  HOB, so the hart list, memory ranges, console and timebase parameters
+  are extracted here instead of by every downstream consumer.
+
+  @param  Fdt                    Pointer to the relocated device tree the
+                                 recorded node offsets refer to.
+**/
+STATIC
+VOID
+BuildFdtPlatformInfoHob (
+  IN VOID  *Fdt
+  )
+{
+  FDT_PLATFORM_INFO  *Info;
+  CONST UINT32       *Prop;
+  CONST CHAR8        *Str;
+  CHAR8              ConsolePath[128];
+  UINT32             AddressCells;
+  UINT32             SizeCells;
+  UINT32             CpuAddressCells;
+  UINT32             Index;
+  INT32              Node;
+  INT32              SubNode;
+  INT32              Parent;
+  INT32              Len;
+
+  Info = BuildGuidHob (&gFdtPlatformInfoHobGuid, sizeof (FDT_PLATFORM_INFO));
+  ASSERT (Info != NULL);
+  if (Info == NULL) {
+    return;
+  }
+
+  ZeroMem (Info, sizeof (FDT_PLATFORM_INFO));
+  Info->CpusNodeOffset    = -1;
+  Info->ChosenNodeOffset  = -1;
+  Info->ConsoleNodeOffset = -1;
+
+  //
+  // The root cell counts govern the layout of the memory reg properties.
+  //
+  AddressCells = FdtReadCellCount (Fdt, 0, "#address-cells", 2);
+  SizeCells    = FdtReadCellCount (Fdt, 0, "#size-cells", 2);
+
+  //
+  // Hart list and timebase from a single /cpus walk.
+  //
+  Node = fdt_path_offset (Fdt, "/cpus");
+  if (Node >= 0) {
+    Info->CpusNodeOffset = Node;
+    Prop = fdt_getprop (Fdt, Node, "timebase-frequency", &Len);
+    if ((Prop != NULL) && (Len == sizeof (UINT32))) {
+      Info->TimebaseFrequency = fdt32_to_cpu (*Prop);
+    }
+
+    CpuAddressCells = FdtReadCellCount (Fdt, Node, "#address-cells", 1);
+    for (SubNode = fdt_first_subnode (Fdt, Node);
+         SubNode >= 0;
+         SubNode = fdt_next_subnode (Fdt, SubNode)) {
+      Str = fdt_getprop (Fdt, SubNode, "device_type", &Len);
+      if ((Str == NULL) || (AsciiStrCmp (Str, "cpu") != 0)) {
+        continue;
+      }
+
+      Prop = fdt_getprop (Fdt, SubNode, "reg", &Len);
+      if ((Prop == NULL) || (Len < (INT32)(CpuAddressCells * sizeof (UINT32)))) {
+        continue;
+      }
+
+      if (Info->HartCount < FDT_PLATFORM_INFO_MAX_HARTS) {
+        Info->HartId[Info->HartCount] = FdtReadCells (Prop, CpuAddressCells);
+        Info->HartCount++;
+      }
+    }
+  }
+
+  //
+  // Memory ranges from the top-level memory nodes.
+  //
+  for (Node = fdt_first_subnode (Fdt, 0);
+       Node >= 0;
+       Node = fdt_next_subnode (Fdt, Node)) {
+    Str = fdt_getprop (Fdt, Node, "device_type", &Len);
+    if ((Str == NULL) || (AsciiStrCmp (Str, "memory") != 0)) {
+      continue;
+    }
+
+    Prop = fdt_getprop (Fdt, Node, "reg", &Len);
+    if (Prop == NULL) {
+      continue;
+    }
+
+    while ((Len >= (INT32)((AddressCells + SizeCells) * sizeof (UINT32)))
+           && (Info->MemoryRangeCount < FDT_PLATFORM_INFO_MAX_MEMORY_RANGES)) {
+      Index = Info->MemoryRangeCount;
+      Info->MemoryRange[Index].Base = FdtReadCells (Prop, AddressCells);
+      Info->MemoryRange[Index].Size = FdtReadCells (Prop + AddressCells, SizeCells);
+      Info->MemoryRangeCount++;
+      Prop += AddressCells + SizeCells;
+      Len  -= (AddressCells + SizeCells) * sizeof (UINT32);
+    }
+  }
+
+  //
+  // Console parameters from the node /chosen points at. The stdout-path
+  // value may carry baud options after a colon, which fdt_path_offset
+  // does not understand.
+  //
+  Node = fdt_path_offset (Fdt, "/chosen");
+  if (Node >= 0) {
+    Info->ChosenNodeOffset = Node;
+    Str = fdt_getprop (Fdt, Node, "stdout-path", &Len);
+    if ((Str != NULL) && (Len > 0)) {
+      for (Index = 0; (Index < sizeof (ConsolePath) - 1)
+           && (Index < (UINT32)Len)
+           && (Str[Index] != '\0') && (Str[Index] != ':'); Index++) {
+        ConsolePath[Index] = Str[Index];
+      }
+
+      ConsolePath[Index] = '\0';
+      SubNode = fdt_path_offset (Fdt, ConsolePath);
+      if (SubNode >= 0) {
+        Info->ConsoleNodeOffset = SubNode;
+        Parent = fdt_parent_offset (Fdt, SubNode);
+        if (Parent < 0) {
+          Parent = 0;
+        }
+
+        Prop = fdt_getprop (Fdt, SubNode, "reg", &Len);
+        AddressCells = FdtReadCellCount (Fdt, Parent, "#address-cells", 2);
+        if ((Prop != NULL) && (Len >= (INT32)(AddressCells * sizeof (UINT32)))) {
+          Info->ConsoleUartBase = FdtReadCells (Prop, AddressCells);
+        }
+
+        Prop = fdt_getprop (Fdt, SubNode, "clock-frequency", &Len);
+        if ((Prop != NULL) && (Len == sizeof (UINT32))) {
+          Info->ConsoleUartClock = fdt32_to_cpu (*Prop);
+        }
+      }
+    }
+  }
+
+  DEBUG ((DEBUG_INFO,
+    "%a: %d harts, %d memory ranges, timebase %ld Hz, console at 0x%lx\n",
+    __FUNCTION__,
+    Info->HartCount,
+    Info->MemoryRangeCount,
+    Info->TimebaseFrequency,
+    Info->ConsoleUartBase
+    ));
+}
 
 /**
   The entrypoint of the module, it will pass the FDT via a HOB.
@@ -69,5 +281,11 @@ PeimPassFdt (
   ASSERT (FdtHobData != NULL);
   *FdtHobData = (UINTN)NewBase;
 
+  //
+  // Extract the typed platform information in one pass over the relocated
+  // copy, so downstream consumers do not each re-walk the blob.
+  //
+  BuildFdtPlatformInfoHob (NewBase);
+
   return EFI_SUCCESS;
 }
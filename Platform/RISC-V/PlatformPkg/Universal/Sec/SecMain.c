@@ -28,8 +28,11 @@
 //
 // Indicates the boot hart (PcdBootHartId) OpenSBI initialization is done.
 //
-atomic_t  BootHartDone           = ATOMIC_INITIALIZER (0);
-atomic_t  NonBootHartMessageLock = ATOMIC_INITIALIZER (0);
+// Each flag gets a cache line of its own, so the non boot harts polling
+// BootHartDone do not contend with the exchanges on the message lock.
+//
+atomic_t  BootHartDone           __attribute__ ((aligned (64))) = ATOMIC_INITIALIZER (0);
+atomic_t  NonBootHartMessageLock __attribute__ ((aligned (64))) = ATOMIC_INITIALIZER (0);
 
 /**
   Locates a section within a series of sections
@@ -650,6 +653,7 @@ SecCoreStartUpWithStack (
   )
 {
   UINT32                                    HardIndex;
+  UINT32                                    PauseCount;
   UINT64                                    BootHartDoneSbiInit;
   UINT64                                    NonBootHartMessageLockValue;
   struct sbi_platform                       *ThisSbiPlatform;
@@ -700,14 +704,20 @@ SecCoreStartUpWithStack (
   do {
     BootHartDoneSbiInit = atomic_read (&BootHartDone);
     //
-    // Below leave some memory cycles to boot hart
-    // for updating BootHartDone.
+    // Back off between the polls to leave the memory system to the boot
+    // hart. The flag is written only once, so the poll latency does not
+    // matter here.
     //
-    CpuPause ();
-    CpuPause ();
-    CpuPause ();
+    for (PauseCount = 0; PauseCount < 64; PauseCount++) {
+      CpuPause ();
+    }
   } while (BootHartDoneSbiInit != (UINT64)TRUE);
 
+  //
+  // The message lock only serializes the console output below, so do not
+  // bounce it between the harts when debug code is disabled.
+  //
+  DEBUG_CODE_BEGIN ();
   NonBootHartMessageLockValue = atomic_xchg (&NonBootHartMessageLock, TRUE);
   while (NonBootHartMessageLockValue == TRUE) {
     CpuPause ();
@@ -717,13 +727,14 @@ SecCoreStartUpWithStack (
   }
 
   DEBUG ((DEBUG_INFO, "%a: Non boot hart %d initialization.\n", __FUNCTION__, HartId));
+  DEBUG ((DEBUG_INFO, "%a: Non boot hart %d DTB is at 0x%x.\n", __FUNCTION__, HartId, Scratch->next_arg1));
+  NonBootHartMessageLockValue = atomic_xchg (&NonBootHartMessageLock, FALSE);
+  DEBUG_CODE_END ();
+
   if (Scratch->next_arg1 == (unsigned long)NULL) {
     DEBUG ((DEBUG_ERROR, "Platform Device Tree is not found\n"));
     ASSERT (FALSE);
   }
-
-  DEBUG ((DEBUG_INFO, "%a: Non boot hart %d DTB is at 0x%x.\n", __FUNCTION__, HartId, Scratch->next_arg1));
-  NonBootHartMessageLockValue = atomic_xchg (&NonBootHartMessageLock, FALSE);
   //
   // Non boot hart wiil be halted waiting for SBI_HART_STARTING.
   // Use HSM ecall to start non boot hart (SBI_EXT_HSM_HART_START) later on,
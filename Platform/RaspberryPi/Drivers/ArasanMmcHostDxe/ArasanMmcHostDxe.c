@@ -15,6 +15,12 @@ STATIC BOOLEAN mCardIsPresent = FALSE;
 STATIC CARD_DETECT_STATE mCardDetectState = CardDetectRequired;
 UINT32 LastExecutedCommand = (UINT32) -1;
 
+//
+// Block count announced by the last CMD23, consumed by the following
+// CMD18/CMD25 to program a bounded multi-block transfer.
+//
+STATIC UINT32 mBlockCount = 1;
+
 STATIC RASPBERRY_PI_FIRMWARE_PROTOCOL *mFwProtocol;
 STATIC UINTN mMmcHsBase;
 
@@ -339,6 +345,7 @@ MMCSendCommand (
   BOOLEAN IsAppCmd = (LastExecutedCommand == CMD55);
   BOOLEAN IsDATCmd = FALSE;
   BOOLEAN IsADTCCmd = FALSE;
+  BOOLEAN IsDataCmd = FALSE;
 
   DEBUG ((DEBUG_MMCHOST_SD, "ArasanMMCHost: MMCSendCommand(MmcCmd: %08x, Argument: %08x)\n", MmcCmd, Argument));
 
@@ -381,12 +388,32 @@ MMCSendCommand (
     goto Exit;
   }
 
+  if (!IsAppCmd && MmcCmd == CMD23) {
+    //
+    // Remember the announced count for the following CMD18/CMD25.
+    //
+    mBlockCount = Argument & 0xFFFF;
+  }
+
   if (IsAppCmd && MmcCmd == ACMD22) {
     SdMmioWrite32 (MMCHS_BLK, 4);
   } else if (IsAppCmd && MmcCmd == ACMD51) {
     SdMmioWrite32 (MMCHS_BLK, 8);
   } else if (!IsAppCmd && MmcCmd == CMD6) {
     SdMmioWrite32 (MMCHS_BLK, 64);
+  } else if (!IsAppCmd && (MmcCmd == CMD18 || MmcCmd == CMD25)) {
+    //
+    // Bounded multi-block transfer: program the full block count and let
+    // the controller count blocks itself. Without a preceding CMD23 the
+    // transfer stays open-ended and is terminated by CMD12 as before.
+    //
+    IsDataCmd = TRUE;
+    if (mBlockCount > 1) {
+      MmcCmd |= BCE_ENABLE;
+      SdMmioWrite32 (MMCHS_BLK, (mBlockCount << 16) | BLEN_512BYTES);
+    } else {
+      SdMmioWrite32 (MMCHS_BLK, BLEN_512BYTES);
+    }
   } else if (IsADTCCmd) {
     SdMmioWrite32 (MMCHS_BLK, BLEN_512BYTES);
   }
@@ -448,6 +475,12 @@ MMCSendCommand (
   }
 
 Exit:
+  if (IsDataCmd) {
+    //
+    // The announced count only applies to one data command.
+    //
+    mBlockCount = 1;
+  }
   if (EFI_ERROR (Status)) {
     LastExecutedCommand = (UINT32) -1;
   } else {
@@ -24,6 +24,18 @@
                                 (posY) * This->Mode->Info->PixelsPerScanLine * \
                                 PI3_BYTES_PER_PIXEL +                   \
                                 (posX) * PI3_BYTES_PER_PIXEL))
+#define POS_TO_SHADOW(posX, posY) ((UINT8*)                             \
+                               ((UINTN)mShadowBuffer +                  \
+                                (posY) * This->Mode->Info->PixelsPerScanLine * \
+                                PI3_BYTES_PER_PIXEL +                   \
+                                (posX) * PI3_BYTES_PER_PIXEL))
+//
+// Blt operations draw into the cached shadow surface when it is available
+// and fall back to the frame buffer itself when it is not.
+//
+#define POS_TO_SURF(posX, posY) (mShadowBuffer != NULL ?                \
+                                 POS_TO_SHADOW (posX, posY) :           \
+                                 POS_TO_FB (posX, posY))
 
 STATIC
 EFI_STATUS
@@ -108,6 +120,13 @@ typedef struct {
 
 STATIC UINT32 mBootWidth;
 STATIC UINT32 mBootHeight;
+//
+// Cached shadow of the frame buffer. The VideoCore frame buffer is mapped
+// write-through, so reads from it and read-modify-write Blt patterns are
+// slow; drawing into this surface and flushing only the dirty rectangle
+// keeps VRAM traffic down to wide sequential stores of changed pixels.
+//
+STATIC UINT8 *mShadowBuffer;
 STATIC EFI_HANDLE mDevice;
 STATIC RASPBERRY_PI_FIRMWARE_PROTOCOL *mFwProtocol;
 STATIC EFI_CPU_ARCH_PROTOCOL *mCpu;
@@ -200,6 +219,34 @@ DisplayQueryMode (
   return EFI_SUCCESS;
 }
 
+STATIC
+VOID
+DisplayFlushRect (
+  IN  EFI_GRAPHICS_OUTPUT_PROTOCOL *This,
+  IN  UINTN                        X,
+  IN  UINTN                        Y,
+  IN  UINTN                        Width,
+  IN  UINTN                        Height
+  )
+{
+  UINTN Row;
+
+  if (mShadowBuffer == NULL) {
+    return;
+  }
+
+  //
+  // Push only the dirty rectangle out to VRAM. CopyMem issues the widest
+  // stores the architecture offers, which is exactly what the
+  // write-through window wants.
+  //
+  for (Row = 0; Row < Height; Row++) {
+    CopyMem (POS_TO_FB (X, Y + Row),
+      POS_TO_SHADOW (X, Y + Row),
+      Width * PI3_BYTES_PER_PIXEL);
+  }
+}
+
 STATIC
 VOID
 ClearScreen (
@@ -282,6 +329,19 @@ DisplaySetMode (
   This->Mode->FrameBufferSize = Mode->Width * Mode->Height * PI3_BYTES_PER_PIXEL;
   DEBUG((DEBUG_INFO, "Reported Mode->FrameBufferSize is %u\n", This->Mode->FrameBufferSize));
 
+  //
+  // (Re)allocate the shadow surface for the new geometry. Drawing still
+  // works without it, just directly against VRAM.
+  //
+  if (mShadowBuffer != NULL) {
+    FreePool (mShadowBuffer);
+  }
+  mShadowBuffer = AllocatePool (This->Mode->FrameBufferSize);
+  if (mShadowBuffer == NULL) {
+    DEBUG ((DEBUG_WARN, "%a: could not allocate shadow buffer, Blt will draw to VRAM directly\n",
+      __FUNCTION__));
+  }
+
   ClearScreen (This);
   return EFI_SUCCESS;
 }
@@ -318,10 +378,11 @@ DisplayBlt (
     BltBuf = (UINT8*)BltBuffer;
 
     for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (DestinationX, DestinationY + i);
+      VidBuf = POS_TO_SURF (DestinationX, DestinationY + i);
 
       SetMem32 (VidBuf, Width * PI3_BYTES_PER_PIXEL, *(UINT32*)BltBuf);
     }
+    DisplayFlushRect (This, DestinationX, DestinationY, Width, Height);
     break;
 
   case EfiBltVideoToBltBuffer:
@@ -329,8 +390,12 @@ DisplayBlt (
       Delta = Width * PI3_BYTES_PER_PIXEL;
     }
 
+    //
+    // Served from the shadow surface - reading back the write-through
+    // frame buffer is the single most expensive Blt pattern.
+    //
     for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (SourceX, SourceY + i);
+      VidBuf = POS_TO_SURF (SourceX, SourceY + i);
 
       BltBuf = (UINT8*)((UINTN)BltBuffer + (DestinationY + i) * Delta +
         DestinationX * PI3_BYTES_PER_PIXEL);
@@ -345,21 +410,23 @@ DisplayBlt (
     }
 
     for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (DestinationX, DestinationY + i);
+      VidBuf = POS_TO_SURF (DestinationX, DestinationY + i);
       BltBuf = (UINT8*)((UINTN)BltBuffer + (SourceY + i) * Delta +
         SourceX * PI3_BYTES_PER_PIXEL);
 
       gBS->CopyMem ((VOID*)VidBuf, (VOID*)BltBuf, Width * PI3_BYTES_PER_PIXEL);
     }
+    DisplayFlushRect (This, DestinationX, DestinationY, Width, Height);
     break;
 
   case EfiBltVideoToVideo:
     for (i = 0; i < Height; i++) {
-      VidBuf = POS_TO_FB (SourceX, SourceY + i);
-      VidBuf1 = POS_TO_FB (DestinationX, DestinationY + i);
+      VidBuf = POS_TO_SURF (SourceX, SourceY + i);
+      VidBuf1 = POS_TO_SURF (DestinationX, DestinationY + i);
 
       gBS->CopyMem ((VOID*)VidBuf1, (VOID*)VidBuf, Width * PI3_BYTES_PER_PIXEL);
     }
+    DisplayFlushRect (This, DestinationX, DestinationY, Width, Height);
     break;
 
   default:
@@ -643,6 +710,10 @@ DriverStop (
   gDisplayProto.Mode->Info = NULL;
   FreePool (gDisplayProto.Mode);
   gDisplayProto.Mode = NULL;
+  if (mShadowBuffer != NULL) {
+    FreePool (mShadowBuffer);
+    mShadowBuffer = NULL;
+  }
 
   gBS->CloseProtocol (
          Controller,
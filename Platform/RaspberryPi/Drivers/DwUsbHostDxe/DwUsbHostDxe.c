@@ -94,14 +94,19 @@ Wait4Chhltd (
   UINT32  Hcint, Hctsiz;
   UINT32  HcintCompHltAck = DWC2_HCINT_XFERCOMP;
 
-  MicroSecondDelay (100);
+  /*
+   * Poll for the halt straight away: CHHLTD is the last status bit the
+   * core raises for a transaction, so once it is seen the rest of HCINT
+   * is stable and no settling delay is needed. The fixed delays that
+   * used to sit here taxed every channel enable with 200us, which
+   * dominated transfer time for short packets and split transactions.
+   */
   Status = Wait4Bit (Timeout, DwHc->DwUsbBase + HCINT (Channel),
                      DWC2_HCINT_CHHLTD, 1);
   if (EFI_ERROR (Status)) {
     return XFER_NOT_HALTED;
   }
 
-  MicroSecondDelay (100);
   Hcint = MmioRead32 (DwHc->DwUsbBase + HCINT (Channel));
 
   ASSERT ((Hcint & DWC2_HCINT_CHHLTD) != 0);
@@ -123,6 +128,14 @@ Wait4Chhltd (
   }
 
   if ((Hcint & DWC2_HCINT_NAK) != 0) {
+    /*
+     * Packets may have completed before the endpoint NAKed. Report the
+     * residual and current toggle so the caller can bank partial data
+     * and resume the transfer instead of replaying it from scratch.
+     */
+    Hctsiz = MmioRead32 (DwHc->DwUsbBase + HCTSIZ (Channel));
+    *Sub = (Hctsiz & DWC2_HCTSIZ_XFERSIZE_MASK) >> DWC2_HCTSIZ_XFERSIZE_OFFSET;
+    *Toggle = (Hctsiz & DWC2_HCTSIZ_PID_MASK) >> DWC2_HCTSIZ_PID_OFFSET;
     return XFER_NAK;
   }
 
@@ -340,7 +353,14 @@ DwHcTransfer (
     } else if (Ret == XFER_CSPLIT) {
       ASSERT (Split.Splitting);
 
-      if (Split.Tries++ < 3) {
+      if (Split.Tries++ < DWC2_CSPLIT_TRIES) {
+        /*
+         * NYET means the transaction translator hasn't heard back from
+         * the device yet. Pace the retries so they land in successive
+         * microframes rather than hammering the same one, and only
+         * fall back to a fresh start split once the window has passed.
+         */
+        MicroSecondDelay (DWC2_CSPLIT_RETRY_DELAY_US);
         goto RestartChannel;
       }
 
@@ -361,6 +381,23 @@ DwHcTransfer (
         goto RestartXfer;
       }
 
+      if ((EpType == DWC2_HCCHAR_EPTYPE_BULK) &&
+          EFI_ERROR (gBS->CheckEvent (Timeout))) {
+        /*
+         * Bulk endpoints NAK while the device is busy - mass storage
+         * does this for every command it processes. Bank whatever
+         * data already arrived and resume at the updated toggle until
+         * the caller's timeout fires, instead of failing the whole
+         * transfer and making the caller replay it.
+         */
+        if (TransferDirection) { // in
+          ArmDataSynchronizationBarrier ();
+          CopyMem (Data + Done, DwHc->AlignedBuffer, TxferLen - Sub);
+        }
+        Done += TxferLen - Sub;
+        goto RestartXfer;
+      }
+
       *TransferResult = EFI_USB_ERR_NAK;
       Status = EFI_DEVICE_ERROR;
       break;
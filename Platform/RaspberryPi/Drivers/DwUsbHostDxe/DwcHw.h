@@ -752,6 +752,14 @@
 #define DWC2_MAX_TRANSFER_SIZE           65535
 #define DWC2_MAX_PACKET_COUNT            511
 
+/*
+ * A complete split that gets NYETed may be retried on the same channel
+ * before falling back to a fresh start split, paced so consecutive
+ * attempts land in different 125us microframes.
+ */
+#define DWC2_CSPLIT_TRIES                8
+#define DWC2_CSPLIT_RETRY_DELAY_US       25
+
 #define DWC2_HC_CHANNEL                 0
 #define DWC2_HC_CHANNEL_ASYNC           1
 #define DWC2_HC_CHANNEL_SYNC            2
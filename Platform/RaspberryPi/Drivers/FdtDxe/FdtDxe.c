@@ -23,6 +23,252 @@ STATIC VOID                             *mFdtImage;
 
 STATIC RASPBERRY_PI_FIRMWARE_PROTOCOL   *mFwProtocol;
 
+/*
+ * One-pass index over the FDT. fdt_path_offset walks the alias table and
+ * the tree from the root on every call, so each fixup used to pay for a
+ * full-tree search (or several). Instead, resolve every node the fixups
+ * care about in a single traversal and keep the cached offsets adjusted
+ * as the fixups splice the tree, so later fixups never reparse it.
+ */
+typedef enum {
+  FdtNodeAliases,
+  FdtNodeMemory,
+  FdtNodePsci,
+  FdtNodeCpus,
+  FdtNodeEthernet,
+  FdtNodeUsb,
+  FdtNodeDisplay0,
+  FdtNodePcie0,
+  FdtNodePcieXhci,
+  FdtNodeCount
+} FDT_INDEX_NODE;
+
+STATIC INTN mFdtIndex[FdtNodeCount];
+
+#define FDT_INDEX_MAX_DEPTH 8
+#define FDT_INDEX_MAX_PATH  160
+
+/*
+ * Follows the fdt_path_offset matching rules: a search path component
+ * without a unit address matches a node name that carries one.
+ */
+STATIC
+BOOLEAN
+FdtPathMatch (
+  IN CONST CHAR8 *NodePath,
+  IN CONST CHAR8 *SearchPath
+  )
+{
+  for (;;) {
+    if (*SearchPath == *NodePath) {
+      if (*SearchPath == '\0') {
+        return TRUE;
+      }
+      SearchPath++;
+      NodePath++;
+    } else if ((*SearchPath == '/' || *SearchPath == '\0') &&
+               *NodePath == '@') {
+      while (*NodePath != '/' && *NodePath != '\0') {
+        NodePath++;
+      }
+    } else {
+      return FALSE;
+    }
+  }
+}
+
+STATIC
+VOID
+BuildFdtIndex (
+  VOID
+  )
+{
+  CONST CHAR8 *Target[FdtNodeCount];
+  UINTN       PathLen[FDT_INDEX_MAX_DEPTH];
+  CHAR8       Path[FDT_INDEX_MAX_PATH];
+  CONST CHAR8 *Name;
+  UINTN       NameLen;
+  UINTN       Base;
+  UINTN       Index;
+  INTN        Aliases;
+  INTN        Node;
+  INT32       Depth;
+
+  for (Index = 0; Index < FdtNodeCount; Index++) {
+    mFdtIndex[Index] = -FDT_ERR_NOTFOUND;
+    Target[Index] = NULL;
+  }
+
+  Target[FdtNodeAliases] = "/aliases";
+  Target[FdtNodeMemory] = "/memory";
+  Target[FdtNodePsci] = "/psci";
+  Target[FdtNodeCpus] = "/cpus";
+  Target[FdtNodePcieXhci] = "/scb/pcie@7d500000/pci@1,0";
+
+  //
+  // Resolve the alias-addressed nodes up front, so the walk below can
+  // pick their targets up by path like everything else.
+  //
+  Aliases = fdt_subnode_offset (mFdtImage, 0, "aliases");
+  if (Aliases >= 0) {
+    Target[FdtNodeEthernet] = fdt_getprop (mFdtImage, Aliases, "ethernet", NULL);
+    if (Target[FdtNodeEthernet] == NULL) {
+      Target[FdtNodeEthernet] = fdt_getprop (mFdtImage, Aliases, "ethernet0", NULL);
+    }
+    Target[FdtNodeUsb] = fdt_getprop (mFdtImage, Aliases, "usb", NULL);
+    Target[FdtNodeDisplay0] = fdt_getprop (mFdtImage, Aliases, "display0", NULL);
+    Target[FdtNodePcie0] = fdt_getprop (mFdtImage, Aliases, "pcie0", NULL);
+  }
+
+  PathLen[0] = 0;
+  Depth = 0;
+
+  for (Node = fdt_next_node (mFdtImage, 0, &Depth);
+       Node >= 0 && Depth > 0;
+       Node = fdt_next_node (mFdtImage, Node, &Depth)) {
+    if (Depth >= FDT_INDEX_MAX_DEPTH) {
+      continue;
+    }
+
+    Name = fdt_get_name (mFdtImage, Node, NULL);
+    if (Name == NULL) {
+      continue;
+    }
+
+    Base = PathLen[Depth - 1];
+    NameLen = AsciiStrLen (Name);
+    if (Base + NameLen + 2 > sizeof (Path)) {
+      continue;
+    }
+
+    Path[Base] = '/';
+    CopyMem (&Path[Base + 1], Name, NameLen + 1);
+    PathLen[Depth] = Base + 1 + NameLen;
+
+    for (Index = 0; Index < FdtNodeCount; Index++) {
+      if (Target[Index] != NULL && mFdtIndex[Index] < 0 &&
+          FdtPathMatch (Path, Target[Index])) {
+        mFdtIndex[Index] = Node;
+      }
+    }
+  }
+}
+
+/*
+ * Splicing the tree shifts everything behind the splice point; keep the
+ * cached offsets in step so they stay valid across fixups.
+ */
+STATIC
+VOID
+FdtIndexAdjust (
+  IN INTN  SplicePoint,
+  IN INT32 Delta
+  )
+{
+  UINTN Index;
+
+  if (Delta == 0) {
+    return;
+  }
+
+  for (Index = 0; Index < FdtNodeCount; Index++) {
+    if (mFdtIndex[Index] >= SplicePoint) {
+      mFdtIndex[Index] += Delta;
+    }
+  }
+}
+
+STATIC
+INT32
+FdtIndexSetProp (
+  IN INTN        Node,
+  IN CONST CHAR8 *Name,
+  IN CONST VOID  *Value,
+  IN UINT32      Length
+  )
+{
+  INT32 SizeBefore;
+  INT32 Retval;
+
+  SizeBefore = fdt_size_dt_struct (mFdtImage);
+  Retval = fdt_setprop (mFdtImage, Node, Name, Value, Length);
+  FdtIndexAdjust (Node + 1, fdt_size_dt_struct (mFdtImage) - SizeBefore);
+  return Retval;
+}
+
+STATIC
+INT32
+FdtIndexSetPropString (
+  IN INTN        Node,
+  IN CONST CHAR8 *Name,
+  IN CONST CHAR8 *Value
+  )
+{
+  return FdtIndexSetProp (Node, Name, Value, AsciiStrSize (Value));
+}
+
+STATIC
+INT32
+FdtIndexDelProp (
+  IN INTN        Node,
+  IN CONST CHAR8 *Name
+  )
+{
+  INT32 SizeBefore;
+  INT32 Retval;
+
+  SizeBefore = fdt_size_dt_struct (mFdtImage);
+  Retval = fdt_delprop (mFdtImage, Node, Name);
+  FdtIndexAdjust (Node + 1, fdt_size_dt_struct (mFdtImage) - SizeBefore);
+  return Retval;
+}
+
+STATIC
+INT32
+FdtIndexDelNode (
+  IN INTN Node
+  )
+{
+  INT32 SizeBefore;
+  INT32 Retval;
+  INT32 Delta;
+  UINTN Index;
+
+  SizeBefore = fdt_size_dt_struct (mFdtImage);
+  Retval = fdt_del_node (mFdtImage, Node);
+  if (Retval != 0) {
+    return Retval;
+  }
+
+  Delta = fdt_size_dt_struct (mFdtImage) - SizeBefore;
+  for (Index = 0; Index < FdtNodeCount; Index++) {
+    if (mFdtIndex[Index] >= Node && mFdtIndex[Index] < Node - Delta) {
+      mFdtIndex[Index] = -FDT_ERR_NOTFOUND;
+    }
+  }
+
+  FdtIndexAdjust (Node, Delta);
+  return Retval;
+}
+
+STATIC
+INTN
+FdtIndexAddSubnode (
+  IN INTN        Parent,
+  IN CONST CHAR8 *Name
+  )
+{
+  INT32 SizeBefore;
+  INTN  Node;
+
+  SizeBefore = fdt_size_dt_struct (mFdtImage);
+  Node = fdt_add_subnode (mFdtImage, Parent, Name);
+  if (Node >= 0) {
+    FdtIndexAdjust (Node, fdt_size_dt_struct (mFdtImage) - SizeBefore);
+  }
+  return Node;
+}
+
 STATIC
 EFI_STATUS
 FixEthernetAliases (
@@ -41,7 +287,7 @@ FixEthernetAliases (
   //
   // Look up the 'ethernet[0]' aliases
   //
-  Aliases = fdt_path_offset (mFdtImage, "/aliases");
+  Aliases = mFdtIndex[FdtNodeAliases];
   if (Aliases < 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate '/aliases'\n", __FUNCTION__));
     return EFI_NOT_FOUND;
@@ -69,7 +315,7 @@ FixEthernetAliases (
   //
   Status = EFI_SUCCESS;
   if (!Ethernet) {
-    Retval = fdt_setprop (mFdtImage, Aliases, "ethernet", Copy, CopySize);
+    Retval = FdtIndexSetProp (Aliases, "ethernet", Copy, CopySize);
     if (Retval != 0) {
       Status = EFI_NOT_FOUND;
       DEBUG ((DEBUG_ERROR, "%a: failed to create 'ethernet' alias (%d)\n",
@@ -78,7 +324,7 @@ FixEthernetAliases (
     DEBUG ((DEBUG_INFO, "%a: created 'ethernet' alias '%a'\n", __FUNCTION__, Copy));
   }
   if (!Ethernet0) {
-    Retval = fdt_setprop (mFdtImage, Aliases, "ethernet0", Copy, CopySize);
+    Retval = FdtIndexSetProp (Aliases, "ethernet0", Copy, CopySize);
     if (Retval != 0) {
       Status = EFI_NOT_FOUND;
       DEBUG ((DEBUG_ERROR, "%a: failed to create 'ethernet0' alias (%d)\n",
@@ -105,7 +351,7 @@ UpdateMacAddress (
   //
   // Locate the node that the 'ethernet' alias refers to
   //
-  Node = fdt_path_offset (mFdtImage, "ethernet");
+  Node = mFdtIndex[FdtNodeEthernet];
   if (Node < 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate 'ethernet' alias\n", __FUNCTION__));
     return EFI_NOT_FOUND;
@@ -120,7 +366,7 @@ UpdateMacAddress (
     return Status;
   }
 
-  Retval = fdt_setprop (mFdtImage, Node, "mac-address", MacAddress,
+  Retval = FdtIndexSetProp (Node, "mac-address", MacAddress,
     sizeof MacAddress);
   if (Retval != 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to create 'mac-address' property (%d)\n",
@@ -153,7 +399,7 @@ AddUsbCompatibleProperty (
   INTN          Retval;
 
   // Locate the node that the 'usb' alias refers to
-  Node = fdt_path_offset (mFdtImage, "usb");
+  Node = mFdtIndex[FdtNodeUsb];
   if (Node < 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate 'usb' alias\n", __FUNCTION__));
     return EFI_NOT_FOUND;
@@ -192,7 +438,7 @@ AddUsbCompatibleProperty (
   CopyMem (NewList, List, ListSize);
   CopyMem (&NewList[ListSize], NewProp, sizeof (NewProp));
 
-  Retval = fdt_setprop (mFdtImage, Node, "compatible", NewList,
+  Retval = FdtIndexSetProp (Node, "compatible", NewList,
              ListSize + sizeof (NewProp));
   FreePool (NewList);
   if (Retval != 0) {
@@ -213,7 +459,7 @@ CleanMemoryNodes (
   INTN Node;
   INT32 Retval;
 
-  Node = fdt_path_offset (mFdtImage, "/memory");
+  Node = mFdtIndex[FdtNodeMemory];
   if (Node < 0) {
     return EFI_SUCCESS;
   }
@@ -223,7 +469,7 @@ CleanMemoryNodes (
    * OS go crazy and ignore the UEFI map.
    */
   DEBUG ((DEBUG_INFO, "Removing bogus /memory\n"));
-  Retval = fdt_del_node (mFdtImage, Node);
+  Retval = FdtIndexDelNode (Node);
   if (Retval != 0) {
     DEBUG ((DEBUG_ERROR, "Failed to remove /memory\n"));
     return EFI_NOT_FOUND;
@@ -239,18 +485,13 @@ SanitizePSCI (
   )
 {
   INTN Node;
-  INTN Root;
+  INTN Cpus;
   INT32 Retval;
 
-  Root = fdt_path_offset (mFdtImage, "/");
-  ASSERT (Root >= 0);
-  if (Root < 0) {
-    return EFI_NOT_FOUND;
-  }
-
-  Node = fdt_path_offset (mFdtImage, "/psci");
+  Node = mFdtIndex[FdtNodePsci];
   if (Node < 0) {
-    Node = fdt_add_subnode (mFdtImage, Root, "psci");
+    Node = FdtIndexAddSubnode (0, "psci");
+    mFdtIndex[FdtNodePsci] = Node;
   }
 
   ASSERT (Node >= 0);
@@ -259,32 +500,32 @@ SanitizePSCI (
     return EFI_NOT_FOUND;
   }
 
-  Retval = fdt_setprop_string (mFdtImage, Node, "compatible", "arm,psci-1.0");
+  Retval = FdtIndexSetPropString (Node, "compatible", "arm,psci-1.0");
   if (Retval != 0) {
     DEBUG ((DEBUG_ERROR, "Couldn't set /psci compatible property\n"));
     return EFI_NOT_FOUND;
   }
 
-  Retval = fdt_setprop_string (mFdtImage, Node, "method", "smc");
+  Retval = FdtIndexSetPropString (Node, "method", "smc");
   if (Retval != 0) {
     DEBUG ((DEBUG_ERROR, "Couldn't set /psci method property\n"));
     return EFI_NOT_FOUND;
   }
 
-  Root = fdt_path_offset (mFdtImage, "/cpus");
-  if (Root < 0) {
+  Cpus = mFdtIndex[FdtNodeCpus];
+  if (Cpus < 0) {
     DEBUG ((DEBUG_ERROR, "No CPUs to update with PSCI enable-method?\n"));
     return EFI_NOT_FOUND;
   }
 
-  Node = fdt_first_subnode (mFdtImage, Root);
+  Node = fdt_first_subnode (mFdtImage, Cpus);
   while (Node >= 0) {
-    if (fdt_setprop_string (mFdtImage, Node, "enable-method", "psci") != 0) {
+    if (FdtIndexSetPropString (Node, "enable-method", "psci") != 0) {
       DEBUG ((DEBUG_ERROR, "Failed to update enable-method for a CPU\n"));
       return EFI_NOT_FOUND;
     }
 
-    fdt_delprop (mFdtImage, Node, "cpu-release-addr");
+    FdtIndexDelProp (Node, "cpu-release-addr");
     Node = fdt_next_subnode (mFdtImage, Node);
   }
   return EFI_SUCCESS;
@@ -303,7 +544,7 @@ CleanSimpleFramebuffer (
    * Should look for nodes by kind and remove aliases
    * by matching against device.
    */
-  Node = fdt_path_offset (mFdtImage, "display0");
+  Node = mFdtIndex[FdtNodeDisplay0];
   if (Node < 0) {
     return EFI_SUCCESS;
   }
@@ -313,19 +554,19 @@ CleanSimpleFramebuffer (
    * doesn't reflect the framebuffer built by UEFI.
    */
   DEBUG ((DEBUG_INFO, "Removing bogus display0\n"));
-  Retval = fdt_del_node (mFdtImage, Node);
+  Retval = FdtIndexDelNode (Node);
   if (Retval != 0) {
     DEBUG ((DEBUG_ERROR, "Failed to remove display0\n"));
     return EFI_NOT_FOUND;
   }
 
-  Node = fdt_path_offset (mFdtImage, "/aliases");
+  Node = mFdtIndex[FdtNodeAliases];
   if (Node < 0) {
     DEBUG ((DEBUG_ERROR, "Couldn't find /aliases to remove display0\n"));
     return EFI_NOT_FOUND;
   }
 
-  Retval = fdt_delprop (mFdtImage, Node, "display0");
+  Retval = FdtIndexDelProp (Node, "display0");
   if (Retval != 0) {
     DEBUG ((DEBUG_ERROR, "Failed to remove display0 alias\n"));
     return EFI_NOT_FOUND;
@@ -345,7 +586,7 @@ SyncPcie (
   INTN          Retval;
   UINT32        DmaRanges[7];
 
-  Node = fdt_path_offset (mFdtImage, "pcie0");
+  Node = mFdtIndex[FdtNodePcie0];
   if (Node < 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate 'pcie0' alias\n", __FUNCTION__));
     return EFI_NOT_FOUND;
@@ -367,7 +608,7 @@ SyncPcie (
    * around a failure in Linux and OpenBSD to reset the PCIe/XHCI correctly
    * when in DT mode.
    */
-  Retval = fdt_setprop (mFdtImage, Node, "dma-ranges",
+  Retval = FdtIndexSetProp (Node, "dma-ranges",
                         DmaRanges,  sizeof DmaRanges);
   if (Retval != 0) {
     DEBUG ((DEBUG_ERROR, "%a: failed to locate PCIe 'dma-ranges' property (%d)\n",
@@ -388,12 +629,12 @@ SyncPcie (
    * triggering the mailbox by removing the node.
    */
 
-  Node = fdt_path_offset (mFdtImage, "/scb/pcie@7d500000/pci@1,0");
+  Node = mFdtIndex[FdtNodePcieXhci];
   if (Node < 0) {
     // This can happen on CM4/etc which doesn't have an onboard XHCI
     DEBUG ((DEBUG_INFO, "%a: failed to locate /scb/pcie@7d500000/pci@1/usb@1\n", __FUNCTION__));
   } else {
-    Retval = fdt_del_node (mFdtImage, Node);
+    Retval = FdtIndexDelNode (Node);
     if (Retval != 0) {
       DEBUG ((DEBUG_ERROR, "Failed to remove /scb/pcie@7d500000/pci@1/usb@1\n"));
       return EFI_NOT_FOUND;
@@ -451,7 +692,8 @@ FdtDxeInitialize (
   DEBUG ((DEBUG_INFO, "Devicetree passed via config.txt (0x%lx bytes)\n", FdtSize));
 
   /*
-   * Probably overkill.
+   * Headroom for the fixups below, so property and node additions can
+   * splice in place instead of failing for lack of space.
    */
   FdtSize += EFI_PAGE_SIZE * 2;
   Status = gBS->AllocatePages (AllocateAnyPages, EfiBootServicesData,
@@ -467,6 +709,8 @@ FdtDxeInitialize (
      goto out;
   }
 
+  BuildFdtIndex ();
+
   /*
    * These are all best-effort.
    */
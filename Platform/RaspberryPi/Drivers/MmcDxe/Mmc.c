@@ -170,6 +170,9 @@ EFI_STATUS DestroyMmcHostInstance (
   if (MmcHostInstance->CardInfo.ECSDData) {
     FreePages (MmcHostInstance->CardInfo.ECSDData, EFI_SIZE_TO_PAGES (sizeof (ECSD)));
   }
+  if (MmcHostInstance->CacheBuffer) {
+    FreePool (MmcHostInstance->CacheBuffer);
+  }
   FreePool (MmcHostInstance);
 
   return Status;
@@ -366,6 +369,7 @@ CheckCardsCallback (
       MmcHostInstance->State = MmcHwInitializationState;
       MmcHostInstance->BlockIo.Media->MediaPresent = !MmcHostInstance->Initialized;
       MmcHostInstance->Initialized = !MmcHostInstance->Initialized;
+      MmcInvalidateCache (MmcHostInstance);
 
       if (MmcHostInstance->BlockIo.Media->MediaPresent) {
         Status = InitializeMmcDevice (MmcHostInstance);
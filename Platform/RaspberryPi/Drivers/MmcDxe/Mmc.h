@@ -342,6 +342,17 @@ typedef struct _MMC_HOST_INSTANCE {
   EFI_MMC_HOST_PROTOCOL     *MmcHost;
 
   BOOLEAN                   Initialized;
+
+  //
+  // Read-ahead sector cache. Small reads are widened to
+  // PcdMmcReadAheadBlocks and the surplus retained here, so that the
+  // bursts of adjacent single-block reads issued by filesystem drivers
+  // are served without a command per block.
+  //
+  UINT8                     *CacheBuffer;
+  EFI_LBA                   CacheStartLba;
+  UINTN                     CacheBlockCount;
+  UINTN                     CacheCapacity;
 } MMC_HOST_INSTANCE;
 
 #define MMC_HOST_INSTANCE_SIGNATURE                 SIGNATURE_32('m', 'm', 'c', 'h')
@@ -487,6 +498,11 @@ MmcNotifyState (
   IN MMC_STATE               State
   );
 
+VOID
+MmcInvalidateCache (
+  IN MMC_HOST_INSTANCE      *MmcHostInstance
+  );
+
 EFI_STATUS
 InitializeMmcDevice (
   IN  MMC_HOST_INSTANCE     *MmcHost
@@ -7,12 +7,23 @@
  **/
 
 #include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
 
 #include "Mmc.h"
 
 #define MMCI0_BLOCKLEN 512
 #define MMCI0_TIMEOUT  1000
 
+EFI_STATUS
+MmcIoBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL    *This,
+  IN UINTN                    Transfer,
+  IN UINT32                   MediaId,
+  IN EFI_LBA                  Lba,
+  IN UINTN                    BufferSize,
+  OUT VOID                    *Buffer
+  );
+
 STATIC
 EFI_STATUS
 R1TranAndReady (
@@ -177,6 +188,8 @@ MmcReset (
     // Indicate that the driver requires initialization
     MmcHostInstance->State = MmcHwInitializationState;
 
+    MmcInvalidateCache (MmcHostInstance);
+
     return EFI_SUCCESS;
   }
 
@@ -314,6 +327,130 @@ MmcTransferBlock (
   return Status;
 }
 
+VOID
+MmcInvalidateCache (
+  IN MMC_HOST_INSTANCE        *MmcHostInstance
+  )
+{
+  MmcHostInstance->CacheBlockCount = 0;
+}
+
+STATIC
+VOID
+MmcInvalidateCacheRange (
+  IN MMC_HOST_INSTANCE        *MmcHostInstance,
+  IN EFI_LBA                  Lba,
+  IN UINTN                    BlockCount
+  )
+{
+  if (MmcHostInstance->CacheBlockCount != 0 &&
+      Lba + BlockCount > MmcHostInstance->CacheStartLba &&
+      Lba < MmcHostInstance->CacheStartLba + MmcHostInstance->CacheBlockCount) {
+    MmcInvalidateCache (MmcHostInstance);
+  }
+}
+
+/**
+  Try to satisfy a read from the read-ahead cache, widening small
+  requests to PcdMmcReadAheadBlocks so that the surplus blocks are
+  retained for the adjacent reads that typically follow.
+
+  @retval TRUE   The request was served (Buffer is filled).
+  @retval FALSE  The caller must issue the read itself.
+
+**/
+STATIC
+BOOLEAN
+MmcReadAheadBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL    *This,
+  IN MMC_HOST_INSTANCE        *MmcHostInstance,
+  IN UINT32                   MediaId,
+  IN EFI_LBA                  Lba,
+  IN UINTN                    BufferSize,
+  OUT VOID                    *Buffer
+  )
+{
+  EFI_STATUS              Status;
+  EFI_MMC_HOST_PROTOCOL   *MmcHost;
+  UINTN                   BlockCount;
+  UINTN                   ReadAheadBlocks;
+  UINTN                   Offset;
+
+  ReadAheadBlocks = PcdGet32 (PcdMmcReadAheadBlocks);
+  if (ReadAheadBlocks == 0) {
+    return FALSE;
+  }
+
+  BlockCount = BufferSize / This->Media->BlockSize;
+
+  // Serve the request from the cache when it is fully contained
+  if (MmcHostInstance->CacheBlockCount != 0 &&
+      Lba >= MmcHostInstance->CacheStartLba &&
+      Lba + BlockCount <=
+      MmcHostInstance->CacheStartLba + MmcHostInstance->CacheBlockCount) {
+    Offset = (UINTN)(Lba - MmcHostInstance->CacheStartLba) * This->Media->BlockSize;
+    CopyMem (Buffer, MmcHostInstance->CacheBuffer + Offset, BufferSize);
+    return TRUE;
+  }
+
+  // Large requests already amortize the per-command overhead themselves
+  if (BlockCount >= ReadAheadBlocks) {
+    return FALSE;
+  }
+
+  //
+  // Read-ahead only pays off when the extra blocks come in the same
+  // multi-block command.
+  //
+  MmcHost = MmcHostInstance->MmcHost;
+  if (PcdGet32 (PcdMmcDisableMulti) != 0 ||
+      !MMC_HOST_HAS_ISMULTIBLOCK (MmcHost) ||
+      !MmcHost->IsMultiBlock (MmcHost)) {
+    return FALSE;
+  }
+
+  // Never read past the end of the media
+  if (Lba + ReadAheadBlocks > This->Media->LastBlock + 1) {
+    ReadAheadBlocks = (UINTN)(This->Media->LastBlock + 1 - Lba);
+    if (ReadAheadBlocks <= BlockCount) {
+      return FALSE;
+    }
+  }
+
+  if (MmcHostInstance->CacheBuffer == NULL) {
+    MmcHostInstance->CacheCapacity = PcdGet32 (PcdMmcReadAheadBlocks);
+    MmcHostInstance->CacheBuffer = AllocatePool (
+                                     MmcHostInstance->CacheCapacity *
+                                     This->Media->BlockSize);
+    if (MmcHostInstance->CacheBuffer == NULL) {
+      MmcHostInstance->CacheCapacity = 0;
+      return FALSE;
+    }
+  }
+  if (ReadAheadBlocks > MmcHostInstance->CacheCapacity) {
+    ReadAheadBlocks = MmcHostInstance->CacheCapacity;
+  }
+
+  //
+  // Re-enter MmcIoBlocks for the widened read: the request now covers
+  // ReadAheadBlocks blocks, so the read-ahead path stands aside and the
+  // regular transfer logic applies. On error fall back to the plain
+  // read, which may still succeed.
+  //
+  MmcInvalidateCache (MmcHostInstance);
+  Status = MmcIoBlocks (This, MMC_IOBLOCKS_READ, MediaId, Lba,
+             ReadAheadBlocks * This->Media->BlockSize,
+             MmcHostInstance->CacheBuffer);
+  if (EFI_ERROR (Status)) {
+    return FALSE;
+  }
+
+  MmcHostInstance->CacheStartLba = Lba;
+  MmcHostInstance->CacheBlockCount = ReadAheadBlocks;
+  CopyMem (Buffer, MmcHostInstance->CacheBuffer, BufferSize);
+  return TRUE;
+}
+
 EFI_STATUS
 MmcIoBlocks (
   IN EFI_BLOCK_IO_PROTOCOL    *This,
@@ -381,6 +518,16 @@ MmcIoBlocks (
     return EFI_INVALID_PARAMETER;
   }
 
+  if (Transfer == MMC_IOBLOCKS_READ) {
+    if (MmcReadAheadBlocks (This, MmcHostInstance, MediaId, Lba, BufferSize, Buffer)) {
+      return EFI_SUCCESS;
+    }
+  } else {
+    // Drop cached blocks the write is about to make stale
+    MmcInvalidateCacheRange (MmcHostInstance, Lba,
+      BufferSize / This->Media->BlockSize);
+  }
+
   BytesRemainingToBeTransfered = BufferSize;
   while (BytesRemainingToBeTransfered > 0) {
     Status = WaitUntilTran (MmcHostInstance);
@@ -10,6 +10,7 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/TimerLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 
 #include "Mmc.h"
 
@@ -20,6 +21,102 @@ typedef union {
 
 #define MAX_RETRY_COUNT         1000
 #define CMD_RETRY_COUNT         20
+
+//
+// Identification backoff: instead of a fixed 1us stall per ACMD41/CMD1 poll,
+// double the stall up to this cap while the card reports busy.
+//
+#define ID_BACKOFF_START_US     8
+#define ID_BACKOFF_MAX_US       1024
+
+//
+// Card profile persisted across boots. The OCR voltage window negotiated on
+// a previous boot primes the first ACMD41, so a card that has not changed
+// (validated by CID) skips most of the negotiation retry ladder.
+//
+#define MMC_CARD_PROFILE_NAME       L"MmcCardProfile"
+#define MMC_CARD_PROFILE_SIGNATURE  SIGNATURE_32 ('M', 'C', 'P', '1')
+
+STATIC EFI_GUID mMmcCardProfileGuid = {
+  0x1a4c2c8e, 0x86fd, 0x4e21, { 0xb8, 0x10, 0x49, 0x9d, 0x02, 0x5c, 0x63, 0x7a }
+};
+
+#pragma pack (1)
+typedef struct {
+  UINT32 Signature;
+  UINT32 CardType;
+  UINT32 Ocr;
+  UINT32 Cid[4];
+  UINT32 NegotiationRetries;
+} MMC_CARD_PROFILE;
+#pragma pack ()
+
+STATIC MMC_CARD_PROFILE mCardProfile;
+STATIC BOOLEAN          mCardProfileValid = FALSE;
+
+STATIC
+VOID
+MmcLoadCardProfile (
+  VOID
+  )
+{
+  EFI_STATUS Status;
+  UINTN      Size;
+
+  if (mCardProfileValid) {
+    return;
+  }
+
+  Size = sizeof (mCardProfile);
+  Status = gRT->GetVariable (
+                  MMC_CARD_PROFILE_NAME,
+                  &mMmcCardProfileGuid,
+                  NULL,
+                  &Size,
+                  &mCardProfile
+                  );
+  if (EFI_ERROR (Status) ||
+      (Size != sizeof (mCardProfile)) ||
+      (mCardProfile.Signature != MMC_CARD_PROFILE_SIGNATURE)) {
+    ZeroMem (&mCardProfile, sizeof (mCardProfile));
+    return;
+  }
+
+  mCardProfileValid = TRUE;
+}
+
+STATIC
+VOID
+MmcSaveCardProfile (
+  IN MMC_HOST_INSTANCE     *MmcHostInstance,
+  IN UINT32                NegotiationRetries
+  )
+{
+  MMC_CARD_PROFILE Profile;
+
+  Profile.Signature          = MMC_CARD_PROFILE_SIGNATURE;
+  Profile.CardType           = (UINT32)MmcHostInstance->CardInfo.CardType;
+  Profile.Ocr                = ((UINT32*) &(MmcHostInstance->CardInfo.OCRData))[0];
+  CopyMem (Profile.Cid, &(MmcHostInstance->CardInfo.CIDData), sizeof (Profile.Cid));
+  Profile.NegotiationRetries = NegotiationRetries;
+
+  if (mCardProfileValid &&
+      (CompareMem (&Profile, &mCardProfile, sizeof (Profile)) == 0)) {
+    // Same card, nothing new to learn: avoid the variable write.
+    return;
+  }
+
+  CopyMem (&mCardProfile, &Profile, sizeof (Profile));
+  mCardProfileValid = TRUE;
+
+  gRT->SetVariable (
+         MMC_CARD_PROFILE_NAME,
+         &mMmcCardProfileGuid,
+         EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+         sizeof (mCardProfile),
+         &mCardProfile
+         );
+}
 #define RCA_SHIFT_OFFSET        16
 #define EMMC_CARD_SIZE          512
 #define EMMC_ECSD_SIZE_OFFSET   53
@@ -726,6 +823,7 @@ MmcIdentificationMode (
   EFI_STATUS              Status;
   UINT32                  Response[4];
   UINTN                   Timeout;
+  UINT32                  Backoff;
   UINTN                   CmdArg;
   BOOLEAN                 IsHCS;
   EFI_MMC_HOST_PROTOCOL   *MmcHost;
@@ -820,8 +918,19 @@ MmcIdentificationMode (
     DEBUG ((DEBUG_ERROR, "Not a SD2.0 Card\n"));
   }
 
+  MmcLoadCardProfile ();
+  if (mCardProfileValid) {
+    //
+    // Prime the first ACMD41/CMD1 with the voltage window negotiated on a
+    // previous boot. With a correct window the card starts initialization
+    // on the first full command instead of after an extra inquiry round.
+    //
+    ((UINT32*) &(MmcHostInstance->CardInfo.OCRData))[0] = mCardProfile.Ocr & ~BIT31;
+  }
+
   // We need to wait for the MMC or SD card is ready => (gCardInfo.OCRData.PowerUp == 1)
   Timeout = MAX_RETRY_COUNT;
+  Backoff = ID_BACKOFF_START_US;
   while (Timeout > 0) {
     // SD Card or MMC Card ? CMD55 indicates to the card that the next command is an application specific command
     Status = MmcHost->SendCommand (MmcHost, MMC_CMD55, 0);
@@ -864,7 +973,10 @@ MmcIdentificationMode (
 
     if (!EFI_ERROR (Status)) {
       if (!MmcHostInstance->CardInfo.OCRData.PowerUp) {
-        gBS->Stall (1);
+        gBS->Stall (Backoff);
+        if (Backoff < ID_BACKOFF_MAX_US) {
+          Backoff *= 2;
+        }
         Timeout--;
       } else {
         if ((MmcHostInstance->CardInfo.CardType == SD_CARD_2) && (MmcHostInstance->CardInfo.OCRData.AccessMode & BIT1)) {
@@ -874,7 +986,10 @@ MmcIdentificationMode (
         break;  // The MMC/SD card is ready. Continue the Identification Mode
       }
     } else {
-      gBS->Stall (1);
+      gBS->Stall (Backoff);
+      if (Backoff < ID_BACKOFF_MAX_US) {
+        Backoff *= 2;
+      }
       Timeout--;
     }
   }
@@ -905,6 +1020,17 @@ MmcIdentificationMode (
 
   PrintCID (Response);
 
+  CopyMem (&(MmcHostInstance->CardInfo.CIDData), Response,
+    sizeof (MmcHostInstance->CardInfo.CIDData));
+  if (mCardProfileValid &&
+      (CompareMem (mCardProfile.Cid, Response, sizeof (mCardProfile.Cid)) != 0)) {
+    //
+    // A different card than last boot: the cached profile is stale and
+    // will be rewritten once this identification completes.
+    //
+    mCardProfileValid = FALSE;
+  }
+
   Status = MmcHost->NotifyState (MmcHost, MmcIdentificationState);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "MmcIdentificationMode() : Error MmcIdentificationState\n"));
@@ -942,6 +1068,8 @@ MmcIdentificationMode (
     return Status;
   }
 
+  MmcSaveCardProfile (MmcHostInstance, (UINT32)(MAX_RETRY_COUNT - Timeout));
+
   return EFI_SUCCESS;
 }
 
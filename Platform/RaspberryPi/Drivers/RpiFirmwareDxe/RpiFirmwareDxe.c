@@ -37,6 +37,27 @@ STATIC UINTN mDmaBufferBusAddress;
 
 STATIC SPIN_LOCK mMailboxLock;
 
+//
+// Answers that cannot change while the system is running. They are fetched
+// with a single multi-tag mailbox transaction on first use, so the dozens of
+// sequential queries issued by ConfigDxe and PlatformSmbiosDxe at boot cost
+// one doorbell/poll cycle instead of one each.
+//
+STATIC struct {
+  BOOLEAN   Valid;
+  UINT32    Model;
+  UINT32    ModelRevision;
+  UINT32    FirmwareRevision;
+  UINT64    Serial;
+  UINT8     MacAddress[6];
+} mBoardInfo;
+
+STATIC
+EFI_STATUS
+RpiFirmwarePrimeBoardInfo (
+  VOID
+  );
+
 STATIC
 BOOLEAN
 DrainMailbox (
@@ -308,6 +329,15 @@ RpiFirmwareGetMacAddress (
   EFI_STATUS                  Status;
   UINT32                      Result;
 
+  //
+  // Serve the answer from the cached multi-tag query when possible and
+  // fall back to a dedicated transaction otherwise.
+  //
+  if (!EFI_ERROR (RpiFirmwarePrimeBoardInfo ())) {
+    CopyMem (MacAddress, mBoardInfo.MacAddress, sizeof (mBoardInfo.MacAddress));
+    return EFI_SUCCESS;
+  }
+
   if (!AcquireSpinLockOrFail (&mMailboxLock)) {
     DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -364,6 +394,18 @@ RpiFirmwareGetSerial (
   EFI_STATUS                  Status;
   UINT32                      Result;
 
+  if (!EFI_ERROR (RpiFirmwarePrimeBoardInfo ())) {
+    *Serial = mBoardInfo.Serial;
+    // Some platforms return 0 or 0x0000000010000000 for serial.
+    // For those, try to use the MAC address.
+    if ((*Serial == 0) || ((*Serial & 0xFFFFFFFF0FFFFFFFULL) == 0)) {
+      CopyMem (Serial, mBoardInfo.MacAddress, sizeof (mBoardInfo.MacAddress));
+      // Convert to a more user-friendly value
+      *Serial = SwapBytes64 (*Serial << 16);
+    }
+    return EFI_SUCCESS;
+  }
+
   if (!AcquireSpinLockOrFail (&mMailboxLock)) {
     DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -427,6 +469,11 @@ RpiFirmwareGetModel (
   EFI_STATUS                  Status;
   UINT32                      Result;
 
+  if (!EFI_ERROR (RpiFirmwarePrimeBoardInfo ())) {
+    *Model = mBoardInfo.Model;
+    return EFI_SUCCESS;
+  }
+
   if (!AcquireSpinLockOrFail (&mMailboxLock)) {
     DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -472,6 +519,89 @@ typedef struct {
 } RPI_FW_GET_REVISION_CMD;
 #pragma pack()
 
+#pragma pack(1)
+typedef struct {
+  RPI_FW_BUFFER_HEAD        BufferHead;
+  RPI_FW_TAG_HEAD           ModelTagHead;
+  RPI_FW_MODEL_TAG          Model;
+  RPI_FW_TAG_HEAD           RevisionTagHead;
+  RPI_FW_MODEL_REVISION_TAG Revision;
+  RPI_FW_TAG_HEAD           FwRevisionTagHead;
+  RPI_FW_MODEL_REVISION_TAG FwRevision;
+  RPI_FW_TAG_HEAD           MacTagHead;
+  RPI_FW_MAC_ADDR_TAG       MacAddress;
+  RPI_FW_TAG_HEAD           SerialTagHead;
+  RPI_FW_SERIAL_TAG         Serial;
+  UINT32                    EndTag;
+} RPI_FW_GET_BOARD_INFO_CMD;
+#pragma pack()
+
+/**
+  Fetch all immutable board properties with a single mailbox transaction.
+
+  The property interface allows several tags to be packed into one buffer,
+  so the model, board revision, firmware revision, MAC address and serial
+  are retrieved behind one doorbell and cached for later queries.
+**/
+STATIC
+EFI_STATUS
+RpiFirmwarePrimeBoardInfo (
+  VOID
+  )
+{
+  RPI_FW_GET_BOARD_INFO_CMD   *Cmd;
+  EFI_STATUS                  Status;
+  UINT32                      Result;
+
+  if (mBoardInfo.Valid) {
+    return EFI_SUCCESS;
+  }
+
+  if (!AcquireSpinLockOrFail (&mMailboxLock)) {
+    DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
+    return EFI_DEVICE_ERROR;
+  }
+
+  Cmd = mDmaBuffer;
+  ZeroMem (Cmd, sizeof (*Cmd));
+
+  Cmd->BufferHead.BufferSize     = sizeof (*Cmd);
+  Cmd->BufferHead.Response       = 0;
+  Cmd->ModelTagHead.TagId        = RPI_MBOX_GET_BOARD_MODEL;
+  Cmd->ModelTagHead.TagSize      = sizeof (Cmd->Model);
+  Cmd->RevisionTagHead.TagId     = RPI_MBOX_GET_BOARD_REVISION;
+  Cmd->RevisionTagHead.TagSize   = sizeof (Cmd->Revision);
+  Cmd->FwRevisionTagHead.TagId   = RPI_MBOX_GET_REVISION;
+  Cmd->FwRevisionTagHead.TagSize = sizeof (Cmd->FwRevision);
+  Cmd->MacTagHead.TagId          = RPI_MBOX_GET_MAC_ADDRESS;
+  Cmd->MacTagHead.TagSize        = sizeof (Cmd->MacAddress);
+  Cmd->SerialTagHead.TagId       = RPI_MBOX_GET_BOARD_SERIAL;
+  Cmd->SerialTagHead.TagSize     = sizeof (Cmd->Serial);
+  Cmd->EndTag                    = 0;
+
+  Status = MailboxTransaction (Cmd->BufferHead.BufferSize, RPI_MBOX_VC_CHANNEL, &Result);
+
+  if (EFI_ERROR (Status) ||
+      Cmd->BufferHead.Response != RPI_MBOX_RESP_SUCCESS) {
+    DEBUG ((DEBUG_ERROR,
+      "%a: mailbox transaction error: Status == %r, Response == 0x%x\n",
+      __FUNCTION__, Status, Cmd->BufferHead.Response));
+    ReleaseSpinLock (&mMailboxLock);
+    return EFI_DEVICE_ERROR;
+  }
+
+  mBoardInfo.Model            = Cmd->Model.Model;
+  mBoardInfo.ModelRevision    = Cmd->Revision.Revision;
+  mBoardInfo.FirmwareRevision = Cmd->FwRevision.Revision;
+  mBoardInfo.Serial           = Cmd->Serial.Serial;
+  CopyMem (mBoardInfo.MacAddress, Cmd->MacAddress.MacAddress,
+    sizeof (Cmd->MacAddress.MacAddress));
+  mBoardInfo.Valid            = TRUE;
+  ReleaseSpinLock (&mMailboxLock);
+
+  return EFI_SUCCESS;
+}
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -483,6 +613,15 @@ RpiFirmwareGetModelRevision (
   EFI_STATUS                    Status;
   UINT32                        Result;
 
+  //
+  // The board revision feeds the model name, family, memory size and CPU
+  // name lookups, so it is by far the most frequently queried property.
+  //
+  if (!EFI_ERROR (RpiFirmwarePrimeBoardInfo ())) {
+    *Revision = mBoardInfo.ModelRevision;
+    return EFI_SUCCESS;
+  }
+
   if (!AcquireSpinLockOrFail (&mMailboxLock)) {
     DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -526,6 +665,11 @@ RpiFirmwareGetFirmwareRevision (
   EFI_STATUS                    Status;
   UINT32                        Result;
 
+  if (!EFI_ERROR (RpiFirmwarePrimeBoardInfo ())) {
+    *Revision = mBoardInfo.FirmwareRevision;
+    return EFI_SUCCESS;
+  }
+
   if (!AcquireSpinLockOrFail (&mMailboxLock)) {
     DEBUG ((DEBUG_ERROR, "%a: failed to acquire spinlock\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -95,6 +95,7 @@ VarStoreWrite (
 {
   CopyMem ((VOID*)Address, Buffer, *NumBytes);
   mFvInstance->Dirty = TRUE;
+  VarStoreScheduleFlush ();
 
   return EFI_SUCCESS;
 }
@@ -108,6 +109,7 @@ VarStoreErase (
 {
   SetMem ((VOID*)Address, LbaLength, 0xff);
   mFvInstance->Dirty = TRUE;
+  VarStoreScheduleFlush ();
 
   return EFI_SUCCESS;
 }
@@ -15,6 +15,7 @@
 #include <Library/DevicePathLib.h>
 #include <Library/PcdLib.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
 #include <Library/UefiRuntimeLib.h>
 #include <Protocol/DevicePath.h>
 #include <Protocol/FirmwareVolumeBlock.h>
@@ -176,6 +177,11 @@ InstallDumpVarEventHandlers (
   VOID
 );
 
+VOID
+VarStoreScheduleFlush (
+  VOID
+  );
+
 EFI_STATUS
 FileWrite (
   IN EFI_FILE_PROTOCOL *File,
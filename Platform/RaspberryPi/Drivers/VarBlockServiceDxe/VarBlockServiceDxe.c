@@ -22,7 +22,37 @@
 #define PLATFORM_RESET_DELAY    3500000
 #endif
 
+//
+// Quiescence delay for the deferred writeback timer. Each variable store
+// write re-arms the timer, so a provisioning burst that touches dozens of
+// variables coalesces into a single file writeback once the burst goes
+// idle, instead of waiting for ready-to-boot to persist anything.
+//
+#define VARIABLE_FLUSH_QUIESCENCE EFI_TIMER_PERIOD_MILLISECONDS (2000)
+
 VOID *mSFSRegistration;
+STATIC EFI_EVENT mFlushEvent;
+
+
+VOID
+VarStoreScheduleFlush (
+  VOID
+  )
+{
+  EFI_STATUS Status;
+
+  if (mFlushEvent == NULL) {
+    //
+    // Event handlers not installed yet; the ready-to-boot
+    // flush will pick the write up.
+    //
+    return;
+  }
+
+  Status = gBS->SetTimer (mFlushEvent, TimerRelative,
+             VARIABLE_FLUSH_QUIESCENCE);
+  ASSERT_EFI_ERROR (Status);
+}
 
 
 VOID
@@ -233,6 +263,28 @@ ReadyToBootHandler (
 }
 
 
+STATIC
+VOID
+EFIAPI
+OnExitBootServices (
+  IN EFI_EVENT Event,
+  IN VOID *Context
+  )
+{
+  gBS->SetTimer (mFlushEvent, TimerCancel, 0);
+
+  //
+  // Too late to touch the SD card here: the file system stack may
+  // already have been quiesced by its own handler. Anything the
+  // ready-to-boot and image-load flushes didn't pick up stays in
+  // memory only, so at least leave a trace of it.
+  //
+  if (mFvInstance->Dirty) {
+    DEBUG ((DEBUG_WARN, "Variables dirty at ExitBootServices!\n"));
+  }
+}
+
+
 VOID
 InstallDumpVarEventHandlers (
   VOID
@@ -241,6 +293,26 @@ InstallDumpVarEventHandlers (
   EFI_STATUS Status;
   EFI_EVENT ResetEvent;
   EFI_EVENT ReadyToBootEvent;
+  EFI_EVENT ExitBootServicesEvent;
+
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  DumpVars,
+                  NULL,
+                  &mFlushEvent
+                );
+  ASSERT_EFI_ERROR (Status);
+
+  Status = gBS->CreateEventEx (
+                  EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  OnExitBootServices,
+                  NULL,
+                  &gEfiEventExitBootServicesGuid,
+                  &ExitBootServicesEvent
+                );
+  ASSERT_EFI_ERROR (Status);
 
   Status = gBS->CreateEventEx (
                   EVT_NOTIFY_SIGNAL,
@@ -13,11 +13,32 @@
 #include <Library/DebugLib.h>
 #include <Library/IoLib.h>
 #include <Library/NonDiscoverableDeviceRegistrationLib.h>
+#include <Library/PerformanceLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 
 #include <Protocol/NonDiscoverableDevice.h>
 
 #include <SocVersion.h>
 
+#define STYX_SATA_TOPOLOGY_VARIABLE_NAME  L"StyxSataTopology"
+
+STATIC EFI_GUID mStyxSataTopologyGuid = {
+  0x46f7cb3a, 0x54be, 0x41f0, { 0xb2, 0xb4, 0x55, 0x9a, 0xcd, 0x14, 0x5e, 0x92 }
+  };
+
+//
+// Bitmap of ports (numbered across both controllers) that carried a drive
+// on the previous boot. Ports that were empty are masked out of the Ports
+// Implemented register after a short PHY presence probe, which spares the
+// generic SATA stack its full per-port detection timeouts on diskless
+// systems. The variable is runtime accessible so the OS or setup can
+// delete it to request a full scan on the next boot.
+//
+STATIC UINT32  mCachedPortMap;
+STATIC BOOLEAN mCacheValid;
+STATIC UINT32  mObservedPortMap;
+
 STATIC
 VOID
 ResetSataController (
@@ -52,11 +73,39 @@ SetSataCapabilities (
   MmioOr32 (AhciBaseAddr + EFI_AHCI_CAPABILITY_OFFSET, Capability);
 }
 
+STATIC
+UINT32
+ProbeSataPorts (
+  EFI_PHYSICAL_ADDRESS    AhciBaseAddr,
+  UINTN                   PortCount
+  )
+{
+  UINT32                  PortMap;
+  UINTN                   PortNum;
+  UINTN                   Timeout;
+  UINT32                  Ssts;
+
+  PortMap = 0;
+  for (PortNum = 0; PortNum < PortCount; PortNum++) {
+    for (Timeout = EFI_AHCI_BUS_PHY_DETECT_TIMEOUT; Timeout > 0; Timeout--) {
+      Ssts = MmioRead32 (AhciBaseAddr + EFI_AHCI_PORT_OFFSET (PortNum) +
+               EFI_AHCI_PORT_SSTS);
+      if ((Ssts & EFI_AHCI_PORT_SSTS_DET_MASK) == EFI_AHCI_PORT_SSTS_DET_PCE) {
+        PortMap |= 1U << PortNum;
+        break;
+      }
+      gBS->Stall (1000);
+    }
+  }
+  return PortMap;
+}
+
 STATIC
 VOID
 InitializeSataPorts (
   EFI_PHYSICAL_ADDRESS    AhciBaseAddr,
-  UINTN                   PortCount
+  UINTN                   PortCount,
+  UINT32                  PortMap
   )
 {
   INTN                    PortNum;
@@ -66,7 +115,7 @@ InitializeSataPorts (
   UINT32                  RegVal;
 
   // Set Ports Implemented (PI)
-  MmioWrite32 (AhciBaseAddr + EFI_AHCI_PI_OFFSET, (1 << PortCount) - 1);
+  MmioWrite32 (AhciBaseAddr + EFI_AHCI_PI_OFFSET, PortMap);
 
   IsCpd = FixedPcdGetBool (PcdSataPortCpd);
   IsMpsp = FixedPcdGetBool (PcdSataPortMpsp);
@@ -91,8 +140,8 @@ InitializeSataPorts (
 }
 
 STATIC
-EFI_STATUS
-InitializeSataController (
+VOID
+StartSataController (
   EFI_PHYSICAL_ADDRESS    AhciBaseAddr,
   UINTN                   SataPortCount,
   UINTN                   StartPort
@@ -125,11 +174,41 @@ InitializeSataController (
   // Set SATA capabilities
   //
   SetSataCapabilities (AhciBaseAddr);
+}
+
+STATIC
+EFI_STATUS
+FinishSataController (
+  EFI_PHYSICAL_ADDRESS    AhciBaseAddr,
+  UINTN                   SataPortCount,
+  UINTN                   StartPort
+  )
+{
+  UINT32                  PortMap;
+  UINT32                  DetectedMap;
+
+  //
+  // Expose every port unless the cached topology says otherwise. Ports
+  // that were empty last boot only stay visible if a short PHY presence
+  // probe finds a newly attached drive; previously populated ports keep
+  // their full detection timeouts in the generic SATA stack.
+  //
+  PortMap = (1U << SataPortCount) - 1;
+  DetectedMap = ProbeSataPorts (AhciBaseAddr, SataPortCount);
+  if (mCacheValid) {
+    PortMap &= ((mCachedPortMap >> StartPort) | DetectedMap);
+    if (PortMap != (UINT32)((1U << SataPortCount) - 1)) {
+      DEBUG ((DEBUG_INFO,
+        "%a: skipping detection on empty cached ports (map 0x%x)\n",
+        __FUNCTION__, PortMap));
+    }
+  }
+  mObservedPortMap |= DetectedMap << StartPort;
 
   //
   // Set and intialize the Sata ports
   //
-  InitializeSataPorts (AhciBaseAddr, SataPortCount);
+  InitializeSataPorts (AhciBaseAddr, SataPortCount, PortMap);
 
   return RegisterNonDiscoverableMmioDevice (
            NonDiscoverableDeviceTypeAhci,
@@ -140,15 +219,13 @@ InitializeSataController (
            AhciBaseAddr, SIZE_4KB);
 }
 
+STATIC
 EFI_STATUS
-EFIAPI
-StyxSataPlatformDxeEntryPoint (
-  IN EFI_HANDLE         ImageHandle,
-  IN EFI_SYSTEM_TABLE   *SystemTable
+Sata0LinkTask (
+  VOID
   )
 {
   UINT32                  PortNum;
-  EFI_STATUS              Status;
 
   //
   // Perform SATA workarounds
@@ -157,7 +234,40 @@ StyxSataPlatformDxeEntryPoint (
       SetCwMinSata0 (PortNum);
   }
 
-  Status = InitializeSataController (FixedPcdGet32(PcdSata0CtrlAxiSlvPort),
+  StartSataController (FixedPcdGet32(PcdSata0CtrlAxiSlvPort),
+    FixedPcdGet8(PcdSata0PortCount), 0);
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+Sata1LinkTask (
+  VOID
+  )
+{
+  UINT32                  PortNum;
+
+  for (PortNum = 0; PortNum < FixedPcdGet8(PcdSata1PortCount); PortNum++) {
+      SetCwMinSata1 (PortNum);
+  }
+
+  StartSataController (FixedPcdGet32(PcdSata1CtrlAxiSlvPort),
+    FixedPcdGet8(PcdSata1PortCount), FixedPcdGet8(PcdSata0PortCount));
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+Sata0ProbeTask (
+  VOID
+  )
+{
+  EFI_STATUS              Status;
+  UINT32                  PortNum;
+
+  Status = FinishSataController (FixedPcdGet32(PcdSata0CtrlAxiSlvPort),
              FixedPcdGet8(PcdSata0PortCount), 0);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_WARN, "%a: failed to initialize primary SATA controller!\n",
@@ -169,28 +279,155 @@ StyxSataPlatformDxeEntryPoint (
       SetPrdSingleSata0 (PortNum);
   }
 
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+Sata1ProbeTask (
+  VOID
+  )
+{
+  EFI_STATUS              Status;
+  UINT32                  PortNum;
+
+  Status = FinishSataController (FixedPcdGet32(PcdSata1CtrlAxiSlvPort),
+             FixedPcdGet8(PcdSata1PortCount),
+             FixedPcdGet8(PcdSata0PortCount));
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "%a: failed to initialize secondary SATA controller!\n",
+      __FUNCTION__));
+    return Status;
+  }
+
+  for (PortNum = 0; PortNum < FixedPcdGet8(PcdSata1PortCount); PortNum++) {
+      SetPrdSingleSata1 (PortNum);
+  }
+
+  return Status;
+}
+
+//
+// Board init task graph. Each task may depend on one earlier task and is
+// stamped into the firmware performance table under its token. The link
+// tasks for both controllers run before either probe task, so the PHY
+// settling and drive spin-up windows of the two controllers overlap
+// instead of being paid back to back. NIC PHY negotiation and USB
+// handoff are owned by the generic PCIe, network and USB bus stacks on
+// this board and have no platform task to schedule here.
+//
+typedef struct {
+  CONST CHAR8   *Token;
+  EFI_STATUS    (*Run) (VOID);
+  INTN          DependsOn;
+  BOOLEAN       Skip;
+  BOOLEAN       Done;
+  EFI_STATUS    Status;
+} BOARD_INIT_TASK;
+
+typedef enum {
+  BoardTaskSata0Link = 0,
+  BoardTaskSata1Link,
+  BoardTaskSata0Probe,
+  BoardTaskSata1Probe,
+  BoardTaskCount
+} BOARD_INIT_TASK_INDEX;
+
+STATIC BOARD_INIT_TASK mBoardInitTasks[BoardTaskCount] = {
+  { "Sata0Link",  Sata0LinkTask,  -1,                 FALSE, FALSE, EFI_SUCCESS },
+  { "Sata1Link",  Sata1LinkTask,  -1,                 FALSE, FALSE, EFI_SUCCESS },
+  { "Sata0Probe", Sata0ProbeTask, BoardTaskSata0Link, FALSE, FALSE, EFI_SUCCESS },
+  { "Sata1Probe", Sata1ProbeTask, BoardTaskSata1Link, FALSE, FALSE, EFI_SUCCESS },
+};
+
+EFI_STATUS
+EFIAPI
+StyxSataPlatformDxeEntryPoint (
+  IN EFI_HANDLE         ImageHandle,
+  IN EFI_SYSTEM_TABLE   *SystemTable
+  )
+{
+  BOARD_INIT_TASK         *Task;
+  EFI_STATUS              Status;
+  UINTN                   DataSize;
+  UINTN                   Index;
+  BOOLEAN                 Progress;
+
+  //
+  // Load the port occupancy seen on the previous boot. A missing or
+  // malformed variable means a full scan of every port.
+  //
+  DataSize = sizeof (mCachedPortMap);
+  Status = gRT->GetVariable (
+                  STYX_SATA_TOPOLOGY_VARIABLE_NAME,
+                  &mStyxSataTopologyGuid,
+                  NULL,
+                  &DataSize,
+                  &mCachedPortMap
+                  );
+  mCacheValid = (BOOLEAN)(!EFI_ERROR (Status) &&
+                          DataSize == sizeof (mCachedPortMap));
+
   //
   // Ignore the second SATA controller on pre-B1 silicon
   //
-  if ((PcdGet32 (PcdSocCpuId) & STYX_SOC_VERSION_MASK) < STYX_SOC_VERSION_B1) {
-    return EFI_SUCCESS;
+  if (((PcdGet32 (PcdSocCpuId) & STYX_SOC_VERSION_MASK) < STYX_SOC_VERSION_B1) ||
+      (FixedPcdGet8(PcdSata1PortCount) == 0)) {
+    mBoardInitTasks[BoardTaskSata1Link].Skip = TRUE;
   }
 
-  if (FixedPcdGet8(PcdSata1PortCount) > 0) {
-    for (PortNum = 0; PortNum < FixedPcdGet8(PcdSata1PortCount); PortNum++) {
-        SetCwMinSata1 (PortNum);
+  //
+  // Run every task whose dependency has completed; a task whose
+  // dependency was skipped or failed is skipped as well.
+  //
+  do {
+    Progress = FALSE;
+    for (Index = 0; Index < BoardTaskCount; Index++) {
+      Task = &mBoardInitTasks[Index];
+      if (Task->Done || Task->Skip) {
+        continue;
+      }
+      if (Task->DependsOn >= 0) {
+        if (mBoardInitTasks[Task->DependsOn].Skip ||
+            (mBoardInitTasks[Task->DependsOn].Done &&
+             EFI_ERROR (mBoardInitTasks[Task->DependsOn].Status))) {
+          Task->Skip = TRUE;
+          Progress = TRUE;
+          continue;
+        }
+        if (!mBoardInitTasks[Task->DependsOn].Done) {
+          continue;
+        }
+      }
+
+      PERF_START (NULL, Task->Token, NULL, 0);
+      Task->Status = Task->Run ();
+      PERF_END (NULL, Task->Token, NULL, 0);
+      Task->Done = TRUE;
+      Progress = TRUE;
     }
+  } while (Progress);
+
+  if (EFI_ERROR (mBoardInitTasks[BoardTaskSata0Probe].Status)) {
+    return mBoardInitTasks[BoardTaskSata0Probe].Status;
+  }
 
-    Status = InitializeSataController (FixedPcdGet32(PcdSata1CtrlAxiSlvPort),
-               FixedPcdGet8(PcdSata1PortCount),
-               FixedPcdGet8(PcdSata0PortCount));
+  //
+  // Remember the occupancy observed on this boot for the next one
+  //
+  if (!mCacheValid || mObservedPortMap != mCachedPortMap) {
+    Status = gRT->SetVariable (
+                    STYX_SATA_TOPOLOGY_VARIABLE_NAME,
+                    &mStyxSataTopologyGuid,
+                    EFI_VARIABLE_NON_VOLATILE |
+                    EFI_VARIABLE_BOOTSERVICE_ACCESS |
+                    EFI_VARIABLE_RUNTIME_ACCESS,
+                    sizeof (mObservedPortMap),
+                    &mObservedPortMap
+                    );
     if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_WARN, "%a: failed to initialize secondary SATA controller!\n",
-        __FUNCTION__));
-    } else {
-      for (PortNum = 0; PortNum < FixedPcdGet8(PcdSata1PortCount); PortNum++) {
-          SetPrdSingleSata1 (PortNum);
-      }
+      DEBUG ((DEBUG_WARN, "%a: failed to save SATA topology - %r\n",
+        __FUNCTION__, Status));
     }
   }
   return EFI_SUCCESS;
@@ -13,12 +13,19 @@
 
 #include <PiDxe.h>
 
+#include <AcpiHeader.h>
+#include <Guid/BootProgressTelemetryHob.h>
 #include <Library/AmpereCpuLib.h>
+#include <Library/ArmGenericTimerCounterLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/DxeServicesLib.h>
+#include <Library/HobLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/SystemFirmwareInterfaceLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Pi/PiStatusCode.h>
+#include <Protocol/AcpiTable.h>
 #include <Protocol/ReportStatusCodeHandler.h>
 
 typedef struct {
@@ -81,10 +88,130 @@ UINT32 DxeErrorCode[] = {
   0                                                                       // Must end by 0
 };
 
+#define BOOT_PROGRESS_TELEMETRY_TABLE_SIGNATURE  SIGNATURE_32 ('B', 'P', 'R', 'T')
+#define BOOT_PROGRESS_TELEMETRY_TABLE_REVISION   1
+
+#pragma pack(1)
+
+//
+// OEM ACPI table carrying the boot progress telemetry for the OS agent
+//
+typedef struct {
+  EFI_ACPI_DESCRIPTION_HEADER Header;
+  BOOT_PROGRESS_TELEMETRY     Telemetry;
+} BOOT_PROGRESS_TELEMETRY_TABLE;
+
+#pragma pack()
+
+STATIC BOOT_PROGRESS_TELEMETRY_TABLE mTelemetryTableTemplate = {
+  .Header = __ACPI_HEADER (
+              BOOT_PROGRESS_TELEMETRY_TABLE_SIGNATURE,
+              BOOT_PROGRESS_TELEMETRY_TABLE,
+              BOOT_PROGRESS_TELEMETRY_TABLE_REVISION
+              ),
+};
+
 EFI_RSC_HANDLER_PROTOCOL *mRscHandlerProtocol = NULL;
 
+STATIC BOOT_PROGRESS_TELEMETRY *mTelemetry = NULL;
+
 STATIC UINT8 mBootstate = BootStart;
 
+/**
+  Record a boot progress event in the telemetry buffer.
+
+  The buffer was built in PEI as a HOB; DXE events are appended to it with
+  generic timer timestamps and the delta to the previously recorded event.
+
+  @param[in]  CodeType            Indicates the type of status code being reported.
+  @param[in]  Value               Describes the current status of a hardware or software entity.
+
+**/
+STATIC
+VOID
+BootProgressRecordEvent (
+  IN EFI_STATUS_CODE_TYPE  CodeType,
+  IN EFI_STATUS_CODE_VALUE Value
+  )
+{
+  BOOT_PROGRESS_TELEMETRY_RECORD *Record;
+
+  if (mTelemetry == NULL ||
+      mTelemetry->RecordCount >= BOOT_PROGRESS_TELEMETRY_MAX_RECORDS) {
+    return;
+  }
+
+  Record = &mTelemetry->Record[mTelemetry->RecordCount];
+  Record->Timestamp = ArmGenericTimerGetSystemCount ();
+  Record->Delta = (mTelemetry->RecordCount == 0) ?
+                  0 : Record->Timestamp - mTelemetry->Record[mTelemetry->RecordCount - 1].Timestamp;
+  Record->CodeType = CodeType;
+  Record->Value = Value;
+  mTelemetry->RecordCount++;
+}
+
+/**
+  Install the boot progress telemetry ACPI table on ReadyToBoot.
+
+  The table is a snapshot of the telemetry buffer so the OS agent can
+  scrape per-stage boot timing after boot; events reported after
+  ReadyToBoot keep updating SMpro only.
+
+  @param[in]  Event               Event whose notification function is being invoked.
+  @param[in]  Context             Pointer to the notification function's context.
+
+**/
+STATIC
+VOID
+EFIAPI
+BootProgressInstallAcpiTable (
+  IN EFI_EVENT Event,
+  IN VOID      *Context
+  )
+{
+  BOOT_PROGRESS_TELEMETRY_TABLE *Table;
+  EFI_ACPI_TABLE_PROTOCOL       *AcpiTableProtocol;
+  EFI_STATUS                    Status;
+  UINTN                         TableKey;
+
+  gBS->CloseEvent (Event);
+
+  if (mTelemetry == NULL) {
+    return;
+  }
+
+  Status = gBS->LocateProtocol (
+                  &gEfiAcpiTableProtocolGuid,
+                  NULL,
+                  (VOID **)&AcpiTableProtocol
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "BootProgressDxe: Unable to locate ACPI table protocol\n"));
+    return;
+  }
+
+  Table = AllocateCopyPool (
+            sizeof (BOOT_PROGRESS_TELEMETRY_TABLE),
+            &mTelemetryTableTemplate
+            );
+  if (Table == NULL) {
+    return;
+  }
+
+  CopyMem (&Table->Telemetry, mTelemetry, sizeof (BOOT_PROGRESS_TELEMETRY));
+
+  Status = AcpiTableProtocol->InstallAcpiTable (
+                                AcpiTableProtocol,
+                                Table,
+                                sizeof (BOOT_PROGRESS_TELEMETRY_TABLE),
+                                &TableKey
+                                );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "BootProgressDxe: Unable to install telemetry table\n"));
+  }
+  FreePool (Table);
+}
+
 STATIC
 BOOLEAN
 StatusCodeFilter (
@@ -163,6 +290,8 @@ BootProgressListenerDxe (
     mBootstate = BootComplete;
   }
 
+  BootProgressRecordEvent (CodeType, Value);
+
   MailboxMsgSetBootProgress (0, mBootstate, Value);
 
   if (Value == (EFI_SOFTWARE_EFI_BOOT_SERVICE | EFI_SW_BS_PC_EXIT_BOOT_SERVICES) &&
@@ -192,7 +321,18 @@ BootProgressDxeEntryPoint (
   IN EFI_SYSTEM_TABLE *SystemTable
   )
 {
+  EFI_EVENT  ReadyToBootEvent;
   EFI_STATUS Status;
+  VOID       *Hob;
+
+  //
+  // Pick up the telemetry buffer built by BootProgressPeim so DXE events
+  // are appended to the same record.
+  //
+  Hob = GetFirstGuidHob (&gBootProgressTelemetryHobGuid);
+  if (Hob != NULL) {
+    mTelemetry = (BOOT_PROGRESS_TELEMETRY *)GET_GUID_HOB_DATA (Hob);
+  }
 
   //
   // Get Report Status Code Handler Protocol.
@@ -208,5 +348,18 @@ BootProgressDxeEntryPoint (
   }
   ASSERT_EFI_ERROR (Status);
 
+  //
+  // Publish the telemetry record to the OS when the boot is about to end.
+  //
+  Status = gBS->CreateEventEx (
+                  EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  BootProgressInstallAcpiTable,
+                  NULL,
+                  &gEfiEventReadyToBootGuid,
+                  &ReadyToBootEvent
+                  );
+  ASSERT_EFI_ERROR (Status);
+
   return EFI_SUCCESS;
 }
@@ -13,8 +13,12 @@
 
 #include <PiPei.h>
 
+#include <Guid/BootProgressTelemetryHob.h>
 #include <Library/AmpereCpuLib.h>
+#include <Library/ArmGenericTimerCounterLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
+#include <Library/HobLib.h>
 #include <Library/PeiServicesLib.h>
 #include <Library/SystemFirmwareInterfaceLib.h>
 #include <Pi/PiStatusCode.h>
@@ -88,6 +92,47 @@ UINT32 PeiErrorStatusCode[] = {
 // Should always be BootStart when start
 STATIC UINT8 mBootstate = BootStart;
 
+/**
+  Record a boot progress event in the telemetry HOB.
+
+  Each event is timestamped with the generic timer and carries the delta to
+  the previously recorded event, so boot time regressions can be correlated
+  per stage after boot.
+
+  @param[in]  CodeType            Indicates the type of status code being reported.
+  @param[in]  Value               Describes the current status of a hardware or software entity.
+
+**/
+STATIC
+VOID
+BootProgressRecordEvent (
+  IN EFI_STATUS_CODE_TYPE  CodeType,
+  IN EFI_STATUS_CODE_VALUE Value
+  )
+{
+  BOOT_PROGRESS_TELEMETRY        *Telemetry;
+  BOOT_PROGRESS_TELEMETRY_RECORD *Record;
+  VOID                           *Hob;
+
+  Hob = GetFirstGuidHob (&gBootProgressTelemetryHobGuid);
+  if (Hob == NULL) {
+    return;
+  }
+
+  Telemetry = (BOOT_PROGRESS_TELEMETRY *)GET_GUID_HOB_DATA (Hob);
+  if (Telemetry->RecordCount >= BOOT_PROGRESS_TELEMETRY_MAX_RECORDS) {
+    return;
+  }
+
+  Record = &Telemetry->Record[Telemetry->RecordCount];
+  Record->Timestamp = ArmGenericTimerGetSystemCount ();
+  Record->Delta = (Telemetry->RecordCount == 0) ?
+                  0 : Record->Timestamp - Telemetry->Record[Telemetry->RecordCount - 1].Timestamp;
+  Record->CodeType = CodeType;
+  Record->Value = Value;
+  Telemetry->RecordCount++;
+}
+
 STATIC
 BOOLEAN
 StatusCodeFilter (
@@ -168,6 +213,8 @@ BootProgressListenerPei (
     mBootstate = BootFailed;
   }
 
+  BootProgressRecordEvent (CodeType, Value);
+
   MailboxMsgSetBootProgress (0, mBootstate, Value);
 
   return EFI_SUCCESS;
@@ -191,9 +238,23 @@ BootProgressPeiEntryPoint (
   IN CONST EFI_PEI_SERVICES    **PeiServices
   )
 {
+  BOOT_PROGRESS_TELEMETRY *Telemetry;
   EFI_STATUS              Status;
   EFI_PEI_RSC_HANDLER_PPI *RscHandler;
 
+  //
+  // Build the telemetry HOB that accumulates timestamped boot progress
+  // events through PEI and DXE.
+  //
+  Telemetry = BuildGuidHob (
+                &gBootProgressTelemetryHobGuid,
+                sizeof (BOOT_PROGRESS_TELEMETRY)
+                );
+  if (Telemetry != NULL) {
+    ZeroMem (Telemetry, sizeof (BOOT_PROGRESS_TELEMETRY));
+    Telemetry->TimerFrequency = ArmGenericTimerGetTimerFreq ();
+  }
+
   Status = PeiServicesLocatePpi (
              &gEfiPeiRscHandlerPpiGuid,
              0,
@@ -126,6 +126,47 @@ CpuNvParamSet (
   return EFI_SUCCESS;
 }
 
+/**
+  Write an NVParam only when the stored value is absent or different.
+
+  Every NVParam write is a transaction with the secure firmware that ends
+  in a flash update, so skipping writes whose value is already in place
+  lets an unchanged boot complete the default setup without any exchange.
+
+  @param  Param                  NVParam identifier.
+  @param  Value                  Value the param should hold.
+
+  @retval EFI_SUCCESS            The param already held Value or was updated.
+  @retval Others                 The update failed.
+
+**/
+STATIC
+EFI_STATUS
+NVParamSetIfChanged (
+  IN UINT32 Param,
+  IN UINT32 Value
+  )
+{
+  EFI_STATUS Status;
+  UINT32     StoredValue;
+
+  Status = NVParamGet (
+             Param,
+             NV_PERM_ATF | NV_PERM_BIOS | NV_PERM_MANU | NV_PERM_BMC,
+             &StoredValue
+             );
+  if (!EFI_ERROR (Status) && StoredValue == Value) {
+    return EFI_SUCCESS;
+  }
+
+  return NVParamSet (
+           Param,
+           NV_PERM_ATF | NV_PERM_BIOS | NV_PERM_MANU | NV_PERM_BMC,
+           NV_PERM_BIOS | NV_PERM_MANU,
+           Value
+           );
+}
+
 STATIC
 EFI_STATUS
 SetupDefaultSettings (
@@ -158,12 +199,7 @@ SetupDefaultSettings (
   //
   // ARM ERRATA 1542419 workaround
   //
-  Status = NVParamSet (
-             NV_SI_ERRATUM_1542419_WA,
-             NV_PERM_ATF | NV_PERM_BIOS | NV_PERM_MANU | NV_PERM_BMC,
-             NV_PERM_BIOS | NV_PERM_MANU,
-             WA_ERRATUM_1542419_DEFAULT
-             );
+  Status = NVParamSetIfChanged (NV_SI_ERRATUM_1542419_WA, WA_ERRATUM_1542419_DEFAULT);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -171,12 +207,7 @@ SetupDefaultSettings (
   //
   // Near atomic
   //
-  Status = NVParamSet (
-             NV_SI_NEAR_ATOMIC_DISABLE,
-             NV_PERM_ATF | NV_PERM_BIOS | NV_PERM_MANU | NV_PERM_BMC,
-             NV_PERM_BIOS | NV_PERM_MANU,
-             NEAR_ATOMIC_DISABLE_DEFAULT
-             );
+  Status = NVParamSetIfChanged (NV_SI_NEAR_ATOMIC_DISABLE, NEAR_ATOMIC_DISABLE_DEFAULT);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -184,12 +215,7 @@ SetupDefaultSettings (
   //
   // SLC Replacement Policy
   //
-  Status = NVParamSet (
-             NV_SI_HNF_AUX_CTL_32_63,
-             NV_PERM_ATF | NV_PERM_BIOS | NV_PERM_MANU | NV_PERM_BMC,
-             NV_PERM_BIOS | NV_PERM_MANU,
-             CPU_SLC_REPLACE_POLICY
-             );
+  Status = NVParamSetIfChanged (NV_SI_HNF_AUX_CTL_32_63, CPU_SLC_REPLACE_POLICY);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -6,6 +6,7 @@
 
 **/
 
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/FlashLib.h>
 #include <Library/PcdLib.h>
@@ -250,8 +251,6 @@ FlashFvbDxeRead (
   IN OUT   UINT8                               *Buffer
   )
 {
-  EFI_STATUS Status;
-
   ASSERT (NumBytes != NULL);
   ASSERT (Buffer != NULL);
 
@@ -259,16 +258,17 @@ FlashFvbDxeRead (
     return EFI_BAD_BUFFER_SIZE;
   }
 
-  Status = FlashReadCommand (
-             mNvFlashBase + Lba * mFlashBlockSize + Offset,
-             Buffer,
-             *NumBytes
-             );
-
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "Failed to do flash read\n"));
-    return EFI_DEVICE_ERROR;
-  }
+  //
+  // Serve the read from the in-memory copy of the NV store. The copy is
+  // refreshed from flash once at initialization and kept up to date by
+  // Write() and EraseBlocks(), so no call into the secure flash service
+  // is needed here.
+  //
+  CopyMem (
+    Buffer,
+    (VOID *)(UINTN)(mNvStorageBase + Lba * mFlashBlockSize + Offset),
+    *NumBytes
+    );
 
   return EFI_SUCCESS;
 }
@@ -350,6 +350,17 @@ FlashFvbDxeWrite (
     return EFI_BAD_BUFFER_SIZE;
   }
 
+  //
+  // Write through: update the in-memory copy so subsequent reads are
+  // served from memory, then flush the written bytes to flash in one
+  // call to the secure flash service.
+  //
+  CopyMem (
+    (VOID *)(UINTN)(mNvStorageBase + Lba * mFlashBlockSize + Offset),
+    Buffer,
+    *NumBytes
+    );
+
   Status = FlashWriteCommand (
              mNvFlashBase + Lba * mFlashBlockSize + Offset,
              Buffer,
@@ -422,20 +433,52 @@ FlashFvbDxeErase (
   VA_LIST    Args;
   EFI_LBA    Start;
   UINTN      Length;
+  EFI_LBA    PendingStart;
+  UINTN      PendingLength;
   EFI_STATUS Status;
 
   Status = EFI_SUCCESS;
+  PendingStart = 0;
+  PendingLength = 0;
 
   VA_START (Args, This);
 
+  //
+  // Update the in-memory copy and group contiguous ranges so that adjacent
+  // dirty blocks reach the secure flash service as one erase call.
+  //
   for (Start = VA_ARG (Args, EFI_LBA);
        Start != EFI_LBA_LIST_TERMINATOR;
        Start = VA_ARG (Args, EFI_LBA))
   {
     Length = VA_ARG (Args, UINTN);
+
+    SetMem (
+      (VOID *)(UINTN)(mNvStorageBase + Start * mFlashBlockSize),
+      Length * mFlashBlockSize,
+      0xFF
+      );
+
+    if ((PendingLength != 0) && (Start == PendingStart + PendingLength)) {
+      PendingLength += Length;
+      continue;
+    }
+
+    if (PendingLength != 0) {
+      Status = FlashEraseCommand (
+                 mNvFlashBase + PendingStart * mFlashBlockSize,
+                 PendingLength * mFlashBlockSize
+                 );
+    }
+
+    PendingStart = Start;
+    PendingLength = Length;
+  }
+
+  if (PendingLength != 0) {
     Status = FlashEraseCommand (
-               mNvFlashBase + Start * mFlashBlockSize,
-               Length * mFlashBlockSize
+               mNvFlashBase + PendingStart * mFlashBlockSize,
+               PendingLength * mFlashBlockSize
                );
   }
 
@@ -499,6 +542,21 @@ FlashFvbDxeInitialize (
     return EFI_DEVICE_ERROR;
   }
 
+  //
+  // Refresh the in-memory copy of the NV store from flash once, so that
+  // all subsequent reads are served from memory and only writes and
+  // erases call into the secure flash service.
+  //
+  Status = FlashReadCommand (
+             mNvFlashBase,
+             (VOID *)(UINTN)mNvStorageBase,
+             mNvStorageSize
+             );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: Failed to load NV store from Flash\n", __FUNCTION__));
+    return EFI_DEVICE_ERROR;
+  }
+
   Status = gBS->CreateEventEx (
                   EVT_NOTIFY_SIGNAL,
                   TPL_NOTIFY,
@@ -1248,15 +1248,14 @@ MemInfoScreenSetup (
   )
 {
   EFI_STATUS         Status;
-  VOID               *Hob;
   PLATFORM_INFO_HOB  *PlatformHob;
 
-  /* Get the Platform HOB */
-  Hob = GetFirstGuidHob (&gPlatformInfoHobGuid);
-  if (Hob == NULL) {
+  /* Get the Platform HOB through the cached library accessor so the HOB
+     list is only walked once per boot across its consumers */
+  PlatformHob = GetPlatformHob ();
+  if (PlatformHob == NULL) {
     return EFI_DEVICE_ERROR;
   }
-  PlatformHob = (PLATFORM_INFO_HOB *)GET_GUID_HOB_DATA (Hob);
 
   Status = MemInfoMainScreen (PlatformHob);
   if (EFI_ERROR (Status)) {
@@ -0,0 +1,47 @@
+/** @file
+
+  Copyright (c) 2021, Ampere Computing LLC. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef BOOT_PROGRESS_TELEMETRY_HOB_H_
+#define BOOT_PROGRESS_TELEMETRY_HOB_H_
+
+#define BOOT_PROGRESS_TELEMETRY_HOB_GUID \
+  { 0xc9984027, 0x73de, 0x4020, { 0x81, 0xfe, 0x1d, 0xda, 0x64, 0xb7, 0xe4, 0x6e } }
+
+extern GUID gBootProgressTelemetryHobGuid;
+
+//
+// Upper bound on recorded events. Events beyond this bound still update the
+// SMpro boot progress, they are just not recorded.
+//
+#define BOOT_PROGRESS_TELEMETRY_MAX_RECORDS  96
+
+#pragma pack(1)
+
+//
+// One timestamped boot progress event
+//
+typedef struct {
+  UINT64 Timestamp;  // Generic timer count when the event was reported
+  UINT64 Delta;      // Ticks elapsed since the previously recorded event
+  UINT32 CodeType;   // EFI_STATUS_CODE_TYPE of the event
+  UINT32 Value;      // EFI_STATUS_CODE_VALUE of the event
+} BOOT_PROGRESS_TELEMETRY_RECORD;
+
+//
+// Boot progress telemetry, built in PEI and appended to through DXE
+//
+typedef struct {
+  UINT64                         TimerFrequency; // Generic timer ticks per second
+  UINT32                         RecordCount;
+  UINT32                         Reserved;
+  BOOT_PROGRESS_TELEMETRY_RECORD Record[BOOT_PROGRESS_TELEMETRY_MAX_RECORDS];
+} BOOT_PROGRESS_TELEMETRY;
+
+#pragma pack()
+
+#endif /* BOOT_PROGRESS_TELEMETRY_HOB_H_ */
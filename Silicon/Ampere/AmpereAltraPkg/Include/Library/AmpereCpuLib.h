@@ -9,6 +9,8 @@
 #ifndef AMPERE_CPU_LIB_H_
 #define AMPERE_CPU_LIB_H_
 
+#include <Guid/PlatformInfoHob.h>
+
 #define SUBNUMA_MODE_MONOLITHIC        0
 #define SUBNUMA_MODE_HEMISPHERE        1
 #define SUBNUMA_MODE_QUADRANT          2
@@ -26,6 +28,20 @@
 #define CLUSTER_ID(CpuId)              (((CpuId) / PLATFORM_CPU_NUM_CORES_PER_CPM) % PLATFORM_CPU_MAX_CPM)
 
 
+/**
+  Get the platform HOB data.
+
+  The HOB is located once and the pointer is cached by the library
+  instance, so repeated calls do not walk the HOB list again.
+
+  @return   PLATFORM_INFO_HOB   The pointer to the platform HOB data.
+
+**/
+PLATFORM_INFO_HOB *
+GetPlatformHob (
+  VOID
+  );
+
 /**
   Get current CPU frequency.
 
@@ -1335,7 +1335,7 @@ Ac01PcieCoreUpdateLink (
         DisableCompletionTimeOut (RootComplex, PcieIndex, FALSE);
 
       } else {
-        *IsNextRoundNeeded = FALSE;
+        *IsNextRoundNeeded = TRUE;
         FailedPciePtr[*FailedPcieCount] = PcieIndex;
         *FailedPcieCount += 1;
       }
@@ -1343,6 +1343,52 @@ Ac01PcieCoreUpdateLink (
   }
 }
 
+/**
+  Check whether all links of a Root Complex have settled
+
+  A link has settled when it is already up, or when it stays electrically
+  idle because no receiver was detected. A link in the middle of LTSSM
+  training has not settled and is worth waiting for.
+
+  @param RootComplex          Pointer to AC01_ROOT_COMPLEX structure
+
+  @retval                     TRUE if no link of this Root Complex is still
+                              training
+**/
+STATIC
+BOOLEAN
+RootComplexLinkSweep (
+  IN AC01_ROOT_COMPLEX *RootComplex
+  )
+{
+  UINT32  LinkStat;
+  UINT8   PcieIndex;
+
+  if (!RootComplex->Active) {
+    return TRUE;
+  }
+
+  for (PcieIndex = 0; PcieIndex < RootComplex->MaxPcieController; PcieIndex++) {
+    if (!RootComplex->Pcie[PcieIndex].Active ||
+        RootComplex->Pcie[PcieIndex].LinkUp) {
+      continue;
+    }
+
+    if (PcieLinkUpCheck (&RootComplex->Pcie[PcieIndex])) {
+      continue;
+    }
+
+    LinkStat = MmioRead32 (RootComplex->Pcie[PcieIndex].CsrBase + AC01_PCIE_CORE_LINK_STAT_REG);
+    if ((LinkStat & (SMLH_LTSSM_STATE_MASK | PHY_STATUS_MASK_BIT |
+                     SMLH_LINK_UP_MASK_BIT | RDLH_LINK_UP_MASK_BIT)) != 0) {
+      // LTSSM is active, the link is still training
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
 /**
   Verify the link status and retry to initialize the Root Complex if there's any issue.
 
@@ -1355,13 +1401,19 @@ Ac01PcieCorePostSetupRC (
 {
   UINT8   RCIndex, Idx;
   BOOLEAN IsNextRoundNeeded, NextRoundNeeded;
+  BOOLEAN AllSettled;
   UINT64  PrevTick, CurrTick, ElapsedCycle;
   UINT64  TimerTicks64;
+  UINT64  MinSettleTicks;
+  UINT64  SettleTicks[AC01_PCIE_MAX_ROOT_COMPLEX];
   UINT8   ReInit;
   INT8    FailedPciePtr[MaxPcieControllerOfRootComplexB];
   INT8    FailedPcieCount;
 
   ReInit = 0;
+  for (RCIndex = 0; RCIndex < AC01_PCIE_MAX_ROOT_COMPLEX; RCIndex++) {
+    SettleTicks[RCIndex] = 0;
+  }
 
 _link_polling:
   NextRoundNeeded = FALSE;
@@ -1370,9 +1422,17 @@ _link_polling:
   // Calculate system ticks for link training.
   //
   TimerTicks64 = ArmGenericTimerGetTimerFreq (); /* 1 Second */
+  MinSettleTicks = TimerTicks64 / 10; /* 100ms for Detect to L0 transition */
   PrevTick = ArmGenericTimerGetSystemCount ();
   ElapsedCycle = 0;
 
+  //
+  // Training has been kicked off on every Root Complex during setup, so
+  // sweep them collectively rather than sleeping for the full deadline:
+  // stop waiting once every active link is either up or electrically idle,
+  // while links still making LTSSM progress keep the full deadline. Record
+  // when each Root Complex settled for the timing report.
+  //
   do {
     CurrTick = ArmGenericTimerGetSystemCount ();
     if (CurrTick < PrevTick) {
@@ -1381,7 +1441,20 @@ _link_polling:
     }
     ElapsedCycle += (CurrTick - PrevTick);
     PrevTick = CurrTick;
-  } while (ElapsedCycle < TimerTicks64);
+
+    AllSettled = TRUE;
+    for (RCIndex = 0; RCIndex < AC01_PCIE_MAX_ROOT_COMPLEX; RCIndex++) {
+      if (SettleTicks[RCIndex] != 0) {
+        continue;
+      }
+      if (RootComplexLinkSweep (&RootComplexList[RCIndex])) {
+        SettleTicks[RCIndex] = ElapsedCycle;
+      } else {
+        AllSettled = FALSE;
+      }
+    }
+  } while ((!AllSettled || (ElapsedCycle < MinSettleTicks))
+           && (ElapsedCycle < TimerTicks64));
 
   for (RCIndex = 0; RCIndex < AC01_PCIE_MAX_ROOT_COMPLEX; RCIndex++) {
     Ac01PcieCoreUpdateLink (&RootComplexList[RCIndex], &IsNextRoundNeeded, FailedPciePtr, &FailedPcieCount);
@@ -1407,10 +1480,38 @@ _link_polling:
           // Some controller still observes link-down. Re-init controller
           //
           Ac01PcieCoreSetupRC (&RootComplexList[RCIndex], TRUE, FailedPciePtr[Idx]);
+
+          // The Root Complex is training again, sweep it in the next round
+          SettleTicks[RCIndex] = 0;
         }
       }
     }
 
     goto _link_polling;
   }
+
+  //
+  // Per Root Complex link training timing report
+  //
+  for (RCIndex = 0; RCIndex < AC01_PCIE_MAX_ROOT_COMPLEX; RCIndex++) {
+    if (!RootComplexList[RCIndex].Active) {
+      continue;
+    }
+
+    DEBUG ((
+      DEBUG_INFO,
+      "PCIe: Socket%d RootComplex%d link training %a after %lu ms\n",
+      RootComplexList[RCIndex].Socket,
+      RootComplexList[RCIndex].ID,
+      (SettleTicks[RCIndex] != 0) ? "settled" : "deadline expired",
+      DivU64x64Remainder (
+        MultU64x32 (
+          (SettleTicks[RCIndex] != 0) ? SettleTicks[RCIndex] : TimerTicks64,
+          1000
+          ),
+        TimerTicks64,
+        NULL
+        )
+      ));
+  }
 }
@@ -19,11 +19,6 @@
 #include <NVParamDef.h>
 #include <Platform/Ac01.h>
 
-PLATFORM_INFO_HOB *
-GetPlatformHob (
-  VOID
-  );
-
 /**
   Get current CPU frequency.
 
@@ -415,7 +410,7 @@ SetNumberOfConfiguredCPMs (
   )
 {
   EFI_STATUS Status;
-  UINT32     Value;
+  UINT32     Value, StoredValue;
   UINT32     Param, ParamStart, ParamEnd;
   BOOLEAN    IsClear;
 
@@ -445,6 +440,19 @@ SetNumberOfConfiguredCPMs (
                  NV_PERM_BIOS | NV_PERM_MANU
                  );
     } else {
+      //
+      // Each NVParam write is a secure world transaction against the
+      // flash-backed parameter store, so skip words that already hold
+      // the requested bitmap and only push the ones that changed.
+      //
+      Status = NVParamGet (
+                 Param,
+                 NV_PERM_ATF | NV_PERM_BIOS | NV_PERM_MANU | NV_PERM_BMC,
+                 &StoredValue
+                 );
+      if (!EFI_ERROR (Status) && StoredValue == Value) {
+        continue;
+      }
       Status = NVParamSet (
                  Param,
                  NV_PERM_ATF | NV_PERM_BIOS | NV_PERM_MANU | NV_PERM_BMC,
@@ -278,7 +278,16 @@ FlashWriteCommand (
 
   Remain = Length;
   while (Remain > 0) {
-    NumWrite = (Remain > EFI_MM_MAX_TMP_BUF_SIZE) ? EFI_MM_MAX_TMP_BUF_SIZE : Remain;
+    //
+    // At boot time the caller's buffer is passed through as-is, so many
+    // blocks can be written per call; at runtime each chunk is staged in
+    // the 4KB temp buffer.
+    //
+    if (gFlashLibRuntime) {
+      NumWrite = (Remain > EFI_MM_MAX_TMP_BUF_SIZE) ? EFI_MM_MAX_TMP_BUF_SIZE : Remain;
+    } else {
+      NumWrite = (Remain > EFI_MM_MAX_DIRECT_XFER_SIZE) ? EFI_MM_MAX_DIRECT_XFER_SIZE : Remain;
+    }
 
     MmData[0] = MM_SPINOR_FUNC_WRITE;
     MmData[1] = ByteAddress + Count;
@@ -338,12 +347,21 @@ FlashReadCommand (
 
   Remain = Length;
   while (Remain > 0) {
-    NumRead = (Remain > EFI_MM_MAX_TMP_BUF_SIZE) ? EFI_MM_MAX_TMP_BUF_SIZE : Remain;
-
     MmData[0] = MM_SPINOR_FUNC_READ;
     MmData[1] = ByteAddress + Count;
+    if (gFlashLibRuntime) {
+      NumRead = (Remain > EFI_MM_MAX_TMP_BUF_SIZE) ? EFI_MM_MAX_TMP_BUF_SIZE : Remain;
+      MmData[3] = (UINT64)gFlashLibPhysicalBuffer;  // Read data into the temp buffer with specified virtual address
+    } else {
+      //
+      // At boot time the destination buffer is identity mapped, so the
+      // secure firmware can transfer many blocks per call straight into
+      // it, without the temp buffer bounce and the extra copy.
+      //
+      NumRead = (Remain > EFI_MM_MAX_DIRECT_XFER_SIZE) ? EFI_MM_MAX_DIRECT_XFER_SIZE : Remain;
+      MmData[3] = (UINT64)(Buffer + Count);
+    }
     MmData[2] = NumRead;
-    MmData[3] = (UINT64)gFlashLibPhysicalBuffer;  // Read data into the temp buffer with specified virtual address
 
     Status = FlashMmCommunicate (
               MmData,
@@ -360,10 +378,13 @@ FlashReadCommand (
       return EFI_DEVICE_ERROR;
     }
 
-    //
-    // Get data from the virtual address of the temp buffer.
-    //
-    CopyMem ((VOID *)(Buffer + Count), (VOID *)gFlashLibVirtualBuffer, NumRead);
+    if (gFlashLibRuntime) {
+      //
+      // Get data from the virtual address of the temp buffer.
+      //
+      CopyMem ((VOID *)(Buffer + Count), (VOID *)gFlashLibVirtualBuffer, NumRead);
+    }
+
     Remain -= NumRead;
     Count += NumRead;
   }
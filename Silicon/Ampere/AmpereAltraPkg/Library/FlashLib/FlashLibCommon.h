@@ -12,6 +12,13 @@
 #define EFI_MM_MAX_TMP_BUF_SIZE           0x1000
 #define EFI_MM_MAX_PAYLOAD_SIZE           0x50
 
+//
+// Transfer cap for boot time requests, where the caller's buffer is
+// identity mapped and handed to the secure firmware directly instead of
+// being bounced through the 4KB temp buffer.
+//
+#define EFI_MM_MAX_DIRECT_XFER_SIZE       0x10000
+
 #define MM_SPINOR_FUNC_GET_INFO           0x00
 #define MM_SPINOR_FUNC_READ               0x01
 #define MM_SPINOR_FUNC_WRITE              0x02
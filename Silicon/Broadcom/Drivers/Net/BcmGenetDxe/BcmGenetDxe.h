@@ -12,6 +12,7 @@
 #define BCM_GENET_DXE_H__
 
 #include <Uefi.h>
+#include <Library/SnpPerfLib.h>
 #include <Library/UefiLib.h>
 #include <Protocol/BcmGenetPlatformDevice.h>
 #include <Protocol/AdapterInformation.h>
@@ -231,6 +232,8 @@ typedef struct {
   GENET_PHY_MODE                      PhyMode;
 
   UINTN                               RegBase;
+
+  SNP_PERF_STATS                      *PerfStats;
 } GENET_PRIVATE_DATA;
 
 extern EFI_COMPONENT_NAME_PROTOCOL            gGenetComponentName;
@@ -347,6 +350,12 @@ GenetDmaMapRxDescriptor (
   IN UINT8              DescIndex
   );
 
+VOID
+GenetDmaRearmRxDescriptor (
+  IN GENET_PRIVATE_DATA *Genet,
+  IN UINT8              DescIndex
+  );
+
 VOID
 GenetDmaUnmapRxDescriptor (
   IN GENET_PRIVATE_DATA *Genet,
@@ -359,6 +368,13 @@ GenetTxIntr (
   OUT VOID              **TxBuf
   );
 
+VOID
+EFIAPI
+GenetWaitForPacketNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
 UINT32
 GenetRxPending (
   IN  GENET_PRIVATE_DATA *Genet
@@ -160,6 +160,7 @@ GenetDriverBindingStart (
   Genet->Phy.Configure                 = GenetPhyConfigure;
   Genet->Phy.ResetAction               = GenetPhyResetAction;
   Genet->PhyMode                       = GENET_PHY_MODE_RGMII_RXID;
+  Genet->PerfStats                     = SnpPerfRegister ("BcmGenetDxe");
 
   EfiInitializeLock (&Genet->Lock, TPL_CALLBACK);
   CopyMem (&Genet->Snp, &gGenetSimpleNetworkTemplate, sizeof Genet->Snp);
@@ -203,6 +204,21 @@ GenetDriverBindingStart (
     goto FreeDevice;
   }
 
+  //
+  // Let consumers block on WaitForPacket instead of polling Receive ();
+  // the notify function checks the RX producer index on each wait/check.
+  //
+  Status = gBS->CreateEvent (EVT_NOTIFY_WAIT, TPL_NOTIFY,
+                  GenetWaitForPacketNotify, Genet,
+                  &Genet->Snp.WaitForPacket);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN,
+      "GenetDriverBindingStart: failed to create WaitForPacket event - %r\n",
+      Status));
+    gBS->CloseEvent (Genet->ExitBootServicesEvent);
+    goto FreeDevice;
+  }
+
   Status = gBS->InstallMultipleProtocolInterfaces (&ControllerHandle,
                   &gEfiSimpleNetworkProtocolGuid,       &Genet->Snp,
                   &gEfiAdapterInformationProtocolGuid,  &Genet->Aip,
@@ -222,6 +238,7 @@ GenetDriverBindingStart (
   return EFI_SUCCESS;
 
 FreeEvent:
+  gBS->CloseEvent (Genet->Snp.WaitForPacket);
   gBS->CloseEvent (Genet->ExitBootServicesEvent);
 FreeDevice:
   DEBUG ((DEBUG_WARN, "%a: Returning %r\n", __FUNCTION__, Status));
@@ -283,6 +300,9 @@ GenetDriverBindingStop (
     return Status;
   }
 
+  Status = gBS->CloseEvent (Genet->Snp.WaitForPacket);
+  ASSERT_EFI_ERROR (Status);
+
   Status = gBS->CloseEvent (Genet->ExitBootServicesEvent);
   ASSERT_EFI_ERROR (Status);
 
@@ -666,6 +666,29 @@ GenetDmaMapRxDescriptor (
   return EFI_SUCCESS;
 }
 
+/**
+  Given an RX buffer descriptor index, hand the buffer back to the hardware
+  without touching its DMA mapping.
+
+  The buffer address programmed at map time never changes, so rearming a
+  consumed descriptor only needs the status word cleared; the per-frame
+  DmaUnmap/DmaMap pair is not required.
+
+  @param  Genet[in]      Pointer to GENET_PRIVATE_DATA.
+  @param  DescIndex[in]  Index of RX buffer descriptor.
+
+**/
+VOID
+GenetDmaRearmRxDescriptor (
+  IN GENET_PRIVATE_DATA * Genet,
+  IN UINT8                DescIndex
+  )
+{
+  ASSERT (Genet->RxBufferMap[DescIndex].Mapping != NULL);
+
+  GenetMmioWrite (Genet, GENET_RX_DESC_STATUS (DescIndex), 0);
+}
+
 /**
   Given an RX buffer descriptor index, undo the DmaMap operation on the buffer.
 
@@ -768,6 +791,41 @@ GenetTxIntr (
   }
 }
 
+/**
+  Notify function for the WaitForPacket event.
+
+  Runs whenever the event is checked or waited on and signals it as soon as
+  the hardware has produced a frame. This gives consumers an event driven
+  receive wakeup with a single MMIO read of the latched producer index,
+  instead of calling Receive () at a fixed poll period.
+
+  @param[in]  Event    The WaitForPacket event.
+  @param[in]  Context  Pointer to the GENET driver private data.
+
+**/
+VOID
+EFIAPI
+GenetWaitForPacketNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  GENET_PRIVATE_DATA *Genet;
+  UINT32             ProdIndex;
+
+  Genet = Context;
+
+  if (Genet->SnpMode.State != EfiSimpleNetworkInitialized) {
+    return;
+  }
+
+  ProdIndex = GenetMmioRead (Genet,
+                GENET_RX_DMA_PROD_INDEX (GENET_DMA_DEFAULT_QUEUE)) & 0xFFFF;
+  if (ProdIndex != Genet->RxConsIndex) {
+    gBS->SignalEvent (Event);
+  }
+}
+
 UINT32
 GenetRxPending (
   IN  GENET_PRIVATE_DATA *Genet
@@ -10,6 +10,7 @@
 
 #include <Uefi.h>
 #include <Library/BaseMemoryLib.h>
+#include <Library/CacheMaintenanceLib.h>
 #include <Library/DebugLib.h>
 #include <Library/DmaLib.h>
 #include <Library/NetLib.h>
@@ -759,10 +760,17 @@ GenetSimpleNetworkReceive (
 
   ASSERT (Genet->RxBufferMap[DescIndex].Mapping != NULL);
 
-  GenetDmaUnmapRxDescriptor (Genet, DescIndex);
-
   Frame = GENET_RX_BUFFER (Genet, DescIndex);
 
+  //
+  // The descriptor mapping stays in place for the life of the interface;
+  // the CPU only ever reads the buffer, so making the DMA data visible
+  // just needs the received bytes invalidated (speculation may have
+  // pulled stale lines in since the descriptor was armed). Buffers are a
+  // whole number of cache lines apart, so this cannot touch a neighbour.
+  //
+  InvalidateDataCacheRange (Frame, FrameLength);
+
   if (FrameLength > 2 + Genet->SnpMode.MediaHeaderSize) {
     // Received frame has 2 bytes of padding at the start
     Frame += 2;
@@ -800,10 +808,7 @@ GenetSimpleNetworkReceive (
   }
 
 out:
-  Status = GenetDmaMapRxDescriptor (Genet, DescIndex);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a: Failed to remap RX descriptor!\n", __FUNCTION__));
-  }
+  GenetDmaRearmRxDescriptor (Genet, DescIndex);
 
   GenetRxComplete (Genet);
 
@@ -811,6 +816,94 @@ out:
   return Status;
 }
 
+/**
+  Performance accounting wrapper around GenetSimpleNetworkTransmit(),
+  recording packet and byte counts, ring-full rejections and the time
+  spent in the call.
+
+  See GenetSimpleNetworkTransmit() for the parameter and return value
+  documentation.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+GenetSimpleNetworkTransmitTimed (
+  IN EFI_SIMPLE_NETWORK_PROTOCOL *This,
+  IN UINTN                       HeaderSize,
+  IN UINTN                       BufferSize,
+  IN VOID                        *Buffer,
+  IN EFI_MAC_ADDRESS             *SrcAddr,  OPTIONAL
+  IN EFI_MAC_ADDRESS             *DestAddr, OPTIONAL
+  IN UINT16                      *Protocol  OPTIONAL
+  )
+{
+  SNP_PERF_STATS      *Stats;
+  EFI_STATUS          Status;
+  UINT64              Start;
+
+  Start = SnpPerfTimestamp ();
+  Status = GenetSimpleNetworkTransmit (This, HeaderSize, BufferSize, Buffer,
+             SrcAddr, DestAddr, Protocol);
+
+  if (This != NULL) {
+    Stats = GENET_PRIVATE_DATA_FROM_SNP_THIS (This)->PerfStats;
+    SnpPerfAddElapsed (&Stats->TxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->TxPackets++;
+      Stats->TxBytes += BufferSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->TxRingFull++;
+    }
+  }
+
+  return Status;
+}
+
+/**
+  Performance accounting wrapper around GenetSimpleNetworkReceive(),
+  recording packet and byte counts, empty polls and the time spent in
+  the call.
+
+  See GenetSimpleNetworkReceive() for the parameter and return value
+  documentation.
+
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+GenetSimpleNetworkReceiveTimed (
+  IN     EFI_SIMPLE_NETWORK_PROTOCOL *This,
+  OUT    UINTN                       *HeaderSize, OPTIONAL
+  IN OUT UINTN                       *BufferSize,
+  OUT    VOID                        *Buffer,
+  OUT    EFI_MAC_ADDRESS             *SrcAddr,    OPTIONAL
+  OUT    EFI_MAC_ADDRESS             *DestAddr,   OPTIONAL
+  OUT    UINT16                      *Protocol    OPTIONAL
+  )
+{
+  SNP_PERF_STATS      *Stats;
+  EFI_STATUS          Status;
+  UINT64              Start;
+
+  Start = SnpPerfTimestamp ();
+  Status = GenetSimpleNetworkReceive (This, HeaderSize, BufferSize, Buffer,
+             SrcAddr, DestAddr, Protocol);
+
+  if (This != NULL) {
+    Stats = GENET_PRIVATE_DATA_FROM_SNP_THIS (This)->PerfStats;
+    SnpPerfAddElapsed (&Stats->RxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->RxPackets++;
+      Stats->RxBytes += *BufferSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->RxPollEmpty++;
+    }
+  }
+
+  return Status;
+}
+
 /**
   This function converts a multicast IP address to a multicast HW MAC address
   for all packet transactions.
@@ -859,8 +952,8 @@ CONST EFI_SIMPLE_NETWORK_PROTOCOL gGenetSimpleNetworkTemplate = {
   GenetSimpleNetworkMCastIPtoMAC,             // MCastIpToMac
   GenetSimpleNetworkNvData,                   // NvData
   GenetSimpleNetworkGetStatus,                // GetStatus
-  GenetSimpleNetworkTransmit,                 // Transmit
-  GenetSimpleNetworkReceive,                  // Receive
+  GenetSimpleNetworkTransmitTimed,            // Transmit
+  GenetSimpleNetworkReceiveTimed,             // Receive
   NULL,                                       // WaitForPacket
   NULL                                        // Mode
 };
@@ -0,0 +1,79 @@
+/** @file
+  Layout of the SNP performance statistics configuration table.
+
+  SnpPerfLib installs a single SNP_PERF_TABLE as an EFI configuration
+  table under gSnpPerfTableGuid. Each instrumented driver owns one
+  SNP_PERF_STATS entry; an external tool locates the table through the
+  system table and dumps the counters without any driver cooperation.
+
+  Copyright (c) 2026, ARM Limited. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef SNP_PERF_TABLE_H__
+#define SNP_PERF_TABLE_H__
+
+#define SNP_PERF_TABLE_GUID \
+  { 0x36e58c08, 0x14ed, 0x4a6f, { 0x8c, 0x83, 0x36, 0xaa, 0x3b, 0x0e, 0xc0, 0xe4 }}
+
+#define SNP_PERF_TABLE_REVISION   1
+
+#define SNP_PERF_MAX_ENTRIES      8
+#define SNP_PERF_NAME_LENGTH      16
+
+//
+// Counters of one instrumented SNP driver instance. Tick counts are in
+// units of the performance counter whose rate is given by the table's
+// TicksPerSecond field.
+//
+typedef struct {
+  //
+  // NUL terminated driver name, e.g. "Pp2Dxe".
+  //
+  CHAR8     Name[SNP_PERF_NAME_LENGTH];
+  //
+  // Frames accepted by Transmit() and their cumulative length.
+  //
+  UINT64    TxPackets;
+  UINT64    TxBytes;
+  //
+  // Ticks spent inside Transmit(), including failed calls.
+  //
+  UINT64    TxTicks;
+  //
+  // Transmit() calls rejected with EFI_NOT_READY, i.e. the TX
+  // descriptor ring was full.
+  //
+  UINT64    TxRingFull;
+  //
+  // Frames delivered by Receive() and their cumulative length.
+  //
+  UINT64    RxPackets;
+  UINT64    RxBytes;
+  //
+  // Ticks spent inside Receive(), including empty polls.
+  //
+  UINT64    RxTicks;
+  //
+  // Receive() calls that returned EFI_NOT_READY because no frame was
+  // pending.
+  //
+  UINT64    RxPollEmpty;
+} SNP_PERF_STATS;
+
+typedef struct {
+  UINT32            Revision;
+  UINT32            EntryCount;
+  //
+  // Rate of the performance counter backing the tick fields, as
+  // reported by the TimerLib of the registering driver.
+  //
+  UINT64            TicksPerSecond;
+  SNP_PERF_STATS    Entry[SNP_PERF_MAX_ENTRIES];
+} SNP_PERF_TABLE;
+
+extern EFI_GUID gSnpPerfTableGuid;
+
+#endif // SNP_PERF_TABLE_H__
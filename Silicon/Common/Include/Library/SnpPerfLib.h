@@ -0,0 +1,68 @@
+/** @file
+  Performance instrumentation for SNP network drivers.
+
+  A driver registers one entry per interface and bumps its counters from
+  the Transmit() and Receive() paths. All entries live in a single
+  configuration table (see Guid/SnpPerfTable.h) shared by every driver
+  linking this library, so one dump shows all interfaces side by side.
+
+  Copyright (c) 2026, ARM Limited. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef SNP_PERF_LIB_H__
+#define SNP_PERF_LIB_H__
+
+#include <Guid/SnpPerfTable.h>
+
+/**
+  Register one SNP driver instance for performance accounting.
+
+  The first registration in the system allocates the statistics table
+  and installs it as a configuration table; later registrations append
+  to it. On any failure a private scratch entry outside the table is
+  returned so callers can update counters unconditionally.
+
+  @param[in]  Name  NUL terminated driver name; truncated to
+                    SNP_PERF_NAME_LENGTH - 1 characters.
+
+  @return  The entry to account this instance against. Never NULL.
+
+**/
+SNP_PERF_STATS *
+EFIAPI
+SnpPerfRegister (
+  IN CONST CHAR8  *Name
+  );
+
+/**
+  Read the performance counter for use with SnpPerfAddElapsed().
+
+  @return  The current performance counter value.
+
+**/
+UINT64
+EFIAPI
+SnpPerfTimestamp (
+  VOID
+  );
+
+/**
+  Add the ticks elapsed since StartTimestamp to a tick accumulator,
+  taking the count direction of the performance counter into account.
+
+  @param[in, out] Accumulator     Tick counter to add the elapsed time to.
+  @param[in]      StartTimestamp  Value returned by SnpPerfTimestamp() at
+                                  the start of the measured interval.
+
+**/
+VOID
+EFIAPI
+SnpPerfAddElapsed (
+  IN OUT UINT64  *Accumulator,
+  IN     UINT64  StartTimestamp
+  );
+
+#endif // SNP_PERF_LIB_H__
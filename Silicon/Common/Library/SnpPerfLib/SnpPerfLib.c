@@ -0,0 +1,115 @@
+/** @file
+  Performance instrumentation for SNP network drivers.
+
+  Copyright (c) 2026, ARM Limited. All rights reserved.<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+
+#include <Library/BaseLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/SnpPerfLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
+
+//
+// Each driver linking this library gets its own copy of these globals,
+// but the table they point at is shared through the configuration table.
+//
+STATIC SNP_PERF_TABLE   *mSnpPerfTable;
+STATIC BOOLEAN          mCounterCountsDown;
+
+//
+// Fallback entry handed out when the table cannot be installed or is
+// full, so callers never have to check for registration failure.
+//
+STATIC SNP_PERF_STATS   mSnpPerfScratch;
+
+SNP_PERF_STATS *
+EFIAPI
+SnpPerfRegister (
+  IN CONST CHAR8  *Name
+  )
+{
+  EFI_STATUS      Status;
+  SNP_PERF_STATS  *Stats;
+  UINT64          StartValue;
+  UINT64          EndValue;
+
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+  mCounterCountsDown = (BOOLEAN)(StartValue > EndValue);
+
+  if (mSnpPerfTable == NULL) {
+    //
+    // Another driver may have installed the table already; append to it
+    // rather than replacing it.
+    //
+    Status = EfiGetSystemConfigurationTable (&gSnpPerfTableGuid,
+               (VOID **)&mSnpPerfTable);
+    if (EFI_ERROR (Status)) {
+      mSnpPerfTable = AllocateZeroPool (sizeof (SNP_PERF_TABLE));
+      if (mSnpPerfTable == NULL) {
+        return &mSnpPerfScratch;
+      }
+
+      mSnpPerfTable->Revision = SNP_PERF_TABLE_REVISION;
+      mSnpPerfTable->TicksPerSecond =
+        GetPerformanceCounterProperties (NULL, NULL);
+
+      Status = gBS->InstallConfigurationTable (&gSnpPerfTableGuid,
+                      mSnpPerfTable);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_WARN,
+          "%a: failed to install SNP perf table - %r\n", __FUNCTION__,
+          Status));
+        FreePool (mSnpPerfTable);
+        mSnpPerfTable = NULL;
+        return &mSnpPerfScratch;
+      }
+    }
+  }
+
+  if (mSnpPerfTable->EntryCount >= SNP_PERF_MAX_ENTRIES) {
+    DEBUG ((DEBUG_WARN, "%a: SNP perf table full, dropping '%a'\n",
+      __FUNCTION__, Name));
+    return &mSnpPerfScratch;
+  }
+
+  Stats = &mSnpPerfTable->Entry[mSnpPerfTable->EntryCount];
+  AsciiStrnCpyS (Stats->Name, SNP_PERF_NAME_LENGTH, Name,
+    SNP_PERF_NAME_LENGTH - 1);
+  mSnpPerfTable->EntryCount++;
+
+  return Stats;
+}
+
+UINT64
+EFIAPI
+SnpPerfTimestamp (
+  VOID
+  )
+{
+  return GetPerformanceCounter ();
+}
+
+VOID
+EFIAPI
+SnpPerfAddElapsed (
+  IN OUT UINT64  *Accumulator,
+  IN     UINT64  StartTimestamp
+  )
+{
+  UINT64  Now;
+
+  Now = GetPerformanceCounter ();
+  if (mCounterCountsDown) {
+    *Accumulator += StartTimestamp - Now;
+  } else {
+    *Accumulator += Now - StartTimestamp;
+  }
+}
@@ -171,15 +171,19 @@ AcpiPlatformEntryPoint (
   EFI_FIRMWARE_VOLUME2_PROTOCOL  *FwVol;
   INTN                           Instance;
   EFI_ACPI_COMMON_HEADER         *CurrentTable;
+  EFI_ACPI_COMMON_HEADER         *NextTable;
   UINTN                          TableHandle;
   UINT32                         FvStatus;
   UINTN                          TableSize;
   UINTN                          Size;
+  UINTN                          NextSize;
   EFI_STATUS                     TableStatus;
+  EFI_STATUS                     NextStatus;
   EFI_ACPI_DESCRIPTION_HEADER    *TableHeader;
 
   Instance     = 0;
   CurrentTable = NULL;
+  NextTable    = NULL;
   TableHandle  = 0;
 
   //
@@ -198,64 +202,82 @@ AcpiPlatformEntryPoint (
     return EFI_ABORTED;
   }
   //
-  // Read tables from the storage file.
+  // Read tables from the storage file, keeping the section read one table
+  // ahead of the patch/checksum/install stage so the FV driver can start
+  // satisfying the next read while the current table is being published.
   //
+  Status = FwVol->ReadSection (
+                    FwVol,
+                    (EFI_GUID*)PcdGetPtr (PcdAcpiTableStorageFile),
+                    EFI_SECTION_RAW,
+                    Instance,
+                    (VOID**) &CurrentTable,
+                    &Size,
+                    &FvStatus
+                    );
   while (Status == EFI_SUCCESS) {
+    //
+    // Issue the read for the next table before touching the current one.
+    //
+    Instance++;
+    NextStatus = FwVol->ReadSection (
+                          FwVol,
+                          (EFI_GUID*)PcdGetPtr (PcdAcpiTableStorageFile),
+                          EFI_SECTION_RAW,
+                          Instance,
+                          (VOID**) &NextTable,
+                          &NextSize,
+                          &FvStatus
+                          );
+
+    //
+    // Add the table
+    //
+    TableHeader = (EFI_ACPI_DESCRIPTION_HEADER*) (CurrentTable);
+    //Update specfic Acpi Table
+    //If the Table is updated failed, doesn't install it,
+    //go to find next section.
+    TableStatus = UpdateAcpiTable(TableHeader);
+    if (TableStatus == EFI_SUCCESS) {
+      TableHandle = 0;
+
+      TableSize = ((EFI_ACPI_DESCRIPTION_HEADER *) CurrentTable)->Length;
+      ASSERT (Size >= TableSize);
 
-    Status = FwVol->ReadSection (
-                      FwVol,
-                      (EFI_GUID*)PcdGetPtr (PcdAcpiTableStorageFile),
-                      EFI_SECTION_RAW,
-                      Instance,
-                      (VOID**) &CurrentTable,
-                      &Size,
-                      &FvStatus
-                      );
-    if (!EFI_ERROR(Status)) {
       //
-      // Add the table
+      // Checksum ACPI table
       //
-      TableHeader = (EFI_ACPI_DESCRIPTION_HEADER*) (CurrentTable);
-      //Update specfic Acpi Table
-      //If the Table is updated failed, doesn't install it,
-      //go to find next section.
-      TableStatus = UpdateAcpiTable(TableHeader);
-      if (TableStatus == EFI_SUCCESS) {
-        TableHandle = 0;
-
-        TableSize = ((EFI_ACPI_DESCRIPTION_HEADER *) CurrentTable)->Length;
-        ASSERT (Size >= TableSize);
-
-        //
-        // Checksum ACPI table
-        //
-        AcpiPlatformChecksum ((UINT8*)CurrentTable, TableSize);
-
-        //
-        // Install ACPI table
-        //
-        Status = AcpiTable->InstallAcpiTable (
-                              AcpiTable,
-                              CurrentTable,
-                              TableSize,
-                              &TableHandle
-                              );
-      }
+      AcpiPlatformChecksum ((UINT8*)CurrentTable, TableSize);
+
       //
-      // Free memory allocated by ReadSection
+      // Install ACPI table
       //
-      gBS->FreePool (CurrentTable);
+      Status = AcpiTable->InstallAcpiTable (
+                            AcpiTable,
+                            CurrentTable,
+                            TableSize,
+                            &TableHandle
+                            );
+    }
+    //
+    // Free memory allocated by ReadSection
+    //
+    gBS->FreePool (CurrentTable);
 
-      if (EFI_ERROR(Status)) {
-        return EFI_ABORTED;
+    if (EFI_ERROR(Status)) {
+      if (!EFI_ERROR(NextStatus)) {
+        gBS->FreePool (NextTable);
       }
-
-      //
-      // Increment the instance
-      //
-      Instance++;
-      CurrentTable = NULL;
+      return EFI_ABORTED;
     }
+
+    //
+    // Hand the prefetched table to the next iteration
+    //
+    CurrentTable = NextTable;
+    Size         = NextSize;
+    Status       = NextStatus;
+    NextTable    = NULL;
   }
 
   Status = gBS->InstallProtocolInterface (
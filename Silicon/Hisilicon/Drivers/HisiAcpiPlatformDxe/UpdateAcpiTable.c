@@ -64,6 +64,16 @@ IsIortWithSmmu (
   return FALSE;
 }
 
+//
+// The storage file carries one IORT candidate per SMMU configuration.
+// The wanted variant is computed once from the OemConfig variable, and
+// once it has been accepted the remaining candidates are rejected
+// without walking their node lists.
+//
+STATIC BOOLEAN mIortVariantKnown = FALSE;
+STATIC BOOLEAN mIortWithSmmuWanted = FALSE;
+STATIC BOOLEAN mIortSelected = FALSE;
+
 EFI_STATUS
 SelectIort (
   IN EFI_ACPI_DESCRIPTION_HEADER      *TableHeader
@@ -73,31 +83,35 @@ SelectIort (
   UINTN               Size;
   OEM_CONFIG_DATA     Configuration;
 
-  Configuration.EnableSmmu = 0;
-  Size = sizeof (OEM_CONFIG_DATA);
-  Status = gRT->GetVariable (
-                  OEM_CONFIG_NAME,
-                  &gOemConfigGuid,
-                  NULL,
-                  &Size,
-                  &Configuration
-                  );
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "Get OemConfig variable (%r).\n", Status));
+  if (mIortSelected) {
+    return EFI_ABORTED;
   }
 
-  Status =  EFI_SUCCESS;
-  if (IsIortWithSmmu (TableHeader)) {
-    if (!Configuration.EnableSmmu) {
-      Status = EFI_ABORTED;
+  if (!mIortVariantKnown) {
+    Configuration.EnableSmmu = 0;
+    Size = sizeof (OEM_CONFIG_DATA);
+    Status = gRT->GetVariable (
+                    OEM_CONFIG_NAME,
+                    &gOemConfigGuid,
+                    NULL,
+                    &Size,
+                    &Configuration
+                    );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Get OemConfig variable (%r).\n", Status));
     }
+    mIortWithSmmuWanted = (BOOLEAN)(Configuration.EnableSmmu != 0);
+    mIortVariantKnown = TRUE;
+  }
+
+  if (IsIortWithSmmu (TableHeader) == mIortWithSmmuWanted) {
+    mIortSelected = TRUE;
+    Status = EFI_SUCCESS;
   } else {
-    if (Configuration.EnableSmmu) {
-      Status = EFI_ABORTED;
-    }
+    Status = EFI_ABORTED;
   }
   DEBUG ((DEBUG_INFO, "SmmuEnable=%x, return %r for Iort table.\n",
-          Configuration.EnableSmmu, Status));
+          mIortWithSmmuWanted, Status));
 
   return Status;
 }
@@ -442,10 +442,41 @@ EFIAPI Erase(
         Length -= TempLength;
     }
 
+    DEBUG ((EFI_D_INFO, "[%a]:NOR totals this boot: %d programs %ldus, %d erases %ldus\n",
+            __FUNCTION__, gFlashProgramCount, gFlashProgramTimeUs, gFlashEraseCount, gFlashEraseTimeUs));
+
     return Status;
 }
 
 
+static BOOLEAN CanProgramWithoutErase(
+    IN  UINT32       Base,
+    IN  UINT32       Offset,
+    IN  UINT8       *Buffer,
+    IN  UINT32       Length
+  )
+{
+    UINTN NewAddr = Base + Offset;
+    UINT8 FlashData = 0;
+    UINT8 BufferData = 0;
+
+    for(; Length > 0; Length --)
+    {
+        BufferData = *Buffer;
+        //lint -epn -e511
+        FlashData = *(UINT8 *)NewAddr;
+        if ((FlashData & BufferData) != BufferData)
+        {
+            return FALSE;
+        }
+        NewAddr ++;
+        Buffer ++;
+    }
+
+    return TRUE;
+}
+
+
 EFI_STATUS
 EFIAPI Write(
   IN UNI_NOR_FLASH_PROTOCOL   *This,
@@ -495,11 +526,16 @@ EFIAPI Write(
 
         if (TRUE == IsNeedToWrite(TempBase, Offset, Buffer, TempLength))
         {
-            Status = FlashSectorErase(TempBase, Offset, TempLength);
-            if (EFI_ERROR(Status))
+            //NOR programming only clears bits: when no bit goes back to 1 the new
+            //data is programmed in place and the slow sector erase is skipped
+            if (FALSE == CanProgramWithoutErase(TempBase, Offset, Buffer, TempLength))
             {
-                DEBUG ((EFI_D_ERROR, "[%a]:[%dL]:FlashErase One Sector Error, Status = %r!\n", __FUNCTION__,__LINE__,Status));
-                return Status;
+                Status = FlashSectorErase(TempBase, Offset, TempLength);
+                if (EFI_ERROR(Status))
+                {
+                    DEBUG ((EFI_D_ERROR, "[%a]:[%dL]:FlashErase One Sector Error, Status = %r!\n", __FUNCTION__,__LINE__,Status));
+                    return Status;
+                }
             }
 
 
@@ -523,6 +559,9 @@ EFIAPI Write(
         ulLength -= TempLength;
     }
 
+    DEBUG ((EFI_D_INFO, "[%a]:NOR totals this boot: %d programs %ldus, %d erases %ldus\n",
+            __FUNCTION__, gFlashProgramCount, gFlashProgramTimeUs, gFlashEraseCount, gFlashEraseTimeUs));
+
     return EFI_SUCCESS;
 }
 
@@ -24,6 +24,17 @@ FLASH_INDEX gIndex = {
     0
 };
 
+//
+// Cumulative program/erase accounting for this boot. The protocol layer
+// reports the totals so slow variable traffic shows up in the log.
+//
+UINT32 gFlashProgramCount = 0;
+UINT64 gFlashProgramTimeUs = 0;
+UINT32 gFlashEraseCount = 0;
+UINT64 gFlashEraseTimeUs = 0;
+
+static UINT32 gLastWaitUs = 0;
+
 
 UINT32 PortReadData (
     UINT32 Index,
@@ -378,7 +389,10 @@ EFI_STATUS BufferWriteCommand(UINTN Base, UINTN Offset, void *pData)
 
     }
 
-    (void)gBS->Stall(200);
+    //
+    // No fixed wait here: CompleteCheck polls the readback until the
+    // embedded program algorithm finishes.
+    //
 
     gFlashBusy = FALSE;
     return EFI_SUCCESS;
@@ -416,7 +430,10 @@ EFI_STATUS SectorEraseCommand(UINTN Base, UINTN Offset)
     dwAddr = (UINT32)Base + Offset;
     (VOID)PortWriteData(gIndex.InfIndex, dwAddr, gFlashCommandErase[gIndex.EIndex].SectorEraseDataStep6);
 
-    (void)gBS->Stall(500000);
+    //
+    // No fixed wait here either: a typical sector finishes well before the
+    // former worst case 500ms stall, CompleteCheck polls it out.
+    //
 
     gFlashBusy = FALSE;
     return EFI_SUCCESS;
@@ -431,6 +448,7 @@ EFI_STATUS CompleteCheck(UINT32 Base, UINT32 Offset, void *pData, UINT32 Length)
     UINT32 dwTemp1 = 0;
     UINT32 i;
     UINT32 dwTimeOut = 3000000;
+    UINT32 dwElapsed = 0;
 
     if(gFlashBusy)
     {
@@ -453,12 +471,14 @@ EFI_STATUS CompleteCheck(UINT32 Base, UINT32 Offset, void *pData, UINT32 Length)
                 dwTemp1 = MmioRead32 (dwTestAddr);
                 if ((dwTemp == dwTemp1) && (dwTestData == dwTemp1))
                 {
+                    gLastWaitUs = dwElapsed;
                     gFlashBusy = FALSE;
                     return EFI_SUCCESS;
                 }
             }
 
             (void)gBS->Stall(1);
+            dwElapsed ++;
         }
 
         if((UINT16)(dwTemp1 >> 16) != (UINT16)(dwTestData >> 16))
@@ -484,12 +504,14 @@ EFI_STATUS CompleteCheck(UINT32 Base, UINT32 Offset, void *pData, UINT32 Length)
                 dwTemp1 = MmioRead16 (dwTestAddr);
                 if ((dwTemp == dwTemp1) && (dwTestData == dwTemp1))
                 {
+                    gLastWaitUs = dwElapsed;
                     gFlashBusy = FALSE;
                     return EFI_SUCCESS;
                 }
             }
 
             (void)gBS->Stall(1);
+            dwElapsed ++;
         }
     }
 
@@ -500,6 +522,7 @@ EFI_STATUS CompleteCheck(UINT32 Base, UINT32 Offset, void *pData, UINT32 Length)
 
     FlashReset(Base);
 
+    gLastWaitUs = dwElapsed;
     gFlashBusy = FALSE;
     DEBUG((EFI_D_ERROR, "CompleteCheck ERROR: timeout address %x, buffer %x, flash %x\n", Offset, dwTestData, dwTemp1));
     return EFI_TIMEOUT;
@@ -549,6 +572,8 @@ EFI_STATUS BufferWrite(UINT32 Offset, void *pData, UINT32 Length)
         (void)BufferWriteCommand(gIndex.Base, Offset, pData);
         Status = CompleteCheck(gIndex.Base, Offset, pData, Length);
 
+        gFlashProgramCount ++;
+        gFlashProgramTimeUs += gLastWaitUs;
 
         if (EFI_SUCCESS == Status)
         {
@@ -590,6 +615,8 @@ EFI_STATUS SectorErase(UINT32 Base, UINT32 Offset)
         (void)SectorEraseCommand(Base, Offset);
         Status = CompleteCheck(Base, Offset, (void *)gTemp, FLASH_MAX_UNIT);
 
+        gFlashEraseCount ++;
+        gFlashEraseTimeUs += gLastWaitUs;
 
         if (EFI_SUCCESS == Status)
         {
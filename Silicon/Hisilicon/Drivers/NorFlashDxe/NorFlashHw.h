@@ -99,6 +99,11 @@ extern EFI_STATUS BufferWrite(UINT32 Offset, void *pData, UINT32 Length);
 extern EFI_STATUS IsNeedToWrite(UINT32 Base, UINT32 Offset, UINT8 *Buffer, UINT32 Length);
 
 
+extern UINT32 gFlashProgramCount;
+extern UINT64 gFlashProgramTimeUs;
+extern UINT32 gFlashEraseCount;
+extern UINT64 gFlashEraseTimeUs;
+
 extern NOR_FLASH_INFO_TABLE gFlashInfo[FLASH_DEVICE_NUM];
 extern FLASH_COMMAND_RESET gFlashCommandReset[FLASH_DEVICE_NUM];
 extern FLASH_COMMAND_ID gFlashCommandId[FLASH_DEVICE_NUM];
@@ -9,6 +9,7 @@
 
 #include <Uefi.h>
 #include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 #include <Library/DebugLib.h>
 #include <Library/BaseLib.h>
 #include <Library/UefiLib.h>
@@ -61,8 +62,39 @@ typedef struct {
   VOID                    *RomBase;
 } OPTION_ROM_INFO;
 
+//
+// Enumeration hint store. The post-enumeration BAR assignments are persisted
+// in a non-volatile variable keyed by a hash of the device topology, so on
+// stable topologies the platform hooks can reuse the prior boot's assignments
+// instead of deriving everything from zero again.
+//
+#define PCI_ENUM_HINT_VARIABLE_NAME L"PciEnumHints"
+#define PCI_ENUM_HINT_SIGNATURE     SIGNATURE_32 ('P', 'E', 'H', '0')
+#define PCI_ENUM_HINT_BAR_COUNT     6
+
+STATIC CONST EFI_GUID mPciEnumHintGuid = \
+  { 0x8c4f9d21, 0x6e35, 0x47aa, {0x8b, 0x91, 0x2f, 0xd0, 0x43, 0x7c, 0x15, 0xe6}};
+
+typedef struct {
+  UINT32  SegBusDevFunc;  // Segment[31:24] Bus[23:16] Device[15:8] Function[7:0]
+  UINT32  VendorDevice;   // DeviceId[31:16] VendorId[15:0]
+  UINT32  Bar[PCI_ENUM_HINT_BAR_COUNT];
+} PCI_ENUM_HINT_ENTRY;
+
+typedef struct {
+  UINT32               Signature;
+  UINT32               TopologyHash;
+  UINT32               DeviceCount;
+  PCI_ENUM_HINT_ENTRY  Entry[1];
+} PCI_ENUM_HINT_STORE;
+
 PCI_PLATFORM_PRIVATE_DATA *mPciPrivateData = NULL;
 
+//
+// Hint store persisted by the previous boot, NULL when absent or malformed
+//
+STATIC PCI_ENUM_HINT_STORE *mStoredHints = NULL;
+
 PCI_OPTION_ROM_TABLE      mPciOptionRomTable[] = {
   {
     SAS_OPTION_ROM_FILE_GUID,
@@ -396,6 +428,255 @@ Returns:
   return EFI_SUCCESS;
 }
 
+#define PCI_ENUM_HINT_STORE_SIZE(Count) \
+  (OFFSET_OF (PCI_ENUM_HINT_STORE, Entry) + \
+   (Count) * sizeof (PCI_ENUM_HINT_ENTRY))
+
+VOID
+LoadEnumerationHints (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Load the hint store persisted by the previous boot into mStoredHints.
+  A missing or malformed variable simply leaves mStoredHints NULL; the
+  store is rebuilt at the end of this boot's enumeration.
+
+Arguments:
+
+Returns:
+
+  VOID.
+
+--*/
+{
+  EFI_STATUS          Status;
+  UINTN               DataSize;
+  PCI_ENUM_HINT_STORE *Store;
+
+  DataSize = 0;
+  Status = gRT->GetVariable (
+                  PCI_ENUM_HINT_VARIABLE_NAME,
+                  (EFI_GUID *)&mPciEnumHintGuid,
+                  NULL,
+                  &DataSize,
+                  NULL
+                  );
+  if (Status != EFI_BUFFER_TOO_SMALL) {
+    return;
+  }
+
+  Store = AllocatePool (DataSize);
+  if (Store == NULL) {
+    return;
+  }
+
+  Status = gRT->GetVariable (
+                  PCI_ENUM_HINT_VARIABLE_NAME,
+                  (EFI_GUID *)&mPciEnumHintGuid,
+                  NULL,
+                  &DataSize,
+                  Store
+                  );
+  if (EFI_ERROR (Status)
+      || (DataSize < PCI_ENUM_HINT_STORE_SIZE (0))
+      || (Store->Signature != PCI_ENUM_HINT_SIGNATURE)
+      || (DataSize != PCI_ENUM_HINT_STORE_SIZE (Store->DeviceCount))) {
+    FreePool (Store);
+    return;
+  }
+
+  mStoredHints = Store;
+}
+
+BOOLEAN
+EFIAPI
+PciPlatformQueryEnumHint (
+  IN  UINTN   Segment,
+  IN  UINTN   Bus,
+  IN  UINTN   Device,
+  IN  UINTN   Function,
+  OUT UINT32  Bar[PCI_ENUM_HINT_BAR_COUNT]
+  )
+/*++
+
+Routine Description:
+
+  Look up the BAR assignments recorded for a device by the previous boot.
+  Intended for the PciPlatformLib hooks, which can preload apertures for
+  a known-stable topology instead of waiting for the sizing probes.
+
+Arguments:
+
+  Segment   -  Segment of the device to look up.
+  Bus       -  Bus of the device to look up.
+  Device    -  Device number of the device to look up.
+  Function  -  Function of the device to look up.
+  Bar       -  Receives the recorded BAR values on success.
+
+Returns:
+
+  TRUE if a hint was recorded for the device, FALSE otherwise.
+
+--*/
+{
+  UINT32  SegBusDevFunc;
+  UINT32  Index;
+
+  if (mStoredHints == NULL) {
+    return FALSE;
+  }
+
+  SegBusDevFunc = (UINT32)((Segment << 24) | (Bus << 16) | (Device << 8) | Function);
+  for (Index = 0; Index < mStoredHints->DeviceCount; Index++) {
+    if (mStoredHints->Entry[Index].SegBusDevFunc == SegBusDevFunc) {
+      CopyMem (
+        Bar,
+        mStoredHints->Entry[Index].Bar,
+        sizeof (mStoredHints->Entry[Index].Bar)
+        );
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+VOID
+CaptureEnumerationHints (
+  VOID
+  )
+/*++
+
+Routine Description:
+
+  Snapshot the enumerated topology and BAR assignments, hash the device
+  identities and refresh the persisted hint store when anything changed.
+  On the stable topologies this avoids a variable write on every boot.
+
+Arguments:
+
+Returns:
+
+  VOID.
+
+--*/
+{
+  EFI_STATUS          Status;
+  EFI_HANDLE          *HandleBuffer;
+  UINTN               HandleCount;
+  UINTN               Index;
+  UINTN               Segment;
+  UINTN               Bus;
+  UINTN               Device;
+  UINTN               Function;
+  EFI_PCI_IO_PROTOCOL *PciIo;
+  PCI_ENUM_HINT_STORE *Store;
+  PCI_ENUM_HINT_ENTRY *Entry;
+  UINT64              *Identities;
+  UINT32              Hash;
+  UINTN               StoreSize;
+
+  Status = gBS->LocateHandleBuffer (
+                  ByProtocol,
+                  &gEfiPciIoProtocolGuid,
+                  NULL,
+                  &HandleCount,
+                  &HandleBuffer
+                  );
+  if (EFI_ERROR (Status) || HandleCount == 0) {
+    return;
+  }
+
+  StoreSize = PCI_ENUM_HINT_STORE_SIZE (HandleCount);
+  Store = AllocateZeroPool (StoreSize);
+  Identities = AllocatePool (HandleCount * sizeof (UINT64));
+  if (Store == NULL || Identities == NULL) {
+    goto Done;
+  }
+
+  Store->Signature = PCI_ENUM_HINT_SIGNATURE;
+  Store->DeviceCount = (UINT32)HandleCount;
+
+  for (Index = 0; Index < HandleCount; Index++) {
+    Entry = &Store->Entry[Index];
+
+    Status = gBS->HandleProtocol (
+                    HandleBuffer[Index],
+                    &gEfiPciIoProtocolGuid,
+                    (VOID **)&PciIo
+                    );
+    if (EFI_ERROR (Status)) {
+      goto Done;
+    }
+
+    (VOID)PciIo->GetLocation (PciIo, &Segment, &Bus, &Device, &Function);
+    Entry->SegBusDevFunc = (UINT32)((Segment << 24) | (Bus << 16)
+                           | (Device << 8) | Function);
+    (VOID)PciIo->Pci.Read (
+                       PciIo,
+                       EfiPciIoWidthUint32,
+                       PCI_VENDOR_ID_OFFSET,
+                       1,
+                       &Entry->VendorDevice
+                       );
+    (VOID)PciIo->Pci.Read (
+                       PciIo,
+                       EfiPciIoWidthUint32,
+                       PCI_BASE_ADDRESSREG_OFFSET,
+                       PCI_ENUM_HINT_BAR_COUNT,
+                       Entry->Bar
+                       );
+
+    Identities[Index] = LShiftU64 (Entry->SegBusDevFunc, 32)
+                        | Entry->VendorDevice;
+  }
+
+  //
+  // The hash covers only the device identities, so a resource policy change
+  // refreshes the recorded BARs without looking like a different topology.
+  //
+  Status = gBS->CalculateCrc32 (
+                  Identities,
+                  HandleCount * sizeof (UINT64),
+                  &Hash
+                  );
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+  Store->TopologyHash = Hash;
+
+  if ((mStoredHints != NULL)
+      && (mStoredHints->TopologyHash == Hash)
+      && (mStoredHints->DeviceCount == Store->DeviceCount)
+      && (CompareMem (mStoredHints, Store, StoreSize) == 0)) {
+    DEBUG ((DEBUG_INFO, "PciPlatform: enum hints up to date (hash 0x%08x)\n", Hash));
+    goto Done;
+  }
+
+  Status = gRT->SetVariable (
+                  PCI_ENUM_HINT_VARIABLE_NAME,
+                  (EFI_GUID *)&mPciEnumHintGuid,
+                  EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                  StoreSize,
+                  Store
+                  );
+  DEBUG ((DEBUG_INFO,
+    "PciPlatform: enum hints refreshed for %d devices (hash 0x%08x): %r\n",
+    Store->DeviceCount, Hash, Status));
+
+Done:
+  if (Identities != NULL) {
+    FreePool (Identities);
+  }
+  if (Store != NULL) {
+    FreePool (Store);
+  }
+  FreePool (HandleBuffer);
+}
+
 EFI_STATUS
 EFIAPI
 PhaseNotify (
@@ -425,6 +706,11 @@ Returns:
 {
   PhaseNotifyPlatform (HostBridge, Phase, ChipsetPhase);
 
+  if ((Phase == EfiPciHostBridgeEndEnumeration)
+      && (ChipsetPhase == ChipsetExit)) {
+    CaptureEnumerationHints ();
+  }
+
   return EFI_SUCCESS;
 }
 
@@ -452,6 +738,8 @@ Returns:
   EFI_STATUS  Status;
   PCI_PLATFORM_PRIVATE_DATA *PciPrivateData;
 
+  LoadEnumerationHints ();
+
   PciInitPlatform ();
 
   PciPrivateData = AllocateZeroPool (sizeof (PCI_PLATFORM_PRIVATE_DATA));
@@ -185,6 +185,9 @@
 #define lower_32_bits(n) ((UINT32)(n))
 #define MAX_TARGET_ID 4
 
+// Completion harvest timer tick, in 100ns units (1ms)
+#define SAS_TIMER_PERIOD 10000
+
 // Generic HW DMA host memory structures
 struct hisi_sas_cmd_hdr {
     UINT32 dw0;
@@ -257,6 +260,12 @@ UINT32 status[260];
 
 struct hisi_sas_slot {
     BOOLEAN used;
+    BOOLEAN done;       // completion header harvested
+    UINT32 data;        // harvested completion header dword
+    EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET *Packet;
+    EFI_EVENT Event;    // NULL for blocking requests
+    VOID *BufferMap;    // only kept for queued requests
+    UINT64 TimeLeft;    // remaining time in 100ns units
 };
 
 struct hisi_hba {
@@ -296,9 +305,135 @@ typedef struct {
 #define SAS_DEVICE_SIGNATURE SIGNATURE_32 ('S','A','S','0')
 #define SAS_FROM_PASS_THRU(a) CR (a, SAS_V1_INFO, ExtScsiPassThru, SAS_DEVICE_SIGNATURE)
 
+// Finish a queued (non-blocking) request whose completion header has been
+// harvested: release the DMA mapping, translate the result and signal the
+// caller. Runs at TPL_NOTIFY from the harvest path.
+STATIC VOID complete_slot (
+  struct hisi_hba *hba,
+  UINT32 slot_idx
+  )
+{
+  struct hisi_sas_slot *slot = &hba->slots[slot_idx];
+  struct hisi_sas_sts *sts = &hba->status_buf[slot_idx / QUEUE_SLOTS][slot_idx % QUEUE_SLOTS];
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET *Packet = slot->Packet;
+  EFI_SCSI_SENSE_DATA *SensePtr = Packet->SenseData;
+  UINT8 *p;
+
+  if (slot->BufferMap) {
+    DmaUnmap (slot->BufferMap);
+  }
+
+  Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_OK;
+  Packet->TargetStatus = EFI_EXT_SCSI_STATUS_TARGET_GOOD;
+
+  if ((slot->data & CMPLT_HDR_ERR_RCRD_XFRD_MSK) &&
+    !(slot->data & CMPLT_HDR_RSPNS_XFRD_MSK)) {
+    Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_OTHER;
+  }
+
+  p = (UINT8 *)&sts->status[0];
+  if (SensePtr && p[SENSE_DATA_PRES]) {
+    // Report not ready and let the caller schedule its own retry,
+    // the timer callback is no place to sleep out a disk spin up
+    SensePtr->Sense_Key = EFI_SCSI_SK_NOT_READY;
+    SensePtr->Addnl_Sense_Code = EFI_SCSI_ASC_NOT_READY;
+    SensePtr->Addnl_Sense_Code_Qualifier = EFI_SCSI_ASCQ_IN_PROGRESS;
+  }
+
+  if (slot->Event != NULL) {
+    gBS->SignalEvent (slot->Event);
+  }
+  slot->Packet = NULL;
+  slot->Event = NULL;
+  slot->BufferMap = NULL;
+  slot->done = FALSE;
+  slot->used = FALSE;
+}
+
+// Walk every completion queue with work pending and retire the slots the
+// controller has finished, matching them back through the IPTT tag. Queued
+// requests complete here; blocking requests are only marked done and
+// finished by their submitter.
+STATIC VOID harvest_completions (
+  struct hisi_hba *hba
+  )
+{
+  struct hisi_sas_complete_hdr *complete_hdr;
+  struct hisi_sas_slot *slot;
+  UINT32 base = hba->base;
+  UINT32 queue, rd, wr, iptt, pending;
+  EFI_TPL OriginalTPL;
+
+  OriginalTPL = gBS->RaiseTPL (TPL_NOTIFY);
+
+  pending = READ_REG32(base, OQ_INT_SRC);
+  for (queue = 0; queue < QUEUE_CNT; queue++) {
+    if (!(pending & BIT(queue)))
+      continue;
+
+    rd = READ_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue));
+    wr = READ_REG32(base, COMPL_Q_0_WR_PTR + (0x14 * queue));
+    while (rd != wr) {
+      complete_hdr = &hba->complete_hdr[queue][rd];
+      iptt = (complete_hdr->data & CMPLT_HDR_IPTT_MSK) >> CMPLT_HDR_IPTT_OFF;
+      if (iptt < SLOT_ENTRIES) {
+        slot = &hba->slots[iptt];
+        if (slot->used && !slot->done) {
+          slot->data = complete_hdr->data;
+          slot->done = TRUE;
+          if (slot->Event != NULL) {
+            complete_slot (hba, iptt);
+          }
+        }
+      }
+      rd = (rd + 1) % QUEUE_SLOTS;
+    }
+    // Update read point
+    WRITE_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue), rd);
+    // Clear int
+    WRITE_REG32(base, OQ_INT_SRC, BIT(queue));
+  }
+
+  gBS->RestoreTPL (OriginalTPL);
+}
+
+// Periodic tick: harvest finished commands and age the per-slot timeouts
+// of the outstanding queued requests.
+STATIC VOID EFIAPI sas_v1_timer (
+  IN EFI_EVENT Event,
+  IN VOID *Context
+  )
+{
+  struct hisi_hba *hba = Context;
+  struct hisi_sas_slot *slot;
+  UINT32 i;
+
+  harvest_completions (hba);
+
+  for (i = 0; i < SLOT_ENTRIES; i++) {
+    slot = &hba->slots[i];
+    if (!slot->used || slot->Event == NULL || slot->Packet == NULL)
+      continue;
+    if (slot->Packet->Timeout == 0)
+      continue;
+    if (slot->TimeLeft <= SAS_TIMER_PERIOD) {
+      // There is no abort support, so quarantine the slot (leave it
+      // used and mapped) in case the controller completes it late,
+      // and hand the timeout to the caller
+      slot->Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_TIMEOUT_COMMAND;
+      gBS->SignalEvent (slot->Event);
+      slot->Event = NULL;
+      slot->Packet = NULL;
+    } else {
+      slot->TimeLeft -= SAS_TIMER_PERIOD;
+    }
+  }
+}
+
 STATIC EFI_STATUS prepare_cmd (
   struct hisi_hba *hba,
-  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET    *Packet
+  EFI_EXT_SCSI_PASS_THRU_SCSI_REQUEST_PACKET    *Packet,
+  EFI_EVENT                                     Event
   )
 {
   struct hisi_sas_slot *slot;
@@ -312,6 +447,7 @@ STATIC EFI_STATUS prepare_cmd (
   int queue = hba->queue;
   UINT32 r, w = 0, slot_idx = 0;
   UINT32 base = hba->base;
+  UINT64 remaining;
   UINT8 *p;
   EFI_PHYSICAL_ADDRESS  BufferAddress;
   EFI_STATUS            Status = EFI_SUCCESS;
@@ -345,6 +481,11 @@ STATIC EFI_STATUS prepare_cmd (
     ZeroMem (SensePtr, sizeof (EFI_SCSI_SENSE_DATA));
 
   slot->used = TRUE;
+  slot->done = FALSE;
+  slot->Packet = Packet;
+  slot->Event = Event;
+  slot->BufferMap = NULL;
+  slot->TimeLeft = Packet->Timeout;
   hba->queue = (queue + 1) % QUEUE_CNT;
 
   // Only consider ssp
@@ -388,6 +529,9 @@ STATIC EFI_STATUS prepare_cmd (
 
     Status = DmaMap (DmaOperation, Buffer, &BufferSize, &BufferAddress, &BufferMap);
     if (EFI_ERROR (Status)) {
+      slot->Packet = NULL;
+      slot->Event = NULL;
+      slot->used = FALSE;
       return Status;
     }
     remain = len = BufferSize;
@@ -410,45 +554,59 @@ STATIC EFI_STATUS prepare_cmd (
     hdr->sg_len = i << CMD_HDR_DATA_SGL_LEN_OFF;
   }
 
+  if (Event != NULL) {
+    slot->BufferMap = BufferMap;
+  }
+
   // Ensure descriptor effective before start dma
   MemoryFence();
 
   // Start dma
   WRITE_REG32(base, DLVRY_Q_0_WR_PTR + queue * 0x14, ++w % QUEUE_SLOTS);
 
-  // Wait for dma complete
-  while (slot->used) {
-    if (READ_REG32(base, OQ_INT_SRC) & BIT(queue)) {
-      struct hisi_sas_complete_hdr *complete_hdr;
-      UINT32 data, rd;
-      rd = READ_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue));
+  if (Event != NULL) {
+    // Queued request, leave it outstanding: the periodic timer harvests
+    // the completion queues, tracks the per-slot timeout and signals
+    // the event once this tag is retired
+    return EFI_SUCCESS;
+  }
 
-      complete_hdr = &hba->complete_hdr[queue][rd];
-      data = complete_hdr->data;
-
-      // Check whether dma transfer error
-      if ((data & CMPLT_HDR_ERR_RCRD_XFRD_MSK) &&
-        !(data & CMPLT_HDR_RSPNS_XFRD_MSK)) {
-        DEBUG ((EFI_D_VERBOSE, "sas retry data=0x%x\n", data));
-        DEBUG ((EFI_D_VERBOSE, "sts[0]=0x%x\n", sts->status[0]));
-        DEBUG ((EFI_D_VERBOSE, "sts[1]=0x%x\n", sts->status[1]));
-        DEBUG ((EFI_D_VERBOSE, "sts[2]=0x%x\n", sts->status[2]));
-        Status = EFI_NOT_READY;
-        // wait 1 second and retry, some disk need long time to be ready
-        // and ScsiDisk treat retry over 3 times as error
-        MicroSecondDelay(1000000);
-      }
-       // Update read point
-       WRITE_REG32(base, COMPL_Q_0_RD_PTR + (0x14 * queue), w);
-       // Clear int
-       WRITE_REG32(base, OQ_INT_SRC, BIT(queue));
-       slot->used = FALSE;
-       break;
+  // Wait for dma complete
+  remaining = Packet->Timeout;
+  for (;;) {
+    harvest_completions (hba);
+    if (slot->done) {
+      break;
+    }
+    if ((Packet->Timeout != 0) && (remaining == 0)) {
+      // There is no abort support, so quarantine the slot (leave it
+      // used and mapped) in case the controller completes it late
+      slot->Packet = NULL;
+      Packet->HostAdapterStatus = EFI_EXT_SCSI_STATUS_HOST_ADAPTER_TIMEOUT_COMMAND;
+      return EFI_TIMEOUT;
     }
+    remaining--;
     // Wait for status change in polling
     NanoSecondDelay (100);
   }
 
+  // Check whether dma transfer error
+  if ((slot->data & CMPLT_HDR_ERR_RCRD_XFRD_MSK) &&
+    !(slot->data & CMPLT_HDR_RSPNS_XFRD_MSK)) {
+    DEBUG ((EFI_D_VERBOSE, "sas retry data=0x%x\n", slot->data));
+    DEBUG ((EFI_D_VERBOSE, "sts[0]=0x%x\n", sts->status[0]));
+    DEBUG ((EFI_D_VERBOSE, "sts[1]=0x%x\n", sts->status[1]));
+    DEBUG ((EFI_D_VERBOSE, "sts[2]=0x%x\n", sts->status[2]));
+    Status = EFI_NOT_READY;
+    // wait 1 second and retry, some disk need long time to be ready
+    // and ScsiDisk treat retry over 3 times as error
+    MicroSecondDelay(1000000);
+  }
+
+  slot->done = FALSE;
+  slot->Packet = NULL;
+  slot->used = FALSE;
+
   if (BufferMap)
        DmaUnmap (BufferMap);
 
@@ -672,7 +830,7 @@ SasV1ExtScsiPassThruFunction (
   SAS_V1_INFO *SasV1Info = SAS_FROM_PASS_THRU(This);
   struct hisi_hba *hba = SasV1Info->hba;
 
-  return prepare_cmd(hba, Packet);
+  return prepare_cmd(hba, Packet, Event);
 }
 
 STATIC
@@ -914,9 +1072,23 @@ SasDriverBindingStart (
   val &= ~SL_CONTROL_NOTIFY_EN;
   PHY_WRITE_REG32(base, SL_CONTROL, phy_id, val);
 
+  // Harvest completions and age per-slot timeouts of queued requests
+  Status = gBS->CreateEvent (
+                EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                TPL_NOTIFY,
+                sas_v1_timer,
+                hba,
+                &SasV1Info->TimerEvent
+                );
+  ASSERT_EFI_ERROR (Status);
+  Status = gBS->SetTimer (SasV1Info->TimerEvent, TimerPeriodic, SAS_TIMER_PERIOD);
+  ASSERT_EFI_ERROR (Status);
+
   CopyMem (&SasV1Info->ExtScsiPassThru, &SasV1ExtScsiPassThruProtocolTemplate, sizeof (EFI_EXT_SCSI_PASS_THRU_PROTOCOL));
   SasV1Info->ExtScsiPassThruMode.AdapterId = 2;
-  SasV1Info->ExtScsiPassThruMode.Attributes = EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_PHYSICAL | EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_LOGICAL;
+  SasV1Info->ExtScsiPassThruMode.Attributes = EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_PHYSICAL |
+                                              EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_LOGICAL |
+                                              EFI_EXT_SCSI_PASS_THRU_ATTRIBUTES_NONBLOCKIO;
   SasV1Info->ExtScsiPassThruMode.IoAlign  = 64; //cache line align
   SasV1Info->ExtScsiPassThru.Mode = &SasV1Info->ExtScsiPassThruMode;
 
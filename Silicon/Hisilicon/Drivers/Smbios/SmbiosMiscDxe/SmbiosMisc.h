@@ -183,6 +183,39 @@ LogSmbiosData (
   IN  OUT  EFI_SMBIOS_HANDLE          *SmbiosHandle
   );
 
+/**
+ Acquires the shared zeroed buffer used to assemble one SMBIOS record.
+ The buffer stays valid until the next call; the caller must not free it.
+
+ @param [in]   Size           Number of bytes the record requires.
+
+**/
+VOID *
+SmbiosMiscAcquireRecordBuffer (
+  IN UINTN                     Size
+  );
+
+/**
+ Returns the cached HII package string for a token. The caller must not
+ free the returned string.
+
+ @param [in]   Token          The string token to fetch.
+
+**/
+EFI_STRING
+SmbiosMiscGetCachedString (
+  IN EFI_STRING_ID             Token
+  );
+
+/**
+ Releases the shared record buffer and the cached package strings.
+
+**/
+VOID
+SmbiosMiscFreeBuilderContext (
+  VOID
+  );
+
 /**
  Get Link Type Handle.
 
@@ -19,12 +19,28 @@ Based on files under Nt32Pkg/MiscSubClassPlatformDxe/
 
 #include "SmbiosMisc.h"
 
-#define MAX_HANDLE_COUNT  0x10
+#define MAX_HANDLE_COUNT         0x10
+#define MAX_CACHED_STRING_COUNT  0x20
 
 EFI_HANDLE              mImageHandle;
 EFI_HII_HANDLE          mHiiHandle;
 EFI_SMBIOS_PROTOCOL     *mSmbios = NULL;
 
+//
+// Builder context shared by all the TypeXX producers: one reusable record
+// buffer and a token-keyed cache of the HII package strings. Both live only
+// for the duration of the data table walk in the entry point.
+//
+typedef struct {
+    EFI_STRING_ID       Token;
+    EFI_STRING          String;
+} SMBIOS_MISC_CACHED_STRING;
+
+STATIC UINT8                      *mRecordBuffer = NULL;
+STATIC UINTN                      mRecordBufferSize = 0;
+STATIC SMBIOS_MISC_CACHED_STRING  mCachedStrings[MAX_CACHED_STRING_COUNT];
+STATIC UINTN                      mCachedStringCount = 0;
+
 //
 // Data Table Array
 //
@@ -96,15 +112,157 @@ SmbiosMiscEntryPoint(
             if (EFI_ERROR(EfiStatus))
             {
                 DEBUG((EFI_D_ERROR, "Misc smbios store error.  Index=%d, ReturnStatus=%r\n", Index, EfiStatus));
-                return EfiStatus;
+                break;
             }
         }
     }
 
+    SmbiosMiscFreeBuilderContext();
+
     return EfiStatus;
 }
 
 
+/**
+  Acquires the shared buffer used to assemble one SMBIOS record.
+
+  The buffer is zeroed on every call and grows on demand. It stays valid only
+  until the next call, so a record must be handed to LogSmbiosData() before
+  the next one is built. The caller must not free the returned buffer.
+
+  @param  Size                  Number of bytes the record requires.
+
+  @retval NULL                  Not enough resources to grow the buffer.
+  @retval Others                Pointer to the zeroed record buffer.
+
+**/
+VOID *
+SmbiosMiscAcquireRecordBuffer (
+  IN UINTN                     Size
+  )
+{
+    if (Size > mRecordBufferSize)
+    {
+        if (mRecordBuffer != NULL)
+        {
+            FreePool(mRecordBuffer);
+            mRecordBuffer = NULL;
+        }
+        mRecordBufferSize = 0;
+
+        mRecordBuffer = AllocatePool(Size);
+        if (mRecordBuffer == NULL)
+        {
+            return NULL;
+        }
+        mRecordBufferSize = Size;
+    }
+
+    (VOID)ZeroMem(mRecordBuffer, mRecordBufferSize);
+
+    return mRecordBuffer;
+}
+
+
+/**
+  Returns the HII package string for a token, caching the result.
+
+  Repeated requests for the same token reuse the copy fetched by the first
+  one, and tokens whose contents compare equal (manufacturer names repeat
+  across record types) share a single copy. The caller must not free the
+  returned string; the whole cache is released by
+  SmbiosMiscFreeBuilderContext().
+
+  @param  Token                 The string token to fetch.
+
+  @retval NULL                  The string is not present in the package.
+  @retval Others                Pointer to the cached string.
+
+**/
+EFI_STRING
+SmbiosMiscGetCachedString (
+  IN EFI_STRING_ID             Token
+  )
+{
+    EFI_STRING         String;
+    UINTN              Index;
+
+    for (Index = 0; Index < mCachedStringCount; Index++)
+    {
+        if (mCachedStrings[Index].Token == Token)
+        {
+            return mCachedStrings[Index].String;
+        }
+    }
+
+    String = HiiGetPackageString(&gEfiCallerIdGuid, Token, NULL);
+    if (String == NULL || mCachedStringCount >= MAX_CACHED_STRING_COUNT)
+    {
+        return String;
+    }
+
+    //
+    // Share one copy between tokens whose contents are identical.
+    //
+    for (Index = 0; Index < mCachedStringCount; Index++)
+    {
+        if (StrCmp(mCachedStrings[Index].String, String) == 0)
+        {
+            FreePool(String);
+            String = mCachedStrings[Index].String;
+            break;
+        }
+    }
+
+    mCachedStrings[mCachedStringCount].Token  = Token;
+    mCachedStrings[mCachedStringCount].String = String;
+    mCachedStringCount++;
+
+    return String;
+}
+
+
+/**
+  Releases the shared record buffer and the cached package strings.
+
+**/
+VOID
+SmbiosMiscFreeBuilderContext (
+  VOID
+  )
+{
+    UINTN              Index;
+    UINTN              Index2;
+
+    for (Index = 0; Index < mCachedStringCount; Index++)
+    {
+        //
+        // Deduplicated tokens alias one allocation - free it only once.
+        //
+        for (Index2 = 0; Index2 < Index; Index2++)
+        {
+            if (mCachedStrings[Index2].String == mCachedStrings[Index].String)
+            {
+                break;
+            }
+        }
+
+        if (Index2 == Index)
+        {
+            FreePool(mCachedStrings[Index].String);
+        }
+    }
+    mCachedStringCount = 0;
+
+    if (mRecordBuffer != NULL)
+    {
+        FreePool(mRecordBuffer);
+        mRecordBuffer = NULL;
+        mRecordBufferSize = 0;
+    }
+}
+
+
 /**
   Logs SMBIOS record.
 
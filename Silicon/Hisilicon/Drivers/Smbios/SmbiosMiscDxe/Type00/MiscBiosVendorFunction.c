@@ -178,17 +178,17 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscBiosVendor)
     }
 
     TokenToGet = STRING_TOKEN (STR_MISC_BIOS_VENDOR);
-    Vendor = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Vendor = SmbiosMiscGetCachedString(TokenToGet);
     VendorStrLen = StrLen(Vendor);
 
 
     TokenToGet = STRING_TOKEN (STR_MISC_BIOS_VERSION);
-    Version = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Version = SmbiosMiscGetCachedString(TokenToGet);
     VerStrLen = StrLen(Version);
 
 
     TokenToGet = STRING_TOKEN (STR_MISC_BIOS_RELEASE_DATE);
-    ReleaseDate = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    ReleaseDate = SmbiosMiscGetCachedString(TokenToGet);
     DateStrLen = StrLen(ReleaseDate);
 
     //
@@ -199,7 +199,7 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscBiosVendor)
     //
     // Two zeros following the last string.
     //
-    SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE0) + VendorStrLen + 1 + VerStrLen + 1 + DateStrLen + 1 + 1);
+    SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE0) + VendorStrLen + 1 + VerStrLen + 1 + DateStrLen + 1 + 1);
     if(NULL == SmbiosRecord)
     {
         Status = EFI_OUT_OF_RESOURCES;
@@ -228,24 +228,7 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscBiosVendor)
         DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type00 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
     }
 
-    FreePool(SmbiosRecord);
-
 Exit:
-    if(Vendor != NULL)
-    {
-        FreePool(Vendor);
-    }
-
-    if(Version != NULL)
-    {
-        FreePool(Version);
-    }
-
-    if(ReleaseDate != NULL)
-    {
-        FreePool(ReleaseDate);
-    }
-
     if(Char16String != NULL)
     {
         FreePool(Char16String);
@@ -84,33 +84,33 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscSystemManufacturer)
     UpdateSmbiosInfo(mHiiHandle, STRING_TOKEN (STR_MISC_SYSTEM_MANUFACTURER), SystemManufacturerType01);
 
     TokenToGet   = STRING_TOKEN (STR_MISC_SYSTEM_MANUFACTURER);
-    Manufacturer = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Manufacturer = SmbiosMiscGetCachedString(TokenToGet);
     ManuStrLen   = StrLen(Manufacturer);
 
     TokenToGet   = STRING_TOKEN (STR_MISC_SYSTEM_PRODUCT_NAME);
-    ProductName  = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    ProductName  = SmbiosMiscGetCachedString(TokenToGet);
     PdNameStrLen = StrLen(ProductName);
 
     TokenToGet = STRING_TOKEN (STR_MISC_SYSTEM_VERSION);
-    Version    = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Version    = SmbiosMiscGetCachedString(TokenToGet);
     VerStrLen  = StrLen(Version);
 
     TokenToGet      = STRING_TOKEN (STR_MISC_SYSTEM_SERIAL_NUMBER);
-    SerialNumber    = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    SerialNumber    = SmbiosMiscGetCachedString(TokenToGet);
     SerialNumStrLen = StrLen(SerialNumber);
 
     TokenToGet   = STRING_TOKEN (STR_MISC_SYSTEM_SKU_NUMBER);
-    SKUNumber    = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    SKUNumber    = SmbiosMiscGetCachedString(TokenToGet);
     SKUNumStrLen = StrLen(SKUNumber);
 
     TokenToGet   = STRING_TOKEN (STR_MISC_SYSTEM_FAMILY);
-    Family       = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Family       = SmbiosMiscGetCachedString(TokenToGet);
     FamilyStrLen = StrLen(Family);
 
     //
     // Two zeros following the last string.
     //
-    SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE1) + ManuStrLen      + 1
+    SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE1) + ManuStrLen      + 1
                                                                 + PdNameStrLen    + 1
                                                                 + VerStrLen       + 1
                                                                 + SerialNumStrLen + 1
@@ -157,38 +157,6 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscSystemManufacturer)
         DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type01 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
     }
 
-    FreePool(SmbiosRecord);
-
 Exit:
-    if(Manufacturer != NULL)
-    {
-        FreePool(Manufacturer);
-    }
-
-    if(ProductName != NULL)
-    {
-        FreePool(ProductName);
-    }
-
-    if(Version != NULL)
-    {
-        FreePool(Version);
-    }
-
-    if(SerialNumber != NULL)
-    {
-        FreePool(SerialNumber);
-    }
-
-    if(SKUNumber != NULL)
-    {
-        FreePool(SKUNumber);
-    }
-
-    if(Family != NULL)
-    {
-        FreePool(Family);
-    }
-
     return Status;
 }
@@ -88,33 +88,33 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscBaseBoardManufacturer)
     UpdateSmbiosInfo(mHiiHandle, STRING_TOKEN (STR_MISC_BASE_BOARD_MANUFACTURER), BoardManufacturerType02);
 
     TokenToGet = STRING_TOKEN (STR_MISC_BASE_BOARD_MANUFACTURER);
-    BaseBoardManufacturer = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    BaseBoardManufacturer = SmbiosMiscGetCachedString(TokenToGet);
     ManuStrLen = StrLen(BaseBoardManufacturer);
 
     TokenToGet = STRING_TOKEN (STR_MISC_BASE_BOARD_PRODUCT_NAME);
-    BaseBoardProductName = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    BaseBoardProductName = SmbiosMiscGetCachedString(TokenToGet);
     ProductNameStrLen = StrLen(BaseBoardProductName);
 
     TokenToGet = STRING_TOKEN (STR_MISC_BASE_BOARD_VERSION);
-    Version = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Version = SmbiosMiscGetCachedString(TokenToGet);
     VerStrLen = StrLen(Version);
 
     TokenToGet = STRING_TOKEN (STR_MISC_BASE_BOARD_SERIAL_NUMBER);
-    SerialNumber = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    SerialNumber = SmbiosMiscGetCachedString(TokenToGet);
     SerialNumStrLen = StrLen(SerialNumber);
 
     TokenToGet = STRING_TOKEN (STR_MISC_BASE_BOARD_ASSET_TAG);
-    AssetTag = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    AssetTag = SmbiosMiscGetCachedString(TokenToGet);
     AssetTagStrLen = StrLen(AssetTag);
 
     TokenToGet = STRING_TOKEN (STR_MISC_BASE_BOARD_CHASSIS_LOCATION);
-    ChassisLocation = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    ChassisLocation = SmbiosMiscGetCachedString(TokenToGet);
     ChassisLocaStrLen = StrLen(ChassisLocation);
 
     //
     // Two zeros following the last string.
     //
-    SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE2) + ManuStrLen        + 1
+    SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE2) + ManuStrLen        + 1
                                                                 + ProductNameStrLen + 1
                                                                 + VerStrLen         + 1
                                                                 + SerialNumStrLen   + 1
@@ -161,38 +161,6 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscBaseBoardManufacturer)
         DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type02 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
     }
 
-    FreePool(SmbiosRecord);
-
 Exit:
-    if(BaseBoardManufacturer != NULL)
-    {
-        FreePool(BaseBoardManufacturer);
-    }
-
-    if(BaseBoardProductName != NULL)
-    {
-        FreePool(BaseBoardProductName);
-    }
-
-    if(Version != NULL)
-    {
-        FreePool(Version);
-    }
-
-    if(SerialNumber != NULL)
-    {
-        FreePool(SerialNumber);
-    }
-
-    if(AssetTag != NULL)
-    {
-        FreePool(AssetTag);
-    }
-
-    if(ChassisLocation != NULL)
-    {
-        FreePool(ChassisLocation);
-    }
-
     return Status;
 }
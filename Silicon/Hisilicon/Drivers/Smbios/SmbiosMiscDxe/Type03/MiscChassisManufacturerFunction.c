@@ -89,23 +89,23 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscChassisManufacturer)
     UpdateSmbiosInfo(mHiiHandle, STRING_TOKEN (STR_MISC_CHASSIS_MANUFACTURER), ManufacturerType03);
 
     TokenToGet = STRING_TOKEN (STR_MISC_CHASSIS_MANUFACTURER);
-    Manufacturer = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Manufacturer = SmbiosMiscGetCachedString(TokenToGet);
     ManuStrLen = StrLen(Manufacturer);
 
     TokenToGet = STRING_TOKEN (STR_MISC_CHASSIS_VERSION);
-    Version = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    Version = SmbiosMiscGetCachedString(TokenToGet);
     VerStrLen = StrLen(Version);
 
     TokenToGet = STRING_TOKEN (STR_MISC_CHASSIS_SERIAL_NUMBER);
-    SerialNumber = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    SerialNumber = SmbiosMiscGetCachedString(TokenToGet);
     SerialNumStrLen = StrLen(SerialNumber);
 
     TokenToGet = STRING_TOKEN (STR_MISC_CHASSIS_ASSET_TAG);
-    AssertTag = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    AssertTag = SmbiosMiscGetCachedString(TokenToGet);
     AssertTagStrLen = StrLen(AssertTag);
 
     TokenToGet = STRING_TOKEN (STR_MISC_CHASSIS_SKU_NUMBER);
-    ChassisSkuNumber = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    ChassisSkuNumber = SmbiosMiscGetCachedString(TokenToGet);
     ChaNumStrLen = StrLen(ChassisSkuNumber);
 
     ContainedElementCount = InputData->ContainedElementCount;
@@ -118,7 +118,7 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscChassisManufacturer)
     //
     // Two zeros following the last string.
     //
-    SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE3) + ExtendLength    + 1
+    SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE3) + ExtendLength    + 1
                                                                 + ManuStrLen      + 1
                                                                 + VerStrLen       + 1
                                                                 + SerialNumStrLen + 1
@@ -166,33 +166,6 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscChassisManufacturer)
         DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type03 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
     }
 
-    FreePool(SmbiosRecord);
-
 Exit:
-    if(Manufacturer != NULL)
-    {
-        FreePool(Manufacturer);
-    }
-
-    if(Version != NULL)
-    {
-        FreePool(Version);
-    }
-
-    if(SerialNumber != NULL)
-    {
-        FreePool(SerialNumber);
-    }
-
-    if(AssertTag != NULL)
-    {
-        FreePool(AssertTag);
-    }
-
-    if(ChassisSkuNumber != NULL)
-    {
-        FreePool(ChassisSkuNumber);
-    }
-
     return Status;
 }
@@ -154,13 +154,13 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscSystemSlotDesignation)
     UpdateSlotDesignation (InputData);
 
     TokenToGet   = STRING_TOKEN (STR_MISC_SYSTEM_SLOT_DESIGNATION);
-    SlotDesignation = HiiGetPackageString(&gEfiCallerIdGuid, TokenToGet, NULL);
+    SlotDesignation = SmbiosMiscGetCachedString(TokenToGet);
     SlotDesignationStrLen = StrLen(SlotDesignation);
 
     //
     // Two zeros following the last string.
     //
-    SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE9) + SlotDesignationStrLen + 1 + 1);
+    SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE9) + SlotDesignationStrLen + 1 + 1);
     if(NULL == SmbiosRecord)
     {
         Status = EFI_OUT_OF_RESOURCES;
@@ -184,13 +184,6 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscSystemSlotDesignation)
       DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type09 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
     }
 
-    FreePool(SmbiosRecord);
-
 Exit:
-    if(SlotDesignation != NULL)
-    {
-      FreePool(SlotDesignation);
-    }
-
     return Status;
 }
@@ -133,7 +133,7 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscNumberOfInstallableLanguages)
   //
   // Two zeros following the last string.
   //
-  SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE13) + LangStrLen + 1 + 1);
+  SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE13) + LangStrLen + 1 + 1);
   if(NULL == SmbiosRecord) {
     return EFI_OUT_OF_RESOURCES;
   }
@@ -152,6 +152,5 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscNumberOfInstallableLanguages)
     DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type13 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
   }
 
-  FreePool(SmbiosRecord);
   return Status;
 }
@@ -46,7 +46,7 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscBootInformation)
     //
     // Two zeros following the last string.
     //
-    SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE32) + 1 + 1);
+    SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE32) + 1 + 1);
     if(NULL == SmbiosRecord) {
         return EFI_OUT_OF_RESOURCES;
     }
@@ -63,6 +63,5 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscBootInformation)
         DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type32 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
     }
 
-    FreePool(SmbiosRecord);
     return Status;
 }
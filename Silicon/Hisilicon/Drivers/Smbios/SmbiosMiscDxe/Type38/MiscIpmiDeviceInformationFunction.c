@@ -53,7 +53,7 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscIpmiDeviceInformation)
 
     InputData = (SMBIOS_TABLE_TYPE38*)RecordData;
 
-    SmbiosRecord = AllocateZeroPool(sizeof (SMBIOS_TABLE_TYPE38) + 1 + 1);
+    SmbiosRecord = SmbiosMiscAcquireRecordBuffer(sizeof (SMBIOS_TABLE_TYPE38) + 1 + 1);
     if(NULL == SmbiosRecord) {
         return EFI_OUT_OF_RESOURCES;
     }
@@ -76,6 +76,5 @@ MISC_SMBIOS_TABLE_FUNCTION(MiscIpmiDeviceInformation)
         DEBUG((EFI_D_ERROR, "[%a]:[%dL] Smbios Type38 Table Log Failed! %r \n", __FUNCTION__, __LINE__, Status));
     }
 
-    FreePool(SmbiosRecord);
     return Status;
 }
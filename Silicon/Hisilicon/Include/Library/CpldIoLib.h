@@ -10,7 +10,40 @@
 #ifndef _CPLD_IO_LIB_H_
 #define _CPLD_IO_LIB_H_
 
+typedef enum {
+  CPLD_TRANS_READ = 0,
+  CPLD_TRANS_WRITE
+} CPLD_TRANS_OP;
+
+//
+// One element of a batched CPLD transaction. Data points to Length bytes
+// read from or written to consecutive registers starting at RegAddr.
+//
+typedef struct {
+  CPLD_TRANS_OP Op;
+  UINT16        RegAddr;
+  UINT8         *Data;
+  UINT16        Length;
+} CPLD_TRANSACTION;
+
+//
+// Access statistics collected by the library since boot (or since the
+// library was loaded, for the runtime variant). TotalTicks accumulates
+// performance counter ticks spent on the bus and is zero where no timer
+// is available.
+//
+typedef struct {
+  UINT64        ReadCount;
+  UINT64        WriteCount;
+  UINT64        TransactionCount;
+  UINT64        TotalTicks;
+} CPLD_ACCESS_JOURNAL;
+
 VOID WriteCpldReg(UINTN ulRegAddr, UINT8 ulValue);
 UINT8 ReadCpldReg(UINTN ulRegAddr);
 
+VOID ExecCpldTransactions(CPLD_TRANSACTION *Trans, UINTN Count);
+VOID GetCpldAccessJournal(CPLD_ACCESS_JOURNAL *Journal);
+VOID DumpCpldAccessJournal(VOID);
+
 #endif /* _CPLD_IO_LIB_H_ */
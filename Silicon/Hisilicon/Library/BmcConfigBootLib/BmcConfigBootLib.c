@@ -211,6 +211,25 @@ GetBmcBootOptionsSetting (
   )
 {
   EFI_STATUS   Status;
+  UINTN        DataSize;
+
+  // The boot flags only change when the BMC operator sets a new override,
+  // so the answer queried earlier this boot is still valid - reuse it
+  // instead of going back to the BMC.
+  DataSize = sizeof (IPMI_GET_BOOT_OPTION);
+  Status = gRT->GetVariable (
+                  L"BmcBootOptions",
+                  &gOemBootVariableGuid,
+                  NULL,
+                  &DataSize,
+                  BmcBootOpt
+                  );
+  if (!EFI_ERROR (Status)) {
+    if (BmcBootOpt->BootFlagsValid != BOOT_OPTION_BOOT_FLAG_VALID) {
+      return EFI_NOT_FOUND;
+    }
+    return EFI_SUCCESS;
+  }
 
   Status = IpmiCmdGetSysBootOptions (BmcBootOpt);
   if (EFI_ERROR (Status)) {
@@ -218,16 +237,34 @@ GetBmcBootOptionsSetting (
     return Status;
   }
 
+  // Cache the response for the rest of this boot, including the common
+  // no-override case. The variable is volatile, so the next boot starts
+  // with a fresh query.
+  Status = gRT->SetVariable (
+                  L"BmcBootOptions",
+                  &gOemBootVariableGuid,
+                  EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                  sizeof (IPMI_GET_BOOT_OPTION),
+                  BmcBootOpt
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Cache iBMC BootOpts %r!\n", Status));
+  }
+
   if (BmcBootOpt->BootFlagsValid != BOOT_OPTION_BOOT_FLAG_VALID) {
     return EFI_NOT_FOUND;
   }
 
   if (BmcBootOpt->Persistent) {
+    // A persistent override stays valid in the BMC, so there is nothing
+    // to write back.
     BmcBootOpt->BootFlagsValid = BOOT_OPTION_BOOT_FLAG_VALID;
-  } else {
-    BmcBootOpt->BootFlagsValid = BOOT_OPTION_BOOT_FLAG_INVALID;
+    return EFI_SUCCESS;
   }
 
+  // Acknowledge a one-shot override so the BMC does not replay it on
+  // the next boot.
+  BmcBootOpt->BootFlagsValid = BOOT_OPTION_BOOT_FLAG_INVALID;
   Status = IpmiCmdSetSysBootOptions (BmcBootOpt);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "Set iBMC BootOpts %r!\n", Status));
@@ -14,18 +14,93 @@
 #include <Library/CpldIoLib.h>
 
 
+STATIC CPLD_ACCESS_JOURNAL mCpldJournal = {0, 0, 0, 0};
+
+
 VOID WriteCpldReg(UINTN ulRegAddr, UINT8 ulValue)
 {
+    mCpldJournal.WriteCount++;
     MmioWrite8 (ulRegAddr + PcdGet64(PcdCpldBaseAddress), ulValue);
 }
 
 
 UINT8 ReadCpldReg(UINTN ulRegAddr)
 {
+    mCpldJournal.ReadCount++;
     return MmioRead8 (ulRegAddr + PcdGet64(PcdCpldBaseAddress));
 }
 
 
+/**
+  Execute a vector of CPLD register transactions back-to-back.
+
+  The base address is resolved once and all accesses are issued in a tight
+  loop, so a bank of status registers costs a single bus setup instead of
+  one per register as with repeated ReadCpldReg/WriteCpldReg calls.
+
+  @param Trans   Array of transactions to execute, in order.
+  @param Count   Number of elements in Trans.
+
+**/
+VOID ExecCpldTransactions(CPLD_TRANSACTION *Trans, UINTN Count)
+{
+    UINTN   Base;
+    UINTN   Index;
+    UINT16  Offset;
+    UINT64  StartTick;
+
+    if ((NULL == Trans) || (0 == Count)) {
+        return;
+    }
+
+    Base = (UINTN)PcdGet64(PcdCpldBaseAddress);
+    StartTick = GetPerformanceCounter ();
+
+    for (Index = 0; Index < Count; Index++) {
+        if (NULL == Trans[Index].Data) {
+            continue;
+        }
+
+        if (CPLD_TRANS_WRITE == Trans[Index].Op) {
+            for (Offset = 0; Offset < Trans[Index].Length; Offset++) {
+                MmioWrite8 (Base + Trans[Index].RegAddr + Offset, Trans[Index].Data[Offset]);
+            }
+            mCpldJournal.WriteCount += Trans[Index].Length;
+        } else {
+            for (Offset = 0; Offset < Trans[Index].Length; Offset++) {
+                Trans[Index].Data[Offset] = MmioRead8 (Base + Trans[Index].RegAddr + Offset);
+            }
+            mCpldJournal.ReadCount += Trans[Index].Length;
+        }
+    }
+
+    mCpldJournal.TransactionCount++;
+    mCpldJournal.TotalTicks += GetPerformanceCounter () - StartTick;
+}
+
+
+VOID GetCpldAccessJournal(CPLD_ACCESS_JOURNAL *Journal)
+{
+    if (NULL == Journal) {
+        return;
+    }
+
+    *Journal = mCpldJournal;
+}
+
+
+VOID DumpCpldAccessJournal(VOID)
+{
+    UINT64 TimeUs;
+
+    TimeUs = GetTimeInNanoSecond (mCpldJournal.TotalTicks) / 1000;
+
+    DEBUG ((DEBUG_INFO, "CPLD access journal: %ld reads, %ld writes, %ld batched transactions, %ld us on bus\n",
+        mCpldJournal.ReadCount, mCpldJournal.WriteCount,
+        mCpldJournal.TransactionCount, TimeUs));
+}
+
+
 VOID ReadCpldBytes(UINT16 Addr, UINT8 *Data, UINT8 Bytes)
 {
     UINT8 i;
@@ -85,14 +85,74 @@ CpldRuntimeLibDestructor (
   return Status;
 }
 
+STATIC CPLD_ACCESS_JOURNAL mCpldJournal = {0, 0, 0, 0};
+
 VOID WriteCpldReg(UINTN ulRegAddr, UINT8 ulValue)
 {
+    mCpldJournal.WriteCount++;
     MmioWrite8 (ulRegAddr + mCpldRegAddr, ulValue);
 }
 
 UINT8 ReadCpldReg(UINTN ulRegAddr)
 {
+    mCpldJournal.ReadCount++;
     return MmioRead8 (ulRegAddr + mCpldRegAddr);
 }
 
+/**
+  Execute a vector of CPLD register transactions back-to-back.
+
+  Runtime variant: accesses go through the converted base address and no
+  timer is used, so TotalTicks stays zero in the journal.
+
+  @param Trans   Array of transactions to execute, in order.
+  @param Count   Number of elements in Trans.
+
+**/
+VOID ExecCpldTransactions(CPLD_TRANSACTION *Trans, UINTN Count)
+{
+    UINTN   Index;
+    UINT16  Offset;
+
+    if ((NULL == Trans) || (0 == Count)) {
+        return;
+    }
+
+    for (Index = 0; Index < Count; Index++) {
+        if (NULL == Trans[Index].Data) {
+            continue;
+        }
+
+        if (CPLD_TRANS_WRITE == Trans[Index].Op) {
+            for (Offset = 0; Offset < Trans[Index].Length; Offset++) {
+                MmioWrite8 (mCpldRegAddr + Trans[Index].RegAddr + Offset, Trans[Index].Data[Offset]);
+            }
+            mCpldJournal.WriteCount += Trans[Index].Length;
+        } else {
+            for (Offset = 0; Offset < Trans[Index].Length; Offset++) {
+                Trans[Index].Data[Offset] = MmioRead8 (mCpldRegAddr + Trans[Index].RegAddr + Offset);
+            }
+            mCpldJournal.ReadCount += Trans[Index].Length;
+        }
+    }
+
+    mCpldJournal.TransactionCount++;
+}
+
+VOID GetCpldAccessJournal(CPLD_ACCESS_JOURNAL *Journal)
+{
+    if (NULL == Journal) {
+        return;
+    }
+
+    *Journal = mCpldJournal;
+}
+
+VOID DumpCpldAccessJournal(VOID)
+{
+    DEBUG ((DEBUG_INFO, "CPLD access journal: %ld reads, %ld writes, %ld batched transactions\n",
+        mCpldJournal.ReadCount, mCpldJournal.WriteCount,
+        mCpldJournal.TransactionCount));
+}
+
 
@@ -51,6 +51,119 @@ SerialPortInitialize (
 }
 
 
+//
+// Pending transmit ring, used only when PcdSerialPortTxRingSize is not zero.
+// Bytes that would block on a full FIFO are parked here and drained on the
+// next SerialPortWrite call instead of gating the caller on the line rate.
+//
+STATIC UINT8  mTxRing[UART_TX_RING_CAPACITY];
+STATIC UINTN  mTxRingHead = 0;
+STATIC UINTN  mTxRingCount = 0;
+
+STATIC
+BOOLEAN
+SerialPortTxEmpty (
+  VOID
+  )
+{
+  return (BOOLEAN) ((MmioRead8 (UART_LSR_REG) & UART_LSR_THRE) == UART_LSR_THRE);
+}
+
+STATIC
+VOID
+SerialPortWaitTxEmpty (
+  VOID
+  )
+{
+  UINT32 ulLoop = 0;
+
+  while (ulLoop < (UINT32)UART_SEND_DELAY) {
+    if (SerialPortTxEmpty ()) {
+      break;
+    }
+
+    ulLoop++;
+  }
+}
+
+/**
+  Fill the transmit FIFO with up to one FIFO depth of data.
+
+  Waits (bounded by UART_SEND_DELAY, as the per-character path did) for the
+  transmit FIFO to drain, then bursts up to PcdSerialPortFifoDepth bytes with
+  a single LSR check instead of one check per byte.
+
+  @param  Buffer           Pointer to the data to be written.
+  @param  NumberOfBytes    Number of bytes available in Buffer.
+
+  @return The number of bytes placed in the FIFO.
+
+**/
+STATIC
+UINTN
+SerialPortWriteFifo (
+  IN UINT8     *Buffer,
+  IN UINTN     NumberOfBytes
+  )
+{
+  UINTN  Count;
+  UINTN  Index;
+  UINTN  FifoDepth;
+
+  FifoDepth = UART_FIFO_DEPTH;
+  if (FifoDepth == 0) {
+    FifoDepth = 1;
+  }
+
+  SerialPortWaitTxEmpty ();
+
+  Count = MIN (NumberOfBytes, FifoDepth);
+  for (Index = 0; Index < Count; Index++) {
+    MmioWrite8 (UART_THR_REG, Buffer[Index]);
+  }
+
+  return Count;
+}
+
+/**
+  Drain bytes parked in the transmit ring into the FIFO.
+
+  @param  Blocking         If TRUE, wait for the FIFO until the ring is empty.
+                           If FALSE, stop as soon as the FIFO is not empty.
+
+**/
+STATIC
+VOID
+SerialPortDrainTxRing (
+  IN BOOLEAN   Blocking
+  )
+{
+  UINTN  Count;
+  UINTN  FifoDepth;
+
+  FifoDepth = UART_FIFO_DEPTH;
+  if (FifoDepth == 0) {
+    FifoDepth = 1;
+  }
+
+  while (mTxRingCount > 0) {
+    if (!SerialPortTxEmpty ()) {
+      if (!Blocking) {
+        return;
+      }
+
+      SerialPortWaitTxEmpty ();
+    }
+
+    Count = MIN (mTxRingCount, FifoDepth);
+    while (Count--) {
+      MmioWrite8 (UART_THR_REG, mTxRing[mTxRingHead]);
+      mTxRingHead = (mTxRingHead + 1) % UART_TX_RING_CAPACITY;
+      mTxRingCount--;
+    }
+  }
+}
+
 /**
   Write data from buffer to serial device.
 
@@ -58,6 +171,11 @@ SerialPortInitialize (
   The number of bytes actually written to the serial device is returned.
   If the return value is less than NumberOfBytes, then the write operation failed.
 
+  Data is sent one FIFO burst at a time. When PcdSerialPortTxRingSize is not
+  zero, bytes that would have to wait on a full FIFO are queued in the
+  transmit ring and drained on later calls, so the caller does not stall on
+  the line rate.
+
   If Buffer is NULL, then ASSERT().
 
   If NumberOfBytes is zero, then return 0.
@@ -78,6 +196,8 @@ SerialPortWrite (
 )
 {
   UINTN  Result;
+  UINTN  Sent;
+  UINTN  RingSize;
 
   if (NULL == Buffer) {
     return 0;
@@ -85,10 +205,42 @@ SerialPortWrite (
 
   Result = NumberOfBytes;
 
-  while (NumberOfBytes--) {
+  RingSize = UART_TX_RING_SIZE;
+  if (RingSize > UART_TX_RING_CAPACITY) {
+    RingSize = UART_TX_RING_CAPACITY;
+  }
 
-    SerialPortWriteChar(*Buffer);
-    Buffer++;
+  //
+  // Push out bytes parked by an earlier non-blocking call first so that
+  // output stays in order.
+  //
+  SerialPortDrainTxRing ((BOOLEAN)(RingSize == 0));
+
+  while (NumberOfBytes > 0) {
+    if ((mTxRingCount == 0) && ((RingSize == 0) || SerialPortTxEmpty ())) {
+      Sent = SerialPortWriteFifo (Buffer, NumberOfBytes);
+      Buffer += Sent;
+      NumberOfBytes -= Sent;
+      continue;
+    }
+
+    //
+    // Ring mode and the FIFO is busy (or older output is still queued):
+    // park the data instead of spinning on the LSR.
+    //
+    while ((NumberOfBytes > 0) && (mTxRingCount < RingSize)) {
+      mTxRing[(mTxRingHead + mTxRingCount) % UART_TX_RING_CAPACITY] = *Buffer;
+      mTxRingCount++;
+      Buffer++;
+      NumberOfBytes--;
+    }
+
+    if (NumberOfBytes > 0) {
+      //
+      // The ring is full; fall back to a blocking drain.
+      //
+      SerialPortDrainTxRing (TRUE);
+    }
   }
 
   return Result;
@@ -17,8 +17,15 @@
 
 
 #define UART_SEND_DELAY      (PcdGet32(PcdSerialPortSendDelay))
+#define UART_FIFO_DEPTH      (PcdGet32(PcdSerialPortFifoDepth))
+#define UART_TX_RING_SIZE    (PcdGet32(PcdSerialPortTxRingSize))
 #define BAUDRATE             (PcdGet64(PcdUartDefaultBaudRate))
 
+//
+// Upper bound for PcdSerialPortTxRingSize, sizes the static ring storage.
+//
+#define UART_TX_RING_CAPACITY 2048
+
 
 #define UART_THR_REG         (SERIAL_0_BASE_ADR + UART_THR)
 #define UART_RBR_REG         (SERIAL_0_BASE_ADR + UART_RBR)
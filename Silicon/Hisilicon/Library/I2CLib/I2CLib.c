@@ -417,6 +417,7 @@ I2CRead(
   UINT8       I2CWAddr[2];
   EFI_STATUS  Status;
   UINT32      Idx = 0;
+  UINT32      CmdLen;
   UINTN       Base;
 
   if (I2cInfo->Port >= I2C_PORT_MAX) {
@@ -448,12 +449,20 @@ I2CRead(
     return EFI_TIMEOUT;
   }
 
+  CmdLen = RxLen;
   while (RxLen > 0) {
-    if (RxLen > 1) {
-      I2C_REG_WRITE (Base + I2C_DATA_CMD_OFFSET, I2C_READ_SIGNAL);
-    } else {
-      //Send command stop bit for the last transfer
-      I2C_REG_WRITE (Base + I2C_DATA_CMD_OFFSET, I2C_READ_SIGNAL | I2C_CMD_STOP_BIT);
+    // Keep read commands in flight up to the FIFO threshold, so the
+    // controller clocks the next bytes in from the wire while the ones
+    // already received are drained below.
+    while ((CmdLen > 0) &&
+           (I2C_GetTxStatus (I2cInfo->Socket, I2cInfo->Port) <= I2C_TXRX_THRESHOLD)) {
+      if (CmdLen > 1) {
+        I2C_REG_WRITE (Base + I2C_DATA_CMD_OFFSET, I2C_READ_SIGNAL);
+      } else {
+        //Send command stop bit for the last transfer
+        I2C_REG_WRITE (Base + I2C_DATA_CMD_OFFSET, I2C_READ_SIGNAL | I2C_CMD_STOP_BIT);
+      }
+      CmdLen --;
     }
 
     if (CheckI2CTimeOut (I2cInfo->Socket, I2cInfo->Port, I2CRx) == EFI_TIMEOUT) {
@@ -532,11 +541,16 @@ I2CReadMultiByte (
   TotalLen = RxLen;
   BytesLeft = TotalLen;
 
-  for (Count = 0; Count < BytesLeft; Count++) {
-    I2C_REG_WRITE (Base + I2C_DATA_CMD_OFFSET, I2C_READ_SIGNAL);
-  }
+  // Issue the read commands as the FIFO drains instead of all at once,
+  // so transfers longer than the FIFO depth cannot overflow it.
+  Count = 0;
+  for (Idx = 0; Idx < BytesLeft; ) {
+    while ((Count < BytesLeft) &&
+           (I2C_GetTxStatus (I2cInfo->Socket, I2cInfo->Port) <= I2C_TXRX_THRESHOLD)) {
+      I2C_REG_WRITE (Base + I2C_DATA_CMD_OFFSET, I2C_READ_SIGNAL);
+      Count++;
+    }
 
-  for (Count = 0; Count < BytesLeft; Count++) {
     if (CheckI2CTimeOut (I2cInfo->Socket, I2cInfo->Port, I2CRx) == EFI_TIMEOUT) {
       return EFI_TIMEOUT;
     }
@@ -0,0 +1,23 @@
+/** @file
+  Silicon Policy Dump HOBs carry a raw binary image of the assembled
+  policy config block tables for an offline decoder, so full policy
+  capture does not require serial text output on the boot path.
+
+  Copyright (c) 2020 Intel Corporation. All rights reserved. <BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#ifndef _SI_POLICY_DUMP_HOB_H_
+#define _SI_POLICY_DUMP_HOB_H_
+
+//
+// The HOB data is the unmodified config block table: a CONFIG_BLOCK_TABLE_HEADER
+// followed by the config blocks, each prefixed by the CONFIG_BLOCK_HEADER that
+// holds its GUID, length and revision. The block headers are the field table a
+// decoder needs to enumerate every policy blob.
+//
+extern EFI_GUID gSiPreMemPolicyDumpHobGuid;
+extern EFI_GUID gSiPolicyDumpHobGuid;
+
+#endif // _SI_POLICY_DUMP_HOB_H_
@@ -205,6 +205,16 @@ PcieFindExtendedCapId (
   IN UINT16  CapId
   );
 
+/**
+  Invalidates the capability offset cache used by PcieFindCapId () and PcieFindExtendedCapId ().
+  Must be called whenever the bus:device mapping may have changed, that is after
+  hot-plug, hot-unplug or bus renumbering.
+**/
+VOID
+PcieCapOffsetCacheInvalidate (
+  VOID
+  );
+
 /*
   Checks device's Slot Clock Configuration
 
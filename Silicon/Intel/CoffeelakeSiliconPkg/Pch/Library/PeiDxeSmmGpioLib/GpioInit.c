@@ -326,31 +326,40 @@ GpioConfigurePch (
       PadCfgReg = S_GPIO_PCR_PADCFG * PadNumber + GpioGroupInfo[GroupIndex].PadCfgOffset;
 
       //
-      // Write PADCFG DW0 register
+      // Write PADCFG DW0 register.
+      // The access is skipped if the pad configuration leaves all fields of
+      // a given DW register at hardware default, such read-modify-write
+      // would be a no-op and PCR accesses are slow.
       //
-      MmioAndThenOr32 (
-        PCH_PCR_ADDRESS (GpioCom, PadCfgReg),
-        ~PadCfgDwRegMask[0],
-        PadCfgDwReg[0]
-        );
+      if (PadCfgDwRegMask[0] != 0) {
+        MmioAndThenOr32 (
+          PCH_PCR_ADDRESS (GpioCom, PadCfgReg),
+          ~PadCfgDwRegMask[0],
+          PadCfgDwReg[0]
+          );
+      }
 
       //
       // Write PADCFG DW1 register
       //
-      MmioAndThenOr32 (
-        PCH_PCR_ADDRESS (GpioCom, PadCfgReg + 0x4),
-        ~PadCfgDwRegMask[1],
-        PadCfgDwReg[1]
-        );
+      if (PadCfgDwRegMask[1] != 0) {
+        MmioAndThenOr32 (
+          PCH_PCR_ADDRESS (GpioCom, PadCfgReg + 0x4),
+          ~PadCfgDwRegMask[1],
+          PadCfgDwReg[1]
+          );
+      }
 
       //
       // Write PADCFG DW2 register
       //
-      MmioAndThenOr32 (
-        PCH_PCR_ADDRESS (GpioCom, PadCfgReg + 0x8),
-        ~PadCfgDwRegMask[2],
-        PadCfgDwReg[2]
-        );
+      if (PadCfgDwRegMask[2] != 0) {
+        MmioAndThenOr32 (
+          PCH_PCR_ADDRESS (GpioCom, PadCfgReg + 0x8),
+          ~PadCfgDwRegMask[2],
+          PadCfgDwReg[2]
+          );
+      }
 
       //
       // Get GPIO DW register values from GPIO config data
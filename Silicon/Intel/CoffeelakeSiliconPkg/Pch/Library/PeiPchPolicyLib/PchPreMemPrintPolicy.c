@@ -8,6 +8,7 @@
 
 #include "PeiPchPolicyLibrary.h"
 #include <Library/ConfigBlockLib.h>
+#include <SiPolicyDumpHob.h>
 
 /**
   Print PCH_GENERAL_PREMEM_CONFIG and serial out.
@@ -249,6 +250,12 @@ PchPreMemPrintPolicyPpi (
   IN  SI_PREMEM_POLICY_PPI     *SiPreMemPolicyPpi
   )
 {
+  //
+  // Capture the whole table in binary first; it stays available even when
+  // serial logging is disabled.
+  //
+  PchDumpPolicyBinary (&gSiPreMemPolicyDumpHobGuid, (CONST VOID *) SiPreMemPolicyPpi);
+
   DEBUG_CODE_BEGIN ();
   EFI_STATUS                      Status;
   PCH_GENERAL_PREMEM_CONFIG       *PchGeneralPreMemConfig;
@@ -9,6 +9,41 @@
 #include "PeiPchPolicyLibrary.h"
 #include <Private/PchHsio.h>
 #include <Library/ConfigBlockLib.h>
+#include <Library/HobLib.h>
+#include <SiPolicyDumpHob.h>
+
+/**
+  Capture a policy config block table as one binary dump HOB.
+
+  The table is already self-describing: each config block starts with a
+  CONFIG_BLOCK_HEADER carrying its GUID, length and revision, so an offline
+  decoder can enumerate every policy blob without any text formatting on
+  the boot path.
+
+  @param[in] DumpHobGuid          GUID to publish the dump HOB with
+  @param[in] ConfigBlockTable     Pointer to the assembled config block table
+
+**/
+VOID
+PchDumpPolicyBinary (
+  IN EFI_GUID      *DumpHobGuid,
+  IN CONST VOID    *ConfigBlockTable
+  )
+{
+  CONST CONFIG_BLOCK_TABLE_HEADER *TableHeader;
+  UINT16                          TableSize;
+  VOID                            *HobData;
+
+  TableHeader = (CONST CONFIG_BLOCK_TABLE_HEADER *) ConfigBlockTable;
+  TableSize   = TableHeader->Header.GuidHob.Header.HobLength;
+
+  HobData = BuildGuidHob (DumpHobGuid, TableSize);
+  if (HobData == NULL) {
+    DEBUG ((DEBUG_WARN, "PchDumpPolicyBinary: unable to build 0x%x byte policy dump HOB\n", TableSize));
+    return;
+  }
+  CopyMem (HobData, ConfigBlockTable, TableSize);
+}
 
 /**
   Print USB_CONFIG and serial out.
@@ -680,6 +715,12 @@ PchPrintPolicyPpi (
   IN  SI_POLICY_PPI     *SiPolicyPpi
   )
 {
+  //
+  // Capture the whole table in binary first; it stays available even when
+  // serial logging is disabled.
+  //
+  PchDumpPolicyBinary (&gSiPolicyDumpHobGuid, (CONST VOID *) SiPolicyPpi);
+
 DEBUG_CODE_BEGIN();
   EFI_STATUS                      Status;
   PCH_GENERAL_CONFIG              *PchGeneralConfig;
@@ -31,4 +31,16 @@ LoadDeviceInterruptConfig (
   IN OUT  PCH_INTERRUPT_CONFIG  *InterruptConfig
   );
 
+/**
+  Capture a policy config block table as one binary dump HOB for an offline decoder.
+
+  @param[in] DumpHobGuid          GUID to publish the dump HOB with
+  @param[in] ConfigBlockTable     Pointer to the assembled config block table
+**/
+VOID
+PchDumpPolicyBinary (
+  IN EFI_GUID      *DumpHobGuid,
+  IN CONST VOID    *ConfigBlockTable
+  );
+
 #endif // _PEI_PCH_POLICY_LIBRARY_H_
@@ -94,6 +94,109 @@ typedef struct {
   SBDF   Entry [MAX_SBDF_TABLE_SIZE];
 } SBDF_TABLE;
 
+//
+// The capability offset cache remembers where a capability was found in a device's config space.
+// ASPM, LTR and AER flows all re-walk the same capability linked lists, so across all root ports
+// and their endpoints the walks add up to thousands of redundant config reads per boot.
+// Capability layout never changes for a given device, so only positive results are cached;
+// a miss is re-walked every time because the device may appear later (e.g. after link training).
+// The cache is keyed by flat config address, so it must be dropped whenever the bus:device mapping
+// may have changed - see PcieCapOffsetCacheInvalidate ()
+//
+#define PCIE_CAP_CACHE_MAX_ENTRIES 64
+
+typedef struct {
+  UINT64  DeviceBase;
+  UINT16  CapId;
+  BOOLEAN Extended;
+  UINT16  CapOffset;
+} PCIE_CAP_CACHE_ENTRY;
+
+STATIC PCIE_CAP_CACHE_ENTRY mPcieCapCache[PCIE_CAP_CACHE_MAX_ENTRIES];
+STATIC UINT32               mPcieCapCacheCount = 0;
+STATIC UINT32               mPcieCapCacheEvict = 0;
+
+/**
+  Searches the capability offset cache for a previously found capability
+
+  @param[in]  DeviceBase      device's base address
+  @param[in]  CapId           CAPID to search for
+  @param[in]  Extended        TRUE for extended capabilities, FALSE for standard ones
+  @param[out] CapOffset       offset of the capability, valid only when function returns TRUE
+
+  @retval TRUE when the offset was found in the cache; FALSE otherwise
+**/
+STATIC
+BOOLEAN
+PcieCapCacheLookup (
+  IN  UINT64   DeviceBase,
+  IN  UINT16   CapId,
+  IN  BOOLEAN  Extended,
+  OUT UINT16   *CapOffset
+  )
+{
+  UINT32 Index;
+
+  for (Index = 0; Index < mPcieCapCacheCount; Index++) {
+    if ((mPcieCapCache[Index].DeviceBase == DeviceBase) &&
+        (mPcieCapCache[Index].CapId == CapId) &&
+        (mPcieCapCache[Index].Extended == Extended)) {
+      *CapOffset = mPcieCapCache[Index].CapOffset;
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+/**
+  Remembers a capability offset found by walking device's config space
+
+  @param[in] DeviceBase      device's base address
+  @param[in] CapId           CAPID that was searched for
+  @param[in] Extended        TRUE for extended capabilities, FALSE for standard ones
+  @param[in] CapOffset       offset the capability was found at
+**/
+STATIC
+VOID
+PcieCapCacheInsert (
+  IN UINT64   DeviceBase,
+  IN UINT16   CapId,
+  IN BOOLEAN  Extended,
+  IN UINT16   CapOffset
+  )
+{
+  UINT32 Index;
+
+  if (mPcieCapCacheCount < PCIE_CAP_CACHE_MAX_ENTRIES) {
+    Index = mPcieCapCacheCount++;
+  } else {
+    //
+    // Table full - recycle the oldest slot. Correctness doesn't suffer,
+    // the evicted device will simply be re-walked on its next lookup.
+    //
+    Index = mPcieCapCacheEvict;
+    mPcieCapCacheEvict = (mPcieCapCacheEvict + 1) % PCIE_CAP_CACHE_MAX_ENTRIES;
+  }
+  mPcieCapCache[Index].DeviceBase = DeviceBase;
+  mPcieCapCache[Index].CapId      = CapId;
+  mPcieCapCache[Index].Extended   = Extended;
+  mPcieCapCache[Index].CapOffset  = CapOffset;
+}
+
+/**
+  Invalidates the capability offset cache used by PcieFindCapId () and PcieFindExtendedCapId ().
+  Must be called whenever the bus:device mapping may have changed, that is after
+  hot-plug, hot-unplug or bus renumbering.
+**/
+VOID
+PcieCapOffsetCacheInvalidate (
+  VOID
+  )
+{
+  mPcieCapCacheCount = 0;
+  mPcieCapCacheEvict = 0;
+}
+
 /**
   Converts device's segment:bus:device:function coordinates to flat address
 
@@ -262,8 +365,9 @@ TpoToUs (
   @retval 0                       CAPID not found (this includes situation where device doesn't exit)
   @retval Other                   CAPID found, Offset of desired CAPID
 **/
+STATIC
 UINT8
-PcieBaseFindCapId (
+PcieBaseWalkCapId (
   IN UINT64  DeviceBase,
   IN UINT8   CapId
   )
@@ -326,6 +430,41 @@ PcieBaseFindCapId (
   }
 }
 
+/**
+  Finds the Offset to a given Capabilities ID
+  The offset is served from the capability offset cache when possible; the capability
+  linked list in device's pci cfg is only walked on a cache miss.
+  CAPID list:
+    0x01 = PCI Power Management Interface
+    0x04 = Slot Identification
+    0x05 = MSI Capability
+    0x10 = PCI Express Capability
+
+  @param[in] DeviceBase           device's base address
+  @param[in] CapId                CAPID to search for
+
+  @retval 0                       CAPID not found (this includes situation where device doesn't exist)
+  @retval Other                   CAPID found, Offset of desired CAPID
+**/
+UINT8
+PcieBaseFindCapId (
+  IN UINT64  DeviceBase,
+  IN UINT8   CapId
+  )
+{
+  UINT16 CachedOffset;
+  UINT8  CapHeaderOffset;
+
+  if (PcieCapCacheLookup (DeviceBase, CapId, FALSE, &CachedOffset)) {
+    return (UINT8) CachedOffset;
+  }
+  CapHeaderOffset = PcieBaseWalkCapId (DeviceBase, CapId);
+  if (CapHeaderOffset != 0) {
+    PcieCapCacheInsert (DeviceBase, CapId, FALSE, CapHeaderOffset);
+  }
+  return CapHeaderOffset;
+}
+
 /**
   Find the Offset to a given Capabilities ID
   CAPID list:
@@ -373,8 +512,9 @@ PcieFindCapId (
   @retval 0                       CAPID not found, this includes situation where device doesn't exist
   @retval Other                   CAPID found, Offset of desired CAPID
 **/
+STATIC
 UINT16
-PcieBaseFindExtendedCapId (
+PcieBaseWalkExtendedCapId (
   IN UINT64  DeviceBase,
   IN UINT16  CapId
   )
@@ -403,6 +543,40 @@ PcieBaseFindExtendedCapId (
   return 0;
 }
 
+/**
+  Search and return the offset of desired Pci Express Capability ID
+  The offset is served from the capability offset cache when possible; the extended capability
+  list in device's extended config space is only walked on a cache miss.
+  CAPID list:
+    0x0001 = Advanced Error Reporting Capability
+    0x0002 = Virtual Channel Capability
+    0x0003 = Device Serial Number Capability
+    0x0004 = Power Budgeting Capability
+
+  @param[in] DeviceBase           device base address
+  @param[in] CapId                Extended CAPID to search for
+
+  @retval 0                       CAPID not found, this includes situation where device doesn't exist
+  @retval Other                   CAPID found, Offset of desired CAPID
+**/
+UINT16
+PcieBaseFindExtendedCapId (
+  IN UINT64  DeviceBase,
+  IN UINT16  CapId
+  )
+{
+  UINT16 CapHeaderOffset;
+
+  if (PcieCapCacheLookup (DeviceBase, CapId, TRUE, &CapHeaderOffset)) {
+    return CapHeaderOffset;
+  }
+  CapHeaderOffset = PcieBaseWalkExtendedCapId (DeviceBase, CapId);
+  if (CapHeaderOffset != 0) {
+    PcieCapCacheInsert (DeviceBase, CapId, TRUE, CapHeaderOffset);
+  }
+  return CapHeaderOffset;
+}
+
 /**
   Search and return the offset of desired Pci Express Capability ID
   CAPID list:
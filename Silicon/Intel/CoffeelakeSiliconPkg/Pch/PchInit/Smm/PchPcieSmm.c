@@ -52,6 +52,12 @@ PchPcieSmi (
   BOOLEAN               DownstreamDevicePresent;
   UINT32                Timeout;
 
+  //
+  // The device behind this port (and everything below it) may have just changed;
+  // drop cached capability offsets so stale ones are not reused.
+  //
+  PcieCapOffsetCacheInvalidate ();
+
   RpBase   = PCI_SEGMENT_LIB_ADDRESS (
                DEFAULT_PCI_SEGMENT_NUMBER_PCH,
                mPchBusNumber,
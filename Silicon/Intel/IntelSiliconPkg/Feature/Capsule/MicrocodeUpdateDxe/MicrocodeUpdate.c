@@ -166,6 +166,126 @@ LoadMicrocodeOnThis (
   }
 }
 
+/**
+  Load Microcode on an Application Processor if it matches the target processor.
+  The function prototype for invoking a function on an Application Processor.
+
+  The Application Processor compares its own processor signature and platform ID
+  against the ones recorded for the processor which verified the Microcode, and
+  only loads the Microcode when they agree. The loaded revision is recorded for
+  the per-processor status check done by the caller.
+
+  @param[in,out] Buffer  The pointer to private data buffer.
+**/
+VOID
+EFIAPI
+MicrocodeLoadAllAp (
+  IN OUT VOID  *Buffer
+  )
+{
+  EFI_STATUS                           Status;
+  MICROCODE_LOAD_ALL_BUFFER            *MicrocodeLoadAllBuffer;
+  MICROCODE_FMP_PRIVATE_DATA           *MicrocodeFmpPrivate;
+  PROCESSOR_INFO                       *ProcessorInfo;
+  UINTN                                CpuIndex;
+
+  MicrocodeLoadAllBuffer = Buffer;
+  MicrocodeFmpPrivate = MicrocodeLoadAllBuffer->MicrocodeFmpPrivate;
+  CpuIndex = 0;
+  Status = MicrocodeFmpPrivate->MpService->WhoAmI (MicrocodeFmpPrivate->MpService, &CpuIndex);
+  if (EFI_ERROR(Status)) {
+    return;
+  }
+  ProcessorInfo = &MicrocodeFmpPrivate->ProcessorInfo[CpuIndex];
+  if ((ProcessorInfo->ProcessorSignature != MicrocodeLoadAllBuffer->ProcessorSignature) ||
+      (ProcessorInfo->PlatformId != MicrocodeLoadAllBuffer->PlatformId)) {
+    return;
+  }
+  ProcessorInfo->MicrocodeRevision = LoadMicrocode (MicrocodeLoadAllBuffer->Address);
+}
+
+/**
+  Load new Microcode on all processors matching the target processor.
+
+  VerifyMicrocode() with TryLoad only loads the Microcode on the single
+  processor which matched it, so the remaining processors keep running the old
+  revision until the next reset. This function broadcasts the already verified
+  Microcode to every processor with the same processor signature and platform
+  ID, and reports every processor which did not reach the new revision.
+
+  When PcdMicrocodeParallelLoad is TRUE the Application Processors load the
+  Microcode concurrently. The default is the serialized broadcast, which is
+  required on processors where a Microcode update must not be performed on two
+  logical processors of the same core at the same time.
+
+  @param[in]  MicrocodeFmpPrivate        The Microcode driver private data
+  @param[in]  TargetCpuIndex             The index of the processor which verified the Microcode.
+  @param[in]  Address                    The address of new Microcode.
+  @param[in]  Revision                   The revision of new Microcode.
+**/
+VOID
+LoadMicrocodeOnAll (
+  IN  MICROCODE_FMP_PRIVATE_DATA  *MicrocodeFmpPrivate,
+  IN  UINTN                       TargetCpuIndex,
+  IN  UINT64                      Address,
+  IN  UINT32                      Revision
+  )
+{
+  EFI_STATUS                           Status;
+  EFI_MP_SERVICES_PROTOCOL             *MpService;
+  MICROCODE_LOAD_ALL_BUFFER            MicrocodeLoadAllBuffer;
+  PROCESSOR_INFO                       *ProcessorInfo;
+  UINTN                                Index;
+
+  MpService = MicrocodeFmpPrivate->MpService;
+  MicrocodeLoadAllBuffer.MicrocodeFmpPrivate = MicrocodeFmpPrivate;
+  MicrocodeLoadAllBuffer.Address = Address;
+  MicrocodeLoadAllBuffer.ProcessorSignature = MicrocodeFmpPrivate->ProcessorInfo[TargetCpuIndex].ProcessorSignature;
+  MicrocodeLoadAllBuffer.PlatformId = MicrocodeFmpPrivate->ProcessorInfo[TargetCpuIndex].PlatformId;
+
+  //
+  // The target processor already runs the new Microcode, just record it.
+  //
+  MicrocodeFmpPrivate->ProcessorInfo[TargetCpuIndex].MicrocodeRevision = Revision;
+
+  if (MicrocodeFmpPrivate->BspIndex != TargetCpuIndex) {
+    ProcessorInfo = &MicrocodeFmpPrivate->ProcessorInfo[MicrocodeFmpPrivate->BspIndex];
+    if ((ProcessorInfo->ProcessorSignature == MicrocodeLoadAllBuffer.ProcessorSignature) &&
+        (ProcessorInfo->PlatformId == MicrocodeLoadAllBuffer.PlatformId)) {
+      ProcessorInfo->MicrocodeRevision = LoadMicrocode (Address);
+    }
+  }
+
+  Status = MpService->StartupAllAPs (
+                        MpService,
+                        MicrocodeLoadAllAp,
+                        !PcdGetBool (PcdMicrocodeParallelLoad),
+                        NULL,
+                        0,
+                        &MicrocodeLoadAllBuffer,
+                        NULL
+                        );
+  if (EFI_ERROR(Status) && (Status != EFI_NOT_STARTED)) {
+    DEBUG((DEBUG_ERROR, "LoadMicrocodeOnAll - StartupAllAPs %r\n", Status));
+  }
+
+  //
+  // Per-processor status check. A processor left on the old revision is not
+  // fatal - the flash region is already updated and the next reset loads the
+  // new Microcode everywhere - but it is worth reporting.
+  //
+  for (Index = 0; Index < MicrocodeFmpPrivate->ProcessorCount; Index++) {
+    ProcessorInfo = &MicrocodeFmpPrivate->ProcessorInfo[Index];
+    if ((ProcessorInfo->ProcessorSignature != MicrocodeLoadAllBuffer.ProcessorSignature) ||
+        (ProcessorInfo->PlatformId != MicrocodeLoadAllBuffer.PlatformId)) {
+      continue;
+    }
+    if (ProcessorInfo->MicrocodeRevision != Revision) {
+      DEBUG((DEBUG_ERROR, "LoadMicrocodeOnAll - CPU 0x%x revision 0x%x (expected 0x%x)\n", ProcessorInfo->CpuIndex, ProcessorInfo->MicrocodeRevision, Revision));
+    }
+  }
+}
+
 /**
   Collect processor information.
   The function prototype for invoking a function on an Application Processor.
@@ -1318,6 +1438,19 @@ MicrocodeWrite (
                );
   }
 
+  if (!EFI_ERROR(Status)) {
+    //
+    // The flash region now carries the new Microcode. Bring the rest of the
+    // matching processors to the new revision without waiting for a reset.
+    //
+    LoadMicrocodeOnAll (
+      MicrocodeFmpPrivate,
+      TargetCpuIndex,
+      (UINTN)AlignedImage + sizeof(CPU_MICROCODE_HEADER),
+      ((CPU_MICROCODE_HEADER *)Image)->UpdateRevision
+      );
+  }
+
   FreePool(AlignedImage);
 
   return Status;
@@ -95,6 +95,13 @@ struct _MICROCODE_FMP_PRIVATE_DATA {
 
 typedef struct _MICROCODE_FMP_PRIVATE_DATA  MICROCODE_FMP_PRIVATE_DATA;
 
+typedef struct {
+  MICROCODE_FMP_PRIVATE_DATA  *MicrocodeFmpPrivate;
+  UINT64                      Address;
+  UINT32                      ProcessorSignature;
+  UINT8                       PlatformId;
+} MICROCODE_LOAD_ALL_BUFFER;
+
 #define MICROCODE_FMP_LAST_ATTEMPT_VARIABLE_NAME  L"MicrocodeLastAttemptVar"
 
 /**
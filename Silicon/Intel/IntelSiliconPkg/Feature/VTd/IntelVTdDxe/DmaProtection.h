@@ -219,6 +219,45 @@ InvalidateIOTLB (
   IN UINTN  VtdIndex
   );
 
+/**
+  Invalidate VTd IOTLB for a domain.
+
+  The invalidation is scoped by the domain ID, so the cached translations
+  of the other domains behind the same VTd engine are preserved.
+
+  When Wait is FALSE the invalidation descriptor is only queued: a later
+  synchronous invalidation on the same engine drains the whole batch with
+  one completion wait. The register-based interface has no queue and is
+  always synchronous.
+
+  @param[in]  VtdIndex              The index of VTd engine.
+  @param[in]  DomainIdentifier      The domain ID of the source.
+  @param[in]  Wait                  Wait for the invalidation to complete.
+
+  @retval EFI_SUCCESS           VTd IOTLB of the domain is invalidated.
+  @retval EFI_DEVICE_ERROR      VTd IOTLB of the domain is not invalidated.
+**/
+EFI_STATUS
+InvalidateVtdIOTLBDomain (
+  IN UINTN    VtdIndex,
+  IN UINT16   DomainIdentifier,
+  IN BOOLEAN  Wait
+  );
+
+/**
+  Wait until the remapping hardware unit has processed all queued
+  invalidation descriptors.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+
+  @retval EFI_SUCCESS           The invalidation queue is drained.
+  @retval RETURN_DEVICE_ERROR   A fault is detected.
+**/
+EFI_STATUS
+WaitQueuedInvalidationComplete (
+  IN UINTN  VtdIndex
+  );
+
 /**
   Invalid VTd global IOTLB.
 
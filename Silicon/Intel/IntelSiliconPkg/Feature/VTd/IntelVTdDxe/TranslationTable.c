@@ -293,6 +293,27 @@ CreateSecondLevelPagingEntryTable (
 
       Lvl3PtEntry = (VTD_SECOND_LEVEL_PAGING_ENTRY *)(UINTN)VTD_64BITS_ADDRESS(Lvl4PtEntry[Index4].Bits.AddressLo, Lvl4PtEntry[Index4].Bits.AddressHi);
       for (Index3 = Lvl3Start; Index3 <= Lvl3End; Index3++) {
+        //
+        // Map a whole aligned gigabyte with one 1GB leaf entry when the
+        // engine supports it. This removes the Lvl2 table (512 x 2MB
+        // entries) per gigabyte and the time to fill it, which dominates
+        // the table footprint and setup latency on large-memory systems.
+        // SplitSecondLevelPage demotes the entry later if a finer-grained
+        // mapping is requested.
+        //
+        if (((mVtdUnitInformation[VtdIndex].CapReg.Bits.SLLPS & BIT1) != 0) &&
+            (Lvl3PtEntry[Index3].Uint64 == 0) &&
+            ((BaseAddress & (SIZE_1GB - 1)) == 0) &&
+            (BaseAddress + SIZE_1GB <= EndAddress)) {
+          Lvl3PtEntry[Index3].Uint64 = BaseAddress;
+          SetSecondLevelPagingEntryAttribute (&Lvl3PtEntry[Index3], IoMmuAccess);
+          Lvl3PtEntry[Index3].Bits.PageSize = 1;
+          BaseAddress += SIZE_1GB;
+          if (BaseAddress >= MemoryLimit) {
+            break;
+          }
+          continue;
+        }
         if (Lvl3PtEntry[Index3].Uint64 == 0) {
           Lvl3PtEntry[Index3].Uint64 = (UINT64)(UINTN)AllocateZeroPages (1);
           if (Lvl3PtEntry[Index3].Uint64 == 0) {
@@ -389,7 +410,7 @@ SetupTranslationTable (
         ASSERT(FALSE);
         Status = EFI_UNSUPPORTED;
       } else {
-        Status = CreateContextEntry (Index);
+        Status = CreateContextEntry (Index);
       }
     } else {
       if (mVtdUnitInformation[Index].ECapReg.Bits.DEP_24) {
@@ -513,6 +534,10 @@ DumpSecondLevelPagingEntry (
         if (Lvl3PtEntry[Index3].Uint64 == 0) {
           continue;
         }
+        if (Lvl3PtEntry[Index3].Bits.PageSize == 1) {
+          // 1G leaf entry, no Lvl2 table behind it
+          continue;
+        }
 
         Lvl2PtEntry = (VTD_SECOND_LEVEL_PAGING_ENTRY *)(UINTN)VTD_64BITS_ADDRESS(Lvl3PtEntry[Index3].Bits.AddressLo, Lvl3PtEntry[Index3].Bits.AddressHi);
         for (Index2 = 0; Index2 < SIZE_4KB/sizeof(VTD_SECOND_LEVEL_PAGING_ENTRY); Index2++) {
@@ -540,15 +565,39 @@ DumpSecondLevelPagingEntry (
 /**
   Invalid page entry.
 
-  @param VtdIndex  The VTd engine index.
+  @param VtdIndex          The VTd engine index.
+  @param DomainIdentifier  The domain ID of the source.
+  @param IoMmuAccess       The IOMMU access the page entries were set to.
 **/
 VOID
 InvalidatePageEntry (
-  IN UINTN                 VtdIndex
+  IN UINTN                 VtdIndex,
+  IN UINT16                DomainIdentifier,
+  IN UINT64                IoMmuAccess
   )
 {
-  if (mVtdUnitInformation[VtdIndex].HasDirtyContext || mVtdUnitInformation[VtdIndex].HasDirtyPages) {
+  BOOLEAN  Wait;
+
+  //
+  // A revocation must not return before the stale translation is gone.
+  // When access is only granted and the engine does not cache
+  // not-present entries (Caching Mode is clear), the queued descriptor
+  // may drain later without a correctness risk, so a Map storm pays for
+  // one completion wait per batch instead of one per call.
+  //
+  Wait = (IoMmuAccess == 0) ||
+         (mVtdUnitInformation[VtdIndex].CapReg.Bits.CM != 0);
+
+  if (mVtdUnitInformation[VtdIndex].HasDirtyContext) {
     InvalidateVtdIOTLBGlobal (VtdIndex);
+  } else if (mVtdUnitInformation[VtdIndex].HasDirtyPages) {
+    //
+    // Only the page table of one domain is updated.
+    // A domain scoped invalidation keeps the IOTLB footprint of the other
+    // domains intact, so the mapping churn of one device does not drop the
+    // cached translations of the others behind the same VTd engine.
+    //
+    InvalidateVtdIOTLBDomain (VtdIndex, DomainIdentifier, Wait);
   }
   mVtdUnitInformation[VtdIndex].HasDirtyContext = FALSE;
   mVtdUnitInformation[VtdIndex].HasDirtyPages = FALSE;
@@ -685,16 +734,28 @@ GetSecondLevelPageTableEntry (
 
   L3PageTable = (UINT64 *)(UINTN)(L4PageTable[Index4] & PAGING_4K_ADDRESS_MASK_64);
   if (L3PageTable[Index3] == 0) {
-    L3PageTable[Index3] = (UINT64)(UINTN)AllocateZeroPages (1);
-    if (L3PageTable[Index3] == 0) {
-      DEBUG ((DEBUG_ERROR,"!!!!!! ALLOCATE LVL3 PAGE FAIL (0x%x, 0x%x)!!!!!!\n", Index4, Index3));
-      ASSERT(FALSE);
-      *PageAttribute = PageNone;
-      return NULL;
+    if ((mVtdUnitInformation[VtdIndex].CapReg.Bits.SLLPS & BIT1) != 0) {
+      //
+      // Populate an untouched gigabyte with a no-access 1G leaf instead of
+      // a Lvl2 table, mirroring the 2M handling below. NeedSplitPage
+      // demotes it when a finer-grained mapping is requested.
+      //
+      L3PageTable[Index3] = Address & PAGING_1G_ADDRESS_MASK_64;
+      SetSecondLevelPagingEntryAttribute ((VTD_SECOND_LEVEL_PAGING_ENTRY *)&L3PageTable[Index3], 0);
+      L3PageTable[Index3] |= VTD_PG_PS;
+      FlushPageTableMemory (VtdIndex, (UINTN)&L3PageTable[Index3], sizeof(L3PageTable[Index3]));
+    } else {
+      L3PageTable[Index3] = (UINT64)(UINTN)AllocateZeroPages (1);
+      if (L3PageTable[Index3] == 0) {
+        DEBUG ((DEBUG_ERROR,"!!!!!! ALLOCATE LVL3 PAGE FAIL (0x%x, 0x%x)!!!!!!\n", Index4, Index3));
+        ASSERT(FALSE);
+        *PageAttribute = PageNone;
+        return NULL;
+      }
+      FlushPageTableMemory (VtdIndex, (UINTN)L3PageTable[Index3], SIZE_4KB);
+      SetSecondLevelPagingEntryAttribute ((VTD_SECOND_LEVEL_PAGING_ENTRY *)&L3PageTable[Index3], EDKII_IOMMU_ACCESS_READ | EDKII_IOMMU_ACCESS_WRITE);
+      FlushPageTableMemory (VtdIndex, (UINTN)&L3PageTable[Index3], sizeof(L3PageTable[Index3]));
     }
-    FlushPageTableMemory (VtdIndex, (UINTN)L3PageTable[Index3], SIZE_4KB);
-    SetSecondLevelPagingEntryAttribute ((VTD_SECOND_LEVEL_PAGING_ENTRY *)&L3PageTable[Index3], EDKII_IOMMU_ACCESS_READ | EDKII_IOMMU_ACCESS_WRITE);
-    FlushPageTableMemory (VtdIndex, (UINTN)&L3PageTable[Index3], sizeof(L3PageTable[Index3]));
   }
   if ((L3PageTable[Index3] & VTD_PG_PS) != 0) {
     // 1G
@@ -1098,7 +1159,7 @@ SetAccessAttribute (
     }
   }
 
-  InvalidatePageEntry (VtdIndex);
+  InvalidatePageEntry (VtdIndex, DomainIdentifier, IoMmuAccess);
 
   return EFI_SUCCESS;
 }
@@ -149,6 +149,12 @@ DisableQueuedInvalidationInterface (
   UINT32  Reg32;
 
   if (mVtdUnitInformation[VtdIndex].EnableQueuedInvalidation != 0) {
+    //
+    // Drain descriptors still queued by a deferred invalidation before
+    // the queue is torn down.
+    //
+    WaitQueuedInvalidationComplete (VtdIndex);
+
     Reg32 = MmioRead32 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + R_GSTS_REG);
     Reg32 &= (~B_GMCD_REG_QIE);
     MmioWrite32 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + R_GCMD_REG, Reg32);
@@ -209,18 +215,18 @@ QueuedInvalidationCheckFault (
 }
 
 /**
-  Submit the queued invalidation descriptor to the remapping
-   hardware unit and wait for its completion.
+  Queue one invalidation descriptor to the remapping hardware unit
+  without waiting for its completion.
 
   @param[in]  VtdIndex          The index used to identify a VTd engine.
   @param[in]  Desc              The invalidate descriptor
 
-  @retval EFI_SUCCESS           The operation was successful.
+  @retval EFI_SUCCESS           The descriptor is queued.
   @retval RETURN_DEVICE_ERROR   A fault is detected.
   @retval EFI_INVALID_PARAMETER Parameter is invalid.
 **/
 EFI_STATUS
-SubmitQueuedInvalidationDescriptor (
+QueueInvalidationDescriptor (
   IN UINTN    VtdIndex,
   IN QI_DESC  *Desc
   )
@@ -240,6 +246,20 @@ SubmitQueuedInvalidationDescriptor (
 
   DEBUG((DEBUG_VERBOSE, "[%d] Submit QI Descriptor [0x%08x, 0x%08x] Free Head (%d)\n", VtdIndex, Desc->Low, Desc->High, mVtdUnitInformation[VtdIndex].QiFreeHead));
 
+  //
+  // If the queue is full of unprocessed descriptors, wait for the
+  // hardware to catch up before overwriting one it has not fetched.
+  //
+  do {
+    Status = QueuedInvalidationCheckFault(VtdIndex);
+    if (Status != EFI_SUCCESS) {
+      DEBUG((DEBUG_ERROR,"Detect Queued Invalidation Fault.\n"));
+      return Status;
+    }
+
+    Reg64Iqh = MmioRead64 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + R_IQH_REG);
+  } while (((mVtdUnitInformation[VtdIndex].QiFreeHead + 1) % QiDescLength) == (Reg64Iqh >> DMAR_IQ_SHIFT));
+
   BaseDesc[mVtdUnitInformation[VtdIndex].QiFreeHead].Low = Desc->Low;
   BaseDesc[mVtdUnitInformation[VtdIndex].QiFreeHead].High = Desc->High;
   FlushPageTableMemory(VtdIndex, (UINTN) &BaseDesc[mVtdUnitInformation[VtdIndex].QiFreeHead], sizeof(QI_DESC));
@@ -252,6 +272,33 @@ SubmitQueuedInvalidationDescriptor (
   Reg64Iqt = mVtdUnitInformation[VtdIndex].QiFreeHead << DMAR_IQ_SHIFT;
   MmioWrite64 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + R_IQT_REG, Reg64Iqt);
 
+  return EFI_SUCCESS;
+}
+
+/**
+  Wait until the remapping hardware unit has processed all queued
+  invalidation descriptors.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+
+  @retval EFI_SUCCESS           The invalidation queue is drained.
+  @retval RETURN_DEVICE_ERROR   A fault is detected.
+**/
+EFI_STATUS
+WaitQueuedInvalidationComplete (
+  IN UINTN  VtdIndex
+  )
+{
+  EFI_STATUS Status;
+  UINT64     Reg64Iqt;
+  UINT64     Reg64Iqh;
+
+  if (mVtdUnitInformation[VtdIndex].EnableQueuedInvalidation == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Reg64Iqt = mVtdUnitInformation[VtdIndex].QiFreeHead << DMAR_IQ_SHIFT;
+
   Status = EFI_SUCCESS;
   do {
     Status = QueuedInvalidationCheckFault(VtdIndex);
@@ -266,6 +313,33 @@ SubmitQueuedInvalidationDescriptor (
   return Status;
 }
 
+/**
+  Submit the queued invalidation descriptor to the remapping
+   hardware unit and wait for its completion.
+
+  @param[in]  VtdIndex          The index used to identify a VTd engine.
+  @param[in]  Desc              The invalidate descriptor
+
+  @retval EFI_SUCCESS           The operation was successful.
+  @retval RETURN_DEVICE_ERROR   A fault is detected.
+  @retval EFI_INVALID_PARAMETER Parameter is invalid.
+**/
+EFI_STATUS
+SubmitQueuedInvalidationDescriptor (
+  IN UINTN    VtdIndex,
+  IN QI_DESC  *Desc
+  )
+{
+  EFI_STATUS Status;
+
+  Status = QueueInvalidationDescriptor (VtdIndex, Desc);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  return WaitQueuedInvalidationComplete (VtdIndex);
+}
+
 /**
   Invalidate VTd context cache.
 
@@ -351,6 +425,78 @@ InvalidateIOTLB (
   return EFI_SUCCESS;
 }
 
+/**
+  Invalidate VTd IOTLB for a domain.
+
+  The invalidation is scoped by the domain ID, so the cached translations
+  of the other domains behind the same VTd engine are preserved.
+
+  When Wait is FALSE the invalidation descriptor is only queued: a later
+  synchronous invalidation on the same engine drains the whole batch with
+  one completion wait. The register-based interface has no queue and is
+  always synchronous.
+
+  @param[in]  VtdIndex              The index of VTd engine.
+  @param[in]  DomainIdentifier      The domain ID of the source.
+  @param[in]  Wait                  Wait for the invalidation to complete.
+
+  @retval EFI_SUCCESS           VTd IOTLB of the domain is invalidated.
+  @retval EFI_DEVICE_ERROR      VTd IOTLB of the domain is not invalidated.
+**/
+EFI_STATUS
+InvalidateVtdIOTLBDomain (
+  IN UINTN    VtdIndex,
+  IN UINT16   DomainIdentifier,
+  IN BOOLEAN  Wait
+  )
+{
+  UINT64     Reg64;
+  QI_DESC    QiDesc;
+
+  if (!mVtdEnabled) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG((DEBUG_VERBOSE, "InvalidateVtdIOTLBDomain(%d) Domain - %d\n", VtdIndex, DomainIdentifier));
+
+  //
+  // Write Buffer Flush before invalidation
+  //
+  FlushWriteBuffer (VtdIndex);
+
+  if (mVtdUnitInformation[VtdIndex].EnableQueuedInvalidation == 0) {
+    //
+    // Register-based Invalidation
+    //
+    Reg64 = MmioRead64 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + (mVtdUnitInformation[VtdIndex].ECapReg.Bits.IRO * 16) + R_IOTLB_REG);
+    if ((Reg64 & B_IOTLB_REG_IVT) != 0) {
+      DEBUG ((DEBUG_ERROR,"ERROR: InvalidateVtdIOTLBDomain: B_IOTLB_REG_IVT is set for VTD(%d)\n", VtdIndex));
+      return EFI_DEVICE_ERROR;
+    }
+
+    Reg64 &= ((~B_IOTLB_REG_IVT) & (~B_IOTLB_REG_IIRG_MASK) & (~LShiftU64 (0xFFFF, 32)));
+    Reg64 |= (B_IOTLB_REG_IVT | V_IOTLB_REG_IIRG_DOMAIN | LShiftU64 (DomainIdentifier, 32));
+    MmioWrite64 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + (mVtdUnitInformation[VtdIndex].ECapReg.Bits.IRO * 16) + R_IOTLB_REG, Reg64);
+
+    do {
+      Reg64 = MmioRead64 (mVtdUnitInformation[VtdIndex].VtdUnitBaseAddress + (mVtdUnitInformation[VtdIndex].ECapReg.Bits.IRO * 16) + R_IOTLB_REG);
+    } while ((Reg64 & B_IOTLB_REG_IVT) != 0);
+  } else {
+    //
+    // Queued Invalidation
+    //
+    QiDesc.Low = QI_IOTLB_DID(DomainIdentifier) | QI_IOTLB_DR(CAP_READ_DRAIN(mVtdUnitInformation[VtdIndex].CapReg.Uint64)) | QI_IOTLB_DW(CAP_WRITE_DRAIN(mVtdUnitInformation[VtdIndex].CapReg.Uint64)) | QI_IOTLB_GRAN(2) | QI_IOTLB_TYPE;
+    QiDesc.High = QI_IOTLB_ADDR(0) | QI_IOTLB_IH(0) | QI_IOTLB_AM(0);
+
+    if (!Wait) {
+      return QueueInvalidationDescriptor(VtdIndex, &QiDesc);
+    }
+    return SubmitQueuedInvalidationDescriptor(VtdIndex, &QiDesc);
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Invalid VTd global IOTLB.
 
@@ -416,6 +562,9 @@ PrepareVtdConfig (
     if ((mVtdUnitInformation[Index].CapReg.Bits.SLLPS & BIT0) == 0) {
       DEBUG((DEBUG_WARN, "!!!! 2MB super page is not supported on VTD %d !!!!\n", Index));
     }
+    if ((mVtdUnitInformation[Index].CapReg.Bits.SLLPS & BIT1) != 0) {
+      DEBUG((DEBUG_INFO, "Support 1GB super page on VTD %d\n", Index));
+    }
     if ((mVtdUnitInformation[Index].CapReg.Bits.SAGAW & BIT3) != 0) {
       DEBUG((DEBUG_INFO, "Support 5-level page-table on VTD %d\n", Index));
     }
@@ -11,11 +11,29 @@
 #include <Library/BaseMemoryLib.h>
 #include <Library/IoLib.h>
 #include <Library/DebugLib.h>
+#include <Library/HobLib.h>
 #include <IndustryStandard/Vtd.h>
 #include <Ppi/VtdInfo.h>
 
 #include "IntelVTdPmrPei.h"
 
+EFI_GUID mVTdPmrRangeCacheGuid = {
+  0x8b9f2fcd, 0x4377, 0x4a1f, { 0x91, 0x3b, 0x5d, 0x7e, 0xc3, 0x65, 0x1a, 0x27 }
+};
+
+//
+// Last PMR range programmed into the engines, kept in a GUID HOB so that
+// repeated DMA buffer notifications do not reprogram (and re-probe the
+// alignment of) every engine when the effective protected span is unchanged.
+//
+typedef struct {
+  UINT64                            EngineMask;
+  UINT32                            LowMemoryBase;
+  UINT32                            LowMemoryLength;
+  UINT64                            HighMemoryBase;
+  UINT64                            HighMemoryLength;
+} PMR_RANGE_CACHE;
+
 /**
   Get protected low memory alignment.
 
@@ -291,11 +309,36 @@ SetDmaProtectedRange (
   IN UINT64        HighMemoryLength
   )
 {
-  UINTN       Index;
-  EFI_STATUS  Status;
+  UINTN            Index;
+  EFI_STATUS       Status;
+  VOID             *Hob;
+  PMR_RANGE_CACHE  *RangeCache;
 
   DEBUG ((DEBUG_INFO, "SetDmaProtectedRange(0x%lx) - [0x%x, 0x%x] [0x%016lx, 0x%016lx]\n", EngineMask, LowMemoryBase, LowMemoryLength, HighMemoryBase, HighMemoryLength));
 
+  //
+  // Skip the engines entirely when the requested span matches what is
+  // already programmed and all requested engines still have PMR enabled.
+  //
+  Hob = GetFirstGuidHob (&mVTdPmrRangeCacheGuid);
+  if (Hob != NULL) {
+    RangeCache = GET_GUID_HOB_DATA (Hob);
+    if (((RangeCache->EngineMask & EngineMask) == EngineMask) &&
+        (RangeCache->LowMemoryBase    == LowMemoryBase) &&
+        (RangeCache->LowMemoryLength  == LowMemoryLength) &&
+        (RangeCache->HighMemoryBase   == HighMemoryBase) &&
+        (RangeCache->HighMemoryLength == HighMemoryLength) &&
+        (GetDmaProtectionEnabledEngineMask (VTdInfo, EngineMask) == EngineMask)) {
+      DEBUG ((DEBUG_INFO, "SetDmaProtectedRange - no boundary change, skip\n"));
+      return EFI_SUCCESS;
+    }
+  }
+
+  //
+  // Batch the update: program the region into every engine first, then
+  // enable them all in a second pass, so a multi-engine update is one
+  // sweep over the register sets instead of a full cycle per engine.
+  //
   for (Index = 0; Index < VTdInfo->VTdEngineCount; Index++) {
     if ((EngineMask & LShiftU64(1, Index)) == 0) {
       continue;
@@ -312,12 +355,43 @@ SetDmaProtectedRange (
     if (EFI_ERROR(Status)) {
       return Status;
     }
+  }
+
+  for (Index = 0; Index < VTdInfo->VTdEngineCount; Index++) {
+    if ((EngineMask & LShiftU64(1, Index)) == 0) {
+      continue;
+    }
     Status = EnablePmr ((UINTN)VTdInfo->VTdEngineAddress[Index]);
     if (EFI_ERROR(Status)) {
       return Status;
     }
   }
 
+  if (Hob == NULL) {
+    RangeCache = BuildGuidHob (&mVTdPmrRangeCacheGuid, sizeof(PMR_RANGE_CACHE));
+    if (RangeCache == NULL) {
+      //
+      // Cache is an optimization only; the registers are programmed.
+      //
+      return EFI_SUCCESS;
+    }
+    RangeCache->EngineMask = 0;
+  }
+  if ((RangeCache->LowMemoryBase    != LowMemoryBase) ||
+      (RangeCache->LowMemoryLength  != LowMemoryLength) ||
+      (RangeCache->HighMemoryBase   != HighMemoryBase) ||
+      (RangeCache->HighMemoryLength != HighMemoryLength)) {
+    //
+    // The span moved; engines outside this call no longer match the cache.
+    //
+    RangeCache->EngineMask = 0;
+  }
+  RangeCache->EngineMask      |= EngineMask;
+  RangeCache->LowMemoryBase    = LowMemoryBase;
+  RangeCache->LowMemoryLength  = LowMemoryLength;
+  RangeCache->HighMemoryBase   = HighMemoryBase;
+  RangeCache->HighMemoryLength = HighMemoryLength;
+
   return EFI_SUCCESS;
 }
 
@@ -335,11 +409,19 @@ DisableDmaProtection (
   IN UINT64        EngineMask
   )
 {
-  UINTN       Index;
-  EFI_STATUS  Status;
+  UINTN            Index;
+  EFI_STATUS       Status;
+  VOID             *Hob;
+  PMR_RANGE_CACHE  *RangeCache;
 
   DEBUG ((DEBUG_INFO, "DisableDmaProtection - 0x%lx\n", EngineMask));
 
+  Hob = GetFirstGuidHob (&mVTdPmrRangeCacheGuid);
+  if (Hob != NULL) {
+    RangeCache = GET_GUID_HOB_DATA (Hob);
+    RangeCache->EngineMask &= ~EngineMask;
+  }
+
   for (Index = 0; Index < VTdInfo->VTdEngineCount; Index++) {
     DEBUG ((DEBUG_INFO, "Disabling...%d\n", Index));
 
@@ -8,8 +8,19 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <PeiFspPolicyInitLib.h>
 #include <Library/FspWrapperApiLib.h>
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/PerformanceLib.h>
+
+//
+// FPDT "EventRec" identifiers bracketing FSP policy initialization.
+//
+#define PERF_ID_POLICY_INIT_PRE_MEM_BEGIN   0x5180
+#define PERF_ID_POLICY_INIT_PRE_MEM_END     0x5181
+#define PERF_ID_POLICY_INIT_POST_MEM_BEGIN  0x5182
+#define PERF_ID_POLICY_INIT_POST_MEM_END    0x5183
+
 /**
   Performs silicon pre-mem policy initialization.
 
@@ -68,6 +79,9 @@ SiliconPolicyInitPreMem (
     return NULL;
   }
   DEBUG ((DEBUG_INFO, "FspmUpdDataPtr - 0x%x\n", FspmUpdDataPtr));
+
+  PERF_START_EX (NULL, "EventRec", NULL, AsmReadTsc (), PERF_ID_POLICY_INIT_PRE_MEM_BEGIN);
+
   //
   // Initialize Intel PEI Platform Policy
   //
@@ -119,6 +133,8 @@ SiliconPolicyInitPreMem (
   //
   Status = PeiFspMiscUpdInitPreMem (FspmUpdDataPtr);
 
+  PERF_END_EX (NULL, "EventRec", NULL, AsmReadTsc (), PERF_ID_POLICY_INIT_PRE_MEM_END);
+
   return FspmUpdDataPtr;
 }
 
@@ -199,6 +215,9 @@ SiliconPolicyInitPostMem (
     return NULL;
   }
   DEBUG ((DEBUG_INFO, "FspsUpdDataPtr - 0x%x\n", FspsUpdDataPtr));
+
+  PERF_START_EX (NULL, "EventRec", NULL, AsmReadTsc (), PERF_ID_POLICY_INIT_POST_MEM_BEGIN);
+
   //
   // Initialize Intel PEI Platform Policy
   //
@@ -237,6 +256,8 @@ SiliconPolicyInitPostMem (
     DEBUG ((DEBUG_WARN, "ERROR - CPU Pei Fsp Policy Initialization fail, Status = %r\n", Status));
   }
 
+  PERF_END_EX (NULL, "EventRec", NULL, AsmReadTsc (), PERF_ID_POLICY_INIT_POST_MEM_END);
+
   return FspsUpdDataPtr;
 }
 
@@ -291,22 +291,28 @@ GpioConfigureSklPch (
       PadCfgReg = PAD_CFG_SIZE * PadNumber + GpioGroupInfo[GroupIndex].PadCfgOffset;
 
       //
-      // Write PADCFG DW0 register
+      // Write PADCFG DW0 register.
+      // Skip the access if every DW0 field is left at its hardware default,
+      // each PCR read-modify-write is expensive and would change nothing.
       //
-      MmioAndThenOr32 (
-        PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, PadCfgReg),
-        ~PadCfgDwRegMask[0],
-        PadCfgDwReg[0]
-        );
+      if (PadCfgDwRegMask[0] != 0) {
+        MmioAndThenOr32 (
+          PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, PadCfgReg),
+          ~PadCfgDwRegMask[0],
+          PadCfgDwReg[0]
+          );
+      }
 
       //
       // Write PADCFG DW1 register
       //
-      MmioAndThenOr32 (
-        PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, PadCfgReg + 0x4),
-        ~PadCfgDwRegMask[1],
-        PadCfgDwReg[1]
-        );
+      if (PadCfgDwRegMask[1] != 0) {
+        MmioAndThenOr32 (
+          PCH_PCR_ADDRESS (GpioGroupInfo[GroupIndex].Community, PadCfgReg + 0x4),
+          ~PadCfgDwRegMask[1],
+          PadCfgDwReg[1]
+          );
+      }
 
       //
       // Get GPIO DW register values from GPIO config data
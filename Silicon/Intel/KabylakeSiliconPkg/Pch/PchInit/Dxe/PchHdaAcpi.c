@@ -10,6 +10,27 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Guid/Acpi.h>
 #include <Library/PcdLib.h>
 #include <Library/PchHdaLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+
+//
+// Assembled-NHLT blob cache. The serialized table is stored in a variable
+// keyed by a CRC over the endpoint selection, so boards whose audio
+// endpoint set does not change install the cached blob directly and skip
+// table assembly on later boots.
+//
+#define NHLT_BLOB_CACHE_VARIABLE  L"NhltBlobCache"
+
+STATIC EFI_GUID mNhltBlobCacheGuid = {
+  0x34c3ff0a, 0x1cfd, 0x4c31, { 0xa6, 0x92, 0x97, 0x24, 0xd0, 0x2b, 0x4f, 0x92 }
+};
+
+typedef struct {
+  UINT32  EndpointKey;
+  UINT32  TableLength;
+  //
+  // Serialized NHLT table (TableLength bytes) follows.
+  //
+} NHLT_BLOB_CACHE_HEADER;
 
 PCH_HDA_NHLT_ENDPOINTS mPchHdaNhltEndpoints[HdaEndpointMax] =
 {
@@ -99,10 +120,14 @@ PublishNhltAcpiTable (
   NHLT_ACPI_TABLE                           *NhltTable;
   UINT32                                    TableLength;
   EFI_STATUS                                Status;
+  UINT32                                    EndpointKey;
+  NHLT_BLOB_CACHE_HEADER                    *BlobCache;
+  UINTN                                     BlobCacheSize;
 
   AcpiTable = NULL;
   NhltTable = NULL;
   AcpiTableKey = 0;
+  BlobCache = NULL;
 
   DEBUG ((DEBUG_INFO, "PublishNhltAcpiTable() Start\n"));
 
@@ -114,11 +139,66 @@ PublishNhltAcpiTable (
     return EFI_UNSUPPORTED;
   }
 
+  //
+  // Key the blob cache on the endpoint selection (type, formats bitmask and
+  // enable state of every endpoint).
+  //
+  EndpointKey = 0;
+  gBS->CalculateCrc32 (mPchHdaNhltEndpoints, sizeof (mPchHdaNhltEndpoints), &EndpointKey);
+
+  BlobCacheSize = 0;
+  Status = gRT->GetVariable (NHLT_BLOB_CACHE_VARIABLE, &mNhltBlobCacheGuid, NULL, &BlobCacheSize, NULL);
+  if (Status == EFI_BUFFER_TOO_SMALL) {
+    BlobCache = AllocatePool (BlobCacheSize);
+  }
+  if (BlobCache != NULL) {
+    Status = gRT->GetVariable (NHLT_BLOB_CACHE_VARIABLE, &mNhltBlobCacheGuid, NULL, &BlobCacheSize, BlobCache);
+    if (!EFI_ERROR (Status) &&
+        (BlobCacheSize >= sizeof (NHLT_BLOB_CACHE_HEADER)) &&
+        (BlobCache->EndpointKey == EndpointKey) &&
+        (BlobCacheSize == sizeof (NHLT_BLOB_CACHE_HEADER) + BlobCache->TableLength)) {
+      DEBUG ((DEBUG_INFO, "PublishNhltAcpiTable: installing cached NHLT blob (key 0x%08x)\n", EndpointKey));
+      Status = AcpiTable->InstallAcpiTable (
+                            AcpiTable,
+                            (UINT8 *) (BlobCache + 1),
+                            BlobCache->TableLength,
+                            &AcpiTableKey
+                            );
+      FreePool (BlobCache);
+      DEBUG ((DEBUG_INFO, "PublishNhltAcpiTable() End\n"));
+      return Status;
+    }
+    FreePool (BlobCache);
+    BlobCache = NULL;
+  }
+
   NhltConstructor (mPchHdaNhltEndpoints, &NhltTable, &TableLength);
   NhltAcpiHeaderConstructor (NhltTable, TableLength);
 
   Status = AcpiTable->InstallAcpiTable (AcpiTable, NhltTable, NhltTable->Header.Length, &AcpiTableKey);
 
+  //
+  // Serialize the freshly assembled table for the next boot. A failure to
+  // cache only costs the assembly time again.
+  //
+  if (!EFI_ERROR (Status)) {
+    BlobCacheSize = sizeof (NHLT_BLOB_CACHE_HEADER) + NhltTable->Header.Length;
+    BlobCache = AllocatePool (BlobCacheSize);
+    if (BlobCache != NULL) {
+      BlobCache->EndpointKey = EndpointKey;
+      BlobCache->TableLength = NhltTable->Header.Length;
+      CopyMem (BlobCache + 1, NhltTable, NhltTable->Header.Length);
+      gRT->SetVariable (
+             NHLT_BLOB_CACHE_VARIABLE,
+             &mNhltBlobCacheGuid,
+             EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+             BlobCacheSize,
+             BlobCache
+             );
+      FreePool (BlobCache);
+    }
+  }
+
   DEBUG ((DEBUG_INFO, "PublishNhltAcpiTable() End\n"));
   return Status;
 }
@@ -60,6 +60,127 @@ GLOBAL_REMOVE_IF_UNREFERENCED CONST CHAR8 *mMtrrMemoryCacheTypeShortName[] = {
   "R*"   // Invalid
 };
 
+//
+// Cache of attribute requests already applied to the live MTRRs. PCI
+// enumeration replays the same handful of range/type pairs, and each
+// replay used to pay for a full variable MTRR read, overlap scan and
+// reprogramming pass. A request matching a cached entry is known to be
+// in effect and is answered without touching the registers. An entry is
+// evicted when a different request overlaps its range, and the whole
+// cache is dropped whenever the MTRRs are rewritten wholesale.
+//
+#define MTRR_REQUEST_CACHE_SIZE  8
+
+typedef struct {
+  BOOLEAN                 Valid;
+  PHYSICAL_ADDRESS        BaseAddress;
+  UINT64                  Length;
+  MTRR_MEMORY_CACHE_TYPE  Attribute;
+} MTRR_REQUEST_CACHE_ENTRY;
+
+STATIC MTRR_REQUEST_CACHE_ENTRY  mMtrrRequestCache[MTRR_REQUEST_CACHE_SIZE];
+STATIC UINTN                     mMtrrRequestCacheNext;
+STATIC UINT32                    mMtrrSetRequests;
+STATIC UINT32                    mMtrrSetRequestHits;
+
+/**
+  Drops every cached attribute request. Called whenever the MTRRs are
+  written through a path that doesn't go through the request cache.
+
+**/
+STATIC
+VOID
+MtrrRequestCacheFlush (
+  VOID
+  )
+{
+  UINTN Index;
+
+  for (Index = 0; Index < MTRR_REQUEST_CACHE_SIZE; Index++) {
+    mMtrrRequestCache[Index].Valid = FALSE;
+  }
+}
+
+/**
+  Checks whether an identical attribute request was already applied.
+
+  @param[in]  BaseAddress   Start address of the requested region.
+  @param[in]  Length        Size in bytes of the requested region.
+  @param[in]  Attribute     Requested memory cache type.
+
+  @retval TRUE   The request is already in effect.
+  @retval FALSE  The request has to be computed and programmed.
+
+**/
+STATIC
+BOOLEAN
+MtrrRequestCacheLookup (
+  IN PHYSICAL_ADDRESS        BaseAddress,
+  IN UINT64                  Length,
+  IN MTRR_MEMORY_CACHE_TYPE  Attribute
+  )
+{
+  UINTN Index;
+
+  for (Index = 0; Index < MTRR_REQUEST_CACHE_SIZE; Index++) {
+    if (mMtrrRequestCache[Index].Valid &&
+        mMtrrRequestCache[Index].BaseAddress == BaseAddress &&
+        mMtrrRequestCache[Index].Length == Length &&
+        mMtrrRequestCache[Index].Attribute == Attribute) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+  Records a successfully applied attribute request, evicting cached
+  entries whose ranges the new request may have retyped.
+
+  @param[in]  BaseAddress   Start address of the applied region.
+  @param[in]  Length        Size in bytes of the applied region.
+  @param[in]  Attribute     Memory cache type that was applied.
+
+**/
+STATIC
+VOID
+MtrrRequestCacheInsert (
+  IN PHYSICAL_ADDRESS        BaseAddress,
+  IN UINT64                  Length,
+  IN MTRR_MEMORY_CACHE_TYPE  Attribute
+  )
+{
+  UINTN             Index;
+  PHYSICAL_ADDRESS  EvictBase;
+  UINT64            EvictLength;
+
+  //
+  // A request starting at exactly 1MB is extended down to 0 when the
+  // variable MTRRs are programmed, so evict on the extended range.
+  //
+  EvictBase = BaseAddress;
+  EvictLength = Length;
+  if (BaseAddress == BASE_1MB) {
+    EvictBase = 0;
+    EvictLength += SIZE_1MB;
+  }
+
+  for (Index = 0; Index < MTRR_REQUEST_CACHE_SIZE; Index++) {
+    if (mMtrrRequestCache[Index].Valid &&
+        mMtrrRequestCache[Index].BaseAddress < EvictBase + EvictLength &&
+        EvictBase < mMtrrRequestCache[Index].BaseAddress + mMtrrRequestCache[Index].Length) {
+      mMtrrRequestCache[Index].Valid = FALSE;
+    }
+  }
+
+  mMtrrRequestCache[mMtrrRequestCacheNext].Valid = TRUE;
+  mMtrrRequestCache[mMtrrRequestCacheNext].BaseAddress = BaseAddress;
+  mMtrrRequestCache[mMtrrRequestCacheNext].Length = Length;
+  mMtrrRequestCache[mMtrrRequestCacheNext].Attribute = Attribute;
+  mMtrrRequestCacheNext = (mMtrrRequestCacheNext + 1) % MTRR_REQUEST_CACHE_SIZE;
+}
+
 UINT64
 MtrrRegisterRead (
   IN  UINT32  MtrrRegister
@@ -1841,13 +1962,28 @@ MtrrSetMemoryAttribute (
   IN MTRR_MEMORY_CACHE_TYPE  Attribute
   )
 {
+  RETURN_STATUS  Status;
+
   DEBUG((DEBUG_CACHE, "MtrrSetMemoryAttribute() %a:%016lx-%016lx\n", mMtrrMemoryCacheTypeShortName[Attribute], BaseAddress, Length));
-  return MtrrSetMemoryAttributeWorker (
-           NULL,
-           BaseAddress,
-           Length,
-           Attribute
-           );
+
+  mMtrrSetRequests++;
+  if (MtrrRequestCacheLookup (BaseAddress, Length, Attribute)) {
+    mMtrrSetRequestHits++;
+    DEBUG ((DEBUG_CACHE, "  already applied (%u of %u requests cached)\n",
+      mMtrrSetRequestHits, mMtrrSetRequests));
+    return RETURN_SUCCESS;
+  }
+
+  Status = MtrrSetMemoryAttributeWorker (
+             NULL,
+             BaseAddress,
+             Length,
+             Attribute
+             );
+  if (!RETURN_ERROR (Status)) {
+    MtrrRequestCacheInsert (BaseAddress, Length, Attribute);
+  }
+  return Status;
 }
 
 /**
@@ -1943,6 +2079,7 @@ MtrrSetVariableMtrr (
   PreMtrrChange (&MtrrContext);
   MtrrSetVariableMtrrWorker (VariableSettings);
   PostMtrrChange (&MtrrContext);
+  MtrrRequestCacheFlush ();
   MtrrDebugPrintAllMtrrs ();
 
   return  VariableSettings;
@@ -1993,6 +2130,7 @@ MtrrSetFixedMtrr (
   PreMtrrChange (&MtrrContext);
   MtrrSetFixedMtrrWorker (FixedSettings);
   PostMtrrChange (&MtrrContext);
+  MtrrRequestCacheFlush ();
   MtrrDebugPrintAllMtrrs ();
 
   return FixedSettings;
@@ -2079,6 +2217,7 @@ MtrrSetAllMtrrs (
 
   PostMtrrChangeEnableCache (&MtrrContext);
 
+  MtrrRequestCacheFlush ();
   MtrrDebugPrintAllMtrrs ();
 
   return MtrrSetting;
@@ -1560,6 +1560,8 @@ static void rd_train(
 #define VREF_MAX (0x3F) // offset into "vref_codes[]" for maximum allowed VREF setting
 #define RDQS_MIN (0x00) // minimum RDQS delay value
 #define RDQS_MAX (0x3F) // maximum RDQS delay value
+#define RDQS_SEED_WINDOW 16 // half width of the narrowed RDQS re-sweep window around a stored centre
+#define VREF_SEED_WINDOW 16 // half width of the narrowed VREF re-sweep window around a stored centre
 #define B 0 // BOTTOM VREF
 #define T 1 // TOP VREF
 #define L 0 // LEFT RDQS
@@ -1577,6 +1579,8 @@ static void rd_train(
   uint8_t y_coordinate[2/*side_x*/][2/*side_y*/][NUM_CHANNELS][NUM_BYTE_LANES]; // Y coordinate data (passing VREF values) for approach vectors
   uint8_t x_center[NUM_CHANNELS][NUM_RANKS][NUM_BYTE_LANES]; // centered X (RDQS)
   uint8_t y_center[NUM_CHANNELS][NUM_BYTE_LANES]; // centered Y (VREF)
+  uint8_t seeded; // stored timings usable as search window seeds
+  uint32_t seedD; // stored centre for the current byte lane
   uint32_t address; // target address for "check_bls_ex()"
   uint32_t result; // result of "check_bls_ex()"
   uint32_t bl_mask; // byte lane mask for "result" checking
@@ -1608,6 +1612,13 @@ static void rd_train(
     } // if channel is enabled
   } // channel_i loop
 #else
+  // When stored timings were trained at this frequency against this same
+  // configuration (a forced retrain rather than a first boot or a config
+  // change) the previous centres are still a good estimate, so open the
+  // search windows around them instead of sweeping the full range.
+  seeded = ((mrc_params->ddr_speed == mrc_params->timings.ddr_speed) &&
+            (mrc_params->timings.cfg_signature == config_fingerprint(mrc_params))) ? 1 : 0;
+
   // initialise x/y_coordinate arrays
   for (channel_i = 0; channel_i < NUM_CHANNELS; channel_i++)
   {
@@ -1620,15 +1631,41 @@ static void rd_train(
           for (bl_i = 0; bl_i < (NUM_BYTE_LANES / bl_divisor); bl_i++)
           {
             // x_coordinate:
-            x_coordinate[L][B][channel_i][rank_i][bl_i] = RDQS_MIN;
-            x_coordinate[R][B][channel_i][rank_i][bl_i] = RDQS_MAX;
-            x_coordinate[L][T][channel_i][rank_i][bl_i] = RDQS_MIN;
-            x_coordinate[R][T][channel_i][rank_i][bl_i] = RDQS_MAX;
+            seedD = mrc_params->timings.rdqs[channel_i][rank_i][bl_i];
+            if (seeded && (seedD <= RDQS_MAX))
+            {
+              x_coordinate[L][B][channel_i][rank_i][bl_i] =
+                  (seedD > (RDQS_MIN + RDQS_SEED_WINDOW)) ? ((uint8_t) (seedD - RDQS_SEED_WINDOW)) : RDQS_MIN;
+              x_coordinate[R][B][channel_i][rank_i][bl_i] =
+                  (seedD < (RDQS_MAX - RDQS_SEED_WINDOW)) ? ((uint8_t) (seedD + RDQS_SEED_WINDOW)) : RDQS_MAX;
+              x_coordinate[L][T][channel_i][rank_i][bl_i] = x_coordinate[L][B][channel_i][rank_i][bl_i];
+              x_coordinate[R][T][channel_i][rank_i][bl_i] = x_coordinate[R][B][channel_i][rank_i][bl_i];
+            }
+            else
+            {
+              x_coordinate[L][B][channel_i][rank_i][bl_i] = RDQS_MIN;
+              x_coordinate[R][B][channel_i][rank_i][bl_i] = RDQS_MAX;
+              x_coordinate[L][T][channel_i][rank_i][bl_i] = RDQS_MIN;
+              x_coordinate[R][T][channel_i][rank_i][bl_i] = RDQS_MAX;
+            }
             // y_coordinate:
-            y_coordinate[L][B][channel_i][bl_i] = VREF_MIN;
-            y_coordinate[R][B][channel_i][bl_i] = VREF_MIN;
-            y_coordinate[L][T][channel_i][bl_i] = VREF_MAX;
-            y_coordinate[R][T][channel_i][bl_i] = VREF_MAX;
+            seedD = mrc_params->timings.vref[channel_i][bl_i];
+            if (seeded && (seedD <= VREF_MAX))
+            {
+              y_coordinate[L][B][channel_i][bl_i] =
+                  (seedD > (VREF_MIN + VREF_SEED_WINDOW)) ? ((uint8_t) (seedD - VREF_SEED_WINDOW)) : VREF_MIN;
+              y_coordinate[R][B][channel_i][bl_i] = y_coordinate[L][B][channel_i][bl_i];
+              y_coordinate[L][T][channel_i][bl_i] =
+                  (seedD < (VREF_MAX - VREF_SEED_WINDOW)) ? ((uint8_t) (seedD + VREF_SEED_WINDOW)) : VREF_MAX;
+              y_coordinate[R][T][channel_i][bl_i] = y_coordinate[L][T][channel_i][bl_i];
+            }
+            else
+            {
+              y_coordinate[L][B][channel_i][bl_i] = VREF_MIN;
+              y_coordinate[R][B][channel_i][bl_i] = VREF_MIN;
+              y_coordinate[L][T][channel_i][bl_i] = VREF_MAX;
+              y_coordinate[R][T][channel_i][bl_i] = VREF_MAX;
+            }
           } // bl_i loop
         } // if rank is enabled
       } // rank_i loop
@@ -2449,6 +2486,12 @@ void MemInit(
       // full training required as frequency changed
       mrc_params->boot_mode = bmCold;
     }
+    else if (mrc_params->timings.cfg_signature != config_fingerprint(mrc_params))
+    {
+      // full training required as stored timings were trained
+      // against a different memory configuration
+      mrc_params->boot_mode = bmCold;
+    }
   }
 
   for (i = 0; i < MCOUNT(init); i++)
@@ -1479,6 +1479,33 @@ void enable_scrambling(
   return;
 }
 
+// Fingerprint the configuration inputs that influence training results.
+// Stored timings are only trusted when the fingerprint computed on the
+// current boot matches the one they were trained with, so a memory down
+// configuration change (or an MRC algorithm change) forces retraining.
+uint32_t config_fingerprint(
+    MRCParams_t *mrc_params)
+{
+  uint32_t fp;
+
+  fp = MRC_VERSION;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->dram_width;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->ddr_type;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->ecc_enables;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->rank_enables;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->channel_enables;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->channel_width;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->address_mode;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->params.DENSITY;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->params.tCL;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->params.tRAS;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->params.tWTR;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->params.tRRD;
+  fp = ((fp << 5) | (fp >> 27)) ^ mrc_params->params.tFAW;
+
+  return fp;
+}
+
 // This function will store relevant timing data
 // This data will be used on subsequent boots to speed up boot times
 // and is required for Suspend To RAM capabilities.
@@ -1511,6 +1538,9 @@ void store_timings(
   // need to save for a case of changing frequency after warm reset
   mt->ddr_speed = mrc_params->ddr_speed;
 
+  // tag the results with the configuration they were trained against
+  mt->cfg_signature = config_fingerprint(mrc_params);
+
   return;
 }
 
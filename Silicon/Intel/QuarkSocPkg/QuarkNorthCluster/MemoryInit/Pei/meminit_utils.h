@@ -79,6 +79,7 @@ void training_message(uint8_t channel, uint8_t rank, uint8_t byte_lane);
 void print_timings(MRCParams_t *mrc_params);
 
 void enable_scrambling(MRCParams_t *mrc_params);
+uint32_t config_fingerprint(MRCParams_t *mrc_params);
 void store_timings(MRCParams_t *mrc_params);
 void restore_timings(MRCParams_t *mrc_params);
 void default_timings(MRCParams_t *mrc_params);
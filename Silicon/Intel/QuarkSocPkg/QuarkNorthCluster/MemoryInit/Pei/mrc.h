@@ -64,6 +64,7 @@ typedef struct MrcTimings_s
   uint32_t wcmd[NUM_CHANNELS];
 
   uint32_t scrambler_seed;
+  uint32_t cfg_signature;        // fingerprint of the configuration the timings were trained with
   uint8_t  ddr_speed;            // need to save for the case of frequency change
 } MrcTimings_t;
 
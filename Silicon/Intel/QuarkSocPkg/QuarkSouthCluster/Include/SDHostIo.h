@@ -95,6 +95,8 @@ typedef enum {
 #define  MMIO_HOSTCTL2                            0x3E
 #define  MMIO_CAP                                 0x40
 #define  MMIO_MCCAP                               0x48
+#define  MMIO_ADMAERRSTS                          0x54
+#define  MMIO_ADMAADR                             0x58
 #define  MMIO_SLTINTSTS                           0xFC
 #define  MMIO_CTRLRVER                            0xFE
 #define  MMIO_SRST                                0x1FC
@@ -445,6 +445,10 @@ SendCommand (
   UINT8                 Index;
   INTN                  TimeOut2;
   BOOLEAN               AutoCMD12Enable = FALSE;
+  BOOLEAN               UseAdma;
+  ADMA_DESC_LINE        *DescLine;
+  UINT32                Remaining;
+  UINT32                Address;
 
 
   Status             = EFI_SUCCESS;
@@ -460,7 +464,19 @@ SendCommand (
     goto Exit;
   }
 
-  if (((UINTN)Buffer & (This->HostCapability.BoundarySize - 1)) != (UINTN)NULL) {
+  //
+  // The ADMA2 engine scatter-gathers the request from descriptor lines,
+  // so it has no SDMA buffer boundary restriction. Word alignment is all
+  // the descriptor address field requires.
+  //
+  UseAdma = (BOOLEAN) (SDHostData->AdmaSupport &&
+                       (Buffer != NULL) &&
+                       (BufferSize != 0) &&
+                       (BufferSize <= This->HostCapability.BoundarySize) &&
+                       (((UINTN)Buffer & 0x3) == 0));
+
+  if (!UseAdma &&
+      ((UINTN)Buffer & (This->HostCapability.BoundarySize - 1)) != (UINTN)NULL) {
     Status = EFI_INVALID_PARAMETER;
     DEBUG ((EFI_D_ERROR, "SendCommand: invalid parameter \r\n"));
     goto Exit;
@@ -516,13 +532,71 @@ SendCommand (
 
 
   if (Buffer != NULL) {
+     if (UseAdma) {
+       //
+       // Build one descriptor line per ADMA_MAX_DESC_LENGTH chunk of the
+       // request; the engine walks the whole table in a single transfer.
+       //
+       DescLine  = SDHostData->AdmaDescTable;
+       Remaining = BufferSize;
+       Address   = (UINT32)(UINTN)Buffer;
+       do {
+         DescLine->Attribute = ADMA_DESC_ATTR_TRAN | ADMA_DESC_ATTR_VALID;
+         DescLine->Address   = Address;
+         if (Remaining <= ADMA_MAX_DESC_LENGTH) {
+           DescLine->Length     = (UINT16)Remaining;
+           DescLine->Attribute |= ADMA_DESC_ATTR_END;
+           break;
+         }
+         DescLine->Length = ADMA_MAX_DESC_LENGTH;
+         Remaining       -= ADMA_MAX_DESC_LENGTH;
+         Address         += ADMA_MAX_DESC_LENGTH;
+         DescLine++;
+       } while (TRUE);
+
+       Data = (UINT32)(UINTN)SDHostData->AdmaDescTable;
+       PciIo->Mem.Write (
+                    PciIo,
+                    EfiPciIoWidthUint32,
+                    0,
+                    (UINT64)MMIO_ADMAADR,
+                    1,
+                    &Data
+                    );
+     } else {
+       PciIo->Mem.Write (
+                    PciIo,
+                    EfiPciIoWidthUint32,
+                    0,
+                    (UINT64)MMIO_DMAADR,
+                    1,
+                    &Buffer
+                    );
+     }
+
+     //
+     // Select the DMA engine for this transfer in DMA Select (bits 4:3
+     // of the Host Control register): 10b for 32-bit ADMA2, 00b for SDMA.
+     //
+     PciIo->Mem.Read (
+                  PciIo,
+                  EfiPciIoWidthUint8,
+                  0,
+                  (UINT64)MMIO_HOSTCTL,
+                  1,
+                  &Data
+                  );
+     Data &= ~(BIT4 | BIT3);
+     if (UseAdma) {
+       Data |= BIT4;
+     }
      PciIo->Mem.Write (
                   PciIo,
-                  EfiPciIoWidthUint32,
+                  EfiPciIoWidthUint8,
                   0,
-                  (UINT64)MMIO_DMAADR,
+                  (UINT64)MMIO_HOSTCTL,
                   1,
-                  &Buffer
+                  &Data
                   );
 
      PciIo->Mem.Read (
@@ -1632,6 +1706,19 @@ SDControllerStart (
     SDHostData->SDHostIo.HostCapability.BusWidth8 = TRUE;
   }
 
+  if ((Data & BIT19) != 0) {
+    //
+    // ADMA2 capable controller. The descriptor table is reused for every
+    // data command, so allocate it once here; if the allocation fails we
+    // quietly keep using SDMA.
+    //
+    SDHostData->AdmaDescTable = AllocateZeroPool (ADMA_MAX_DESC_LINES * sizeof (ADMA_DESC_LINE));
+    if (SDHostData->AdmaDescTable != NULL) {
+      SDHostData->AdmaSupport = TRUE;
+      DEBUG ((EFI_D_INFO, "SdHostDriverBindingStart: ADMA2 supported \r\n"));
+    }
+  }
+
   if ((Data & BIT21) != 0) {
     SDHostData->SDHostIo.HostCapability.HighSpeedSupport = TRUE;
   }
@@ -1698,6 +1785,9 @@ SDControllerStart (
 Exit:
   if (EFI_ERROR (Status)) {
     if (SDHostData != NULL) {
+      if (SDHostData->AdmaDescTable != NULL) {
+        FreePool (SDHostData->AdmaDescTable);
+      }
       FreePool (SDHostData);
     }
   }
@@ -1768,6 +1858,10 @@ SDControllerStop (
 
   FreeUnicodeStringTable (SDHostData->ControllerNameTable);
 
+  if (SDHostData->AdmaDescTable != NULL) {
+    FreePool (SDHostData->AdmaDescTable);
+  }
+
   FreePool (SDHostData);
 
   gBS->CloseProtocol (
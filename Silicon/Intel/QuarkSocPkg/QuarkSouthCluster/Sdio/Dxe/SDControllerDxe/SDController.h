@@ -52,14 +52,35 @@ typedef struct {
   UINT8 BaseCode;
 } PCI_CLASSC;
 
+//
+// ADMA2 32-bit descriptor table line
+//
+typedef struct {
+  UINT16 Attribute;
+  UINT16 Length;
+  UINT32 Address;
+} ADMA_DESC_LINE;
+
 #pragma pack()
 
+#define ADMA_DESC_ATTR_VALID   BIT0
+#define ADMA_DESC_ATTR_END     BIT1
+#define ADMA_DESC_ATTR_TRAN    0x0020
+//
+// Length of data described by one descriptor line. The table is sized so
+// that a transfer of BoundarySize bytes, the most any caller may request
+// at once, always fits.
+//
+#define ADMA_MAX_DESC_LENGTH   0x8000
+#define ADMA_MAX_DESC_LINES    (((512 * 1024) / ADMA_MAX_DESC_LENGTH) + 1)
 
 typedef struct {
   UINTN                      Signature;
   EFI_SD_HOST_IO_PROTOCOL    SDHostIo;
   EFI_PCI_IO_PROTOCOL        *PciIo;
   BOOLEAN                    IsAutoStopCmd;
+  BOOLEAN                    AdmaSupport;
+  ADMA_DESC_LINE             *AdmaDescTable;
   UINT32                     BaseClockInMHz;
   UINT32                     CurrentClockInKHz;
   UINT32                     BlockLength;
@@ -343,7 +343,11 @@ OhciControlTransfer (
     *TransferResult = EFI_USB_ERR_SYSTEM;
     return EFI_DEVICE_ERROR;
   }
-  gBS->Stall(20 * 1000);
+  //
+  // The HC stops processing the control list at the next SOF,
+  // so one frame is long enough for the disable to take effect.
+  //
+  gBS->Stall (1000);
 
   OhciSetMemoryPointer (Ohc, HC_CONTROL_HEAD, NULL);
   Ed = OhciCreateED (Ohc);
@@ -418,9 +422,13 @@ OhciControlTransfer (
   ActualSendLength = DataMapLength;
   DataToggle = 1;
   while (LeftLength > 0) {
+    //
+    // The whole data stage fits in one TD since the request size is
+    // bounded by MAX_BYTES_PER_TD; the HC splits it into packets itself.
+    //
     ActualSendLength = LeftLength;
-    if (LeftLength > MaxPacketLength) {
-      ActualSendLength = MaxPacketLength;
+    if (LeftLength > MAX_BYTES_PER_TD) {
+      ActualSendLength = MAX_BYTES_PER_TD;
     }
     DataTd = OhciCreateTD (Ohc);
     if (DataTd == NULL) {
@@ -515,9 +523,6 @@ OhciControlTransfer (
     Status = EFI_DEVICE_ERROR;
     goto UNMAP_DATA_BUFF;
   }
-  gBS->Stall(20 * 1000);
-
-
   TimeCount = 0;
   Status = CheckIfDone (Ohc, CONTROL_LIST, Ed, HeadTd, &EdResult);
 
@@ -686,7 +691,11 @@ OhciBulkTransfer(
     *TransferResult = EFI_USB_ERR_SYSTEM;
     return EFI_DEVICE_ERROR;
   }
-  gBS->Stall(20 * 1000);
+  //
+  // Processing of the bulk list stops at the next SOF,
+  // so waiting one frame covers the disable.
+  //
+  gBS->Stall (1000);
 
   OhciSetMemoryPointer (Ohc, HC_BULK_HEAD, NULL);
 
@@ -724,9 +733,14 @@ OhciBulkTransfer(
   HeadTd = NULL;
   FirstTD = TRUE;
   while (LeftLength > 0) {
+    //
+    // The HC walks through a TD packet by packet on its own and a TD
+    // buffer may cross one page boundary, so fill each TD up to a page
+    // instead of a single packet to keep the TD list short.
+    //
     ActualSendLength = LeftLength;
-    if (LeftLength > MaxPacketLength) {
-      ActualSendLength = MaxPacketLength;
+    if (LeftLength > MAX_BYTES_PER_TD) {
+      ActualSendLength = MAX_BYTES_PER_TD;
     }
     DataTd = OhciCreateTD (Ohc);
     if (DataTd == NULL) {
@@ -753,7 +767,10 @@ OhciBulkTransfer(
     } else {
       OhciLinkTD (HeadTd, DataTd);
     }
-    *DataToggle ^= 1;
+    //
+    // The toggle advances once per packet carried by the TD
+    //
+    *DataToggle ^= (UINT8) (((ActualSendLength + MaxPacketLength - 1) / MaxPacketLength) & 1);
     MapPyhAddr += ActualSendLength;
     LeftLength -= ActualSendLength;
   }
@@ -799,8 +816,6 @@ OhciBulkTransfer(
     DEBUG ((EFI_D_INFO, "OhciControlTransfer: Fail to enable BULK_ENABLE\r\n"));
     goto FREE_OHCI_TDBUFF;
   }
-  gBS->Stall(20 * 1000);
-
   TimeCount = 0;
   Status = CheckIfDone (Ohc, BULK_LIST, Ed, HeadTd, &EdResult);
   while (Status == EFI_NOT_READY && TimeCount <= TimeOut) {
@@ -304,6 +304,50 @@ FREE_ED_BUFF:
   return Status;
 }
 
+/**
+  Get a TD for a bulk transfer, reusing one retired by an earlier
+  transfer when available.
+
+  @param  Ohc                   UHC private data.
+
+  @retval                       TD structure pointer.
+
+**/
+STATIC
+TD_DESCRIPTOR *
+OhciBulkAcquireTD (
+  IN USB_OHCI_HC_DEV             *Ohc
+  )
+{
+  TD_DESCRIPTOR                  *Td;
+
+  if (Ohc->BulkFreeTds != NULL) {
+    Td = Ohc->BulkFreeTds;
+    Ohc->BulkFreeTds = Td->NextTDPointer;
+    ZeroMem (Td, sizeof (TD_DESCRIPTOR));
+    return Td;
+  }
+  return OhciCreateTD (Ohc);
+}
+
+/**
+  Retire a bulk TD so the next transfer can reuse it.
+
+  @param  Ohc                   UHC private data.
+  @param  Td                    Pointer to the TD to retire.
+
+**/
+STATIC
+VOID
+OhciBulkReleaseTD (
+  IN USB_OHCI_HC_DEV             *Ohc,
+  IN TD_DESCRIPTOR               *Td
+  )
+{
+  Td->NextTDPointer = Ohc->BulkFreeTds;
+  Ohc->BulkFreeTds = Td;
+}
+
 /**
   Submits bulk transfer to a bulk endpoint of a USB device.
 
@@ -397,10 +441,20 @@ OhciBulkTransfer (
 
   OhciSetMemoryPointer (Ohc, HC_BULK_HEAD, NULL);
 
-  Ed = OhciCreateED (Ohc);
+  //
+  // Reuse the ED of the previous bulk transfer when there is one; every
+  // field is rewritten below. Recovery image reads issue long runs of
+  // sequential bulk transfers, so rebuilding descriptors per chunk is
+  // pure overhead.
+  //
+  Ed = Ohc->BulkEd;
   if (Ed == NULL) {
-    DEBUG ((EFI_D_INFO, "OhcBulkTransfer: Fail to allocate ED buffer\r\n"));
-    return EFI_OUT_OF_RESOURCES;
+    Ed = OhciCreateED (Ohc);
+    if (Ed == NULL) {
+      DEBUG ((EFI_D_INFO, "OhcBulkTransfer: Fail to allocate ED buffer\r\n"));
+      return EFI_OUT_OF_RESOURCES;
+    }
+    Ohc->BulkEd = Ed;
   }
   OhciSetEDField (Ed, ED_SKIP, 1);
   OhciSetEDField (Ed, ED_FUNC_ADD, DeviceAddress);
@@ -433,7 +487,7 @@ OhciBulkTransfer (
     if (LeftLength > MaxPacketLength) {
       ActualSendLength = MaxPacketLength;
     }
-    DataTd = OhciCreateTD (Ohc);
+    DataTd = OhciBulkAcquireTD (Ohc);
     if (DataTd == NULL) {
       DEBUG ((EFI_D_INFO, "OhcBulkTransfer: Fail to allocate Data TD buffer\r\n"));
       Status = EFI_OUT_OF_RESOURCES;
@@ -465,7 +519,7 @@ OhciBulkTransfer (
   //
   // Empty Stage
   //
-  EmptyTd = OhciCreateTD (Ohc);
+  EmptyTd = OhciBulkAcquireTD (Ohc);
   if (EmptyTd == NULL) {
     Status = EFI_OUT_OF_RESOURCES;
       DEBUG ((EFI_D_INFO, "OhcBulkTransfer: Fail to allocate Empty TD buffer\r\n"));
@@ -522,12 +576,16 @@ OhciBulkTransfer (
     *DataToggle = (UINT8) OhciGetEDField (Ed, ED_DTTOGGLE);
 
 FREE_TD_BUFF:
+  //
+  // Keep the ED and retire the TDs to the reuse list instead of freeing
+  // them; the next bulk transfer picks them up again
+  //
+  OhciSetEDField (Ed, ED_SKIP, 1);
   while (HeadTd) {
     DataTd = HeadTd;
     HeadTd = HeadTd->NextTDPointer;
-    UsbHcFreeMem(Ohc->MemPool, DataTd, sizeof(TD_DESCRIPTOR));
+    OhciBulkReleaseTD (Ohc, DataTd);
   }
-  UsbHcFreeMem(Ohc->MemPool, Ed, sizeof(ED_DESCRIPTOR));
 
   return Status;
 }
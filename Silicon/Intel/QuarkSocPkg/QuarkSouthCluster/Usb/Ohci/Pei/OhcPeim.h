@@ -52,6 +52,12 @@ struct _USB_OHCI_HC_DEV {
   EFI_PEI_PPI_DESCRIPTOR       PpiDescriptor;
   UINT32                       UsbHostControllerBaseAddress;
   VOID                         *MemPool;
+  //
+  // Bulk descriptors are kept here between transfers so sequential
+  // recovery image reads reuse them, see OhciBulkTransfer()
+  //
+  ED_DESCRIPTOR                *BulkEd;
+  TD_DESCRIPTOR                *BulkFreeTds;
 };
 
 #define PEI_RECOVERY_USB_OHC_DEV_FROM_EHCI_THIS(a)  CR (a, USB_OHCI_HC_DEV, UsbHostControllerPpi, USB_OHCI_HC_DEV_SIGNATURE)
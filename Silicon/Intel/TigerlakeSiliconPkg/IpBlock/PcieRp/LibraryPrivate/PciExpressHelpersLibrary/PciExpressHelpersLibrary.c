@@ -47,6 +47,25 @@ typedef struct {
   const PCH_PCIE_DEVICE_OVERRIDE* Table;
 } OVERRIDE_TABLE;
 
+//
+// Journal of links whose retrain was triggered but not yet confirmed done.
+// Retrains for a whole tree are issued back-to-back and harvested in one
+// sweep afterwards, so the tree pays the slowest link's retrain time
+// instead of the sum of all of them. Sized for the deepest realistic
+// topology (every downstream port of a fully populated switch fabric).
+//
+#define MAX_DEFERRED_RETRAINS 32
+
+typedef struct {
+  UINT64  Base;
+  UINT8   PcieCapOffset;
+} RETRAIN_LINK_ENTRY;
+
+typedef struct {
+  RETRAIN_LINK_ENTRY  Link[MAX_DEFERRED_RETRAINS];
+  UINT32              Count;
+} RETRAIN_JOURNAL;
+
 typedef enum {
   DevTypePci,
   DevTypePcieEndpoint,
@@ -1364,15 +1383,17 @@ RecursiveCpmConfiguration (
   When this function executes on downstream component, it only returns SCC capability
 
   @param[in] Segment,Bus,Device,Function    address of currently visited PCIe device
-  @param[in] WaitForRetrain                 decides if this function should busy-wait for link retrain
+  @param[in] RetrainJournal                 journal collecting links with an in-flight retrain;
+                                            when NULL, or when the journal is full, this function
+                                            busy-waits for each retrain instead
 
   @retval TRUE = this device supports SCC, FALSE = it doesn't
 **/
 STATIC
 BOOLEAN
 RecursiveCccConfiguration (
-  SBDF       Sbdf,
-  BOOLEAN    WaitForRetrain
+  SBDF             Sbdf,
+  RETRAIN_JOURNAL  *RetrainJournal
   )
 {
   UINT64       Base;
@@ -1390,7 +1411,7 @@ RecursiveCccConfiguration (
   if (HasChildBus (Sbdf, &ChildSbdf)) {
     DevType = GetDeviceType (Sbdf);
     while (FindNextPcieChild (DevType, &ChildSbdf)) {
-      ChildScc |= RecursiveCccConfiguration (ChildSbdf, WaitForRetrain);
+      ChildScc |= RecursiveCccConfiguration (ChildSbdf, RetrainJournal);
     }
     if (DevType == DevTypePcieDownstream) {
       LinkScc = MyScc & ChildScc;
@@ -1399,13 +1420,48 @@ RecursiveCccConfiguration (
         while (FindNextPcieChild (DevType, &ChildSbdf)) {
           EnableCcc (SbdfToBase(ChildSbdf), (UINT8)ChildSbdf.PcieCap);
         }
-        RetrainLink(Base, (UINT8)Sbdf.PcieCap, WaitForRetrain);
+        if ((RetrainJournal != NULL) && (RetrainJournal->Count < MAX_DEFERRED_RETRAINS)) {
+          RetrainLink (Base, (UINT8)Sbdf.PcieCap, FALSE);
+          RetrainJournal->Link[RetrainJournal->Count].Base = Base;
+          RetrainJournal->Link[RetrainJournal->Count].PcieCapOffset = (UINT8)Sbdf.PcieCap;
+          RetrainJournal->Count++;
+        } else {
+          RetrainLink (Base, (UINT8)Sbdf.PcieCap, TRUE);
+        }
       }
     }
   }
   return MyScc;
 }
 
+/**
+  Waits until every link recorded in the retrain journal has finished
+  retraining, each with its own LINK_RETRAIN_WAIT_TIME deadline. Since all
+  retrains were already issued and progress in parallel, the sweep costs
+  roughly the slowest link rather than the sum of all links.
+
+  @param[in] RetrainJournal   journal filled by RecursiveCccConfiguration
+**/
+STATIC
+VOID
+WaitForRetrainCompletion (
+  RETRAIN_JOURNAL  *RetrainJournal
+  )
+{
+  UINT32  Index;
+  UINT32  TimeoutUs;
+  UINT16  LinkTraining;
+
+  for (Index = 0; Index < RetrainJournal->Count; Index++) {
+    TimeoutUs = LINK_RETRAIN_WAIT_TIME;
+    do {
+      LinkTraining = (PciSegmentRead16 (RetrainJournal->Link[Index].Base + RetrainJournal->Link[Index].PcieCapOffset + R_PCIE_LSTS_OFFSET) & B_PCIE_LSTS_LT);
+      TimeoutUs--;
+    } while (LinkTraining && (TimeoutUs != 0));
+  }
+  RetrainJournal->Count = 0;
+}
+
 /**
   Configures Latency Tolerance Reporting in given device and in PCIe tree below it.
   This function configures Maximum LTR and enables LTR mechanism. It visits devices using depth-first search
@@ -1694,6 +1750,7 @@ RootportDownstreamConfiguration (
   UINT64          RpBase;
   SBDF            RpSbdf;
   SBDF_TABLE      BridgeCleanupList;
+  RETRAIN_JOURNAL RetrainJournal;
 
   IoApicPresent = FALSE;
   RpBase = PCI_SEGMENT_LIB_ADDRESS (RpSegment, RpBus, RpDevice, RpFunction, 0);
@@ -1720,7 +1777,13 @@ RootportDownstreamConfiguration (
   if ((PciSku == EnumPchPcie) || (PciSku == EnumCpuPcie)) {
     ConfigureEoiForwarding (RpBase, IoApicPresent);
   }
-  RecursiveCccConfiguration (RpSbdf, TRUE);
+  //
+  // Issue all CCC retrains first, then harvest their completion in a single
+  // sweep before PTM configuration touches devices behind the links.
+  //
+  RetrainJournal.Count = 0;
+  RecursiveCccConfiguration (RpSbdf, &RetrainJournal);
+  WaitForRetrainCompletion (&RetrainJournal);
 
   if (IsPtmCapable (RpSbdf)) {
     RecursivePtmConfiguration (RpSbdf, 0, FALSE);
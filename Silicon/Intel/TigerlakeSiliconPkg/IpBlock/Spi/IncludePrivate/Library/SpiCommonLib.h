@@ -17,6 +17,20 @@
 #define SPI_WAIT_TIME   6000000     ///< Wait Time = 6 seconds = 6000000 microseconds
 #define SPI_WAIT_PERIOD 10          ///< Wait Period = 10 microseconds
 
+//
+// Number of register polls without timer stall before falling back to
+// SPI_WAIT_PERIOD stalls. A single FIFO data cycle completes in a few
+// microseconds, so polling tightly at first keeps consecutive data cycles
+// back to back instead of serializing them on the stall granularity.
+//
+#define SPI_CYCLE_FAST_POLL_COUNT 0x200
+
+//
+// Number of flash region registers (FREG0 - FREG15) shadowed in the
+// region layout cache.
+//
+#define SPI_REGION_CACHE_NUM  16
+
 ///
 /// Flash cycle Type
 ///
@@ -62,6 +76,22 @@ typedef struct {
   UINT8                 NumberOfComponents;
   UINT32                Component1StartAddr;
   UINT32                TotalFlashSize;
+  /**
+    Flash region layout cache, filled once by SpiProtocolConstructor ().
+    The FREG registers are derived from the flash descriptor and do not
+    change after reset, so region lookups on the flash cycle path can be
+    served without MMIO access when RegionCacheValid is TRUE.
+  **/
+  BOOLEAN               RegionCacheValid;
+  UINT32                FregCache[SPI_REGION_CACHE_NUM];
+  /**
+    Read throughput statistics: number of hardware read cycles issued,
+    bytes transferred, and TSC ticks spent in read commands. Reported by
+    SpiDumpReadStatistics () for flash readback validation.
+  **/
+  UINT64                ReadCycleCount;
+  UINT64                ReadByteCount;
+  UINT64                ReadTicks;
 } SPI_INSTANCE;
 
 #define SPI_INSTANCE_FROM_SPIPROTOCOL(a)  CR (a, SPI_INSTANCE, SpiProtocol, PCH_SPI_PRIVATE_DATA_SIGNATURE)
@@ -83,6 +113,16 @@ SpiProtocolConstructor (
   IN     SPI_INSTANCE       *SpiInstance
   );
 
+/**
+  Report the accumulated flash read throughput statistics.
+
+  @param[in] SpiInstance          Pointer to the SPI protocol instance
+**/
+VOID
+SpiDumpReadStatistics (
+  IN     SPI_INSTANCE       *SpiInstance
+  );
+
 /**
   This function is a hook for Spi to disable BIOS Write Protect
 
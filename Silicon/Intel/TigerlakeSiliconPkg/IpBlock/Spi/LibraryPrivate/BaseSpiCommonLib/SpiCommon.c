@@ -159,6 +159,7 @@ SpiProtocolConstructor (
   UINTN           PchSpiBar0;
   UINT32          Data32;
   UINT16          Mdtba;
+  UINT32          Index;
   EFI_STATUS      Status;
 
   //
@@ -211,6 +212,20 @@ SpiProtocolConstructor (
   SpiInstance->SfdpVscc1Value = MmioRead32 (PchSpiBar0 + R_SPI_MEM_SFDP1_VSCC1);
   DEBUG ((DEBUG_INFO, "Component 1 SFDP VSCC value : %0x\n", SpiInstance->SfdpVscc1Value));
 
+  //
+  // Shadow the flash region registers. They are derived from the flash
+  // descriptor and do not change after reset, so region lookups during
+  // flash cycles can be served from the cache without MMIO access.
+  //
+  for (Index = 0; Index < SPI_REGION_CACHE_NUM; Index++) {
+    SpiInstance->FregCache[Index] = MmioRead32 (PchSpiBar0 + R_SPI_MEM_FREG0_FLASHD + (S_SPI_MEM_FREGX * Index));
+  }
+  SpiInstance->RegionCacheValid = TRUE;
+
+  SpiInstance->ReadCycleCount = 0;
+  SpiInstance->ReadByteCount  = 0;
+  SpiInstance->ReadTicks      = 0;
+
   //
   // Select to Flash Map 0 Register to get the number of flash Component
   //
@@ -414,8 +429,12 @@ WaitForSpiCycleComplete (
   WaitCount = SPI_WAIT_TIME / SPI_WAIT_PERIOD;
   //
   // Wait for the SPI cycle to complete.
+  // Poll without stalling for the first SPI_CYCLE_FAST_POLL_COUNT reads;
+  // a single FIFO data cycle completes in a few microseconds and stalling
+  // between polls would leave the interface idle between consecutive data
+  // cycles of a long transfer.
   //
-  for (WaitTicks = 0; WaitTicks < WaitCount; WaitTicks++) {
+  for (WaitTicks = 0; WaitTicks < WaitCount + SPI_CYCLE_FAST_POLL_COUNT; WaitTicks++) {
     Data32 = MmioRead32 (PchSpiBar0 + R_SPI_MEM_HSFSC);
     if ((Data32 & B_SPI_MEM_HSFSC_SCIP) == 0) {
       MmioWrite32 (PchSpiBar0 + R_SPI_MEM_HSFSC, B_SPI_MEM_HSFSC_FCERR | B_SPI_MEM_HSFSC_FDONE);
@@ -425,7 +444,9 @@ WaitForSpiCycleComplete (
         return TRUE;
       }
     }
-    PchPmTimerStallRuntimeSafe (SpiInstance->PchAcpiBase, SPI_WAIT_PERIOD);
+    if (WaitTicks >= SPI_CYCLE_FAST_POLL_COUNT) {
+      PchPmTimerStallRuntimeSafe (SpiInstance->PchAcpiBase, SPI_WAIT_PERIOD);
+    }
   }
   return FALSE;
 }
@@ -469,6 +490,9 @@ SendSpiCmd (
   UINT32          SmiEnSave;
   UINT16          ABase;
   UINT32          HsfstsCtl;
+  UINT64          ReadStartTick;
+
+  ReadStartTick     = 0;
 
   //
   // For flash write, there is a requirement that all CPU threads are in SMM
@@ -586,6 +610,10 @@ SendSpiCmd (
       break;
   }
 
+  if (FlashCycleType == FlashCycleRead) {
+    ReadStartTick = AsmReadTsc ();
+  }
+
   do {
     SpiDataCount = ByteCount;
     if ((FlashCycleType == FlashCycleRead) ||
@@ -716,11 +744,20 @@ SendSpiCmd (
       }
     }
 
+    if (FlashCycleType == FlashCycleRead) {
+      SpiInstance->ReadCycleCount++;
+      SpiInstance->ReadByteCount += SpiDataCount;
+    }
+
     HardwareSpiAddr += SpiDataCount;
     Buffer += SpiDataCount;
     ByteCount -= SpiDataCount;
   } while (ByteCount > 0);
 
+  if (FlashCycleType == FlashCycleRead) {
+    SpiInstance->ReadTicks += AsmReadTsc () - ReadStartTick;
+  }
+
 SendSpiCmdEnd:
   //
   // Restore the settings for SPI Prefetching and Caching and enable BIOS Write Protect
@@ -1105,9 +1142,17 @@ SpiProtocolGetRegionAddress (
     return EFI_SUCCESS;
   }
 
-  PchSpiBar0      = AcquireSpiBar0 (SpiInstance);
-  ReadValue = MmioRead32 (PchSpiBar0 + (R_SPI_MEM_FREG0_FLASHD + (S_SPI_MEM_FREGX * ((UINT32) FlashRegionType))));
-  ReleaseSpiBar0 (SpiInstance);
+  if (SpiInstance->RegionCacheValid && ((UINT32) FlashRegionType < SPI_REGION_CACHE_NUM)) {
+    //
+    // The flash region registers never change after reset, serve the lookup
+    // from the layout cache filled at construction time.
+    //
+    ReadValue = SpiInstance->FregCache[FlashRegionType];
+  } else {
+    PchSpiBar0      = AcquireSpiBar0 (SpiInstance);
+    ReadValue = MmioRead32 (PchSpiBar0 + (R_SPI_MEM_FREG0_FLASHD + (S_SPI_MEM_FREGX * ((UINT32) FlashRegionType))));
+    ReleaseSpiBar0 (SpiInstance);
+  }
 
   //
   // If the region is not used, the Region Base is 7FFFh and Region Limit is 0000h
@@ -1126,6 +1171,25 @@ SpiProtocolGetRegionAddress (
   return EFI_SUCCESS;
 }
 
+/**
+  Report the accumulated flash read throughput statistics.
+
+  @param[in] SpiInstance          Pointer to the SPI protocol instance
+**/
+VOID
+SpiDumpReadStatistics (
+  IN     SPI_INSTANCE       *SpiInstance
+  )
+{
+  DEBUG ((DEBUG_INFO, "SPI flash read statistics:\n"));
+  DEBUG ((DEBUG_INFO, "  Read cycles : %ld\n", SpiInstance->ReadCycleCount));
+  DEBUG ((DEBUG_INFO, "  Bytes read  : %ld\n", SpiInstance->ReadByteCount));
+  DEBUG ((DEBUG_INFO, "  TSC ticks   : %ld\n", SpiInstance->ReadTicks));
+  if (SpiInstance->ReadCycleCount != 0) {
+    DEBUG ((DEBUG_INFO, "  Ticks/cycle : %ld\n", SpiInstance->ReadTicks / SpiInstance->ReadCycleCount));
+  }
+}
+
 /**
   Read PCH Soft Strap Values
 
@@ -235,6 +235,83 @@ IsIoTrapExContentMatched (
 }
 
 
+/**
+  Rebuild the address sorted record index of one trap handler.
+
+  The index allows the dispatcher to resolve a trapped address with a binary
+  search instead of a linear callback list walk. Registration changes only
+  happen before SmmReadyToLock, so the rebuild cost is never paid at SMI time.
+
+  @param[in] TrapHandlerNum  trap number (0-3)
+
+  @retval    EFI_OUT_OF_RESOURCES       If run out of SMM memory pool,
+             EFI_SUCCESS                Index rebuilt successfully.
+**/
+STATIC
+EFI_STATUS
+RebuildIoTrapRecordIndex (
+  IN UINT8  TrapHandlerNum
+  )
+{
+  EFI_STATUS                Status;
+  IO_TRAP_ENTRY_ATTRIBUTES  *TrapEntry;
+  LIST_ENTRY                *LinkInDb;
+  IO_TRAP_RECORD            *RecordInDb;
+  IO_TRAP_RECORD            **NewIndex;
+  UINT32                    Count;
+  UINT32                    Index;
+  UINT32                    SortIndex;
+
+  TrapEntry = &mIoTrapData.Entry[TrapHandlerNum];
+
+  Count = 0;
+  LinkInDb = GetFirstNode (&TrapEntry->CallbackDataBase);
+  while (!IsNull (&TrapEntry->CallbackDataBase, LinkInDb)) {
+    Count++;
+    LinkInDb = GetNextNode (&TrapEntry->CallbackDataBase, LinkInDb);
+  }
+
+  if (Count > TrapEntry->SortedRecordCapacity) {
+    Status = gSmst->SmmAllocatePool (
+                      EfiRuntimeServicesData,
+                      (Count + 0x10) * sizeof (IO_TRAP_RECORD *),
+                      (VOID **) &NewIndex
+                      );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "Failed to allocate memory for IoTrap record index! \n"));
+      return EFI_OUT_OF_RESOURCES;
+    }
+    if (TrapEntry->SortedRecord != NULL) {
+      gSmst->SmmFreePool (TrapEntry->SortedRecord);
+    }
+    TrapEntry->SortedRecord = NewIndex;
+    TrapEntry->SortedRecordCapacity = Count + 0x10;
+  }
+
+  //
+  // Insertion sort by trap range base address. The registration flow hands
+  // out non overlapping ranges and the common pool grows upwards, so the
+  // list is nearly sorted already.
+  //
+  Index = 0;
+  LinkInDb = GetFirstNode (&TrapEntry->CallbackDataBase);
+  while (!IsNull (&TrapEntry->CallbackDataBase, LinkInDb)) {
+    RecordInDb = IO_TRAP_RECORD_FROM_LINK (LinkInDb);
+    SortIndex = Index;
+    while ((SortIndex > 0) &&
+           (TrapEntry->SortedRecord[SortIndex - 1]->Context.Address > RecordInDb->Context.Address)) {
+      TrapEntry->SortedRecord[SortIndex] = TrapEntry->SortedRecord[SortIndex - 1];
+      SortIndex--;
+    }
+    TrapEntry->SortedRecord[SortIndex] = RecordInDb;
+    Index++;
+    LinkInDb = GetNextNode (&TrapEntry->CallbackDataBase, LinkInDb);
+  }
+  TrapEntry->SortedRecordCount = Index;
+
+  return EFI_SUCCESS;
+}
+
 /**
   The helper function for IoTrap callback dispacther
 
@@ -247,6 +324,7 @@ IoTrapDispatcherHelper (
 {
   IO_TRAP_RECORD                            *RecordInDb;
   LIST_ENTRY                                *LinkInDb;
+  IO_TRAP_ENTRY_ATTRIBUTES                  *TrapEntry;
   EFI_SMM_IO_TRAP_REGISTER_CONTEXT          CurrentIoTrapRegisterData;
   EFI_SMM_IO_TRAP_CONTEXT                   CurrentIoTrapContextData;
   UINT16                                    BaseAddress;
@@ -256,8 +334,14 @@ IoTrapDispatcherHelper (
   UINT8                                     ActiveHighByteEnable;
   BOOLEAN                                   ReadCycle;
   UINT32                                    WriteData;
+  UINT32                                    Low;
+  UINT32                                    High;
+  UINT32                                    Middle;
+  UINT64                                    StartTsc;
+
+  TrapEntry = &mIoTrapData.Entry[TrapHandlerNum];
 
-  if (!IsListEmpty (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase))) {
+  if (!IsListEmpty (&TrapEntry->CallbackDataBase)) {
     Data32 = PchPcrRead32 (PID_PSTH, R_PSTH_PCR_TRPC);
     WriteData = PchPcrRead32 (PID_PSTH, R_PSTH_PCR_TRPD);
 
@@ -273,54 +357,98 @@ IoTrapDispatcherHelper (
     CurrentIoTrapRegisterData.Type = (EFI_SMM_IO_TRAP_DISPATCH_TYPE)ReadCycle;
     CurrentIoTrapContextData.WriteData = WriteData;
 
-    LinkInDb = GetFirstNode (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase));
-
-    while (!IsNull (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase), LinkInDb)) {
+    //
+    // If MergeDisable is TRUE, no need to check the address range, dispatch the callback function directly.
+    // Expect only one callback available.
+    //
+    if (TrapEntry->MergeDisable) {
+      LinkInDb = GetFirstNode (&TrapEntry->CallbackDataBase);
       RecordInDb = IO_TRAP_RECORD_FROM_LINK (LinkInDb);
-
+      StartTsc = AsmReadTsc ();
+      if (RecordInDb->IoTrapCallback != NULL) {
+        RecordInDb->IoTrapCallback (&RecordInDb->Link, &CurrentIoTrapContextData, NULL, NULL);
+      }
+      if (RecordInDb->IoTrapExCallback != NULL) {
+        RecordInDb->IoTrapExCallback (BaseAddress, ActiveHighByteEnable, !ReadCycle, WriteData);
+      }
+      RecordInDb->DispatchCycles += AsmReadTsc () - StartTsc;
+      RecordInDb->DispatchCount++;
+    } else {
       //
-      // If MergeDisable is TRUE, no need to check the address range, dispatch the callback function directly.
+      // If MergeDisable is FALSE, resolve the trapped address range with a
+      // binary search over the address sorted record index. Find the first
+      // record whose range does not end before StartAddress, then verify it
+      // covers the whole access.
       //
-      if (mIoTrapData.Entry[TrapHandlerNum].MergeDisable) {
-        if (RecordInDb->IoTrapCallback != NULL) {
-          RecordInDb->IoTrapCallback (&RecordInDb->Link, &CurrentIoTrapContextData, NULL, NULL);
-        }
-        if (RecordInDb->IoTrapExCallback != NULL) {
-          RecordInDb->IoTrapExCallback (BaseAddress, ActiveHighByteEnable, !ReadCycle, WriteData);
+      Low  = 0;
+      High = TrapEntry->SortedRecordCount;
+      while (Low < High) {
+        Middle = Low + ((High - Low) / 2);
+        RecordInDb = TrapEntry->SortedRecord[Middle];
+        if ((UINT32) (RecordInDb->Context.Address + RecordInDb->Context.Length) <= StartAddress) {
+          Low = Middle + 1;
+        } else {
+          High = Middle;
         }
-        //
-        // Expect only one callback available. So break immediately.
-        //
-        break;
-      //
-      // If MergeDisable is FALSE, check the address range and trap type.
-      //
-      } else {
-        if ((RecordInDb->Context.Address <= StartAddress) &&
-            (RecordInDb->Context.Address + RecordInDb->Context.Length > EndAddress)) {
-          if ((RecordInDb->Context.Type == IoTrapExTypeReadWrite) || (RecordInDb->Context.Type == (IO_TRAP_EX_DISPATCH_TYPE) CurrentIoTrapRegisterData.Type)) {
-            //
-            // Pass the IO trap context information
-            //
-            RecordInDb->IoTrapCallback (&RecordInDb->Link, &CurrentIoTrapContextData, NULL, NULL);
-          }
+      }
+
+      if ((Low < TrapEntry->SortedRecordCount) &&
+          (TrapEntry->SortedRecord[Low]->Context.Address <= StartAddress) &&
+          (TrapEntry->SortedRecord[Low]->Context.Address + TrapEntry->SortedRecord[Low]->Context.Length > EndAddress)) {
+        RecordInDb = TrapEntry->SortedRecord[Low];
+        if ((RecordInDb->Context.Type == IoTrapExTypeReadWrite) || (RecordInDb->Context.Type == (IO_TRAP_EX_DISPATCH_TYPE) CurrentIoTrapRegisterData.Type)) {
           //
-          // Break if the address is match
+          // Pass the IO trap context information
           //
-          break;
-        } else {
-          LinkInDb = GetNextNode (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase), &RecordInDb->Link);
-          if (IsNull (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase), LinkInDb)) {
-            //
-            // An IO access was trapped that does not have a handler registered.
-            // This indicates an error condition.
-            //
-            ASSERT (FALSE);
-          }
+          StartTsc = AsmReadTsc ();
+          RecordInDb->IoTrapCallback (&RecordInDb->Link, &CurrentIoTrapContextData, NULL, NULL);
+          RecordInDb->DispatchCycles += AsmReadTsc () - StartTsc;
+          RecordInDb->DispatchCount++;
         }
-      } // end of if else block
-    } // end of while loop
-  } // end of if else block
+      } else {
+        //
+        // An IO access was trapped that does not have a handler registered.
+        // This indicates an error condition.
+        //
+        ASSERT (FALSE);
+      }
+    }
+  }
+}
+
+/**
+  Dump the dispatch profile of every registered IoTrap handler.
+
+  For each handler the trap range, the invocation count, and the total TSC
+  cycles spent in the callback are printed, so expensive handlers can be
+  identified from a debug command.
+**/
+VOID
+IoTrapDispatchProfileDump (
+  VOID
+  )
+{
+  IO_TRAP_RECORD  *RecordInDb;
+  LIST_ENTRY      *LinkInDb;
+  UINTN           TrapHandlerNum;
+
+  DEBUG ((DEBUG_INFO, "IoTrap dispatch profile:\n"));
+  for (TrapHandlerNum = 0; TrapHandlerNum < IO_TRAP_HANDLER_NUM; TrapHandlerNum++) {
+    LinkInDb = GetFirstNode (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase));
+    while (!IsNull (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase), LinkInDb)) {
+      RecordInDb = IO_TRAP_RECORD_FROM_LINK (LinkInDb);
+      DEBUG ((
+        DEBUG_INFO,
+        "  Trap %d Address 0x%04x Length 0x%x Count %ld Cycles %ld\n",
+        TrapHandlerNum,
+        RecordInDb->Context.Address,
+        RecordInDb->Context.Length,
+        RecordInDb->DispatchCount,
+        RecordInDb->DispatchCycles
+        ));
+      LinkInDb = GetNextNode (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase), LinkInDb);
+    }
+  }
 }
 
 /**
@@ -646,9 +774,18 @@ IoTrapRegisterHelper (
   mIoTrapRecord->IoTrapCallback          = IoTrapDispatchFunction;
   mIoTrapRecord->IoTrapExCallback        = IoTrapExDispatchFunction;
   mIoTrapRecord->IoTrapNumber            = TrapHandlerNum;
+  mIoTrapRecord->DispatchCount           = 0;
+  mIoTrapRecord->DispatchCycles          = 0;
 
   InsertTailList (&(mIoTrapData.Entry[TrapHandlerNum].CallbackDataBase), &mIoTrapRecord->Link);
 
+  Status = RebuildIoTrapRecordIndex (TrapHandlerNum);
+  if (EFI_ERROR (Status)) {
+    RemoveEntryList (&mIoTrapRecord->Link);
+    gSmst->SmmFreePool (mIoTrapRecord);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
   //
   // Child's handle will be the address linked list link in the record
   //
@@ -787,6 +924,11 @@ IoTrapUnRegisterHelper (
   }
 
   RemoveEntryList (&RecordToDelete->Link);
+  //
+  // Rebuilding for fewer records reuses the existing index buffer, so this
+  // cannot fail.
+  //
+  RebuildIoTrapRecordIndex (TrapHandlerNum);
   Status = gSmst->SmmFreePool (RecordToDelete);
   ASSERT_EFI_ERROR (Status);
 
@@ -29,6 +29,15 @@ typedef struct {
     The callback linked list for all "merged" IoTrap callbacks.
   **/
   LIST_ENTRY                            CallbackDataBase;
+  /**
+    Address sorted index of the records in CallbackDataBase.
+    The dispatcher resolves a trapped address with a binary search over this
+    index instead of walking the callback list. It is rebuilt on every
+    registration change; CallbackDataBase remains the master database.
+  **/
+  struct _IO_TRAP_RECORD                **SortedRecord;
+  UINT32                                SortedRecordCount;
+  UINT32                                SortedRecordCapacity;
   /**
     The IoTrap IO range used length tracking for "merged" IoTrap register.
   **/
@@ -84,6 +93,13 @@ typedef struct _IO_TRAP_RECORD {
   **/
   IO_TRAP_EX_DISPATCH_CALLBACK              IoTrapExCallback;
   UINT8                                     IoTrapNumber;
+  /**
+    Dispatch profiling data: invocation count and total TSC cycles spent in
+    the callback. Collected on every dispatch and reported by
+    IoTrapDispatchProfileDump() to locate expensive handlers.
+  **/
+  UINT64                                    DispatchCount;
+  UINT64                                    DispatchCycles;
 } IO_TRAP_RECORD;
 
 #define IO_TRAP_RECORD_FROM_LINK(_record) CR (_record, IO_TRAP_RECORD, Link, IO_TRAP_RECORD_SIGNATURE)
@@ -223,4 +239,16 @@ IoTrapControlResume (
   IN EFI_HANDLE                       DispatchHandle
   );
 
+/**
+  Dump the dispatch profile of every registered IoTrap handler.
+
+  For each handler the trap range, the invocation count, and the total TSC
+  cycles spent in the callback are printed, so expensive handlers can be
+  identified from a debug command.
+**/
+VOID
+IoTrapDispatchProfileDump (
+  VOID
+  );
+
 #endif
@@ -61,6 +61,18 @@ GLOBAL_REMOVE_IF_UNREFERENCED ESPI_SMI_INSTANCE mEspiSmiInstance = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0
   },
   //
+  // EspiSmiDispatchCounter[EspiSmiTypeMax]
+  //
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  //
+  // EspiSmiDispatchCycles[EspiSmiTypeMax]
+  //
+  {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  },
+  //
   // Barrier[EspiTopLevelTypeMax]
   //
   {
@@ -464,57 +476,77 @@ EspiSmiClearStatus (
 }
 
 /**
-  Checks if a source is active by looking at the enable and status bits
+  Decodes all pending causes of a top level event into a bit vector
 
-  @param[in]  EspiSmiType  Type based on ESPI_SMI_TYPE
+  Every bit of the returned vector corresponds to an ESPI_SMI_TYPE whose
+  enable and status bits indicate the source is active. Adjacent sources
+  share a single cause register (e.g. both Peripheral Channel error types
+  live in PCERR_SLV0), so the last register read is cached and reused
+  rather than re-reading the full register set per source.
+
+  @param[in]  EspiTopLevelType  Type based on ESPI_TOP_LEVEL_TYPE
+
+  @retval     UINT32            Cause vector indexed by ESPI_SMI_TYPE
 **/
 STATIC
-BOOLEAN
-EspiSmiSourceIsActive (
-  IN CONST  ESPI_SMI_TYPE EspiSmiType
+UINT32
+EspiSmiGetCauseVector (
+  IN CONST  ESPI_TOP_LEVEL_TYPE EspiTopLevelType
   )
 {
-  BOOLEAN                 Active;
+  UINT32                  CauseVector;
   UINT32                  PciBus;
   UINT32                  PciDev;
   UINT32                  PciFun;
   UINT32                  PciReg;
   UINT64                  PciBaseAddress;
   UINT32                  Data32;
+  BOOLEAN                 CacheValid;
+  PCH_SMM_ADDRESS         CachedAddress;
+  ESPI_SMI_TYPE           EspiSmiType;
   CONST ESPI_DESCRIPTOR   *Desc;
 
-  Desc = &mEspiDescriptor[EspiSmiType];
+  CauseVector = 0;
+  CacheValid  = FALSE;
+  Data32      = 0;
 
-  Active = FALSE;
-  switch (Desc->Address.Type) {
-    case PCIE_ADDR_TYPE:
-      PciBus  = Desc->Address.Data.pcie.Fields.Bus;
-      PciDev  = Desc->Address.Data.pcie.Fields.Dev;
-      PciFun  = Desc->Address.Data.pcie.Fields.Fnc;
-      PciReg  = Desc->Address.Data.pcie.Fields.Reg;
-      PciBaseAddress = PCI_SEGMENT_LIB_ADDRESS (DEFAULT_PCI_SEGMENT_NUMBER_PCH, PciBus, PciDev, PciFun, 0);
-      Data32 = PciSegmentRead32 (PciBaseAddress + PciReg);
-      break;
+  for (EspiSmiType = mEspiSmiInstance.Barrier[EspiTopLevelType].Start; EspiSmiType <= mEspiSmiInstance.Barrier[EspiTopLevelType].End; ++EspiSmiType) {
+    Desc = &mEspiDescriptor[EspiSmiType];
+
+    if (!CacheValid || (CachedAddress.Type != Desc->Address.Type) || (CachedAddress.Data.raw != Desc->Address.Data.raw)) {
+      switch (Desc->Address.Type) {
+        case PCIE_ADDR_TYPE:
+          PciBus  = Desc->Address.Data.pcie.Fields.Bus;
+          PciDev  = Desc->Address.Data.pcie.Fields.Dev;
+          PciFun  = Desc->Address.Data.pcie.Fields.Fnc;
+          PciReg  = Desc->Address.Data.pcie.Fields.Reg;
+          PciBaseAddress = PCI_SEGMENT_LIB_ADDRESS (DEFAULT_PCI_SEGMENT_NUMBER_PCH, PciBus, PciDev, PciFun, 0);
+          Data32 = PciSegmentRead32 (PciBaseAddress + PciReg);
+          break;
 
-    case PCR_ADDR_TYPE:
-      Data32 = PchPcrRead32 (
-                 Desc->Address.Data.Pcr.Fields.Pid,
-                 Desc->Address.Data.Pcr.Fields.Offset
-                 );
-      break;
+        case PCR_ADDR_TYPE:
+          Data32 = PchPcrRead32 (
+                     Desc->Address.Data.Pcr.Fields.Pid,
+                     Desc->Address.Data.Pcr.Fields.Offset
+                     );
+          break;
 
-    default:
-      Data32 = 0;
-      DEBUG ((DEBUG_ERROR, "Address type for eSPI SMI is invalid \n"));
-      ASSERT (FALSE);
-      break;
-  }
+        default:
+          Data32 = 0;
+          DEBUG ((DEBUG_ERROR, "Address type for eSPI SMI is invalid \n"));
+          ASSERT (FALSE);
+          break;
+      }
+      CachedAddress = Desc->Address;
+      CacheValid    = TRUE;
+    }
 
-  if ((Data32 & Desc->SourceIsActiveAndMask) == Desc->SourceIsActiveValue) {
-    Active = TRUE;
+    if ((Data32 & Desc->SourceIsActiveAndMask) == Desc->SourceIsActiveValue) {
+      CauseVector |= (UINT32) (1 << EspiSmiType);
+    }
   }
 
-  return Active;
+  return CauseVector;
 }
 
 /**
@@ -574,6 +606,8 @@ EspiSmiCallback (
   ESPI_SMI_TYPE       EspiSmiType;
   ESPI_SMI_RECORD     *RecordInDb;
   LIST_ENTRY          *LinkInDb;
+  UINT32              CauseVector;
+  UINT64              StartTime;
 
   PchSmiRecord = DATABASE_RECORD_FROM_LINK (DispatchHandle);
 
@@ -587,10 +621,18 @@ EspiSmiCallback (
     return;
   }
 
+  //
+  // Decode all pending causes up front, then service each set bit below.
+  // Handling every pending cause in a single pass avoids taking another
+  // SMM entry per cause and re-reading the shared cause registers.
+  //
+  CauseVector = EspiSmiGetCauseVector (EspiTopLevelType);
+
   for (EspiSmiType = mEspiSmiInstance.Barrier[EspiTopLevelType].Start; EspiSmiType <= mEspiSmiInstance.Barrier[EspiTopLevelType].End; ++EspiSmiType) {
-    if (!EspiSmiSourceIsActive (EspiSmiType)) {
+    if ((CauseVector & (UINT32) (1 << EspiSmiType)) == 0) {
       continue;
     }
+    StartTime = AsmReadTsc ();
     //
     // The source is active, so walk the callback database and dispatch
     //
@@ -631,6 +673,19 @@ EspiSmiCallback (
     // Finish walking the linked list for the EspiSmiType, so clear status
     //
     EspiSmiClearStatus (EspiSmiType);
+
+    //
+    // Track how often each cause fires and how long servicing it takes
+    //
+    mEspiSmiInstance.EspiSmiDispatchCounter[EspiSmiType]++;
+    mEspiSmiInstance.EspiSmiDispatchCycles[EspiSmiType] += AsmReadTsc () - StartTime;
+    DEBUG ((
+      DEBUG_VERBOSE,
+      "eSPI SMI cause %d dispatched %d times, %ld cycles total\n",
+      EspiSmiType,
+      mEspiSmiInstance.EspiSmiDispatchCounter[EspiSmiType],
+      mEspiSmiInstance.EspiSmiDispatchCycles[EspiSmiType]
+      ));
   }
 }
 
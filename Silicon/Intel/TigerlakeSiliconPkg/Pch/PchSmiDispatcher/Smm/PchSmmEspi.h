@@ -73,6 +73,14 @@ typedef struct _ESPI_SMI_INSTANCE {
   ///
   UINTN                           EspiSmiEventCounter[EspiSmiTypeMax];
   ///
+  /// Number of times each eSPI SMI cause has been dispatched
+  ///
+  UINTN                           EspiSmiDispatchCounter[EspiSmiTypeMax];
+  ///
+  /// Accumulated TSC cycles spent servicing each eSPI SMI cause
+  ///
+  UINT64                          EspiSmiDispatchCycles[EspiSmiTypeMax];
+  ///
   /// Instance of barrier
   ///
   CONST ESPI_SMI_TYPE_BARRIER     Barrier[EspiTopLevelTypeMax];
@@ -276,6 +276,8 @@ typedef struct {
 
 FIT_TABLE_CONTEXT   gFitTableContext = {0};
 
+BOOLEAN             mBenchmark = FALSE;
+
 unsigned int
 xtoi (
   char  *str
@@ -345,6 +347,7 @@ Returns:
           "\t[-M <MicrocodeAddress MicrocodeSize>] [-M ...]|[-U <MicrocodeFv MicrocodeBase>|<MicrocodeRegionOffset MicrocodeRegionSize>|<MicrocodeGuid>] [-V <MicrocodeVersion>]\n"
           "\t[-O RecordType <RecordDataAddress RecordDataSize>|<RESERVE RecordDataSize>|<RecordDataGuid>|<RecordBinFile>|<CseRecordSubType RecordBinFile> [-V <RecordVersion>]] [-O ... [-V ...]]\n"
           "\t[-P RecordType <IndexPort DataPort Width Bit Index> [-V <RecordVersion>]] [-P ... [-V ...]]\n"
+          "\t[-BENCH]\n"
           , UTILITY_NAME);
   printf ("  Where:\n");
   printf ("\t-D                     - It is FD file instead of FV file. (The tool will search FV file)\n");
@@ -388,6 +391,7 @@ Returns:
   printf ("\tWidth                  - The Width of the port.\n");
   printf ("\tBit                    - The Bit Number of the port.\n");
   printf ("\tIndex                  - The Index Number of the port.\n");
+  printf ("\t-BENCH                 - Report the read/scan/patch/write phase timing. It may be placed anywhere on the command line.\n");
   printf ("\nUsage (view): %s [-view] InputFile -F <FitTablePointerOffset>\n", UTILITY_NAME);
   printf ("  Where:\n");
   printf ("\tInputFile              - Name of the input file.\n");
@@ -542,14 +546,14 @@ Returns:
 }
 
 UINT8 *
-FindNextFvHeader (
+ScanNextFvHeader (
   IN UINT8 *FileBuffer,
   IN UINTN  FileLength
   )
 /*++
 
   Routine Description:
-    Find next FvHeader in the FileBuffer
+    Find next FvHeader in the FileBuffer by linear scan
 
   Parameters:
     FileBuffer        -   The start FileBuffer which needs to be searched
@@ -608,6 +612,117 @@ FindNextFvHeader (
   return NULL;
 }
 
+//
+// FV layout cache
+// Every FindFileFromFvByGuid() call on the full FD image walks the image
+// byte by byte to locate the FV headers, so on a big FD the scan cost is
+// paid once per GUID lookup. The layout is scanned once after the input
+// file is read and later lookups are served from this cache.
+//
+#define MAX_FV_LAYOUT_ENTRY  0x40
+
+typedef struct {
+  UINT8      *FvHeader;
+  UINT64     FvLength;
+} FV_LAYOUT_ENTRY;
+
+typedef struct {
+  UINT8            *FdBuffer;
+  UINTN            FdSize;
+  UINT32           FvCount;
+  FV_LAYOUT_ENTRY  Fv[MAX_FV_LAYOUT_ENTRY];
+} FV_LAYOUT_CACHE;
+
+FV_LAYOUT_CACHE  mFvLayoutCache = {NULL, 0, 0};
+
+VOID
+BuildFvLayoutCache (
+  IN UINT8  *FdBuffer,
+  IN UINT32 FdSize
+  )
+/*++
+
+  Routine Description:
+    Scan the input image once and cache the discovered FV layout
+
+  Parameters:
+    FdBuffer          -   Fd file buffer
+    FdSize            -   Fd file size
+  Return:
+    None. If the image holds more FVs than the cache, the cache is left
+    disabled and every lookup falls back to the linear scan.
+
+--*/
+{
+  UINT8   *FvHeader;
+  UINT64  FvLength;
+
+  mFvLayoutCache.FdBuffer = NULL;
+  mFvLayoutCache.FvCount = 0;
+
+  FvHeader = ScanNextFvHeader (FdBuffer, FdSize);
+  while (FvHeader != NULL) {
+    FvLength = ((EFI_FIRMWARE_VOLUME_HEADER *)FvHeader)->FvLength;
+    if (mFvLayoutCache.FvCount >= MAX_FV_LAYOUT_ENTRY) {
+      return;
+    }
+    mFvLayoutCache.Fv[mFvLayoutCache.FvCount].FvHeader = FvHeader;
+    mFvLayoutCache.Fv[mFvLayoutCache.FvCount].FvLength = FvLength;
+    mFvLayoutCache.FvCount++;
+
+    if ((UINTN)FvHeader + FvLength >= (UINTN)FdBuffer + FdSize) {
+      break;
+    }
+    FvHeader = ScanNextFvHeader (FvHeader + FvLength, (UINTN)FdBuffer + FdSize - ((UINTN)FvHeader + (UINTN)FvLength));
+  }
+
+  mFvLayoutCache.FdBuffer = FdBuffer;
+  mFvLayoutCache.FdSize = FdSize;
+}
+
+UINT8 *
+FindNextFvHeader (
+  IN UINT8 *FileBuffer,
+  IN UINTN  FileLength
+  )
+/*++
+
+  Routine Description:
+    Find next FvHeader in the FileBuffer
+
+  Parameters:
+    FileBuffer        -   The start FileBuffer which needs to be searched
+    FileLength        -   The whole File Length.
+  Return:
+    FvHeader          -   The FvHeader is found successfully.
+    NULL              -   The FvHeader is not found.
+
+--*/
+{
+  UINT32  Index;
+  UINT8   *FvHeader;
+
+  //
+  // Serve the lookup from the FV layout cache when it covers the requested
+  // range. The FIT and Microcode patching done by this tool never moves an
+  // FV header, so the cache stays valid for the whole run.
+  //
+  if ((mFvLayoutCache.FdBuffer != NULL) &&
+      (FileBuffer >= mFvLayoutCache.FdBuffer) &&
+      ((UINTN)FileBuffer + FileLength <= (UINTN)mFvLayoutCache.FdBuffer + mFvLayoutCache.FdSize)) {
+    for (Index = 0; Index < mFvLayoutCache.FvCount; Index++) {
+      FvHeader = mFvLayoutCache.Fv[Index].FvHeader;
+      if ((FvHeader >= FileBuffer) &&
+          ((UINTN)FvHeader + (UINTN)mFvLayoutCache.Fv[Index].FvLength <= (UINTN)FileBuffer + FileLength)) {
+        return FvHeader;
+      }
+    }
+    return NULL;
+  }
+
+  return ScanNextFvHeader (FileBuffer, FileLength);
+}
+
 UINT8  *
 FindFileFromFvByGuid (
   IN UINT8     *FvBuffer,
@@ -3167,7 +3282,17 @@ Returns:
 
   UINT8                       *AcmBuffer;
 
+  clock_t                     BenchClock;
+  double                      BenchReadTime;
+  double                      BenchScanTime;
+  double                      BenchPatchTime;
+  double                      BenchWriteTime;
+
   FileBufferRaw = NULL;
+  BenchReadTime = 0;
+  BenchScanTime = 0;
+  BenchPatchTime = 0;
+  BenchWriteTime = 0;
   //
   // Step 0: Check FV or FD
   //
@@ -3181,6 +3306,7 @@ Returns:
   //
   // Step 1: Read InputFvRecovery.fv data
   //
+  BenchClock = clock ();
   if (IsFv) {
     Status = ReadInputFile (argv[1], &FileBuffer, &FvRecoveryFileSize, &FileBufferRaw);
     if (Status != STATUS_SUCCESS) {
@@ -3189,17 +3315,33 @@ Returns:
     }
     FdFileBuffer = FileBuffer;
     FdFileSize = FvRecoveryFileSize;
+    BenchReadTime = (double)(clock () - BenchClock) / CLOCKS_PER_SEC;
+
+    //
+    // Scan the FV layout once, later GUID lookups are served from the cache
+    //
+    BenchClock = clock ();
+    BuildFvLayoutCache (FdFileBuffer, FdFileSize);
+    BenchScanTime = (double)(clock () - BenchClock) / CLOCKS_PER_SEC;
   } else {
     Status = ReadInputFile (argv[2], &FdFileBuffer, &FdFileSize, &FileBufferRaw);
     if (Status != STATUS_SUCCESS) {
       Error (NULL, 0, 0, "Unable to open file", "%s", argv[2]);
       goto exitFunc;
     }
+    BenchReadTime = (double)(clock () - BenchClock) / CLOCKS_PER_SEC;
+
+    //
+    // Scan the FV layout once, later GUID lookups are served from the cache
+    //
+    BenchClock = clock ();
+    BuildFvLayoutCache (FdFileBuffer, FdFileSize);
 
     //
     // Get Fvrecovery information
     //
     FvRecoveryFileSize = GetFvRecoveryInfoFromFd (FdFileBuffer, FdFileSize, &FileBuffer);
+    BenchScanTime = (double)(clock () - BenchClock) / CLOCKS_PER_SEC;
     if ((FvRecoveryFileSize == 0) || (FileBuffer == NULL)) {
       Error (NULL, 0, 0, "FvRecovery not found in Fd file!", NULL);
       Status = STATUS_ERROR;
@@ -3210,6 +3352,7 @@ Returns:
   //
   // Step 2: Calculate FIT entry number.
   //
+  BenchClock = clock ();
   FitEntryNumber = GetFitEntryNumber (argc, argv, FdFileBuffer, FdFileSize);
   if (!gFitTableContext.Clear) {
     if (FitEntryNumber == 0) {
@@ -3295,15 +3438,26 @@ Returns:
     ClearFitTable (FdFileBuffer, FdFileSize);
     printf ("Clear FIT table Done!\n");
   }
+  BenchPatchTime = (double)(clock () - BenchClock) / CLOCKS_PER_SEC;
 
   //
   // Step 5: Write OutputFvRecovery.fv data
   //
+  BenchClock = clock ();
   if (IsFv) {
     Status = WriteOutputFile (argv[2], FileBuffer, FvRecoveryFileSize);
   } else {
     Status = WriteOutputFile (argv[3], FdFileBuffer, FdFileSize);
   }
+  BenchWriteTime = (double)(clock () - BenchClock) / CLOCKS_PER_SEC;
+
+  if (mBenchmark) {
+    printf ("FitGen benchmark (CPU seconds):\n");
+    printf ("  read  : %.3f\n", BenchReadTime);
+    printf ("  scan  : %.3f\n", BenchScanTime);
+    printf ("  patch : %.3f\n", BenchPatchTime);
+    printf ("  write : %.3f\n", BenchWriteTime);
+  }
 
 exitFunc:
   if (FileBufferRaw != NULL) {
@@ -3403,6 +3557,9 @@ Returns:
 
 --*/
 {
+  int  Index;
+  int  Index2;
+
   SetUtilityName (UTILITY_NAME);
 
   //
@@ -3410,6 +3567,21 @@ Returns:
   //
   PrintUtilityInfo ();
 
+  //
+  // Strip the benchmark option, it may be placed anywhere on the command line
+  //
+  for (Index = 1; Index < argc; Index++) {
+    if ((strcmp (argv[Index], "-BENCH") == 0) ||
+        (strcmp (argv[Index], "-bench") == 0)) {
+      mBenchmark = TRUE;
+      for (Index2 = Index; Index2 < argc - 1; Index2++) {
+        argv[Index2] = argv[Index2 + 1];
+      }
+      argc--;
+      Index--;
+    }
+  }
+
   //
   // Verify the correct number of arguments
   //
@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 #define PI_SPECIFICATION_VERSION  0x00010000
 #define EFI_FVH_PI_REVISION       EFI_FVH_REVISION
 #include <Common/UefiBaseTypes.h>
@@ -31,7 +32,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 // Utility version information
 //
 #define UTILITY_MAJOR_VERSION 0
-#define UTILITY_MINOR_VERSION 64
+#define UTILITY_MINOR_VERSION 65
 #define UTILITY_DATE          __DATE__
 
 //
@@ -13,6 +13,7 @@
 #include <Base.h>
 
 #include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
 #include <Library/DebugLib.h>
 #include <Library/IoLib.h>
 #include <Library/MemoryAllocationLib.h>
@@ -31,6 +32,27 @@ typedef enum {
   PciCfgWidthMax
 } PCI_CFG_WIDTH;
 
+//
+// Cached translation of a single PCI function. Generic enumeration issues
+// long runs of accesses to the same Segment/Bus/Device/Function, so keeping
+// the last few resolved windows avoids re-deriving the target address and
+// re-evaluating the bus 0 filter on every config cycle.
+//
+typedef struct {
+  UINT64      BdfKey;        ///< Segment/Bus/Device/Function address bits
+  UINT64      FunctionBase;  ///< Mapped base of this function's config window
+  BOOLEAN     Filtered;      ///< TRUE if accesses to this BDF must be dropped
+} PCI_CFG_TRANSLATION;
+
+#define PCI_CFG_CACHE_SIZE     4
+#define PCI_CFG_FUNCTION_MASK  0x0000FFFF0FFFF000ULL
+#define PCI_CFG_REGISTER_MASK  0xFFFULL
+
+STATIC PCI_CFG_TRANSLATION mCfgTranslationCache[PCI_CFG_CACHE_SIZE];
+STATIC UINTN mCfgTranslationNext;
+STATIC UINTN mCfgCacheHits;
+STATIC UINTN mCfgCacheMisses;
+
 /**
   Assert the validity of a PCI Segment address.
   A valid PCI Segment address should not contain 1's in bits 28..31 and 48..63
@@ -52,23 +74,66 @@ typedef enum {
   (((A) & 0x0000ffff00000000) >> 32)
 
 /**
-  Internal worker function to obtain config space base address.
+  Internal worker function to resolve the config space window of the function
+  addressed by a PCI Segment address.
 
-  @param  Address The address that encodes the PCI Bus, Device, Function and
-                  Register.
+  The result is served from a small BDF-indexed cache; on a miss the window is
+  derived from the controller's base address and inserted in round-robin
+  order. The cache hit rate is reported periodically on DEBUG builds.
 
-  @return The value read from the PCI configuration register.
+  @param  Address The address that encodes the PCI Segment, Bus, Device,
+                  Function and Register.
+
+  @return The cached translation entry describing the target function.
 
 **/
 STATIC
-UINT64
-PciSegmentLibGetConfigBase (
+PCI_CFG_TRANSLATION *
+PciSegmentLibGetTranslation (
   IN  UINT64      Address
   )
 {
+  PCI_CFG_TRANSLATION   *Entry;
+  UINT64                BdfKey;
+  UINTN                 Index;
+
+  BdfKey = Address & PCI_CFG_FUNCTION_MASK;
+
+  for (Index = 0; Index < PCI_CFG_CACHE_SIZE; Index++) {
+    Entry = &mCfgTranslationCache[Index];
+    if (Entry->BdfKey == BdfKey) {
+      mCfgCacheHits++;
+      return Entry;
+    }
+  }
+
   ASSERT (SEGMENT_INDEX (Address) < mPcieControllerCount);
 
-  return mConfigSpaceAddresses[SEGMENT_INDEX (Address)];
+  //
+  // Plain round-robin eviction - enumeration walks functions sequentially,
+  // so the oldest entry is also the least likely to be touched again soon.
+  //
+  Entry = &mCfgTranslationCache[mCfgTranslationNext];
+  mCfgTranslationNext = (mCfgTranslationNext + 1) % PCI_CFG_CACHE_SIZE;
+
+  Entry->BdfKey = BdfKey;
+  Entry->FunctionBase = mConfigSpaceAddresses[SEGMENT_INDEX (Address)] +
+                        (UINT32)(BdfKey & 0x0FFFF000);
+  // ignore devices > 0 on bus 0
+  Entry->Filtered = ((Address & 0xff00000) == 0 && (Address & 0xf8000) != 0);
+
+  mCfgCacheMisses++;
+  DEBUG_CODE_BEGIN ();
+  if (((mCfgCacheHits + mCfgCacheMisses) % 1024) == 0) {
+    DEBUG ((DEBUG_VERBOSE,
+      "%a: translation cache: %lu hits, %lu misses\n",
+      __FUNCTION__,
+      (UINT64)mCfgCacheHits,
+      (UINT64)mCfgCacheMisses));
+  }
+  DEBUG_CODE_END ();
+
+  return Entry;
 }
 
 /**
@@ -88,22 +153,23 @@ PciSegmentLibReadWorker (
   IN  PCI_CFG_WIDTH               Width
   )
 {
-  UINT64    Base;
+  PCI_CFG_TRANSLATION   *Entry;
+  UINT64                Target;
 
-  Base = PciSegmentLibGetConfigBase (Address);
-
-  // ignore devices > 0 on bus 0
-  if ((Address & 0xff00000) == 0 && (Address & 0xf8000) != 0) {
+  Entry = PciSegmentLibGetTranslation (Address);
+  if (Entry->Filtered) {
     return 0xffffffff;
   }
 
+  Target = Entry->FunctionBase + (Address & PCI_CFG_REGISTER_MASK);
+
   switch (Width) {
   case PciCfgWidthUint8:
-    return MmioRead8 (Base + (UINT32)Address);
+    return MmioRead8 (Target);
   case PciCfgWidthUint16:
-    return MmioRead16 (Base + (UINT32)Address);
+    return MmioRead16 (Target);
   case PciCfgWidthUint32:
-    return MmioRead32 (Base + (UINT32)Address);
+    return MmioRead32 (Target);
   default:
     ASSERT (FALSE);
   }
@@ -130,24 +196,25 @@ PciSegmentLibWriteWorker (
   IN  UINT32                      Data
   )
 {
-  UINT64    Base;
-
-  Base = PciSegmentLibGetConfigBase (Address);
+  PCI_CFG_TRANSLATION   *Entry;
+  UINT64                Target;
 
-  // ignore devices > 0 on bus 0
-  if ((Address & 0xff00000) == 0 && (Address & 0xf8000) != 0) {
+  Entry = PciSegmentLibGetTranslation (Address);
+  if (Entry->Filtered) {
     return Data;
   }
 
+  Target = Entry->FunctionBase + (Address & PCI_CFG_REGISTER_MASK);
+
   switch (Width) {
   case PciCfgWidthUint8:
-    MmioWrite8 (Base + (UINT32)Address, Data);
+    MmioWrite8 (Target, Data);
     break;
   case PciCfgWidthUint16:
-    MmioWrite16 (Base + (UINT32)Address, Data);
+    MmioWrite16 (Target, Data);
     break;
   case PciCfgWidthUint32:
-    MmioWrite32 (Base + (UINT32)Address, Data);
+    MmioWrite32 (Target, Data);
     break;
   default:
     ASSERT (FALSE);
@@ -1243,6 +1310,8 @@ PciSegmentReadBuffer (
   OUT VOID                     *Buffer
   )
 {
+  PCI_CFG_TRANSLATION               *Entry;
+  UINT64                            Target;
   UINTN                             ReturnValue;
 
   ASSERT_INVALID_PCI_SEGMENT_ADDRESS (StartAddress, 0);
@@ -1259,22 +1328,35 @@ PciSegmentReadBuffer (
   //
   ReturnValue = Size;
 
-  if ((StartAddress & BIT0) != 0) {
+  //
+  // The whole range lives in a single function's config space, so resolve
+  // the window once and issue back-to-back cycles against it instead of
+  // re-translating the address for every access.
+  //
+  Entry = PciSegmentLibGetTranslation (StartAddress);
+  if (Entry->Filtered) {
+    SetMem (Buffer, Size, 0xFF);
+    return ReturnValue;
+  }
+
+  Target = Entry->FunctionBase + (StartAddress & PCI_CFG_REGISTER_MASK);
+
+  if ((Target & BIT0) != 0) {
     //
     // Read a byte if StartAddress is byte aligned
     //
-    *(volatile UINT8 *)Buffer = PciSegmentRead8 (StartAddress);
-    StartAddress += sizeof (UINT8);
+    *(volatile UINT8 *)Buffer = MmioRead8 (Target);
+    Target += sizeof (UINT8);
     Size -= sizeof (UINT8);
     Buffer = (UINT8*)Buffer + 1;
   }
 
-  if (Size >= sizeof (UINT16) && (StartAddress & BIT1) != 0) {
+  if (Size >= sizeof (UINT16) && (Target & BIT1) != 0) {
     //
     // Read a word if StartAddress is word aligned
     //
-    WriteUnaligned16 (Buffer, PciSegmentRead16 (StartAddress));
-    StartAddress += sizeof (UINT16);
+    WriteUnaligned16 (Buffer, MmioRead16 (Target));
+    Target += sizeof (UINT16);
     Size -= sizeof (UINT16);
     Buffer = (UINT16*)Buffer + 1;
   }
@@ -1283,8 +1365,8 @@ PciSegmentReadBuffer (
     //
     // Read as many double words as possible
     //
-    WriteUnaligned32 (Buffer, PciSegmentRead32 (StartAddress));
-    StartAddress += sizeof (UINT32);
+    WriteUnaligned32 (Buffer, MmioRead32 (Target));
+    Target += sizeof (UINT32);
     Size -= sizeof (UINT32);
     Buffer = (UINT32*)Buffer + 1;
   }
@@ -1293,8 +1375,8 @@ PciSegmentReadBuffer (
     //
     // Read the last remaining word if exist
     //
-    WriteUnaligned16 (Buffer, PciSegmentRead16 (StartAddress));
-    StartAddress += sizeof (UINT16);
+    WriteUnaligned16 (Buffer, MmioRead16 (Target));
+    Target += sizeof (UINT16);
     Size -= sizeof (UINT16);
     Buffer = (UINT16*)Buffer + 1;
   }
@@ -1303,7 +1385,7 @@ PciSegmentReadBuffer (
     //
     // Read the last remaining byte if exist
     //
-    *(volatile UINT8 *)Buffer = PciSegmentRead8 (StartAddress);
+    *(volatile UINT8 *)Buffer = MmioRead8 (Target);
   }
 
   return ReturnValue;
@@ -1342,6 +1424,8 @@ PciSegmentWriteBuffer (
   IN VOID                      *Buffer
   )
 {
+  PCI_CFG_TRANSLATION               *Entry;
+  UINT64                            Target;
   UINTN                             ReturnValue;
 
   ASSERT_INVALID_PCI_SEGMENT_ADDRESS (StartAddress, 0);
@@ -1358,22 +1442,33 @@ PciSegmentWriteBuffer (
   //
   ReturnValue = Size;
 
-  if ((StartAddress & BIT0) != 0) {
+  //
+  // As in PciSegmentReadBuffer(), resolve the config window once for the
+  // whole range.
+  //
+  Entry = PciSegmentLibGetTranslation (StartAddress);
+  if (Entry->Filtered) {
+    return ReturnValue;
+  }
+
+  Target = Entry->FunctionBase + (StartAddress & PCI_CFG_REGISTER_MASK);
+
+  if ((Target & BIT0) != 0) {
     //
     // Write a byte if StartAddress is byte aligned
     //
-    PciSegmentWrite8 (StartAddress, *(UINT8*)Buffer);
-    StartAddress += sizeof (UINT8);
+    MmioWrite8 (Target, *(UINT8*)Buffer);
+    Target += sizeof (UINT8);
     Size -= sizeof (UINT8);
     Buffer = (UINT8*)Buffer + 1;
   }
 
-  if (Size >= sizeof (UINT16) && (StartAddress & BIT1) != 0) {
+  if (Size >= sizeof (UINT16) && (Target & BIT1) != 0) {
     //
     // Write a word if StartAddress is word aligned
     //
-    PciSegmentWrite16 (StartAddress, ReadUnaligned16 (Buffer));
-    StartAddress += sizeof (UINT16);
+    MmioWrite16 (Target, ReadUnaligned16 (Buffer));
+    Target += sizeof (UINT16);
     Size -= sizeof (UINT16);
     Buffer = (UINT16*)Buffer + 1;
   }
@@ -1382,8 +1477,8 @@ PciSegmentWriteBuffer (
     //
     // Write as many double words as possible
     //
-    PciSegmentWrite32 (StartAddress, ReadUnaligned32 (Buffer));
-    StartAddress += sizeof (UINT32);
+    MmioWrite32 (Target, ReadUnaligned32 (Buffer));
+    Target += sizeof (UINT32);
     Size -= sizeof (UINT32);
     Buffer = (UINT32*)Buffer + 1;
   }
@@ -1392,8 +1487,8 @@ PciSegmentWriteBuffer (
     //
     // Write the last remaining word if exist
     //
-    PciSegmentWrite16 (StartAddress, ReadUnaligned16 (Buffer));
-    StartAddress += sizeof (UINT16);
+    MmioWrite16 (Target, ReadUnaligned16 (Buffer));
+    Target += sizeof (UINT16);
     Size -= sizeof (UINT16);
     Buffer = (UINT16*)Buffer + 1;
   }
@@ -1402,7 +1497,7 @@ PciSegmentWriteBuffer (
     //
     // Write the last remaining byte if exist
     //
-    PciSegmentWrite8 (StartAddress, *(UINT8*)Buffer);
+    MmioWrite8 (Target, *(UINT8*)Buffer);
   }
 
   return ReturnValue;
@@ -1426,6 +1521,14 @@ Armada7k8kPciSegmentLibConstructor (
   EFI_STATUS Status;
   UINTN Index;
 
+  //
+  // Mark all translation cache entries as invalid - a zeroed BdfKey would
+  // alias segment 0, bus 0, device 0, function 0.
+  //
+  for (Index = 0; Index < PCI_CFG_CACHE_SIZE; Index++) {
+    mCfgTranslationCache[Index].BdfKey = MAX_UINT64;
+  }
+
   Status = gBS->LocateProtocol (
                   &gMarvellBoardDescProtocolGuid,
                   NULL,
@@ -11,6 +11,19 @@ MV_BOARD_DESC *mBoardDescInstance;
 STATIC MV_BOARD_GPIO_DESCRIPTION *mGpioDescription;
 STATIC MV_BOARD_PCIE_DESCRIPTION *mPcieDescription;
 
+/*
+ * Per-interface descriptor tables are materialized once at driver start
+ * and the same pointers are returned to every consumer thereafter.
+ */
+STATIC MV_BOARD_COMPHY_DESC *mComPhyBoardDesc;
+STATIC MV_BOARD_I2C_DESC    *mI2cBoardDesc;
+STATIC MV_BOARD_MDIO_DESC   *mMdioBoardDesc;
+STATIC MV_BOARD_AHCI_DESC   *mAhciBoardDesc;
+STATIC MV_BOARD_SDMMC_DESC  *mSdMmcBoardDesc;
+STATIC MV_BOARD_XHCI_DESC   *mXhciBoardDesc;
+STATIC MV_BOARD_PP2_DESC    *mPp2BoardDesc;
+STATIC MV_BOARD_UTMI_DESC   *mUtmiBoardDesc;
+
 STATIC
 EFI_STATUS
 MvBoardDescComPhyGet (
@@ -24,6 +37,12 @@ MvBoardDescComPhyGet (
   MV_SOC_COMPHY_DESC *SoCDesc;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mComPhyBoardDesc != NULL) {
+    *ComPhyDesc = mComPhyBoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available ComPhy controllers */
   Status = ArmadaSoCDescComPhyGet (&SoCDesc, &ComPhyCount);
   if (EFI_ERROR (Status)) {
@@ -69,6 +88,7 @@ MvBoardDescComPhyGet (
 
   BoardDesc->ComPhyDevCount = ComPhyIndex;
 
+  mComPhyBoardDesc = BoardDesc;
   *ComPhyDesc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -134,6 +154,12 @@ MvBoardDescI2cGet (
   MV_SOC_I2C_DESC *SoCDesc;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mI2cBoardDesc != NULL) {
+    *I2cDesc = mI2cBoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available I2C controllers */
   Status = ArmadaSoCDescI2cGet (&SoCDesc, &I2cCount);
   if (EFI_ERROR (Status)) {
@@ -181,6 +207,7 @@ MvBoardDescI2cGet (
 
   BoardDesc->I2cDevCount = I2cIndex;
 
+  mI2cBoardDesc = BoardDesc;
   *I2cDesc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -198,6 +225,12 @@ MvBoardDescMdioGet (
   UINTN MdioCount, Index;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mMdioBoardDesc != NULL) {
+    *MdioDesc = mMdioBoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available MDIO controllers */
   Status = ArmadaSoCDescMdioGet (&SoCDesc, &MdioCount);
   if (EFI_ERROR (Status)) {
@@ -216,6 +249,8 @@ MvBoardDescMdioGet (
   }
 
   BoardDesc->MdioDevCount = MdioCount;
+
+  mMdioBoardDesc = BoardDesc;
   *MdioDesc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -234,6 +269,12 @@ MvBoardDescAhciGet (
   MV_SOC_AHCI_DESC *SoCDesc;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mAhciBoardDesc != NULL) {
+    *AhciDesc = mAhciBoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available AHCI controllers */
   Status = ArmadaSoCDescAhciGet (&SoCDesc, &AhciCount);
   if (EFI_ERROR (Status)) {
@@ -279,6 +320,7 @@ MvBoardDescAhciGet (
 
   BoardDesc->AhciDevCount = AhciIndex;
 
+  mAhciBoardDesc = BoardDesc;
   *AhciDesc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -298,6 +340,12 @@ MvBoardDescSdMmcGet (
   MV_SOC_SDMMC_DESC *SoCDesc;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mSdMmcBoardDesc != NULL) {
+    *SdMmcDesc = mSdMmcBoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available SDMMC controllers */
   Status = ArmadaSoCDescSdMmcGet (&SoCDesc, &SdMmcCount);
   if (EFI_ERROR (Status)) {
@@ -350,6 +398,7 @@ MvBoardDescSdMmcGet (
 
   BoardDesc->SdMmcDevCount = SdMmcIndex;
 
+  mSdMmcBoardDesc = BoardDesc;
   *SdMmcDesc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -368,6 +417,12 @@ MvBoardDescXhciGet (
   MV_SOC_XHCI_DESC *SoCDesc;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mXhciBoardDesc != NULL) {
+    *XhciDesc = mXhciBoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available XHCI controllers */
   Status = ArmadaSoCDescXhciGet (&SoCDesc, &XhciCount);
   if (EFI_ERROR (Status)) {
@@ -413,6 +468,7 @@ MvBoardDescXhciGet (
 
   BoardDesc->XhciDevCount = XhciIndex;
 
+  mXhciBoardDesc = BoardDesc;
   *XhciDesc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -515,6 +571,12 @@ MvBoardDescPp2Get (
   MV_SOC_PP2_DESC *SoCDesc;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mPp2BoardDesc != NULL) {
+    *Pp2Desc = mPp2BoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available PP2 controllers */
   Status = ArmadaSoCDescPp2Get (&SoCDesc, &Pp2Count);
   if (EFI_ERROR (Status)) {
@@ -559,6 +621,7 @@ MvBoardDescPp2Get (
 
   BoardDesc->Pp2DevCount = Pp2Index;
 
+  mPp2BoardDesc = BoardDesc;
   *Pp2Desc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -577,6 +640,12 @@ MvBoardDescUtmiGet (
   MV_SOC_UTMI_DESC *SoCDesc;
   EFI_STATUS Status;
 
+  /* Use existing structure if already created. */
+  if (mUtmiBoardDesc != NULL) {
+    *UtmiDesc = mUtmiBoardDesc;
+    return EFI_SUCCESS;
+  }
+
   /* Get SoC data about all available UTMI controllers */
   Status = ArmadaSoCDescUtmiGet (&SoCDesc, &UtmiCount);
   if (EFI_ERROR (Status)) {
@@ -649,6 +718,7 @@ MvBoardDescUtmiGet (
 
   BoardDesc->UtmiDevCount = UtmiIndex;
 
+  mUtmiBoardDesc = BoardDesc;
   *UtmiDesc = BoardDesc;
 
   return EFI_SUCCESS;
@@ -660,7 +730,45 @@ MvBoardDescFree (
   IN VOID *BoardDesc
   )
 {
-  FreePool (BoardDesc);
+  /*
+   * The descriptor tables are materialized once at driver start and shared
+   * between all consumers, so there is nothing to release here.
+   */
+}
+
+/*
+ * Build all descriptor tables upfront, so the consumers are served with
+ * the already parsed structures and do not repeat the PCD parsing and
+ * allocation with every protocol call. Missing description of an interface
+ * is not an error - a board simply may not use it.
+ */
+STATIC
+VOID
+MvBoardDescMaterialize (
+  IN MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol
+  )
+{
+  MV_BOARD_PCIE_DESCRIPTION CONST *PcieDescription;
+  MV_BOARD_GPIO_DESCRIPTION *GpioDescription;
+  MV_BOARD_COMPHY_DESC *ComPhyDesc;
+  MV_BOARD_SDMMC_DESC *SdMmcDesc;
+  MV_BOARD_AHCI_DESC *AhciDesc;
+  MV_BOARD_I2C_DESC *I2cDesc;
+  MV_BOARD_MDIO_DESC *MdioDesc;
+  MV_BOARD_UTMI_DESC *UtmiDesc;
+  MV_BOARD_XHCI_DESC *XhciDesc;
+  MV_BOARD_PP2_DESC *Pp2Desc;
+
+  MvBoardDescAhciGet (BoardDescProtocol, &AhciDesc);
+  MvBoardDescComPhyGet (BoardDescProtocol, &ComPhyDesc);
+  MvBoardDescI2cGet (BoardDescProtocol, &I2cDesc);
+  MvBoardDescMdioGet (BoardDescProtocol, &MdioDesc);
+  MvBoardDescPp2Get (BoardDescProtocol, &Pp2Desc);
+  MvBoardDescSdMmcGet (BoardDescProtocol, &SdMmcDesc);
+  MvBoardDescUtmiGet (BoardDescProtocol, &UtmiDesc);
+  MvBoardDescXhciGet (BoardDescProtocol, &XhciDesc);
+  MvBoardGpioDescriptionGet (BoardDescProtocol, &GpioDescription);
+  MvBoardPcieDescriptionGet (BoardDescProtocol, &PcieDescription);
 }
 
 STATIC
@@ -702,6 +810,8 @@ MvBoardDescEntryPoint (
 
   mBoardDescInstance->Signature = MV_BOARD_DESC_SIGNATURE;
 
+  MvBoardDescMaterialize (&mBoardDescInstance->BoardDescProtocol);
+
   Status = gBS->InstallMultipleProtocolInterfaces (&(mBoardDescInstance->Handle),
                   &gMarvellBoardDescProtocolGuid,
                   &(mBoardDescInstance->BoardDescProtocol));
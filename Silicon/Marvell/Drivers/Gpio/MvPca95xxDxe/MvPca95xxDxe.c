@@ -115,6 +115,11 @@ MvPca95xxGetI2c (
   EFI_HANDLE  *HandleBuffer;
   EFI_STATUS   Status;
 
+  if (mPca95xxInstance->Shadow[ControllerIndex].I2cIo != NULL) {
+    *I2cIo = mPca95xxInstance->Shadow[ControllerIndex].I2cIo;
+    return EFI_SUCCESS;
+  }
+
   I2cBus = mPca95xxInstance->GpioExpanders[ControllerIndex].I2cBus;
   I2cAddress = mPca95xxInstance->GpioExpanders[ControllerIndex].I2cAddress;
 
@@ -143,6 +148,7 @@ MvPca95xxGetI2c (
       return Status;
     }
     if ((*I2cIo)->DeviceIndex == I2C_DEVICE_INDEX (I2cBus, I2cAddress)) {
+      mPca95xxInstance->Shadow[ControllerIndex].I2cIo = *I2cIo;
       gBS->FreePool (HandleBuffer);
       return EFI_SUCCESS;
     }
@@ -218,6 +224,93 @@ MvPca95xxWriteRegs (
   return MvPca95xxI2cTransfer (I2cIo, Reg, &RegVal, I2C_FLAG_NORESTART);
 }
 
+/*
+ * Return the shadowed value of an output/direction bank register, reading
+ * it from the chip only on first touch.
+ */
+STATIC
+EFI_STATUS
+MvPca95xxGetShadowedReg (
+  IN  EFI_I2C_IO_PROTOCOL *I2cIo,
+  IN  UINTN                ControllerIndex,
+  IN  UINT8                Reg,
+  IN  UINTN                Bank,
+  OUT UINT8               *RegVal
+  )
+{
+  PCA95XX_SHADOW *Shadow;
+  EFI_STATUS Status;
+  UINT8 *Cache;
+  UINT8 *Valid;
+
+  Shadow = &mPca95xxInstance->Shadow[ControllerIndex];
+  if (Reg == PCA95XX_DIRECTION_REG) {
+    Cache = Shadow->Direction;
+    Valid = &Shadow->DirectionValid;
+  } else {
+    Cache = Shadow->Output;
+    Valid = &Shadow->OutputValid;
+  }
+
+  if (*Valid & (1 << Bank)) {
+    *RegVal = Cache[Bank];
+    return EFI_SUCCESS;
+  }
+
+  Status = MvPca95xxReadRegs (I2cIo, Reg + Bank, RegVal);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Cache[Bank] = *RegVal;
+  *Valid |= (1 << Bank);
+
+  return EFI_SUCCESS;
+}
+
+/*
+ * Write an output/direction bank register and track the new value in the
+ * shadow. Writes carrying the value the bank already holds are skipped.
+ */
+STATIC
+EFI_STATUS
+MvPca95xxSetShadowedReg (
+  IN EFI_I2C_IO_PROTOCOL *I2cIo,
+  IN UINTN                ControllerIndex,
+  IN UINT8                Reg,
+  IN UINTN                Bank,
+  IN UINT8                RegVal
+  )
+{
+  PCA95XX_SHADOW *Shadow;
+  EFI_STATUS Status;
+  UINT8 *Cache;
+  UINT8 *Valid;
+
+  Shadow = &mPca95xxInstance->Shadow[ControllerIndex];
+  if (Reg == PCA95XX_DIRECTION_REG) {
+    Cache = Shadow->Direction;
+    Valid = &Shadow->DirectionValid;
+  } else {
+    Cache = Shadow->Output;
+    Valid = &Shadow->OutputValid;
+  }
+
+  if ((*Valid & (1 << Bank)) && (Cache[Bank] == RegVal)) {
+    return EFI_SUCCESS;
+  }
+
+  Status = MvPca95xxWriteRegs (I2cIo, Reg + Bank, RegVal);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Cache[Bank] = RegVal;
+  *Valid |= (1 << Bank);
+
+  return EFI_SUCCESS;
+}
+
 STATIC
 EFI_STATUS
 MvPca95xxSetOutputValue (
@@ -239,7 +332,11 @@ MvPca95xxSetOutputValue (
 
   Bank = GpioPin / PCA95XX_BANK_SIZE;
 
-  Status = MvPca95xxReadRegs (I2cIo, PCA95XX_OUTPUT_REG + Bank, &RegVal);
+  Status = MvPca95xxGetShadowedReg (I2cIo,
+             ControllerIndex,
+             PCA95XX_OUTPUT_REG,
+             Bank,
+             &RegVal);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: fail to read device register\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -251,7 +348,11 @@ MvPca95xxSetOutputValue (
     RegVal &= ~(1 << (GpioPin % PCA95XX_BANK_SIZE));
   }
 
-  Status = MvPca95xxWriteRegs (I2cIo, PCA95XX_OUTPUT_REG + Bank, RegVal);
+  Status = MvPca95xxSetShadowedReg (I2cIo,
+             ControllerIndex,
+             PCA95XX_OUTPUT_REG,
+             Bank,
+             RegVal);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: fail to write device register\n", __FUNCTION__));
     return EFI_DEVICE_ERROR;
@@ -281,7 +382,11 @@ MvPca95xxSetDirection (
 
   Bank = GpioPin / PCA95XX_BANK_SIZE;
 
-  Status = MvPca95xxReadRegs (I2cIo, PCA95XX_DIRECTION_REG + Bank, &RegVal);
+  Status = MvPca95xxGetShadowedReg (I2cIo,
+             ControllerIndex,
+             PCA95XX_DIRECTION_REG,
+             Bank,
+             &RegVal);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: fail to read device register\n", __FUNCTION__));
     return Status;
@@ -293,7 +398,11 @@ MvPca95xxSetDirection (
     RegVal &= ~(1 << (GpioPin % PCA95XX_BANK_SIZE));
   }
 
-  Status = MvPca95xxWriteRegs (I2cIo, PCA95XX_DIRECTION_REG + Bank, RegVal);
+  Status = MvPca95xxSetShadowedReg (I2cIo,
+             ControllerIndex,
+             PCA95XX_DIRECTION_REG,
+             Bank,
+             RegVal);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: fail to write device register\n", __FUNCTION__));
     return Status;
@@ -325,7 +434,11 @@ MvPca95xxReadMode (
 
   Bank = GpioPin / PCA95XX_BANK_SIZE;
 
-  Status = MvPca95xxReadRegs (I2cIo, PCA95XX_DIRECTION_REG + Bank, &RegVal);
+  Status = MvPca95xxGetShadowedReg (I2cIo,
+             ControllerIndex,
+             PCA95XX_DIRECTION_REG,
+             Bank,
+             &RegVal);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a: fail to read device register\n", __FUNCTION__));
     return Status;
@@ -616,6 +729,17 @@ MvPca95xxEntryPoint (
   mPca95xxInstance->GpioExpanders = GpioDescription->GpioExpanders;
   mPca95xxInstance->GpioExpanderCount = GpioDescription->GpioExpanderCount;
 
+  mPca95xxInstance->Shadow = AllocateZeroPool (
+                               mPca95xxInstance->GpioExpanderCount *
+                               sizeof (PCA95XX_SHADOW));
+  if (mPca95xxInstance->Shadow == NULL) {
+    DEBUG ((DEBUG_ERROR,
+      "%a: Fail to allocate register shadows\n",
+      __FUNCTION__));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ErrShadowAlloc;
+  }
+
   Status = gBS->InstallMultipleProtocolInterfaces (
                   &(mPca95xxInstance->ControllerHandle),
                   &gEmbeddedGpioProtocolGuid,
@@ -630,6 +754,9 @@ MvPca95xxEntryPoint (
   return EFI_SUCCESS;
 
 ErrInstallProtocols:
+  gBS->FreePool (mPca95xxInstance->Shadow);
+
+ErrShadowAlloc:
   gBS->FreePool (mPca95xxInstance);
 
 ErrPca95xxInstanceAlloc:
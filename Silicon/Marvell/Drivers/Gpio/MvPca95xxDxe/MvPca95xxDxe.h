@@ -34,6 +34,9 @@
 #define PCA95XX_OPERATION_COUNT  2
 #define PCA95XX_OPERATION_LENGTH 1
 
+/* Largest supported chip (PCA9505) has 40 pins, i.e. 5 banks */
+#define PCA95XX_MAX_BANK_COUNT   5
+
 typedef enum {
   PCA9505_PIN_COUNT = 40,
   PCA9534_PIN_COUNT = 8,
@@ -48,10 +51,27 @@ typedef enum {
   PCA9557_PIN_COUNT = 16,
 } PCA95XX_PIN_COUNT;
 
+/*
+ * Per-expander shadow state. The output and direction registers are read
+ * from the chip once per bank and updated locally afterwards, so pin
+ * updates cost a single write (or none, when the bank value is unchanged)
+ * instead of a read-modify-write per pin. The I2C protocol instance is
+ * cached alongside, as the handle database does not change for the
+ * soldered-down expanders.
+ */
+typedef struct {
+  EFI_I2C_IO_PROTOCOL *I2cIo;
+  UINT8                Output[PCA95XX_MAX_BANK_COUNT];
+  UINT8                Direction[PCA95XX_MAX_BANK_COUNT];
+  UINT8                OutputValid;
+  UINT8                DirectionValid;
+} PCA95XX_SHADOW;
+
 typedef struct {
   EMBEDDED_GPIO      GpioProtocol;
   MV_GPIO_EXPANDER  *GpioExpanders;
   UINTN              GpioExpanderCount;
+  PCA95XX_SHADOW    *Shadow;
   UINTN              Signature;
   EFI_HANDLE         ControllerHandle;
 } PCA95XX;
@@ -88,10 +88,10 @@ out:
   return Status;
 }
 
+STATIC
 EFI_STATUS
-EFIAPI
-MvEepromTransfer (
-  IN CONST MARVELL_EEPROM_PROTOCOL *This,
+MvEepromRawTransfer (
+  IN EEPROM_CONTEXT *EepromContext,
   IN UINT16 Address,
   IN UINT32 Length,
   IN UINT8 *Buffer,
@@ -101,7 +101,6 @@ MvEepromTransfer (
   EFI_I2C_REQUEST_PACKET *RequestPacket;
   UINTN RequestPacketSize;
   EFI_STATUS Status = EFI_SUCCESS;
-  EEPROM_CONTEXT *EepromContext = EEPROM_SC_FROM_EEPROM(This);
   UINT32 BufferLength;
   UINT32 Transmitted = 0;
   UINT32 CurrentAddress = Address;
@@ -125,7 +124,18 @@ MvEepromTransfer (
 
   while (Length > 0) {
     CurrentAddress = Address + Transmitted;
-    BufferLength = (Length <= MAX_BUFFER_LENGTH ? Length : MAX_BUFFER_LENGTH);
+    if (Operation == EEPROM_READ) {
+      /* Sequential reads are not page-limited - read back-to-back in
+         transactions as large as the protocol allows */
+      BufferLength = (Length <= MAX_READ_LENGTH ? Length : MAX_READ_LENGTH);
+    } else {
+      /* Writes must not cross a page boundary or the address wraps
+         within the page - clamp each chunk to the end of its page */
+      BufferLength = MAX_BUFFER_LENGTH - (CurrentAddress % MAX_BUFFER_LENGTH);
+      if (Length < BufferLength) {
+        BufferLength = Length;
+      }
+    }
     RequestPacket->Operation[0].Buffer[0] = (CurrentAddress >> 8) & 0xff;
     RequestPacket->Operation[0].Buffer[1] = CurrentAddress & 0xff;
     RequestPacket->Operation[1].LengthInBytes = BufferLength;
@@ -144,6 +154,48 @@ MvEepromTransfer (
   return Status;
 }
 
+EFI_STATUS
+EFIAPI
+MvEepromTransfer (
+  IN CONST MARVELL_EEPROM_PROTOCOL *This,
+  IN UINT16 Address,
+  IN UINT32 Length,
+  IN UINT8 *Buffer,
+  IN UINT8 Operation
+  )
+{
+  EEPROM_CONTEXT *EepromContext = EEPROM_SC_FROM_EEPROM(This);
+  EFI_STATUS Status;
+
+  ASSERT(EepromContext != NULL);
+
+  /* Reads contained in the board-config area are served from a cache
+     filled with a single bulk read the first time the area is touched */
+  if (Operation == EEPROM_READ &&
+      Address + Length <= EEPROM_CONFIG_REGION_SIZE) {
+    if (!EepromContext->ConfigCacheValid) {
+      Status = MvEepromRawTransfer (EepromContext,
+                 0,
+                 EEPROM_CONFIG_REGION_SIZE,
+                 EepromContext->ConfigCache,
+                 EEPROM_READ);
+      if (EFI_ERROR(Status)) {
+        return Status;
+      }
+      EepromContext->ConfigCacheValid = TRUE;
+    }
+    CopyMem (Buffer, EepromContext->ConfigCache + Address, Length);
+    return EFI_SUCCESS;
+  }
+
+  /* Writes touching the board-config area invalidate the cache */
+  if (Operation == EEPROM_WRITE && Address < EEPROM_CONFIG_REGION_SIZE) {
+    EepromContext->ConfigCacheValid = FALSE;
+  }
+
+  return MvEepromRawTransfer (EepromContext, Address, Length, Buffer, Operation);
+}
+
 EFI_STATUS
 EFIAPI
 MvEepromStart (
@@ -12,8 +12,16 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define EEPROM_SIGNATURE          SIGNATURE_32 ('E', 'E', 'P', 'R')
 
+/* Write page size of the EEPROM - writes must not cross a page boundary */
 #define MAX_BUFFER_LENGTH 64
 
+/* Sequential reads are not page-limited, so use much larger transactions */
+#define MAX_READ_LENGTH 2048
+
+/* Board configuration area at the start of the EEPROM, prefetched once
+   and served from cache on subsequent reads */
+#define EEPROM_CONFIG_REGION_SIZE 256
+
 #define I2C_GUID \
   { \
   0xadc1901b, 0xb83c, 0x4831, { 0x8f, 0x59, 0x70, 0x89, 0x8f, 0x26, 0x57, 0x1e } \
@@ -24,6 +32,8 @@ typedef struct {
   EFI_HANDLE ControllerHandle;
   EFI_I2C_IO_PROTOCOL *I2cIo;
   MARVELL_EEPROM_PROTOCOL EepromProtocol;
+  UINT8   ConfigCache[EEPROM_CONFIG_REGION_SIZE];
+  BOOLEAN ConfigCacheValid;
 } EEPROM_CONTEXT;
 
 #define EEPROM_SC_FROM_IO(a) CR (a, EEPROM_CONTEXT, I2cIo, EEPROM_SIGNATURE)
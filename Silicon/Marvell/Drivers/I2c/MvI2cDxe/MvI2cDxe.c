@@ -272,7 +272,7 @@ MvI2cClearIflg (
   MvI2cControlClear(I2cMasterContext, I2C_CONTROL_IFLG);
 }
 
-/* Timeout is given in us */
+/* Timeout is given in us. Returns 0 on success, non-zero on timeout. */
 STATIC
 UINTN
 MvI2cPollCtrl (
@@ -280,11 +280,23 @@ MvI2cPollCtrl (
   IN UINTN Timeout,
   IN UINT32 Mask)
 {
+  UINTN Spin;
+
+  /*
+   * The controller raises IFLG within a few bus clocks of each byte,
+   * so spin on the register first and fall back to timed 10 us polls
+   * only for slow or absent slaves.
+   */
+  for (Spin = 0; Spin < I2C_POLL_SPIN_COUNT; Spin++) {
+    if (I2C_READ(I2cMasterContext, I2C_CONTROL) & Mask)
+      return (0);
+  }
+
   Timeout /= 10;
   while (!(I2C_READ(I2cMasterContext, I2C_CONTROL) & Mask)) {
     gBS->Stall(10);
     if (--Timeout == 0)
-      return (Timeout);
+      return (1);
   }
   return (0);
 }
@@ -332,8 +344,11 @@ MvI2cLockedStart (
     return EFI_DEVICE_ERROR;
   }
 
+  /*
+   * IFLG is still set from the START condition at this point, so clearing
+   * it pushes the Slave address out right away - no settling delay needed.
+   */
   I2C_WRITE(I2cMasterContext, I2C_DATA, Slave);
-  gBS->Stall(I2C_OPERATION_TIMEOUT);
   MvI2cClearIflg(I2cMasterContext);
 
   if (MvI2cPollCtrl(I2cMasterContext, Timeout, I2C_CONTROL_IFLG)) {
@@ -467,7 +482,6 @@ MvI2cStop (
 {
   EfiAcquireLock (&I2cMasterContext->Lock);
   MvI2cControlSet(I2cMasterContext, I2C_CONTROL_STOP);
-  gBS->Stall(I2C_OPERATION_TIMEOUT);
   MvI2cClearIflg(I2cMasterContext);
   EfiReleaseLock (&I2cMasterContext->Lock);
 
@@ -502,7 +516,12 @@ MvI2cRead (
     else
       MvI2cControlSet(I2cMasterContext, I2C_CONTROL_ACK);
 
-    gBS->Stall (I2C_OPERATION_TIMEOUT);
+    /*
+     * Clearing IFLG starts the byte transfer; MvI2cClearIflg() already
+     * waits for the flag, so no fixed per-byte stall is required. This
+     * matters for the SPD/board-config EEPROM dumps, which pull whole
+     * pages through this loop during boot.
+     */
     MvI2cClearIflg(I2cMasterContext);
 
     if (MvI2cPollCtrl(I2cMasterContext, delay, I2C_CONTROL_IFLG)) {
@@ -620,7 +639,7 @@ MvI2cStartRequest (
                  Operation->Buffer,
                  Operation->LengthInBytes,
                  &Transmitted,
-                 Count == 1,
+                 Count == RequestPacket->OperationCount - 1,
                  I2C_TRANSFER_TIMEOUT);
       Operation->LengthInBytes = Transmitted;
     } else {
@@ -647,11 +666,18 @@ MvI2cStartRequest (
     }
   }
 
+  /*
+   * The whole packet was executed above, so for asynchronous callers the
+   * request is already complete - report the transaction result through
+   * I2cStatus and signal the Event, as I2cHost expects.
+   */
   if (I2cStatus != NULL)
-    *I2cStatus = EFI_SUCCESS;
-  if (Event != NULL)
+    *I2cStatus = Status;
+  if (Event != NULL) {
     gBS->SignalEvent(Event);
-  return EFI_SUCCESS;
+    return EFI_SUCCESS;
+  }
+  return Status;
 }
 
 STATIC CONST EFI_GUID DevGuid = I2C_GUID;
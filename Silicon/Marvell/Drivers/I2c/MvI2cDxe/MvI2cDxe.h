@@ -42,6 +42,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define I2C_SOFT_RESET    0x1c
 #define I2C_TRANSFER_TIMEOUT 10000
 #define I2C_OPERATION_TIMEOUT 100
+#define I2C_POLL_SPIN_COUNT  100
 
 #define I2C_UNKNOWN        0x0
 #define I2C_SLOW           0x1
@@ -134,6 +134,15 @@ Mvpp2PoolRefill (
   IN UINT32 Cookie
   );
 
+VOID
+Mvpp2BmPoolBulkPut (
+  IN MVPP2_SHARED *Priv,
+  IN INT32 Pool,
+  IN UINT64 BufPhysAddr,
+  IN UINT32 BufStride,
+  IN UINT32 BufNum
+  );
+
 INTN
 Mvpp2BmPoolCtrl (
   IN MVPP2_SHARED *Priv,
@@ -6,6 +6,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 *******************************************************************************/
 
+#include <Guid/Pp2ChecksumOffload.h>
+
 #include <Protocol/BoardDesc.h>
 #include <Protocol/DevicePath.h>
 #include <Protocol/DriverBinding.h>
@@ -28,6 +30,11 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define ReturnUnlock(tpl, status) do { gBS->RestoreTPL (tpl); return (status); } while(0)
 
+#define PP2_ETHERTYPE_IPV4  0x0800
+#define PP2_ETHERTYPE_IPV6  0x86DD
+#define PP2_IP_PROTO_TCP    6
+#define PP2_IP_PROTO_UDP    17
+
 STATIC PP2_DEVICE_PATH Pp2DevicePathTemplate = {
   {
     {
@@ -61,8 +68,8 @@ EFI_SIMPLE_NETWORK_PROTOCOL Pp2SnpTemplate = {
   Pp2SnpIpToMac,                                        // MCastIpToMac
   NULL,                                                 // NvData
   Pp2SnpGetStatus,                                      // GetStatus
-  Pp2SnpTransmit,                                       // Transmit
-  Pp2SnpReceive,                                        // Receive
+  Pp2SnpTransmitTimed,                                  // Transmit
+  Pp2SnpReceiveTimed,                                   // Receive
   NULL,                                                 // WaitForPacket
   NULL                                                  // Mode
 };
@@ -142,6 +149,64 @@ QueueRemove (
   return Buffer;
 }
 
+#define TxInFlightNext(off)  ((((off) + 1) >= TX_INFLIGHT_QUEUE_DEPTH) ? 0 : ((off) + 1))
+
+STATIC
+BOOLEAN
+TxInFlightFull (
+  IN PP2DXE_CONTEXT *Pp2Context
+  )
+{
+  return TxInFlightNext (Pp2Context->TxInFlightTail) == Pp2Context->TxInFlightHead;
+}
+
+STATIC
+EFI_STATUS
+TxInFlightInsert (
+  IN PP2DXE_CONTEXT *Pp2Context,
+  IN VOID *Buffer
+  )
+{
+
+  if (TxInFlightFull (Pp2Context)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Pp2Context->TxInFlightQueue[Pp2Context->TxInFlightTail] = Buffer;
+  Pp2Context->TxInFlightTail = TxInFlightNext (Pp2Context->TxInFlightTail);
+
+  return EFI_SUCCESS;
+}
+
+/*
+ * Move the buffers whose descriptors the hardware reports as transmitted
+ * from the in-flight queue to the GetStatus completion queue. Transmit
+ * completion is in submission order on the single TXQ. Non-blocking; a
+ * full completion queue just defers the hand-over to the next call.
+ */
+STATIC
+VOID
+Pp2TxReclaim (
+  IN PP2DXE_CONTEXT *Pp2Context
+  )
+{
+  PP2DXE_PORT *Port = &Pp2Context->Port;
+  VOID *Buffer;
+
+  Pp2Context->TxDoneCount += Mvpp2TxqSentDescProc(Port, &Port->Txqs[0]);
+
+  while (Pp2Context->TxDoneCount != 0 &&
+         Pp2Context->TxInFlightHead != Pp2Context->TxInFlightTail) {
+    Buffer = Pp2Context->TxInFlightQueue[Pp2Context->TxInFlightHead];
+    if (EFI_ERROR (QueueInsert (Pp2Context, Buffer))) {
+      break;
+    }
+    Pp2Context->TxInFlightQueue[Pp2Context->TxInFlightHead] = NULL;
+    Pp2Context->TxInFlightHead = TxInFlightNext (Pp2Context->TxInFlightHead);
+    Pp2Context->TxDoneCount--;
+  }
+}
+
 STATIC
 EFI_STATUS
 Pp2DxeBmPoolInit (
@@ -162,7 +227,7 @@ Pp2DxeBmPoolInit (
     Mvpp2BmIrqClear(Mvpp2Shared, Index);
   }
 
-  for (Index = 0; Index < MVPP2_MAX_PORT; Index++) {
+  for (Index = 0; Index < MVPP2_BM_POOLS_USED; Index++) {
     Mvpp2Shared->BmPools[Index] = AllocateZeroPool (sizeof(MVPP2_BMS_POOL));
 
     if (Mvpp2Shared->BmPools[Index] == NULL) {
@@ -210,7 +275,7 @@ Pp2DxeBmStart (
   )
 {
   UINT8 *Buff, *BuffPhys;
-  INTN Index, Pool;
+  INTN Pool;
 
   ASSERT(BM_ALIGN >= sizeof(UINTN));
 
@@ -218,18 +283,34 @@ Pp2DxeBmStart (
     Mvpp2BmPoolCtrl(Mvpp2Shared, Pool, MVPP2_START);
     Mvpp2BmPoolBufsizeSet(Mvpp2Shared, Mvpp2Shared->BmPools[Pool], RX_BUFFER_SIZE);
 
-    /* Fill BM pool with Buffers */
-    for (Index = 0; Index < MVPP2_BM_SIZE; Index++) {
-      Buff = (UINT8 *)(Mvpp2Shared->BufferLocation.RxBuffers[Pool] + (Index * RX_BUFFER_SIZE));
-      if (Buff == NULL) {
-        return EFI_OUT_OF_RESOURCES;
-      }
-
-      BuffPhys = ALIGN_POINTER(Buff, BM_ALIGN);
-      Mvpp2BmPoolPut(Mvpp2Shared, Pool, (UINTN)BuffPhys, (UINTN)BuffPhys);
+    /* Fill BM pool with Buffers in a single batch */
+    Buff = (UINT8 *)Mvpp2Shared->BufferLocation.RxBuffers[Pool];
+    if (Buff == NULL) {
+      return EFI_OUT_OF_RESOURCES;
     }
+
+    BuffPhys = ALIGN_POINTER(Buff, BM_ALIGN);
+    Mvpp2BmPoolBulkPut(Mvpp2Shared, Pool, (UINTN)BuffPhys, RX_BUFFER_SIZE, MVPP2_BM_SIZE);
   }
 
+  /* Start and fill the long pool, shared by jumbo frames of all ports */
+  Mvpp2BmPoolCtrl(Mvpp2Shared, MVPP2_BM_LONG_POOL, MVPP2_START);
+  Mvpp2BmPoolBufsizeSet(Mvpp2Shared,
+                        Mvpp2Shared->BmPools[MVPP2_BM_LONG_POOL],
+                        RX_JUMBO_BUFFER_SIZE);
+
+  Buff = (UINT8 *)Mvpp2Shared->BufferLocation.RxJumboBuffers;
+  if (Buff == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  BuffPhys = ALIGN_POINTER(Buff, BM_ALIGN);
+  Mvpp2BmPoolBulkPut(Mvpp2Shared,
+                     MVPP2_BM_LONG_POOL,
+                     (UINTN)BuffPhys,
+                     RX_JUMBO_BUFFER_SIZE,
+                     MVPP2_BM_LONG_SIZE);
+
   Mvpp2Shared->BmEnabled = TRUE;
 
   return EFI_SUCCESS;
@@ -455,10 +536,18 @@ Pp2DxeLateInitialize (
       return Status;
     }
 
-    /* Attach pool to Rxq */
-    Mvpp2RxqLongPoolSet(Port, 0, Port->Id);
+    /* Attach pools to Rxq - oversize frames fall back to the long pool */
+    Mvpp2RxqLongPoolSet(Port, 0, MVPP2_BM_LONG_POOL);
     Mvpp2RxqShortPoolSet(Port, 0, Port->Id);
 
+    /*
+     * Unmask the RXQ occupied cause so packet arrival is latched in the
+     * ISR cause register polled by Pp2WaitForPacketNotify.
+     */
+    Mvpp2Write(Port->Priv,
+               MVPP2_ISR_RX_TX_MASK_REG(Port->Id),
+               MVPP2_CAUSE_RXQ_OCCUP_DESC_ALL_MASK);
+
     /*
      * Mark this port being fully initialized,
      * otherwise it will be inited again
@@ -671,6 +760,7 @@ Pp2SnpShutdown (
   SavedTpl = gBS->RaiseTPL (TPL_CALLBACK);
   PP2DXE_CONTEXT *Pp2Context = INSTANCE_FROM_SNP(This);
   UINT32 State = This->Mode->State;
+  INTN PollingCount;
 
   if (State != EfiSimpleNetworkInitialized) {
     switch (State) {
@@ -685,6 +775,19 @@ Pp2SnpShutdown (
     }
   }
 
+  /*
+   * Drain in-flight transmits so callers can still recover their buffers
+   * through GetStatus after the interface is shut down.
+   */
+  PollingCount = 0;
+  while (Pp2Context->TxInFlightHead != Pp2Context->TxInFlightTail) {
+    Pp2TxReclaim (Pp2Context);
+    if (PollingCount++ > MVPP2_TX_SEND_MAX_POLLING_COUNT) {
+      DEBUG((DEBUG_ERROR, "Pp2Dxe: transmit drain polling failed\n"));
+      break;
+    }
+  }
+
   ReturnUnlock (SavedTpl, EFI_SUCCESS);
 }
 
@@ -833,6 +936,9 @@ Pp2SnpGetStatus (
   }
   Snp->Mode->MediaPresent = LinkUp;
 
+  /* Collect buffers whose transmit has completed since the last call */
+  Pp2TxReclaim (Pp2Context);
+
   if (TxBuf != NULL) {
     *TxBuf = QueueRemove (Pp2Context);
   }
@@ -840,6 +946,68 @@ Pp2SnpGetStatus (
   ReturnUnlock(SavedTpl, EFI_SUCCESS);
 }
 
+/*
+ * Build the checksum related part of the transmit descriptor command.
+ *
+ * When the consumer enabled generation through the checksum offload
+ * AdapterInfo type, recognized IPv4/IPv6 TCP and UDP frames are described
+ * to the classifier (L3 offset, IP header length, L4 protocol) so it fills
+ * in the checksums. Anything else keeps generation disabled, matching the
+ * previous unconditional behaviour.
+ */
+STATIC
+UINT32
+Pp2TxChecksumCommand (
+  IN PP2DXE_CONTEXT *Pp2Context,
+  IN UINT8          *Packet,
+  IN UINTN          Length
+  )
+{
+  UINT16 EtherType;
+  UINT8 IpHdrLen;
+  UINT8 L4Proto;
+  UINT32 Command;
+
+  if (!Pp2Context->TxChecksumGenerate ||
+      Length < sizeof(ETHER_HEAD) + sizeof(EFI_IP4_HEADER)) {
+    return MVPP2_TXD_IP_CSUM_DISABLE | MVPP2_TXD_L4_CSUM_NOT;
+  }
+
+  EtherType = NTOHS (*(UINT16 *)&Packet[12]);
+  Command = sizeof(ETHER_HEAD) << MVPP2_TXD_L3_OFF_SHIFT;
+
+  switch (EtherType) {
+  case PP2_ETHERTYPE_IPV4:
+    IpHdrLen = Packet[sizeof(ETHER_HEAD)] & 0x0f;
+    L4Proto = Packet[sizeof(ETHER_HEAD) + 9];
+    break;
+  case PP2_ETHERTYPE_IPV6:
+    /* No L3 checksum in IPv6, header length is fixed at 40 bytes */
+    Command |= MVPP2_TXD_L3_IP6 | MVPP2_TXD_IP_CSUM_DISABLE;
+    IpHdrLen = sizeof(EFI_IP6_HEADER) >> 2;
+    L4Proto = Packet[sizeof(ETHER_HEAD) + 6];
+    break;
+  default:
+    return MVPP2_TXD_IP_CSUM_DISABLE | MVPP2_TXD_L4_CSUM_NOT;
+  }
+
+  Command |= IpHdrLen << MVPP2_TXD_IP_HLEN_SHIFT;
+
+  switch (L4Proto) {
+  case PP2_IP_PROTO_TCP:
+    /* Full L4 checksum - neither NOT nor FRAG bit set */
+    break;
+  case PP2_IP_PROTO_UDP:
+    Command |= MVPP2_TXD_L4_UDP;
+    break;
+  default:
+    Command |= MVPP2_TXD_L4_CSUM_NOT;
+    break;
+  }
+
+  return Command;
+}
+
 EFI_STATUS
 EFIAPI
 Pp2SnpTransmit (
@@ -858,8 +1026,6 @@ Pp2SnpTransmit (
   MVPP2_TX_QUEUE *AggrTxq = Mvpp2Shared->AggrTxqs;
   MVPP2_TX_DESC *TxDesc;
   EFI_STATUS Status;
-  INTN PollingCount;
-  INTN TxSent;
   UINT8 *DataPtr = Buffer;
   UINT16 EtherType;
   UINT32 State = This->Mode->State;
@@ -899,6 +1065,15 @@ Pp2SnpTransmit (
 
   EtherType = HTONS (*EtherTypePtr);
 
+  /*
+   * Reclaim finished descriptors first, so a full in-flight queue means
+   * the TXQ ring really is busy.
+   */
+  Pp2TxReclaim (Pp2Context);
+  if (TxInFlightFull (Pp2Context)) {
+    ReturnUnlock(SavedTpl, EFI_NOT_READY);
+  }
+
   /* Fetch next descriptor */
   TxDesc = Mvpp2TxqNextDescGet(AggrTxq);
 
@@ -919,7 +1094,7 @@ Pp2SnpTransmit (
   }
 
   /* Set descriptor fields */
-  TxDesc->command =  MVPP2_TXD_IP_CSUM_DISABLE | MVPP2_TXD_L4_CSUM_NOT |
+  TxDesc->command =  Pp2TxChecksumCommand (Pp2Context, DataPtr, BufferSize) |
                      MVPP2_TXD_F_DESC | MVPP2_TXD_L_DESC;
   TxDesc->DataSize = BufferSize;
   TxDesc->PacketOffset = (PhysAddrT)DataPtr & MVPP2_TX_DESC_ALIGN;
@@ -932,36 +1107,11 @@ Pp2SnpTransmit (
   Mvpp2AggrTxqPendDescAdd(Port, 1);
 
   /*
-   * Egress processing:
-   * Wait until packet is passed from per-cpu aggregated queue
-   * to physical per-port TXQ.
+   * Completion is asynchronous: the hardware transmits directly from the
+   * caller buffer, which stays owned by the hardware until GetStatus
+   * reports it back through the completion queue. No per-packet wait.
    */
-  PollingCount = 0;
-  TxSent = Mvpp2AggrTxqPendDescNumGet(Mvpp2Shared, 0);
-  do {
-    if (PollingCount++ > MVPP2_TX_SEND_MAX_POLLING_COUNT) {
-      DEBUG((DEBUG_ERROR, "Pp2Dxe: transmit polling failed\n"));
-      ReturnUnlock(SavedTpl, EFI_TIMEOUT);
-    }
-    TxSent = Mvpp2AggrTxqPendDescNumGet(Mvpp2Shared, 0);
-  } while (TxSent);
-
-  /* Wait for packet to be transmitted by hardware. */
-  PollingCount = 0;
-  TxSent = Mvpp2TxqSentDescProc(Port, &Port->Txqs[0]);
-  while (!TxSent) {
-    if (PollingCount++ > MVPP2_TX_SEND_MAX_POLLING_COUNT) {
-      DEBUG((DEBUG_ERROR, "Pp2Dxe: transmit polling failed\n"));
-      ReturnUnlock(SavedTpl, EFI_TIMEOUT);
-    }
-    TxSent = Mvpp2TxqSentDescProc(Port, &Port->Txqs[0]);
-  }
-
-  /*
-   * At this point TxSent has increased - HW sent the packet
-   * Add buffer to completion queue and return.
-   */
-  Status = QueueInsert (Pp2Context, Buffer);
+  Status = TxInFlightInsert (Pp2Context, Buffer);
   ReturnUnlock (SavedTpl, Status);
 }
 
@@ -1005,6 +1155,9 @@ Pp2SnpReceive (
   RxDesc = Mvpp2RxqNextDescGet(Rxq);
   StatusReg = RxDesc->status;
 
+  /* Preserve classifier parse result for the checksum offload AdapterInfo */
+  Pp2Context->LastRxStatus = StatusReg;
+
   /* extract addresses from descriptor */
   PhysAddr = RxDesc->BufPhysAddrKeyHash & MVPP22_ADDR_MASK;
   VirtAddr = RxDesc->BufCookieBmQsetClsInfo & MVPP22_ADDR_MASK;
@@ -1060,6 +1213,210 @@ drop:
   ReturnUnlock(SavedTpl, Status);
 }
 
+/*
+ * Performance accounting wrappers registered in Pp2SnpTemplate; they
+ * delegate to the real Transmit/Receive and only touch the counters.
+ */
+EFI_STATUS
+EFIAPI
+Pp2SnpTransmitTimed (
+  IN EFI_SIMPLE_NETWORK_PROTOCOL *This,
+  IN UINTN                       HeaderSize,
+  IN UINTN                       BufferSize,
+  IN VOID                        *Buffer,
+  IN EFI_MAC_ADDRESS             *SrcAddr  OPTIONAL,
+  IN EFI_MAC_ADDRESS             *DestAddr OPTIONAL,
+  IN UINT16                      *EtherTypePtr OPTIONAL
+  )
+{
+  SNP_PERF_STATS *Stats;
+  EFI_STATUS Status;
+  UINT64 Start;
+
+  Start = SnpPerfTimestamp();
+  Status = Pp2SnpTransmit(This, HeaderSize, BufferSize, Buffer, SrcAddr,
+             DestAddr, EtherTypePtr);
+
+  if (This != NULL) {
+    Stats = INSTANCE_FROM_SNP(This)->PerfStats;
+    SnpPerfAddElapsed(&Stats->TxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->TxPackets++;
+      Stats->TxBytes += BufferSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->TxRingFull++;
+    }
+  }
+
+  return Status;
+}
+
+EFI_STATUS
+EFIAPI
+Pp2SnpReceiveTimed (
+  IN EFI_SIMPLE_NETWORK_PROTOCOL *This,
+  OUT UINTN                      *HeaderSize OPTIONAL,
+  IN OUT UINTN                   *BufferSize,
+  OUT VOID                       *Buffer,
+  OUT EFI_MAC_ADDRESS            *SrcAddr OPTIONAL,
+  OUT EFI_MAC_ADDRESS            *DstAddr OPTIONAL,
+  OUT UINT16                     *EtherType OPTIONAL
+  )
+{
+  SNP_PERF_STATS *Stats;
+  EFI_STATUS Status;
+  UINT64 Start;
+
+  Start = SnpPerfTimestamp();
+  Status = Pp2SnpReceive(This, HeaderSize, BufferSize, Buffer, SrcAddr,
+             DstAddr, EtherType);
+
+  if (This != NULL) {
+    Stats = INSTANCE_FROM_SNP(This)->PerfStats;
+    SnpPerfAddElapsed(&Stats->RxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->RxPackets++;
+      Stats->RxBytes += *BufferSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->RxPollEmpty++;
+    }
+  }
+
+  return Status;
+}
+
+/*
+ * Vendor burst receive - drain up to *FrameCount completed RX descriptors
+ * in a single call instead of one frame per Pp2SnpReceive invocation.
+ * See Protocol/Pp2BurstReceive.h for the interface contract.
+ */
+EFI_STATUS
+EFIAPI
+Pp2BurstReceive (
+  IN     MARVELL_PP2_BURST_RECEIVE_PROTOCOL *This,
+  IN OUT UINTN                              *FrameCount,
+  IN OUT MARVELL_PP2_RX_FRAME               *Frames
+  )
+{
+  PP2DXE_CONTEXT *Pp2Context;
+  PP2DXE_PORT *Port;
+  MVPP2_SHARED *Mvpp2Shared;
+  MVPP2_RX_QUEUE *Rxq;
+  MVPP2_RX_DESC *RxDesc;
+  EFI_STATUS Status = EFI_SUCCESS;
+  EFI_TPL SavedTpl;
+  INTN ReceivedPackets;
+  INTN Processed;
+  UINTN Delivered;
+  UINTN PhysAddr, VirtAddr;
+  UINT32 StatusReg;
+  UINTN PktLength;
+  INTN PoolId;
+
+  if (This == NULL || FrameCount == NULL || Frames == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Pp2Context = INSTANCE_FROM_BURST_RX(This);
+  Port = &Pp2Context->Port;
+  Mvpp2Shared = Port->Priv;
+  Rxq = &Port->Rxqs[0];
+
+  ASSERT (Port != NULL);
+  ASSERT (Rxq != NULL);
+
+  SavedTpl = gBS->RaiseTPL (TPL_CALLBACK);
+  ReceivedPackets = Mvpp2RxqReceived(Port, Rxq->Id);
+
+  if (ReceivedPackets == 0) {
+    *FrameCount = 0;
+    ReturnUnlock(SavedTpl, EFI_NOT_READY);
+  }
+
+  Processed = 0;
+  Delivered = 0;
+
+  while (Processed < ReceivedPackets && Delivered < *FrameCount) {
+    /* Peek the descriptor so an undersized caller buffer leaves the frame in the ring */
+    RxDesc = Rxq->Descs + Rxq->NextDescToProc;
+    StatusReg = RxDesc->status;
+
+    if (!(StatusReg & (MVPP2_RXD_BUF_HDR | MVPP2_RXD_ERR_SUMMARY))) {
+      PktLength = (UINTN) RxDesc->DataSize - 2;
+      if (PktLength > Frames[Delivered].BufferSize) {
+        Frames[Delivered].BufferSize = PktLength;
+        Status = EFI_BUFFER_TOO_SMALL;
+        break;
+      }
+    }
+
+    /* Consume the descriptor */
+    Mvpp2RxqNextDescGet(Rxq);
+    Processed++;
+
+    /* extract addresses from descriptor */
+    PhysAddr = RxDesc->BufPhysAddrKeyHash & MVPP22_ADDR_MASK;
+    VirtAddr = RxDesc->BufCookieBmQsetClsInfo & MVPP22_ADDR_MASK;
+
+    /* Drop packets with error or with buffer header (MC, SG) */
+    if ((StatusReg & MVPP2_RXD_BUF_HDR) || (StatusReg & MVPP2_RXD_ERR_SUMMARY)) {
+      DEBUG((DEBUG_WARN, "Pp2Dxe: dropping packet\n"));
+    } else {
+      PktLength = (UINTN) RxDesc->DataSize - 2;
+      CopyMem (Frames[Delivered].Buffer, (VOID*) (PhysAddr + 2), PktLength);
+      Frames[Delivered].BufferSize = PktLength;
+      Frames[Delivered].RxStatus = StatusReg;
+
+      /* Preserve classifier parse result for the checksum offload AdapterInfo */
+      Pp2Context->LastRxStatus = StatusReg;
+      Delivered++;
+    }
+
+    /* Refill: pass packet back to BM */
+    PoolId = (StatusReg & MVPP2_RXD_BM_POOL_ID_MASK) >> MVPP2_RXD_BM_POOL_ID_OFFS;
+    Mvpp2BmPoolPut(Mvpp2Shared, PoolId, PhysAddr, VirtAddr);
+  }
+
+  if (Processed != 0) {
+    /* Update counters with all packets received and refilled in this burst */
+    Mvpp2RxqStatusUpdate(Port, Rxq->Id, Processed, Processed);
+  }
+
+  *FrameCount = Delivered;
+
+  ReturnUnlock(SavedTpl, Status);
+}
+
+/*
+ * Wait-notify callback backing Snp.WaitForPacket. The event core invokes
+ * it whenever a consumer checks or waits on the event; the event is
+ * signalled as soon as the RX cause register reports occupied
+ * descriptors, so the network stack wakes on packet arrival instead of
+ * sleeping through a fixed poll period.
+ */
+STATIC
+VOID
+EFIAPI
+Pp2WaitForPacketNotify (
+  IN EFI_EVENT Event,
+  IN VOID *Context
+  )
+{
+  PP2DXE_CONTEXT *Pp2Context = Context;
+  PP2DXE_PORT *Port = &Pp2Context->Port;
+  UINT32 CauseRxTx;
+
+  if (!Pp2Context->Initialized) {
+    return;
+  }
+
+  CauseRxTx = Mvpp2Read (Port->Priv, MVPP2_ISR_RX_TX_CAUSE_REG(Port->Id));
+
+  if (CauseRxTx & MVPP2_CAUSE_RXQ_OCCUP_DESC_ALL_MASK) {
+    gBS->SignalEvent (Event);
+  }
+}
+
 EFI_STATUS
 Pp2DxeSnpInstall (
   IN PP2DXE_CONTEXT *Pp2Context
@@ -1069,6 +1426,7 @@ Pp2DxeSnpInstall (
   EFI_STATUS Status;
   PP2_DEVICE_PATH *Pp2DevicePath;
   EFI_SIMPLE_NETWORK_MODE *SnpMode;
+  CHAR8 PerfName[] = "Pp2Dxe0";
 
   Pp2DevicePath = AllocateCopyPool (sizeof (PP2_DEVICE_PATH), &Pp2DevicePathTemplate);
   if (Pp2DevicePath == NULL) {
@@ -1097,6 +1455,24 @@ Pp2DxeSnpInstall (
   SetMem (&SnpMode->BroadcastAddress, sizeof (EFI_MAC_ADDRESS), 0xFF);
 
   Pp2Context->Snp.Mode = SnpMode;
+  Pp2Context->BurstRx.Receive = Pp2BurstReceive;
+
+  /* One perf table entry per port, e.g. "Pp2Dxe0" */
+  PerfName[6] = (CHAR8)('0' + Pp2Context->Instance);
+  Pp2Context->PerfStats = SnpPerfRegister (PerfName);
+
+  /* Event-driven RX wakeup - see Pp2WaitForPacketNotify */
+  Status = gBS->CreateEvent (
+      EVT_NOTIFY_WAIT,
+      TPL_NOTIFY,
+      Pp2WaitForPacketNotify,
+      Pp2Context,
+      &Pp2Context->Snp.WaitForPacket
+      );
+  if (EFI_ERROR(Status)) {
+    DEBUG((DEBUG_ERROR, "Failed to create WaitForPacket event.\n"));
+    return Status;
+  }
 
   /* Install protocol */
   Status = gBS->InstallMultipleProtocolInterfaces (
@@ -1104,6 +1480,7 @@ Pp2DxeSnpInstall (
       &gEfiSimpleNetworkProtocolGuid, &Pp2Context->Snp,
       &gEfiDevicePathProtocolGuid, Pp2DevicePath,
       &gEfiAdapterInformationProtocolGuid, &Pp2Context->Aip,
+      &gMarvellPp2BurstReceiveProtocolGuid, &Pp2Context->BurstRx,
       NULL
       );
 
@@ -1146,14 +1523,37 @@ Pp2AipGetInformation (
   OUT UINTN                             *InformationBlockSize
   )
 {
-  EFI_ADAPTER_INFO_MEDIA_STATE  *AdapterInfo;
-  PP2DXE_CONTEXT                *Pp2Context;
-  EFI_STATUS                     Status;
+  EFI_ADAPTER_INFO_MEDIA_STATE      *AdapterInfo;
+  MARVELL_PP2_CHECKSUM_OFFLOAD_INFO *ChecksumInfo;
+  PP2DXE_CONTEXT                    *Pp2Context;
+  EFI_STATUS                         Status;
 
   if (This == NULL || InformationBlock == NULL || InformationBlockSize == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
+  Pp2Context = INSTANCE_FROM_AIP (This);
+
+  if (CompareGuid (InformationType, &gMarvellPp2ChecksumOffloadInfoGuid)) {
+    ChecksumInfo = AllocateZeroPool (sizeof (MARVELL_PP2_CHECKSUM_OFFLOAD_INFO));
+    if (ChecksumInfo == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    ChecksumInfo->TxChecksumGenerate = Pp2Context->TxChecksumGenerate;
+    ChecksumInfo->RxLastStatus = Pp2Context->LastRxStatus;
+    ChecksumInfo->RxLastL4ChecksumOk =
+      (Pp2Context->LastRxStatus & MVPP2_RXD_L4_CSUM_OK) != 0;
+    ChecksumInfo->RxLastIp4HeaderOk =
+      (Pp2Context->LastRxStatus & (MVPP2_RXD_L3_IP4 | MVPP2_RXD_IP4_HEADER_ERR)) ==
+      MVPP2_RXD_L3_IP4;
+
+    *InformationBlock = ChecksumInfo;
+    *InformationBlockSize = sizeof (MARVELL_PP2_CHECKSUM_OFFLOAD_INFO);
+
+    return EFI_SUCCESS;
+  }
+
   if (!CompareGuid (InformationType, &gEfiAdapterInfoMediaStateGuid)) {
     return EFI_UNSUPPORTED;
   }
@@ -1166,8 +1566,6 @@ Pp2AipGetInformation (
   *InformationBlock = AdapterInfo;
   *InformationBlockSize = sizeof (EFI_ADAPTER_INFO_MEDIA_STATE);
 
-  Pp2Context = INSTANCE_FROM_AIP (This);
-
   Status = Pp2Context->Snp.GetStatus (&(Pp2Context->Snp), NULL, NULL);
   if (Status == EFI_NOT_READY){
     AdapterInfo->MediaState = EFI_NOT_READY;
@@ -1217,10 +1615,26 @@ Pp2AipSetInformation (
   IN  UINTN                             InformationBlockSize
   )
 {
+  MARVELL_PP2_CHECKSUM_OFFLOAD_INFO *ChecksumInfo;
+  PP2DXE_CONTEXT                    *Pp2Context;
+
   if (This == NULL || InformationBlock == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
+  if (CompareGuid (InformationType, &gMarvellPp2ChecksumOffloadInfoGuid)) {
+    if (InformationBlockSize != sizeof (MARVELL_PP2_CHECKSUM_OFFLOAD_INFO)) {
+      return EFI_INVALID_PARAMETER;
+    }
+
+    /* Only transmit checksum generation is settable */
+    ChecksumInfo = InformationBlock;
+    Pp2Context = INSTANCE_FROM_AIP (This);
+    Pp2Context->TxChecksumGenerate = ChecksumInfo->TxChecksumGenerate;
+
+    return EFI_SUCCESS;
+  }
+
   if (CompareGuid (InformationType, &gEfiAdapterInfoMediaStateGuid)) {
     return EFI_WRITE_PROTECTED;
   }
@@ -1263,13 +1677,14 @@ Pp2AipGetSupportedTypes (
     return EFI_INVALID_PARAMETER;
   }
 
-  *InfoTypesBuffer = AllocatePool (sizeof (EFI_GUID));
+  *InfoTypesBuffer = AllocatePool (2 * sizeof (EFI_GUID));
   if (*InfoTypesBuffer == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
 
-  *InfoTypesBufferCount = 1;
-  CopyGuid (*InfoTypesBuffer, &gEfiAdapterInfoMediaStateGuid);
+  *InfoTypesBufferCount = 2;
+  CopyGuid (&(*InfoTypesBuffer)[0], &gEfiAdapterInfoMediaStateGuid);
+  CopyGuid (&(*InfoTypesBuffer)[1], &gMarvellPp2ChecksumOffloadInfoGuid);
 
   return EFI_SUCCESS;
 }
@@ -1362,6 +1777,11 @@ Pp2DxeInitialiseController (
       Index * MVPP2_BM_SIZE * RX_BUFFER_SIZE);
   }
 
+  Mvpp2Shared->BufferLocation.RxJumboBuffers = (DmaAddrT)
+    ((UINTN)BufferSpace + (MVPP2_MAX_TXD * MVPP2_MAX_PORT + MVPP2_AGGR_TXQ_SIZE) *
+    sizeof(MVPP2_TX_DESC) + MVPP2_MAX_RXD * MVPP2_MAX_PORT * sizeof(MVPP2_RX_DESC) +
+    MVPP2_MAX_PORT * MVPP2_BM_SIZE * RX_BUFFER_SIZE);
+
   /* Initialize HW */
   Mvpp2AxiConfig(Mvpp2Shared);
   Pp2DxeBmPoolInit (Mvpp2Shared);
@@ -15,6 +15,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Protocol/Ip4.h>
 #include <Protocol/Ip6.h>
 #include <Protocol/MvPhy.h>
+#include <Protocol/Pp2BurstReceive.h>
 #include <Protocol/SimpleNetwork.h>
 
 #include <Library/BaseLib.h>
@@ -25,6 +26,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Library/MemoryAllocationLib.h>
 #include <Library/NetLib.h>
 #include <Library/PcdLib.h>
+#include <Library/SnpPerfLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiLib.h>
 
@@ -35,6 +37,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define PP2DXE_SIGNATURE                    SIGNATURE_32('P', 'P', '2', 'D')
 #define INSTANCE_FROM_AIP(a)                CR((a), PP2DXE_CONTEXT, Aip, PP2DXE_SIGNATURE)
 #define INSTANCE_FROM_SNP(a)                CR((a), PP2DXE_CONTEXT, Snp, PP2DXE_SIGNATURE)
+#define INSTANCE_FROM_BURST_RX(a)           CR((a), PP2DXE_CONTEXT, BurstRx, PP2DXE_SIGNATURE)
 
 /* OS API */
 #define Mvpp2Alloc(v)                       AllocateZeroPool(v)
@@ -115,6 +118,14 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define MVPP2_BM_POOL                      0
 #define MVPP2_BM_SIZE                      64
 
+/*
+ * Shared long pool serving jumbo frames on all ports. Pools 0..2 keep
+ * the per-port short (default MTU) buffers.
+ */
+#define MVPP2_BM_LONG_POOL                 MVPP2_MAX_PORT
+#define MVPP2_BM_LONG_SIZE                 32
+#define MVPP2_BM_POOLS_USED                (MVPP2_MAX_PORT + 1)
+
 /*
  * BM short pool packet Size
  * These value assure that for SWF the total number
@@ -133,6 +144,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 /* RX constants */
 #define RX_BUFFER_SIZE                     (ALIGN_VALUE(MTU + WRAP, ARCH_DMA_MINALIGN))
+#define RX_JUMBO_BUFFER_SIZE               (ALIGN_VALUE(JUMBO_MTU + WRAP, ARCH_DMA_MINALIGN))
 #define MVPP2_RXQ_OFFSET                   0
 #define BUFF_HDR_OFFS                      32
 #define BM_ALIGN                           32
@@ -141,6 +153,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 /* 2(HW hdr) 14(MAC hdr) 4(CRC) 32(extra for cache prefetch) */
 #define WRAP                              (2 + ETH_HLEN + 4 + 32)
 #define MTU                               1500
+#define JUMBO_MTU                         9000
 
 /*
  * Maximum retries of checking, wheter HW really sent the packet
@@ -243,6 +256,7 @@ typedef struct {
   MVPP2_TX_DESC *AggrTxDescs;
   MVPP2_RX_DESC *RxDescs[MVPP2_MAX_PORT];
   DmaAddrT RxBuffers[MVPP2_MAX_PORT];
+  DmaAddrT RxJumboBuffers;
 } BUFFER_LOCATION;
 
 /* Shared Packet Processor resources */
@@ -264,7 +278,7 @@ typedef struct {
   MVPP2_TX_QUEUE *AggrTxqs;
 
   /* BM pools */
-  MVPP2_BMS_POOL *BmPools[MVPP2_MAX_PORT];
+  MVPP2_BMS_POOL *BmPools[MVPP2_BM_POOLS_USED];
   BOOLEAN BmEnabled;
 
   /* PRS shadow table */
@@ -324,6 +338,8 @@ typedef struct {
 } PP2_DEVICE_PATH;
 
 #define QUEUE_DEPTH 64
+/* Bounded by the per-port TXQ ring (MVPP2_MAX_TXD descriptors) */
+#define TX_INFLIGHT_QUEUE_DEPTH MVPP2_MAX_TXD
 typedef struct {
   UINT32                      Signature;
   INTN                        Instance;
@@ -338,9 +354,17 @@ typedef struct {
   VOID                        *CompletionQueue[QUEUE_DEPTH];
   UINTN                       CompletionQueueHead;
   UINTN                       CompletionQueueTail;
+  VOID                        *TxInFlightQueue[TX_INFLIGHT_QUEUE_DEPTH];
+  UINTN                       TxInFlightHead;
+  UINTN                       TxInFlightTail;
+  UINTN                       TxDoneCount;
   EFI_EVENT                   EfiExitBootServicesEvent;
   PP2_DEVICE_PATH             *DevicePath;
   EFI_ADAPTER_INFORMATION_PROTOCOL Aip;
+  MARVELL_PP2_BURST_RECEIVE_PROTOCOL BurstRx;
+  BOOLEAN                     TxChecksumGenerate;
+  UINT32                      LastRxStatus;
+  SNP_PERF_STATS              *PerfStats;
 } PP2DXE_CONTEXT;
 
 /* Inline helpers */
@@ -596,4 +620,36 @@ Pp2SnpReceive (
   OUT EFI_MAC_ADDRESS            *DstAddr OPTIONAL,
   OUT UINT16                     *EtherType OPTIONAL
   );
+
+EFI_STATUS
+EFIAPI
+Pp2SnpTransmitTimed (
+  IN EFI_SIMPLE_NETWORK_PROTOCOL *This,
+  IN UINTN                       HeaderSize,
+  IN UINTN                       BufferSize,
+  IN VOID                        *Buffer,
+  IN EFI_MAC_ADDRESS             *SrcAddr  OPTIONAL,
+  IN EFI_MAC_ADDRESS             *DestAddr OPTIONAL,
+  IN UINT16                      *EtherTypePtr OPTIONAL
+  );
+
+EFI_STATUS
+EFIAPI
+Pp2SnpReceiveTimed (
+  IN EFI_SIMPLE_NETWORK_PROTOCOL *This,
+  OUT UINTN                      *HeaderSize OPTIONAL,
+  IN OUT UINTN                   *BufferSize,
+  OUT VOID                       *Buffer,
+  OUT EFI_MAC_ADDRESS            *SrcAddr OPTIONAL,
+  OUT EFI_MAC_ADDRESS            *DstAddr OPTIONAL,
+  OUT UINT16                     *EtherType OPTIONAL
+  );
+
+EFI_STATUS
+EFIAPI
+Pp2BurstReceive (
+  IN     MARVELL_PP2_BURST_RECEIVE_PROTOCOL *This,
+  IN OUT UINTN                              *FrameCount,
+  IN OUT MARVELL_PP2_RX_FRAME               *Frames
+  );
 #endif
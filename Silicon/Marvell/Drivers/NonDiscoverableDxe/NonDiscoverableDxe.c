@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <PiDxe.h>
 
 #include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
 #include <Library/NonDiscoverableDeviceRegistrationLib.h>
 #include <Library/NonDiscoverableInitLib.h>
 #include <Library/UefiBootServicesTableLib.h>
@@ -18,97 +19,78 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 //
 // NonDiscoverable devices registration
 //
+typedef struct {
+  NON_DISCOVERABLE_DEVICE_TYPE     Type;
+  NON_DISCOVERABLE_DEVICE_DMA_TYPE DmaType;
+  NON_DISCOVERABLE_DEVICE_INIT     Initialize;
+  UINTN                            BaseAddress;
+  UINTN                            MemSize;
+} NON_DISCOVERABLE_DEVICE_ENTRY;
+
 STATIC
-EFI_STATUS
-NonDiscoverableInitXhci (
-  IN MV_BOARD_XHCI_DESC *Desc
+UINTN
+NonDiscoverableCollectXhci (
+  IN MV_BOARD_XHCI_DESC             *Desc,
+  OUT NON_DISCOVERABLE_DEVICE_ENTRY *Entry
   )
 {
-  EFI_STATUS Status;
   UINT8 i;
 
-  for (i = 0; i < Desc->XhciDevCount; i++) {
-    Status = RegisterNonDiscoverableMmioDevice (
-                     NonDiscoverableDeviceTypeXhci,
-                     Desc[i].SoC->XhciDmaType,
-                     NonDiscoverableDeviceInitializerGet (
-                       NonDiscoverableDeviceTypeXhci,
-                       i),
-                     NULL,
-                     1,
-                     Desc[i].SoC->XhciBaseAddress,
-                     Desc[i].SoC->XhciMemSize
-                   );
-
-    if (EFI_ERROR(Status)) {
-      DEBUG((DEBUG_ERROR, "NonDiscoverable: Cannot install Xhci device %d\n", i));
-      return Status;
-    }
+  for (i = 0; i < Desc->XhciDevCount; i++, Entry++) {
+    Entry->Type = NonDiscoverableDeviceTypeXhci;
+    Entry->DmaType = Desc[i].SoC->XhciDmaType;
+    Entry->Initialize = NonDiscoverableDeviceInitializerGet (
+                          NonDiscoverableDeviceTypeXhci,
+                          i);
+    Entry->BaseAddress = Desc[i].SoC->XhciBaseAddress;
+    Entry->MemSize = Desc[i].SoC->XhciMemSize;
   }
 
-  return EFI_SUCCESS;
+  return Desc->XhciDevCount;
 }
 
 STATIC
-EFI_STATUS
-NonDiscoverableInitAhci (
-  IN MV_BOARD_AHCI_DESC *Desc
+UINTN
+NonDiscoverableCollectAhci (
+  IN MV_BOARD_AHCI_DESC             *Desc,
+  OUT NON_DISCOVERABLE_DEVICE_ENTRY *Entry
   )
 {
-  EFI_STATUS Status;
   UINT8 i;
 
-  for (i = 0; i < Desc->AhciDevCount; i++) {
-    Status = RegisterNonDiscoverableMmioDevice (
-                     NonDiscoverableDeviceTypeAhci,
-                     Desc[i].SoC->AhciDmaType,
-                     NonDiscoverableDeviceInitializerGet (
-                       NonDiscoverableDeviceTypeAhci,
-                       i),
-                     NULL,
-                     1,
-                     Desc[i].SoC->AhciBaseAddress,
-                     Desc[i].SoC->AhciMemSize
-                   );
-
-    if (EFI_ERROR(Status)) {
-      DEBUG((DEBUG_ERROR, "NonDiscoverable: Cannot install Ahci device %d\n", i));
-      return Status;
-    }
+  for (i = 0; i < Desc->AhciDevCount; i++, Entry++) {
+    Entry->Type = NonDiscoverableDeviceTypeAhci;
+    Entry->DmaType = Desc[i].SoC->AhciDmaType;
+    Entry->Initialize = NonDiscoverableDeviceInitializerGet (
+                          NonDiscoverableDeviceTypeAhci,
+                          i);
+    Entry->BaseAddress = Desc[i].SoC->AhciBaseAddress;
+    Entry->MemSize = Desc[i].SoC->AhciMemSize;
   }
 
-  return EFI_SUCCESS;
+  return Desc->AhciDevCount;
 }
 
 STATIC
-EFI_STATUS
-NonDiscoverableInitSdhci (
-  IN MV_BOARD_SDMMC_DESC *Desc
+UINTN
+NonDiscoverableCollectSdhci (
+  IN MV_BOARD_SDMMC_DESC            *Desc,
+  OUT NON_DISCOVERABLE_DEVICE_ENTRY *Entry
   )
 {
-  EFI_STATUS Status;
   UINT8 i;
 
-  for (i = 0; i < Desc->SdMmcDevCount; i++) {
-    Status = RegisterNonDiscoverableMmioDevice (
-                     NonDiscoverableDeviceTypeSdhci,
-                     Desc[i].SoC->SdMmcDmaType,
-                     NonDiscoverableDeviceInitializerGet (
-                       NonDiscoverableDeviceTypeSdhci,
-                       i),
-                     NULL,
-                     1,
-                     Desc[i].SoC->SdMmcBaseAddress,
-                     Desc[i].SoC->SdMmcMemSize
-                   );
-
-    if (EFI_ERROR(Status)) {
-      DEBUG((DEBUG_ERROR, "NonDiscoverable: Cannot install Sdhci device %d\n", i));
-      return Status;
-    }
+  for (i = 0; i < Desc->SdMmcDevCount; i++, Entry++) {
+    Entry->Type = NonDiscoverableDeviceTypeSdhci;
+    Entry->DmaType = Desc[i].SoC->SdMmcDmaType;
+    Entry->Initialize = NonDiscoverableDeviceInitializerGet (
+                          NonDiscoverableDeviceTypeSdhci,
+                          i);
+    Entry->BaseAddress = Desc[i].SoC->SdMmcBaseAddress;
+    Entry->MemSize = Desc[i].SoC->SdMmcMemSize;
   }
 
-  return EFI_SUCCESS;
+  return Desc->SdMmcDevCount;
 }
 
 //
@@ -125,8 +107,16 @@ NonDiscoverableEntryPoint (
   MV_BOARD_SDMMC_DESC *SdMmcBoardDesc;
   MV_BOARD_AHCI_DESC *AhciBoardDesc;
   MV_BOARD_XHCI_DESC *XhciBoardDesc;
+  NON_DISCOVERABLE_DEVICE_ENTRY *DeviceTable;
+  NON_DISCOVERABLE_DEVICE_ENTRY *Entry;
+  UINTN DeviceCount;
+  UINTN Index;
   EFI_STATUS Status;
 
+  SdMmcBoardDesc = NULL;
+  AhciBoardDesc = NULL;
+  XhciBoardDesc = NULL;
+
   /* Obtain list of available controllers */
   Status = gBS->LocateProtocol (&gMarvellBoardDescProtocolGuid,
                   NULL,
@@ -135,40 +125,87 @@ NonDiscoverableEntryPoint (
     return Status;
   }
 
-  /* Xhci */
+  /* Obtain the whole board description up front */
   Status = BoardDescProtocol->BoardDescXhciGet (BoardDescProtocol,
                                 &XhciBoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
   }
-  Status = NonDiscoverableInitXhci (XhciBoardDesc);
-  if (EFI_ERROR(Status)) {
-    return Status;
-  }
-  BoardDescProtocol->BoardDescFree (XhciBoardDesc);
 
-  /* Ahci */
   Status = BoardDescProtocol->BoardDescAhciGet (BoardDescProtocol,
                                 &AhciBoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
   }
-  Status = NonDiscoverableInitAhci (AhciBoardDesc);
-  if (EFI_ERROR(Status)) {
-    return Status;
-  }
-  BoardDescProtocol->BoardDescFree (AhciBoardDesc);
 
-  /* SdMmc */
   Status = BoardDescProtocol->BoardDescSdMmcGet (BoardDescProtocol,
                                 &SdMmcBoardDesc);
   if (EFI_ERROR (Status)) {
     return Status;
   }
-  Status = NonDiscoverableInitSdhci (SdMmcBoardDesc);
-  if (EFI_ERROR(Status)) {
-    return Status;
+
+  DeviceCount = 0;
+  if (XhciBoardDesc != NULL) {
+    DeviceCount += XhciBoardDesc->XhciDevCount;
+  }
+  if (AhciBoardDesc != NULL) {
+    DeviceCount += AhciBoardDesc->AhciDevCount;
+  }
+  if (SdMmcBoardDesc != NULL) {
+    DeviceCount += SdMmcBoardDesc->SdMmcDevCount;
+  }
+
+  if (DeviceCount == 0) {
+    return EFI_SUCCESS;
+  }
+
+  /* Gather all device entries in a single table */
+  DeviceTable = AllocateZeroPool (DeviceCount *
+                  sizeof (NON_DISCOVERABLE_DEVICE_ENTRY));
+  if (DeviceTable == NULL) {
+    DEBUG ((DEBUG_ERROR, "NonDiscoverable: Cannot allocate device table\n"));
+    return EFI_OUT_OF_RESOURCES;
   }
 
+  Entry = DeviceTable;
+  if (XhciBoardDesc != NULL) {
+    Entry += NonDiscoverableCollectXhci (XhciBoardDesc, Entry);
+    BoardDescProtocol->BoardDescFree (XhciBoardDesc);
+  }
+  if (AhciBoardDesc != NULL) {
+    Entry += NonDiscoverableCollectAhci (AhciBoardDesc, Entry);
+    BoardDescProtocol->BoardDescFree (AhciBoardDesc);
+  }
+  if (SdMmcBoardDesc != NULL) {
+    Entry += NonDiscoverableCollectSdhci (SdMmcBoardDesc, Entry);
+    BoardDescProtocol->BoardDescFree (SdMmcBoardDesc);
+  }
+
+  /*
+   * Register all devices from the table; each registration installs the
+   * device and device path protocols with a single
+   * InstallMultipleProtocolInterfaces call.
+   */
+  for (Index = 0; Index < DeviceCount; Index++) {
+    Status = RegisterNonDiscoverableMmioDevice (
+                     DeviceTable[Index].Type,
+                     DeviceTable[Index].DmaType,
+                     DeviceTable[Index].Initialize,
+                     NULL,
+                     1,
+                     DeviceTable[Index].BaseAddress,
+                     DeviceTable[Index].MemSize
+                   );
+
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "NonDiscoverable: Cannot install device %d\n",
+        Index));
+      FreePool (DeviceTable);
+      return Status;
+    }
+  }
+
+  FreePool (DeviceTable);
+
   return EFI_SUCCESS;
 }
@@ -345,6 +345,15 @@ XenonSdMmcCapability (
   Capability &= ~(UINT64)(SDHC_CAP_SLOT_TYPE_MASK);
   Capability |= SdMmcDesc.SlotType << SDHC_CAP_SLOT_TYPE_OFFSET;
 
+  //
+  // Xenon supports ADMA2 with 64-bit descriptor addressing, but the
+  // capability register does not always advertise it. Force both bits on
+  // so the generic host controller driver performs multi-segment
+  // scatter-gather transfers instead of falling back to the single-buffer
+  // SDMA path.
+  //
+  Capability |= (UINT64)(SDHC_CAP_ADMA2 | SDHC_CAP_64BIT_SYS_BUS);
+
   WriteUnaligned64 (SdMmcHcSlotCapability, Capability);
 
   //
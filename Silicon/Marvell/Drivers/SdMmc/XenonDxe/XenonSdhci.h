@@ -47,6 +47,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #define UHS_MODE_SELECT_MASK          0x7
 #define SDHC_CAP                      0x0040
 #define SDHC_CAP_BUS_WIDTH8           BIT18
+#define SDHC_CAP_ADMA2                BIT19
+#define SDHC_CAP_64BIT_SYS_BUS        BIT28
 #define SDHC_CAP_VOLTAGE_33           BIT24
 #define SDHC_CAP_VOLTAGE_30           BIT25
 #define SDHC_CAP_VOLTAGE_18           BIT26
@@ -27,6 +27,7 @@
 #include "MvFvbDxe.h"
 
 STATIC EFI_EVENT     mFvbVirtualAddrChangeEvent;
+STATIC EFI_EVENT     mFvbFlushEvent;
 STATIC FVB_DEVICE    *mFvbDevice;
 
 STATIC CONST FVB_DEVICE mMvFvbFlashInstanceTemplate = {
@@ -54,6 +55,9 @@ STATIC CONST FVB_DEVICE mMvFvbFlashInstanceTemplate = {
   0, // FvbSize ... NEED TO BE FILLED
   0, // StartLba
 
+  FALSE, // WriteBackEnabled ... NEED TO BE FILLED
+  NULL,  // DirtyMap ... NEED TO BE FILLED
+
   {
     0,     // MediaId ... NEED TO BE FILLED
     FALSE, // RemovableMedia
@@ -702,6 +706,23 @@ MvFvbWrite (
 
   FlashInstance = INSTANCE_FROM_FVB_THIS (This);
 
+  //
+  // With write-back caching the shadow buffer is authoritative until the
+  // dirty blocks are flushed at ExitBootServices, so the slow SPI
+  // program cycle is skipped here. Runtime writes keep going straight
+  // to the flash, as no flush opportunity is left at that point.
+  //
+  if (FlashInstance->WriteBackEnabled && !EfiAtRuntime ()) {
+    DataOffset = GET_DATA_OFFSET (FlashInstance->RegionBaseAddress + Offset,
+                   FlashInstance->StartLba + Lba,
+                   FlashInstance->Media.BlockSize);
+
+    CopyMem ((UINTN *)DataOffset, Buffer, *NumBytes);
+    FlashInstance->DirtyMap[FlashInstance->StartLba + Lba] = TRUE;
+
+    return EFI_SUCCESS;
+  }
+
   DataOffset = GET_DATA_OFFSET (FlashInstance->FvbOffset + Offset,
                  FlashInstance->StartLba + Lba,
                  FlashInstance->Media.BlockSize);
@@ -787,6 +808,7 @@ MvFvbEraseBlocks (
   EFI_STATUS             Status;
   VA_LIST                Args;
   UINTN                  BlockAddress; // Physical address of Lba to erase
+  UINTN                  DataOffset;   // Shadow buffer address of Lba to erase
   EFI_LBA                StartingLba;  // Lba from which we start erasing
   UINTN                  NumOfLba;     // Number of Lba blocks to erase
 
@@ -858,6 +880,23 @@ MvFvbEraseBlocks (
     // Go through each one and erase it
     while (NumOfLba > 0) {
 
+      //
+      // With write-back caching only the shadow buffer is erased; the
+      // flush erases the block right before programming it anyway.
+      //
+      if (FlashInstance->WriteBackEnabled && !EfiAtRuntime ()) {
+        DataOffset = GET_DATA_OFFSET (FlashInstance->RegionBaseAddress,
+                       FlashInstance->StartLba + StartingLba,
+                       FlashInstance->Media.BlockSize);
+
+        SetMem ((VOID *)DataOffset, FlashInstance->Media.BlockSize, 0xFF);
+        FlashInstance->DirtyMap[FlashInstance->StartLba + StartingLba] = TRUE;
+
+        StartingLba++;
+        NumOfLba--;
+        continue;
+      }
+
       // Get the physical address of Lba to erase
       BlockAddress = GET_DATA_OFFSET (FlashInstance->FvbOffset,
                        FlashInstance->StartLba + StartingLba,
@@ -914,6 +953,87 @@ MvFvbVirtualNotifyEvent (
   return;
 }
 
+/**
+  Write every block the write-back cache has marked dirty from the
+  shadow buffer back to the SPI flash, one erase+program cycle each.
+
+  @param[in]    FlashInstance   The FVB instance to flush
+
+  @retval       EFI_SUCCESS     All dirty blocks were written back
+  @return       Other           Error returned by the SPI flash protocol
+**/
+STATIC
+EFI_STATUS
+MvFvbFlushDirtyBlocks (
+  IN FVB_DEVICE *FlashInstance
+  )
+{
+  EFI_STATUS Status;
+  UINTN      BlockAddress;
+  UINTN      DataOffset;
+  UINTN      BlockCount;
+  UINTN      BlockIndex;
+
+  BlockCount = FlashInstance->FvbSize / FlashInstance->Media.BlockSize;
+
+  for (BlockIndex = 0; BlockIndex < BlockCount; BlockIndex++) {
+    if (!FlashInstance->DirtyMap[BlockIndex]) {
+      continue;
+    }
+
+    BlockAddress = GET_DATA_OFFSET (FlashInstance->FvbOffset,
+                     BlockIndex,
+                     FlashInstance->Media.BlockSize);
+    DataOffset = GET_DATA_OFFSET (FlashInstance->RegionBaseAddress,
+                   BlockIndex,
+                   FlashInstance->Media.BlockSize);
+
+    Status = FlashInstance->SpiFlashProtocol->Erase (&FlashInstance->SpiDevice,
+                                                BlockAddress,
+                                                FlashInstance->Media.BlockSize);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Status = FlashInstance->SpiFlashProtocol->Write (&FlashInstance->SpiDevice,
+                                                BlockAddress,
+                                                FlashInstance->Media.BlockSize,
+                                                (VOID *)DataOffset);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    FlashInstance->DirtyMap[BlockIndex] = FALSE;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Bring the SPI flash up to date with the shadow buffer before the OS
+  takes over, as no later flush opportunity exists.
+
+  @param[in]    Event   The Event that is being processed
+  @param[in]    Context Event Context
+**/
+STATIC
+VOID
+EFIAPI
+MvFvbFlushEventNotify (
+  IN EFI_EVENT        Event,
+  IN VOID             *Context
+  )
+{
+  EFI_STATUS Status;
+
+  Status = MvFvbFlushDirtyBlocks (mFvbDevice);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR,
+      "%a: Failed to flush variable store to flash\n",
+      __FUNCTION__));
+  }
+}
+
 STATIC
 EFI_STATUS
 MvFvbFlashProbe (
@@ -1208,7 +1328,34 @@ MvFvbEntryPoint (
     goto ErrorSetMemAttr;
   }
 
-  return Status;
+  //
+  // Optionally enable write-back caching of the variable store. From
+  // now on boot-time writes and erases only touch the shadow buffer
+  // and the flash is brought up to date in one pass at ExitBootServices,
+  // which coalesces the many small variable updates made during
+  // provisioning. The FV header preparation above has already gone
+  // straight to the flash, so the shadow and the flash start out in
+  // sync. Fall back to write-through if the cache cannot be set up.
+  //
+  if (!mFvbDevice->IsMemoryMapped && PcdGetBool (PcdSpiFvbWriteBackEnable)) {
+    mFvbDevice->DirtyMap = AllocateZeroPool (mFvbDevice->FvbSize /
+                             mFvbDevice->Media.BlockSize);
+    if (mFvbDevice->DirtyMap != NULL) {
+      Status = gBS->CreateEvent (EVT_SIGNAL_EXIT_BOOT_SERVICES,
+                      TPL_NOTIFY,
+                      MvFvbFlushEventNotify,
+                      NULL,
+                      &mFvbFlushEvent);
+      if (EFI_ERROR (Status)) {
+        FreePool (mFvbDevice->DirtyMap);
+        mFvbDevice->DirtyMap = NULL;
+      } else {
+        mFvbDevice->WriteBackEnabled = TRUE;
+      }
+    }
+  }
+
+  return EFI_SUCCESS;
 
 ErrorSetMemAttr:
   gDS->RemoveMemorySpace (RegionBaseAddress, RuntimeMmioRegionSize);
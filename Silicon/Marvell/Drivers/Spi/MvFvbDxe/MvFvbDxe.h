@@ -57,6 +57,10 @@ typedef struct {
   UINTN                               FvbSize;
   EFI_LBA                             StartLba;
 
+  // Boot-time write-back cache state, see PcdSpiFvbWriteBackEnable
+  BOOLEAN                             WriteBackEnabled;
+  BOOLEAN                             *DirtyMap;
+
   EFI_BLOCK_IO_MEDIA                  Media;
   EFI_FIRMWARE_VOLUME_BLOCK2_PROTOCOL FvbProtocol;
 
@@ -11,6 +11,9 @@ STATIC EFI_EVENT            mMvSpiFlashVirtualAddrChangeEvent;
 MARVELL_SPI_MASTER_PROTOCOL *SpiMasterProtocol;
 SPI_FLASH_INSTANCE  *mSpiFlashInstance;
 
+// Extended address register state, tracked to skip redundant bank writes
+STATIC UINT8 mSpiFlashBankSel = SPI_FLASH_BANK_INVALID;
+
 STATIC
 VOID
 SpiFlashFormatAddress (
@@ -144,7 +147,18 @@ SpiFlashBank (
 
   BankSel = Offset / SPI_FLASH_16MB_BOUN;
 
-  SpiFlashCmdBankaddrWrite (Slave, BankSel);
+  // The full offset travels in the command in 4-byte address mode,
+  // so the extended address register does not need programming.
+  if (Slave->AddrSize == 4) {
+    return BankSel;
+  }
+
+  // Each bank write costs a write-enable/program/poll cycle on the
+  // bus, so skip it while the register already holds the value.
+  if (BankSel != mSpiFlashBankSel) {
+    SpiFlashCmdBankaddrWrite (Slave, BankSel);
+    mSpiFlashBankSel = BankSel;
+  }
 
   return BankSel;
 }
@@ -212,11 +226,10 @@ MvSpiFlashRead (
   UINT32 ReadAddr, ReadLength, RemainLength;
   UINTN BankSel = 0;
 
+  // Zero the dummy cycle byte trailing the address as well
+  ZeroMem (Cmd, sizeof (Cmd));
   Cmd[0] = CMD_READ_ARRAY_FAST;
 
-  // Sign end of address with 0 byte
-  Cmd[5] = 0;
-
   while (Length) {
     ReadAddr = Offset;
 
@@ -230,7 +243,10 @@ MvSpiFlashRead (
     }
     SpiFlashFormatAddress (ReadAddr, Slave->AddrSize, Cmd);
     // Program proper read address and read data
-    Status = MvSpiFlashReadCmd (Slave, Cmd, Slave->AddrSize + 2, Buf, Length);
+    Status = MvSpiFlashReadCmd (Slave, Cmd, Slave->AddrSize + 2, Buf, ReadLength);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
 
     Offset += ReadLength;
     Length -= ReadLength;
@@ -481,6 +497,9 @@ MvSpiFlashInit (
   EFI_STATUS Status;
   UINT8 Cmd, StatusRegister;
 
+  // The extended address register content is unknown after reset
+  mSpiFlashBankSel = SPI_FLASH_BANK_INVALID;
+
   if (Slave->Info->Flags & NOR_FLASH_4B_ADDR) {
     Slave->AddrSize = 4;
   } else {
@@ -47,6 +47,8 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 
 #define SPI_FLASH_16MB_BOUN             0x1000000
 
+#define SPI_FLASH_BANK_INVALID          0xFF
+
 typedef enum {
   SPI_FLASH_READ_ID,
   SPI_FLASH_READ, // Read from SPI flash with address
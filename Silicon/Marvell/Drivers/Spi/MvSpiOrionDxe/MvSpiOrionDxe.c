@@ -172,10 +172,10 @@ MvSpiTransfer (
 {
   SPI_MASTER *SpiMaster;
   UINT64  Length;
-  UINT32  Iterator, Reg;
+  UINT32  Iterator, Reg, DataRead;
   UINT8   *DataOutPtr = (UINT8 *)DataOut;
   UINT8   *DataInPtr  = (UINT8 *)DataIn;
-  UINT8   DataToSend  = 0;
+  UINT32  DataToSend  = 0;
   UINTN   SpiRegBase;
 
   SpiMaster = SPI_MASTER_FROM_SPI_MASTER_PROTOCOL (This);
@@ -192,13 +192,59 @@ MvSpiTransfer (
     SpiActivateCs (Slave);
   }
 
-  // Set 8-bit mode
+  //
+  // Stream the bulk of the transaction as 16-bit frames - this halves
+  // the register writes and busy polls per byte, which dominate flash
+  // access time on this controller. CS stays asserted throughout, so
+  // the frame length is invisible on the wire.
+  //
+  if (Length >= 16) {
+    // Set 16-bit mode
+    Reg = MmioRead32 (SpiRegBase + SPI_CONF_REG);
+    Reg |= SPI_BYTE_LENGTH;
+    MmioWrite32 (SpiRegBase + SPI_CONF_REG, Reg);
+
+    while (Length >= 16) {
+      if (DataOutPtr != NULL) {
+        // MSB first on the wire, see SPI_TXLSBF_MASK handling
+        DataToSend = (DataOutPtr[0] << 8) | DataOutPtr[1];
+      }
+      // Transmit Data
+      MmioWrite32 (SpiRegBase + SPI_INT_CAUSE_REG, 0x0);
+      MmioWrite32 (SpiRegBase + SPI_DATA_OUT_REG, DataToSend);
+      // Wait for memory ready
+      for (Iterator = 0; Iterator < SPI_TIMEOUT; Iterator++) {
+        if (MmioRead32 (SpiRegBase + SPI_INT_CAUSE_REG)) {
+          if (DataInPtr != NULL) {
+            DataRead = MmioRead32 (SpiRegBase + SPI_DATA_IN_REG);
+            *DataInPtr++ = (UINT8)(DataRead >> 8);
+            *DataInPtr++ = (UINT8)DataRead;
+          }
+          if (DataOutPtr != NULL) {
+            DataOutPtr += 2;
+          }
+          Length -= 16;
+          break;
+        }
+      }
+
+      if (Iterator >= SPI_TIMEOUT) {
+        DEBUG ((DEBUG_ERROR, "%a: Timeout\n", __FUNCTION__));
+        if (!EfiAtRuntime ()) {
+          EfiReleaseLock (&SpiMaster->Lock);
+        }
+        return EFI_TIMEOUT;
+      }
+    }
+  }
+
+  // Set 8-bit mode for the remaining tail
   Reg = MmioRead32 (SpiRegBase + SPI_CONF_REG);
   Reg &= ~SPI_BYTE_LENGTH;
   MmioWrite32 (SpiRegBase + SPI_CONF_REG, Reg);
 
   while (Length > 0) {
-    if (DataOut != NULL) {
+    if (DataOutPtr != NULL) {
       DataToSend = *DataOutPtr & 0xFF;
     }
     // Transmit Data
@@ -221,6 +267,9 @@ MvSpiTransfer (
 
     if (Iterator >= SPI_TIMEOUT) {
       DEBUG ((DEBUG_ERROR, "%a: Timeout\n", __FUNCTION__));
+      if (!EfiAtRuntime ()) {
+        EfiReleaseLock (&SpiMaster->Lock);
+      }
       return EFI_TIMEOUT;
     }
   }
@@ -0,0 +1,40 @@
+/********************************************************************************
+Copyright (C) 2018 Marvell International Ltd.
+
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+*******************************************************************************/
+
+#ifndef __PP2_CHECKSUM_OFFLOAD_H__
+#define __PP2_CHECKSUM_OFFLOAD_H__
+
+//
+// Vendor EFI_ADAPTER_INFORMATION_PROTOCOL information type exposing the
+// PP2 classifier checksum capabilities. The parser computes L3/L4 parse
+// results and checksums for every frame anyway, so a network stack aware
+// of this information type can skip per-packet software checksumming.
+//
+#define MARVELL_PP2_CHECKSUM_OFFLOAD_INFO_GUID \
+  { 0x8daca806, 0x1fe0, 0x4d1a, { 0x95, 0x0d, 0x21, 0x52, 0x9c, 0x5e, 0x72, 0x0c }}
+
+typedef struct {
+  //
+  // When TRUE, Transmit parses outgoing IPv4/IPv6 TCP and UDP frames and
+  // programs the descriptor so the hardware generates the IP header and
+  // L4 checksums; the submitter may leave those fields zeroed. Frames the
+  // parser does not recognize are sent with checksum generation disabled,
+  // exactly as before. Writable through SetInformation.
+  //
+  BOOLEAN TxChecksumGenerate;
+  //
+  // Raw descriptor status of the most recently delivered receive frame
+  // (MVPP2_RXD_* bits) together with a decoded summary. Valid for the
+  // frame returned by the immediately preceding Receive call.
+  //
+  UINT32  RxLastStatus;
+  BOOLEAN RxLastL4ChecksumOk;
+  BOOLEAN RxLastIp4HeaderOk;
+} MARVELL_PP2_CHECKSUM_OFFLOAD_INFO;
+
+extern EFI_GUID gMarvellPp2ChecksumOffloadInfoGuid;
+#endif
@@ -0,0 +1,70 @@
+/********************************************************************************
+Copyright (C) 2018 Marvell International Ltd.
+
+SPDX-License-Identifier: BSD-2-Clause-Patent
+
+*******************************************************************************/
+
+#ifndef __PP2_BURST_RECEIVE_H__
+#define __PP2_BURST_RECEIVE_H__
+
+#define MARVELL_PP2_BURST_RECEIVE_PROTOCOL_GUID { 0x9f6765a4, 0x41b6, 0x4b4b, { 0x9b, 0x21, 0x38, 0x0f, 0x68, 0x4e, 0x1d, 0x5a }}
+
+typedef struct _MARVELL_PP2_BURST_RECEIVE_PROTOCOL MARVELL_PP2_BURST_RECEIVE_PROTOCOL;
+
+//
+// One caller supplied frame slot of a burst receive call.
+//
+typedef struct {
+  //
+  // Caller allocated buffer the frame is copied into.
+  //
+  VOID    *Buffer;
+  //
+  // On input the capacity of Buffer in bytes; on output the length of
+  // the delivered frame.
+  //
+  UINTN   BufferSize;
+  //
+  // Raw MVPP2_RXD_* status bits of the descriptor the frame came from,
+  // so a consumer can use the classifier parse and checksum results.
+  //
+  UINT32  RxStatus;
+} MARVELL_PP2_RX_FRAME;
+
+/**
+  Drain up to *FrameCount completed RX descriptors in a single call.
+
+  Each delivered frame is copied into the corresponding entry of the
+  Frames array. Frames with hardware errors are dropped and their buffers
+  recycled without consuming an entry. If a pending frame does not fit
+  into the next entry, the burst stops with the frame left in the ring,
+  the entry's BufferSize is set to the required length and
+  EFI_BUFFER_TOO_SMALL is returned; frames delivered before that point
+  remain valid.
+
+  @param[in]     This        Instance of MARVELL_PP2_BURST_RECEIVE_PROTOCOL.
+  @param[in out] FrameCount  On input the number of entries in Frames; on
+                             output the number of frames delivered.
+  @param[in out] Frames      Array of caller supplied frame slots.
+
+  @retval EFI_SUCCESS           One or more frames were delivered.
+  @retval EFI_NOT_READY         No pending frames in the RX ring.
+  @retval EFI_BUFFER_TOO_SMALL  A pending frame is larger than the next
+                                entry's buffer.
+  @retval EFI_INVALID_PARAMETER A pointer argument is NULL.
+**/
+typedef
+EFI_STATUS
+(EFIAPI *MARVELL_PP2_BURST_RECEIVE) (
+  IN     MARVELL_PP2_BURST_RECEIVE_PROTOCOL  *This,
+  IN OUT UINTN                               *FrameCount,
+  IN OUT MARVELL_PP2_RX_FRAME                *Frames
+  );
+
+struct _MARVELL_PP2_BURST_RECEIVE_PROTOCOL {
+  MARVELL_PP2_BURST_RECEIVE Receive;
+};
+
+extern EFI_GUID gMarvellPp2BurstReceiveProtocolGuid;
+#endif
@@ -118,44 +118,140 @@ ComPhySmc (
   return EFI_SUCCESS;
 }
 
+/*
+ * First training stage - kick off the PHY power-on and link training
+ * for a single lane.  Completion polls that can run after every lane
+ * has started training belong in ComPhyCp110WaitLaneReady.
+ */
 STATIC
-UINTN
-ComPhySataPowerUp (
-  IN UINTN ChipId,
+EFI_STATUS
+ComPhyCp110PowerOnLane (
+  IN CHIP_COMPHY_CONFIG *PtrChipCfg,
+  IN COMPHY_MAP *PtrComPhyMap,
   IN UINT32 Lane,
-  IN EFI_PHYSICAL_ADDRESS HpipeBase,
-  IN EFI_PHYSICAL_ADDRESS ComPhyBase,
-  IN MV_BOARD_AHCI_DESC *Desc
+  IN UINT32 PcieWidth,
+  IN MV_BOARD_AHCI_DESC *AhciBoardDesc
   )
 {
   EFI_STATUS Status;
 
-  DEBUG ((DEBUG_INFO, "ComPhySata: Initialize SATA PHYs\n"));
+  switch (PtrComPhyMap->Type) {
+  case COMPHY_TYPE_PCIE0:
+  case COMPHY_TYPE_PCIE1:
+  case COMPHY_TYPE_PCIE2:
+  case COMPHY_TYPE_PCIE3:
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
+               PtrChipCfg->ComPhyBaseAddr,
+               Lane,
+               COMPHY_FW_PCIE_FORMAT (PcieWidth,
+                 COMPHY_PCIE_MODE,
+                 PtrComPhyMap->Speed));
+    break;
+  case COMPHY_TYPE_SATA0:
+  case COMPHY_TYPE_SATA1:
+  case COMPHY_TYPE_SATA2:
+  case COMPHY_TYPE_SATA3:
+    if (AhciBoardDesc == NULL) {
+      Status = EFI_DEVICE_ERROR;
+      break;
+    }
 
-  DEBUG((DEBUG_INFO, "ComPhySataPowerUp: stage: MAC configuration - power down ComPhy\n"));
+    DEBUG ((DEBUG_INFO, "ComPhySata: Initialize SATA PHYs\n"));
+    DEBUG ((DEBUG_INFO, "ComPhyCp110PowerOnLane: stage: MAC configuration - power down ComPhy\n"));
+
+    ComPhySataMacPowerDown (AhciBoardDesc[PtrChipCfg->ChipId].SoC->AhciBaseAddress);
+
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
+               PtrChipCfg->ComPhyBaseAddr,
+               Lane,
+               COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
+                 AhciBoardDesc[PtrChipCfg->ChipId].SoC->AhciId,
+                 COMPHY_SPEED_DEFAULT));
+    break;
+  case COMPHY_TYPE_USB3_HOST0:
+  case COMPHY_TYPE_USB3_HOST1:
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
+               PtrChipCfg->ComPhyBaseAddr,
+               Lane,
+               COMPHY_FW_MODE_FORMAT (COMPHY_USB3H_MODE));
+    break;
+  case COMPHY_TYPE_SGMII0:
+  case COMPHY_TYPE_SGMII1:
+  case COMPHY_TYPE_SGMII2:
+  case COMPHY_TYPE_SGMII3:
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
+               PtrChipCfg->ComPhyBaseAddr,
+               Lane,
+               COMPHY_FW_FORMAT (COMPHY_SGMII_MODE,
+                 (PtrComPhyMap->Type - COMPHY_TYPE_SGMII0),
+                 PtrComPhyMap->Speed));
+    break;
+  case COMPHY_TYPE_SFI:
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
+               PtrChipCfg->ComPhyBaseAddr,
+               Lane,
+               COMPHY_FW_FORMAT (COMPHY_SFI_MODE,
+                 COMPHY_UNIT_ID0,
+                 PtrComPhyMap->Speed));
+    break;
+  case COMPHY_TYPE_RXAUI0:
+  case COMPHY_TYPE_RXAUI1:
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
+               PtrChipCfg->ComPhyBaseAddr,
+               Lane,
+               COMPHY_FW_MODE_FORMAT (COMPHY_RXAUI_MODE));
+    break;
+  default:
+    DEBUG((DEBUG_ERROR, "Unknown SerDes Type, skip initialize SerDes %d\n",
+      Lane));
+    Status = EFI_INVALID_PARAMETER;
+    ASSERT (FALSE);
+    break;
+  }
 
-  ComPhySataMacPowerDown (Desc[ChipId].SoC->AhciBaseAddress);
+  return Status;
+}
 
-  Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
-             ComPhyBase,
-             Lane,
-             COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
-               Desc[ChipId].SoC->AhciId,
-               COMPHY_SPEED_DEFAULT));
-  if (EFI_ERROR (Status)) {
-    return Status;
-  }
+/*
+ * Second training stage - poll the lane for training completion.
+ * Every lane has already been kicked off by ComPhyCp110PowerOnLane,
+ * so the PLLs lock in parallel and the poll below mostly finds the
+ * lane already done instead of burning a full per-lane timeout.
+ */
+STATIC
+EFI_STATUS
+ComPhyCp110WaitLaneReady (
+  IN CHIP_COMPHY_CONFIG *PtrChipCfg,
+  IN COMPHY_MAP *PtrComPhyMap,
+  IN UINT32 Lane,
+  IN MV_BOARD_AHCI_DESC *AhciBoardDesc
+  )
+{
+  EFI_STATUS Status;
 
-  ComPhySataPhyPowerUp (Desc[ChipId].SoC->AhciBaseAddress);
+  switch (PtrComPhyMap->Type) {
+  case COMPHY_TYPE_SATA0:
+  case COMPHY_TYPE_SATA1:
+  case COMPHY_TYPE_SATA2:
+  case COMPHY_TYPE_SATA3:
+    if (AhciBoardDesc == NULL) {
+      Status = EFI_DEVICE_ERROR;
+      break;
+    }
 
-  Status = ComPhySmc (MV_SMC_ID_COMPHY_PLL_LOCK,
-             ComPhyBase,
-             Lane,
-             COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
-               Desc[ChipId].SoC->AhciId,
-               COMPHY_SPEED_DEFAULT));
-  if (EFI_ERROR (Status)) {
-    return Status;
+    ComPhySataPhyPowerUp (AhciBoardDesc[PtrChipCfg->ChipId].SoC->AhciBaseAddress);
+
+    Status = ComPhySmc (MV_SMC_ID_COMPHY_PLL_LOCK,
+               PtrChipCfg->ComPhyBaseAddr,
+               Lane,
+               COMPHY_FW_FORMAT (COMPHY_SATA_MODE,
+                 AhciBoardDesc[PtrChipCfg->ChipId].SoC->AhciId,
+                 COMPHY_SPEED_DEFAULT));
+    break;
+  default:
+    /* The remaining modes complete within the power-on call */
+    Status = EFI_SUCCESS;
+    break;
   }
 
   return Status;
@@ -166,20 +262,21 @@ ComPhyCp110Init (
   IN CHIP_COMPHY_CONFIG *PtrChipCfg
   )
 {
+  EFI_STATUS LaneStatus[MAX_LANE_OPTIONS];
+  UINT64 LaneTicks[MAX_LANE_OPTIONS];
   EFI_STATUS Status;
   COMPHY_MAP *PtrComPhyMap, *SerdesMap;
-  EFI_PHYSICAL_ADDRESS ComPhyBaseAddr, HpipeBaseAddr;
   MARVELL_BOARD_DESC_PROTOCOL *BoardDescProtocol;
   MV_BOARD_AHCI_DESC *AhciBoardDesc;
   UINT32 ComPhyMaxCount, Lane;
   UINT32 PcieWidth = 0;
-  UINT8 ChipId;
+  UINT64 StartTicks;
+  BOOLEAN SataPresent = FALSE;
 
   ComPhyMaxCount = PtrChipCfg->LanesCount;
-  ComPhyBaseAddr = PtrChipCfg->ComPhyBaseAddr;
-  HpipeBaseAddr = PtrChipCfg->Hpipe3BaseAddr;
   SerdesMap = PtrChipCfg->MapData;
-  ChipId = PtrChipCfg->ChipId;
+  BoardDescProtocol = NULL;
+  AhciBoardDesc = NULL;
 
   /* Check if the first 4 Lanes configured as By-4 */
   for (Lane = 0, PtrComPhyMap = SerdesMap; Lane < 4; Lane++, PtrComPhyMap++) {
@@ -189,8 +286,43 @@ ComPhyCp110Init (
     PcieWidth++;
   }
 
+  /* Obtain the AHCI board description once if any lane runs SATA */
+  for (Lane = 0, PtrComPhyMap = SerdesMap; Lane < ComPhyMaxCount;
+       Lane++, PtrComPhyMap++) {
+    if (PtrComPhyMap->Type >= COMPHY_TYPE_SATA0 &&
+        PtrComPhyMap->Type <= COMPHY_TYPE_SATA3) {
+      SataPresent = TRUE;
+      break;
+    }
+  }
+
+  if (SataPresent) {
+    Status = gBS->LocateProtocol (&gMarvellBoardDescProtocolGuid,
+                    NULL,
+                    (VOID **)&BoardDescProtocol);
+    if (!EFI_ERROR (Status)) {
+      Status = BoardDescProtocol->BoardDescAhciGet (BoardDescProtocol,
+                                    &AhciBoardDesc);
+      if (EFI_ERROR (Status)) {
+        AhciBoardDesc = NULL;
+      }
+    }
+  }
+
+  /*
+   * Kick off training on every configured lane before polling any of
+   * them for completion, so that the lanes train concurrently instead
+   * of serializing a full polling timeout per lane.
+   */
   for (Lane = 0, PtrComPhyMap = SerdesMap; Lane < ComPhyMaxCount;
        Lane++, PtrComPhyMap++) {
+    LaneStatus[Lane] = EFI_SUCCESS;
+    LaneTicks[Lane] = 0;
+
+    if (PtrComPhyMap->Type == COMPHY_TYPE_UNCONNECTED) {
+      continue;
+    }
+
     DEBUG((DEBUG_INFO, "ComPhy: Initialize serdes number %d\n", Lane));
     DEBUG((DEBUG_INFO, "ComPhy: Serdes Type = 0x%x\n", PtrComPhyMap->Type));
 
@@ -199,89 +331,50 @@ ComPhyCp110Init (
       PcieWidth = 1;
     }
 
-    switch (PtrComPhyMap->Type) {
-    case COMPHY_TYPE_UNCONNECTED:
+    StartTicks = GetPerformanceCounter ();
+    LaneStatus[Lane] = ComPhyCp110PowerOnLane (PtrChipCfg,
+                         PtrComPhyMap,
+                         Lane,
+                         PcieWidth,
+                         AhciBoardDesc);
+    LaneTicks[Lane] = GetPerformanceCounter () - StartTicks;
+  }
+
+  /* Unified completion poll over the lanes that started training */
+  for (Lane = 0, PtrComPhyMap = SerdesMap; Lane < ComPhyMaxCount;
+       Lane++, PtrComPhyMap++) {
+    if (PtrComPhyMap->Type == COMPHY_TYPE_UNCONNECTED ||
+        EFI_ERROR (LaneStatus[Lane])) {
       continue;
-      break;
-    case COMPHY_TYPE_PCIE0:
-    case COMPHY_TYPE_PCIE1:
-    case COMPHY_TYPE_PCIE2:
-    case COMPHY_TYPE_PCIE3:
-      Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
-                 PtrChipCfg->ComPhyBaseAddr,
-                 Lane,
-                 COMPHY_FW_PCIE_FORMAT (PcieWidth,
-                   COMPHY_PCIE_MODE,
-                   PtrComPhyMap->Speed));
-      break;
-    case COMPHY_TYPE_SATA0:
-    case COMPHY_TYPE_SATA1:
-    case COMPHY_TYPE_SATA2:
-    case COMPHY_TYPE_SATA3:
-      /* Obtain AHCI board description */
-      Status = gBS->LocateProtocol (&gMarvellBoardDescProtocolGuid,
-                      NULL,
-                      (VOID **)&BoardDescProtocol);
-      if (EFI_ERROR (Status)) {
-        break;
-      }
+    }
 
-      Status = BoardDescProtocol->BoardDescAhciGet (BoardDescProtocol,
-                                    &AhciBoardDesc);
-      if (EFI_ERROR (Status)) {
-        break;
-      }
+    StartTicks = GetPerformanceCounter ();
+    LaneStatus[Lane] = ComPhyCp110WaitLaneReady (PtrChipCfg,
+                         PtrComPhyMap,
+                         Lane,
+                         AhciBoardDesc);
+    LaneTicks[Lane] += GetPerformanceCounter () - StartTicks;
+  }
 
-      Status = ComPhySataPowerUp (ChipId,
-                 Lane,
-                 HpipeBaseAddr,
-                 ComPhyBaseAddr,
-                 AhciBoardDesc);
+  if (AhciBoardDesc != NULL) {
+    BoardDescProtocol->BoardDescFree (AhciBoardDesc);
+  }
 
-      BoardDescProtocol->BoardDescFree (AhciBoardDesc);
-      break;
-    case COMPHY_TYPE_USB3_HOST0:
-    case COMPHY_TYPE_USB3_HOST1:
-      Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
-                 PtrChipCfg->ComPhyBaseAddr,
-                 Lane,
-                 COMPHY_FW_MODE_FORMAT (COMPHY_USB3H_MODE));
-      break;
-    case COMPHY_TYPE_SGMII0:
-    case COMPHY_TYPE_SGMII1:
-    case COMPHY_TYPE_SGMII2:
-    case COMPHY_TYPE_SGMII3:
-      Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
-                 PtrChipCfg->ComPhyBaseAddr,
-                 Lane,
-                 COMPHY_FW_FORMAT (COMPHY_SGMII_MODE,
-                   (PtrComPhyMap->Type - COMPHY_TYPE_SGMII0),
-                   PtrComPhyMap->Speed));
-      break;
-    case COMPHY_TYPE_SFI:
-      Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
-                 PtrChipCfg->ComPhyBaseAddr,
-                 Lane,
-                 COMPHY_FW_FORMAT (COMPHY_SFI_MODE,
-                   COMPHY_UNIT_ID0,
-                   PtrComPhyMap->Speed));
-      break;
-    case COMPHY_TYPE_RXAUI0:
-    case COMPHY_TYPE_RXAUI1:
-      Status = ComPhySmc (MV_SMC_ID_COMPHY_POWER_ON,
-                 PtrChipCfg->ComPhyBaseAddr,
-                 Lane,
-                 COMPHY_FW_MODE_FORMAT (COMPHY_RXAUI_MODE));
-      break;
-    default:
-      DEBUG((DEBUG_ERROR, "Unknown SerDes Type, skip initialize SerDes %d\n",
-        Lane));
-      Status = EFI_INVALID_PARAMETER;
-      ASSERT (FALSE);
-      break;
+  /* Per-lane training-time records for board bring-up profiling */
+  for (Lane = 0, PtrComPhyMap = SerdesMap; Lane < ComPhyMaxCount;
+       Lane++, PtrComPhyMap++) {
+    if (PtrComPhyMap->Type == COMPHY_TYPE_UNCONNECTED) {
+      continue;
     }
-    if (EFI_ERROR(Status)) {
-      DEBUG ((DEBUG_ERROR, "Failed to initialize Lane %d\n with Status = 0x%x", Lane, Status));
+
+    DEBUG ((DEBUG_INFO, "ComPhy: Lane %d (%s) trained in %ld us\n",
+      Lane,
+      GetTypeString (PtrComPhyMap->Type),
+      DivU64x32 (GetTimeInNanoSecond (LaneTicks[Lane]), 1000)));
+
+    if (EFI_ERROR (LaneStatus[Lane])) {
+      DEBUG ((DEBUG_ERROR, "Failed to initialize Lane %d\n with Status = 0x%x",
+        Lane, LaneStatus[Lane]));
       PtrComPhyMap->Type = COMPHY_TYPE_UNCONNECTED;
     }
   }
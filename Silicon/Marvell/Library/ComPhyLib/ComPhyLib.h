@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-2-Clause-Patent
 #include <Uefi.h>
 #include <Library/ArmLib.h>
 #include <Library/ArmPlatformLib.h>
+#include <Library/BaseLib.h>
 #include <Library/DebugLib.h>
 #include <Library/PcdLib.h>
 #include <Library/MemoryAllocationLib.h>
@@ -126,6 +127,11 @@ ComPhyCp110Init (
   IN CHIP_COMPHY_CONFIG * First
   );
 
+CHAR16 *
+GetTypeString (
+  UINT32 Type
+  );
+
 VOID
 RegSet (
   IN EFI_PHYSICAL_ADDRESS Addr,
@@ -76,6 +76,28 @@ Reset (
   return EFI_SUCCESS;
 }
 
+/**
+  Function to start a transaction on the I2c bus
+
+  All operations in the request packet are carried out back to back as one
+  bus transaction, with a repeated START between operations, so a register
+  address write followed by a data read reaches the slave without releasing
+  the bus in between. The transaction runs to completion before returning;
+  when an event is supplied the caller's status is filled in and the event
+  signalled so that asynchronous callers also complete.
+
+  @param   This            Pointer to I2c master protocol
+  @param   SlaveAddress    Address of the device on the I2c bus
+  @param   RequestPacket   Pointer to an EFI_I2C_REQUEST_PACKET structure
+                           describing the I2c transaction
+  @param   Event           Event to signal for asynchronous transactions,
+                           NULL for synchronous transactions
+  @param   I2cStatus       Optional buffer to receive the transaction status
+
+  @retval EFI_SUCCESS            Operation successfull
+  @retval EFI_INVALID_PARAMETER  RequestPacket is NULL or empty
+  @retval Others                 Status returned from I2cBusXfer
+**/
 STATIC
 EFI_STATUS
 EFIAPI
@@ -93,6 +115,10 @@ StartRequest (
   EFI_TPL                  Tpl;
   BOOLEAN                  AtRuntime;
 
+  if ((RequestPacket == NULL) || (RequestPacket->OperationCount == 0)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
   AtRuntime = EfiAtRuntime ();
   if (!AtRuntime) {
     Tpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
@@ -108,6 +134,15 @@ StartRequest (
     gBS->RestoreTPL (Tpl);
   }
 
+  if (I2cStatus != NULL) {
+    *I2cStatus = Status;
+  }
+
+  if ((Event != NULL) && !AtRuntime) {
+    gBS->SignalEvent (Event);
+    return EFI_SUCCESS;
+  }
+
   return Status;
 }
 
@@ -59,6 +59,57 @@ STATIC CONST UINT8 mOutStride[] = {
   0  // EfiCpuIoWidthFillUint64
 };
 
+//
+// Host address window of one PCIe segment I/O space
+//
+typedef struct {
+  UINT64 Start;
+  UINT64 End;
+  UINT64 Shift;
+} IO_PORT_WINDOW;
+
+//
+// The segment windows only depend on fixed PCDs, so compute them once at
+// build time instead of rederiving all six on every port access.
+//
+STATIC CONST IO_PORT_WINDOW mIoPortWindows[] = {
+  {
+    PCI_SEG0_PORTIO_MIN + PCI_SEG0_PORTIO_OFFSET,
+    PCI_SEG0_PORTIO_MAX + PCI_SEG0_PORTIO_OFFSET,
+    PCI_SEG0_PHY_IO_BASE - PCI_SEG0_PORTIO_OFFSET
+  },
+  {
+    PCI_SEG1_PORTIO_MIN + PCI_SEG1_PORTIO_OFFSET,
+    PCI_SEG1_PORTIO_MAX + PCI_SEG1_PORTIO_OFFSET,
+    (PCI_SEG0_PHY_IO_BASE + (PCI_BASE_DIFF * 1)) - PCI_SEG1_PORTIO_OFFSET
+  },
+  {
+    PCI_SEG2_PORTIO_MIN + PCI_SEG2_PORTIO_OFFSET,
+    PCI_SEG2_PORTIO_MAX + PCI_SEG2_PORTIO_OFFSET,
+    (PCI_SEG0_PHY_IO_BASE + (PCI_BASE_DIFF * 2)) - PCI_SEG2_PORTIO_OFFSET
+  },
+  {
+    PCI_SEG3_PORTIO_MIN + PCI_SEG3_PORTIO_OFFSET,
+    PCI_SEG3_PORTIO_MAX + PCI_SEG3_PORTIO_OFFSET,
+    (PCI_SEG0_PHY_IO_BASE + (PCI_BASE_DIFF * 3)) - PCI_SEG3_PORTIO_OFFSET
+  },
+  {
+    PCI_SEG4_PORTIO_MIN + PCI_SEG4_PORTIO_OFFSET,
+    PCI_SEG4_PORTIO_MAX + PCI_SEG4_PORTIO_OFFSET,
+    (PCI_SEG0_PHY_IO_BASE + (PCI_BASE_DIFF * 4)) - PCI_SEG4_PORTIO_OFFSET
+  },
+  {
+    PCI_SEG5_PORTIO_MIN + PCI_SEG5_PORTIO_OFFSET,
+    PCI_SEG5_PORTIO_MAX + PCI_SEG5_PORTIO_OFFSET,
+    (PCI_SEG0_PHY_IO_BASE + (PCI_BASE_DIFF * 5)) - PCI_SEG5_PORTIO_OFFSET
+  }
+};
+
+//
+// Index of the window that served the previous port access
+//
+STATIC UINTN mLastIoPortWindow = 0;
+
 /**
   Check parameters to a CPU I/O 2 Protocol service request.
 
@@ -244,14 +295,44 @@ CpuMemoryServiceRead (
   InStride = mInStride[Width];
   OutStride = mOutStride[Width];
   OperationWidth = (EFI_CPU_IO_PROTOCOL_WIDTH) (Width & 0x03);
-  for (Uint8Buffer = Buffer; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+
+  //
+  // Incrementing transfers are block copies at the operation width. Use the
+  // IoLib buffer accessors so enumeration sweeps and option ROM reads are not
+  // dispatched on the width for every unit.
+  //
+  if (InStride != 0 && OutStride != 0) {
     if (OperationWidth == EfiCpuIoWidthUint8) {
-      *Uint8Buffer = MmioRead8 ((UINTN)Address);
+      MmioReadBuffer8 ((UINTN)Address, Count, Buffer);
     } else if (OperationWidth == EfiCpuIoWidthUint16) {
-      *((UINT16 *)Uint8Buffer) = MmioRead16 ((UINTN)Address);
+      MmioReadBuffer16 ((UINTN)Address, Count * 2, Buffer);
     } else if (OperationWidth == EfiCpuIoWidthUint32) {
-      *((UINT32 *)Uint8Buffer) = MmioRead32 ((UINTN)Address);
+      MmioReadBuffer32 ((UINTN)Address, Count * 4, Buffer);
     } else if (OperationWidth == EfiCpuIoWidthUint64) {
+      MmioReadBuffer64 ((UINTN)Address, Count * 8, Buffer);
+    }
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Fifo and Fill transfers keep either Address or Buffer fixed, so run a
+  // dedicated loop per width with the dispatch hoisted out of it.
+  //
+  Uint8Buffer = Buffer;
+  if (OperationWidth == EfiCpuIoWidthUint8) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+      *Uint8Buffer = MmioRead8 ((UINTN)Address);
+    }
+  } else if (OperationWidth == EfiCpuIoWidthUint16) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+      *((UINT16 *)Uint8Buffer) = MmioRead16 ((UINTN)Address);
+    }
+  } else if (OperationWidth == EfiCpuIoWidthUint32) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+      *((UINT32 *)Uint8Buffer) = MmioRead32 ((UINTN)Address);
+    }
+  } else if (OperationWidth == EfiCpuIoWidthUint64) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
       *((UINT64 *)Uint8Buffer) = MmioRead64 ((UINTN)Address);
     }
   }
@@ -324,14 +405,43 @@ CpuMemoryServiceWrite (
   InStride = mInStride[Width];
   OutStride = mOutStride[Width];
   OperationWidth = (EFI_CPU_IO_PROTOCOL_WIDTH) (Width & 0x03);
-  for (Uint8Buffer = Buffer; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+
+  //
+  // Incrementing transfers are block copies at the operation width. Use the
+  // IoLib buffer accessors so the width is not dispatched for every unit.
+  //
+  if (InStride != 0 && OutStride != 0) {
     if (OperationWidth == EfiCpuIoWidthUint8) {
-      MmioWrite8 ((UINTN)Address, *Uint8Buffer);
+      MmioWriteBuffer8 ((UINTN)Address, Count, Buffer);
     } else if (OperationWidth == EfiCpuIoWidthUint16) {
-      MmioWrite16 ((UINTN)Address, *((UINT16 *)Uint8Buffer));
+      MmioWriteBuffer16 ((UINTN)Address, Count * 2, Buffer);
     } else if (OperationWidth == EfiCpuIoWidthUint32) {
-      MmioWrite32 ((UINTN)Address, *((UINT32 *)Uint8Buffer));
+      MmioWriteBuffer32 ((UINTN)Address, Count * 4, Buffer);
     } else if (OperationWidth == EfiCpuIoWidthUint64) {
+      MmioWriteBuffer64 ((UINTN)Address, Count * 8, Buffer);
+    }
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Fifo and Fill transfers keep either Address or Buffer fixed, so run a
+  // dedicated loop per width with the dispatch hoisted out of it.
+  //
+  Uint8Buffer = Buffer;
+  if (OperationWidth == EfiCpuIoWidthUint8) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+      MmioWrite8 ((UINTN)Address, *Uint8Buffer);
+    }
+  } else if (OperationWidth == EfiCpuIoWidthUint16) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+      MmioWrite16 ((UINTN)Address, *((UINT16 *)Uint8Buffer));
+    }
+  } else if (OperationWidth == EfiCpuIoWidthUint32) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
+      MmioWrite32 ((UINTN)Address, *((UINT32 *)Uint8Buffer));
+    }
+  } else if (OperationWidth == EfiCpuIoWidthUint64) {
+    for (; Count > 0; Address += InStride, Uint8Buffer += OutStride, Count--) {
       MmioWrite64 ((UINTN)Address, *((UINT64 *)Uint8Buffer));
     }
   }
@@ -344,64 +454,25 @@ TranslateIoAddress (
   IN  OUT UINT64                 *Address
   )
 {
-  UINT64 Start;
-  UINT64 End;
-  UINT64 Shift;
-  UINT64 SegIoHostAddressBase;
-
-  SegIoHostAddressBase = PCI_SEG0_PHY_IO_BASE;
-  Start = PCI_SEG0_PORTIO_MIN + PCI_SEG0_PORTIO_OFFSET;
-  End   = PCI_SEG0_PORTIO_MAX + PCI_SEG0_PORTIO_OFFSET;
-  Shift = SegIoHostAddressBase - PCI_SEG0_PORTIO_OFFSET;
+  UINTN Index;
 
-  if (*Address >= Start && *Address <= End) {
-    *Address += Shift;
-    return EFI_SUCCESS;
-  }
-
-  Start = PCI_SEG1_PORTIO_MIN + PCI_SEG1_PORTIO_OFFSET;
-  End   = PCI_SEG1_PORTIO_MAX + PCI_SEG1_PORTIO_OFFSET;
-  Shift = (SegIoHostAddressBase + (PCI_BASE_DIFF * 1)) - PCI_SEG1_PORTIO_OFFSET;
-
-  if (*Address >= Start && *Address <= End) {
-    *Address += Shift;
-    return EFI_SUCCESS;
-  }
-
-  Start = PCI_SEG2_PORTIO_MIN + PCI_SEG2_PORTIO_OFFSET;
-  End   = PCI_SEG2_PORTIO_MAX + PCI_SEG2_PORTIO_OFFSET;
-  Shift = (SegIoHostAddressBase + (PCI_BASE_DIFF * 2)) - PCI_SEG2_PORTIO_OFFSET;
-
-  if (*Address >= Start && *Address <= End) {
-    *Address += Shift;
-    return EFI_SUCCESS;
-  }
-
-  Start = PCI_SEG3_PORTIO_MIN + PCI_SEG3_PORTIO_OFFSET;
-  End   = PCI_SEG3_PORTIO_MAX + PCI_SEG3_PORTIO_OFFSET;
-  Shift = (SegIoHostAddressBase + (PCI_BASE_DIFF * 3)) - PCI_SEG3_PORTIO_OFFSET;
-
-  if (*Address >= Start && *Address <= End) {
-    *Address += Shift;
-    return EFI_SUCCESS;
-  }
-
-  Start = PCI_SEG4_PORTIO_MIN + PCI_SEG4_PORTIO_OFFSET;
-  End   = PCI_SEG4_PORTIO_MAX + PCI_SEG4_PORTIO_OFFSET;
-  Shift = (SegIoHostAddressBase + (PCI_BASE_DIFF * 4)) - PCI_SEG4_PORTIO_OFFSET;
-
-  if (*Address >= Start && *Address <= End) {
-    *Address += Shift;
+  //
+  // Port accesses cluster within one segment window, so try the window that
+  // served the previous access before sweeping the table.
+  //
+  if (*Address >= mIoPortWindows[mLastIoPortWindow].Start &&
+      *Address <= mIoPortWindows[mLastIoPortWindow].End) {
+    *Address += mIoPortWindows[mLastIoPortWindow].Shift;
     return EFI_SUCCESS;
   }
 
-  Start = PCI_SEG5_PORTIO_MIN + PCI_SEG5_PORTIO_OFFSET;
-  End   = PCI_SEG5_PORTIO_MAX + PCI_SEG5_PORTIO_OFFSET;
-  Shift = (SegIoHostAddressBase + (PCI_BASE_DIFF * 5)) - PCI_SEG5_PORTIO_OFFSET;
-
-  if (*Address >= Start && *Address <= End) {
-    *Address += Shift;
-    return EFI_SUCCESS;
+  for (Index = 0; Index < ARRAY_SIZE (mIoPortWindows); Index++) {
+    if (*Address >= mIoPortWindows[Index].Start &&
+        *Address <= mIoPortWindows[Index].End) {
+      mLastIoPortWindow = Index;
+      *Address += mIoPortWindows[Index].Shift;
+      return EFI_SUCCESS;
+    }
   }
   ASSERT (FALSE);
   return EFI_INVALID_PARAMETER;
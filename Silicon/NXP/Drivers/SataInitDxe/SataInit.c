@@ -10,17 +10,136 @@
 #include <Library/DebugLib.h>
 #include <Library/IoLib.h>
 #include <Library/NonDiscoverableDeviceRegistrationLib.h>
+#include <Library/TimerLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 
 #define SATA_PPCFG             0xA8
 #define SATA_PTC               0xC8
 #define SATA_PAXIC             0xC0
 
+#define SATA_AHCI_PI           0x0C
+#define SATA_PORT_BASE         0x100
+#define SATA_PORT_SIZE         0x80
+#define SATA_PORT_CMD          0x18
+#define SATA_PORT_SSTS         0x28
+#define SATA_PORT_SCTL         0x2C
+
 #define PORT_PHYSICAL          0xA003FFFE
 #define PORT_TRANSPORT         0x08000025
 #define PORT_RXWM              0x08000029
 #define ENABLE_NONZERO_4MB_PRD 0x10000000
 
+#define PORT_CMD_SUD           BIT1
+#define PORT_SCTL_DET_INIT     0x1
+#define PORT_SSTS_DET_MASK     0xF
+#define PORT_SSTS_DET_PHY_RDY  0x3
+
+//
+// COMRESET must be asserted for at least 1 ms to be recognized by the device
+//
+#define SATA_COMRESET_DELAY    1000
+
+//
+// Shared deadline for all links to come up, in 1 ms polls
+//
+#define SATA_LINKUP_RETRIES    100
+
+/**
+  Bring up the links on all implemented ports of all SATA controllers
+
+  COMRESET is kicked off on every port first, held once for the minimum
+  assertion time and released, and the links are then polled collectively
+  against one shared deadline. Boards with many ports therefore pay the
+  settle and link establishment time once instead of once per port, and the
+  generic AHCI driver finds the links already up when it connects. Ports
+  without a device attached simply stop being polled when the shared
+  deadline expires.
+
+**/
+STATIC
+VOID
+SataSpinUpPorts (
+  VOID
+  )
+{
+  UINT32                   NumSataController;
+  UINT32                   Index;
+  UINT32                   Port;
+  UINT32                   PortsImplemented;
+  UINT32                   Retry;
+  UINT32                   Data;
+  UINTN                    ControllerAddr;
+  UINTN                    PortAddr;
+  BOOLEAN                  LinkPending;
+
+  NumSataController = PcdGet32 (PcdNumSataController);
+
+  //
+  // Kick off spin-up and COMRESET on every implemented port
+  //
+  for (Index = 0; Index < NumSataController; Index++) {
+    ControllerAddr = PcdGet64 (PcdSataBaseAddr) +
+                     (Index * PcdGet32 (PcdSataSize));
+    PortsImplemented = MmioRead32 ((UINTN)(ControllerAddr + SATA_AHCI_PI));
+    for (Port = 0; PortsImplemented != 0; Port++, PortsImplemented >>= 1) {
+      if (!(PortsImplemented & BIT0)) {
+        continue;
+      }
+      PortAddr = ControllerAddr + SATA_PORT_BASE + (Port * SATA_PORT_SIZE);
+      MmioOr32 ((UINTN)(PortAddr + SATA_PORT_CMD), PORT_CMD_SUD);
+      MmioOr32 ((UINTN)(PortAddr + SATA_PORT_SCTL), PORT_SCTL_DET_INIT);
+    }
+  }
+
+  //
+  // Hold COMRESET for the minimum assertion time, once for all ports
+  //
+  MicroSecondDelay (SATA_COMRESET_DELAY);
+
+  //
+  // Release COMRESET on every port
+  //
+  for (Index = 0; Index < NumSataController; Index++) {
+    ControllerAddr = PcdGet64 (PcdSataBaseAddr) +
+                     (Index * PcdGet32 (PcdSataSize));
+    PortsImplemented = MmioRead32 ((UINTN)(ControllerAddr + SATA_AHCI_PI));
+    for (Port = 0; PortsImplemented != 0; Port++, PortsImplemented >>= 1) {
+      if (!(PortsImplemented & BIT0)) {
+        continue;
+      }
+      PortAddr = ControllerAddr + SATA_PORT_BASE + (Port * SATA_PORT_SIZE);
+      MmioAnd32 ((UINTN)(PortAddr + SATA_PORT_SCTL),
+        ~(UINT32)PORT_SSTS_DET_MASK);
+    }
+  }
+
+  //
+  // Poll all links collectively against one shared deadline
+  //
+  for (Retry = 0; Retry < SATA_LINKUP_RETRIES; Retry++) {
+    LinkPending = FALSE;
+    for (Index = 0; Index < NumSataController; Index++) {
+      ControllerAddr = PcdGet64 (PcdSataBaseAddr) +
+                       (Index * PcdGet32 (PcdSataSize));
+      PortsImplemented = MmioRead32 ((UINTN)(ControllerAddr + SATA_AHCI_PI));
+      for (Port = 0; PortsImplemented != 0; Port++, PortsImplemented >>= 1) {
+        if (!(PortsImplemented & BIT0)) {
+          continue;
+        }
+        PortAddr = ControllerAddr + SATA_PORT_BASE + (Port * SATA_PORT_SIZE);
+        Data = MmioRead32 ((UINTN)(PortAddr + SATA_PORT_SSTS));
+        if ((Data & PORT_SSTS_DET_MASK) != PORT_SSTS_DET_PHY_RDY) {
+          LinkPending = TRUE;
+        }
+      }
+    }
+    if (!LinkPending) {
+      break;
+    }
+    MicroSecondDelay (1000);
+  }
+}
+
 /**
   This function gets registered as a callback to perform USB controller intialization
 
@@ -89,6 +208,8 @@ SataEndOfDxeCallback (
         ControllerAddr, Status));
     }
   }
+
+  SataSpinUpPorts ();
 }
 
 /**
@@ -10,6 +10,7 @@
 #include <Library/DebugLib.h>
 #include <Library/IoLib.h>
 #include <Library/NonDiscoverableDeviceRegistrationLib.h>
+#include <Library/TimerLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 
 #include "UsbHcd.h"
@@ -54,14 +55,14 @@ Dwc3SetMode (
 }
 
 /**
-  This function issues phy reset and core soft reset
+  This function asserts the phy and core soft resets
 
   @param  Dwc3Reg      Pointer to DWC3 register.
 
 **/
 STATIC
 VOID
-Dwc3CoreSoftReset (
+Dwc3CoreSoftResetAssert (
   IN  DWC3   *Dwc3Reg
   )
 {
@@ -79,9 +80,20 @@ Dwc3CoreSoftReset (
   // Assert USB3 PHY reset
   //
   MmioOr32 ((UINTN)&Dwc3Reg->GUsb2PhyCfg, DWC3_GUSB2PHYCFG_PHYSOFTRST);
+}
 
-  MemoryFence ();
+/**
+  This function releases the phy and core soft resets
 
+  @param  Dwc3Reg      Pointer to DWC3 register.
+
+**/
+STATIC
+VOID
+Dwc3CoreSoftResetRelease (
+  IN  DWC3   *Dwc3Reg
+  )
+{
   //
   // Clear USB3 PHY reset
   //
@@ -100,6 +112,41 @@ Dwc3CoreSoftReset (
   MmioAnd32 ((UINTN)&Dwc3Reg->GCtl, ~DWC3_GCTL_CORESOFTRESET);
 }
 
+/**
+  This function validates the controller and asserts its resets, so the
+  PHY stabilization window can run while other controllers are brought up
+
+  @param  UsbReg       Base address of the controller registers.
+
+  @retval EFI_SUCCESS    The resets are asserted.
+  @retval EFI_NOT_FOUND  The controller is not a DWC3 core.
+
+**/
+STATIC
+EFI_STATUS
+XhciCoreResetAssert (
+  IN  UINTN  UsbReg
+  )
+{
+  DWC3       *Dwc3Reg;
+  UINT32     Revision;
+
+  Dwc3Reg = (VOID *)(UsbReg + DWC3_REG_OFFSET);
+
+  Revision = MmioRead32 ((UINTN)&Dwc3Reg->GSnpsId);
+  //
+  // This should read as 0x5533, ascii of U3(DWC_usb3) followed by revision num
+  //
+  if ((Revision & DWC3_GSNPSID_MASK) != DWC3_SYNOPSYS_ID) {
+    DEBUG ((DEBUG_ERROR,"This is not a DesignWare USB3 DRD Core.\n"));
+    return EFI_NOT_FOUND;
+  }
+
+  Dwc3CoreSoftResetAssert (Dwc3Reg);
+
+  return EFI_SUCCESS;
+}
+
 /**
   This function performs low-level initialization of DWC3 Core
 
@@ -125,7 +172,7 @@ Dwc3CoreInit (
     return EFI_NOT_FOUND;
   }
 
-  Dwc3CoreSoftReset (Dwc3Reg);
+  Dwc3CoreSoftResetRelease (Dwc3Reg);
 
   Reg = MmioRead32 ((UINTN)&Dwc3Reg->GCtl);
   Reg &= ~DWC3_GCTL_SCALEDOWN_MASK;
@@ -217,15 +264,36 @@ UsbEndOfDxeCallback (
   UINT32        NumUsbController;
   UINT32        ControllerAddr;
   UINT32        Index;
+  UINT64        Ticks;
 
   gBS->CloseEvent (Event);
 
   NumUsbController = PcdGet32 (PcdNumUsbController);
 
+  //
+  // Assert the core and PHY resets on every controller first, so the
+  // PHY settling windows of all controllers overlap instead of being
+  // paid once per controller.
+  //
+  for (Index = 0; Index < NumUsbController; Index++) {
+    ControllerAddr = PcdGet64 (PcdUsbBaseAddr) +
+                      (Index * PcdGet32 (PcdUsbSize));
+
+    Ticks = GetPerformanceCounter ();
+    Status = XhciCoreResetAssert (ControllerAddr);
+    Ticks = GetPerformanceCounter () - Ticks;
+
+    DEBUG ((DEBUG_INFO, "USB controller 0x%x: reset asserted in %luus (%r)\n",
+      ControllerAddr, DivU64x32 (GetTimeInNanoSecond (Ticks), 1000), Status));
+  }
+
+  MemoryFence ();
+
   for (Index = 0; Index < NumUsbController; Index++) {
     ControllerAddr = PcdGet64 (PcdUsbBaseAddr) +
                       (Index * PcdGet32 (PcdUsbSize));
 
+    Ticks = GetPerformanceCounter ();
     Status = RegisterNonDiscoverableMmioDevice (
                NonDiscoverableDeviceTypeXhci,
                NonDiscoverableDeviceDmaTypeNonCoherent,
@@ -234,6 +302,10 @@ UsbEndOfDxeCallback (
                1,
                ControllerAddr, PcdGet32 (PcdUsbSize)
              );
+    Ticks = GetPerformanceCounter () - Ticks;
+
+    DEBUG ((DEBUG_INFO, "USB controller 0x%x: handoff in %luus\n",
+      ControllerAddr, DivU64x32 (GetTimeInNanoSecond (Ticks), 1000)));
 
     if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "Failed to register USB device 0x%x, error 0x%r \n",
@@ -199,7 +199,7 @@ I2cBusTestBusBusy (
   UINT32  Index;
   UINT8   Reg;
 
-  for (Index = 0; Index < I2C_NUM_RETRIES; Index++) {
+  for (Index = 0; Index < (I2C_NUM_FAST_RETRIES + I2C_NUM_RETRIES); Index++) {
     Reg = MmioRead8 ((UINTN)&Regs->Ibsr);
 
     if (Reg & I2C_IBSR_IBAL) {
@@ -215,10 +215,14 @@ I2cBusTestBusBusy (
       break;
     }
 
-    MicroSecondDelay (1);
+    // Spin on the status register first, back off to timed delays only if
+    // the bus state does not change quickly.
+    if (Index >= I2C_NUM_FAST_RETRIES) {
+      MicroSecondDelay (1);
+    }
   }
 
-  if (Index == I2C_NUM_RETRIES) {
+  if (Index == (I2C_NUM_FAST_RETRIES + I2C_NUM_RETRIES)) {
     return EFI_TIMEOUT;
   }
 
@@ -235,7 +239,7 @@ I2cTransferComplete (
   UINT32     Index;
   UINT8      Reg;
 
-  for (Index = 0; Index < I2C_NUM_RETRIES; Index++) {
+  for (Index = 0; Index < (I2C_NUM_FAST_RETRIES + I2C_NUM_RETRIES); Index++) {
     Reg = MmioRead8 ((UINTN)&Regs->Ibsr);
 
     if (Reg & I2C_IBSR_IBIF) {
@@ -244,10 +248,15 @@ I2cTransferComplete (
       break;
     }
 
-    MicroSecondDelay (1);
+    // Spin on the status register while the byte is on the wire, back off
+    // to timed delays only if the transfer takes unexpectedly long. This
+    // keeps back to back bytes of a burst moving without timer overhead.
+    if (Index >= I2C_NUM_FAST_RETRIES) {
+      MicroSecondDelay (1);
+    }
   }
 
-  if (Index == I2C_NUM_RETRIES) {
+  if (Index == (I2C_NUM_FAST_RETRIES + I2C_NUM_RETRIES)) {
     return EFI_TIMEOUT;
   }
 
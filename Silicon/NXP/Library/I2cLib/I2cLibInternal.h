@@ -78,6 +78,13 @@
 
 #define ARRAY_LAST_ELEM(x)      (x)[ARRAY_SIZE (x) - 1]
 #define I2C_NUM_RETRIES         500
+/**
+  Number of back to back status register reads performed before the poll
+  loops start inserting timed delays. A byte takes roughly 90us on the wire
+  at 100 KHz, so spinning briefly catches the completion of short transfers
+  without paying the timer overhead on every byte of a burst.
+**/
+#define I2C_NUM_FAST_RETRIES    50
 
 typedef struct _I2C_REGS {
   UINT8 Ibad; // I2c Bus Address Register
@@ -8,6 +8,7 @@
 
 **/
 
+#include <Library/BaseLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/NorFlashInfoLib.h>
@@ -308,20 +309,25 @@ NorFlashWaitProgramErase (
   IN NOR_FLASH_INSTANCE     *Instance
   )
 {
-  BOOLEAN     SRegDone;
-  BOOLEAN     FSRegDone;
-
   DEBUG ((DEBUG_BLKIO, "NorFlashWaitProgramErase()\n"));
 
-  do {
-    SRegDone = (NorFlashReadStatusRegister (Instance) & SPINOR_SR_WIP) == 0;
-    FSRegDone = TRUE;
-    if (Instance->Flags & NOR_FLASH_POLL_FSR) {
-      NorFlashSetHostCommand (Instance, SPINOR_OP_RDFSR);
-      FSRegDone = (MmioRead8 (Instance->RegionBaseAddress) &
-                   SPINOR_FSR_READY) != 0;
+  //
+  // Every read of the region reissues the status register command, so the
+  // command sequences do not have to be rewritten between the polls.
+  //
+  NorFlashSetHostCommand (Instance, SPINOR_OP_RDSR);
+  while ((MmioRead8 (Instance->RegionBaseAddress) & SPINOR_SR_WIP) != 0) {
+    CpuPause ();
+  }
+
+  if (Instance->Flags & NOR_FLASH_POLL_FSR) {
+    NorFlashSetHostCommand (Instance, SPINOR_OP_RDFSR);
+    while ((MmioRead8 (Instance->RegionBaseAddress) &
+            SPINOR_FSR_READY) == 0) {
+      CpuPause ();
     }
-  } while (!SRegDone || !FSRegDone);
+  }
+
   NorFlashSetHostCommand (Instance, SPINOR_OP_READ_4B);
   return EFI_SUCCESS;
 }
@@ -524,6 +530,43 @@ NorFlashWriteSingleWord (
   return Status;
 }
 
+STATIC
+EFI_STATUS
+NorFlashWritePage (
+  IN NOR_FLASH_INSTANCE     *Instance,
+  IN UINTN                  PageAddress,
+  IN UINTN                  NumWords,
+  IN UINT32                 *WriteData
+  )
+{
+  UINTN                 Index;
+
+  DEBUG ((DEBUG_BLKIO,
+    "NorFlashWritePage(PageAddress=0x%08x, NumWords=0x%x)\n",
+    PageAddress, NumWords));
+
+  if (EFI_ERROR (NorFlashEnableWrite (Instance))) {
+    return EFI_DEVICE_ERROR;
+  }
+  NorFlashSetHostCommand (Instance, SPINOR_OP_PP);
+
+  //
+  // The command sequencer keeps the chip select asserted as long as the
+  // accesses stay sequential, so the whole page is streamed out as the data
+  // phase of a single PAGE PROGRAM command. The non-sequential status
+  // register access issued by the poll below terminates the transfer.
+  //
+  for (Index = 0; Index < NumWords; Index++) {
+    MmioWrite32 (PageAddress + (Index * sizeof (UINT32)), WriteData[Index]);
+  }
+  MemoryFence ();
+  NorFlashWaitProgramErase (Instance);
+
+  NorFlashDisableWrite (Instance);
+  NorFlashSetHostCSDC (Instance, TRUE, mFip006NullCmdSeq);
+  return EFI_SUCCESS;
+}
+
 STATIC
 EFI_STATUS
 NorFlashWriteFullBlock (
@@ -536,6 +579,7 @@ NorFlashWriteFullBlock (
   EFI_STATUS              Status;
   UINTN                   WordAddress;
   UINT32                  WordIndex;
+  UINT32                  PageSizeInWords;
   UINTN                   BlockAddress;
   NOR_FLASH_LOCK_CONTEXT  Lock;
 
@@ -558,12 +602,34 @@ NorFlashWriteFullBlock (
     goto EXIT;
   }
 
-  for (WordIndex=0;
-       WordIndex < BlockSizeInWords;
-       WordIndex++, DataBuffer++, WordAddress += 4) {
-    Status = NorFlashWriteSingleWord (Instance, WordAddress, *DataBuffer);
-    if (EFI_ERROR (Status)) {
-      goto EXIT;
+  if (FixedPcdGetBool (PcdFip006SingleWordProgramming)) {
+    //
+    // Safety fallback: program the block one word per PAGE PROGRAM command.
+    //
+    for (WordIndex=0;
+         WordIndex < BlockSizeInWords;
+         WordIndex++, DataBuffer++, WordAddress += 4) {
+      Status = NorFlashWriteSingleWord (Instance, WordAddress, *DataBuffer);
+      if (EFI_ERROR (Status)) {
+        goto EXIT;
+      }
+    }
+  } else {
+    //
+    // Program the block one page at a time, so the write enable/status poll
+    // cycle is paid once per page instead of once per word.
+    //
+    for (WordIndex = 0; WordIndex < BlockSizeInWords;) {
+      PageSizeInWords = MIN (BlockSizeInWords - WordIndex,
+                             NOR_FLASH_PAGE_SIZE / sizeof (UINT32));
+      Status = NorFlashWritePage (Instance, WordAddress, PageSizeInWords,
+                 DataBuffer);
+      if (EFI_ERROR (Status)) {
+        goto EXIT;
+      }
+      WordIndex += PageSizeInWords;
+      DataBuffer += PageSizeInWords;
+      WordAddress += PageSizeInWords * sizeof (UINT32);
     }
   }
 
@@ -28,6 +28,8 @@
 
 #define NOR_FLASH_ERASE_RETRY                     10
 
+#define NOR_FLASH_PAGE_SIZE                       256
+
 #define GET_NOR_BLOCK_ADDRESS(BaseAddr, Lba, LbaSize) \
                                       ((BaseAddr) + (UINTN)((Lba) * (LbaSize)))
 
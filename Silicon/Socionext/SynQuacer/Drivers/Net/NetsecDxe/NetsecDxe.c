@@ -12,6 +12,12 @@
 
 EFI_CPU_ARCH_PROTOCOL      *mCpu;
 
+STATIC
+VOID
+NetsecKickTxRing (
+  IN  NETSEC_DRIVER   *LanDriver
+  );
+
 STATIC
 VOID
 GetCurrentMacAddress (
@@ -326,6 +332,9 @@ SnpInitialize (
     ReturnUnlock (EFI_DEVICE_ERROR);
   }
 
+  LanDriver->TxQueuedNum = 0;
+  LanDriver->RxPendingNum = 0;
+
   ogma_clear_desc_ring_irq_status (LanDriver->Handle, OGMA_DESC_RING_ID_NRM_TX,
                                    OGMA_CH_IRQ_REG_EMPTY);
 
@@ -415,6 +424,8 @@ SnpShutdown (
   // Find the LanDriver structure
   LanDriver = INSTANCE_FROM_SNP_THIS (Snp);
 
+  NetsecKickTxRing (LanDriver);
+
   ogma_stop_gmac (LanDriver->Handle, OGMA_TRUE, OGMA_TRUE);
 
   ogma_stop_desc_ring (LanDriver->Handle, OGMA_DESC_RING_ID_NRM_RX);
@@ -593,6 +604,23 @@ ExitUnlock:
   return Status;
 }
 
+/*
+ *  Write the TX ring doorbell for all frames whose submission was
+ *  deferred for coalescing.
+ */
+STATIC
+VOID
+NetsecKickTxRing (
+  IN  NETSEC_DRIVER   *LanDriver
+  )
+{
+  if (LanDriver->TxQueuedNum > 0) {
+    ogma_notify_tx_pkt_data (LanDriver->Handle, OGMA_DESC_RING_ID_NRM_TX,
+                             LanDriver->TxQueuedNum);
+    LanDriver->TxQueuedNum = 0;
+  }
+}
+
 /*
  *  UEFI GetStatus () function
  */
@@ -640,6 +668,9 @@ SnpGetStatus (
   // Find the LanDriver structure
   LanDriver = INSTANCE_FROM_SNP_THIS (Snp);
 
+  // Make sure deferred frames are in flight before checking completions
+  NetsecKickTxRing (LanDriver);
+
   ogma_err = ogma_clean_tx_desc_ring (LanDriver->Handle,
                                       OGMA_DESC_RING_ID_NRM_TX);
 
@@ -803,11 +834,28 @@ SnpTransmit (
   tx_pkt_ctrl.pass_through_flag     = OGMA_TRUE;
   tx_pkt_ctrl.target_desc_ring_id   = OGMA_DESC_RING_ID_GMAC;
 
+  //
+  // When doorbell coalescing is enabled, let frames accumulate on the
+  // ring and kick it once per batch; GetStatus() and Receive() flush
+  // any partial batch so a lone frame is never held back for long.
+  //
+  if (FixedPcdGet16 (PcdTxBatchNum) > 1) {
+    tx_pkt_ctrl.defer_notify_flag = OGMA_TRUE;
+  }
+
   // check empty slot
   do {
     tx_avail_num = ogma_get_tx_avail_num (LanDriver->Handle,
                                           OGMA_DESC_RING_ID_NRM_TX);
-  } while (tx_avail_num < SCAT_NUM);
+    if (tx_avail_num >= SCAT_NUM) {
+      break;
+    }
+    //
+    // The ring is full - make sure frames with a deferred doorbell
+    // write are in flight before waiting for a slot to open up.
+    //
+    NetsecKickTxRing (LanDriver);
+  } while (TRUE);
 
   // send
   ogma_err = ogma_set_tx_pkt_data (LanDriver->Handle,
@@ -832,6 +880,13 @@ SnpTransmit (
   //
   InsertTailList (&LanDriver->TxBufferList, &pkt_handle->Link);
 
+  if (tx_pkt_ctrl.defer_notify_flag) {
+    LanDriver->TxQueuedNum++;
+    if (LanDriver->TxQueuedNum >= FixedPcdGet16 (PcdTxBatchNum)) {
+      NetsecKickTxRing (LanDriver);
+    }
+  }
+
   gBS->RestoreTPL (SavedTpl);
   return EFI_SUCCESS;
 
@@ -894,11 +949,25 @@ SnpReceive (
   // Find the LanDriver structure
   LanDriver = INSTANCE_FROM_SNP_THIS (Snp);
 
-  if (ogma_get_rx_num (LanDriver->Handle, OGMA_DESC_RING_ID_NRM_RX) > 0) {
+  //
+  // The hardware packet counter is read-to-clear, so one register read
+  // harvests a whole group of completed RX descriptors; deliver from the
+  // cached count and only touch the counter again once it is drained.
+  //
+  if (LanDriver->RxPendingNum == 0) {
+    LanDriver->RxPendingNum = ogma_get_rx_num (LanDriver->Handle,
+                                OGMA_DESC_RING_ID_NRM_RX);
+  }
+
+  if (LanDriver->RxPendingNum > 0) {
 
     ogma_err = ogma_get_rx_pkt_data (LanDriver->Handle,
                                     OGMA_DESC_RING_ID_NRM_RX,
                                     &rx_pkt_info, &rx_data, &len, &pkt_handle);
+
+    // the descriptor is consumed even if delivery failed
+    LanDriver->RxPendingNum--;
+
     if (ogma_err != OGMA_ERR_OK) {
       DEBUG ((DEBUG_ERROR,
         "NETSEC: ogma_get_rx_pkt_data failed with error code: %d\n",
@@ -923,6 +992,8 @@ SnpReceive (
     *HdrSize = LanDriver->SnpMode.MediaHeaderSize;
   }
 
+  NetsecKickTxRing (LanDriver);
+
   ogma_clear_desc_ring_irq_status (LanDriver->Handle,
                                    OGMA_DESC_RING_ID_NRM_TX,
                                    OGMA_CH_IRQ_REG_EMPTY);
@@ -940,6 +1011,80 @@ ExitUnlock:
   return Status;
 }
 
+/*
+ *  Performance accounting wrappers. These sit between the protocol and
+ *  the real Transmit()/Receive() so the hot paths stay untouched.
+ */
+STATIC
+EFI_STATUS
+EFIAPI
+SnpTransmitTimed (
+  IN  EFI_SIMPLE_NETWORK_PROTOCOL   *Snp,
+  IN  UINTN                         HdrSize,
+  IN  UINTN                         BufSize,
+  IN  VOID                          *BufAddr,
+  IN  EFI_MAC_ADDRESS               *SrcAddr    OPTIONAL,
+  IN  EFI_MAC_ADDRESS               *DstAddr    OPTIONAL,
+  IN  UINT16                        *Protocol   OPTIONAL
+  )
+{
+  EFI_STATUS          Status;
+  SNP_PERF_STATS      *Stats;
+  UINT64              Start;
+
+  Start = SnpPerfTimestamp ();
+  Status = SnpTransmit (Snp, HdrSize, BufSize, BufAddr, SrcAddr, DstAddr,
+             Protocol);
+
+  if (Snp != NULL) {
+    Stats = INSTANCE_FROM_SNP_THIS (Snp)->PerfStats;
+    SnpPerfAddElapsed (&Stats->TxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->TxPackets++;
+      Stats->TxBytes += BufSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->TxRingFull++;
+    }
+  }
+
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+EFIAPI
+SnpReceiveTimed (
+  IN      EFI_SIMPLE_NETWORK_PROTOCOL   *Snp,
+      OUT UINTN                         *HdrSize    OPTIONAL,
+  IN  OUT UINTN                         *BuffSize,
+      OUT VOID                          *Data,
+      OUT EFI_MAC_ADDRESS               *SrcAddr    OPTIONAL,
+      OUT EFI_MAC_ADDRESS               *DstAddr    OPTIONAL,
+      OUT UINT16                        *Protocol   OPTIONAL
+  )
+{
+  EFI_STATUS          Status;
+  SNP_PERF_STATS      *Stats;
+  UINT64              Start;
+
+  Start = SnpPerfTimestamp ();
+  Status = SnpReceive (Snp, HdrSize, BuffSize, Data, SrcAddr, DstAddr,
+             Protocol);
+
+  if (Snp != NULL) {
+    Stats = INSTANCE_FROM_SNP_THIS (Snp)->PerfStats;
+    SnpPerfAddElapsed (&Stats->RxTicks, Start);
+    if (Status == EFI_SUCCESS) {
+      Stats->RxPackets++;
+      Stats->RxBytes += *BuffSize;
+    } else if (Status == EFI_NOT_READY) {
+      Stats->RxPollEmpty++;
+    }
+  }
+
+  return Status;
+}
+
 STATIC
 EFI_STATUS
 EFIAPI
@@ -1065,6 +1210,9 @@ NetsecInit (
   // Set the signature of the LAN Driver structure
   LanDriver->Signature = NETSEC_SIGNATURE;
 
+  // Register with the shared SNP performance table
+  LanDriver->PerfStats = SnpPerfRegister ("NetsecDxe");
+
   // Probe the device
   Status = Probe (DriverBindingHandle, LanDriver);
   if (EFI_ERROR (Status)) {
@@ -1087,8 +1235,8 @@ NetsecInit (
   Snp->MCastIpToMac = NULL;
   Snp->NvData = NULL;
   Snp->GetStatus = SnpGetStatus;
-  Snp->Transmit = SnpTransmit;
-  Snp->Receive = SnpReceive;
+  Snp->Transmit = SnpTransmitTimed;
+  Snp->Receive = SnpReceiveTimed;
 
   // Fill in simple network mode structure
   SnpMode->State = EfiSimpleNetworkStopped;
@@ -17,6 +17,7 @@
 #include <Library/IoLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/NetLib.h>
+#include <Library/SnpPerfLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiLib.h>
 
@@ -61,6 +62,17 @@ typedef struct {
   // List of submitted TX buffers
   LIST_ENTRY                        TxBufferList;
 
+  // Number of frames submitted to the TX ring whose doorbell write has
+  // been deferred for coalescing
+  UINT16                            TxQueuedNum;
+
+  // Completed RX descriptors harvested from the hardware packet counter
+  // but not yet delivered through SnpReceive()
+  UINT16                            RxPendingNum;
+
+  // Performance counters published through the SNP perf table
+  SNP_PERF_STATS                    *PerfStats;
+
   EFI_EVENT                         ExitBootEvent;
 
   EFI_EVENT                         PhyStatusEvent;
@@ -325,6 +325,7 @@ struct ogma_tx_pkt_ctrl_s{
     ogma_uint pass_through_flag:1;
     ogma_uint cksum_offload_flag:1;
     ogma_uint tcp_seg_offload_flag:1;
+    ogma_uint defer_notify_flag:1;
     ogma_desc_ring_id_t target_desc_ring_id;
     ogma_uint16 tcp_seg_len;
 };
@@ -527,6 +528,12 @@ ogma_err_t ogma_set_tx_pkt_data (
     pfdep_pkt_handle_t pkt_handle
     );
 
+ogma_err_t ogma_notify_tx_pkt_data (
+    ogma_handle_t ogma_handle,
+    ogma_desc_ring_id_t ring_id,
+    ogma_uint32 pkt_cnt
+    );
+
 ogma_err_t ogma_get_rx_pkt_data (
     ogma_handle_t ogma_handle,
     ogma_desc_ring_id_t ring_id,
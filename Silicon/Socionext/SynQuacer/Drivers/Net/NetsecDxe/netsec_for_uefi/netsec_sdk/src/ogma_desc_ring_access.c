@@ -1232,17 +1232,77 @@ ogma_err_t ogma_set_tx_pkt_data (
         ogma_inc_desc_head_idx( ctrl_p, desc_ring_p, 1);
     }
 
+    if ( !tx_pkt_ctrl_p->defer_notify_flag) {
+
+        pfdep_write_mem_barrier();
+
+        ogma_write_reg( ctrl_p,
+                        tx_pkt_cnt_reg_addr[ring_id],
+                        (ogma_uint32)1);
+    }
+
+end:
+    pfdep_release_soft_lock( &desc_ring_p->soft_lock,
+                             &soft_lock_ctx);
+
+    return ogma_err;
+}
+
+ogma_err_t ogma_notify_tx_pkt_data (
+    ogma_handle_t ogma_handle,
+    ogma_desc_ring_id_t ring_id,
+    ogma_uint32 pkt_cnt
+    )
+{
+    ogma_ctrl_t *ctrl_p = (ogma_ctrl_t *)ogma_handle;
+    ogma_desc_ring_t *desc_ring_p;
+
+    pfdep_err_t pfdep_err;
+    pfdep_soft_lock_ctx_t soft_lock_ctx;
+
+    pfdep_print( PFDEP_DEBUG_LEVEL_DEBUG, "%s call.\n", __func__);
+
+    if ( ( ctrl_p == NULL) ||
+         ( ring_id > OGMA_DESC_RING_ID_MAX) ) {
+        return OGMA_ERR_PARAM;
+    }
+
+    if ( !ctrl_p->desc_ring[ring_id].param.valid_flag) {
+        return OGMA_ERR_NOTAVAIL;
+    }
+
+    if ( !ctrl_p->desc_ring[ring_id].tx_desc_ring_flag) {
+        return OGMA_ERR_PARAM;
+    }
+
+    if ( pkt_cnt == 0) {
+        return OGMA_ERR_RANGE;
+    }
+
+    desc_ring_p = &ctrl_p->desc_ring[ring_id];
+
+    if ( ( pfdep_err = pfdep_acquire_soft_lock(
+              &desc_ring_p->soft_lock,
+              &soft_lock_ctx ) ) != PFDEP_ERR_OK) {
+        return OGMA_ERR_INTERRUPT;
+    }
+
+    if ( !desc_ring_p->running_flag) {
+        pfdep_release_soft_lock( &desc_ring_p->soft_lock,
+                                 &soft_lock_ctx);
+        return OGMA_ERR_NOTAVAIL;
+    }
+
     pfdep_write_mem_barrier();
 
     ogma_write_reg( ctrl_p,
                     tx_pkt_cnt_reg_addr[ring_id],
-                    (ogma_uint32)1);
+                    pkt_cnt);
 
-end:
     pfdep_release_soft_lock( &desc_ring_p->soft_lock,
                              &soft_lock_ctx);
 
-    return ogma_err;
+    return OGMA_ERR_OK;
 }
 
 ogma_err_t ogma_get_rx_pkt_data (
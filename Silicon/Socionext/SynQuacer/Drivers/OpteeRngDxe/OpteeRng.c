@@ -11,6 +11,7 @@
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/OpteeLib.h>
+#include <Library/PcdLib.h>
 #include <Library/TimerLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Protocol/Rng.h>
@@ -18,6 +19,96 @@
 #define PTA_COMMAND_GET_ENTROPY  0x0
 #define OPTEE_RNG_POOL_SIZE      (4 * 1024)
 
+//
+// Normal-world entropy pool. Each secure-world harvest fetches more bytes
+// than the caller asked for, so the small boot-time requests (ISNs, UUIDs,
+// seed handoff) drain the pool instead of each paying a world switch.
+// The pool is drained from the tail and consumed bytes are wiped.
+//
+STATIC UINT8 mEntropyPool[OPTEE_RNG_POOL_SIZE];
+STATIC UINTN mEntropyPoolLevel;
+
+/**
+  Refill the entropy pool from the OP-TEE RNG Trusted Application.
+
+  A single session is opened and the pool is topped up to the target level
+  with as few invocations as the application allows.
+
+  @param[in]  Target            Pool level in bytes to refill up to. Must not
+                                exceed OPTEE_RNG_POOL_SIZE.
+
+  @retval EFI_SUCCESS           The pool holds at least Target bytes.
+  @retval EFI_DEVICE_ERROR      A secure world call failed.
+
+**/
+STATIC
+EFI_STATUS
+RefillEntropyPool (
+  IN UINTN  Target
+  )
+{
+  EFI_STATUS                 Status;
+  OPTEE_OPEN_SESSION_ARG     OpenSessionArg;
+  OPTEE_INVOKE_FUNCTION_ARG  InvokeFunctionArg;
+  UINTN                      OutSize;
+  UINTN                      WaitMiliSeconds;
+
+  ZeroMem (&OpenSessionArg, sizeof (OPTEE_OPEN_SESSION_ARG));
+  CopyMem (&OpenSessionArg.Uuid, &gOpteeRngTaGuid, sizeof (EFI_GUID));
+
+  Status = OpteeOpenSession (&OpenSessionArg);
+  if ((Status != EFI_SUCCESS) || (OpenSessionArg.Return != OPTEE_SUCCESS)) {
+    DEBUG ((DEBUG_ERROR, "OP-TEE Open Session failed with return: %08x and"
+      "return origin: %d\n", OpenSessionArg.Return,
+      OpenSessionArg.ReturnOrigin));
+    return EFI_DEVICE_ERROR;
+  }
+
+  while (mEntropyPoolLevel < Target) {
+    ZeroMem (&InvokeFunctionArg, sizeof (OPTEE_INVOKE_FUNCTION_ARG));
+
+    InvokeFunctionArg.Function = PTA_COMMAND_GET_ENTROPY;
+    InvokeFunctionArg.Session = OpenSessionArg.Session;
+
+    InvokeFunctionArg.Params[0].Attribute =
+      OPTEE_MESSAGE_ATTRIBUTE_TYPE_MEMORY_INOUT;
+    InvokeFunctionArg.Params[0].Union.Memory.BufferAddress =
+      (UINTN)&mEntropyPool[mEntropyPoolLevel];
+    InvokeFunctionArg.Params[0].Union.Memory.Size =
+      OPTEE_RNG_POOL_SIZE - mEntropyPoolLevel;
+
+    Status = OpteeInvokeFunction (&InvokeFunctionArg);
+    if ((Status != EFI_SUCCESS) ||
+        (InvokeFunctionArg.Return != OPTEE_SUCCESS)) {
+      DEBUG ((DEBUG_ERROR, "OP-TEE Invoke Function failed with return: %x and"
+        "return origin: %d\n", InvokeFunctionArg.Return,
+        InvokeFunctionArg.ReturnOrigin));
+
+      OpteeCloseSession (OpenSessionArg.Session);
+
+      return EFI_DEVICE_ERROR;
+    }
+
+    OutSize = MIN (InvokeFunctionArg.Params[0].Union.Memory.Size,
+                OPTEE_RNG_POOL_SIZE - mEntropyPoolLevel);
+
+    mEntropyPoolLevel += OutSize;
+
+    //
+    // OP-TEE RNG Trusted application takes approximately 256ms for every 32
+    // bytes of full entropy output.
+    //
+    if (mEntropyPoolLevel < Target) {
+      WaitMiliSeconds = (((Target - mEntropyPoolLevel) + 32) * 256) / 32;
+      MicroSecondDelay (WaitMiliSeconds * 1000);
+    }
+  }
+
+  OpteeCloseSession (OpenSessionArg.Session);
+
+  return EFI_SUCCESS;
+}
+
 /**
   Returns information about the random number generation implementation.
 
@@ -111,12 +202,8 @@ GetRNG (
   OUT UINT8             *Value
 )
 {
-  EFI_STATUS                 Status;
-  OPTEE_OPEN_SESSION_ARG     OpenSessionArg;
-  OPTEE_INVOKE_FUNCTION_ARG  InvokeFunctionArg;
-  UINT8                      *OutPointer;
-  UINTN                      OutSize;
-  UINTN                      WaitMiliSeconds;
+  EFI_STATUS  Status;
+  UINTN       Target;
 
   if ((Value == NULL) || (ValueLength == 0)) {
     return EFI_INVALID_PARAMETER;
@@ -130,59 +217,24 @@ GetRNG (
     return EFI_UNSUPPORTED;
   }
 
-  ZeroMem (&OpenSessionArg, sizeof (OPTEE_OPEN_SESSION_ARG));
-  CopyMem (&OpenSessionArg.Uuid, &gOpteeRngTaGuid, sizeof (EFI_GUID));
-
-  Status = OpteeOpenSession (&OpenSessionArg);
-  if ((Status != EFI_SUCCESS) || (OpenSessionArg.Return != OPTEE_SUCCESS)) {
-    DEBUG ((DEBUG_ERROR, "OP-TEE Open Session failed with return: %08x and"
-      "return origin: %d\n", OpenSessionArg.Return,
-      OpenSessionArg.ReturnOrigin));
-    return EFI_DEVICE_ERROR;
-  }
-
-  OutPointer = Value;
-
-  while (ValueLength > 0) {
-    ZeroMem (&InvokeFunctionArg, sizeof (OPTEE_INVOKE_FUNCTION_ARG));
-
-    InvokeFunctionArg.Function = PTA_COMMAND_GET_ENTROPY;
-    InvokeFunctionArg.Session = OpenSessionArg.Session;
-
-    InvokeFunctionArg.Params[0].Attribute =
-      OPTEE_MESSAGE_ATTRIBUTE_TYPE_MEMORY_INOUT;
-    InvokeFunctionArg.Params[0].Union.Memory.BufferAddress =
-      (UINTN) OutPointer;
-    InvokeFunctionArg.Params[0].Union.Memory.Size = ValueLength;
-
-    Status = OpteeInvokeFunction (&InvokeFunctionArg);
-    if ((Status != EFI_SUCCESS) ||
-        (InvokeFunctionArg.Return != OPTEE_SUCCESS)) {
-      DEBUG ((DEBUG_ERROR, "OP-TEE Invoke Function failed with return: %x and"
-        "return origin: %d\n", InvokeFunctionArg.Return,
-        InvokeFunctionArg.ReturnOrigin));
-
-      OpteeCloseSession (OpenSessionArg.Session);
-
-      return EFI_DEVICE_ERROR;
-    }
-
-    OutSize = MIN (InvokeFunctionArg.Params[0].Union.Memory.Size, ValueLength);
-
-    OutPointer += OutSize;
-    ValueLength -= OutSize;
-
-    //
-    // OP-TEE RNG Trusted application takes approximately 256ms for every 32
-    // bytes of full entropy output.
-    //
-    if (ValueLength > 0) {
-      WaitMiliSeconds = ((ValueLength + 32) * 256) / 32;
-      MicroSecondDelay (WaitMiliSeconds * 1000);
+  //
+  // Harvest past the low-water mark when the pool cannot cover the request,
+  // so a burst of small requests is served by a single secure world trip.
+  //
+  if (mEntropyPoolLevel < ValueLength) {
+    Target = MAX (ValueLength, PcdGet32 (PcdOpteeRngPoolLowWater));
+    Status = RefillEntropyPool (MIN (Target, OPTEE_RNG_POOL_SIZE));
+    if (EFI_ERROR (Status)) {
+      return Status;
     }
   }
 
-  OpteeCloseSession (OpenSessionArg.Session);
+  //
+  // Drain from the tail and wipe what was handed out.
+  //
+  mEntropyPoolLevel -= ValueLength;
+  CopyMem (Value, &mEntropyPool[mEntropyPoolLevel], ValueLength);
+  ZeroMem (&mEntropyPool[mEntropyPoolLevel], ValueLength);
 
   return EFI_SUCCESS;
 }
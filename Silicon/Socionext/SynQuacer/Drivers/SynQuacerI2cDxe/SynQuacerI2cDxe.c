@@ -161,7 +161,7 @@ SynQuacerI2cMasterStart (
     MmioWrite8 (I2c->MmioBase + F_I2C_REG_DAR, SlaveAddress << 1);
   }
 
-  DEBUG ((DEBUG_INFO, "%a: slave:0x%02x\n", __FUNCTION__,
+  DEBUG ((DEBUG_VERBOSE, "%a: slave:0x%02x\n", __FUNCTION__,
     SlaveAddress));
 
   Bsr = MmioRead8 (I2c->MmioBase + F_I2C_REG_BSR);
@@ -173,7 +173,7 @@ SynQuacerI2cMasterStart (
   }
 
   if (Bsr & F_I2C_BSR_BB) { // Bus is busy
-    DEBUG ((DEBUG_INFO, "%a: Continuous Start\n", __FUNCTION__));
+    DEBUG ((DEBUG_VERBOSE, "%a: Continuous Start\n", __FUNCTION__));
     MmioWrite8 (I2c->MmioBase + F_I2C_REG_BCR, Bcr | F_I2C_BCR_SCC);
   } else {
     if (Bcr & F_I2C_BCR_MSS) {
@@ -181,7 +181,7 @@ SynQuacerI2cMasterStart (
         "%a: is not in master mode\n", __FUNCTION__));
       return EFI_DEVICE_ERROR;
     }
-    DEBUG ((DEBUG_INFO, "%a: Start Condition\n", __FUNCTION__));
+    DEBUG ((DEBUG_VERBOSE, "%a: Start Condition\n", __FUNCTION__));
     MmioWrite8 (I2c->MmioBase + F_I2C_REG_BCR,
                 Bcr | F_I2C_BCR_MSS | F_I2C_BCR_INTE | F_I2C_BCR_BEIE);
   }
@@ -204,6 +204,12 @@ WaitForInterrupt (
     if (Bsr & F_I2C_BCR_INT) {
       return EFI_SUCCESS;
     }
+
+    //
+    // Slow slaves may stretch the clock between bytes, so back off between
+    // the polls instead of hammering the bus interface.
+    //
+    CpuPause ();
   } while (Timeout--);
 
   return EFI_DEVICE_ERROR;
@@ -117,10 +117,15 @@ DriverStart (
   SIMPLE_NETWORK_DEVICE_PATH       *DevicePath;
   UINT64                           DefaultMacAddress;
   EFI_MAC_ADDRESS                  *SwapMacAddressPtr;
-  UINTN                            DescriptorSize;
+  UINTN                            TxRingSize;
+  UINTN                            RxRingSize;
   UINTN                            BufferSize;
   UINTN                            *RxBufferAddr;
   EFI_PHYSICAL_ADDRESS             RxBufferAddrMap;
+  DESIGNWARE_HW_DESCRIPTOR         *TxRingBase;
+  DESIGNWARE_HW_DESCRIPTOR         *RxRingBase;
+  EFI_PHYSICAL_ADDRESS             TxRingBaseMap;
+  EFI_PHYSICAL_ADDRESS             RxRingBaseMap;
 
   // Allocate Resources
   Snp = AllocatePages (EFI_SIZE_TO_PAGES (sizeof (SIMPLE_NETWORK_DRIVER)));
@@ -135,41 +140,54 @@ DriverStart (
                               Controller,
                               EFI_OPEN_PROTOCOL_BY_DRIVER);
 
-  // Size for descriptor
-  DescriptorSize = EFI_PAGES_TO_SIZE (sizeof (DESIGNWARE_HW_DESCRIPTOR));
+  // Each descriptor is padded out to a full cache line, so a whole ring
+  // can be allocated and mapped as one contiguous common buffer instead
+  // of one page and one mapping per descriptor.
+  TxRingSize = CONFIG_TX_DESCR_NUM * sizeof (DESIGNWARE_HW_DESCRIPTOR);
+  RxRingSize = CONFIG_RX_DESCR_NUM * sizeof (DESIGNWARE_HW_DESCRIPTOR);
   // Size for transmit and receive buffer
   BufferSize = ETH_BUFSIZE;
 
-  for (int Index=0; Index < DESC_NUM; Index++) {
-    //DMA TxdescRing allocate buffer and map
-    Status = DmaAllocateBuffer (EfiBootServicesData,
-               EFI_SIZE_TO_PAGES (sizeof (DESIGNWARE_HW_DESCRIPTOR)), (VOID *)&Snp->MacDriver.TxdescRing[Index]);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "%a () for TxdescRing: %r\n", __FUNCTION__, Status));
-      return Status;
-    }
+  //DMA TxdescRing allocate buffer and map
+  Status = DmaAllocateBuffer (EfiBootServicesData,
+             EFI_SIZE_TO_PAGES (TxRingSize), (VOID *)&TxRingBase);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a () for TxdescRing: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
 
-    Status = DmaMap (MapOperationBusMasterCommonBuffer, Snp->MacDriver.TxdescRing[Index],
-               &DescriptorSize, &Snp->MacDriver.TxdescRingMap[Index].AddrMap, &Snp->MacDriver.TxdescRingMap[Index].Mapping);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "%a () for TxdescRing: %r\n", __FUNCTION__, Status));
-      return Status;
-    }
+  Status = DmaMap (MapOperationBusMasterCommonBuffer, TxRingBase,
+             &TxRingSize, &TxRingBaseMap, &Snp->MacDriver.TxdescRingMap[0].Mapping);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a () for TxdescRing: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
 
-    // DMA RxdescRing allocte buffer and map
-    Status = DmaAllocateBuffer (EfiBootServicesData,
-               EFI_SIZE_TO_PAGES (sizeof (DESIGNWARE_HW_DESCRIPTOR)), (VOID *)&Snp->MacDriver.RxdescRing[Index]);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "%a () for RxdescRing: %r\n", __FUNCTION__, Status));
-      return Status;
-    }
+  // DMA RxdescRing allocte buffer and map
+  Status = DmaAllocateBuffer (EfiBootServicesData,
+             EFI_SIZE_TO_PAGES (RxRingSize), (VOID *)&RxRingBase);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a () for RxdescRing: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
 
-    Status = DmaMap (MapOperationBusMasterCommonBuffer, Snp->MacDriver.RxdescRing[Index],
-               &DescriptorSize, &Snp->MacDriver.RxdescRingMap[Index].AddrMap, &Snp->MacDriver.RxdescRingMap[Index].Mapping);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "%a () for RxdescRing: %r\n", __FUNCTION__, Status));
-      return Status;
-    }
+  Status = DmaMap (MapOperationBusMasterCommonBuffer, RxRingBase,
+             &RxRingSize, &RxRingBaseMap, &Snp->MacDriver.RxdescRingMap[0].Mapping);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a () for RxdescRing: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
+
+  for (int Index=0; Index < CONFIG_TX_DESCR_NUM; Index++) {
+    Snp->MacDriver.TxdescRing[Index] = &TxRingBase[Index];
+    Snp->MacDriver.TxdescRingMap[Index].AddrMap =
+      TxRingBaseMap + Index * sizeof (DESIGNWARE_HW_DESCRIPTOR);
+  }
+
+  for (int Index=0; Index < CONFIG_RX_DESCR_NUM; Index++) {
+    Snp->MacDriver.RxdescRing[Index] = &RxRingBase[Index];
+    Snp->MacDriver.RxdescRingMap[Index].AddrMap =
+      RxRingBaseMap + Index * sizeof (DESIGNWARE_HW_DESCRIPTOR);
 
     //DMA mapping for receive buffer
     RxBufferAddr = (UINTN*)((UINTN)Snp->MacDriver.RxBuffer + (Index * BufferSize));
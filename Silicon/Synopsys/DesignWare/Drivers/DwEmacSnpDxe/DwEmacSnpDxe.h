@@ -78,7 +78,6 @@ extern EFI_COMPONENT_NAME2_PROTOCOL      gSnpComponentName2;
 #define INSTANCE_FROM_SNP_THIS(a)        CR(a, SIMPLE_NETWORK_DRIVER, Snp, SNP_DRIVER_SIGNATURE)
 #define SNP_TX_BUFFER_INCREASE           32
 #define SNP_MAX_TX_BUFFER_NUM            65536
-#define DESC_NUM                         10
 #define ETH_BUFSIZE                      0x800
 /*---------------------------------------------------------------------------------------------------------------------
 
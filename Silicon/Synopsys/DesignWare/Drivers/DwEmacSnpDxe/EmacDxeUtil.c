@@ -233,7 +233,7 @@ EmacSetupTxdesc (
   for (Index = 0; Index < CONFIG_TX_DESCR_NUM; Index++) {
     TxDescriptor = (VOID *)(UINTN)EmacDriver->TxdescRingMap[Index].AddrMap;
     TxDescriptor->Addr = (UINT32)(UINTN)&EmacDriver->TxBuffer[Index * CONFIG_ETH_BUFSIZE];
-    if (Index < 9) {
+    if (Index < CONFIG_TX_DESCR_NUM - 1) {
       TxDescriptor->AddrNext = (UINT32)(UINTN)EmacDriver->TxdescRingMap[Index + 1].AddrMap;
     }
     TxDescriptor->Tdes0 = TDES0_TXCHAIN;
@@ -269,7 +269,7 @@ EmacSetupRxdesc (
   for (Index = 0; Index < CONFIG_RX_DESCR_NUM; Index++) {
     RxDescriptor = (VOID *)(UINTN)EmacDriver->RxdescRingMap[Index].AddrMap;
     RxDescriptor->Addr = EmacDriver->RxBufNum[Index].AddrMap;
-    if (Index < 9) {
+    if (Index < CONFIG_RX_DESCR_NUM - 1) {
       RxDescriptor->AddrNext = (UINT32)(UINTN)EmacDriver->RxdescRingMap[Index + 1].AddrMap;
     }
     RxDescriptor->Tdes0 = RDES0_OWN;
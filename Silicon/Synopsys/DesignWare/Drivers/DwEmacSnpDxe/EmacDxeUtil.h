@@ -19,14 +19,16 @@
 
 #include <Protocol/SimpleNetwork.h>
 
+#include <Library/PcdLib.h>
+
 // Most common CRC32 Polynomial for little endian machines
 #define CRC_POLYNOMIAL                                            0xEDB88320
 #define HASH_TABLE_REG(n)                                         0x500 + (0x4 * n)
 #define RX_MAX_PACKET                                             1600
 
 #define CONFIG_ETH_BUFSIZE                                         2048
-#define CONFIG_TX_DESCR_NUM                                        10
-#define CONFIG_RX_DESCR_NUM                                        10
+#define CONFIG_TX_DESCR_NUM                                        FixedPcdGet32 (PcdDwEmacDxeTxDescNum)
+#define CONFIG_RX_DESCR_NUM                                        FixedPcdGet32 (PcdDwEmacDxeRxDescNum)
 #define TX_TOTAL_BUFSIZE                                           (CONFIG_ETH_BUFSIZE * CONFIG_TX_DESCR_NUM)
 #define RX_TOTAL_BUFSIZE                                           (CONFIG_ETH_BUFSIZE * CONFIG_RX_DESCR_NUM)
 
@@ -234,8 +236,17 @@ typedef struct {
   UINT32 Tdes1;
   UINT32 Addr;
   UINT32 AddrNext;
+  // Pad each descriptor out to its own data cache line (64 bytes on the
+  // Cortex-A cores this EMAC is integrated with) so that maintenance or
+  // a DMA snoop on one descriptor can never touch its neighbour.  The
+  // DMA follows AddrNext in chained mode, so the hardware never sees
+  // the padding.
+  UINT32 Reserved[12];
 } DESIGNWARE_HW_DESCRIPTOR;
 
+STATIC_ASSERT (sizeof (DESIGNWARE_HW_DESCRIPTOR) == 64,
+  "DESIGNWARE_HW_DESCRIPTOR must cover exactly one cache line");
+
 typedef struct {
   EFI_PHYSICAL_ADDRESS        AddrMap;
   void                        *Mapping;
@@ -248,7 +259,7 @@ typedef struct {
   CHAR8                       RxBuffer[RX_TOTAL_BUFSIZE];
   MAP_INFO                    TxdescRingMap[CONFIG_TX_DESCR_NUM ];
   MAP_INFO                    RxdescRingMap[CONFIG_RX_DESCR_NUM ];
-  MAP_INFO                    RxBufNum[CONFIG_TX_DESCR_NUM];
+  MAP_INFO                    RxBufNum[CONFIG_RX_DESCR_NUM];
   UINT32                      TxCurrentDescriptorNum;
   UINT32                      TxNextDescriptorNum;
   UINT32                      RxCurrentDescriptorNum;
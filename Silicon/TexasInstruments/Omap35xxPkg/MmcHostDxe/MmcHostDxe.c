@@ -36,21 +36,6 @@ MMCHS_DEVICE_PATH gMMCDevicePath = {
   }
 };
 
-BOOLEAN
-IgnoreCommand (
-  UINT32 Command
-  )
-{
-  switch(Command) {
-    case MMC_CMD12:
-      return TRUE;
-    case MMC_CMD13:
-      return TRUE;
-    default:
-      return FALSE;
-  }
-}
-
 UINT32
 TranslateCommand (
   UINT32 Command
@@ -65,9 +50,9 @@ TranslateCommand (
     case MMC_CMD3:
       Translation = CMD3;
       break;
-    /*case MMC_CMD6:
+    case MMC_CMD6:
       Translation = CMD6;
-      break;*/
+      break;
     case MMC_CMD7:
       Translation = CMD7;
       break;
@@ -77,27 +62,36 @@ TranslateCommand (
     case MMC_CMD9:
       Translation = CMD9;
       break;
-    /*case MMC_CMD12:
+    case MMC_CMD12:
       Translation = CMD12;
       break;
     case MMC_CMD13:
       Translation = CMD13;
-      break;*/
+      break;
     case MMC_CMD16:
       Translation = CMD16;
       break;
     case MMC_CMD17:
       Translation = 0x113A0014;//CMD17;
       break;
+    case MMC_CMD18:
+      Translation = CMD18;
+      break;
     case MMC_CMD24:
       Translation = CMD24 | 4;
       break;
+    case MMC_CMD25:
+      Translation = CMD25;
+      break;
     case MMC_CMD55:
       Translation = CMD55;
       break;
     case MMC_ACMD41:
       Translation = ACMD41;
       break;
+    case MMC_ACMD51:
+      Translation = ACMD51;
+      break;
     default:
       Translation = Command;
   }
@@ -333,19 +327,37 @@ MMCSendCommand (
 {
   UINTN MmcStatus;
   UINTN RetryCount = 0;
+  UINTN BlockLen;
 
-  if (IgnoreCommand(MmcCmd))
-    return EFI_SUCCESS;
+  // CMD6 and ACMD51 move short status blocks rather than full sectors.
+  switch (MmcCmd) {
+    case MMC_CMD6:
+      BlockLen = 64;
+      break;
+    case MMC_ACMD51:
+      BlockLen = 8;
+      break;
+    default:
+      BlockLen = BLEN_512BYTES;
+  }
 
   MmcCmd = TranslateCommand(MmcCmd);
 
   //DEBUG ((EFI_D_ERROR, "MMCSendCommand(%d)\n", MmcCmd));
 
-  // Check if command line is in use or not. Poll till command line is available.
-  while ((MmioRead32 (MMCHS_PSTATE) & DATI_MASK) == DATI_NOT_ALLOWED);
+  if (MmcCmd == CMD12) {
+    // CMD12 aborts an open-ended transfer, so it only needs the command
+    // line; waiting for the data lines would deadlock against the very
+    // transfer it is meant to stop.
+    while ((MmioRead32 (MMCHS_PSTATE) & CMDI_MASK) == CMDI_NOT_ALLOWED);
+  } else {
+    // Check if command line is in use or not. Poll till command line is available.
+    while ((MmioRead32 (MMCHS_PSTATE) & DATI_MASK) == DATI_NOT_ALLOWED);
+  }
 
-  // Provide the block size.
-  MmioWrite32 (MMCHS_BLK, BLEN_512BYTES);
+  // Provide the block size. The block count is left at zero as multi-block
+  // transfers are open-ended and terminated with CMD12.
+  MmioWrite32 (MMCHS_BLK, BlockLen);
 
   // Setting Data timeout counter value to max value.
   MmioAndThenOr32 (MMCHS_SYSCTL, ~DTO_MASK, DTO_VAL);
@@ -560,33 +572,53 @@ MMCReadBlockData (
 {
   UINTN MmcStatus;
   UINTN Count;
-  UINTN RetryCount = 0;
+  UINTN RetryCount;
+  UINTN BlockLen;
 
   DEBUG ((DEBUG_BLKIO, "MMCReadBlockData(LBA: 0x%x, Length: 0x%x, Buffer: 0x%x)\n", Lba, Length, Buffer));
 
-  // Check controller status to make sure there is no error.
-  while (RetryCount < MAX_RETRY_COUNT) {
-    do {
-      // Read Status.
-      MmcStatus = MmioRead32 (MMCHS_STAT);
-    } while(MmcStatus == 0);
+  // Data arrives one block per buffer read ready (BRR) window; drain a
+  // window per block until the whole transfer has been consumed.
+  while (Length > 0) {
+    BlockLen = MIN (Length, BLEN_512BYTES);
+    RetryCount = 0;
+
+    // Check controller status to make sure there is no error.
+    while (RetryCount < MAX_RETRY_COUNT) {
+      do {
+        // Read Status.
+        MmcStatus = MmioRead32 (MMCHS_STAT);
+      } while(MmcStatus == 0);
 
-    // Check if Buffer read ready (BRR) bit is set?
-    if (MmcStatus & BRR) {
+      // Check for data errors (timeout, CRC, end bit).
+      if (MmcStatus & (DTO | DCRC | DEB)) {
 
-      // Clear BRR bit
-      MmioOr32 (MMCHS_STAT, BRR);
+        // Perform soft-reset for mmci_dat line.
+        MmioOr32 (MMCHS_SYSCTL, SRD);
+        while ((MmioRead32 (MMCHS_SYSCTL) & SRD));
 
-      for (Count = 0; Count < Length / 4; Count++) {
-        *Buffer++ = MmioRead32(MMCHS_DATA);
+        return EFI_DEVICE_ERROR;
       }
-      break;
+
+      // Check if Buffer read ready (BRR) bit is set?
+      if (MmcStatus & BRR) {
+
+        // Clear BRR bit
+        MmioOr32 (MMCHS_STAT, BRR);
+
+        for (Count = 0; Count < BlockLen / 4; Count++) {
+          *Buffer++ = MmioRead32(MMCHS_DATA);
+        }
+        break;
+      }
+      RetryCount++;
     }
-    RetryCount++;
-  }
 
-  if (RetryCount == MAX_RETRY_COUNT) {
-    return EFI_TIMEOUT;
+    if (RetryCount == MAX_RETRY_COUNT) {
+      return EFI_TIMEOUT;
+    }
+
+    Length -= BlockLen;
   }
 
   return EFI_SUCCESS;
@@ -602,38 +634,105 @@ MMCWriteBlockData (
 {
   UINTN MmcStatus;
   UINTN Count;
-  UINTN RetryCount = 0;
+  UINTN RetryCount;
+  UINTN BlockLen;
+
+  // Data leaves one block per buffer write ready (BWR) window; fill a
+  // window per block until the whole transfer has been pushed out.
+  while (Length > 0) {
+    BlockLen = MIN (Length, BLEN_512BYTES);
+    RetryCount = 0;
+
+    // Check controller status to make sure there is no error.
+    while (RetryCount < MAX_RETRY_COUNT) {
+      do {
+        // Read Status.
+        MmcStatus = MmioRead32 (MMCHS_STAT);
+      } while(MmcStatus == 0);
+
+      // Check for data errors (timeout, CRC, end bit).
+      if (MmcStatus & (DTO | DCRC | DEB)) {
+
+        // Perform soft-reset for mmci_dat line.
+        MmioOr32 (MMCHS_SYSCTL, SRD);
+        while ((MmioRead32 (MMCHS_SYSCTL) & SRD));
+
+        return EFI_DEVICE_ERROR;
+      }
 
-  // Check controller status to make sure there is no error.
-  while (RetryCount < MAX_RETRY_COUNT) {
-    do {
-      // Read Status.
-      MmcStatus = MmioRead32 (MMCHS_STAT);
-    } while(MmcStatus == 0);
+      // Check if Buffer write ready (BWR) bit is set?
+      if (MmcStatus & BWR) {
 
-    // Check if Buffer write ready (BWR) bit is set?
-    if (MmcStatus & BWR) {
+        // Clear BWR bit
+        MmioOr32 (MMCHS_STAT, BWR);
 
-      // Clear BWR bit
-      MmioOr32 (MMCHS_STAT, BWR);
+        // Write block worth of data.
+        for (Count = 0; Count < BlockLen / 4; Count++) {
+          MmioWrite32 (MMCHS_DATA, *Buffer++);
+        }
 
-      // Write block worth of data.
-      for (Count = 0; Count < Length / 4; Count++) {
-        MmioWrite32 (MMCHS_DATA, *Buffer++);
+        break;
       }
+      RetryCount++;
+    }
 
-      break;
+    if (RetryCount == MAX_RETRY_COUNT) {
+      return EFI_TIMEOUT;
     }
-    RetryCount++;
+
+    Length -= BlockLen;
   }
 
-  if (RetryCount == MAX_RETRY_COUNT) {
-    return EFI_TIMEOUT;
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+MMCSetIos (
+  IN EFI_MMC_HOST_PROTOCOL    *This,
+  IN UINT32                   BusClockFreq,
+  IN UINT32                   BusWidth,
+  IN UINT32                   TimingMode
+  )
+{
+  DEBUG ((DEBUG_BLKIO, "MMCSetIos(Freq: %d, Width: %d)\n", BusClockFreq, BusWidth));
+
+  if (BusClockFreq != 0) {
+    if (BusClockFreq > MMC_REFERENCE_CLK) {
+      return EFI_UNSUPPORTED;
+    }
+
+    // Divide the reference clock down to the closest rate not above the
+    // requested one. The high speed switch lands on 48 MHz this way; the
+    // OMAP3 MMCHS has no separate high speed enable bit.
+    UpdateMMCHSClkFrequency ((MMC_REFERENCE_CLK / BusClockFreq) + 1);
+  }
+
+  switch (BusWidth) {
+    case 0:
+      break;
+    case 1:
+      MmioAnd32 (MMCHS_HCTL, ~DTW_4_BIT);
+      mBitModeSet = FALSE;
+      break;
+    case 4:
+      MmioOr32 (MMCHS_HCTL, DTW_4_BIT);
+      mBitModeSet = TRUE;
+      break;
+    default:
+      return EFI_UNSUPPORTED;
   }
 
   return EFI_SUCCESS;
 }
 
+BOOLEAN
+MMCIsMultiBlock (
+  IN EFI_MMC_HOST_PROTOCOL    *This
+  )
+{
+  return TRUE;
+}
+
 EFI_MMC_HOST_PROTOCOL gMMCHost = {
   MMC_HOST_PROTOCOL_REVISION,
   MMCIsCardPresent,
@@ -643,7 +742,9 @@ EFI_MMC_HOST_PROTOCOL gMMCHost = {
   MMCSendCommand,
   MMCReceiveResponse,
   MMCReadBlockData,
-  MMCWriteBlockData
+  MMCWriteBlockData,
+  MMCSetIos,
+  MMCIsMultiBlock
 };
 
 EFI_STATUS